@@ -131,6 +131,35 @@ static void skip_input_unicode_replacement_ztd_text_view(benchmark::State& state
 	}
 }
 
+static void skip_input_unicode_replacement_ztd_text_run(benchmark::State& state) {
+	using from_char_t = ztd_char8_t;
+	using to_char_t   = ztd_char16_t;
+	const std::vector<from_char_t> input_data(
+	     c_span_char8_t_data(u8_data), c_span_char8_t_data(u8_data) + c_span_char8_t_size(u8_data));
+	std::vector<to_char_t> output_data(c_span_char16_t_size(u16_data));
+	bool result = true;
+	for (auto _ : state) {
+		size_t input_size        = input_data.size();
+		const from_char_t* input = input_data.data();
+		size_t output_size       = output_data.size();
+		to_char_t* output        = output_data.data();
+		auto err                 = ztd::text::transcode_into_raw(ztd::span(input, input_size), ztd::text::utf8,
+		                     ztd::span(output, output_size), ztd::text::utf16, ztd::text::run_replacement_handler,
+		                     ztd::text::run_replacement_handler);
+		if (err.error_code != ztd::text::encoding_error::ok) {
+			result = false;
+		}
+	}
+	const bool is_equal = std::equal(output_data.cbegin(), output_data.cend(), c_span_char16_t_data(u16_data),
+	     c_span_char16_t_data(u16_data) + c_span_char16_t_size(u16_data));
+	if (!result) {
+		state.SkipWithError("conversion failed with an error");
+	}
+	else if (!is_equal) {
+		state.SkipWithError("conversion succeeded but produced illegitimate data");
+	}
+}
+
 static void skip_input_ascii_replacement_ztd_text(benchmark::State& state) {
 	using from_char_t = ztd_char8_t;
 	using to_char_t   = ztd_char16_t;
@@ -315,6 +344,7 @@ static void skip_input_no_replacement_ztd_text_view(benchmark::State& state) {
 BENCHMARK(skip_input_unicode_replacement_ztd_text);
 BENCHMARK(skip_input_unicode_replacement_ztd_text_unbounded);
 BENCHMARK(skip_input_unicode_replacement_ztd_text_view);
+BENCHMARK(skip_input_unicode_replacement_ztd_text_run);
 
 BENCHMARK(skip_input_ascii_replacement_ztd_text);
 BENCHMARK(skip_input_ascii_replacement_ztd_text_unbounded);
@@ -437,4 +437,24 @@
 #define ZTD_TEXT_BENCHMARKS_ERROR_HANDLING_ZTD_TEXT_BASIC_UNCHECKED_BENCHMARKS_I_ ZTD_DEFAULT_ON
 #endif
 
+#if defined(ZTD_TEXT_BENCHMARKS_LEGACY_CONVERSION_SPEED_ZTD_TEXT_BENCHMARKS)
+#if (ZTD_TEXT_BENCHMARKS_LEGACY_CONVERSION_SPEED_ZTD_TEXT_BENCHMARKS != 0)
+#define ZTD_TEXT_BENCHMARKS_LEGACY_CONVERSION_SPEED_ZTD_TEXT_BENCHMARKS_I_ ZTD_ON
+#else
+#define ZTD_TEXT_BENCHMARKS_LEGACY_CONVERSION_SPEED_ZTD_TEXT_BENCHMARKS_I_ ZTD_OFF
+#endif
+#else
+#define ZTD_TEXT_BENCHMARKS_LEGACY_CONVERSION_SPEED_ZTD_TEXT_BENCHMARKS_I_ ZTD_DEFAULT_ON
+#endif
+
+#if defined(ZTD_TEXT_BENCHMARKS_LEGACY_CONVERSION_SPEED_LIBICONV_BENCHMARKS)
+#if (ZTD_TEXT_BENCHMARKS_LEGACY_CONVERSION_SPEED_LIBICONV_BENCHMARKS != 0)
+#define ZTD_TEXT_BENCHMARKS_LEGACY_CONVERSION_SPEED_LIBICONV_BENCHMARKS_I_ ZTD_ON
+#else
+#define ZTD_TEXT_BENCHMARKS_LEGACY_CONVERSION_SPEED_LIBICONV_BENCHMARKS_I_ ZTD_OFF
+#endif
+#else
+#define ZTD_TEXT_BENCHMARKS_LEGACY_CONVERSION_SPEED_LIBICONV_BENCHMARKS_I_ ZTD_DEFAULT_ON
+#endif
+
 #endif
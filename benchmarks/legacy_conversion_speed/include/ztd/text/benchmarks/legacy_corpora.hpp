@@ -0,0 +1,221 @@
+// ============================================================================
+//
+// ztd.text
+// Copyright © JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file
+// in accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ========================================================================= //
+
+#pragma once
+
+#ifndef ZTD_TEXT_BENCHMARKS_LEGACY_CORPORA_HPP
+#define ZTD_TEXT_BENCHMARKS_LEGACY_CORPORA_HPP
+
+#include <ztd/text.hpp>
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace ztd { namespace benchmarks {
+	namespace legacy_text {
+		// Latin-heavy prose: mostly ASCII, with the occasional accented letter and symbol.
+		inline constexpr std::u32string_view english
+		     = U"The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs. The café menu "
+		       U"listed crème brûlée, a jalapeño dip, and a naïve smörgåsbord for €12.50 per person. ";
+		inline constexpr std::u32string_view western
+		     = U"Voix ambiguë d'un cœur qui, au zéphyr, préfère les jattes de kiwis. Falsches Üben von "
+		       U"Xylophonmusik quält jeden größeren Zwerg. El pingüino Wenceslao hizo kilómetros bajo exhaustiva "
+		       U"lluvia y frío. ";
+		inline constexpr std::u32string_view central_european
+		     = U"Pchnąć w tę łódź jeża lub ośm skrzyń fig. Příliš žluťoučký kůň úpěl ďábelské ódy. Árvíztűrő "
+		       U"tükörfúrógép. ";
+		inline constexpr std::u32string_view turkish
+		     = U"Pijamalı hasta yağız şoföre çabucak güvendi. Öküz ağzı gibi büyük bir çanta taşıyordu. ";
+		inline constexpr std::u32string_view baltic
+		     = U"Įlinkdama fechtuotojo špaga sublykčiojusi pragręžė apvalų arbūzą. Glāžšķūņa rūķīši dzērumā "
+		       U"čiepj Baha koncertflīģeļu vākus. ";
+		inline constexpr std::u32string_view cyrillic
+		     = U"Съешь же ещё этих мягких французских булок, да выпей чаю. В чащах юга жил бы цитрус? Да, но "
+		       U"фальшивый экземпляр! ";
+		inline constexpr std::u32string_view greek
+		     = U"Ξεσκεπάζω την ψυχοφθόρα βδελυγμία. Θα ήθελα να μάθω ελληνικά γρήγορα και σωστά, όπως οι "
+		       U"φίλοι μου. ";
+		inline constexpr std::u32string_view hebrew = U"דג סקרן שט בים מאוכזב ולפתע מצא חברה. ";
+		inline constexpr std::u32string_view arabic
+		     = U"نص حكيم له سر قاطع وذو شأن عظيم مكتوب على ثوب أخضر ومغلف بجلد أزرق. ";
+		// CJK-heavy prose, with the usual amount of ASCII punctuation and digits mixed in.
+		inline constexpr std::u32string_view japanese
+		     = U"吾輩は猫である。名前はまだ無い。どこで生れたかとんと見当がつかぬ。何でも薄暗いじめじめした所で"
+		       U"ニャーニャー泣いていた事だけは記憶している。いろはにほへと ちりぬるを わかよたれそ つねならむ。"
+		       U"第1章 (2023年) ";
+		inline constexpr std::u32string_view chinese_simplified
+		     = U"我能吞下玻璃而不伤身体。天地玄黄，宇宙洪荒。日月盈昃，辰宿列张。寒来暑往，秋收冬藏。"
+		       U"闰余成岁，律吕调阳。第1章 (2023年) ";
+		inline constexpr std::u32string_view chinese_traditional
+		     = U"我能吞下玻璃而不傷身體。天地玄黃，宇宙洪荒。日月盈昃，辰宿列張。寒來暑往，秋收冬藏。"
+		       U"閏餘成歲，律呂調陽。第1章 (2023年) ";
+		inline constexpr std::u32string_view korean
+		     = U"다람쥐 헌 쳇바퀴에 타고파. 키스의 고유조건은 입술끼리 만나야 하고 특별한 기술은 필요치 않다. "
+		       U"제1장 (2023년) ";
+		// A little bit of everything, including characters outside of the BMP.
+		inline constexpr std::u32string_view mixed
+		     = U"The quick brown fox 🦊 jumps. Съешь же ещё этих булок. Ξεσκεπάζω την ψυχοφθόρα. 吾輩は猫である。"
+		       U"다람쥐 헌 쳇바퀴에 타고파. 天地玄黄，宇宙洪荒。 café ∑ 😀 ";
+	} // namespace legacy_text
+
+	using utf8_code_unit = ztd::text::code_unit_t<ztd::text::utf8_t>;
+
+	//////
+	/// @brief The size, in code points, each corpus is repeated out to.
+	inline constexpr std::size_t legacy_corpus_code_points = 1 << 16;
+
+	//////
+	/// @brief How often an invalid code unit is inserted into the error-dense corpora, in code points.
+	inline constexpr std::size_t legacy_corpus_error_stride = 32;
+
+	//////
+	/// @brief A corpus in a specific legacy encoding alongside everything it decodes to.
+	///
+	/// @remarks Text the encoding cannot represent is replaced when the corpus is made, so `encoded` and `decoded`
+	/// are exact round-trips of one another unless the corpus was made error-dense.
+	template <typename Encoding>
+	struct legacy_corpus {
+		std::vector<ztd::text::code_unit_t<Encoding>> encoded;
+		std::vector<ztd::text::code_point_t<Encoding>> decoded;
+		std::vector<utf8_code_unit> utf8;
+		std::size_t error_count = 0;
+	};
+
+	//////
+	/// @brief Finds a code unit that, on its own and followed by ASCII, is always an error for the encoding. Returns
+	/// `false` if every code unit value is meaningful (e.g., ISO-8859-1).
+	template <typename Encoding>
+	bool find_invalid_code_unit(const Encoding& encoding, ztd::text::code_unit_t<Encoding>& invalid_code_unit) {
+		using code_unit = ztd::text::code_unit_t<Encoding>;
+		for (unsigned int value = 0xFF; value >= 0x80; --value) {
+			const code_unit input[3] = { static_cast<code_unit>(value), static_cast<code_unit>('A'),
+				static_cast<code_unit>('A') };
+			auto result
+			     = ztd::text::decode_one(ztd::span<const code_unit>(input), encoding, ztd::text::pass_handler);
+			if (result.error_code != ztd::text::encoding_error::ok && ztd::ranges::size(result.input) == 2) {
+				invalid_code_unit = input[0];
+				return true;
+			}
+		}
+		return false;
+	}
+
+	//////
+	/// @brief Builds a corpus for the given encoding by repeating `text` and running it through the encoding.
+	///
+	/// @param[in] encoding The legacy encoding.
+	/// @param[in] text The seed text; repeated until it is legacy_corpus_code_points long.
+	/// @param[in] error_dense Whether an invalid code unit should be inserted every legacy_corpus_error_stride code
+	/// points.
+	///
+	/// @returns The corpus; `encoded` is left empty if an error-dense corpus was requested but the encoding has no
+	/// invalid code unit.
+	template <typename Encoding>
+	legacy_corpus<Encoding> make_legacy_corpus(
+		const Encoding& encoding, std::u32string_view text, bool error_dense) {
+		using code_unit  = ztd::text::code_unit_t<Encoding>;
+		using code_point = ztd::text::code_point_t<Encoding>;
+		legacy_corpus<Encoding> corpus {};
+		std::vector<code_point> source;
+		source.reserve(legacy_corpus_code_points);
+		while (source.size() < legacy_corpus_code_points) {
+			for (char32_t c : text) {
+				source.push_back(static_cast<code_point>(c));
+			}
+		}
+		// round-trip, so that whatever the encoding cannot represent is replaced up-front
+		std::vector<code_point> representable = ztd::text::decode<std::vector<code_point>>(
+		     ztd::text::encode<std::vector<code_unit>>(source, encoding, ztd::text::replacement_handler), encoding,
+		     ztd::text::replacement_handler);
+		if (!error_dense) {
+			corpus.encoded = ztd::text::encode<std::vector<code_unit>>(
+			     representable, encoding, ztd::text::replacement_handler);
+		}
+		else {
+			code_unit invalid_code_unit {};
+			if (!find_invalid_code_unit(encoding, invalid_code_unit)) {
+				return corpus;
+			}
+			for (std::size_t index = 0; index < representable.size(); ++index) {
+				if ((index % legacy_corpus_error_stride) == 0) {
+					corpus.encoded.push_back(invalid_code_unit);
+				}
+				std::vector<code_unit> encoded_code_point = ztd::text::encode<std::vector<code_unit>>(
+				     ztd::span<const code_point>(representable.data() + index, 1), encoding,
+				     ztd::text::replacement_handler);
+				corpus.encoded.insert(corpus.encoded.end(), encoded_code_point.begin(), encoded_code_point.end());
+			}
+		}
+		auto decode_result = ztd::text::decode_to<std::vector<code_point>>(
+		     corpus.encoded, encoding, ztd::text::replacement_handler);
+		corpus.decoded     = std::move(decode_result.output);
+		corpus.error_count = decode_result.error_count;
+		corpus.utf8 = ztd::text::encode<std::vector<utf8_code_unit>>(
+		     corpus.decoded, ztd::text::utf8, ztd::text::pass_handler);
+		return corpus;
+	}
+
+	//////
+	/// @brief Builds a corpus of individual labels, one per word of `text`, for label-based encodings such as
+	/// ztd::text::punycode_t.
+	template <typename Encoding>
+	std::vector<legacy_corpus<Encoding>> make_legacy_label_corpus(
+		const Encoding& encoding, std::u32string_view text) {
+		using code_unit  = ztd::text::code_unit_t<Encoding>;
+		using code_point = ztd::text::code_point_t<Encoding>;
+		std::vector<legacy_corpus<Encoding>> labels;
+		std::size_t code_points = 0;
+		while (code_points < legacy_corpus_code_points) {
+			std::size_t word_first = 0;
+			for (std::size_t index = 0; index <= text.size(); ++index) {
+				if (index != text.size() && text[index] != U' ') {
+					continue;
+				}
+				if (index != word_first) {
+					legacy_corpus<Encoding> label {};
+					for (char32_t c : text.substr(word_first, index - word_first)) {
+						label.decoded.push_back(static_cast<code_point>(c));
+					}
+					label.encoded = ztd::text::encode<std::vector<code_unit>>(
+					     label.decoded, encoding, ztd::text::pass_handler);
+					label.utf8 = ztd::text::encode<std::vector<utf8_code_unit>>(
+					     label.decoded, ztd::text::utf8, ztd::text::pass_handler);
+					code_points += label.decoded.size();
+					labels.push_back(std::move(label));
+				}
+				word_first = index + 1;
+			}
+		}
+		return labels;
+	}
+}} // namespace ztd::benchmarks
+
+#endif
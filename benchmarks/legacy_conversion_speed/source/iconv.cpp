@@ -0,0 +1,305 @@
+// ============================================================================
+//
+// ztd.text
+// Copyright © JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file
+// in accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ========================================================================= //
+
+#include <ztd/text/benchmarks/version.hpp>
+
+#if ZTD_IS_ON(ZTD_TEXT_BENCHMARKS_LEGACY_CONVERSION_SPEED_LIBICONV_BENCHMARKS)
+
+#include <ztd/platform.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <ztd/text/benchmarks/legacy_corpora.hpp>
+
+#include <ztd/text/iconv_names.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+inline namespace ztd_text_benchmarks_legacy_conversion_speed_iconv {
+	struct descriptor_deleter {
+
+		struct pointer {
+			ztd::plat::icnv::descriptor handle;
+
+			pointer(::std::nullptr_t = nullptr) noexcept : handle(ztd::plat::icnv::failure_descriptor) {
+			}
+
+			pointer(ztd::plat::icnv::descriptor desc) noexcept : handle(desc) {
+			}
+
+			pointer(const pointer&) noexcept = default;
+			pointer(pointer&&) noexcept      = default;
+
+			pointer& operator=(const pointer&) noexcept = default;
+			pointer& operator=(pointer&&) noexcept      = default;
+
+			explicit operator bool() const noexcept {
+				return *this != nullptr;
+			}
+
+			operator ztd::plat::icnv::descriptor() const noexcept {
+				return this->handle;
+			}
+
+			friend bool operator==(pointer p, ::std::nullptr_t) noexcept {
+				return !ztd::plat::icnv::descriptor_is_valid(p.handle);
+			}
+
+			friend bool operator==(::std::nullptr_t, pointer p) noexcept {
+				return !ztd::plat::icnv::descriptor_is_valid(p.handle);
+			}
+
+			friend bool operator!=(pointer p, ::std::nullptr_t) noexcept {
+				return ztd::plat::icnv::descriptor_is_valid(p.handle);
+			}
+
+			friend bool operator!=(::std::nullptr_t, pointer p) noexcept {
+				return ztd::plat::icnv::descriptor_is_valid(p.handle);
+			}
+		};
+
+		void operator()(pointer convd) noexcept {
+			const auto& iconv_functions = ztd::plat::icnv::functions();
+			iconv_functions.close(convd.handle);
+		}
+	};
+
+	using unique_descriptor = std::unique_ptr<ztd::plat::icnv::descriptor, descriptor_deleter>;
+
+	inline unique_descriptor open_descriptor(const char* to_name, const char* from_name) {
+		const auto& iconv_functions          = ztd::plat::icnv::functions();
+		descriptor_deleter::pointer raw_convd = iconv_functions.open(to_name, from_name);
+		if (!ztd::plat::icnv::descriptor_is_valid(raw_convd)) {
+			return nullptr;
+		}
+		return unique_descriptor(raw_convd);
+	}
+
+	// Converts all of the input, skipping a single input byte and writing the replacement bytes for every
+	// ill-formed or incomplete sequence, in the same way the replacement_handler used on the ztd.text side does.
+	// Returns false only if the output ran out of space.
+	inline bool convert_replacing(ztd::plat::icnv::descriptor convd, const char* input, size_t input_size,
+		char* output, size_t output_size, const char* replacement, size_t replacement_size) {
+		const auto& iconv_functions = ztd::plat::icnv::functions();
+		iconv_functions.convert(convd, nullptr, nullptr, nullptr, nullptr);
+		while (input_size > 0) {
+			size_t conv_result = iconv_functions.convert(convd, &input, &input_size, &output, &output_size);
+			if (conv_result != ztd::plat::icnv::conversion_failure) {
+				break;
+			}
+			if (output_size < replacement_size) {
+				return false;
+			}
+			++input;
+			--input_size;
+			output      = std::copy(replacement, replacement + replacement_size, output);
+			output_size -= replacement_size;
+			iconv_functions.convert(convd, nullptr, nullptr, nullptr, nullptr);
+		}
+		return true;
+	}
+
+	template <typename Encoding>
+	void set_legacy_counters(benchmark::State& state, const ztd::benchmarks::legacy_corpus<Encoding>& corpus) {
+		state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations())
+		     * static_cast<std::int64_t>(corpus.encoded.size() * sizeof(corpus.encoded[0])));
+		state.counters["code_points"] = benchmark::Counter(
+		     static_cast<double>(corpus.decoded.size()), benchmark::Counter::kIsIterationInvariantRate);
+		state.counters["errors"] = static_cast<double>(corpus.error_count);
+	}
+
+	template <typename Encoding>
+	void legacy_decode_benchmark(
+		benchmark::State& state, const char* iconv_name, const ztd::benchmarks::legacy_corpus<Encoding>& corpus) {
+		static constexpr char32_t replacement[1] = { U'\uFFFD' };
+		if (corpus.encoded.empty()) {
+			state.SkipWithError("the encoding has no invalid code unit to build an error-dense corpus from");
+			return;
+		}
+		unique_descriptor convd = open_descriptor(ztd::text::iconv_utf32_name.data(), iconv_name);
+		if (!convd) {
+			state.SkipWithError("iconv does not support this encoding");
+			return;
+		}
+		std::vector<char32_t> output_data(corpus.decoded.size());
+		bool result = true;
+		for (auto _ : state) {
+			if (!convert_replacing(convd.get(), reinterpret_cast<const char*>(corpus.encoded.data()),
+			         corpus.encoded.size() * sizeof(corpus.encoded[0]), reinterpret_cast<char*>(output_data.data()),
+			         output_data.size() * sizeof(output_data[0]), reinterpret_cast<const char*>(replacement),
+			         sizeof(replacement))) {
+				result = false;
+			}
+		}
+		// iconv implementations differ from one another (and from ztd.text) in how much input an error consumes,
+		// so only well-formed output is checked
+		const bool is_equal = corpus.error_count != 0
+		     || std::equal(output_data.cbegin(), output_data.cend(), corpus.decoded.cbegin(), corpus.decoded.cend(),
+		          [](char32_t left, auto right) { return left == static_cast<char32_t>(right); });
+		if (!result) {
+			state.SkipWithError("conversion failed with an error");
+		}
+		else if (!is_equal) {
+			state.SkipWithError("conversion succeeded but produced illegitimate data");
+		}
+		set_legacy_counters(state, corpus);
+	}
+
+	template <typename Encoding>
+	void legacy_encode_benchmark(
+		benchmark::State& state, const char* iconv_name, const ztd::benchmarks::legacy_corpus<Encoding>& corpus) {
+		static constexpr char replacement[1] = { '?' };
+		unique_descriptor convd              = open_descriptor(iconv_name, ztd::text::iconv_utf32_name.data());
+		if (!convd) {
+			state.SkipWithError("iconv does not support this encoding");
+			return;
+		}
+		std::vector<char32_t> input_data(corpus.decoded.cbegin(), corpus.decoded.cend());
+		std::vector<char> output_data(corpus.encoded.size() * sizeof(corpus.encoded[0]));
+		bool result = true;
+		for (auto _ : state) {
+			if (!convert_replacing(convd.get(), reinterpret_cast<const char*>(input_data.data()),
+			         input_data.size() * sizeof(input_data[0]), output_data.data(), output_data.size(), replacement,
+			         sizeof(replacement))) {
+				result = false;
+			}
+		}
+		const bool is_equal = std::equal(output_data.cbegin(), output_data.cend(),
+		     reinterpret_cast<const char*>(corpus.encoded.data()),
+		     reinterpret_cast<const char*>(corpus.encoded.data() + corpus.encoded.size()));
+		if (!result) {
+			state.SkipWithError("conversion failed with an error");
+		}
+		else if (!is_equal) {
+			state.SkipWithError("conversion succeeded but produced illegitimate data");
+		}
+		set_legacy_counters(state, corpus);
+	}
+
+	template <typename Encoding>
+	void legacy_transcode_benchmark(
+		benchmark::State& state, const char* iconv_name, const ztd::benchmarks::legacy_corpus<Encoding>& corpus) {
+		static constexpr char replacement[3] = { '\xEF', '\xBF', '\xBD' };
+		if (corpus.encoded.empty()) {
+			state.SkipWithError("the encoding has no invalid code unit to build an error-dense corpus from");
+			return;
+		}
+		unique_descriptor convd = open_descriptor(ztd::text::iconv_utf8_name.data(), iconv_name);
+		if (!convd) {
+			state.SkipWithError("iconv does not support this encoding");
+			return;
+		}
+		std::vector<char> output_data(corpus.utf8.size());
+		bool result = true;
+		for (auto _ : state) {
+			if (!convert_replacing(convd.get(), reinterpret_cast<const char*>(corpus.encoded.data()),
+			         corpus.encoded.size() * sizeof(corpus.encoded[0]), output_data.data(), output_data.size(),
+			         replacement, sizeof(replacement))) {
+				result = false;
+			}
+		}
+		const bool is_equal = corpus.error_count != 0
+		     || std::equal(output_data.cbegin(), output_data.cend(),
+		          reinterpret_cast<const char*>(corpus.utf8.data()),
+		          reinterpret_cast<const char*>(corpus.utf8.data() + corpus.utf8.size()));
+		if (!result) {
+			state.SkipWithError("conversion failed with an error");
+		}
+		else if (!is_equal) {
+			state.SkipWithError("conversion succeeded but produced illegitimate data");
+		}
+		set_legacy_counters(state, corpus);
+	}
+} // namespace ztd_text_benchmarks_legacy_conversion_speed_iconv
+
+#define LEGACY_CORPUS_CONVERSION_BENCHMARKS(ENCODING, ICONV_NAME, CORPUS, TEXT, ERROR_DENSE)                      \
+	static const auto& ENCODING##_##CORPUS##_corpus() {                                                          \
+		static const auto corpus = ztd::benchmarks::make_legacy_corpus(ztd::text::ENCODING, TEXT, ERROR_DENSE); \
+		return corpus;                                                                                          \
+	}                                                                                                            \
+	static void ENCODING##_##CORPUS##_decode_iconv(benchmark::State& state) {                                    \
+		legacy_decode_benchmark(state, ICONV_NAME, ENCODING##_##CORPUS##_corpus());                             \
+	}                                                                                                            \
+	static void ENCODING##_##CORPUS##_transcode_iconv(benchmark::State& state) {                                 \
+		legacy_transcode_benchmark(state, ICONV_NAME, ENCODING##_##CORPUS##_corpus());                          \
+	}                                                                                                            \
+	BENCHMARK(ENCODING##_##CORPUS##_decode_iconv);                                                               \
+	BENCHMARK(ENCODING##_##CORPUS##_transcode_iconv)
+
+#define LEGACY_CONVERSION_BENCHMARKS(ENCODING, ICONV_NAME, NATIVE_TEXT)                                              \
+	LEGACY_CORPUS_CONVERSION_BENCHMARKS(ENCODING, ICONV_NAME, latin, ztd::benchmarks::legacy_text::english, false); \
+	LEGACY_CORPUS_CONVERSION_BENCHMARKS(                                                                            \
+	     ENCODING, ICONV_NAME, native, ztd::benchmarks::legacy_text::NATIVE_TEXT, false);                           \
+	LEGACY_CORPUS_CONVERSION_BENCHMARKS(ENCODING, ICONV_NAME, mixed, ztd::benchmarks::legacy_text::mixed, false);   \
+	LEGACY_CORPUS_CONVERSION_BENCHMARKS(                                                                            \
+	     ENCODING, ICONV_NAME, error_dense, ztd::benchmarks::legacy_text::NATIVE_TEXT, true);                       \
+	static void ENCODING##_latin_encode_iconv(benchmark::State& state) {                                            \
+		legacy_encode_benchmark(state, ICONV_NAME, ENCODING##_latin_corpus());                                     \
+	}                                                                                                               \
+	static void ENCODING##_native_encode_iconv(benchmark::State& state) {                                           \
+		legacy_encode_benchmark(state, ICONV_NAME, ENCODING##_native_corpus());                                    \
+	}                                                                                                               \
+	static void ENCODING##_mixed_encode_iconv(benchmark::State& state) {                                            \
+		legacy_encode_benchmark(state, ICONV_NAME, ENCODING##_mixed_corpus());                                     \
+	}                                                                                                               \
+	BENCHMARK(ENCODING##_latin_encode_iconv);                                                                       \
+	BENCHMARK(ENCODING##_native_encode_iconv);                                                                      \
+	BENCHMARK(ENCODING##_mixed_encode_iconv)
+
+// the closest iconv names: the ztd.text CJK encodings follow the WHATWG Encoding Standard, which is what the
+// Microsoft code pages (rather than the strict JIS/KS definitions) most closely match
+LEGACY_CONVERSION_BENCHMARKS(shift_jis_x0208, "CP932", japanese);
+LEGACY_CONVERSION_BENCHMARKS(big5_hkscs, "BIG5-HKSCS", chinese_traditional);
+LEGACY_CONVERSION_BENCHMARKS(gbk, "GBK", chinese_simplified);
+LEGACY_CONVERSION_BENCHMARKS(gb18030, "GB18030", chinese_simplified);
+LEGACY_CONVERSION_BENCHMARKS(euc_kr_uhc, "CP949", korean);
+
+LEGACY_CONVERSION_BENCHMARKS(windows_1251, "CP1251", cyrillic);
+LEGACY_CONVERSION_BENCHMARKS(windows_1252, "CP1252", western);
+LEGACY_CONVERSION_BENCHMARKS(windows_1253, "CP1253", greek);
+LEGACY_CONVERSION_BENCHMARKS(windows_1254, "CP1254", turkish);
+LEGACY_CONVERSION_BENCHMARKS(windows_1255, "CP1255", hebrew);
+LEGACY_CONVERSION_BENCHMARKS(windows_1256, "CP1256", arabic);
+LEGACY_CONVERSION_BENCHMARKS(windows_1257, "CP1257", baltic);
+LEGACY_CONVERSION_BENCHMARKS(windows_1258, "CP1258", western);
+
+LEGACY_CONVERSION_BENCHMARKS(iso_8859_1, "ISO-8859-1", western);
+LEGACY_CONVERSION_BENCHMARKS(iso_8859_2, "ISO-8859-2", central_european);
+LEGACY_CONVERSION_BENCHMARKS(iso_8859_5, "ISO-8859-5", cyrillic);
+LEGACY_CONVERSION_BENCHMARKS(iso_8859_7, "ISO-8859-7", greek);
+LEGACY_CONVERSION_BENCHMARKS(iso_8859_8, "ISO-8859-8", hebrew);
+LEGACY_CONVERSION_BENCHMARKS(iso_8859_15, "ISO-8859-15", western);
+
+#undef LEGACY_CONVERSION_BENCHMARKS
+#undef LEGACY_CORPUS_CONVERSION_BENCHMARKS
+
+#endif
@@ -0,0 +1,49 @@
+// ============================================================================
+//
+// ztd.text
+// Copyright © JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file
+// in accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ========================================================================= //
+
+#include <benchmark/benchmark.h>
+
+#include <ztd/tests/keep_process_awake.hpp>
+
+#include <iostream>
+
+int main(int argc, const char** argv) {
+	ztd::tests::keep_process_awake process_wake {};
+	if (!process_wake.awake_request_successful()) {
+		std::cerr << "[ztd.text/benchmarks] the process awake request did not set successfully; process may fall "
+		             "asleep during benchmarks."
+		          << std::endl;
+	}
+	benchmark::Initialize(&argc, argv);
+	if (benchmark::ReportUnrecognizedArguments(argc, argv))
+		return 1;
+	benchmark::RunSpecifiedBenchmarks();
+	benchmark::Shutdown();
+	return 0;
+}
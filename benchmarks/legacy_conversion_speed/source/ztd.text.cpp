@@ -0,0 +1,260 @@
+// ============================================================================
+//
+// ztd.text
+// Copyright © JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file
+// in accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ========================================================================= //
+
+#include <ztd/text/benchmarks/version.hpp>
+
+#if ZTD_IS_ON(ZTD_TEXT_BENCHMARKS_LEGACY_CONVERSION_SPEED_ZTD_TEXT_BENCHMARKS)
+
+#include <benchmark/benchmark.h>
+
+#include <ztd/text/benchmarks/legacy_corpora.hpp>
+
+#include <ztd/text.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+inline namespace ztd_text_benchmarks_legacy_conversion_speed_ztd_text {
+	template <typename Encoding>
+	void set_legacy_counters(benchmark::State& state, const ztd::benchmarks::legacy_corpus<Encoding>& corpus) {
+		state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations())
+		     * static_cast<std::int64_t>(corpus.encoded.size() * sizeof(corpus.encoded[0])));
+		state.counters["code_points"] = benchmark::Counter(
+		     static_cast<double>(corpus.decoded.size()), benchmark::Counter::kIsIterationInvariantRate);
+		state.counters["errors"] = static_cast<double>(corpus.error_count);
+	}
+
+	template <typename Encoding>
+	void legacy_decode_benchmark(
+		benchmark::State& state, const Encoding& encoding, const ztd::benchmarks::legacy_corpus<Encoding>& corpus) {
+		using code_unit  = ztd::text::code_unit_t<Encoding>;
+		using code_point = ztd::text::code_point_t<Encoding>;
+		if (corpus.encoded.empty()) {
+			state.SkipWithError("the encoding has no invalid code unit to build an error-dense corpus from");
+			return;
+		}
+		std::vector<code_point> output_data(corpus.decoded.size());
+		bool result = true;
+		for (auto _ : state) {
+			auto err = ztd::text::decode_into_raw(
+			     ztd::span<const code_unit>(corpus.encoded.data(), corpus.encoded.size()), encoding,
+			     ztd::span<code_point>(output_data.data(), output_data.size()), ztd::text::replacement_handler);
+			if (err.error_code != ztd::text::encoding_error::ok) {
+				result = false;
+			}
+		}
+		const bool is_equal = std::equal(
+		     output_data.cbegin(), output_data.cend(), corpus.decoded.cbegin(), corpus.decoded.cend());
+		if (!result) {
+			state.SkipWithError("conversion failed with an error");
+		}
+		else if (!is_equal) {
+			state.SkipWithError("conversion succeeded but produced illegitimate data");
+		}
+		set_legacy_counters(state, corpus);
+	}
+
+	template <typename Encoding>
+	void legacy_encode_benchmark(
+		benchmark::State& state, const Encoding& encoding, const ztd::benchmarks::legacy_corpus<Encoding>& corpus) {
+		using code_unit  = ztd::text::code_unit_t<Encoding>;
+		using code_point = ztd::text::code_point_t<Encoding>;
+		std::vector<code_unit> output_data(corpus.encoded.size());
+		bool result = true;
+		for (auto _ : state) {
+			auto err = ztd::text::encode_into_raw(
+			     ztd::span<const code_point>(corpus.decoded.data(), corpus.decoded.size()), encoding,
+			     ztd::span<code_unit>(output_data.data(), output_data.size()), ztd::text::replacement_handler);
+			if (err.error_code != ztd::text::encoding_error::ok) {
+				result = false;
+			}
+		}
+		const bool is_equal = std::equal(
+		     output_data.cbegin(), output_data.cend(), corpus.encoded.cbegin(), corpus.encoded.cend());
+		if (!result) {
+			state.SkipWithError("conversion failed with an error");
+		}
+		else if (!is_equal) {
+			state.SkipWithError("conversion succeeded but produced illegitimate data");
+		}
+		set_legacy_counters(state, corpus);
+	}
+
+	template <typename Encoding>
+	void legacy_transcode_benchmark(
+		benchmark::State& state, const Encoding& encoding, const ztd::benchmarks::legacy_corpus<Encoding>& corpus) {
+		using code_unit = ztd::text::code_unit_t<Encoding>;
+		if (corpus.encoded.empty()) {
+			state.SkipWithError("the encoding has no invalid code unit to build an error-dense corpus from");
+			return;
+		}
+		std::vector<ztd::benchmarks::utf8_code_unit> output_data(corpus.utf8.size());
+		bool result = true;
+		for (auto _ : state) {
+			auto err = ztd::text::transcode_into_raw(
+			     ztd::span<const code_unit>(corpus.encoded.data(), corpus.encoded.size()), encoding,
+			     ztd::span<ztd::benchmarks::utf8_code_unit>(output_data.data(), output_data.size()),
+			     ztd::text::utf8, ztd::text::replacement_handler, ztd::text::replacement_handler);
+			if (err.error_code != ztd::text::encoding_error::ok) {
+				result = false;
+			}
+		}
+		const bool is_equal
+		     = std::equal(output_data.cbegin(), output_data.cend(), corpus.utf8.cbegin(), corpus.utf8.cend());
+		if (!result) {
+			state.SkipWithError("conversion failed with an error");
+		}
+		else if (!is_equal) {
+			state.SkipWithError("conversion succeeded but produced illegitimate data");
+		}
+		set_legacy_counters(state, corpus);
+	}
+
+	template <typename Encoding>
+	void legacy_label_benchmark(benchmark::State& state, const Encoding& encoding,
+		const std::vector<ztd::benchmarks::legacy_corpus<Encoding>>& labels, bool decoding) {
+		using code_unit  = ztd::text::code_unit_t<Encoding>;
+		using code_point = ztd::text::code_point_t<Encoding>;
+		std::vector<code_point> decode_output_data(labels.size() * 64);
+		std::vector<code_unit> encode_output_data(labels.size() * 64);
+		std::size_t code_unit_count  = 0;
+		std::size_t code_point_count = 0;
+		for (const auto& label : labels) {
+			code_unit_count += label.encoded.size();
+			code_point_count += label.decoded.size();
+		}
+		bool result = true;
+		for (auto _ : state) {
+			for (const auto& label : labels) {
+				ztd::text::encoding_error error_code = ztd::text::encoding_error::ok;
+				if (decoding) {
+					error_code = ztd::text::decode_into_raw(
+					     ztd::span<const code_unit>(label.encoded.data(), label.encoded.size()), encoding,
+					     ztd::span<code_point>(decode_output_data.data(), decode_output_data.size()),
+					     ztd::text::pass_handler)
+					                  .error_code;
+				}
+				else {
+					error_code = ztd::text::encode_into_raw(
+					     ztd::span<const code_point>(label.decoded.data(), label.decoded.size()), encoding,
+					     ztd::span<code_unit>(encode_output_data.data(), encode_output_data.size()),
+					     ztd::text::pass_handler)
+					                  .error_code;
+				}
+				if (error_code != ztd::text::encoding_error::ok) {
+					result = false;
+				}
+			}
+		}
+		if (!result) {
+			state.SkipWithError("conversion failed with an error");
+		}
+		state.SetBytesProcessed(
+		     static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(code_unit_count));
+		state.counters["code_points"] = benchmark::Counter(
+		     static_cast<double>(code_point_count), benchmark::Counter::kIsIterationInvariantRate);
+	}
+} // namespace ztd_text_benchmarks_legacy_conversion_speed_ztd_text
+
+#define LEGACY_CORPUS_CONVERSION_BENCHMARKS(ENCODING, CORPUS, TEXT, ERROR_DENSE)                                  \
+	static const auto& ENCODING##_##CORPUS##_corpus() {                                                          \
+		static const auto corpus = ztd::benchmarks::make_legacy_corpus(ztd::text::ENCODING, TEXT, ERROR_DENSE); \
+		return corpus;                                                                                          \
+	}                                                                                                            \
+	static void ENCODING##_##CORPUS##_decode_ztd_text(benchmark::State& state) {                                 \
+		legacy_decode_benchmark(state, ztd::text::ENCODING, ENCODING##_##CORPUS##_corpus());                    \
+	}                                                                                                            \
+	static void ENCODING##_##CORPUS##_transcode_ztd_text(benchmark::State& state) {                              \
+		legacy_transcode_benchmark(state, ztd::text::ENCODING, ENCODING##_##CORPUS##_corpus());                 \
+	}                                                                                                            \
+	BENCHMARK(ENCODING##_##CORPUS##_decode_ztd_text);                                                            \
+	BENCHMARK(ENCODING##_##CORPUS##_transcode_ztd_text)
+
+#define LEGACY_CONVERSION_BENCHMARKS(ENCODING, NATIVE_TEXT)                                                       \
+	LEGACY_CORPUS_CONVERSION_BENCHMARKS(ENCODING, latin, ztd::benchmarks::legacy_text::english, false);          \
+	LEGACY_CORPUS_CONVERSION_BENCHMARKS(ENCODING, native, ztd::benchmarks::legacy_text::NATIVE_TEXT, false);     \
+	LEGACY_CORPUS_CONVERSION_BENCHMARKS(ENCODING, mixed, ztd::benchmarks::legacy_text::mixed, false);            \
+	LEGACY_CORPUS_CONVERSION_BENCHMARKS(ENCODING, error_dense, ztd::benchmarks::legacy_text::NATIVE_TEXT, true); \
+	static void ENCODING##_latin_encode_ztd_text(benchmark::State& state) {                                      \
+		legacy_encode_benchmark(state, ztd::text::ENCODING, ENCODING##_latin_corpus());                         \
+	}                                                                                                            \
+	static void ENCODING##_native_encode_ztd_text(benchmark::State& state) {                                     \
+		legacy_encode_benchmark(state, ztd::text::ENCODING, ENCODING##_native_corpus());                        \
+	}                                                                                                            \
+	static void ENCODING##_mixed_encode_ztd_text(benchmark::State& state) {                                      \
+		legacy_encode_benchmark(state, ztd::text::ENCODING, ENCODING##_mixed_corpus());                         \
+	}                                                                                                            \
+	BENCHMARK(ENCODING##_latin_encode_ztd_text);                                                                 \
+	BENCHMARK(ENCODING##_native_encode_ztd_text);                                                                \
+	BENCHMARK(ENCODING##_mixed_encode_ztd_text)
+
+LEGACY_CONVERSION_BENCHMARKS(shift_jis_x0208, japanese);
+LEGACY_CONVERSION_BENCHMARKS(big5_hkscs, chinese_traditional);
+LEGACY_CONVERSION_BENCHMARKS(gbk, chinese_simplified);
+LEGACY_CONVERSION_BENCHMARKS(gb18030, chinese_simplified);
+LEGACY_CONVERSION_BENCHMARKS(euc_kr_uhc, korean);
+
+LEGACY_CONVERSION_BENCHMARKS(windows_1251, cyrillic);
+LEGACY_CONVERSION_BENCHMARKS(windows_1252, western);
+LEGACY_CONVERSION_BENCHMARKS(windows_1253, greek);
+LEGACY_CONVERSION_BENCHMARKS(windows_1254, turkish);
+LEGACY_CONVERSION_BENCHMARKS(windows_1255, hebrew);
+LEGACY_CONVERSION_BENCHMARKS(windows_1256, arabic);
+LEGACY_CONVERSION_BENCHMARKS(windows_1257, baltic);
+LEGACY_CONVERSION_BENCHMARKS(windows_1258, western);
+
+LEGACY_CONVERSION_BENCHMARKS(iso_8859_1, western);
+LEGACY_CONVERSION_BENCHMARKS(iso_8859_2, central_european);
+LEGACY_CONVERSION_BENCHMARKS(iso_8859_5, cyrillic);
+LEGACY_CONVERSION_BENCHMARKS(iso_8859_7, greek);
+LEGACY_CONVERSION_BENCHMARKS(iso_8859_8, hebrew);
+LEGACY_CONVERSION_BENCHMARKS(iso_8859_15, western);
+
+#undef LEGACY_CONVERSION_BENCHMARKS
+#undef LEGACY_CORPUS_CONVERSION_BENCHMARKS
+
+static const std::vector<ztd::benchmarks::legacy_corpus<ztd::text::punycode_t>>& punycode_labels() {
+	static const auto labels
+	     = ztd::benchmarks::make_legacy_label_corpus(ztd::text::punycode, ztd::benchmarks::legacy_text::mixed);
+	return labels;
+}
+
+static void punycode_mixed_decode_ztd_text(benchmark::State& state) {
+	legacy_label_benchmark(state, ztd::text::punycode, punycode_labels(), true);
+}
+
+static void punycode_mixed_encode_ztd_text(benchmark::State& state) {
+	legacy_label_benchmark(state, ztd::text::punycode, punycode_labels(), false);
+}
+
+BENCHMARK(punycode_mixed_decode_ztd_text);
+BENCHMARK(punycode_mixed_encode_ztd_text);
+
+#endif
@@ -0,0 +1,80 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#include <ztd/text/decode.hpp>
+#include <ztd/text/transcode.hpp>
+#include <ztd/text/encoding.hpp>
+
+#include <ztd/idk/span.hpp>
+#include <ztd/idk/tag.hpp>
+
+#include "gap_buffer.hpp"
+
+#include <string>
+#include <string_view>
+
+namespace gap { namespace {
+	// the text before the gap is one contiguous block, and the text after the gap is another: hand out whichever one
+	// `first` is in, so ztd.text can convert each block in bulk rather than one code unit at a time
+	template <typename Tp, typename DiffTp, typename PtrTp, typename RefTp>
+	ztd::span<const Tp> text_segment(ztd::tag<gap_iterator_base<Tp, DiffTp, PtrTp, RefTp>>,
+		const gap_iterator_base<Tp, DiffTp, PtrTp, RefTp>& first,
+		const gap_iterator_base<Tp, DiffTp, PtrTp, RefTp>& last) {
+		const Tp* segment_last = last.cur;
+		if (first.cur < first.gap_begin && last.cur > first.gap_begin) {
+			segment_last = first.gap_begin;
+		}
+		return ztd::span<const Tp>(first.cur, static_cast<std::size_t>(segment_last - first.cur));
+	}
+}} // namespace gap::
+
+int main(int, char*[]) {
+	using u16_gap_buffer  = gap::gap_vector<char16_t>;
+	using iterator        = typename u16_gap_buffer::iterator;
+	using buffer_subrange = ztd::ranges::subrange<iterator, iterator>;
+
+	std::u16string_view data = u"⛲ Très beau ! 🌊 ~";
+	// split the text right after the leading surrogate of 🌊, so the gap falls in the middle of a code point
+	std::size_t split_index = data.find(u'\xD83C') + 1;
+
+	u16_gap_buffer buffer;
+	buffer.insert(buffer.begin(), data.begin() + split_index, data.end());
+	buffer.insert(buffer.begin(), data.begin(), data.begin() + split_index);
+
+	buffer_subrange u16_buffer_view(buffer.begin(), buffer.end());
+
+	std::u32string decoded_data = ztd::text::decode(u16_buffer_view, ztd::text::utf16);
+	ZTD_TEXT_ASSERT(decoded_data == U"⛲ Très beau ! 🌊 ~");
+
+	std::string transcoded_data = ztd::text::transcode(u16_buffer_view, ztd::text::utf16, ztd::text::compat_utf8);
+	ZTD_TEXT_ASSERT(transcoded_data == "\xE2\x9B\xB2 Tr\xC3\xA8s beau ! \xF0\x9F\x8C\x8A ~");
+
+	return 0;
+}
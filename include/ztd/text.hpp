@@ -53,12 +53,17 @@
 #include <ztd/text/validate_decodable_as.hpp>
 #include <ztd/text/validate_encodable_as.hpp>
 #include <ztd/text/validate_transcodable_as.hpp>
+#include <ztd/text/parallel_transcode.hpp>
+#include <ztd/text/stream_transcoder.hpp>
+#include <ztd/text/output_sizing.hpp>
 
 #include <ztd/text/encode_view.hpp>
 #include <ztd/text/decode_view.hpp>
 #include <ztd/text/transcode_view.hpp>
 #include <ztd/text/recode_view.hpp>
 #include <ztd/text/ciscode_view.hpp>
+#include <ztd/text/chunked_decode_view.hpp>
+#include <ztd/text/chunked_transcode_view.hpp>
 
 #include <ztd/text/normalization.hpp>
 #include <ztd/text/normalized_view.hpp>
@@ -38,6 +38,7 @@
 #include <ztd/text/version.hpp>
 
 #include <ztd/text/detail/any_encoding_with_includes.hpp>
+#include <ztd/text/detail/inline_erased_storage.hpp>
 
 #include <cstdint>
 #include <cstddef>
@@ -63,6 +64,14 @@ namespace ztd { namespace text {
 			}
 		};
 
+		using __erased_state_storage
+			= __inline_erased_ptr<__erased_state, ZTD_TEXT_ANY_ENCODING_INLINE_STORAGE_SIZE_I_>;
+
+		//////
+		/// @brief One object per erased encoding type: its address identifies the type stored inside of a
+		/// ztd::text::any_encoding_with without needing RTTI.
+		template <typename _Encoding>
+		inline constexpr char __any_encoding_type_tag = 0;
 
 	} // namespace __txt_detail
 
@@ -169,6 +178,28 @@ namespace ztd { namespace text {
 			const ::ztd::span<const code_unit>&, const ::ztd::span<const code_point>&)>;
 		using __encode_error_handler = ::std::function<__encode_result(const any_encoding_with&, __encode_result,
 			const ::ztd::span<const code_point>&, const ::ztd::span<const code_unit>&)>;
+		using __transcode_result
+			= pivotless_transcode_result<_DecodeCodeUnits, _EncodeCodeUnits, decode_state, encode_state>;
+
+		template <typename _Range>
+		static inline constexpr bool _S_is_pointer_range_v = ::ztd::ranges::is_range_contiguous_range_v<_Range> // cf
+			&& ::ztd::ranges::is_sized_range_v<_Range>                                                     // cf
+			&& ::std::is_constructible_v<_Range, ::ztd::ranges::range_value_type_t<_Range>*, ::std::size_t>;
+
+		static inline constexpr bool _S_is_direct_transcode_capable_v = _S_is_pointer_range_v<_DecodeCodeUnits> // cf
+			&& _S_is_pointer_range_v<_DecodeCodePoints>                                                   // cf
+			&& _S_is_pointer_range_v<_EncodeCodePoints>                                                   // cf
+			&& _S_is_pointer_range_v<_EncodeCodeUnits>;
+
+		template <typename _Encoding>
+		static const void* _S_type_id() noexcept {
+			return ::std::addressof(__txt_detail::__any_encoding_type_tag<_Encoding>);
+		}
+
+		template <typename _Range>
+		static _Range _S_drop_first(const _Range& __range, ::std::size_t __count) noexcept {
+			return _Range(::ztd::ranges::data(__range) + __count, ::ztd::ranges::size(__range) - __count);
+		}
 
 	public:
 		//////
@@ -200,10 +231,14 @@ namespace ztd { namespace text {
 		/// @param[in] __tag The type marker that informs the ztd::text::any_encoding_with what encoding object to
 		/// store.
 		/// @param[in] __args Any additional arguments used to construct the encoding in the erased storage.
+		///
+		/// @remarks Encodings no bigger than `ZTD_TEXT_ANY_ENCODING_INLINE_STORAGE_SIZE` bytes (and which can be
+		/// moved without throwing) are stored inside the ztd::text::any_encoding_with object itself; only larger
+		/// ones are allocated on the heap.
 		template <typename _Encoding, typename... _Args>
-		any_encoding_with(::std::in_place_type_t<_Encoding> __tag, _Args&&... __args)
-		: _M_storage(::std::make_unique<__typed<_Encoding>>(::std::forward<_Args>(__args)...)) {
+		any_encoding_with(::std::in_place_type_t<_Encoding> __tag, _Args&&... __args) : _M_storage() {
 			(void)__tag;
+			this->_M_storage.template _M_emplace<__typed<_Encoding>>(::std::forward<_Args>(__args)...);
 		}
 
 		//////
@@ -361,8 +396,17 @@ namespace ztd { namespace text {
 				_DecodeCodeUnits __input, __decode_error_handler __error_handler, decode_state& __state) const
 				= 0;
 
-			virtual ::std::unique_ptr<__txt_detail::__erased_state> __create_encode_state() const = 0;
-			virtual ::std::unique_ptr<__txt_detail::__erased_state> __create_decode_state() const = 0;
+			// modifiers: transcode
+			virtual __transcode_result __transcode(const any_encoding_with& __self, _DecodeCodeUnits __input,
+				const any_encoding_with& __to, _EncodeCodeUnits __output,
+				__decode_error_handler __from_error_handler, __encode_error_handler __to_error_handler,
+				decode_state& __from_state, encode_state& __to_state) const = 0;
+
+			virtual const void* __encoding_type_id() const noexcept = 0;
+			virtual const void* __encoding_address() const noexcept = 0;
+
+			virtual void __create_encode_state(__txt_detail::__erased_state_storage& __storage) const = 0;
+			virtual void __create_decode_state(__txt_detail::__erased_state_storage& __storage) const = 0;
 
 			virtual ~__erased() {
 			}
@@ -795,14 +839,65 @@ namespace ztd { namespace text {
 					__raw_result.error_code, __raw_result.error_count);
 			}
 
-			virtual ::std::unique_ptr<__txt_detail::__erased_state> __create_encode_state() const override {
+			// modifiers: transcode
+			virtual __transcode_result __transcode(const any_encoding_with& __self, _DecodeCodeUnits __input,
+				const any_encoding_with& __to, _EncodeCodeUnits __output,
+				__decode_error_handler __from_error_handler, __encode_error_handler __to_error_handler,
+				decode_state& __from_state, encode_state& __to_state) const override {
+				if constexpr (_S_is_direct_transcode_capable_v) {
+					const void* __to_type_id = __to._M_storage->__encoding_type_id();
+					if (__to_type_id == _S_type_id<_Encoding>()) {
+						return this->template _M_transcode_typed<_Encoding>(__self, ::std::move(__input), __to,
+							::std::move(__output), __from_error_handler, __to_error_handler, __from_state,
+							__to_state);
+					}
+					if constexpr (is_unicode_encoding_v<_Encoding> && sizeof(code_unit) == 1) {
+						// any_byte_encoding keeps the Unicode encodings as byte-based encoding schemes
+						using _Utf8Scheme  = encoding_scheme<utf8_t, endian::native, code_unit>;
+						using _Utf16Scheme = encoding_scheme<utf16_t, endian::native, code_unit>;
+						using _Utf32Scheme = encoding_scheme<utf32_t, endian::native, code_unit>;
+						if (__to_type_id == _S_type_id<_Utf8Scheme>()) {
+							return this->template _M_transcode_typed<_Utf8Scheme>(__self, ::std::move(__input),
+								__to, ::std::move(__output), __from_error_handler, __to_error_handler,
+								__from_state, __to_state);
+						}
+						if (__to_type_id == _S_type_id<_Utf16Scheme>()) {
+							return this->template _M_transcode_typed<_Utf16Scheme>(__self, ::std::move(__input),
+								__to, ::std::move(__output), __from_error_handler, __to_error_handler,
+								__from_state, __to_state);
+						}
+						if (__to_type_id == _S_type_id<_Utf32Scheme>()) {
+							return this->template _M_transcode_typed<_Utf32Scheme>(__self, ::std::move(__input),
+								__to, ::std::move(__output), __from_error_handler, __to_error_handler,
+								__from_state, __to_state);
+						}
+					}
+					return this->_M_transcode_blocks(__self, ::std::move(__input), __to, ::std::move(__output),
+						__from_error_handler, __to_error_handler, __from_state, __to_state);
+				}
+				else {
+					// never called: __text_transcode only goes through here for pointer-and-size ranges
+					return __transcode_result(::std::move(__input), ::std::move(__output), __from_state,
+						__to_state, encoding_error::ok, 0);
+				}
+			}
+
+			virtual const void* __encoding_type_id() const noexcept override {
+				return _S_type_id<_Encoding>();
+			}
+
+			virtual const void* __encoding_address() const noexcept override {
+				return ::std::addressof(this->_M_get_encoding());
+			}
+
+			virtual void __create_encode_state(__txt_detail::__erased_state_storage& __storage) const override {
 				auto& __encoding = this->_M_get_encoding();
-				return ::std::make_unique<__typed_state<__real_encode_state>>(make_encode_state(__encoding));
+				__storage.template _M_emplace<__typed_state<__real_encode_state>>(make_encode_state(__encoding));
 			}
 
-			virtual ::std::unique_ptr<__txt_detail::__erased_state> __create_decode_state() const override {
+			virtual void __create_decode_state(__txt_detail::__erased_state_storage& __storage) const override {
 				auto& __encoding = this->_M_get_encoding();
-				return ::std::make_unique<__typed_state<__real_decode_state>>(make_decode_state(__encoding));
+				__storage.template _M_emplace<__typed_state<__real_decode_state>>(make_decode_state(__encoding));
 			}
 
 		private:
@@ -823,6 +918,192 @@ namespace ztd { namespace text {
 					= static_cast<__typed_state<__real_decode_state>*>(__erased_ptr);
 				return __typed_ptr->get_value();
 			}
+
+			template <typename _ToEncoding>
+			__transcode_result _M_transcode_typed(const any_encoding_with& __self, _DecodeCodeUnits __input,
+				const any_encoding_with& __to, _EncodeCodeUnits __output,
+				__decode_error_handler& __from_error_handler, __encode_error_handler& __to_error_handler,
+				decode_state& __from_state, encode_state& __to_state) const {
+				using __real_to_encode_state = encode_state_t<_ToEncoding>;
+				if constexpr (::std::is_empty_v<__real_decode_state> && ::std::is_empty_v<__real_to_encode_state>) {
+					// both states are empty, so a bulk attempt that stops on an error can be thrown away and
+					// redone with no trace left behind
+					const _Encoding& __from_encoding = this->_M_get_encoding();
+					const _ToEncoding& __to_encoding
+						= *static_cast<const _ToEncoding*>(__to._M_storage->__encoding_address());
+					__real_decode_state& __actual_from_state = this->_M_get_state(__from_state);
+					__real_to_encode_state& __actual_to_state
+						= static_cast<__typed_state<__real_to_encode_state>*>(__to_state._M_get_erased_state())
+						       ->get_value();
+					__txt_detail::__progress_handler<false, _Encoding> __from_pass_handler {};
+					__txt_detail::__progress_handler<false, _ToEncoding> __to_pass_handler {};
+					code_point_t<_Encoding> __pivot_buffer[max_code_points_v<_Encoding>] {};
+					code_point __erased_pivot_buffer[max_code_points] {};
+					::std::size_t __error_count = 0;
+					for (;;) {
+						auto __bulk_result = ::ztd::text::transcode_into_raw(__input, __from_encoding, __output,
+							__to_encoding, __from_pass_handler, __to_pass_handler, __actual_from_state,
+							__actual_to_state);
+						if (__bulk_result.error_code == encoding_error::ok) {
+							return __transcode_result(
+								_DecodeCodeUnits(::ztd::ranges::data(__bulk_result.input),
+								     ::ztd::ranges::size(__bulk_result.input)),
+								_EncodeCodeUnits(::ztd::ranges::data(__bulk_result.output),
+								     ::ztd::ranges::size(__bulk_result.output)),
+								__from_state, __to_state, encoding_error::ok, __error_count);
+						}
+						// walk up to the failure one step at a time, then let the real error handlers see only
+						// the sequence that failed before going back to bulk transcoding
+						for (;;) {
+							if (::ztd::ranges::empty(__input)) {
+								break;
+							}
+							::ztd::span<code_point_t<_Encoding>> __pivot(__pivot_buffer);
+							auto __step_result = ::ztd::text::transcode_one_into_raw(__input, __from_encoding,
+								__output, __to_encoding, __from_pass_handler, __to_pass_handler,
+								__actual_from_state, __actual_to_state, __pivot);
+							if (__step_result.error_code == encoding_error::ok) {
+								__input  = _DecodeCodeUnits(::ztd::ranges::data(__step_result.input),
+								      ::ztd::ranges::size(__step_result.input));
+								__output = _EncodeCodeUnits(::ztd::ranges::data(__step_result.output),
+								     ::ztd::ranges::size(__step_result.output));
+								continue;
+							}
+							::ztd::span<code_point> __erased_pivot(__erased_pivot_buffer);
+							auto __erased_result = ::ztd::text::transcode_one_into_raw(__input, __self, __output,
+								__to, __from_error_handler, __to_error_handler, __from_state, __to_state,
+								__erased_pivot);
+							__error_count += __erased_result.error_count;
+							__input  = _DecodeCodeUnits(::ztd::ranges::data(__erased_result.input),
+							      ::ztd::ranges::size(__erased_result.input));
+							__output = _EncodeCodeUnits(::ztd::ranges::data(__erased_result.output),
+							     ::ztd::ranges::size(__erased_result.output));
+							if (__erased_result.error_code != encoding_error::ok) {
+								return __transcode_result(::std::move(__input), ::std::move(__output),
+									__from_state, __to_state, __erased_result.error_code, __error_count);
+							}
+							break;
+						}
+					}
+				}
+				else {
+					return this->_M_transcode_blocks(__self, ::std::move(__input), __to, ::std::move(__output),
+						__from_error_handler, __to_error_handler, __from_state, __to_state);
+				}
+			}
+
+			//////
+			/// @brief Encodes the code points in `[__first, __last)` of `__pivot`, as few virtual calls as it takes.
+			///
+			/// @returns encoding_error::ok, or the error that stopped the encode with `__failed_at` set to the index of
+			/// the first code point that could not be written.
+			static encoding_error _S_encode_block(const any_encoding_with& __to, const code_point* __pivot,
+				::std::size_t __first, ::std::size_t __last, _EncodeCodeUnits& __output,
+				__encode_error_handler& __to_error_handler, encode_state& __to_state, ::std::size_t& __error_count,
+				::std::size_t& __failed_at) {
+				::std::size_t __pivot_encoded = __first;
+				while (__pivot_encoded < __last) {
+					__encode_result __encode_step = __to._M_storage->__encode(__to,
+						_EncodeCodePoints(__pivot + __pivot_encoded, __last - __pivot_encoded), ::std::move(__output),
+						__to_error_handler, __to_state);
+					__error_count += __encode_step.error_count;
+					__output = ::std::move(__encode_step.output);
+					const ::std::size_t __now_encoded = __last - ::ztd::ranges::size(__encode_step.input);
+					if (__encode_step.error_code != encoding_error::ok || __now_encoded == __pivot_encoded) {
+						__failed_at = __now_encoded < __last ? __now_encoded : __last - 1;
+						return __encode_step.error_code != encoding_error::ok
+							? __encode_step.error_code
+							: encoding_error::insufficient_output_space;
+					}
+					__pivot_encoded = __now_encoded;
+				}
+				return encoding_error::ok;
+			}
+
+			__transcode_result _M_transcode_blocks(const any_encoding_with& __self, _DecodeCodeUnits __input,
+				const any_encoding_with& __to, _EncodeCodeUnits __output,
+				__decode_error_handler& __from_error_handler, __encode_error_handler& __to_error_handler,
+				decode_state& __from_state, encode_state& __to_state) const {
+				// decode a whole block of code points without any virtual calls, then hand the block to the other
+				// encoding with one virtual call; each code point remembers how far into the block's input it came
+				// from, so an encode failure can report where the input stopped. The decode error handler is only
+				// run once everything decoded before it has been encoded, so it never runs past an encode failure
+				constexpr ::std::size_t __pivot_size_max
+					= ZTD_TEXT_INTERMEDIATE_TRANSCODE_BUFFER_SIZE_I_(code_point) < max_code_points_v<_Encoding>
+					? max_code_points_v<_Encoding>
+					: ZTD_TEXT_INTERMEDIATE_TRANSCODE_BUFFER_SIZE_I_(code_point);
+				constexpr bool _AssumeValid = is_ignorable_error_handler_v<__decode_error_handler>;
+				code_point __pivot_buffer[__pivot_size_max] {};
+				::std::size_t __pivot_input_ends[__pivot_size_max] {};
+				const _Encoding& __encoding                = this->_M_get_encoding();
+				__real_decode_state& __actual_decode_state = this->_M_get_state(__from_state);
+				::std::size_t __error_count                = 0;
+				::std::size_t __failed_at                  = 0;
+				for (;;) {
+					if (::ztd::ranges::empty(__input)
+						&& ::ztd::text::is_state_complete(__encoding, __actual_decode_state)) {
+						break;
+					}
+					const _DecodeCodeUnits __block_input = __input;
+					::std::size_t __pivot_start          = 0;
+					::std::size_t __pivot_size           = 0;
+					encoding_error __decode_error        = encoding_error::ok;
+					while (__pivot_size + max_code_points_v<_Encoding> <= __pivot_size_max) {
+						if (::ztd::ranges::empty(__input)
+							&& ::ztd::text::is_state_complete(__encoding, __actual_decode_state)) {
+							break;
+						}
+						__txt_detail::__progress_handler<_AssumeValid, any_encoding_with> __pass_handler {};
+						auto __raw_result = __encoding.decode_one(::std::move(__input),
+							_DecodeCodePoints(__pivot_buffer + __pivot_size, __pivot_size_max - __pivot_size),
+							__pass_handler, __actual_decode_state);
+						__decode_result __decode_step(__raw_result.input, __raw_result.output, __from_state,
+							__raw_result.error_code, __raw_result.error_count);
+						if (__decode_step.error_code != encoding_error::ok) {
+							// the code points ahead of this sequence go out first: if one of them cannot, the
+							// input stops there and this sequence's error handler must not have run
+							const encoding_error __encode_error = _S_encode_block(__to, __pivot_buffer,
+								__pivot_start, __pivot_size, __output, __to_error_handler, __to_state,
+								__error_count, __failed_at);
+							if (__encode_error != encoding_error::ok) {
+								return __transcode_result(
+									_S_drop_first(__block_input, __pivot_input_ends[__failed_at]),
+									::std::move(__output), __from_state, __to_state, __encode_error,
+									__error_count);
+							}
+							__pivot_start = __pivot_size;
+							__decode_step = __from_error_handler(__self, ::std::move(__decode_step),
+								__pass_handler._M_code_units_progress(), __pass_handler._M_code_points_progress());
+						}
+						__error_count += __decode_step.error_count;
+						const ::std::size_t __written = static_cast<::std::size_t>(
+							::ztd::ranges::data(__decode_step.output) - __pivot_buffer);
+						const ::std::size_t __read
+							= ::ztd::ranges::size(__block_input) - ::ztd::ranges::size(__decode_step.input);
+						for (; __pivot_size < __written; ++__pivot_size) {
+							__pivot_input_ends[__pivot_size] = __read;
+						}
+						__input = ::std::move(__decode_step.input);
+						if (__decode_step.error_code != encoding_error::ok) {
+							__decode_error = __decode_step.error_code;
+							break;
+						}
+					}
+					const encoding_error __encode_error = _S_encode_block(__to, __pivot_buffer, __pivot_start,
+						__pivot_size, __output, __to_error_handler, __to_state, __error_count, __failed_at);
+					if (__encode_error != encoding_error::ok) {
+						// report the input just past the sequence whose code point could not be written
+						return __transcode_result(_S_drop_first(__block_input, __pivot_input_ends[__failed_at]),
+							::std::move(__output), __from_state, __to_state, __encode_error, __error_count);
+					}
+					if (__decode_error != encoding_error::ok) {
+						return __transcode_result(::std::move(__input), ::std::move(__output), __from_state,
+							__to_state, __decode_error, __error_count);
+					}
+				}
+				return __transcode_result(::std::move(__input), ::std::move(__output), __from_state, __to_state,
+					encoding_error::ok, __error_count);
+			}
 		};
 
 	public:
@@ -830,8 +1111,11 @@ namespace ztd { namespace text {
 		public:
 			//////
 			/// @brief Creates a state properly initialized from the stored encoding.
-			any_decode_state(const any_encoding_with& __encoding)
-			: _M_state(__encoding._M_storage->__create_decode_state()) {
+			///
+			/// @remarks States no bigger than `ZTD_TEXT_ANY_ENCODING_INLINE_STORAGE_SIZE` bytes are kept inside
+			/// this object rather than on the heap.
+			any_decode_state(const any_encoding_with& __encoding) : _M_state() {
+				__encoding._M_storage->__create_decode_state(this->_M_state);
 			}
 
 			//////
@@ -851,22 +1135,25 @@ namespace ztd { namespace text {
 			any_decode_state& operator=(any_decode_state&&) = default;
 
 			__txt_detail::__erased_state* _M_get_erased_state() const noexcept {
-				return _M_state.get();
+				return _M_state._M_get();
 			}
 
 		private:
 			template <typename>
 			friend class __typed;
 
-			::std::unique_ptr<__txt_detail::__erased_state> _M_state;
+			__txt_detail::__erased_state_storage _M_state;
 		};
 
 		class any_encode_state {
 		public:
 			//////
 			/// @brief Creates a state properly initialized from the stored encoding.
-			any_encode_state(const any_encoding_with& __encoding)
-			: _M_state(__encoding._M_storage->__create_encode_state()) {
+			///
+			/// @remarks States no bigger than `ZTD_TEXT_ANY_ENCODING_INLINE_STORAGE_SIZE` bytes are kept inside
+			/// this object rather than on the heap.
+			any_encode_state(const any_encoding_with& __encoding) : _M_state() {
+				__encoding._M_storage->__create_encode_state(this->_M_state);
 			}
 
 			//////
@@ -886,7 +1173,7 @@ namespace ztd { namespace text {
 			any_encode_state& operator=(any_encode_state&&) = default;
 
 			__txt_detail::__erased_state* _M_get_erased_state() const noexcept {
-				return _M_state.get();
+				return _M_state._M_get();
 			}
 
 		private:
@@ -894,7 +1181,7 @@ namespace ztd { namespace text {
 			template <typename>
 			friend class __typed;
 
-			::std::unique_ptr<__txt_detail::__erased_state> _M_state;
+			__txt_detail::__erased_state_storage _M_state;
 		};
 
 	private:
@@ -1023,7 +1310,60 @@ namespace ztd { namespace text {
 				::std::move(__input), ::std::forward<_ErrorHandler>(__error_handler), __state);
 		}
 
-		::std::unique_ptr<__erased> _M_storage;
+		template <typename _FromEncoding, typename _ToEncoding, typename _Input, typename _Output,
+			typename _FromErrorHandler, typename _ToErrorHandler, typename _FromState, typename _ToState,
+			typename _Pivot,
+			::std::enable_if_t<::std::is_base_of_v<any_encoding_with, _FromEncoding> // cf
+			     && ::std::is_base_of_v<any_encoding_with, _ToEncoding>>* = nullptr>
+		friend auto __text_transcode(::ztd::tag<_FromEncoding, _ToEncoding>, _Input&& __input,
+			type_identity_t<const any_encoding_with&> __from_encoding, _Output&& __output,
+			type_identity_t<const any_encoding_with&> __to_encoding, _FromErrorHandler&& __from_error_handler,
+			_ToErrorHandler&& __to_error_handler, _FromState& __from_state, _ToState& __to_state,
+			_Pivot&& __pivot) {
+			using _InitialInput  = ::ztd::ranges::csubrange_for_t<::std::remove_reference_t<_Input>>;
+			using _InitialOutput = ::ztd::ranges::subrange_for_t<::std::remove_reference_t<_Output>>;
+			using _Result = decltype(::ztd::text::transcode_one_into_raw(::std::declval<_InitialInput>(),
+				__from_encoding, ::std::declval<_InitialOutput>(), __to_encoding, __from_error_handler,
+				__to_error_handler, __from_state, __to_state, __pivot));
+			using _WorkingInput  = decltype(::std::declval<_Result>().input);
+			using _WorkingOutput = decltype(::std::declval<_Result>().output);
+			using _FromHandlerRef
+				= ::std::reference_wrapper<::std::remove_reference_t<_FromErrorHandler>>;
+			using _ToHandlerRef = ::std::reference_wrapper<::std::remove_reference_t<_ToErrorHandler>>;
+
+			if constexpr (_S_is_direct_transcode_capable_v                             // cf
+				&& ::std::is_same_v<::std::remove_cv_t<_FromState>, decode_state>       // cf
+				&& ::std::is_same_v<::std::remove_cv_t<_ToState>, encode_state>         // cf
+				&& ::std::is_constructible_v<_DecodeCodeUnits, _WorkingInput>           // cf
+				&& ::std::is_constructible_v<_WorkingInput, _DecodeCodeUnits>           // cf
+				&& ::std::is_constructible_v<_EncodeCodeUnits, _WorkingOutput>          // cf
+				&& ::std::is_constructible_v<_WorkingOutput, _EncodeCodeUnits>          // cf
+				&& ::std::is_constructible_v<__decode_error_handler, _FromHandlerRef> // cf
+				&& ::std::is_constructible_v<__encode_error_handler, _ToHandlerRef>) {
+				// one virtual call for the whole transcode: the erased encoding on the "from" side either finds a
+				// fully-typed path to the erased encoding on the "to" side, or decodes and encodes in large blocks
+				_WorkingInput __working_input(::std::forward<_Input>(__input));
+				_WorkingOutput __working_output(::std::forward<_Output>(__output));
+				__transcode_result __direct_result = __from_encoding._M_storage->__transcode(__from_encoding,
+					_DecodeCodeUnits(::std::move(__working_input)), __to_encoding,
+					_EncodeCodeUnits(::std::move(__working_output)),
+					__decode_error_handler(_FromHandlerRef(__from_error_handler)),
+					__encode_error_handler(_ToHandlerRef(__to_error_handler)), __from_state, __to_state);
+				return _Result(_WorkingInput(::std::move(__direct_result.input)),
+					_WorkingOutput(::std::move(__direct_result.output)), __from_state, __to_state,
+					__direct_result.error_code, __direct_result.error_count, ::std::forward<_Pivot>(__pivot),
+					encoding_error::ok, static_cast<::std::size_t>(0));
+			}
+			else {
+				return ::ztd::text::basic_transcode_into_raw(::std::forward<_Input>(__input), __from_encoding,
+					::std::forward<_Output>(__output), __to_encoding,
+					::std::forward<_FromErrorHandler>(__from_error_handler),
+					::std::forward<_ToErrorHandler>(__to_error_handler), __from_state, __to_state,
+					::std::forward<_Pivot>(__pivot));
+			}
+		}
+
+		__txt_detail::__inline_erased_ptr<__erased, ZTD_TEXT_ANY_ENCODING_INLINE_STORAGE_SIZE_I_> _M_storage;
 	};
 
 
@@ -39,13 +39,23 @@
 #include <ztd/text/code_point.hpp>
 #include <ztd/text/code_unit.hpp>
 #include <ztd/text/skip_input_error.hpp>
+#include <ztd/text/encoding_error.hpp>
 #include <ztd/text/detail/constant_encoding_traits.hpp>
 #include <ztd/text/detail/basic_encoding_scheme_includes.hpp>
+#include <ztd/text/detail/bulk_convert.hpp>
+#include <ztd/text/detail/unicode_kernels.hpp>
 
 #include <ztd/idk/unwrap.hpp>
+#include <ztd/idk/tag.hpp>
+#include <ztd/ranges/range.hpp>
+#include <ztd/ranges/reconstruct.hpp>
 
 #include <optional>
 #include <cstddef>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <utility>
 
 #include <ztd/prologue.hpp>
 
@@ -384,6 +394,169 @@ namespace ztd { namespace text {
 			return _Result(::std::move(__result.input), ::std::move(__result_output), __s, __result.error_code,
 				__result.error_count);
 		}
+
+	private:
+		// UTF-16 and UTF-32 over single bytes go through the bulk Unicode kernels one block at a time: each block of
+		// code units is copied out of (or into) the byte sequence in native byte order, swapping the bytes of every
+		// code unit on the way when the scheme's byte order is not the native one
+		inline static constexpr ::std::size_t _S_kernel_width
+			= sizeof(_Byte) == 1 ? __txt_detail::__unicode_kernel_width_v<_UBaseEncoding> : 0;
+		inline static constexpr bool _S_is_kernel_scheme  = _S_kernel_width == 16 || _S_kernel_width == 32;
+		inline static constexpr bool _S_is_kernel_swapped = _Endian != endian::native;
+
+		//////
+		/// @brief Decodes one block of well-formed input straight into the output, and moves both ranges past what
+		/// was read and written.
+		///
+		/// @returns Whether or not anything was decoded.
+		template <typename _WorkingInput, typename _WorkingOutput>
+		static bool _S_decode_block(_WorkingInput& __working_input, _WorkingOutput& __working_output) noexcept {
+			constexpr ::std::size_t __block_size_max = ZTD_TEXT_INTERMEDIATE_DECODE_BUFFER_SIZE_I_(char32_t);
+			const ::std::size_t __output_size = static_cast<::std::size_t>(::ztd::ranges::size(__working_output));
+			::std::size_t __block_size
+				= static_cast<::std::size_t>(::ztd::ranges::size(__working_input)) / sizeof(_BaseCodeUnit);
+			if (__block_size > __block_size_max) {
+				__block_size = __block_size_max;
+			}
+			if (__block_size == 0 || __output_size == 0) {
+				return false;
+			}
+			_BaseCodeUnit __units[__block_size_max];
+			__txt_detail::__unicode_copy_units_kernel<_S_kernel_width, _S_is_kernel_swapped>(
+				__txt_detail::__bulk_data(__working_input), __block_size, __units);
+			::std::size_t __read    = 0;
+			::std::size_t __written = 0;
+			if constexpr (_S_kernel_width == 32) {
+				__read = __txt_detail::__unicode_validate_kernel<32>(
+					__units, __block_size < __output_size ? __block_size : __output_size);
+				__written = __read;
+				::std::memcpy(__txt_detail::__bulk_data(__working_output), __units, __written * sizeof(char32_t));
+			}
+			else {
+				char32_t __code_points[__block_size_max];
+				const __txt_detail::__unicode_kernel_result __result
+					= __txt_detail::__unicode_transcode_kernel<16, 32>(__units, __block_size, __code_points,
+					     __block_size_max < __output_size ? __block_size_max : __output_size);
+				__read    = __result.__read;
+				__written = __result.__written;
+				::std::memcpy(__txt_detail::__bulk_data(__working_output), __code_points, __written * sizeof(char32_t));
+			}
+			if (__read == 0) {
+				return false;
+			}
+			__working_input  = __txt_detail::__bulk_advance(__working_input, __read * sizeof(_BaseCodeUnit));
+			__working_output = __txt_detail::__bulk_advance(__working_output, __written);
+			return true;
+		}
+
+		//////
+		/// @brief Encodes one block of valid code points straight into the output, and moves both ranges past what
+		/// was read and written.
+		///
+		/// @returns Whether or not anything was encoded.
+		template <typename _WorkingInput, typename _WorkingOutput>
+		static bool _S_encode_block(_WorkingInput& __working_input, _WorkingOutput& __working_output) noexcept {
+			constexpr ::std::size_t __block_size_max = ZTD_TEXT_INTERMEDIATE_ENCODE_BUFFER_SIZE_I_(char32_t);
+			::std::size_t __block_size = static_cast<::std::size_t>(::ztd::ranges::size(__working_input));
+			::std::size_t __output_size
+				= static_cast<::std::size_t>(::ztd::ranges::size(__working_output)) / sizeof(_BaseCodeUnit);
+			if (__block_size > __block_size_max) {
+				__block_size = __block_size_max;
+			}
+			if (__output_size > __block_size_max) {
+				__output_size = __block_size_max;
+			}
+			if (__block_size == 0 || __output_size == 0) {
+				return false;
+			}
+			char32_t __code_points[__block_size_max];
+			::std::memcpy(__code_points, __txt_detail::__bulk_data(__working_input), __block_size * sizeof(char32_t));
+			::std::size_t __read    = 0;
+			::std::size_t __written = 0;
+			if constexpr (_S_kernel_width == 32) {
+				__read = __txt_detail::__unicode_validate_kernel<32>(
+					__code_points, __block_size < __output_size ? __block_size : __output_size);
+				__written = __read;
+				__txt_detail::__unicode_copy_units_kernel<32, _S_is_kernel_swapped>(
+					__code_points, __written, __txt_detail::__bulk_data(__working_output));
+			}
+			else {
+				_BaseCodeUnit __units[__block_size_max];
+				const __txt_detail::__unicode_kernel_result __result
+					= __txt_detail::__unicode_transcode_kernel<32, 16>(
+					     __code_points, __block_size, __units, __output_size);
+				__read    = __result.__read;
+				__written = __result.__written;
+				__txt_detail::__unicode_copy_units_kernel<16, _S_is_kernel_swapped>(
+					__units, __written, __txt_detail::__bulk_data(__working_output));
+			}
+			if (__read == 0) {
+				return false;
+			}
+			__working_input  = __txt_detail::__bulk_advance(__working_input, __read);
+			__working_output = __txt_detail::__bulk_advance(__working_output, __written * sizeof(_BaseCodeUnit));
+			return true;
+		}
+
+		template <bool _IsDecode, typename _Input, typename _Output, typename _ErrorHandler, typename _State>
+		constexpr auto _M_convert_one(
+			_Input&& __input, _Output&& __output, _ErrorHandler& __error_handler, _State& __state) const {
+			if constexpr (_IsDecode) {
+				return this->decode_one(
+					::std::forward<_Input>(__input), ::std::forward<_Output>(__output), __error_handler, __state);
+			}
+			else {
+				return this->encode_one(
+					::std::forward<_Input>(__input), ::std::forward<_Output>(__output), __error_handler, __state);
+			}
+		}
+
+		template <bool _IsDecode, typename _Input, typename _Output, typename _ErrorHandler, typename _State>
+		constexpr auto _M_convert(
+			_Input&& __input, _Output&& __output, _ErrorHandler& __error_handler, _State& __state) const {
+			using _Drain                            = __txt_detail::__bulk_drain;
+			constexpr ::std::size_t _InputUnitSize  = _IsDecode ? sizeof(_Byte) : sizeof(char32_t);
+			constexpr ::std::size_t _OutputUnitSize = _IsDecode ? sizeof(char32_t) : sizeof(_Byte);
+			return __txt_detail::__bulk_convert<_InputUnitSize, _OutputUnitSize, _Drain::__none>(
+				::std::forward<_Input>(__input), ::std::forward<_Output>(__output), __error_handler, __state,
+				[](auto& __working_input, auto& __working_output, _State&) {
+					// the kernels stop on errors, on sequences split across blocks, and on a full output
+#if ZTD_IS_ON(ZTD_STD_LIBRARY_IS_CONSTANT_EVALUATED)
+					if (::std::is_constant_evaluated()) {
+						return false;
+					}
+#endif
+					if constexpr (_IsDecode) {
+						return _S_decode_block(__working_input, __working_output);
+					}
+					else {
+						return _S_encode_block(__working_input, __working_output);
+					}
+				},
+				[this](auto&& __step_input, auto&& __step_output, auto& __step_error_handler, _State& __step_state) {
+					return this->template _M_convert_one<_IsDecode>(
+						::std::forward<decltype(__step_input)>(__step_input),
+						::std::forward<decltype(__step_output)>(__step_output), __step_error_handler, __step_state);
+				});
+		}
+
+		template <typename _Input, typename _Output, typename _ErrorHandler, typename _Self = encoding_scheme,
+			::std::enable_if_t<_Self::_S_is_kernel_scheme>* = nullptr>
+		friend constexpr auto __text_decode(::ztd::tag<encoding_scheme>, _Input&& __input,
+			const encoding_scheme& __encoding, _Output&& __output, _ErrorHandler&& __error_handler,
+			decode_state& __state) {
+			return __encoding.template _M_convert<true>(
+				::std::forward<_Input>(__input), ::std::forward<_Output>(__output), __error_handler, __state);
+		}
+
+		template <typename _Input, typename _Output, typename _ErrorHandler, typename _Self = encoding_scheme,
+			::std::enable_if_t<_Self::_S_is_kernel_scheme>* = nullptr>
+		friend constexpr auto __text_encode(::ztd::tag<encoding_scheme>, _Input&& __input,
+			const encoding_scheme& __encoding, _Output&& __output, _ErrorHandler&& __error_handler,
+			encode_state& __state) {
+			return __encoding.template _M_convert<false>(
+				::std::forward<_Input>(__input), ::std::forward<_Output>(__output), __error_handler, __state);
+		}
 	};
 
 	//////
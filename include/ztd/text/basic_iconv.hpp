@@ -36,6 +36,8 @@
 #include <ztd/text/version.hpp>
 
 #include <ztd/text/detail/basic_iconv_includes.hpp>
+#include <ztd/text/detail/bulk_convert.hpp>
+#include <ztd/text/detail/iconv_descriptor_cache.hpp>
 
 #include <ztd/prologue.hpp>
 
@@ -43,6 +45,8 @@ namespace ztd { namespace text {
 	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
 
 	namespace __txt_detail {
+		struct __iconv_transcoder;
+
 		template <typename _CodeUnit, typename _CodePoint>
 		using __basic_iconv_base =
 #if ZTD_IS_ON(ZTD_PLATFORM_LIBICONV)
@@ -72,7 +76,7 @@ namespace ztd { namespace text {
 
 		inline static constexpr ::std::size_t _MaxDrainSize = 64;
 
-		void _M_reset_state(::ztd::plat::icnv::descriptor __desc) const noexcept {
+		static void _M_reset_state(::ztd::plat::icnv::descriptor __desc) noexcept {
 			const auto& __iconv_functions = ::ztd::plat::icnv::functions();
 			char __drain[_MaxDrainSize];
 			char* __p_drain                          = __drain;
@@ -103,9 +107,9 @@ namespace ztd { namespace text {
 			}
 		}
 
-		bool _M_destroy_bom(c_string_view __to_name, ::ztd::plat::icnv::descriptor __desc,
-			::std::size_t __from_size) const noexcept {
-			this->_M_reset_state(__desc);
+		static bool _M_destroy_bom(
+			c_string_view __to_name, ::ztd::plat::icnv::descriptor __desc, ::std::size_t __from_size) noexcept {
+			_M_reset_state(__desc);
 			constexpr ::std::size_t __max_input_size = 5;
 			// Are we going to a Unicode encoding?
 			if (!::ztd::is_unicode_encoding_name(__to_name.base()) || __from_size > __max_input_size) {
@@ -165,7 +169,7 @@ namespace ztd { namespace text {
 					// we found something! Thank god...
 					return true;
 				}
-				this->_M_reset_state(__desc);
+				_M_reset_state(__desc);
 			}
 
 			// if we get here and we've never found success, well, it's time to just go home and cry!
@@ -173,11 +177,11 @@ namespace ztd { namespace text {
 			return false;
 		}
 
-		void _M_reset_descriptor(c_string_view __to_name, ::ztd::plat::icnv::descriptor __desc,
-			::std::size_t __from_size) const noexcept {
-			if (!this->_M_destroy_bom(__to_name, __desc, __from_size)) {
+		static void _M_reset_descriptor(
+			c_string_view __to_name, ::ztd::plat::icnv::descriptor __desc, ::std::size_t __from_size) noexcept {
+			if (!_M_destroy_bom(__to_name, __desc, __from_size)) {
 				// clear things again, just to be safe
-				this->_M_reset_state(__desc);
+				_M_reset_state(__desc);
 			}
 		}
 
@@ -185,59 +189,105 @@ namespace ztd { namespace text {
 		//////
 		/// @brief The state for decode operations.
 		///
-		/// @remarks This contains the actual conversion descriptor for iconv. When the state disappears, so does
-		/// its descriptor.
+		/// @remarks This contains the actual conversion descriptor for iconv. Descriptors are taken from, and given
+		/// back to, a process-wide cache (see ztd::text::iconv_descriptor_cache_stats), so short-lived states do not
+		/// pay for an `iconv_open` and `iconv_close` every time.
 		struct decode_state {
 			::ztd::plat::icnv::descriptor _M_conv_descriptor;
+			__txt_detail::__iconv_descriptor_cache::__pool* _M_pool;
 
 			decode_state(const basic_iconv& __source) noexcept
-			: _M_conv_descriptor(::ztd::plat::icnv::failure_descriptor) {
-				this->_M_conv_descriptor = ::ztd::plat::icnv::functions().open(
-					__source._M_to_name.c_str(), __source._M_from_name.c_str());
+			: _M_conv_descriptor(::ztd::plat::icnv::failure_descriptor), _M_pool(nullptr) {
+				this->_M_conv_descriptor = __txt_detail::__iconv_descriptor_cache::_S_instance()._M_acquire(
+					__source._M_to_name, __source._M_from_name, this->_M_pool);
 				if (this->_M_is_valid()) {
 					__source._M_reset_descriptor(__source._M_to_name, this->_M_conv_descriptor, sizeof(_CodeUnit));
 				}
 			}
 
+			//////
+			/// @brief Creates a state for the same conversion as `__other`, but starting from the initial shift
+			/// state: conversion descriptors cannot be duplicated.
+			decode_state(const decode_state& __other) noexcept
+			: _M_conv_descriptor(::ztd::plat::icnv::failure_descriptor), _M_pool(__other._M_pool) {
+				this->_M_conv_descriptor
+					= __txt_detail::__iconv_descriptor_cache::_S_instance()._M_acquire(this->_M_pool);
+				if (this->_M_is_valid()) {
+					_M_reset_descriptor(this->_M_pool->_M_to_name, this->_M_conv_descriptor, sizeof(_CodeUnit));
+				}
+			}
+
+			decode_state(decode_state&& __other) noexcept
+			: _M_conv_descriptor(::std::exchange(__other._M_conv_descriptor, ::ztd::plat::icnv::failure_descriptor))
+			, _M_pool(__other._M_pool) {
+			}
+
+			decode_state& operator=(decode_state __other) noexcept {
+				::std::swap(this->_M_conv_descriptor, __other._M_conv_descriptor);
+				::std::swap(this->_M_pool, __other._M_pool);
+				return *this;
+			}
+
 			bool _M_is_valid() const noexcept {
 				return ::ztd::plat::icnv::descriptor_is_valid(this->_M_conv_descriptor);
 			}
 
 			~decode_state() {
-				if (this->_M_conv_descriptor != ::ztd::plat::icnv::failure_descriptor) {
-					int __close_result = ::ztd::plat::icnv::functions().close(this->_M_conv_descriptor);
-					ZTD_TEXT_ASSERT(__close_result == ::ztd::plat::icnv::close_success);
-				}
+				__txt_detail::__iconv_descriptor_cache::_S_instance()._M_release(
+					this->_M_pool, this->_M_conv_descriptor);
 			}
 		};
 
 		//////
 		/// @brief The state for encode operations.
 		///
-		/// @remarks This contains the ac        tual conversion descriptor for iconv. When the state disappears,
-		/// so does its descriptor.
+		/// @remarks This contains the actual conversion descriptor for iconv. Descriptors are taken from, and given
+		/// back to, a process-wide cache (see ztd::text::iconv_descriptor_cache_stats), so short-lived states do not
+		/// pay for an `iconv_open` and `iconv_close` every time.
 		struct encode_state {
 			::ztd::plat::icnv::descriptor _M_conv_descriptor;
+			__txt_detail::__iconv_descriptor_cache::__pool* _M_pool;
 
 			encode_state(const basic_iconv& __source) noexcept
-			: _M_conv_descriptor(::ztd::plat::icnv::failure_descriptor) {
-				this->_M_conv_descriptor = ::ztd::plat::icnv::functions().open(
-					__source._M_from_name.c_str(), __source._M_to_name.c_str());
+			: _M_conv_descriptor(::ztd::plat::icnv::failure_descriptor), _M_pool(nullptr) {
+				this->_M_conv_descriptor = __txt_detail::__iconv_descriptor_cache::_S_instance()._M_acquire(
+					__source._M_from_name, __source._M_to_name, this->_M_pool);
 				if (this->_M_is_valid()) {
 					__source._M_reset_descriptor(
 						__source._M_from_name, this->_M_conv_descriptor, sizeof(_CodePoint));
 				}
 			}
 
+			//////
+			/// @brief Creates a state for the same conversion as `__other`, but starting from the initial shift
+			/// state: conversion descriptors cannot be duplicated.
+			encode_state(const encode_state& __other) noexcept
+			: _M_conv_descriptor(::ztd::plat::icnv::failure_descriptor), _M_pool(__other._M_pool) {
+				this->_M_conv_descriptor
+					= __txt_detail::__iconv_descriptor_cache::_S_instance()._M_acquire(this->_M_pool);
+				if (this->_M_is_valid()) {
+					_M_reset_descriptor(this->_M_pool->_M_to_name, this->_M_conv_descriptor, sizeof(_CodePoint));
+				}
+			}
+
+			encode_state(encode_state&& __other) noexcept
+			: _M_conv_descriptor(::std::exchange(__other._M_conv_descriptor, ::ztd::plat::icnv::failure_descriptor))
+			, _M_pool(__other._M_pool) {
+			}
+
+			encode_state& operator=(encode_state __other) noexcept {
+				::std::swap(this->_M_conv_descriptor, __other._M_conv_descriptor);
+				::std::swap(this->_M_pool, __other._M_pool);
+				return *this;
+			}
+
 			bool _M_is_valid() const noexcept {
 				return ::ztd::plat::icnv::descriptor_is_valid(this->_M_conv_descriptor);
 			}
 
 			~encode_state() {
-				if (this->_M_conv_descriptor != ::ztd::plat::icnv::failure_descriptor) {
-					int __close_result = ::ztd::plat::icnv::functions().close(this->_M_conv_descriptor);
-					ZTD_TEXT_ASSERT(__close_result == ::ztd::plat::icnv::close_success);
-				}
+				__txt_detail::__iconv_descriptor_cache::_S_instance()._M_release(
+					this->_M_pool, this->_M_conv_descriptor);
 			}
 		};
 
@@ -544,6 +594,168 @@ namespace ztd { namespace text {
 			}
 		}
 
+		//////
+		/// @brief Decodes as much of the input as possible into the output with as few calls into iconv as
+		/// possible, and produces a result with the input and output ranges moved past what was successfully read
+		/// and written.
+		///
+		/// @param[in] __input The input view to read code units from.
+		/// @param[in] __output The output view to write code points into.
+		/// @param[in] __error_handler The error handler to invoke if decoding fails.
+		/// @param[in, out] __state The necessary state information, containing the conversion descriptor.
+		///
+		/// @returns A ztd::text::decode_result object that contains the input range, output range, error handler, and
+		/// a reference to the passed-in state\.
+		///
+		/// @remarks When both the input and output are contiguous and sized, the whole input and output are handed
+		/// to a single call to iconv. Only where iconv stops (an illegal or incomplete sequence, or not enough
+		/// output space) is ztd::text::basic_iconv::decode_one used, so that the error handler is invoked exactly
+		/// as it would be when decoding one unit of information at a time. Other ranges are decoded one unit of
+		/// information at a time.
+		template <typename _Input, typename _Output, typename _ErrorHandler>
+		auto decode(_Input&& __input, _Output&& __output, _ErrorHandler&& __error_handler,
+			decode_state& __state) const noexcept {
+			static_assert(__txt_detail::__is_decode_lossless_or_deliberate_v<basic_iconv,
+			                   remove_cvref_t<_ErrorHandler>>,
+				ZTD_TEXT_LOSSY_DECODE_MESSAGE_I_);
+			return this->_M_convert<code_unit, code_point>(::std::forward<_Input>(__input),
+				::std::forward<_Output>(__output), __error_handler, __state,
+				[this](auto&& __step_input, auto&& __step_output, auto& __step_error_handler,
+					decode_state& __step_state) {
+					return this->decode_one(::std::forward<decltype(__step_input)>(__step_input),
+						::std::forward<decltype(__step_output)>(__step_output), __step_error_handler,
+						__step_state);
+				});
+		}
+
+		//////
+		/// @brief Encodes as much of the input as possible into the output with as few calls into iconv as
+		/// possible, and produces a result with the input and output ranges moved past what was successfully read
+		/// and written.
+		///
+		/// @param[in] __input The input view to read code points from.
+		/// @param[in] __output The output view to write code units into.
+		/// @param[in] __error_handler The error handler to invoke if encoding fails.
+		/// @param[in, out] __state The necessary state information, containing the conversion descriptor.
+		///
+		/// @returns A ztd::text::encode_result object that contains the input range, output range, error handler, and
+		/// a reference to the passed-in state\.
+		///
+		/// @remarks When both the input and output are contiguous and sized, the whole input and output are handed
+		/// to a single call to iconv. Only where iconv stops (an illegal or incomplete sequence, or not enough
+		/// output space) is ztd::text::basic_iconv::encode_one used, so that the error handler is invoked exactly
+		/// as it would be when encoding one unit of information at a time. Other ranges are encoded one unit of
+		/// information at a time.
+		template <typename _Input, typename _Output, typename _ErrorHandler>
+		auto encode(_Input&& __input, _Output&& __output, _ErrorHandler&& __error_handler,
+			encode_state& __state) const noexcept {
+			static_assert(__txt_detail::__is_encode_lossless_or_deliberate_v<basic_iconv,
+			                   remove_cvref_t<_ErrorHandler>>,
+				ZTD_TEXT_LOSSY_ENCODE_MESSAGE_I_);
+			return this->_M_convert<code_point, code_unit>(::std::forward<_Input>(__input),
+				::std::forward<_Output>(__output), __error_handler, __state,
+				[this](auto&& __step_input, auto&& __step_output, auto& __step_error_handler,
+					encode_state& __step_state) {
+					return this->encode_one(::std::forward<decltype(__step_input)>(__step_input),
+						::std::forward<decltype(__step_output)>(__step_output), __step_error_handler,
+						__step_state);
+				});
+		}
+
+	private:
+		friend struct __txt_detail::__iconv_transcoder;
+
+		//////
+		/// @brief Runs `__desc` over as much of the (contiguous) input and output as it can in one call, and moves
+		/// both ranges past what iconv read and wrote.
+		///
+		/// @returns Whether or not iconv converted the entire input.
+		template <typename _InputUnit, typename _OutputUnit, typename _WorkingInput, typename _WorkingOutput>
+		static bool _S_convert_bulk(::ztd::plat::icnv::descriptor __desc, _WorkingInput& __working_input,
+			_WorkingOutput& __working_output) noexcept {
+			const ::std::size_t __input_size = static_cast<::std::size_t>(::ztd::ranges::size(__working_input));
+			const ::std::size_t __output_size = static_cast<::std::size_t>(::ztd::ranges::size(__working_output));
+			if (__output_size == 0) {
+				return false;
+			}
+			const ::std::size_t __initial_read_size  = __input_size * sizeof(_InputUnit);
+			const ::std::size_t __initial_write_size = __output_size * sizeof(_OutputUnit);
+			::std::size_t __read_size                = __initial_read_size;
+			::std::size_t __write_size               = __initial_write_size;
+			// iconv does not write through the input pointer; it is only non-const for historical reasons
+			char* __read_pointer = const_cast<char*>(
+				reinterpret_cast<const char*>(::std::addressof(*::ztd::ranges::begin(__working_input))));
+			char* __write_pointer
+				= reinterpret_cast<char*>(::std::addressof(*::ztd::ranges::begin(__working_output)));
+			const ::std::size_t __convert_result = ::ztd::plat::icnv::functions().convert(__desc,
+				::std::addressof(__read_pointer), &__read_size, ::std::addressof(__write_pointer), &__write_size);
+			__working_input = __txt_detail::__bulk_advance(
+				__working_input, (__initial_read_size - __read_size) / sizeof(_InputUnit));
+			__working_output = __txt_detail::__bulk_advance(
+				__working_output, (__initial_write_size - __write_size) / sizeof(_OutputUnit));
+			return __convert_result != ::ztd::plat::icnv::conversion_failure;
+		}
+
+		//////
+		/// @brief Writes the sequence (if any) that returns `__desc` to its initial shift state into the
+		/// (contiguous) output, and moves the output past what was written.
+		///
+		/// @returns Whether or not the whole sequence fit into the output.
+		template <typename _OutputUnit, typename _WorkingOutput>
+		static bool _S_flush_bulk(::ztd::plat::icnv::descriptor __desc, _WorkingOutput& __working_output) noexcept {
+			const ::std::size_t __output_size = static_cast<::std::size_t>(::ztd::ranges::size(__working_output));
+			// a null output pointer would make iconv drop the sequence instead of reporting that it does not fit
+			char __no_space[1];
+			const ::std::size_t __initial_write_size = __output_size * sizeof(_OutputUnit);
+			::std::size_t __write_size               = __initial_write_size;
+			char* __write_pointer                    = __no_space + 0;
+			if (__output_size != 0) {
+				__write_pointer = reinterpret_cast<char*>(::std::addressof(*::ztd::ranges::begin(__working_output)));
+			}
+			const ::std::size_t __convert_result = ::ztd::plat::icnv::functions().convert(
+				__desc, nullptr, nullptr, ::std::addressof(__write_pointer), &__write_size);
+			__working_output = __txt_detail::__bulk_advance(
+				__working_output, (__initial_write_size - __write_size) / sizeof(_OutputUnit));
+			return __convert_result != ::ztd::plat::icnv::conversion_failure;
+		}
+
+		template <typename _InputUnit, typename _OutputUnit, typename _Input, typename _Output,
+			typename _ErrorHandler, typename _State, typename _OneStep>
+		auto _M_convert(_Input&& __input, _Output&& __output, _ErrorHandler& __error_handler, _State& __state,
+			_OneStep&& __one_step) const noexcept {
+			using _Drain = __txt_detail::__bulk_drain;
+			return __txt_detail::__bulk_convert<sizeof(_InputUnit), sizeof(_OutputUnit), _Drain::__none>(
+				::std::forward<_Input>(__input), ::std::forward<_Output>(__output), __error_handler, __state,
+				[](auto& __working_input, auto& __working_output, _State& __bulk_state) {
+					if (!__bulk_state._M_is_valid()) {
+						return false;
+					}
+					// if iconv stopped with nothing left to read, there is nothing left for a single step either
+					return _S_convert_bulk<_InputUnit, _OutputUnit>(
+					            __bulk_state._M_conv_descriptor, __working_input, __working_output)
+					     || ::ztd::ranges::empty(__working_input);
+				},
+				::std::forward<_OneStep>(__one_step));
+		}
+
+		template <typename _Encoding, typename _Input, typename _Output, typename _ErrorHandler,
+			::std::enable_if_t<::std::is_base_of_v<basic_iconv, _Encoding>>* = nullptr>
+		friend auto __text_decode(::ztd::tag<_Encoding>, _Input&& __input,
+			type_identity_t<const basic_iconv&> __encoding, _Output&& __output, _ErrorHandler&& __error_handler,
+			decode_state& __state) {
+			return __encoding.decode(::std::forward<_Input>(__input), ::std::forward<_Output>(__output),
+				::std::forward<_ErrorHandler>(__error_handler), __state);
+		}
+
+		template <typename _Encoding, typename _Input, typename _Output, typename _ErrorHandler,
+			::std::enable_if_t<::std::is_base_of_v<basic_iconv, _Encoding>>* = nullptr>
+		friend auto __text_encode(::ztd::tag<_Encoding>, _Input&& __input,
+			type_identity_t<const basic_iconv&> __encoding, _Output&& __output, _ErrorHandler&& __error_handler,
+			encode_state& __state) {
+			return __encoding.encode(::std::forward<_Input>(__input), ::std::forward<_Output>(__output),
+				::std::forward<_ErrorHandler>(__error_handler), __state);
+		}
+
 #endif
 	public:
 		//////
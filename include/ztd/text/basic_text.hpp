@@ -47,9 +47,12 @@
 #include <ztd/text/decode_view.hpp>
 #include <ztd/text/normalized_view.hpp>
 #include <ztd/text/basic_text_view_iterator.hpp>
+#include <ztd/text/code_point_index.hpp>
 #include <ztd/text/assert.hpp>
 #include <ztd/text/detail/default_char_range.hpp>
+#include <ztd/text/detail/splice_storage.hpp>
 
+#include <ztd/idk/ebco.hpp>
 #include <ztd/idk/unwrap.hpp>
 #include <ztd/idk/basic_c_string_view.hpp>
 #include <ztd/ranges/from_range.hpp>
@@ -59,6 +62,7 @@
 
 #include <string>
 #include <iterator>
+#include <cstddef>
 
 #include <ztd/prologue.hpp>
 
@@ -80,10 +84,15 @@ namespace ztd { namespace text {
 	/// units from the `_Encoding` type.
 	/// @tparam _ErrorHandler The default error handler to use for any and all operations on text. Generally, most
 	/// operations will provide room to override this.
+	/// @tparam _IndexPolicy How code point counts and positions are looked up: ztd::text::no_code_point_index decodes
+	/// the text every time, while ztd::text::cached_code_point_index caches them and keeps them up to date.
 	template <typename _Encoding, typename _NormalizationForm = nfkc,
-		typename _Range = __txt_detail::__default_char_range_t<code_unit_t<_Encoding>>>
-	class basic_text {
+		typename _Range = __txt_detail::__default_char_range_t<code_unit_t<_Encoding>>,
+		typename _IndexPolicy = no_code_point_index>
+	class basic_text : private ::ztd::ebco<_IndexPolicy, 0> {
 	private:
+		// the index policy is a base so that ztd::text::no_code_point_index, the default, takes up no space
+		using __index_base_t      = ::ztd::ebco<_IndexPolicy, 0>;
 		using _URange             = unwrap_remove_cvref_t<_Range>;
 		using _CVRange            = unwrap_remove_reference_t<_Range>;
 		using _UEncoding          = unwrap_remove_cvref_t<_Encoding>;
@@ -106,6 +115,9 @@ namespace ztd { namespace text {
 		/// @brief The normalization form type this view is imposing on top of the encoded sequence.
 		using normalization_type = _NormalizationForm;
 		//////
+		/// @brief The policy used to count code points and look up their positions.
+		using index_policy_type = _IndexPolicy;
+		//////
 		/// @brief The code point type when the underlying storage is decoded.
 		using code_point = code_point_t<_UEncoding>;
 		//////
@@ -261,25 +273,7 @@ namespace ztd { namespace text {
 		constexpr basic_text(::ztd::ranges::from_range_t, _Input&& __input) noexcept(
 			_S_constructor_from_range_noexcept<_Input>())
 		: basic_text() {
-			using _InputValueType = ranges::range_value_type_t<_Input>;
-			if constexpr (is_compatible_code_points_v<code_point, _InputValueType>) {
-				// must transcode from whatever is in __input to our internal container...
-				using _BackInserterIterator
-					= decltype(::std::back_inserter(ztd::unwrap(::std::declval<range_type&>())));
-				using _Unbounded = ranges::unbounded_view<_BackInserterIterator>;
-				_Unbounded __insert_view(::std::back_inserter(ztd::unwrap(this->_M_range)));
-				::ztd::text::encode_into_raw(
-					::std::forward<_Input>(__input), this->_M_encoding, ::std::move(__insert_view));
-			}
-			else {
-				// must transcode from whatever is in __input to our internal container...
-				using _BackInserterIterator
-					= decltype(::std::back_inserter(ztd::unwrap(::std::declval<range_type&>())));
-				using _Unbounded = ranges::unbounded_view<_BackInserterIterator>;
-				_Unbounded __insert_view(::std::back_inserter(ztd::unwrap(this->_M_range)));
-				::ztd::text::transcode_into_raw(
-					::std::forward<_Input>(__input), this->_M_encoding, ::std::move(__insert_view));
-			}
+			this->append(::std::forward<_Input>(__input));
 		}
 
 		//////
@@ -288,25 +282,7 @@ namespace ztd { namespace text {
 		constexpr basic_text(::ztd::ranges::from_range_t, _Input&& __input, _FromEncoding&& __from_encoding) noexcept(
 			_S_constructor_from_range_noexcept<_Input, _FromEncoding>())
 		: basic_text() {
-			using _InputValueType = ranges::range_value_type_t<_Input>;
-			if constexpr (is_compatible_code_points_v<code_point, _InputValueType>) {
-				// must transcode from whatever is in __input to our internal container...
-				using _BackInserterIterator
-					= decltype(::std::back_inserter(ztd::unwrap(::std::declval<range_type&>())));
-				using _Unbounded = ranges::unbounded_view<_BackInserterIterator>;
-				_Unbounded __insert_view(::std::back_inserter(ztd::unwrap(this->_M_range)));
-				::ztd::text::encode_into_raw(::std::forward<_Input>(__input), this->_M_encoding,
-					::std::move(__insert_view), ::std::forward<_FromEncoding>(__from_encoding));
-			}
-			else {
-				// must transcode from whatever is in __input to our internal container...
-				using _BackInserterIterator
-					= decltype(::std::back_inserter(ztd::unwrap(::std::declval<range_type&>())));
-				using _Unbounded = ranges::unbounded_view<_BackInserterIterator>;
-				_Unbounded __insert_view(::std::back_inserter(ztd::unwrap(this->_M_range)));
-				::ztd::text::transcode_into_raw(::std::forward<_Input>(__input), this->_M_encoding,
-					::std::move(__insert_view), ::std::forward<_FromEncoding>(__from_encoding));
-			}
+			this->append(::std::forward<_Input>(__input), ::std::forward<_FromEncoding>(__from_encoding));
 		}
 
 		//////
@@ -316,33 +292,15 @@ namespace ztd { namespace text {
 			_ErrorHandler&& __error_handler) noexcept(_S_constructor_from_range_noexcept<_Input, _FromEncoding,
 			_ErrorHandler>())
 		: basic_text() {
-			using _InputValueType = ranges::range_value_type_t<_Input>;
-			if constexpr (is_compatible_code_points_v<code_point, _InputValueType>) {
-				// must transcode from whatever is in __input to our internal container...
-				using _BackInserterIterator
-					= decltype(::std::back_inserter(ztd::unwrap(::std::declval<range_type&>())));
-				using _Unbounded = ranges::unbounded_view<_BackInserterIterator>;
-				_Unbounded __insert_view(::std::back_inserter(ztd::unwrap(this->_M_range)));
-				::ztd::text::encode_into_raw(::std::forward<_Input>(__input), this->_M_encoding,
-					::std::move(__insert_view), ::std::forward<_FromEncoding>(__from_encoding),
-					::std::forward<_ErrorHandler>(__error_handler));
-			}
-			else {
-				// must transcode from whatever is in __input to our internal container...
-				using _BackInserterIterator
-					= decltype(::std::back_inserter(ztd::unwrap(::std::declval<range_type&>())));
-				using _Unbounded = ranges::unbounded_view<_BackInserterIterator>;
-				_Unbounded __insert_view(::std::back_inserter(ztd::unwrap(this->_M_range)));
-				::ztd::text::transcode_into_raw(::std::forward<_Input>(__input), this->_M_encoding,
-					::std::move(__insert_view), ::std::forward<_FromEncoding>(__from_encoding),
-					::std::forward<_ErrorHandler>(__error_handler));
-			}
+			this->append(::std::forward<_Input>(__input), ::std::forward<_FromEncoding>(__from_encoding),
+				::std::forward<_ErrorHandler>(__error_handler));
 		}
 
 		explicit constexpr basic_text(::std::in_place_t) // cf
 			noexcept(_S_constructor_in_place())
 		: _M_encoding(), _M_normalization(), _M_range() {
 			this->_M_verify_integrity();
+			this->_M_index()._M_rebuild(this->_M_encoding, ::ztd::unwrap(this->_M_range));
 		}
 
 		constexpr basic_text(::std::in_place_t, range_type __range)            // cf
@@ -351,6 +309,7 @@ namespace ztd { namespace text {
 			     && ::std::is_nothrow_default_constructible_v<normalization_type>)
 		: _M_encoding(), _M_normalization(), _M_range(::std::move(__range)) {
 			this->_M_verify_integrity();
+			this->_M_index()._M_rebuild(this->_M_encoding, ::ztd::unwrap(this->_M_range));
 		}
 
 		constexpr basic_text(::std::in_place_t, range_type __range, encoding_type __encoding) // cf
@@ -359,6 +318,7 @@ namespace ztd { namespace text {
 			     && ::std::is_nothrow_default_constructible_v<normalization_type>)
 		: _M_encoding(::std::move(__encoding)), _M_normalization(), _M_range(::std::move(__range)) {
 			this->_M_verify_integrity();
+			this->_M_index()._M_rebuild(this->_M_encoding, ::ztd::unwrap(this->_M_range));
 		}
 
 		constexpr basic_text(::std::in_place_t, range_type __range, encoding_type __encoding,
@@ -370,6 +330,7 @@ namespace ztd { namespace text {
 		, _M_normalization(::std::move(__normalization_form))
 		, _M_range(::std::move(__range)) {
 			this->_M_verify_integrity();
+			this->_M_index()._M_rebuild(this->_M_encoding, ::ztd::unwrap(this->_M_range));
 		}
 
 		// observers
@@ -389,7 +350,15 @@ namespace ztd { namespace text {
 		}
 
 		// observers: storage
+
+		//////
+		/// @brief The underlying storage.
+		///
+		/// @remarks Because the storage can be changed through the returned reference, any cached code point index
+		/// is marked as stale, and the next lookup rebuilds it. Call ztd::text::basic_text::reindex once done
+		/// modifying it to pay for that up-front.
 		constexpr range_type& base() & noexcept {
+			this->_M_index()._M_invalidate();
 			return this->_M_range;
 		}
 
@@ -398,11 +367,20 @@ namespace ztd { namespace text {
 		}
 
 		constexpr range_type&& base() && noexcept {
+			this->_M_index()._M_invalidate();
 			return ::std::move(this->_M_range);
 		}
 
 		// observers: underlying range
+
+		//////
+		/// @brief The underlying storage.
+		///
+		/// @remarks Because the storage can be changed through the returned reference, any cached code point index
+		/// is marked as stale, and the next lookup rebuilds it. Call ztd::text::basic_text::reindex once done
+		/// modifying it to pay for that up-front.
 		constexpr range_type& range() & noexcept {
+			this->_M_index()._M_invalidate();
 			return this->_M_range;
 		}
 
@@ -411,27 +389,273 @@ namespace ztd { namespace text {
 		}
 
 		constexpr range_type&& range() && noexcept {
+			this->_M_index()._M_invalidate();
 			return ::std::move(this->_M_range);
 		}
 
 		// observers: encoding
 		constexpr encoding_type& encoding() & noexcept {
-			return this->_M_range;
+			this->_M_index()._M_invalidate();
+			return this->_M_encoding;
 		}
 
 		constexpr const encoding_type& encoding() const& noexcept {
-			return this->_M_range;
+			return this->_M_encoding;
 		}
 
 		constexpr encoding_type&& encoding() && noexcept {
 			return ::std::move(this->_M_encoding);
 		}
 
+		// observers: code points
+
+		//////
+		/// @brief The number of code points in this text.
+		///
+		/// @remarks O(1) with ztd::text::cached_code_point_index; otherwise, this decodes the whole text.
+		constexpr size_type size() const {
+			return static_cast<size_type>(
+				this->_M_index()._M_size(this->_M_encoding, ::ztd::unwrap(this->_M_range)));
+		}
+
+		//////
+		/// @brief Whether this text has no code units in it.
+		constexpr bool empty() const noexcept {
+			return ::ztd::ranges::empty(::ztd::unwrap(this->_M_range));
+		}
+
+		//////
+		/// @brief The index of the first code unit of the code point at `__code_point_index`.
+		///
+		/// @remarks If the index is past the last code point, this returns the number of code units in the storage.
+		/// With ztd::text::cached_code_point_index, this decodes from the nearest checkpoint; otherwise, it decodes
+		/// from the start of the text.
+		constexpr ::std::size_t code_unit_index(size_type __code_point_index) const {
+			return this->_M_index()._M_code_unit_index(this->_M_encoding, ::ztd::unwrap(this->_M_range),
+				static_cast<::std::size_t>(__code_point_index));
+		}
+
+		//////
+		/// @brief The index of the code point that starts at the code unit at `__code_unit_index`.
+		///
+		/// @remarks `__code_unit_index` must be the start of a complete encoded sequence, or the size of the
+		/// storage. With ztd::text::cached_code_point_index, this decodes from the nearest checkpoint; otherwise, it
+		/// decodes from the start of the text.
+		constexpr size_type code_point_index(::std::size_t __code_unit_index) const {
+			ZTD_TEXT_ASSERT(__code_unit_index <= this->_M_storage_size());
+			return static_cast<size_type>(this->_M_index()._M_code_point_index(
+				this->_M_encoding, ::ztd::unwrap(this->_M_range), __code_unit_index));
+		}
+
 		// modifiers:
+
+		//////
+		/// @brief Rebuilds any cached code point index from scratch.
+		///
+		/// @remarks Never needed for correctness: a lookup after modifying the storage directly through
+		/// ztd::text::basic_text::base or ztd::text::basic_text::range rebuilds the index on its own.
+		constexpr void reindex() {
+			this->_M_index()._M_rebuild(this->_M_encoding, ::ztd::unwrap(this->_M_range));
+		}
+
 		// modifiers: insertion
 
+		//////
+		/// @brief Appends the given input to the end of this text.
+		///
+		/// @param[in] __input The input to append. If its elements are code points compatible with this text's
+		/// encoding, it is encoded directly; otherwise, it is transcoded from the default encoding of its code unit
+		/// type.
+		///
+		/// @remarks The storage is grown once by an exact or upper-bound size, the input is converted directly
+		/// into the new tail of the storage, and the storage is then shrunk to what was actually written.
+		template <typename _Input>
+		constexpr basic_text& append(_Input&& __input) {
+			this->_M_splice(this->_M_storage_size(), 0, ::std::forward<_Input>(__input));
+			return *this;
+		}
+
+		//////
+		/// @brief Appends the given input, interpreted through `__from_encoding`, to the end of this text.
+		template <typename _Input, typename _FromEncoding>
+		constexpr basic_text& append(_Input&& __input, _FromEncoding&& __from_encoding) {
+			this->_M_splice(this->_M_storage_size(), 0, ::std::forward<_Input>(__input),
+				::std::forward<_FromEncoding>(__from_encoding));
+			return *this;
+		}
+
+		//////
+		/// @brief Appends the given input, interpreted through `__from_encoding`, to the end of this text, using
+		/// `__error_handler` for any conversion errors.
+		template <typename _Input, typename _FromEncoding, typename _ErrorHandler>
+		constexpr basic_text& append(
+			_Input&& __input, _FromEncoding&& __from_encoding, _ErrorHandler&& __error_handler) {
+			this->_M_splice(this->_M_storage_size(), 0, ::std::forward<_Input>(__input),
+				::std::forward<_FromEncoding>(__from_encoding), ::std::forward<_ErrorHandler>(__error_handler));
+			return *this;
+		}
+
+		//////
+		/// @brief Inserts the given input before the code unit at `__code_unit_index`.
+		///
+		/// @param[in] __code_unit_index The index into the underlying storage to insert at. It must be the start of
+		/// a complete encoded sequence.
+		/// @param[in] __input The input to insert; see ztd::text::basic_text::append for how it is interpreted.
+		template <typename _Input>
+		constexpr basic_text& insert(::std::size_t __code_unit_index, _Input&& __input) {
+			this->_M_splice(__code_unit_index, 0, ::std::forward<_Input>(__input));
+			return *this;
+		}
+
+		//////
+		/// @brief Inserts the given input, interpreted through `__from_encoding`, before the code unit at
+		/// `__code_unit_index`.
+		template <typename _Input, typename _FromEncoding>
+		constexpr basic_text& insert(
+			::std::size_t __code_unit_index, _Input&& __input, _FromEncoding&& __from_encoding) {
+			this->_M_splice(__code_unit_index, 0, ::std::forward<_Input>(__input),
+				::std::forward<_FromEncoding>(__from_encoding));
+			return *this;
+		}
+
+		//////
+		/// @brief Inserts the given input, interpreted through `__from_encoding`, before the code unit at
+		/// `__code_unit_index`, using `__error_handler` for any conversion errors.
+		template <typename _Input, typename _FromEncoding, typename _ErrorHandler>
+		constexpr basic_text& insert(::std::size_t __code_unit_index, _Input&& __input,
+			_FromEncoding&& __from_encoding, _ErrorHandler&& __error_handler) {
+			this->_M_splice(__code_unit_index, 0, ::std::forward<_Input>(__input),
+				::std::forward<_FromEncoding>(__from_encoding), ::std::forward<_ErrorHandler>(__error_handler));
+			return *this;
+		}
+
+		// modifiers: replacement
+
+		//////
+		/// @brief Replaces the `__code_unit_count` code units starting at `__code_unit_index` with the given input.
+		///
+		/// @param[in] __code_unit_index The index into the underlying storage where the replaced sequence starts. It
+		/// must be the start of a complete encoded sequence.
+		/// @param[in] __code_unit_count The number of code units to replace. It must cover only complete encoded
+		/// sequences.
+		/// @param[in] __input The input to insert; see ztd::text::basic_text::append for how it is interpreted.
+		template <typename _Input>
+		constexpr basic_text& replace(
+			::std::size_t __code_unit_index, ::std::size_t __code_unit_count, _Input&& __input) {
+			this->_M_splice(__code_unit_index, __code_unit_count, ::std::forward<_Input>(__input));
+			return *this;
+		}
+
+		//////
+		/// @brief Replaces the `__code_unit_count` code units starting at `__code_unit_index` with the given input,
+		/// interpreted through `__from_encoding`.
+		template <typename _Input, typename _FromEncoding>
+		constexpr basic_text& replace(::std::size_t __code_unit_index, ::std::size_t __code_unit_count,
+			_Input&& __input, _FromEncoding&& __from_encoding) {
+			this->_M_splice(__code_unit_index, __code_unit_count, ::std::forward<_Input>(__input),
+				::std::forward<_FromEncoding>(__from_encoding));
+			return *this;
+		}
+
+		//////
+		/// @brief Replaces the `__code_unit_count` code units starting at `__code_unit_index` with the given input,
+		/// interpreted through `__from_encoding`, using `__error_handler` for any conversion errors.
+		template <typename _Input, typename _FromEncoding, typename _ErrorHandler>
+		constexpr basic_text& replace(::std::size_t __code_unit_index, ::std::size_t __code_unit_count,
+			_Input&& __input, _FromEncoding&& __from_encoding, _ErrorHandler&& __error_handler) {
+			this->_M_splice(__code_unit_index, __code_unit_count, ::std::forward<_Input>(__input),
+				::std::forward<_FromEncoding>(__from_encoding), ::std::forward<_ErrorHandler>(__error_handler));
+			return *this;
+		}
+
+		// modifiers: erasure
+
+		//////
+		/// @brief Removes the `__code_unit_count` code units starting at `__code_unit_index`.
+		///
+		/// @remarks The removed code units must form complete encoded sequences.
+		constexpr basic_text& erase(::std::size_t __code_unit_index, ::std::size_t __code_unit_count) {
+			ZTD_TEXT_ASSERT(__code_unit_index + __code_unit_count <= this->_M_storage_size());
+			if (__code_unit_count != 0) {
+				auto& __storage = ::ztd::unwrap(this->_M_range);
+				auto __first    = ::std::next(::ztd::ranges::begin(__storage), __code_unit_index);
+				__storage.erase(__first, ::std::next(__first, __code_unit_count));
+				this->_M_index()._M_update(
+					this->_M_encoding, __storage, __code_unit_index, __code_unit_count, 0);
+			}
+			return *this;
+		}
+
+		//////
+		/// @brief Removes everything from this text.
+		constexpr void clear() noexcept(noexcept(::ztd::unwrap(::std::declval<range_type&>()).clear())) {
+			::ztd::unwrap(this->_M_range).clear();
+			this->_M_index()._M_clear();
+		}
 
 	private:
+		constexpr ::std::size_t _M_storage_size() const noexcept {
+			return static_cast<::std::size_t>(::ztd::ranges::size(::ztd::unwrap(this->_M_range)));
+		}
+
+		template <typename _Input, typename... _Args>
+		constexpr void _M_splice(
+			::std::size_t __code_unit_index, ::std::size_t __code_unit_count, _Input&& __input, _Args&&... __args) {
+			if constexpr (::ztd::is_character_pointer_v<::ztd::remove_cvref_t<_Input>>) {
+				using _CStringView = ::ztd::basic_c_string_view<::std::remove_pointer_t<remove_cvref_t<_Input>>>;
+				this->_M_splice(__code_unit_index, __code_unit_count, _CStringView(__input),
+					::std::forward<_Args>(__args)...);
+			}
+			else {
+				ZTD_TEXT_ASSERT(__code_unit_index + __code_unit_count <= this->_M_storage_size());
+				const ::std::size_t __written = this->_M_splice_into(
+					__code_unit_index, __code_unit_count, __input, ::std::forward<_Args>(__args)...);
+				this->_M_index()._M_update(this->_M_encoding, ::ztd::unwrap(this->_M_range), __code_unit_index,
+					__code_unit_count, __written);
+			}
+		}
+
+		template <typename _Input>
+		constexpr ::std::size_t _M_splice_into(
+			::std::size_t __code_unit_index, ::std::size_t __code_unit_count, _Input& __input) {
+			using _InputValueType = ranges::range_value_type_t<_Input>;
+			default_handler_t __handler {};
+			if constexpr (is_compatible_code_points_v<code_point, _InputValueType>) {
+				return __txt_detail::__encode_splice_into_storage(::ztd::unwrap(this->_M_range), __code_unit_index,
+					__code_unit_count, __input, this->_M_encoding, __handler);
+			}
+			else {
+				using _FromEncoding = default_code_unit_encoding_t<_InputValueType>;
+				_FromEncoding __from_encoding {};
+				return this->_M_splice_into(
+					__code_unit_index, __code_unit_count, __input, __from_encoding, __handler);
+			}
+		}
+
+		template <typename _Input, typename _FromEncoding>
+		constexpr ::std::size_t _M_splice_into(::std::size_t __code_unit_index, ::std::size_t __code_unit_count,
+			_Input& __input, _FromEncoding&& __from_encoding) {
+			default_handler_t __handler {};
+			return this->_M_splice_into(__code_unit_index, __code_unit_count, __input, __from_encoding, __handler);
+		}
+
+		template <typename _Input, typename _FromEncoding, typename _ErrorHandler>
+		constexpr ::std::size_t _M_splice_into(::std::size_t __code_unit_index, ::std::size_t __code_unit_count,
+			_Input& __input, _FromEncoding&& __from_encoding, _ErrorHandler&& __error_handler) {
+			auto __to_error_handler = __txt_detail::__duplicate_or_be_careless(__error_handler);
+			return __txt_detail::__transcode_splice_into_storage(::ztd::unwrap(this->_M_range), __code_unit_index,
+				__code_unit_count, __input, __from_encoding, this->_M_encoding, __error_handler,
+				__to_error_handler);
+		}
+
+		constexpr index_policy_type& _M_index() noexcept {
+			return this->__index_base_t::get_value();
+		}
+
+		constexpr const index_policy_type& _M_index() const noexcept {
+			return this->__index_base_t::get_value();
+		}
+
 		constexpr void _M_verify_integrity() const noexcept {
 			const bool __success = ::ztd::text::validate_decodable_as(this->_M_range, this->_M_encoding).valid;
 			ZTD_TEXT_ASSERT_MESSAGE("given data has violated its encoding constraints", __success);
@@ -41,6 +41,7 @@
 #include <ztd/text/is_ignorable_error_handler.hpp>
 #include <ztd/text/detail/empty_state.hpp>
 #include <ztd/text/detail/replacement_units.hpp>
+#include <ztd/text/detail/multibyte_reverse_tables.hpp>
 
 #include <ztd/encoding_tables/big5_hkscs.tables.hpp>
 #include <ztd/ranges/adl.hpp>
@@ -310,7 +311,10 @@ namespace ztd { namespace text {
 					ztd::text::encoding_error::ok);
 			}
 
-			::std::optional<::std::size_t> __maybe_index = ::ztd::et::big5_hkscs_code_point_to_index(__code_point32);
+			::std::optional<::std::size_t> __maybe_index
+				= __txt_detail::__multibyte_code_point_to_index<126 * 157,
+				     &::ztd::et::big5_hkscs_index_to_code_point,
+				     &::ztd::et::big5_hkscs_code_point_to_index>(__code_point32);
 			if (__maybe_index) {
 				const ::std::size_t __index              = *__maybe_index;
 				const ::std::size_t __second_byte_base   = (__index % 157);
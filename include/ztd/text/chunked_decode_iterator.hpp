@@ -0,0 +1,448 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#pragma once
+
+#ifndef ZTD_TEXT_CHUNKED_DECODE_ITERATOR_HPP
+#define ZTD_TEXT_CHUNKED_DECODE_ITERATOR_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/error_handler.hpp>
+#include <ztd/text/state.hpp>
+#include <ztd/text/code_point.hpp>
+#include <ztd/text/max_units.hpp>
+#include <ztd/text/error_handler_always_returns_ok.hpp>
+#include <ztd/text/detail/encoding_iterator.hpp>
+#include <ztd/text/detail/encoding_iterator_storage.hpp>
+#include <ztd/text/detail/chunk_fill.hpp>
+
+#include <ztd/idk/unwrap.hpp>
+#include <ztd/idk/type_traits.hpp>
+#include <ztd/ranges/adl.hpp>
+#include <ztd/ranges/range.hpp>
+#include <ztd/ranges/reconstruct.hpp>
+
+#include <array>
+#include <cstddef>
+
+#include <ztd/prologue.hpp>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	//////
+	/// @brief The sentinel to use as the `end` value for a ztd::text::chunked_decode_iterator.
+	using chunked_decode_sentinel_t = __txt_detail::__encoding_sentinel_t;
+
+	//////
+	/// @brief An iterator over a range of code units, presented as a range of code points, using the `_Encoding`
+	/// specified to do so. Code points are decoded in bulk, up to `_ChunkSize` at a time, into a buffer held by the
+	/// iterator.
+	///
+	/// @tparam _Encoding The encoding to read the underlying range of code units as.
+	/// @tparam _Range The range of input that will be fed into the _Encoding's decode operation.
+	/// @tparam _ErrorHandler The error handler for any decode-step failures.
+	/// @tparam _State The state type to use for the decode operations.
+	/// @tparam _ChunkSize The number of code points to decode per refill. Never less than
+	/// ztd::text::max_code_points_v for the encoding.
+	///
+	/// @remarks Where ztd::text::decode_iterator calls `decode_one` on every refill, this iterator calls the bulk
+	/// ztd::text::decode_into_raw once per chunk and then serves `operator*` and `operator++` from its buffer. This
+	/// makes it much faster to walk, but much more expensive to copy. `error_code()` reports the last error of the
+	/// chunk currently being served, and `range()` returns the input not yet decoded into the buffer. Input ranges
+	/// which cannot be walked backwards are filled with one `decode_one` call per code point, so that a sequence
+	/// split across the end of the chunk never has to be put back.
+	template <typename _Encoding, typename _Range, typename _ErrorHandler = default_handler_t,
+		typename _State          = decode_state_t<_Encoding>,
+		::std::size_t _ChunkSize = ZTD_TEXT_CHUNKED_VIEW_BUFFER_SIZE_I_(code_point_t<_Encoding>)>
+	class chunked_decode_iterator
+	: private __txt_detail::__iterator_storage<_Encoding, _Range, _ErrorHandler, _State>,
+	  private __txt_detail::__cursor_cache<
+		  __txt_detail::__decode_chunk_buffer_size_v<unwrap_remove_cvref_t<_Encoding>, _ChunkSize>, false>,
+	  private __txt_detail::__error_cache<
+		  decode_error_handler_always_returns_ok_v<unwrap_remove_cvref_t<_Encoding>,
+		       unwrap_remove_cvref_t<_ErrorHandler>>> {
+	private:
+		using _UEncoding     = unwrap_remove_cvref_t<_Encoding>;
+		using _UErrorHandler = unwrap_remove_cvref_t<_ErrorHandler>;
+		using _URange        = unwrap_remove_cvref_t<_Range>;
+		using _BaseIterator  = ranges::range_const_iterator_t<_URange>;
+		inline static constexpr ::std::size_t _MaxChunkValues
+			= __txt_detail::__decode_chunk_size_v<_UEncoding, _ChunkSize>;
+		inline static constexpr ::std::size_t _MaxValues
+			= __txt_detail::__decode_chunk_buffer_size_v<_UEncoding, _ChunkSize>;
+		inline static constexpr bool _IsErrorless
+			= decode_error_handler_always_returns_ok_v<_UEncoding, _UErrorHandler>;
+		using __base_storage_t           = __txt_detail::__iterator_storage<_Encoding, _Range, _ErrorHandler, _State>;
+		using __base_cursor_cache_t      = __txt_detail::__cursor_cache<_MaxValues, false>;
+		using __base_cursor_cache_size_t = typename __base_cursor_cache_t::_SizeType;
+		using __base_error_cache_t       = __txt_detail::__error_cache<_IsErrorless>;
+
+	public:
+		//////
+		/// @brief The underlying range type.
+		using range_type = _Range;
+		//////
+		/// @brief The base iterator type.
+		using iterator = _BaseIterator;
+		//////
+		/// @brief The encoding type used for transformations.
+		using encoding_type = _Encoding;
+		//////
+		/// @brief The error handler when a decode operation fails.
+		using error_handler_type = _ErrorHandler;
+		//////
+		/// @brief The state type used for decode operations.
+		using state_type = remove_cvref_t<_State>;
+		//////
+		/// @brief The strength of the iterator category, as defined in relation to the base.
+		using iterator_category = ::std::conditional_t<
+			ranges::is_iterator_concept_or_better_v<::std::forward_iterator_tag, _BaseIterator>,
+			::std::forward_iterator_tag, ranges::iterator_category_t<_BaseIterator>>;
+		//////
+		/// @brief The strength of the iterator concept, as defined in relation to the base.
+		using iterator_concept = ::std::conditional_t<
+			ranges::is_iterator_concept_or_better_v<::std::forward_iterator_tag, _BaseIterator>,
+			::std::forward_iterator_tag, ranges::iterator_concept_t<_BaseIterator>>;
+		//////
+		/// @brief The object type that gets output on every dereference.
+		using value_type = code_point_t<_Encoding>;
+		//////
+		/// @brief A pointer type to the value_type.
+		using pointer = value_type*;
+		//////
+		/// @brief The value returned from derefencing the iterator.
+		///
+		/// @remarks This is a proxy iterator, so the `reference` is a non-reference `value_type.`
+		using reference = value_type;
+		//////
+		/// @brief The type returned when two of these pointers are subtracted from one another.
+		///
+		/// @remarks It's not a very useful type...
+		using difference_type = ranges::iterator_difference_type_t<_BaseIterator>;
+
+		//////
+		/// @brief Default constructor. Defaulted.
+		constexpr chunked_decode_iterator() = default;
+
+		//////
+		/// @brief Copy constructor. Defaulted.
+		constexpr chunked_decode_iterator(const chunked_decode_iterator&) = default;
+
+		//////
+		/// @brief Move constructor. Defaulted.
+		constexpr chunked_decode_iterator(chunked_decode_iterator&&) = default;
+
+		//////
+		/// @brief Constructs a ztd::text::chunked_decode_iterator from the explicitly given `__range`.
+		///
+		/// @param[in] __range The range value that will be read from.
+		///
+		/// @remarks Each argument is moved/forwarded in.
+		template <typename _ArgRange,
+			::std::enable_if_t<!::std::is_same_v<remove_cvref_t<_ArgRange>, chunked_decode_iterator>>* = nullptr>
+		constexpr chunked_decode_iterator(_ArgRange&& __range)
+		: chunked_decode_iterator(::std::forward<_ArgRange>(__range), encoding_type {}, error_handler_type {}) {
+		}
+
+		//////
+		/// @brief Constructs a ztd::text::chunked_decode_iterator from the explicitly given `__range`, and
+		/// `__encoding`.
+		///
+		/// @param[in] __range The range value that will be read from.
+		/// @param[in] __encoding The encoding object to use.
+		///
+		/// @remarks Each argument is moved in.
+		constexpr chunked_decode_iterator(range_type __range, encoding_type __encoding)
+		: chunked_decode_iterator(::std::move(__range), ::std::move(__encoding), error_handler_type {}) {
+		}
+
+		//////
+		/// @brief Constructs a ztd::text::chunked_decode_iterator from the explicitly given `__range`, and @p
+		/// __error_handler.
+		///
+		/// @param[in] __range The range value that will be read from.
+		/// @param[in] __error_handler The error handler to use for reporting errors.
+		///
+		/// @remarks Each argument is moved in.
+		constexpr chunked_decode_iterator(range_type __range, error_handler_type __error_handler)
+		: chunked_decode_iterator(::std::move(__range), encoding_type {}, ::std::move(__error_handler)) {
+		}
+
+		//////
+		/// @brief Constructs a ztd::text::chunked_decode_iterator from the explicitly given `__range`,
+		/// `__encoding`, and `__error_handler`.
+		///
+		/// @param[in] __range The range value that will be read from.
+		/// @param[in] __encoding The encoding object to use.
+		/// @param[in] __error_handler The error handler to use for reporting errors.
+		///
+		/// @remarks Each argument is moved in.
+		constexpr chunked_decode_iterator(
+			range_type __range, encoding_type __encoding, error_handler_type __error_handler)
+		: __base_storage_t(::std::move(__range), ::std::move(__encoding), ::std::move(__error_handler))
+		, __base_cursor_cache_t()
+		, __base_error_cache_t()
+		, _M_cache() {
+			this->_M_read_chunk();
+		}
+
+		//////
+		/// @brief Constructs a ztd::text::chunked_decode_iterator from the explicitly given `__range`,
+		/// `__encoding`, `__error_handler` and `__state`.
+		///
+		/// @param[in] __range The range value that will be read from.
+		/// @param[in] __encoding The encoding object to use.
+		/// @param[in] __error_handler The error handler to use for reporting errors.
+		/// @param[in] __state The current state.
+		///
+		/// @remarks Each argument is moved in.
+		constexpr chunked_decode_iterator(
+			range_type __range, encoding_type __encoding, error_handler_type __error_handler, state_type __state)
+		: __base_storage_t(
+			  ::std::move(__range), ::std::move(__encoding), ::std::move(__error_handler), ::std::move(__state))
+		, __base_cursor_cache_t()
+		, __base_error_cache_t()
+		, _M_cache() {
+			this->_M_read_chunk();
+		}
+
+		//////
+		/// @brief Copy assignment operator. Defaulted.
+		constexpr chunked_decode_iterator& operator=(const chunked_decode_iterator&) = default;
+		//////
+		/// @brief Move assignment operator. Defaulted.
+		constexpr chunked_decode_iterator& operator=(chunked_decode_iterator&&) = default;
+
+		//////
+		/// @brief The encoding object.
+		///
+		/// @returns A const l-value reference to the encoding object used to construct this iterator.
+		constexpr const encoding_type& encoding() const noexcept {
+			return this->__base_storage_t::_M_get_encoding();
+		}
+
+		//////
+		/// @brief The encoding object.
+		///
+		/// @returns An l-value reference to the encoding object used to construct this iterator.
+		constexpr encoding_type& encoding() noexcept {
+			return this->__base_storage_t::_M_get_encoding();
+		}
+
+		//////
+		/// @brief The state object.
+		///
+		/// @returns A const l-value reference to the state object used to construct this iterator.
+		constexpr const state_type& state() const noexcept {
+			return this->__base_storage_t::_M_get_state();
+		}
+
+		//////
+		/// @brief The state object.
+		///
+		/// @returns An l-value reference to the state object used to construct this iterator.
+		constexpr state_type& state() noexcept {
+			return this->__base_storage_t::_M_get_state();
+		}
+
+		//////
+		/// @brief The error handler object.
+		///
+		/// @returns A const l-value reference to the error handler used to construct this iterator.
+		constexpr const error_handler_type& error_handler() const& noexcept {
+			return this->__base_storage_t::_M_get_error_handler();
+		}
+
+		//////
+		/// @brief The error handler object.
+		///
+		/// @returns An l-value reference to the error handler used to construct this iterator.
+		constexpr error_handler_type& error_handler() & noexcept {
+			return this->__base_storage_t::_M_get_error_handler();
+		}
+
+		//////
+		/// @brief The error handler object.
+		///
+		/// @returns An r-value reference to the error handler used to construct this iterator.
+		constexpr error_handler_type&& error_handler() && noexcept {
+			return ::std::move(this->__base_storage_t::_M_get_error_handler());
+		}
+
+		//////
+		/// @brief The input range that has not yet been decoded into this iterator's buffer.
+		///
+		/// @returns A copy of the remaining input range.
+		constexpr range_type range() const noexcept(::std::is_nothrow_move_constructible_v<range_type>) {
+			return ::ztd::ranges::reconstruct(
+				::std::in_place_type<range_type>, this->__base_storage_t::_M_get_range());
+		}
+
+		//////
+		/// @brief Returns whether the last refill had an encoding error or not.
+		///
+		/// @returns The ztd::text::encoding_error that occurred. This can be ztd::text::encoding_error::ok for
+		/// an operation that went just fine.
+		///
+		/// @remarks A refill stops at the first error the error handler does not recover from, so the error
+		/// belongs to the last code points in the current chunk. If the error handler is identified as an error
+		/// handler that, if given a suitably sized buffer, will never return an error, this is always
+		/// ztd::text::encoding_error::ok.
+		constexpr encoding_error error_code() const noexcept {
+			if constexpr (_IsErrorless) {
+				return encoding_error::ok;
+			}
+			else {
+				return this->__base_error_cache_t::_M_to_error();
+			}
+		}
+
+		//////
+		/// @brief Copy then increment the iterator.
+		///
+		/// @returns A copy of iterator, before incrementing.
+		constexpr chunked_decode_iterator operator++(int) {
+			chunked_decode_iterator __copy = *this;
+			++(*this);
+			return __copy;
+		}
+
+		//////
+		/// @brief Increment the iterator.
+		///
+		/// @returns A reference to *this, after incrementing the iterator.
+		constexpr chunked_decode_iterator& operator++() {
+			++this->__base_cursor_cache_t::_M_position;
+			if (this->__base_cursor_cache_t::_M_position >= this->__base_cursor_cache_t::_M_size) {
+				this->_M_read_chunk();
+			}
+			return *this;
+		}
+
+		//////
+		/// @brief Dereference the iterator.
+		///
+		/// @remarks This is a proxy iterator, and therefore only returns a value_type object and not a reference
+		/// object. Encoding iterators are only readable, not writable.
+		constexpr reference operator*() const noexcept {
+			return this->_M_cache[this->__base_cursor_cache_t::_M_position];
+		}
+
+		// observers: comparison
+
+		//////
+		/// @brief Compares whether or not this iterator has truly reached the end.
+		friend constexpr bool operator==(
+			const chunked_decode_iterator& __it, const chunked_decode_sentinel_t&) {
+			return __it._M_base_is_empty()
+				&& __it.__base_cursor_cache_t::_M_position == __it.__base_cursor_cache_t::_M_size;
+		}
+
+		//////
+		/// @brief Compares whether or not this iterator has truly reached the end.
+		friend constexpr bool operator==(
+			const chunked_decode_sentinel_t& __sen, const chunked_decode_iterator& __it) {
+			return __it == __sen;
+		}
+
+		//////
+		/// @brief Compares whether or not this iterator has truly reached the end.
+		template <typename _Concept = iterator_concept,
+			::std::enable_if_t<
+			     ::ztd::ranges::is_concept_or_better_v<::std::forward_iterator_tag, _Concept>>* = nullptr>
+		friend constexpr bool operator==(
+			const chunked_decode_iterator& __it, const chunked_decode_iterator& __sen) {
+			return ::ztd::ranges::begin(__it.__base_storage_t::_M_get_range())
+				== ::ztd::ranges::begin(__sen.__base_storage_t::_M_get_range())
+				&& __it.__base_cursor_cache_t::_M_position == __sen.__base_cursor_cache_t::_M_position;
+		}
+
+		//////
+		/// @brief Compares whether or not this iterator has truly reached the end.
+		friend constexpr bool operator!=(
+			const chunked_decode_iterator& __it, const chunked_decode_sentinel_t& __sen) {
+			return !(__it == __sen);
+		}
+
+		//////
+		/// @brief Compares whether or not this iterator has truly reached the end.
+		friend constexpr bool operator!=(
+			const chunked_decode_sentinel_t& __sen, const chunked_decode_iterator& __it) {
+			return !(__it == __sen);
+		}
+
+		//////
+		/// @brief Compares whether or not this iterator has truly reached the end.
+		template <typename _Concept = iterator_concept,
+			::std::enable_if_t<
+			     ::ztd::ranges::is_concept_or_better_v<::std::forward_iterator_tag, _Concept>>* = nullptr>
+		friend constexpr bool operator!=(
+			const chunked_decode_iterator& __it, const chunked_decode_iterator& __sen) {
+			return !(__it == __sen);
+		}
+
+	private:
+		constexpr bool _M_base_is_empty() const noexcept {
+			return __txt_detail::__chunk_input_is_empty(this->__base_storage_t::_M_get_range());
+		}
+
+		constexpr void _M_read_chunk() {
+			value_type* __first = this->_M_cache.data();
+			__txt_detail::__chunk_fill_result<value_type*> __fill_result { __first, encoding_error::ok };
+			// a refill may legitimately produce nothing (e.g. skipped input), so keep going until there is either
+			// something to serve, an error to report, or no more input
+			while (__fill_result._M_last == __first && __fill_result._M_error_code == encoding_error::ok
+				&& !this->_M_base_is_empty()) {
+				__fill_result = __txt_detail::__decode_fill_chunk(this->__base_storage_t::_M_get_range(),
+					this->encoding(), this->__base_storage_t::_M_get_error_handler(), this->state(), __first,
+					__first + _MaxChunkValues, __first + _MaxValues);
+			}
+			if constexpr (!_IsErrorless) {
+				this->__base_error_cache_t::_M_set_errors(encoding_error::ok, __fill_result._M_error_code);
+			}
+			__base_cursor_cache_size_t __data_size
+				= static_cast<__base_cursor_cache_size_t>(__fill_result._M_last - __first);
+			ZTD_TEXT_ASSERT_MESSAGE_I_("size of produced value can never be bigger than the cache",
+				static_cast<::std::size_t>(__data_size) <= this->_M_cache.size());
+			this->__base_cursor_cache_t::_M_position = static_cast<__base_cursor_cache_size_t>(0);
+			this->__base_cursor_cache_t::_M_size     = __data_size;
+		}
+
+		::std::array<value_type, _MaxValues> _M_cache;
+	};
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#include <ztd/epilogue.hpp>
+
+#endif
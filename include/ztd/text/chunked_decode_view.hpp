@@ -0,0 +1,252 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#pragma once
+
+#ifndef ZTD_TEXT_CHUNKED_DECODE_VIEW_HPP
+#define ZTD_TEXT_CHUNKED_DECODE_VIEW_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/chunked_decode_iterator.hpp>
+#include <ztd/text/error_handler.hpp>
+#include <ztd/text/encoding.hpp>
+#include <ztd/text/code_unit.hpp>
+#include <ztd/text/code_point.hpp>
+#include <ztd/text/detail/default_char_view.hpp>
+
+#include <ztd/ranges/adl.hpp>
+#include <ztd/ranges/reconstruct.hpp>
+
+#include <string_view>
+#include <cstddef>
+
+#include <ztd/prologue.hpp>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	//////
+	/// @brief A view over a range of code units, presenting the code units as code points. Uses the `_Encoding`
+	/// specified to do so, decoding up to `_ChunkSize` code points at a time.
+	///
+	/// @tparam _Encoding The encoding to read the underlying range of code units as.
+	/// @tparam _Range The range of input that will be fed into the _Encoding's decode operation.
+	/// @tparam _ErrorHandler The error handler for any decode-step failures.
+	/// @tparam _State The state type to use for the decode operations.
+	/// @tparam _ChunkSize The number of code points to decode per refill of the iterator's buffer.
+	///
+	/// @remarks This is a drop-in replacement for ztd::text::decode_view when the view is walked from start to finish
+	/// and speed matters more than the size of the iterator. See ztd::text::chunked_decode_iterator for the
+	/// differences in what `error_code()` and `range()` report.
+	template <typename _Encoding, typename _Range = __txt_detail::__default_char_view_t<code_unit_t<_Encoding>>,
+		typename _ErrorHandler = default_handler_t, typename _State = decode_state_t<_Encoding>,
+		::std::size_t _ChunkSize = ZTD_TEXT_CHUNKED_VIEW_BUFFER_SIZE_I_(code_point_t<_Encoding>)>
+	class chunked_decode_view : public ::ztd::ranges::view_base {
+	private:
+		using _CVRange     = unwrap_remove_reference_t<_Range>;
+		using _StoredRange = ranges::range_reconstruct_t<const _CVRange>;
+
+	public:
+		//////
+		/// @brief The iterator type for this view.
+		using iterator = chunked_decode_iterator<_Encoding, _StoredRange, _ErrorHandler, _State, _ChunkSize>;
+		//////
+		/// @brief The sentinel type for this view.
+		using sentinel = chunked_decode_sentinel_t;
+		//////
+		/// @brief The value type for this view.
+		using value_type = ranges::iterator_value_type_t<iterator>;
+		//////
+		/// @brief The underlying range type.
+		using range_type = _Range;
+		//////
+		/// @brief The encoding type used for transformations.
+		using encoding_type = _Encoding;
+		//////
+		/// @brief The error handler when a decode operation fails.
+		using error_handler_type = _ErrorHandler;
+		//////
+		/// @brief The state type used for decode operations.
+		using state_type = decode_state_t<encoding_type>;
+
+		//////
+		/// @brief Constructs a chunked_decode_view from the underlying range.
+		///
+		/// @param[in] __range The input range to wrap and iterate over.
+		///
+		/// @remarks The stored encoding, error handler, and state type are default-constructed.
+		template <typename _ArgRange,
+			::std::enable_if_t<!::std::is_same_v<remove_cvref_t<_ArgRange>, chunked_decode_view>
+			     && !::std::is_same_v<remove_cvref_t<_ArgRange>, iterator>>* = nullptr>
+		constexpr chunked_decode_view(_ArgRange&& __range) noexcept(
+			::std::is_nothrow_constructible_v<iterator, _ArgRange>)
+		: _M_it(::std::forward<_ArgRange>(__range)) {
+		}
+
+		//////
+		/// @brief Constructs a chunked_decode_view from the underlying range.
+		///
+		/// @param[in] __range The input range to wrap and iterate over.
+		/// @param[in] __encoding The encoding object to call `.decode` or equivalent functionality on.
+		constexpr chunked_decode_view(range_type __range, encoding_type __encoding) noexcept(
+			::std::is_nothrow_constructible_v<iterator, range_type, encoding_type>)
+		: _M_it(::std::move(__range), ::std::move(__encoding)) {
+		}
+
+		//////
+		/// @brief Constructs a chunked_decode_view from the underlying range.
+		///
+		/// @param[in] __range The input range to wrap and iterate over.
+		/// @param[in] __encoding The encoding object to call `.decode` or equivalent functionality on.
+		/// @param[in] __error_handler The error handler to store in this view.
+		constexpr chunked_decode_view(range_type __range, encoding_type __encoding,
+			error_handler_type __error_handler) noexcept(::std::is_nothrow_constructible_v<iterator, range_type,
+			encoding_type, error_handler_type>)
+		: _M_it(::std::move(__range), ::std::move(__encoding), ::std::move(__error_handler)) {
+		}
+
+		//////
+		/// @brief Constructs a chunked_decode_view from the underlying range.
+		///
+		/// @param[in] __range The input range to wrap and iterate over.
+		/// @param[in] __encoding The encoding object to call `.decode` or equivalent functionality on.
+		/// @param[in] __error_handler The error handler to store in this view.
+		/// @param[in] __state The state to user for the decode operation.
+		constexpr chunked_decode_view(range_type __range, encoding_type __encoding,
+			error_handler_type __error_handler, state_type __state) noexcept(::std::is_nothrow_constructible_v<
+			iterator, range_type, encoding_type, error_handler_type, state_type>)
+		: _M_it(::std::move(__range), ::std::move(__encoding), ::std::move(__error_handler), ::std::move(__state)) {
+		}
+
+		//////
+		/// @brief Constructs a chunked_decode_view from one of its iterators, reconstituting the range.
+		///
+		/// @param[in] __it A previously-made chunked_decode_view iterator.
+		constexpr chunked_decode_view(iterator __it) noexcept(::std::is_nothrow_move_constructible_v<iterator>)
+		: _M_it(::std::move(__it)) {
+		}
+
+		//////
+		/// @brief Default constructor. Defaulted.
+		constexpr chunked_decode_view() = default;
+
+		//////
+		/// @brief Copy constructor. Defaulted.
+		constexpr chunked_decode_view(const chunked_decode_view&) = default;
+
+		//////
+		/// @brief Move constructor. Defaulted.
+		constexpr chunked_decode_view(chunked_decode_view&&) = default;
+
+		//////
+		/// @brief Copy assignment operator. Defaulted.
+		constexpr chunked_decode_view& operator=(const chunked_decode_view&) = default;
+		//////
+		/// @brief Move assignment operator. Defaulted.
+		constexpr chunked_decode_view& operator=(chunked_decode_view&&) = default;
+
+		//////
+		/// @brief The beginning of the range.
+		constexpr iterator begin() & noexcept {
+			if constexpr (::std::is_copy_constructible_v<iterator>) {
+				return this->_M_it;
+			}
+			else {
+				return ::std::move(this->_M_it);
+			}
+		}
+
+		//////
+		/// @brief The beginning of the range.
+		constexpr iterator begin() const& noexcept {
+			return this->_M_it;
+		}
+
+		//////
+		/// @brief The beginning of the range.
+		constexpr iterator begin() && noexcept {
+			return ::std::move(this->_M_it);
+		}
+
+		//////
+		/// @brief The end of the range. Uses a sentinel type and not a special iterator.
+		constexpr sentinel end() const noexcept {
+			return sentinel();
+		}
+
+	private:
+		iterator _M_it;
+	};
+
+	//////
+	/// @brief The reconstruct extension point for rebuilding a chunked decode view from its iterator and sentinel
+	/// type.
+	template <typename _Encoding, typename _Range, typename _ErrorHandler, typename _State, ::std::size_t _ChunkSize>
+	constexpr chunked_decode_view<_Encoding, _Range, _ErrorHandler, _State, _ChunkSize> reconstruct(
+		::std::in_place_type_t<chunked_decode_view<_Encoding, _Range, _ErrorHandler, _State, _ChunkSize>>,
+		typename chunked_decode_view<_Encoding, _Range, _ErrorHandler, _State, _ChunkSize>::iterator __it,
+		typename chunked_decode_view<_Encoding, _Range, _ErrorHandler, _State, _ChunkSize>::sentinel) noexcept(
+		::std::is_nothrow_constructible_v<chunked_decode_view<_Encoding, _Range, _ErrorHandler, _State, _ChunkSize>,
+		     typename chunked_decode_view<_Encoding, _Range, _ErrorHandler, _State, _ChunkSize>::iterator&&>) {
+		return chunked_decode_view<_Encoding, _Range, _ErrorHandler, _State, _ChunkSize>(::std::move(__it));
+	}
+
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#if ZTD_IS_ON(ZTD_STD_LIBRARY_BORROWED_RANGE)
+
+namespace std { namespace ranges {
+
+	template <typename _Encoding, typename _Range, typename _ErrorHandler, typename _State, ::std::size_t _ChunkSize>
+	inline constexpr bool enable_borrowed_range<
+		::ztd::text::chunked_decode_view<_Encoding, _Range, _ErrorHandler, _State, _ChunkSize>>
+		= ::std::ranges::enable_borrowed_range<_Range>;
+
+}} // namespace std::ranges
+
+#else
+
+namespace ztd { namespace ranges {
+
+	template <typename _Encoding, typename _Range, typename _ErrorHandler, typename _State, ::std::size_t _ChunkSize>
+	inline constexpr bool enable_borrowed_range<
+		::ztd::text::chunked_decode_view<_Encoding, _Range, _ErrorHandler, _State, _ChunkSize>>
+		= ::ztd::ranges::enable_borrowed_range<_Range>;
+
+}} // namespace ztd::ranges
+
+#endif
+
+#include <ztd/epilogue.hpp>
+
+#endif
@@ -0,0 +1,567 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#pragma once
+
+#ifndef ZTD_TEXT_CHUNKED_TRANSCODE_ITERATOR_HPP
+#define ZTD_TEXT_CHUNKED_TRANSCODE_ITERATOR_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/error_handler.hpp>
+#include <ztd/text/state.hpp>
+#include <ztd/text/code_point.hpp>
+#include <ztd/text/code_unit.hpp>
+#include <ztd/text/max_units.hpp>
+#include <ztd/text/encode.hpp>
+#include <ztd/text/error_handler_always_returns_ok.hpp>
+#include <ztd/text/detail/encoding_iterator.hpp>
+#include <ztd/text/detail/encoding_iterator_storage.hpp>
+#include <ztd/text/detail/chunk_fill.hpp>
+
+#include <ztd/idk/unwrap.hpp>
+#include <ztd/idk/ebco.hpp>
+#include <ztd/idk/span.hpp>
+#include <ztd/idk/type_traits.hpp>
+#include <ztd/ranges/adl.hpp>
+#include <ztd/ranges/range.hpp>
+#include <ztd/ranges/reconstruct.hpp>
+
+#include <array>
+#include <cstddef>
+
+#include <ztd/prologue.hpp>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	//////
+	/// @brief The sentinel to use as the `end` value for a ztd::text::chunked_transcode_iterator.
+	using chunked_transcode_sentinel_t = __txt_detail::__encoding_sentinel_t;
+
+	//////
+	/// @brief A transcoding iterator that takes an input of code units and provides an output over the code units of
+	/// the desired `_ToEncoding` after converting from the `_FromEncoding`. Up to `_ChunkSize` intermediate code
+	/// points are decoded in bulk per refill, and then encoded in bulk into a buffer held by the iterator.
+	///
+	/// @tparam _FromEncoding The encoding to read the underlying range of code units as.
+	/// @tparam _ToEncoding The encoding to write the intermediate code points out as.
+	/// @tparam _Range The range of input that will be fed into the _FromEncoding's decode operation.
+	/// @tparam _FromErrorHandler The error handler for any decode-step failures.
+	/// @tparam _ToErrorHandler The error handler for any encode-step failures.
+	/// @tparam _FromState The state type to use for the decode operations to intermediate code points.
+	/// @tparam _ToState The state type to use for the encode operations from intermediate code points.
+	/// @tparam _ChunkSize The number of intermediate code points to decode per refill. Never less than
+	/// ztd::text::max_code_points_v for the `_FromEncoding`.
+	///
+	/// @remarks Where ztd::text::transcode_iterator calls `transcode_one` on every refill, this iterator goes
+	/// through ztd::text::decode_into_raw and ztd::text::encode_into_raw once per chunk. The unit buffer is sized so
+	/// that encoding a whole chunk of code points can never run out of space. `pivot_error_code()` and
+	/// `error_code()` report the last errors of the chunk currently being served, and `range()` returns the input
+	/// not yet decoded into the intermediate buffer.
+	template <typename _FromEncoding, typename _ToEncoding, typename _Range, typename _FromErrorHandler,
+		typename _ToErrorHandler, typename _FromState, typename _ToState,
+		::std::size_t _ChunkSize = ZTD_TEXT_CHUNKED_VIEW_BUFFER_SIZE_I_(code_point_t<_ToEncoding>)>
+	class chunked_transcode_iterator
+	: private __txt_detail::__iterator_storage<_FromEncoding, _Range, _FromErrorHandler, _FromState>,
+	  private ebco<remove_cvref_t<_ToEncoding>, 4>,
+	  private ebco<remove_cvref_t<_ToErrorHandler>, 5>,
+	  private __txt_detail::__state_storage<remove_cvref_t<_ToEncoding>, remove_cvref_t<_ToState>, 6>,
+	  private __txt_detail::__cursor_cache<
+		  __txt_detail::__decode_chunk_buffer_size_v<unwrap_remove_cvref_t<_FromEncoding>, _ChunkSize>
+		       * max_code_units_v<unwrap_remove_cvref_t<_ToEncoding>>,
+		  false>,
+	  private __txt_detail::__error_cache<
+		  decode_error_handler_always_returns_ok_v<unwrap_remove_cvref_t<_FromEncoding>,
+		       unwrap_remove_cvref_t<_FromErrorHandler>> // cf
+		  && encode_error_handler_always_returns_ok_v<unwrap_remove_cvref_t<_ToEncoding>,
+		       unwrap_remove_cvref_t<_ToErrorHandler>>> {
+	private:
+		using _UFromEncoding         = unwrap_remove_cvref_t<_FromEncoding>;
+		using _UToEncoding           = unwrap_remove_cvref_t<_ToEncoding>;
+		using _UFromErrorHandler     = unwrap_remove_cvref_t<_FromErrorHandler>;
+		using _UToErrorHandler       = unwrap_remove_cvref_t<_ToErrorHandler>;
+		using _URange                = unwrap_remove_cvref_t<_Range>;
+		using _BaseIterator          = ranges::range_const_iterator_t<_URange>;
+		using _IntermediateCodePoint = code_point_t<_UToEncoding>;
+		inline static constexpr ::std::size_t _MaxPivotChunkValues
+			= __txt_detail::__decode_chunk_size_v<_UFromEncoding, _ChunkSize>;
+		inline static constexpr ::std::size_t _MaxPivotValues
+			= __txt_detail::__decode_chunk_buffer_size_v<_UFromEncoding, _ChunkSize>;
+		inline static constexpr ::std::size_t _MaxValues = _MaxPivotValues * max_code_units_v<_UToEncoding>;
+		inline static constexpr bool _IsErrorless
+			= decode_error_handler_always_returns_ok_v<_UFromEncoding, _UFromErrorHandler>
+			&& encode_error_handler_always_returns_ok_v<_UToEncoding, _UToErrorHandler>;
+		using __base_storage_t
+			= __txt_detail::__iterator_storage<_FromEncoding, _Range, _FromErrorHandler, _FromState>;
+		using __base_to_encoding_t       = ebco<remove_cvref_t<_ToEncoding>, 4>;
+		using __base_to_error_handler_t  = ebco<remove_cvref_t<_ToErrorHandler>, 5>;
+		using __base_to_state_t
+			= __txt_detail::__state_storage<remove_cvref_t<_ToEncoding>, remove_cvref_t<_ToState>, 6>;
+		using __base_cursor_cache_t      = __txt_detail::__cursor_cache<_MaxValues, false>;
+		using __base_cursor_cache_size_t = typename __base_cursor_cache_t::_SizeType;
+		using __base_error_cache_t       = __txt_detail::__error_cache<_IsErrorless>;
+
+	public:
+		//////
+		/// @brief The underlying range type.
+		using range_type = _Range;
+		//////
+		/// @brief The base iterator type.
+		using iterator_type = _BaseIterator;
+		//////
+		/// @brief The encoding type used for decoding to intermediate code point storage.
+		using from_encoding_type = _FromEncoding;
+		//////
+		/// @brief The encoding type used for encoding to the final code units storage.
+		using to_encoding_type = _ToEncoding;
+		//////
+		/// @brief The error handler when a decode operation fails.
+		using from_error_handler_type = _FromErrorHandler;
+		//////
+		/// @brief The error handler when an encode operation fails.
+		using to_error_handler_type = _ToErrorHandler;
+		//////
+		/// @brief The state type used for decode operations.
+		using from_state_type = remove_cvref_t<_FromState>;
+		//////
+		/// @brief The state type used for encode operations.
+		using to_state_type = remove_cvref_t<_ToState>;
+		//////
+		/// @brief The strength of the iterator category, as defined in relation to the base.
+		using iterator_category = ::std::conditional_t<
+			ranges::is_iterator_concept_or_better_v<::std::forward_iterator_tag, _BaseIterator>,
+			::std::forward_iterator_tag, ranges::iterator_category_t<_BaseIterator>>;
+		//////
+		/// @brief The strength of the iterator concept, as defined in relation to the base.
+		using iterator_concept = ::std::conditional_t<
+			ranges::is_iterator_concept_or_better_v<::std::forward_iterator_tag, _BaseIterator>,
+			::std::forward_iterator_tag, ranges::iterator_concept_t<_BaseIterator>>;
+		//////
+		/// @brief The object type that gets output on every dereference.
+		using value_type = code_unit_t<_ToEncoding>;
+		//////
+		/// @brief A pointer type to the value_type.
+		using pointer = value_type*;
+		//////
+		/// @brief The value returned from derefencing the iterator.
+		///
+		/// @remarks This is a proxy iterator, so the `reference` is a non-reference `value_type.`
+		using reference = value_type;
+		//////
+		/// @brief The type returned when two of these pointers are subtracted from one another.
+		///
+		/// @remarks It's not a very useful type...
+		using difference_type = ranges::iterator_difference_type_t<_BaseIterator>;
+
+		//////
+		/// @brief Default constructor. Defaulted.
+		constexpr chunked_transcode_iterator() = default;
+
+		//////
+		/// @brief Copy constructs a chunked_transcode_iterator.
+		constexpr chunked_transcode_iterator(const chunked_transcode_iterator&) = default;
+		//////
+		/// @brief Move constructs a chunked_transcode_iterator.
+		constexpr chunked_transcode_iterator(chunked_transcode_iterator&&) = default;
+
+		//////
+		/// @brief Constructs a chunked_transcode_iterator from the underlying range.
+		///
+		/// @param[in] __range The input range to wrap and iterate over.
+		template <typename _ArgRange,
+			::std::enable_if_t<!::std::is_same_v<remove_cvref_t<_ArgRange>, chunked_transcode_iterator>>* = nullptr>
+		constexpr chunked_transcode_iterator(_ArgRange&& __range)
+		: chunked_transcode_iterator(::std::forward<_ArgRange>(__range), to_encoding_type {}) {
+		}
+
+		//////
+		/// @brief Constructs a chunked_transcode_iterator from the underlying range.
+		///
+		/// @param[in] __range The input range to wrap and iterate over.
+		/// @param[in] __to_encoding The encoding object to call `encode_one` or equivalent functionality on.
+		constexpr chunked_transcode_iterator(range_type __range, to_encoding_type __to_encoding)
+		: chunked_transcode_iterator(::std::move(__range), from_encoding_type {}, ::std::move(__to_encoding)) {
+		}
+
+		//////
+		/// @brief Constructs a chunked_transcode_iterator from the underlying range.
+		///
+		/// @param[in] __range The input range to wrap and iterate over.
+		/// @param[in] __from_encoding The encoding object to call `decode_one` or equivalent functionality on.
+		/// @param[in] __to_encoding The encoding object to call `encode_one` or equivalent functionality on.
+		constexpr chunked_transcode_iterator(
+			range_type __range, from_encoding_type __from_encoding, to_encoding_type __to_encoding)
+		: chunked_transcode_iterator(::std::move(__range), ::std::move(__from_encoding), ::std::move(__to_encoding),
+			  from_error_handler_type {}, to_error_handler_type {}) {
+		}
+
+		//////
+		/// @brief Constructs a chunked_transcode_iterator from the underlying range.
+		///
+		/// @param[in] __range The input range to wrap and iterate over.
+		/// @param[in] __from_encoding The encoding object to call `decode_one` or equivalent functionality on.
+		/// @param[in] __to_encoding The encoding object to call `encode_one` or equivalent functionality on.
+		/// @param[in] __from_error_handler The error handler for decode operations to store in this view.
+		/// @param[in] __to_error_handler The error handler for encode operations to store in this view.
+		constexpr chunked_transcode_iterator(range_type __range, from_encoding_type __from_encoding,
+			to_encoding_type __to_encoding, from_error_handler_type __from_error_handler,
+			to_error_handler_type __to_error_handler)
+		: __base_storage_t(::std::move(__range), ::std::move(__from_encoding), ::std::move(__from_error_handler))
+		, __base_to_encoding_t(::std::move(__to_encoding))
+		, __base_to_error_handler_t(::std::move(__to_error_handler))
+		, __base_to_state_t(this->to_encoding())
+		, __base_cursor_cache_t()
+		, __base_error_cache_t()
+		, _M_pivot()
+		, _M_cache() {
+			this->_M_read_chunk();
+		}
+
+		//////
+		/// @brief Constructs a chunked_transcode_iterator from the underlying range.
+		///
+		/// @param[in] __range The input range to wrap and iterate over.
+		/// @param[in] __from_encoding The encoding object to call `decode_one` or equivalent functionality on.
+		/// @param[in] __to_encoding The encoding object to call `encode_one` or equivalent functionality on.
+		/// @param[in] __from_error_handler The error handler for decode operations to store in this view.
+		/// @param[in] __to_error_handler The error handler for encode operations to store in this view.
+		/// @param[in] __from_state The state to user for the decode operation.
+		/// @param[in] __to_state The state to user for the encode operation.
+		constexpr chunked_transcode_iterator(range_type __range, from_encoding_type __from_encoding,
+			to_encoding_type __to_encoding, from_error_handler_type __from_error_handler,
+			to_error_handler_type __to_error_handler, from_state_type __from_state, to_state_type __to_state)
+		: __base_storage_t(::std::move(__range), ::std::move(__from_encoding), ::std::move(__from_error_handler),
+			  ::std::move(__from_state))
+		, __base_to_encoding_t(::std::move(__to_encoding))
+		, __base_to_error_handler_t(::std::move(__to_error_handler))
+		, __base_to_state_t(this->to_encoding(), ::std::move(__to_state))
+		, __base_cursor_cache_t()
+		, __base_error_cache_t()
+		, _M_pivot()
+		, _M_cache() {
+			this->_M_read_chunk();
+		}
+
+		//////
+		/// @brief Copy assigns a chunked_transcode_iterator.
+		constexpr chunked_transcode_iterator& operator=(const chunked_transcode_iterator&) = default;
+		//////
+		/// @brief Move assigns a chunked_transcode_iterator.
+		constexpr chunked_transcode_iterator& operator=(chunked_transcode_iterator&&) = default;
+
+		// observers
+
+		//////
+		/// @brief The decoding ("from") encoding object.
+		///
+		/// @returns A const l-value reference to the encoding object used to construct this iterator.
+		constexpr const from_encoding_type& from_encoding() const {
+			return this->__base_storage_t::_M_get_encoding();
+		}
+
+		//////
+		/// @brief The decoding ("from") encoding object.
+		///
+		/// @returns An l-value reference to the encoding object used to construct this iterator.
+		constexpr from_encoding_type& from_encoding() {
+			return this->__base_storage_t::_M_get_encoding();
+		}
+
+		//////
+		/// @brief The encoding ("to") encoding object.
+		///
+		/// @returns A const l-value reference to the encoding object used to construct this iterator.
+		constexpr const to_encoding_type& to_encoding() const {
+			return this->__base_to_encoding_t::get_value();
+		}
+
+		//////
+		/// @brief The encoding ("to") encoding object.
+		///
+		/// @returns An l-value reference to the encoding object used to construct this iterator.
+		constexpr to_encoding_type& to_encoding() {
+			return this->__base_to_encoding_t::get_value();
+		}
+
+		//////
+		/// @brief The decoding ("from") state object.
+		constexpr const from_state_type& from_state() const {
+			return this->__base_storage_t::_M_get_state();
+		}
+
+		//////
+		/// @brief The decoding ("from") state object.
+		constexpr from_state_type& from_state() {
+			return this->__base_storage_t::_M_get_state();
+		}
+
+		//////
+		/// @brief The encoding ("to") state object.
+		constexpr const to_state_type& to_state() const {
+			return this->__base_to_state_t::_M_get_state();
+		}
+
+		//////
+		/// @brief The encoding ("to") state object.
+		constexpr to_state_type& to_state() {
+			return this->__base_to_state_t::_M_get_state();
+		}
+
+		//////
+		/// @brief The error handler object.
+		constexpr const from_error_handler_type& from_handler() const {
+			return this->__base_storage_t::_M_get_error_handler();
+		}
+
+		//////
+		/// @brief The error handler object.
+		constexpr from_error_handler_type& from_handler() {
+			return this->__base_storage_t::_M_get_error_handler();
+		}
+
+		//////
+		/// @brief The error handler object.
+		constexpr const to_error_handler_type& to_handler() const& noexcept {
+			return this->__base_to_error_handler_t::get_value();
+		}
+
+		//////
+		/// @brief The error handler object.
+		constexpr to_error_handler_type& to_handler() & noexcept {
+			return this->__base_to_error_handler_t::get_value();
+		}
+
+		//////
+		/// @brief The error handler object.
+		constexpr to_error_handler_type&& to_handler() && noexcept {
+			return ::std::move(this->__base_to_error_handler_t::get_value());
+		}
+
+		//////
+		/// @brief The input range that has not yet been decoded into this iterator's intermediate buffer.
+		constexpr range_type range() const noexcept(::std::is_nothrow_move_constructible_v<range_type>) {
+			return ::ztd::ranges::reconstruct(
+				::std::in_place_type<range_type>, this->__base_storage_t::_M_get_range());
+		}
+
+		//////
+		/// @brief Returns whether the last decode refill had an encoding error or not.
+		///
+		/// @returns The ztd::text::encoding_error that occurred. This can be ztd::text::encoding_error::ok for
+		/// an operation that went just fine.
+		///
+		/// @remarks If the error handler is identified as an error handler that, if given a suitably sized
+		/// buffer, will never return an error. This is the case with specific encoding operations with
+		/// ztd::text::replacement_handler_t, or ztd::text::throw_handler_t.
+		constexpr encoding_error pivot_error_code() const noexcept {
+			if constexpr (_IsErrorless) {
+				return encoding_error::ok;
+			}
+			else {
+				return this->__base_error_cache_t::_M_from_error();
+			}
+		}
+
+		//////
+		/// @brief Returns whether the last encode refill had an encoding error or not.
+		///
+		/// @returns The ztd::text::encoding_error that occurred. This can be ztd::text::encoding_error::ok for
+		/// an operation that went just fine.
+		///
+		/// @remarks If the error handler is identified as an error handler that, if given a suitably sized
+		/// buffer, will never return an error. This is the case with specific encoding operations with
+		/// ztd::text::replacement_handler_t, or ztd::text::throw_handler_t.
+		constexpr encoding_error error_code() const noexcept {
+			if constexpr (_IsErrorless) {
+				return encoding_error::ok;
+			}
+			else {
+				return this->__base_error_cache_t::_M_to_error();
+			}
+		}
+
+		// observers and modifiers: iteration
+
+		//////
+		/// @brief Copy then increment the iterator.
+		///
+		/// @returns A copy of iterator, before incrementing.
+		constexpr chunked_transcode_iterator operator++(int) {
+			chunked_transcode_iterator __copy = *this;
+			++(*this);
+			return __copy;
+		}
+
+		//////
+		/// @brief Increment the iterator.
+		///
+		/// @returns A reference to *this, after incrementing the iterator.
+		constexpr chunked_transcode_iterator& operator++() {
+			++this->__base_cursor_cache_t::_M_position;
+			if (this->__base_cursor_cache_t::_M_position >= this->__base_cursor_cache_t::_M_size) {
+				this->_M_read_chunk();
+			}
+			return *this;
+		}
+
+		//////
+		/// @brief Dereference the iterator.
+		///
+		/// @returns A value_type (NOT a reference) of the iterator.
+		///
+		/// @remarks This is a proxy iterator, and therefore only returns a value_type object and not a reference
+		/// object. Encoding iterators are only readable, not writable.
+		constexpr value_type operator*() const {
+			return this->_M_cache[this->__base_cursor_cache_t::_M_position];
+		}
+
+		// observers: comparison
+
+		//////
+		/// @brief Compares whether or not this iterator has truly reached the end.
+		friend constexpr bool operator==(
+			const chunked_transcode_iterator& __it, const chunked_transcode_sentinel_t&) {
+			return __it._M_is_drained()
+				&& __it.__base_cursor_cache_t::_M_position == __it.__base_cursor_cache_t::_M_size;
+		}
+
+		//////
+		/// @brief Compares whether or not this iterator has truly reached the end.
+		friend constexpr bool operator==(
+			const chunked_transcode_sentinel_t& __sen, const chunked_transcode_iterator& __it) {
+			return __it == __sen;
+		}
+
+		//////
+		/// @brief Compares whether or not this iterator has truly reached the end.
+		template <typename _Concept = iterator_concept,
+			::std::enable_if_t<
+			     ::ztd::ranges::is_concept_or_better_v<::std::forward_iterator_tag, _Concept>>* = nullptr>
+		friend constexpr bool operator==(
+			const chunked_transcode_iterator& __it, const chunked_transcode_iterator& __sen) {
+			return ::ztd::ranges::begin(__it.__base_storage_t::_M_get_range())
+				== ::ztd::ranges::begin(__sen.__base_storage_t::_M_get_range())
+				&& __it._M_pivot_position == __sen._M_pivot_position
+				&& __it.__base_cursor_cache_t::_M_position == __sen.__base_cursor_cache_t::_M_position;
+		}
+
+		//////
+		/// @brief Compares whether or not this iterator has truly reached the end.
+		friend constexpr bool operator!=(
+			const chunked_transcode_iterator& __it, const chunked_transcode_sentinel_t& __sen) {
+			return !(__it == __sen);
+		}
+
+		//////
+		/// @brief Compares whether or not this iterator has truly reached the end.
+		friend constexpr bool operator!=(
+			const chunked_transcode_sentinel_t& __sen, const chunked_transcode_iterator& __it) {
+			return !(__it == __sen);
+		}
+
+		//////
+		/// @brief Compares whether or not this iterator has truly reached the end.
+		template <typename _Concept = iterator_concept,
+			::std::enable_if_t<
+			     ::ztd::ranges::is_concept_or_better_v<::std::forward_iterator_tag, _Concept>>* = nullptr>
+		friend constexpr bool operator!=(
+			const chunked_transcode_iterator& __it, const chunked_transcode_iterator& __sen) {
+			return !(__it == __sen);
+		}
+
+	private:
+		constexpr bool _M_is_drained() const noexcept {
+			return this->_M_pivot_position == this->_M_pivot_size
+				&& __txt_detail::__chunk_input_is_empty(this->__base_storage_t::_M_get_range());
+		}
+
+		constexpr void _M_read_chunk() {
+			using _PivotInput     = ::ztd::span<const _IntermediateCodePoint>;
+			using _Output         = ::ztd::span<value_type>;
+			value_type* __first   = this->_M_cache.data();
+			value_type* __current = __first;
+			encoding_error __from_error = encoding_error::ok;
+			encoding_error __to_error   = encoding_error::ok;
+			for (;;) {
+				if (this->_M_pivot_position == this->_M_pivot_size) {
+					if (__txt_detail::__chunk_input_is_empty(this->__base_storage_t::_M_get_range())) {
+						break;
+					}
+					_IntermediateCodePoint* __pivot_first = this->_M_pivot.data();
+					auto __fill_result = __txt_detail::__decode_fill_chunk(this->__base_storage_t::_M_get_range(),
+						this->from_encoding(), this->__base_storage_t::_M_get_error_handler(), this->from_state(),
+						__pivot_first, __pivot_first + _MaxPivotChunkValues, __pivot_first + _MaxPivotValues);
+					this->_M_pivot_position = 0;
+					this->_M_pivot_size     = static_cast<::std::size_t>(__fill_result._M_last - __pivot_first);
+					__from_error            = __fill_result._M_error_code;
+					if (this->_M_pivot_size == 0) {
+						if (__from_error != encoding_error::ok) {
+							break;
+						}
+						continue;
+					}
+				}
+				// every code point encodes to at most max_code_units_v code units, so a full chunk always fits
+				_PivotInput __pivot_input(this->_M_pivot.data() + this->_M_pivot_position,
+					this->_M_pivot.data() + this->_M_pivot_size);
+				auto __result = ::ztd::text::encode_into_raw(__pivot_input, this->to_encoding(),
+					_Output(__current, __first + _MaxValues), this->to_handler(), this->to_state());
+				this->_M_pivot_position
+					= static_cast<::std::size_t>(::ztd::to_address(::ztd::ranges::begin(__result.input))
+					     - this->_M_pivot.data());
+				__current  = ::ztd::to_address(::ztd::ranges::begin(__result.output));
+				__to_error = __result.error_code;
+				if (__current != __first || __to_error != encoding_error::ok) {
+					break;
+				}
+			}
+			if constexpr (!_IsErrorless) {
+				this->__base_error_cache_t::_M_set_errors(__from_error, __to_error);
+			}
+			__base_cursor_cache_size_t __data_size = static_cast<__base_cursor_cache_size_t>(__current - __first);
+			ZTD_TEXT_ASSERT_MESSAGE_I_("size of produced value can never be bigger than the cache",
+				static_cast<::std::size_t>(__data_size) <= this->_M_cache.size());
+			this->__base_cursor_cache_t::_M_position = static_cast<__base_cursor_cache_size_t>(0);
+			this->__base_cursor_cache_t::_M_size     = __data_size;
+		}
+
+		::std::size_t _M_pivot_position = 0;
+		::std::size_t _M_pivot_size     = 0;
+		::std::array<_IntermediateCodePoint, _MaxPivotValues> _M_pivot;
+		::std::array<value_type, _MaxValues> _M_cache;
+	};
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#include <ztd/epilogue.hpp>
+
+#endif
@@ -0,0 +1,235 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#pragma once
+
+#ifndef ZTD_TEXT_CHUNKED_TRANSCODE_VIEW_HPP
+#define ZTD_TEXT_CHUNKED_TRANSCODE_VIEW_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/chunked_transcode_iterator.hpp>
+#include <ztd/text/error_handler.hpp>
+#include <ztd/text/encoding.hpp>
+#include <ztd/text/code_unit.hpp>
+#include <ztd/text/code_point.hpp>
+#include <ztd/text/utf8.hpp>
+#include <ztd/text/execution.hpp>
+#include <ztd/text/detail/default_char_view.hpp>
+
+#include <string_view>
+#include <cstddef>
+
+#include <ztd/prologue.hpp>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	//////
+	/// @brief A view over a range of code units in the `_FromEncoding`, presenting them as code units of the
+	/// `_ToEncoding`. Up to `_ChunkSize` intermediate code points are converted at a time.
+	///
+	/// @tparam _FromEncoding The encoding to read the underlying range of code units as.
+	/// @tparam _ToEncoding The encoding to write the intermediate code points out as.
+	/// @tparam _Range The range of input that will be fed into the _FromEncoding's decode operation.
+	/// @tparam _FromErrorHandler The error handler for any decode-step failures.
+	/// @tparam _ToErrorHandler The error handler for any encode-step failures.
+	/// @tparam _FromState The state type to use for the decode operations to intermediate code points.
+	/// @tparam _ToState The state type to use for the encode operations from intermediate code points.
+	/// @tparam _ChunkSize The number of intermediate code points to convert per refill of the iterator's buffers.
+	///
+	/// @remarks This is a drop-in replacement for ztd::text::transcode_view when the view is walked from start to
+	/// finish and speed matters more than the size of the iterator. See ztd::text::chunked_transcode_iterator for the
+	/// differences in what the error codes and `range()` report.
+	template <typename _FromEncoding, typename _ToEncoding = utf8_t,
+		typename _Range            = __txt_detail::__default_char_view_t<code_unit_t<_FromEncoding>>,
+		typename _FromErrorHandler = default_handler_t, typename _ToErrorHandler = default_handler_t,
+		typename _FromState = decode_state_t<_FromEncoding>, typename _ToState = encode_state_t<_ToEncoding>,
+		::std::size_t _ChunkSize = ZTD_TEXT_CHUNKED_VIEW_BUFFER_SIZE_I_(code_point_t<_ToEncoding>)>
+	class chunked_transcode_view : public ::ztd::ranges::view_base {
+	public:
+		//////
+		/// @brief The iterator type for this view.
+		using iterator = chunked_transcode_iterator<_FromEncoding, _ToEncoding, _Range, _FromErrorHandler,
+			_ToErrorHandler, _FromState, _ToState, _ChunkSize>;
+		//////
+		/// @brief The sentinel type for this view.
+		using sentinel = chunked_transcode_sentinel_t;
+		//////
+		/// @brief The underlying range type.
+		using range_type = _Range;
+		//////
+		/// @brief The encoding type used for decoding to intermediate code point storage.
+		using from_encoding_type = _FromEncoding;
+		//////
+		/// @brief The encoding type used for encoding to the final code units storage.
+		using to_encoding_type = _ToEncoding;
+		//////
+		/// @brief The error handler when a decode operation fails.
+		using from_error_handler_type = _FromErrorHandler;
+		//////
+		/// @brief The error handler when an encode operation fails.
+		using to_error_handler_type = _ToErrorHandler;
+		//////
+		/// @brief The state type used for decode operations.
+		using from_state_type = _FromState;
+		//////
+		/// @brief The state type used for encode operations.
+		using to_state_type = _ToState;
+
+		//////
+		/// @brief Constructs a chunked_transcode_view from the underlying range.
+		///
+		/// @param[in] __range The input range to wrap and iterate over.
+		constexpr chunked_transcode_view(range_type __range)
+		: chunked_transcode_view(::std::move(__range), to_encoding_type {}) {
+		}
+
+		//////
+		/// @brief Constructs a chunked_transcode_view from the underlying range.
+		///
+		/// @param[in] __range The input range to wrap and iterate over.
+		/// @param[in] __to_encoding The encoding object to call `encode_one` or equivalent functionality on.
+		constexpr chunked_transcode_view(range_type __range, to_encoding_type __to_encoding)
+		: chunked_transcode_view(::std::move(__range), from_encoding_type {}, ::std::move(__to_encoding)) {
+		}
+
+		//////
+		/// @brief Constructs a chunked_transcode_view from the underlying range.
+		///
+		/// @param[in] __range The input range to wrap and iterate over.
+		/// @param[in] __from_encoding The encoding object to call `decode_one` or equivalent functionality on.
+		/// @param[in] __to_encoding The encoding object to call `encode_one` or equivalent functionality on.
+		constexpr chunked_transcode_view(
+			range_type __range, from_encoding_type __from_encoding, to_encoding_type __to_encoding)
+		: chunked_transcode_view(::std::move(__range), ::std::move(__from_encoding), ::std::move(__to_encoding),
+			  from_error_handler_type {}, to_error_handler_type {}) {
+		}
+
+		//////
+		/// @brief Constructs a chunked_transcode_view from the underlying range.
+		///
+		/// @param[in] __range The input range to wrap and iterate over.
+		/// @param[in] __from_encoding The encoding object to call `decode_one` or equivalent functionality on.
+		/// @param[in] __to_encoding The encoding object to call `encode_one` or equivalent functionality on.
+		/// @param[in] __from_error_handler The error handler for decode operations to store in this view.
+		/// @param[in] __to_error_handler The error handler for encode operations to store in this view.
+		constexpr chunked_transcode_view(range_type __range, from_encoding_type __from_encoding,
+			to_encoding_type __to_encoding, from_error_handler_type __from_error_handler,
+			to_error_handler_type __to_error_handler)
+		: _M_it(::std::move(__range), ::std::move(__from_encoding), ::std::move(__to_encoding),
+			  ::std::move(__from_error_handler), ::std::move(__to_error_handler)) {
+		}
+
+		//////
+		/// @brief Constructs a chunked_transcode_view from the underlying range.
+		///
+		/// @param[in] __range The input range to wrap and iterate over.
+		/// @param[in] __from_encoding The encoding object to call `decode_one` or equivalent functionality on.
+		/// @param[in] __to_encoding The encoding object to call `encode_one` or equivalent functionality on.
+		/// @param[in] __from_error_handler The error handler for decode operations to store in this view.
+		/// @param[in] __to_error_handler The error handler for encode operations to store in this view.
+		/// @param[in] __from_state The state to user for the decode operation.
+		/// @param[in] __to_state The state to user for the decode operation.
+		constexpr chunked_transcode_view(range_type __range, from_encoding_type __from_encoding,
+			to_encoding_type __to_encoding, from_error_handler_type __from_error_handler,
+			to_error_handler_type __to_error_handler, from_state_type __from_state,
+			to_state_type __to_state)
+		: _M_it(::std::move(__range), ::std::move(__from_encoding), ::std::move(__to_encoding),
+			  ::std::move(__from_error_handler), ::std::move(__to_error_handler), ::std::move(__from_state),
+			  ::std::move(__to_state)) {
+		}
+
+		//////
+		/// @brief The beginning of the range.
+		constexpr iterator begin() & noexcept {
+			if constexpr (::std::is_copy_constructible_v<iterator>) {
+				return this->_M_it;
+			}
+			else {
+				return ::std::move(this->_M_it);
+			}
+		}
+
+		//////
+		/// @brief The beginning of the range.
+		constexpr iterator begin() const& noexcept {
+			return this->_M_it;
+		}
+
+		//////
+		/// @brief The beginning of the range.
+		constexpr iterator begin() && noexcept {
+			return ::std::move(this->_M_it);
+		}
+
+		//////
+		/// @brief The end of the range. Uses a sentinel type and not a special iterator.
+		constexpr sentinel end() const noexcept {
+			return sentinel();
+		}
+
+	private:
+		iterator _M_it;
+	};
+
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#if ZTD_IS_ON(ZTD_STD_LIBRARY_BORROWED_RANGE)
+
+namespace std { namespace ranges {
+
+	template <typename _FromEncoding, typename _ToEncoding, typename _Range, typename _FromErrorHandler,
+		typename _ToErrorHandler, typename _FromState, typename _ToState, ::std::size_t _ChunkSize>
+	inline constexpr bool enable_borrowed_range<::ztd::text::chunked_transcode_view<_FromEncoding, _ToEncoding,
+		_Range, _FromErrorHandler, _ToErrorHandler, _FromState, _ToState, _ChunkSize>>
+		= ::std::ranges::enable_borrowed_range<_Range>;
+
+}} // namespace std::ranges
+
+#else
+
+namespace ztd { namespace ranges {
+
+	template <typename _FromEncoding, typename _ToEncoding, typename _Range, typename _FromErrorHandler,
+		typename _ToErrorHandler, typename _FromState, typename _ToState, ::std::size_t _ChunkSize>
+	inline constexpr bool enable_borrowed_range<::ztd::text::chunked_transcode_view<_FromEncoding, _ToEncoding,
+		_Range, _FromErrorHandler, _ToErrorHandler, _FromState, _ToState, _ChunkSize>>
+		= ::ztd::ranges::enable_borrowed_range<_Range>;
+
+}} // namespace ztd::ranges
+
+#endif
+
+#include <ztd/epilogue.hpp>
+
+#endif
@@ -0,0 +1,361 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#pragma once
+
+#ifndef ZTD_TEXT_CODE_POINT_INDEX_HPP
+#define ZTD_TEXT_CODE_POINT_INDEX_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/forward.hpp>
+#include <ztd/text/code_point.hpp>
+#include <ztd/text/code_unit.hpp>
+#include <ztd/text/state.hpp>
+#include <ztd/text/decode_one.hpp>
+#include <ztd/text/default_handler.hpp>
+
+#include <ztd/idk/span.hpp>
+#include <ztd/ranges/adl.hpp>
+
+#include <algorithm>
+#include <vector>
+#include <cstddef>
+
+#include <ztd/prologue.hpp>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	namespace __txt_detail {
+		//////
+		/// @brief A position in encoded storage that falls on a decode boundary: the index of a code unit, and the
+		/// number of code points decoded from everything before it.
+		struct __code_point_checkpoint {
+			::std::size_t __code_unit_index;
+			::std::size_t __code_point_index;
+		};
+
+		//////
+		/// @brief Decodes the code units of `__storage` from the position `__from` up to `__last_code_unit`, one
+		/// decode step at a time, stopping early at the first step boundary for which `__stop` returns `true`.
+		///
+		/// @returns The boundary the scan stopped at.
+		///
+		/// @remarks `__stop` sees every boundary the scan passes, including `__from` itself, so it doubles as the
+		/// place where checkpoints get recorded. Malformed input is consumed according to
+		/// ztd::text::default_handler_t, so the scan always makes progress.
+		template <typename _Encoding, typename _Storage, typename _Stop>
+		constexpr __code_point_checkpoint __scan_code_points(const _Encoding& __encoding, const _Storage& __storage,
+			__code_point_checkpoint __from, ::std::size_t __last_code_unit, _Stop&& __stop) {
+			using _UEncoding = remove_cvref_t<_Encoding>;
+			using _CodeUnit  = code_unit_t<_UEncoding>;
+			using _CodePoint = code_point_t<_UEncoding>;
+
+			const _CodeUnit* __data = __storage.data();
+			_CodePoint __output_storage[max_code_points_v<_UEncoding>] {};
+			default_handler_t __handler {};
+			decode_state_t<_UEncoding> __state = ::ztd::text::make_decode_state(__encoding);
+			__code_point_checkpoint __position = __from;
+			while (__position.__code_unit_index < __last_code_unit) {
+				if (__stop(__position)) {
+					return __position;
+				}
+				::ztd::span<const _CodeUnit> __input(
+					__data + __position.__code_unit_index, __last_code_unit - __position.__code_unit_index);
+				::ztd::span<_CodePoint> __output(__output_storage);
+				auto __result
+					= ::ztd::text::decode_one_into_raw(__input, __encoding, __output, __handler, __state);
+				::std::size_t __read = static_cast<::std::size_t>(__result.input.data() - __input.data());
+				__position.__code_unit_index += __read == 0 ? 1 : __read;
+				__position.__code_point_index
+					+= static_cast<::std::size_t>(__result.output.data() - __output.data());
+			}
+			__stop(__position);
+			return __position;
+		}
+
+		template <typename _Encoding, typename _Storage>
+		constexpr ::std::size_t __scan_code_point_count(const _Encoding& __encoding, const _Storage& __storage) {
+			return __scan_code_points(__encoding, __storage, __code_point_checkpoint { 0, 0 },
+				static_cast<::std::size_t>(::ztd::ranges::size(__storage)),
+				[](const __code_point_checkpoint&) noexcept { return false; })
+				.__code_point_index;
+		}
+	} // namespace __txt_detail
+
+	//////
+	/// @brief The default index policy for ztd::text::basic_text: nothing is cached, and every code point count or
+	/// position lookup decodes the text from the start.
+	class no_code_point_index {
+	private:
+		template <typename, typename, typename, typename>
+		friend class basic_text;
+
+		template <typename _Encoding, typename _Storage>
+		constexpr void _M_rebuild(const _Encoding&, const _Storage&) noexcept {
+		}
+
+		template <typename _Encoding, typename _Storage>
+		constexpr void _M_update(
+			const _Encoding&, const _Storage&, ::std::size_t, ::std::size_t, ::std::size_t) noexcept {
+		}
+
+		constexpr void _M_invalidate() noexcept {
+		}
+
+		constexpr void _M_clear() noexcept {
+		}
+
+		template <typename _Encoding, typename _Storage>
+		constexpr ::std::size_t _M_size(const _Encoding& __encoding, const _Storage& __storage) const {
+			return __txt_detail::__scan_code_point_count(__encoding, __storage);
+		}
+
+		template <typename _Encoding, typename _Storage>
+		constexpr ::std::size_t _M_code_unit_index(
+			const _Encoding& __encoding, const _Storage& __storage, ::std::size_t __code_point_index) const {
+			using __checkpoint = __txt_detail::__code_point_checkpoint;
+			return __txt_detail::__scan_code_points(__encoding, __storage, __checkpoint { 0, 0 },
+				static_cast<::std::size_t>(::ztd::ranges::size(__storage)),
+				[__code_point_index](const __checkpoint& __position) noexcept {
+					return __position.__code_point_index >= __code_point_index;
+				})
+				.__code_unit_index;
+		}
+
+		template <typename _Encoding, typename _Storage>
+		constexpr ::std::size_t _M_code_point_index(
+			const _Encoding& __encoding, const _Storage& __storage, ::std::size_t __code_unit_index) const {
+			using __checkpoint = __txt_detail::__code_point_checkpoint;
+			return __txt_detail::__scan_code_points(__encoding, __storage, __checkpoint { 0, 0 }, __code_unit_index,
+				[](const __checkpoint&) noexcept { return false; })
+				.__code_point_index;
+		}
+	};
+
+	//////
+	/// @brief An index policy for ztd::text::basic_text that caches the number of code points in the text, and keeps
+	/// a sparse list of checkpoints mapping code unit positions to code point positions.
+	///
+	/// @tparam _CheckpointStride The number of code units between checkpoints.
+	///
+	/// @remarks With this policy, `size()` is O(1), and looking up the code unit index of a code point (or the
+	/// reverse) is a binary search followed by decoding at most about `_CheckpointStride` code units. Every
+	/// modifier of ztd::text::basic_text keeps the index current, re-decoding only the checkpoint interval around
+	/// the change.
+	/// Getting mutable access to the underlying storage (through `base()` or `range()`) marks the index as stale:
+	/// the next lookup, modifier call or `reindex()` rebuilds it, so only that one call decodes the whole text. As
+	/// that rebuild can happen inside a `const` lookup, concurrent lookups on a text whose storage was just handed
+	/// out mutably must be synchronized. Checkpoints are
+	/// only kept for encodings whose decode state is empty and independent of the encoding object, since decoding
+	/// cannot otherwise be restarted in the middle of the text; for other encodings, only the count is cached and
+	/// every modifier re-counts the whole text. The underlying storage must be contiguous.
+	template <::std::size_t _CheckpointStride = 4096>
+	class cached_code_point_index {
+	private:
+		static_assert(_CheckpointStride > 0, "the checkpoint stride must not be zero");
+
+		using __checkpoint = __txt_detail::__code_point_checkpoint;
+
+		template <typename, typename, typename, typename>
+		friend class basic_text;
+
+		template <typename _Encoding>
+		static constexpr bool _S_uses_checkpoints() noexcept {
+			using _UEncoding = remove_cvref_t<_Encoding>;
+			return is_decode_state_independent_v<_UEncoding> // cf
+				&& ::std::is_empty_v<decode_state_t<_UEncoding>>;
+		}
+
+		static constexpr auto _S_compare_code_units() noexcept {
+			return [](const __checkpoint& __left, const __checkpoint& __right) noexcept {
+				return __left.__code_unit_index < __right.__code_unit_index;
+			};
+		}
+
+		static constexpr auto _S_compare_code_points() noexcept {
+			return [](const __checkpoint& __left, const __checkpoint& __right) noexcept {
+				return __left.__code_point_index < __right.__code_point_index;
+			};
+		}
+
+		// scans [__from, __last_code_unit), appending a checkpoint every _CheckpointStride code units
+		template <typename _Encoding, typename _Storage>
+		static constexpr __checkpoint _S_scan_into(const _Encoding& __encoding, const _Storage& __storage,
+			__checkpoint __from, ::std::size_t __last_code_unit, ::std::vector<__checkpoint>& __checkpoints) {
+			__checkpoint __last_checkpoint = __from;
+			return __txt_detail::__scan_code_points(__encoding, __storage, __from, __last_code_unit,
+				[&__last_checkpoint, &__checkpoints, __last_code_unit](const __checkpoint& __position) {
+					if (__position.__code_unit_index - __last_checkpoint.__code_unit_index >= _CheckpointStride
+						&& __position.__code_unit_index != __last_code_unit) {
+						__checkpoints.push_back(__position);
+						__last_checkpoint = __position;
+					}
+					return false;
+				});
+		}
+
+		// the last checkpoint at or before __position according to __compare, or the start of the text
+		template <typename _Compare>
+		constexpr __checkpoint _M_checkpoint_before(__checkpoint __position, _Compare __compare) const noexcept {
+			auto __it = ::std::upper_bound(
+				this->_M_checkpoints.cbegin(), this->_M_checkpoints.cend(), __position, __compare);
+			return __it == this->_M_checkpoints.cbegin() ? __checkpoint { 0, 0 } : *::std::prev(__it);
+		}
+
+		// const, so that lookups on a stale index can rebuild it rather than decoding the whole text every time
+		template <typename _Encoding, typename _Storage>
+		constexpr void _M_rebuild(const _Encoding& __encoding, const _Storage& __storage) const {
+			const ::std::size_t __code_unit_count = static_cast<::std::size_t>(::ztd::ranges::size(__storage));
+			this->_M_checkpoints.clear();
+			if constexpr (_S_uses_checkpoints<_Encoding>()) {
+				const __checkpoint __end = _S_scan_into(
+					__encoding, __storage, __checkpoint { 0, 0 }, __code_unit_count, this->_M_checkpoints);
+				this->_M_code_point_count = __end.__code_point_index;
+			}
+			else {
+				this->_M_code_point_count = __txt_detail::__scan_code_point_count(__encoding, __storage);
+			}
+			this->_M_stale = false;
+		}
+
+		// __storage has already had the __erased code units at __code_unit_index replaced by __written new ones
+		template <typename _Encoding, typename _Storage>
+		constexpr void _M_update(const _Encoding& __encoding, const _Storage& __storage,
+			::std::size_t __code_unit_index, ::std::size_t __erased, ::std::size_t __written) {
+			if constexpr (!_S_uses_checkpoints<_Encoding>()) {
+				this->_M_rebuild(__encoding, __storage);
+			}
+			else {
+				if (this->_M_stale) {
+					this->_M_rebuild(__encoding, __storage);
+					return;
+				}
+				// checkpoints in [__first_moved, end) come after the change and only need shifting; those in
+				// [__first_dropped, __first_moved) fell inside it, and the gap they leave is re-decoded
+				auto __first_dropped = ::std::upper_bound(this->_M_checkpoints.begin(), this->_M_checkpoints.end(),
+					__checkpoint { __code_unit_index, 0 }, _S_compare_code_units());
+				auto __first_moved   = ::std::lower_bound(__first_dropped, this->_M_checkpoints.end(),
+					  __checkpoint { __code_unit_index + __erased, 0 }, _S_compare_code_units());
+				const __checkpoint __rescan_from = __first_dropped == this->_M_checkpoints.begin()
+					? __checkpoint { 0, 0 }
+					: *::std::prev(__first_dropped);
+				if (__first_moved != this->_M_checkpoints.end()
+					&& __first_moved->__code_unit_index - __erased + __written
+					     == __rescan_from.__code_unit_index) {
+					// a pure erasure that ends on a checkpoint and starts on another: keep only one of them
+					++__first_moved;
+				}
+				const bool __has_next = __first_moved != this->_M_checkpoints.end();
+				const ::std::size_t __old_rescan_code_points
+					= (__has_next ? __first_moved->__code_point_index : this->_M_code_point_count)
+					- __rescan_from.__code_point_index;
+				const ::std::size_t __rescan_to = __has_next
+					? __first_moved->__code_unit_index - __erased + __written
+					: static_cast<::std::size_t>(::ztd::ranges::size(__storage));
+
+				::std::vector<__checkpoint> __rescanned;
+				const __checkpoint __rescan_end
+					= _S_scan_into(__encoding, __storage, __rescan_from, __rescan_to, __rescanned);
+				const ::std::size_t __new_rescan_code_points
+					= __rescan_end.__code_point_index - __rescan_from.__code_point_index;
+
+				for (auto __it = __first_moved; __it != this->_M_checkpoints.end(); ++__it) {
+					__it->__code_unit_index = __it->__code_unit_index - __erased + __written;
+					__it->__code_point_index
+						= __it->__code_point_index - __old_rescan_code_points + __new_rescan_code_points;
+				}
+				this->_M_code_point_count
+					= this->_M_code_point_count - __old_rescan_code_points + __new_rescan_code_points;
+				auto __insert_at = this->_M_checkpoints.erase(__first_dropped, __first_moved);
+				this->_M_checkpoints.insert(__insert_at, __rescanned.cbegin(), __rescanned.cend());
+			}
+		}
+
+		constexpr void _M_invalidate() noexcept {
+			this->_M_stale = true;
+		}
+
+		constexpr void _M_clear() noexcept {
+			this->_M_checkpoints.clear();
+			this->_M_code_point_count = 0;
+			this->_M_stale            = false;
+		}
+
+		template <typename _Encoding, typename _Storage>
+		constexpr void _M_refresh(const _Encoding& __encoding, const _Storage& __storage) const {
+			if (this->_M_stale) {
+				this->_M_rebuild(__encoding, __storage);
+			}
+		}
+
+		template <typename _Encoding, typename _Storage>
+		constexpr ::std::size_t _M_size(const _Encoding& __encoding, const _Storage& __storage) const {
+			this->_M_refresh(__encoding, __storage);
+			return this->_M_code_point_count;
+		}
+
+		template <typename _Encoding, typename _Storage>
+		constexpr ::std::size_t _M_code_unit_index(
+			const _Encoding& __encoding, const _Storage& __storage, ::std::size_t __code_point_index) const {
+			this->_M_refresh(__encoding, __storage);
+			const __checkpoint __from
+				= this->_M_checkpoint_before(__checkpoint { 0, __code_point_index }, _S_compare_code_points());
+			return __txt_detail::__scan_code_points(__encoding, __storage, __from,
+				static_cast<::std::size_t>(::ztd::ranges::size(__storage)),
+				[__code_point_index](const __checkpoint& __position) noexcept {
+					return __position.__code_point_index >= __code_point_index;
+				})
+				.__code_unit_index;
+		}
+
+		template <typename _Encoding, typename _Storage>
+		constexpr ::std::size_t _M_code_point_index(
+			const _Encoding& __encoding, const _Storage& __storage, ::std::size_t __code_unit_index) const {
+			this->_M_refresh(__encoding, __storage);
+			const __checkpoint __from
+				= this->_M_checkpoint_before(__checkpoint { __code_unit_index, 0 }, _S_compare_code_units());
+			return __txt_detail::__scan_code_points(__encoding, __storage, __from, __code_unit_index,
+				[](const __checkpoint&) noexcept { return false; })
+				.__code_point_index;
+		}
+
+		mutable ::std::vector<__checkpoint> _M_checkpoints {};
+		mutable ::std::size_t _M_code_point_count = 0;
+		mutable bool _M_stale                     = true;
+	};
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#include <ztd/epilogue.hpp>
+
+#endif
@@ -42,6 +42,7 @@
 #include <ztd/text/state.hpp>
 #include <ztd/text/detail/is_lossless.hpp>
 #include <ztd/text/detail/encoding_range.hpp>
+#include <ztd/text/detail/segmented_range.hpp>
 
 #include <ztd/idk/tag.hpp>
 #include <ztd/ranges/subrange.hpp>
@@ -182,6 +183,10 @@ namespace ztd { namespace text {
 			return text_count_as_encoded(::ztd::tag<remove_cvref_t<_Encoding>> {}, ::std::forward<_Input>(__input),
 				::std::forward<_Encoding>(__encoding), ::std::forward<_ErrorHandler>(__error_handler), __state);
 		}
+		else if constexpr (__txt_detail::__is_segmentable_v<_Input, _State>) {
+			return __txt_detail::__segmented_count_as_encoded(::std::forward<_Input>(__input),
+				::std::forward<_Encoding>(__encoding), ::std::forward<_ErrorHandler>(__error_handler), __state);
+		}
 		else if constexpr (is_detected_v<__txt_detail::__detect_adl_internal_text_count_as_encoded, _Input, _Encoding,
 			                   _ErrorHandler, _State>) {
 			return __text_count_as_encoded(::ztd::tag<remove_cvref_t<_Encoding>> {}, ::std::forward<_Input>(__input),
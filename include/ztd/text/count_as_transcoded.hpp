@@ -45,6 +45,8 @@
 #include <ztd/text/max_units.hpp>
 #include <ztd/text/detail/is_lossless.hpp>
 #include <ztd/text/detail/encoding_range.hpp>
+#include <ztd/text/detail/segmented_range.hpp>
+#include <ztd/text/detail/count_unicode_kernels.hpp>
 #include <ztd/text/detail/span_reconstruct.hpp>
 
 #include <ztd/idk/span.hpp>
@@ -216,16 +218,22 @@ namespace ztd { namespace text {
 		_FromErrorHandler&& __from_error_handler, _ToErrorHandler&& __to_error_handler, _FromState& __from_state,
 		_ToState& __to_state, _Pivot&& __pivot) {
 		if constexpr (is_detected_v<__txt_detail::__detect_adl_text_count_as_transcoded, _Input, _FromEncoding,
-			              _ToEncoding, _FromErrorHandler, _ToErrorHandler, _FromState, _ToState>) {
+			              _ToEncoding, _FromErrorHandler, _ToErrorHandler, _FromState, _ToState, _Pivot>) {
 			return text_count_as_transcoded(
 				::ztd::tag<remove_cvref_t<_FromEncoding>, remove_cvref_t<_ToEncoding>> {},
 				::std::forward<_Input>(__input), ::std::forward<_FromEncoding>(__from_encoding),
 				::std::forward<_ToEncoding>(__to_encoding), ::std::forward<_FromErrorHandler>(__from_error_handler),
 				::std::forward<_ToErrorHandler>(__to_error_handler), __from_state, __to_state, __pivot);
 		}
+		else if constexpr (__txt_detail::__is_segmentable_v<_Input, _FromState, _ToState>) {
+			return __txt_detail::__segmented_count_as_transcoded(::std::forward<_Input>(__input),
+				::std::forward<_FromEncoding>(__from_encoding), ::std::forward<_ToEncoding>(__to_encoding),
+				::std::forward<_FromErrorHandler>(__from_error_handler),
+				::std::forward<_ToErrorHandler>(__to_error_handler), __from_state, __to_state, __pivot);
+		}
 		else if constexpr (is_detected_v<__txt_detail::__detect_adl_internal_text_count_as_transcoded, _Input,
 			                   _FromEncoding, _ToEncoding, _FromErrorHandler, _ToErrorHandler, _FromState,
-			                   _ToState>) {
+			                   _ToState, _Pivot>) {
 			return __text_count_as_transcoded(
 				::ztd::tag<remove_cvref_t<_FromEncoding>, remove_cvref_t<_ToEncoding>> {},
 				::std::forward<_Input>(__input), ::std::forward<_FromEncoding>(__from_encoding),
@@ -35,12 +35,638 @@
 
 #include <ztd/text/version.hpp>
 
+#include <ztd/text/assert.hpp>
+#include <ztd/text/unicode_code_point.hpp>
+#include <ztd/text/decode_result.hpp>
+#include <ztd/text/encode_result.hpp>
+#include <ztd/text/encoding_error.hpp>
+#include <ztd/text/is_ignorable_error_handler.hpp>
+#include <ztd/text/detail/bulk_convert.hpp>
+#include <ztd/text/detail/is_lossless.hpp>
+
+#include <ztd/cuneicode.h>
+#include <ztd/idk/span.hpp>
+#include <ztd/idk/tag.hpp>
+#include <ztd/idk/type_traits.hpp>
+#include <ztd/ranges/adl.hpp>
+#include <ztd/ranges/range.hpp>
+#include <ztd/ranges/reconstruct.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
 #include <ztd/prologue.hpp>
 
 namespace ztd { namespace text {
 	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
 
-	// WIP!
+	namespace __txt_detail {
+		struct __cnc_registry_transcoder;
+
+		//////
+		/// @brief A set of already-opened cuneicode conversions between two fixed names of one registry.
+		///
+		/// @remarks Opening a conversion has the registry resolve both names and find a (direct, or pivoting)
+		/// path between them. That only has to happen for the first conversion of a pool: states hand their
+		/// conversion back when they are done with it, and the next state picks it up instead of opening a new one.
+		class __cnc_conversion_pool {
+		private:
+			inline static constexpr ::std::size_t _PoolSize = 16;
+
+		public:
+			__cnc_conversion_pool(::std::shared_ptr<cnc_conversion_registry> __registry, ::std::string __from_name,
+				::std::string __to_name) noexcept
+			: _M_registry(::std::move(__registry))
+			, _M_from_name(::std::move(__from_name))
+			, _M_to_name(::std::move(__to_name))
+			, _M_conversions()
+			, _M_mutex()
+			, _M_open_error(cnc_open_err_ok) {
+				// resolve the path right away, so a bad name is reported up-front and the first state is cheap
+				this->_M_release(this->_M_open());
+			}
+
+			__cnc_conversion_pool(const __cnc_conversion_pool&)            = delete;
+			__cnc_conversion_pool& operator=(const __cnc_conversion_pool&) = delete;
+
+			cnc_open_err _M_error() const noexcept {
+				return this->_M_open_error.load(::std::memory_order_relaxed);
+			}
+
+			cnc_conversion* _M_acquire() noexcept {
+				try {
+					::std::lock_guard<::std::mutex> __lock(this->_M_mutex);
+					if (!this->_M_conversions.empty()) {
+						cnc_conversion* __conversion = this->_M_conversions.back();
+						this->_M_conversions.pop_back();
+						return __conversion;
+					}
+				}
+				catch (...) {
+					// the pool cannot be locked: open a conversion of our own instead
+				}
+				return this->_M_open();
+			}
+
+			void _M_release(cnc_conversion* __conversion) noexcept {
+				if (__conversion == nullptr) {
+					return;
+				}
+				// only a conversion that is not in the middle of a sequence can be handed to someone else
+				if (cnc_conv_state_is_complete(__conversion)) {
+					try {
+						::std::lock_guard<::std::mutex> __lock(this->_M_mutex);
+						if (this->_M_conversions.size() < _PoolSize) {
+							this->_M_conversions.push_back(__conversion);
+							return;
+						}
+					}
+					catch (...) {
+						// fall through and delete it instead
+					}
+				}
+				cnc_conv_delete(__conversion);
+			}
+
+			~__cnc_conversion_pool() {
+				for (cnc_conversion* __conversion : this->_M_conversions) {
+					cnc_conv_delete(__conversion);
+				}
+			}
+
+		private:
+			cnc_conversion* _M_open() noexcept {
+				if (this->_M_registry == nullptr) {
+					return nullptr;
+				}
+				cnc_conversion* __conversion = nullptr;
+				cnc_conversion_info __info   = {};
+				const cnc_open_err __err     = cnc_conv_new_c8(this->_M_registry.get(),
+				         reinterpret_cast<const ztd_char8_t*>(this->_M_from_name.c_str()),
+				         reinterpret_cast<const ztd_char8_t*>(this->_M_to_name.c_str()), &__conversion, &__info);
+				if (__err != cnc_open_err_ok) {
+					this->_M_open_error.store(__err, ::std::memory_order_relaxed);
+					return nullptr;
+				}
+				return __conversion;
+			}
+
+			::std::shared_ptr<cnc_conversion_registry> _M_registry;
+			::std::string _M_from_name;
+			::std::string _M_to_name;
+			::std::vector<cnc_conversion*> _M_conversions;
+			::std::mutex _M_mutex;
+			::std::atomic<cnc_open_err> _M_open_error;
+		};
+
+		//////
+		/// @brief Everything a ztd::text::basic_cuneicode_registry_encoding resolves about its name, shared between
+		/// copies of the encoding.
+		struct __cnc_registry_paths {
+			::std::shared_ptr<cnc_conversion_registry> _M_registry;
+			::std::string _M_name;
+			::std::shared_ptr<__cnc_conversion_pool> _M_decode_pool;
+			::std::shared_ptr<__cnc_conversion_pool> _M_encode_pool;
+			::std::mutex _M_direct_mutex;
+			::std::vector<::std::shared_ptr<__cnc_conversion_pool>> _M_direct_pools;
+			::std::vector<::std::string> _M_direct_names;
+
+			__cnc_registry_paths(::std::shared_ptr<cnc_conversion_registry> __registry, ::std::string_view __name,
+				::std::string_view __code_point_name)
+			: _M_registry(::std::move(__registry))
+			, _M_name(__name)
+			, _M_decode_pool(::std::make_shared<__cnc_conversion_pool>(
+				  this->_M_registry, this->_M_name, ::std::string(__code_point_name)))
+			, _M_encode_pool(::std::make_shared<__cnc_conversion_pool>(
+				  this->_M_registry, ::std::string(__code_point_name), this->_M_name))
+			, _M_direct_mutex()
+			, _M_direct_pools()
+			, _M_direct_names() {
+			}
+
+			//////
+			/// @brief Retrieves (resolving at most once) the conversion straight from this name to `__to_name`.
+			::std::shared_ptr<__cnc_conversion_pool> _M_direct_pool(const ::std::string& __to_name) {
+				::std::lock_guard<::std::mutex> __lock(this->_M_direct_mutex);
+				for (::std::size_t __index = 0; __index < this->_M_direct_names.size(); ++__index) {
+					if (this->_M_direct_names[__index] == __to_name) {
+						return this->_M_direct_pools[__index];
+					}
+				}
+				this->_M_direct_pools.push_back(
+					::std::make_shared<__cnc_conversion_pool>(this->_M_registry, this->_M_name, __to_name));
+				this->_M_direct_names.push_back(__to_name);
+				return this->_M_direct_pools.back();
+			}
+		};
+
+		//////
+		/// @brief Holds one conversion of a pool for the lifetime of a decode or encode state.
+		class __cnc_conversion_handle {
+		public:
+			__cnc_conversion_handle(::std::shared_ptr<__cnc_conversion_pool> __pool) noexcept
+			: _M_pool(::std::move(__pool)), _M_conversion(this->_M_pool->_M_acquire()) {
+			}
+
+			//////
+			/// @brief Creates a handle for the same conversion as `__other`, but starting from the initial state:
+			/// conversions cannot be duplicated.
+			__cnc_conversion_handle(const __cnc_conversion_handle& __other) noexcept
+			: _M_pool(__other._M_pool), _M_conversion(this->_M_pool->_M_acquire()) {
+			}
+
+			__cnc_conversion_handle(__cnc_conversion_handle&& __other) noexcept
+			: _M_pool(__other._M_pool), _M_conversion(::std::exchange(__other._M_conversion, nullptr)) {
+			}
+
+			__cnc_conversion_handle& operator=(__cnc_conversion_handle __other) noexcept {
+				::std::swap(this->_M_pool, __other._M_pool);
+				::std::swap(this->_M_conversion, __other._M_conversion);
+				return *this;
+			}
+
+			//////
+			/// @brief Whether or not this state has completed its current conversion.
+			bool is_complete() const noexcept {
+				return this->_M_conversion == nullptr || cnc_conv_state_is_complete(this->_M_conversion);
+			}
+
+			bool _M_is_valid() const noexcept {
+				return this->_M_conversion != nullptr;
+			}
+
+			//////
+			/// @brief Gives the held conversion back to the pool and takes one that starts from the initial state.
+			void _M_restart() noexcept {
+				this->_M_pool->_M_release(::std::exchange(this->_M_conversion, nullptr));
+				this->_M_conversion = this->_M_pool->_M_acquire();
+			}
+
+			~__cnc_conversion_handle() {
+				this->_M_pool->_M_release(this->_M_conversion);
+			}
+
+			::std::shared_ptr<__cnc_conversion_pool> _M_pool;
+			cnc_conversion* _M_conversion;
+		};
+
+		inline ::std::shared_ptr<cnc_conversion_registry> __default_cnc_registry() noexcept {
+			static const ::std::shared_ptr<cnc_conversion_registry> __registry = []() {
+				cnc_conversion_registry* __raw_registry = nullptr;
+				if (cnc_registry_new(&__raw_registry, cnc_registry_options_none) != cnc_open_err_ok) {
+					return ::std::shared_ptr<cnc_conversion_registry>(nullptr);
+				}
+				return ::std::shared_ptr<cnc_conversion_registry>(__raw_registry, &cnc_registry_delete);
+			}();
+			return __registry;
+		}
+	} // namespace __txt_detail
+
+	//////
+	/// @brief An encoding whose name is only known at run-time, backed by a cuneicode conversion registry.
+	///
+	/// @tparam _CodeUnit The code unit type.
+	/// @tparam _CodePoint The code point type.
+	///
+	/// @remarks The name is resolved against the registry once, when the encoding is constructed: the resulting
+	/// conversions (from the name to UTF-32 and back) are pooled and shared between all copies of the encoding
+	/// and every state made from them, so creating states or converting short strings does not pay for a name
+	/// lookup again. Whole contiguous inputs and outputs go through cuneicode's bulk `cnc_conv` in one call;
+	/// single steps use `cnc_conv_one`. Because it is all done at runtime, it is considered a lossy conversion and
+	/// thus requires use of error handlers.
+	template <typename _CodeUnit = char, typename _CodePoint = unicode_code_point>
+	class basic_cuneicode_registry_encoding {
+	private:
+		inline static constexpr ::std::string_view _CodePointName = "UTF-32";
+
+	public:
+		//////
+		/// @brief The code unit type used for input on decode operations and output for encode operations.
+		using code_unit = _CodeUnit;
+		//////
+		/// @brief The code point type used for output on decode operations and input for encode operations.
+		using code_point = _CodePoint;
+
+		//////
+		/// @brief The maximum number of code units that can be output by a single operation.
+		///
+		/// @remarks Since this is a runtime-based encoding, these numbers are set abnormally high, in hopes that
+		/// they never need to be changed.
+		inline static constexpr ::std::size_t max_code_units = 32;
+		//////
+		/// @brief The maximum number of code points that can be output by a single operation.
+		///
+		/// @remarks Since this is a runtime-based encoding, these numbers are set abnormally high, in hopes that
+		/// they never need to be changed.
+		inline static constexpr ::std::size_t max_code_points = 32;
+
+		//////
+		/// @brief The state for decode operations.
+		///
+		/// @remarks This holds a cuneicode conversion taken from the encoding's pool, and gives it back when it is
+		/// destroyed.
+		class decode_state : public __txt_detail::__cnc_conversion_handle {
+		public:
+			decode_state(const basic_cuneicode_registry_encoding& __source) noexcept
+			: __txt_detail::__cnc_conversion_handle(__source._M_paths->_M_decode_pool) {
+			}
+		};
+
+		//////
+		/// @brief The state for encode operations.
+		///
+		/// @remarks This holds a cuneicode conversion taken from the encoding's pool, and gives it back when it is
+		/// destroyed.
+		class encode_state : public __txt_detail::__cnc_conversion_handle {
+		public:
+			encode_state(const basic_cuneicode_registry_encoding& __source) noexcept
+			: __txt_detail::__cnc_conversion_handle(__source._M_paths->_M_encode_pool) {
+			}
+		};
+
+		//////
+		/// @brief Creates an encoding for the given name, resolved against a process-wide default registry.
+		///
+		/// @param[in] __name The name of the encoding, as the registry knows it.
+		///
+		/// @remarks If the name cannot be resolved, this asserts. Use the overload with an output error parameter
+		/// to check instead.
+		basic_cuneicode_registry_encoding(::std::string_view __name)
+		: basic_cuneicode_registry_encoding(__txt_detail::__default_cnc_registry(), __name) {
+			ZTD_TEXT_ASSERT_MESSAGE("the name could not be resolved to a conversion in the cuneicode registry",
+				this->error() == cnc_open_err_ok);
+		}
+
+		//////
+		/// @brief Creates an encoding for the given name, resolved against a process-wide default registry.
+		///
+		/// @param[in] __name The name of the encoding, as the registry knows it.
+		/// @param[out] __error The result of resolving the name. On failure, states created from this encoding are
+		/// invalid, and any conversion with them reports ztd::text::encoding_error::invalid_sequence.
+		basic_cuneicode_registry_encoding(::std::string_view __name, cnc_open_err& __error)
+		: basic_cuneicode_registry_encoding(__txt_detail::__default_cnc_registry(), __name) {
+			__error = this->error();
+		}
+
+		//////
+		/// @brief Creates an encoding for the given name, resolved against the given registry.
+		///
+		/// @param[in] __registry The registry to use. It must outlive this encoding, all of its copies, and all
+		/// states made from them.
+		/// @param[in] __name The name of the encoding, as the registry knows it.
+		/// @param[out] __error The result of resolving the name.
+		basic_cuneicode_registry_encoding(
+			cnc_conversion_registry* __registry, ::std::string_view __name, cnc_open_err& __error)
+		: basic_cuneicode_registry_encoding(
+			::std::shared_ptr<cnc_conversion_registry>(__registry, [](cnc_conversion_registry*) {}), __name) {
+			__error = this->error();
+		}
+
+		//////
+		/// @brief The name this encoding was created with.
+		const ::std::string& name() const noexcept {
+			return this->_M_paths->_M_name;
+		}
+
+		//////
+		/// @brief The result of resolving this encoding's name in both directions.
+		cnc_open_err error() const noexcept {
+			const cnc_open_err __decode_error = this->_M_paths->_M_decode_pool->_M_error();
+			return __decode_error != cnc_open_err_ok ? __decode_error : this->_M_paths->_M_encode_pool->_M_error();
+		}
+
+		//////
+		/// @brief Decodes a single complete unit of information as code points and produces a result with the
+		/// input and output ranges moved past what was successfully read and written; or, produces an error and
+		/// returns the input and output ranges untouched.
+		///
+		/// @param[in] __input The input view to read code units from.
+		/// @param[in] __output The output view to write code points into.
+		/// @param[in] __error_handler The error handler to invoke if decoding fails.
+		/// @param[in, out] __state The necessary state information, holding the cuneicode conversion.
+		///
+		/// @returns A ztd::text::decode_result object that contains the input range, output range, error handler, and
+		/// a reference to the passed-in state\.
+		template <typename _Input, typename _Output, typename _ErrorHandler>
+		auto decode_one(_Input&& __input, _Output&& __output, _ErrorHandler&& __error_handler,
+			decode_state& __state) const noexcept {
+			using _SubInput  = ztd::ranges::csubrange_for_t<::std::remove_reference_t<_Input>>;
+			using _SubOutput = ztd::ranges::subrange_for_t<::std::remove_reference_t<_Output>>;
+			using _Result    = decode_result<_SubInput, _SubOutput, decode_state>;
+			return this->_M_convert_one<_Result, code_unit, code_point>(::std::forward<_Input>(__input),
+				::std::forward<_Output>(__output), ::std::forward<_ErrorHandler>(__error_handler), __state);
+		}
+
+		//////
+		/// @brief Encodes a single complete unit of information as code units and produces a result with the
+		/// input and output ranges moved past what was successfully read and written; or, produces an error and
+		/// returns the input and output ranges untouched.
+		///
+		/// @param[in] __input The input view to read code points from.
+		/// @param[in] __output The output view to write code units into.
+		/// @param[in] __error_handler The error handler to invoke if encoding fails.
+		/// @param[in, out] __state The necessary state information, holding the cuneicode conversion.
+		///
+		/// @returns A ztd::text::encode_result object that contains the input range, output range, error handler, and
+		/// a reference to the passed-in state\.
+		template <typename _Input, typename _Output, typename _ErrorHandler>
+		auto encode_one(_Input&& __input, _Output&& __output, _ErrorHandler&& __error_handler,
+			encode_state& __state) const noexcept {
+			using _SubInput  = ztd::ranges::csubrange_for_t<::std::remove_reference_t<_Input>>;
+			using _SubOutput = ztd::ranges::subrange_for_t<::std::remove_reference_t<_Output>>;
+			using _Result    = encode_result<_SubInput, _SubOutput, encode_state>;
+			return this->_M_convert_one<_Result, code_point, code_unit>(::std::forward<_Input>(__input),
+				::std::forward<_Output>(__output), ::std::forward<_ErrorHandler>(__error_handler), __state);
+		}
+
+		//////
+		/// @brief Decodes as much of the input as possible into the output, with as few calls into cuneicode as
+		/// possible.
+		///
+		/// @param[in] __input The input view to read code units from.
+		/// @param[in] __output The output view to write code points into.
+		/// @param[in] __error_handler The error handler to invoke if decoding fails.
+		/// @param[in, out] __state The necessary state information, holding the cuneicode conversion.
+		///
+		/// @remarks When both the input and output are contiguous and sized, they are handed to a single `cnc_conv`
+		/// call. Only where it stops is ztd::text::basic_cuneicode_registry_encoding::decode_one used, so the error
+		/// handler is invoked exactly as it would be when decoding one unit of information at a time.
+		template <typename _Input, typename _Output, typename _ErrorHandler>
+		auto decode(_Input&& __input, _Output&& __output, _ErrorHandler&& __error_handler,
+			decode_state& __state) const noexcept {
+			static_assert(__txt_detail::__is_decode_lossless_or_deliberate_v<basic_cuneicode_registry_encoding,
+			                   remove_cvref_t<_ErrorHandler>>,
+				ZTD_TEXT_LOSSY_DECODE_MESSAGE_I_);
+			return this->_M_convert<code_unit, code_point>(::std::forward<_Input>(__input),
+				::std::forward<_Output>(__output), __error_handler, __state,
+				[this](auto&& __step_input, auto&& __step_output, auto& __step_error_handler,
+					decode_state& __step_state) {
+					return this->decode_one(::std::forward<decltype(__step_input)>(__step_input),
+						::std::forward<decltype(__step_output)>(__step_output), __step_error_handler,
+						__step_state);
+				});
+		}
+
+		//////
+		/// @brief Encodes as much of the input as possible into the output, with as few calls into cuneicode as
+		/// possible.
+		///
+		/// @param[in] __input The input view to read code points from.
+		/// @param[in] __output The output view to write code units into.
+		/// @param[in] __error_handler The error handler to invoke if encoding fails.
+		/// @param[in, out] __state The necessary state information, holding the cuneicode conversion.
+		///
+		/// @remarks When both the input and output are contiguous and sized, they are handed to a single `cnc_conv`
+		/// call. Only where it stops is ztd::text::basic_cuneicode_registry_encoding::encode_one used, so the error
+		/// handler is invoked exactly as it would be when encoding one unit of information at a time.
+		template <typename _Input, typename _Output, typename _ErrorHandler>
+		auto encode(_Input&& __input, _Output&& __output, _ErrorHandler&& __error_handler,
+			encode_state& __state) const noexcept {
+			static_assert(__txt_detail::__is_encode_lossless_or_deliberate_v<basic_cuneicode_registry_encoding,
+			                   remove_cvref_t<_ErrorHandler>>,
+				ZTD_TEXT_LOSSY_ENCODE_MESSAGE_I_);
+			return this->_M_convert<code_point, code_unit>(::std::forward<_Input>(__input),
+				::std::forward<_Output>(__output), __error_handler, __state,
+				[this](auto&& __step_input, auto&& __step_output, auto& __step_error_handler,
+					encode_state& __step_state) {
+					return this->encode_one(::std::forward<decltype(__step_input)>(__step_input),
+						::std::forward<decltype(__step_output)>(__step_output), __step_error_handler,
+						__step_state);
+				});
+		}
+
+	private:
+		friend struct __txt_detail::__cnc_registry_transcoder;
+
+		basic_cuneicode_registry_encoding(
+			::std::shared_ptr<cnc_conversion_registry> __registry, ::std::string_view __name)
+		: _M_paths(::std::make_shared<__txt_detail::__cnc_registry_paths>(
+			::std::move(__registry), __name, _CodePointName)) {
+		}
+
+		//////
+		/// @brief Runs `__conversion` over as much of the (contiguous) input and output as it can in one call, and
+		/// moves both ranges past what was read and written.
+		///
+		/// @returns Whether or not the entire input was converted.
+		template <typename _InputUnit, typename _OutputUnit, typename _WorkingInput, typename _WorkingOutput>
+		static bool _S_convert_bulk(cnc_conversion* __conversion, _WorkingInput& __working_input,
+			_WorkingOutput& __working_output) noexcept {
+			const ::std::size_t __input_size = static_cast<::std::size_t>(::ztd::ranges::size(__working_input));
+			const ::std::size_t __output_size = static_cast<::std::size_t>(::ztd::ranges::size(__working_output));
+			if (__output_size == 0) {
+				return false;
+			}
+			const ::std::size_t __initial_read_size  = __input_size * sizeof(_InputUnit);
+			const ::std::size_t __initial_write_size = __output_size * sizeof(_OutputUnit);
+			::std::size_t __read_size                = __initial_read_size;
+			::std::size_t __write_size               = __initial_write_size;
+			const unsigned char* __read_pointer
+				= reinterpret_cast<const unsigned char*>(::std::addressof(*::ztd::ranges::begin(__working_input)));
+			unsigned char* __write_pointer
+				= reinterpret_cast<unsigned char*>(::std::addressof(*::ztd::ranges::begin(__working_output)));
+			const cnc_mcerr __err
+				= cnc_conv(__conversion, &__write_size, &__write_pointer, &__read_size, &__read_pointer);
+			__working_input = __txt_detail::__bulk_advance(
+				__working_input, (__initial_read_size - __read_size) / sizeof(_InputUnit));
+			__working_output = __txt_detail::__bulk_advance(
+				__working_output, (__initial_write_size - __write_size) / sizeof(_OutputUnit));
+			return __err == cnc_mcerr_ok && __read_size == 0;
+		}
+
+		template <typename _InputUnit, typename _OutputUnit, typename _Input, typename _Output,
+			typename _ErrorHandler, typename _State, typename _OneStep>
+		auto _M_convert(_Input&& __input, _Output&& __output, _ErrorHandler& __error_handler, _State& __state,
+			_OneStep&& __one_step) const noexcept {
+			using _Drain = __txt_detail::__bulk_drain;
+			return __txt_detail::__bulk_convert<sizeof(_InputUnit), sizeof(_OutputUnit), _Drain::__once>(
+				::std::forward<_Input>(__input), ::std::forward<_Output>(__output), __error_handler, __state,
+				[](auto& __working_input, auto& __working_output, _State& __bulk_state) {
+					return __bulk_state._M_is_valid()
+					     && _S_convert_bulk<_InputUnit, _OutputUnit>(
+					          __bulk_state._M_conversion, __working_input, __working_output);
+				},
+				[&__one_step](auto&& __step_input, auto&& __step_output, auto& __step_error_handler,
+					_State& __step_state) {
+					auto __step_result = __one_step(::std::forward<decltype(__step_input)>(__step_input),
+						::std::forward<decltype(__step_output)>(__step_output), __step_error_handler, __step_state);
+					if (__step_result.error_code == encoding_error::ok && !__step_state._M_is_valid()) {
+						// nothing can be converted without a conversion, no matter what the error handler did
+						__step_result.error_code = encoding_error::invalid_sequence;
+					}
+					return __step_result;
+				});
+		}
+
+		template <typename _Result, typename _InputUnit, typename _OutputUnit, typename _Input, typename _Output,
+			typename _ErrorHandler, typename _State>
+		auto _M_convert_one(_Input&& __input, _Output&& __output, _ErrorHandler&& __error_handler,
+			_State& __state) const noexcept {
+			using _UErrorHandler                = remove_cvref_t<_ErrorHandler>;
+			using _SubInput                     = decltype(::std::declval<_Result>().input);
+			using _SubOutput                    = decltype(::std::declval<_Result>().output);
+			constexpr bool __call_error_handler = !is_ignorable_error_handler_v<_UErrorHandler>;
+
+			auto __in_it    = ::ztd::ranges::cbegin(__input);
+			auto __in_last  = ::ztd::ranges::cend(__input);
+			auto __out_it   = ::ztd::ranges::begin(__output);
+			auto __out_last = ::ztd::ranges::end(__output);
+
+			if (!__state._M_is_valid()) {
+				// bail instead of destroying everything
+				if constexpr (__call_error_handler) {
+					return ::std::forward<_ErrorHandler>(__error_handler)(*this,
+						_Result(_SubInput(::std::move(__in_it), ::std::move(__in_last)),
+						     _SubOutput(::std::move(__out_it), ::std::move(__out_last)), __state,
+						     encoding_error::invalid_sequence),
+						::ztd::span<const _InputUnit, 0>(), ::ztd::span<const _OutputUnit, 0>());
+				}
+				else {
+					return _Result(_SubInput(::std::move(__in_it), ::std::move(__in_last)),
+						_SubOutput(::std::move(__out_it), ::std::move(__out_last)), __state,
+						encoding_error::invalid_sequence);
+				}
+			}
+
+			// the buffers are handed to cuneicode as bytes, just like the bulk path does with the ranges
+			_InputUnit __read_buffer[max_code_units] = {};
+			::std::size_t __read_count               = 0;
+			if (__in_it == __in_last) {
+				if (__state.is_complete()) {
+					// an exhausted sequence is fine
+					return _Result(_SubInput(::std::move(__in_it), ::std::move(__in_last)),
+						_SubOutput(::std::move(__out_it), ::std::move(__out_last)), __state, encoding_error::ok);
+				}
+			}
+			else {
+				__read_buffer[0] = *__in_it;
+				++__in_it;
+				__read_count = 1;
+			}
+			_OutputUnit __write_buffer[max_code_points] = {};
+			::std::size_t __write_size                  = sizeof(__write_buffer);
+			for (;;) {
+				const unsigned char* __read_pointer = reinterpret_cast<const unsigned char*>(__read_buffer + 0);
+				::std::size_t __read_size           = __read_count * sizeof(_InputUnit);
+				unsigned char* __write_pointer      = reinterpret_cast<unsigned char*>(__write_buffer + 0);
+				__write_size                        = sizeof(__write_buffer);
+				const cnc_mcerr __err               = cnc_conv_one(
+                         __state._M_conversion, &__write_size, &__write_pointer, &__read_size, &__read_pointer);
+				if (__err == cnc_mcerr_ok) {
+					break;
+				}
+				if (__err == cnc_mcerr_incomplete_input && __in_it != __in_last && __read_count < max_code_units) {
+					// not enough yet: feed it one more
+					__read_buffer[__read_count] = *__in_it;
+					++__in_it;
+					++__read_count;
+					continue;
+				}
+				if constexpr (__call_error_handler) {
+					return ::std::forward<_ErrorHandler>(__error_handler)(*this,
+						_Result(_SubInput(::std::move(__in_it), ::std::move(__in_last)),
+						     _SubOutput(::std::move(__out_it), ::std::move(__out_last)), __state,
+						     __err == cnc_mcerr_insufficient_output ? encoding_error::insufficient_output_space
+						                                            : encoding_error::invalid_sequence),
+						::ztd::span<const _InputUnit>(__read_buffer + 0, __read_count),
+						::ztd::span<const _OutputUnit, 0>());
+				}
+				else {
+					break;
+				}
+			}
+			const ::std::size_t __written_count
+				= (sizeof(__write_buffer) - __write_size) / sizeof(__write_buffer[0]);
+			for (::std::size_t __write_index = 0; __write_index < __written_count; ++__write_index) {
+				if constexpr (__call_error_handler) {
+					if (__out_it == __out_last) {
+						// insufficient space!
+						return ::std::forward<_ErrorHandler>(__error_handler)(*this,
+							_Result(_SubInput(::std::move(__in_it), ::std::move(__in_last)),
+							     _SubOutput(::std::move(__out_it), ::std::move(__out_last)), __state,
+							     encoding_error::insufficient_output_space),
+							::ztd::span<const _InputUnit>(__read_buffer + 0, __read_count),
+							::ztd::span<const _OutputUnit>(
+							     __write_buffer + __write_index, __written_count - __write_index));
+					}
+				}
+				*__out_it = __write_buffer[__write_index];
+				++__out_it;
+			}
+			return _Result(_SubInput(::std::move(__in_it), ::std::move(__in_last)),
+				_SubOutput(::std::move(__out_it), ::std::move(__out_last)), __state, encoding_error::ok);
+		}
+
+		template <typename _Encoding, typename _Input, typename _Output, typename _ErrorHandler,
+			::std::enable_if_t<::std::is_base_of_v<basic_cuneicode_registry_encoding, _Encoding>>* = nullptr>
+		friend auto __text_decode(::ztd::tag<_Encoding>, _Input&& __input,
+			type_identity_t<const basic_cuneicode_registry_encoding&> __encoding, _Output&& __output,
+			_ErrorHandler&& __error_handler, decode_state& __state) {
+			return __encoding.decode(::std::forward<_Input>(__input), ::std::forward<_Output>(__output),
+				::std::forward<_ErrorHandler>(__error_handler), __state);
+		}
+
+		template <typename _Encoding, typename _Input, typename _Output, typename _ErrorHandler,
+			::std::enable_if_t<::std::is_base_of_v<basic_cuneicode_registry_encoding, _Encoding>>* = nullptr>
+		friend auto __text_encode(::ztd::tag<_Encoding>, _Input&& __input,
+			type_identity_t<const basic_cuneicode_registry_encoding&> __encoding, _Output&& __output,
+			_ErrorHandler&& __error_handler, encode_state& __state) {
+			return __encoding.encode(::std::forward<_Input>(__input), ::std::forward<_Output>(__output),
+				::std::forward<_ErrorHandler>(__error_handler), __state);
+		}
+
+		::std::shared_ptr<__txt_detail::__cnc_registry_paths> _M_paths;
+	};
+
+	//////
+	/// @brief A convenience alias for a cuneicode registry-backed encoding with `char` code units.
+	using cuneicode_registry_encoding = basic_cuneicode_registry_encoding<char, unicode_code_point>;
 
 	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
 }} // namespace ztd::text
@@ -42,11 +42,15 @@
 #include <ztd/text/state.hpp>
 #include <ztd/text/is_unicode_code_point.hpp>
 #include <ztd/text/max_units.hpp>
+#include <ztd/text/count_as_decoded.hpp>
+#include <ztd/text/output_sizing.hpp>
 #include <ztd/text/detail/span_reconstruct.hpp>
 #include <ztd/text/detail/is_lossless.hpp>
 #include <ztd/text/detail/encoding_range.hpp>
 #include <ztd/text/detail/forward_if_move_only.hpp>
 #include <ztd/text/detail/update_input.hpp>
+#include <ztd/text/detail/output_storage.hpp>
+#include <ztd/text/detail/segmented_range.hpp>
 
 #include <ztd/idk/span.hpp>
 #include <ztd/idk/type_traits.hpp>
@@ -172,6 +176,11 @@ namespace ztd { namespace text {
 				::std::forward<_Encoding>(__encoding), ::std::forward<_Output>(__output),
 				::std::forward<_ErrorHandler>(__error_handler), __state);
 		}
+		else if constexpr (__txt_detail::__is_segmentable_v<_Input, _State>) {
+			return __txt_detail::__segmented_decode_into_raw(::std::forward<_Input>(__input),
+				::std::forward<_Encoding>(__encoding), ::std::forward<_Output>(__output),
+				::std::forward<_ErrorHandler>(__error_handler), __state);
+		}
 		else if constexpr (is_detected_v<__txt_detail::__detect_adl_internal_text_decode, _Input, _Encoding, _Output,
 			                   _ErrorHandler, _State>) {
 			return __text_decode(::ztd::tag<remove_cvref_t<_Encoding>> {}, ::std::forward<_Input>(__input),
@@ -276,8 +285,8 @@ namespace ztd { namespace text {
 			typename _State>
 		constexpr auto __intermediate_decode_to_storage(_Input&& __input, _Encoding&& __encoding,
 			_OutputContainer& __output, _ErrorHandler&& __error_handler, _State& __state) {
-			// Well, SHIT. Write into temporary, then serialize one-by-one/bulk to output.
-			// I'll admit, this is HELLA work to support...
+			// Write straight into the container's tail if it lets us, or into a temporary that is then serialized
+			// in bulk into the container otherwise.
 			using _UEncoding                    = remove_cvref_t<_Encoding>;
 			using _UErrorHandler                = remove_cvref_t<_ErrorHandler>;
 			constexpr ::std::size_t __max_units = max_decode_code_points_v<_UEncoding>;
@@ -287,12 +296,13 @@ namespace ztd { namespace text {
 				: ZTD_TEXT_INTERMEDIATE_DECODE_BUFFER_SIZE_I_(code_point_t<_UEncoding>);
 			using _IntermediateValueType = code_point_t<_UEncoding>;
 			using _IntermediateInput     = __txt_detail::__span_reconstruct_t<_Input, _Input>;
-			using _InitialOutput         = ::ztd::span<_IntermediateValueType, __intermediate_buffer_max>;
 			using _Output                = ::ztd::span<_IntermediateValueType>;
 			using _Result                = decltype(__encoding.decode_one(
                     ::std::declval<_IntermediateInput>(), ::std::declval<_Output>(), __error_handler, __state));
 			using _ResultInput           = decltype(::std::declval<_Result>().input);
 			using _WorkingInput          = __span_reconstruct_t<_ResultInput, _ResultInput>;
+			using _Storage               = __output_storage_t<_OutputContainer, _IntermediateValueType,
+                    __intermediate_buffer_max, __max_units>;
 
 			static_assert(__txt_detail::__is_decode_lossless_or_deliberate_v<_Encoding, _ErrorHandler>,
 				ZTD_TEXT_LOSSY_DECODE_MESSAGE_I_);
@@ -304,20 +314,23 @@ namespace ztd { namespace text {
 			_IntermediateInput __intermediate_input
 				= __txt_detail::__span_reconstruct<_Input>(::std::forward<_Input>(__input));
 			_WorkingInput __working_input(::std::move(__intermediate_input));
-			_IntermediateValueType __intermediate_translation_buffer[__intermediate_buffer_max] {};
+			_Storage __storage(__output);
+			::std::size_t __error_count = 0;
 
 			for (;;) {
-				// Ignore "out of output" errors and do our best to recover properly along the way...
-				_InitialOutput __intermediate_initial_output(__intermediate_translation_buffer);
-				auto __result = ::ztd::text::decode_into_raw(::std::move(__working_input), __encoding,
-					__intermediate_initial_output, __intermediate_handler, __state);
-				_Output __intermediate_output(__intermediate_initial_output.data(), __result.output.data());
-				ranges::__rng_detail::__container_insert_bulk(__output, __intermediate_output);
+				// Ignore "out of output" errors and do our best to recover properly along the way. The last
+				// __max_units of the room are headroom for partial writes and the error handler's output.
+				_Output __room = __storage._M_room();
+				auto __result  = ::ztd::text::decode_into_raw(::std::move(__working_input), __encoding,
+					 __room.first(__room.size() - __max_units), __intermediate_handler, __state);
+				_IntermediateValueType* __current = __result.output.data();
 				if (__result.error_code == encoding_error::insufficient_output_space) {
 					if (__intermediate_handler._M_code_points_progress_size() != 0) {
 						// add any leftover partially-unwritten characters to our output
-						ranges::__rng_detail::__container_insert_bulk(
-							__output, __intermediate_handler._M_const_code_points_progress());
+						auto __progress = __intermediate_handler._M_const_code_points_progress();
+						ranges::__rng_detail::__copy_n_unsafe(
+							::ztd::ranges::cbegin(__progress), __progress.size(), __current);
+						__current += __progress.size();
 						// it's okay, just loop around, we've got S P A C E for more
 						__working_input
 							= __txt_detail::__update_input<_WorkingInput>(::std::move(__result.input));
@@ -338,6 +351,8 @@ namespace ztd { namespace text {
 							// this is an effectively-impossible case, as we cannot stitch the old input together
 							// with the current input.
 							// simply bail!!
+							__storage._M_commit(static_cast<::std::size_t>(__current - __room.data()));
+							__result.error_count = __error_count + 1;
 							return __result;
 						}
 					}
@@ -346,45 +361,79 @@ namespace ztd { namespace text {
 						__working_input
 							= __txt_detail::__update_input<_WorkingInput>(::std::move(__result.input));
 					}
+					__storage._M_commit(static_cast<::std::size_t>(__current - __room.data()));
 					__intermediate_handler.clear();
 					continue;
 				}
 				if (__result.error_code != encoding_error::ok) {
-					// mill result through actual error handler!
-					auto __error_result
-						= ::std::forward<_ErrorHandler>(__error_handler)(::std::forward<_Encoding>(__encoding),
-						     ::std::move(__result), __intermediate_handler._M_code_units_progress(),
-						     __intermediate_handler._M_code_points_progress());
-					return __error_result;
+					// mill result through actual error handler, letting it write into the headroom!
+					__result.output     = _Output(__current, __room.data() + __room.size());
+					auto __error_result = __error_handler(__encoding, ::std::move(__result),
+						__intermediate_handler._M_code_units_progress(),
+						__intermediate_handler._M_code_points_progress());
+					__storage._M_commit(static_cast<::std::size_t>(__error_result.output.data() - __room.data()));
+					__error_count += __error_result.error_count;
+					__intermediate_handler.clear();
+					if (__error_result.error_code != encoding_error::ok) {
+						__error_result.error_count = __error_count;
+						return __error_result;
+					}
+					__working_input
+						= __txt_detail::__update_input<_WorkingInput>(::std::move(__error_result.input));
+					continue;
 				}
+				__storage._M_commit(static_cast<::std::size_t>(__current - __room.data()));
 				if (::ztd::ranges::empty(__result.input)) {
 					if (!::ztd::text::is_state_complete(__encoding, __state)) {
+						__working_input
+							= __txt_detail::__update_input<_WorkingInput>(::std::move(__result.input));
 						continue;
 					}
+					__result.error_count = __error_count;
 					return __result;
 				}
+				__working_input = __txt_detail::__update_input<_WorkingInput>(::std::move(__result.input));
 			}
 		}
 
-		template <bool _OutputOnly, bool _NoState, typename _OutputContainer, typename _Input, typename _Encoding,
-			typename _ErrorHandler, typename _State>
-		constexpr auto __decode_dispatch(
-			_Input&& __input, _Encoding&& __encoding, _ErrorHandler&& __error_handler, _State& __state) {
+		template <bool _OutputOnly, bool _NoState, typename _OutputContainer, typename _SizingPolicy,
+			typename _Input, typename _Encoding, typename _ErrorHandler, typename _State>
+		constexpr auto __decode_dispatch(const _SizingPolicy& __sizing, _Input&& __input, _Encoding&& __encoding,
+			_ErrorHandler&& __error_handler, _State& __state) {
 			using _UEncoding                    = remove_cvref_t<_Encoding>;
+			using _SizingKey                    = ::ztd::tag<_UEncoding, code_point_t<_UEncoding>>;
 			constexpr ::std::size_t __max_units = max_decode_code_points_v<_UEncoding>;
 
 			_OutputContainer __output {};
-			if constexpr (is_detected_v<ranges::detect_adl_size, _Input>) {
-				using _SizeType = decltype(::ztd::ranges::size(__input));
-				if constexpr (is_detected_v<ranges::detect_reserve_with_size, _OutputContainer, _SizeType>) {
-					auto __output_size_hint = ::ztd::ranges::size(__input);
-					__output_size_hint *= (__max_units / 2);
+			const ::std::size_t __input_size = __txt_detail::__output_sizing_input_size(__input);
+			if constexpr (is_detected_v<ranges::detect_reserve_with_size, _OutputContainer, ::std::size_t>) {
+				// by default, at least one code point for every code unit of input, and more for encodings that
+				// tend to produce several
+				const ::std::size_t __default_size = __input_size * ((__max_units > 1) ? (__max_units / 2) : 1);
+				const ::std::size_t __output_size_hint = __txt_detail::__output_size_hint<_SizingKey>(__sizing,
+					__input_size, __default_size, __input_size * max_code_points_v<_UEncoding>, __max_units * 2,
+					[&](::std::size_t __fallback_size) -> ::std::size_t {
+						using _UInput = remove_cvref_t<_Input>;
+						if constexpr (!ranges::is_range_input_or_output_range_exactly_v<_UInput> // cf
+							&& ::std::is_copy_constructible_v<_State>) {
+							remove_cvref_t<_State> __count_state = __state;
+							auto __count_result                  = ::ztd::text::count_as_decoded(
+								                 __input, __encoding, __error_handler, __count_state);
+							return __count_result.count;
+						}
+						else {
+							return __fallback_size;
+						}
+					});
+				if (__output_size_hint != 0) {
 					__output.reserve(__output_size_hint);
 				}
 			}
 			auto __stateful_result = __txt_detail::__intermediate_decode_to_storage(::std::forward<_Input>(__input),
 				::std::forward<_Encoding>(__encoding), __output, ::std::forward<_ErrorHandler>(__error_handler),
 				__state);
+			__txt_detail::__record_output_size<_SizingKey>(
+				__sizing, __input_size, __txt_detail::__output_sizing_input_size(__output));
 			if constexpr (_OutputOnly) {
 				(void)__stateful_result;
 				return __output;
@@ -399,6 +448,15 @@ namespace ztd { namespace text {
 			}
 		}
 
+		template <bool _OutputOnly, bool _NoState, typename _OutputContainer, typename _Input, typename _Encoding,
+			typename _ErrorHandler, typename _State>
+		constexpr auto __decode_dispatch(
+			_Input&& __input, _Encoding&& __encoding, _ErrorHandler&& __error_handler, _State& __state) {
+			return __txt_detail::__decode_dispatch<_OutputOnly, _NoState, _OutputContainer>(default_output_sizing,
+				::std::forward<_Input>(__input), ::std::forward<_Encoding>(__encoding),
+				::std::forward<_ErrorHandler>(__error_handler), __state);
+		}
+
 	} // namespace __txt_detail
 
 	//////
@@ -552,11 +610,14 @@ namespace ztd { namespace text {
 
 	//////
 	/// @brief Converts the code units of the given `__input` view through the encoding to code points the
-	/// specified
-	/// `_OutputContainer` type.
+	/// specified `_OutputContainer` type, reserving room in it according to the given sizing policy.
 	///
 	/// @tparam _OutputContainer The container type to serialize data into.
 	///
+	/// @param[in] __sizing The output sizing policy (ztd::text::exact_output_sizing,
+	/// ztd::text::upper_bound_output_sizing, ztd::text::adaptive_output_sizing, a
+	/// ztd::text::user_hint_output_sizing_t, or ztd::text::default_output_sizing) that decides how much to reserve
+	/// in the container before decoding.
 	/// @param[in] __input An input_view to read code units from and use in the decode operation that will
 	/// produce code points.
 	/// @param[in] __encoding The encoding that will be used to decode the input's code points into
@@ -568,13 +629,12 @@ namespace ztd { namespace text {
 	/// @result A ztd::text::decode_result object that contains references to `__state` and an output of type
 	/// `_OutputContainer`.
 	///
-	/// @remarks This function detects creates a container of type `_OutputContainer` and uses a typical @c
-	/// std::back_inserter or `std::push_back_inserter` to fill in elements as it is written to. The result is
-	/// then returned, with the `.output` value put into the container.
-	template <typename _OutputContainer = void, typename _Input, typename _Encoding, typename _ErrorHandler,
-		typename _State>
-	constexpr auto decode_to(
-		_Input&& __input, _Encoding&& __encoding, _ErrorHandler&& __error_handler, _State& __state) {
+	/// @remarks The reservation only happens if the container has a `reserve` member function.
+	template <typename _OutputContainer = void, typename _SizingPolicy, typename _Input, typename _Encoding,
+		typename _ErrorHandler, typename _State,
+		::std::enable_if_t<is_output_sizing_policy_v<remove_cvref_t<_SizingPolicy>>>* = nullptr>
+	constexpr auto decode_to(_SizingPolicy&& __sizing, _Input&& __input, _Encoding&& __encoding,
+		_ErrorHandler&& __error_handler, _State& __state) {
 		using _UEncoding                = remove_cvref_t<_Encoding>;
 		using _UOutputContainer         = remove_cvref_t<_OutputContainer>;
 		using _OutputCodePoint          = code_point_t<_UEncoding>;
@@ -584,14 +644,14 @@ namespace ztd { namespace text {
 		if constexpr (_IsVoidContainer && _IsStringable) {
 			// prevent instantiation errors with basic_string by boxing it inside of an "if constexpr"
 			using _RealOutputContainer = ::std::basic_string<_OutputCodePoint>;
-			return __txt_detail::__decode_dispatch<false, false, _RealOutputContainer>(
+			return __txt_detail::__decode_dispatch<false, false, _RealOutputContainer>(__sizing,
 				::std::forward<_Input>(__input), ::std::forward<_Encoding>(__encoding),
 				::std::forward<_ErrorHandler>(__error_handler), __state);
 		}
 		else {
 			using _RealOutputContainer
 				= ::std::conditional_t<_IsVoidContainer, ::std::vector<_OutputCodePoint>, _OutputContainer>;
-			return __txt_detail::__decode_dispatch<false, false, _RealOutputContainer>(
+			return __txt_detail::__decode_dispatch<false, false, _RealOutputContainer>(__sizing,
 				::std::forward<_Input>(__input), ::std::forward<_Encoding>(__encoding),
 				::std::forward<_ErrorHandler>(__error_handler), __state);
 		}
@@ -599,11 +659,12 @@ namespace ztd { namespace text {
 
 	//////
 	/// @brief Converts the code units of the given `__input` view through the encoding to code points the
-	/// specified
-	/// `_OutputContainer` type.
+	/// specified `_OutputContainer` type, reserving room in it according to the given sizing policy.
 	///
 	/// @tparam _OutputContainer The container type to serialize data into.
 	///
+	/// @param[in] __sizing The output sizing policy that decides how much to reserve in the container before
+	/// decoding.
 	/// @param[in] __input An input_view to read code units from and use in the decode operation that will
 	/// produce code points.
 	/// @param[in] __encoding The encoding that will be used to decode the input's code points into
@@ -614,8 +675,11 @@ namespace ztd { namespace text {
 	/// @result A ztd::text::stateless_decode_result object whose output is of type `_OutputContainer`.
 	///
 	/// @remarks This function creates a `state` using ztd::text::make_decode_state.
-	template <typename _OutputContainer = void, typename _Input, typename _Encoding, typename _ErrorHandler>
-	constexpr auto decode_to(_Input&& __input, _Encoding&& __encoding, _ErrorHandler&& __error_handler) {
+	template <typename _OutputContainer = void, typename _SizingPolicy, typename _Input, typename _Encoding,
+		typename _ErrorHandler,
+		::std::enable_if_t<is_output_sizing_policy_v<remove_cvref_t<_SizingPolicy>>>* = nullptr>
+	constexpr auto decode_to(
+		_SizingPolicy&& __sizing, _Input&& __input, _Encoding&& __encoding, _ErrorHandler&& __error_handler) {
 		using _UEncoding                = remove_cvref_t<_Encoding>;
 		using _UOutputContainer         = remove_cvref_t<_OutputContainer>;
 		using _OutputCodePoint          = code_point_t<_UEncoding>;
@@ -627,19 +691,97 @@ namespace ztd { namespace text {
 		if constexpr (_IsVoidContainer && _IsStringable) {
 			// prevent instantiation errors with basic_string by boxing it inside of an "if constexpr"
 			using _RealOutputContainer = ::std::basic_string<_OutputCodePoint>;
-			return __txt_detail::__decode_dispatch<false, true, _RealOutputContainer>(
+			return __txt_detail::__decode_dispatch<false, true, _RealOutputContainer>(__sizing,
 				::std::forward<_Input>(__input), ::std::forward<_Encoding>(__encoding),
 				::std::forward<_ErrorHandler>(__error_handler), __state);
 		}
 		else {
 			using _RealOutputContainer
 				= ::std::conditional_t<_IsVoidContainer, ::std::vector<_OutputCodePoint>, _OutputContainer>;
-			return __txt_detail::__decode_dispatch<false, true, _RealOutputContainer>(
+			return __txt_detail::__decode_dispatch<false, true, _RealOutputContainer>(__sizing,
 				::std::forward<_Input>(__input), ::std::forward<_Encoding>(__encoding),
 				::std::forward<_ErrorHandler>(__error_handler), __state);
 		}
 	}
 
+	//////
+	/// @brief Converts the code units of the given `__input` view through the encoding to code points the
+	/// specified `_OutputContainer` type, reserving room in it according to the given sizing policy.
+	///
+	/// @tparam _OutputContainer The container type to serialize data into.
+	///
+	/// @param[in] __sizing The output sizing policy that decides how much to reserve in the container before
+	/// decoding.
+	/// @param[in] __input An input_view to read code units from and use in the decode operation that will
+	/// produce code points.
+	/// @param[in] __encoding The encoding that will be used to decode the input's code points into
+	/// output code units.
+	///
+	/// @result A ztd::text::stateless_decode_result object whose output is of type `_OutputContainer`.
+	///
+	/// @remarks This function creates a `handler` using ztd::text::default_handler_t, but marks it as careless.
+	template <typename _OutputContainer = void, typename _SizingPolicy, typename _Input, typename _Encoding,
+		::std::enable_if_t<is_output_sizing_policy_v<remove_cvref_t<_SizingPolicy>>>* = nullptr>
+	constexpr auto decode_to(_SizingPolicy&& __sizing, _Input&& __input, _Encoding&& __encoding) {
+		default_handler_t __handler {};
+		return ::ztd::text::decode_to<_OutputContainer>(
+			__sizing, ::std::forward<_Input>(__input), ::std::forward<_Encoding>(__encoding), __handler);
+	}
+
+	//////
+	/// @brief Converts the code units of the given `__input` view through the encoding to code points the
+	/// specified
+	/// `_OutputContainer` type.
+	///
+	/// @tparam _OutputContainer The container type to serialize data into.
+	///
+	/// @param[in] __input An input_view to read code units from and use in the decode operation that will
+	/// produce code points.
+	/// @param[in] __encoding The encoding that will be used to decode the input's code points into
+	/// output code units.
+	/// @param[in] __error_handler The error handlers for the from and to encodings,
+	/// respectively.
+	/// @param[in,out] __state A reference to the associated state for the `__encoding` 's decode step.
+	///
+	/// @result A ztd::text::decode_result object that contains references to `__state` and an output of type
+	/// `_OutputContainer`.
+	///
+	/// @remarks This function detects creates a container of type `_OutputContainer` and uses a typical @c
+	/// std::back_inserter or `std::push_back_inserter` to fill in elements as it is written to. The result is
+	/// then returned, with the `.output` value put into the container. Room is reserved in it with
+	/// ztd::text::default_output_sizing.
+	template <typename _OutputContainer = void, typename _Input, typename _Encoding, typename _ErrorHandler,
+		typename _State, ::std::enable_if_t<!is_output_sizing_policy_v<remove_cvref_t<_Input>>>* = nullptr>
+	constexpr auto decode_to(
+		_Input&& __input, _Encoding&& __encoding, _ErrorHandler&& __error_handler, _State& __state) {
+		return ::ztd::text::decode_to<_OutputContainer>(default_output_sizing, ::std::forward<_Input>(__input),
+			::std::forward<_Encoding>(__encoding), ::std::forward<_ErrorHandler>(__error_handler), __state);
+	}
+
+	//////
+	/// @brief Converts the code units of the given `__input` view through the encoding to code points the
+	/// specified
+	/// `_OutputContainer` type.
+	///
+	/// @tparam _OutputContainer The container type to serialize data into.
+	///
+	/// @param[in] __input An input_view to read code units from and use in the decode operation that will
+	/// produce code points.
+	/// @param[in] __encoding The encoding that will be used to decode the input's code points into
+	/// output code units.
+	/// @param[in] __error_handler The error handlers for the from and to encodings,
+	/// respectively.
+	///
+	/// @result A ztd::text::stateless_decode_result object whose output is of type `_OutputContainer`.
+	///
+	/// @remarks This function creates a `state` using ztd::text::make_decode_state.
+	template <typename _OutputContainer = void, typename _Input, typename _Encoding, typename _ErrorHandler,
+		::std::enable_if_t<!is_output_sizing_policy_v<remove_cvref_t<_Input>>>* = nullptr>
+	constexpr auto decode_to(_Input&& __input, _Encoding&& __encoding, _ErrorHandler&& __error_handler) {
+		return ::ztd::text::decode_to<_OutputContainer>(default_output_sizing, ::std::forward<_Input>(__input),
+			::std::forward<_Encoding>(__encoding), ::std::forward<_ErrorHandler>(__error_handler));
+	}
+
 	//////
 	/// @brief Converts the code units of the given `__input` view through the encoding to code points the
 	/// specified
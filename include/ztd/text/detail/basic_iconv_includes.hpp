@@ -8,13 +8,16 @@
 #include <ztd/text/encoding_error.hpp>
 #include <ztd/text/iconv_names.hpp>
 #include <ztd/text/detail/encoding_name.hpp>
+#include <ztd/text/detail/is_lossless.hpp>
 
 #include <ztd/idk/span.hpp>
 #include <ztd/idk/endian.hpp>
 #include <ztd/idk/type_traits.hpp>
 #include <ztd/idk/c_string_view.hpp>
+#include <ztd/idk/tag.hpp>
 #include <ztd/ranges/reconstruct.hpp>
 #include <ztd/ranges/adl.hpp>
+#include <ztd/ranges/range.hpp>
 #include <ztd/ranges/algorithm.hpp>
 
 #include <ztd/platform.hpp>
@@ -23,3 +26,4 @@
 #include <string>
 #include <string_view>
 #include <climits>
+#include <utility>
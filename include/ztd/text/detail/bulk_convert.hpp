@@ -0,0 +1,163 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#pragma once
+
+#ifndef ZTD_TEXT_DETAIL_BULK_CONVERT_HPP
+#define ZTD_TEXT_DETAIL_BULK_CONVERT_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/encoding_error.hpp>
+
+#include <ztd/ranges/adl.hpp>
+#include <ztd/ranges/range.hpp>
+#include <ztd/ranges/reconstruct.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include <ztd/prologue.hpp>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	namespace __txt_detail {
+		//////
+		/// @brief Whether or not `_Range` can be handed to a bulk conversion as a pointer and a size, with each
+		/// element taking up exactly `_UnitSize` bytes.
+		template <typename _Range, ::std::size_t _UnitSize>
+		inline constexpr bool __is_bulk_range_v = ::ztd::ranges::is_range_contiguous_range_v<_Range> // cf
+			&& ::ztd::ranges::is_sized_range_v<_Range>                                              // cf
+			&& sizeof(::ztd::ranges::range_value_type_t<_Range>) == _UnitSize                       // cf
+			&& ::std::is_trivially_copyable_v<::ztd::ranges::range_value_type_t<_Range>>;
+
+		template <typename _Range>
+		constexpr _Range __bulk_advance(_Range& __range, ::std::size_t __count) {
+			auto __first      = ::ztd::ranges::begin(__range);
+			using _Difference = ::ztd::ranges::range_difference_type_t<_Range>;
+			::ztd::ranges::iter_advance(__first, static_cast<_Difference>(__count));
+			return ::ztd::ranges::reconstruct(
+				::std::in_place_type<_Range>, ::std::move(__first), ::ztd::ranges::end(__range));
+		}
+
+		template <typename _Range>
+		auto* __bulk_data(_Range& __range) noexcept {
+			return ::std::addressof(*::ztd::ranges::begin(__range));
+		}
+
+		//////
+		/// @brief What a bulk conversion does with a state that still holds on to something once the input runs
+		/// out.
+		enum class __bulk_drain : unsigned char { __none = 0, __once = 1, __until_complete = 2 };
+
+		//////
+		/// @brief Converts as much of the input as possible into the output, handing whole spans to `__bulk_step`
+		/// and falling back to `__one_step` only where it stops.
+		///
+		/// @param[in] __input The input range.
+		/// @param[in] __output The output range.
+		/// @param[in] __error_handler The error handler passed to `__one_step`.
+		/// @param[in, out] __state The state passed to both `__bulk_step` and `__one_step`.
+		/// @param[in] __bulk_step Called as `__bulk_step(__working_input, __working_output, __state)` when both
+		/// ranges satisfy `__is_bulk_range_v`. It moves both ranges past what it read and wrote and returns
+		/// `true` to go around again, or `false` to have the next unit of information converted by `__one_step`.
+		/// @param[in] __one_step Called as `__one_step(__working_input, __working_output, __error_handler,
+		/// __state)` to convert one unit of information, invoking the error handler exactly as a one-at-a-time
+		/// conversion would.
+		///
+		/// @remarks Conversion stops at the first step that returns an error, and the returned result carries
+		/// the error count of every step taken. What happens once the input is empty is controlled by `_Drain`:
+		/// nothing, a single step to drain the state, or steps until `__state.is_complete()`.
+		template <::std::size_t _InputUnitSize, ::std::size_t _OutputUnitSize, __bulk_drain _Drain, typename _Input,
+			typename _Output, typename _ErrorHandler, typename _State, typename _BulkStep, typename _OneStep>
+		constexpr auto __bulk_convert(_Input&& __input, _Output&& __output, _ErrorHandler& __error_handler,
+			_State& __state, _BulkStep&& __bulk_step, _OneStep&& __one_step) {
+			using _InitialInput  = ::ztd::ranges::csubrange_for_t<::std::remove_reference_t<_Input>>;
+			using _InitialOutput = ::ztd::ranges::subrange_for_t<::std::remove_reference_t<_Output>>;
+			using _StepResult    = decltype(__one_step(::std::declval<_InitialInput>(),
+				   ::std::declval<_InitialOutput>(), __error_handler, __state));
+			using _WorkingInput  = decltype(::std::declval<_StepResult>().input);
+			using _WorkingOutput = decltype(::std::declval<_StepResult>().output);
+
+			_WorkingInput __working_input(::std::forward<_Input>(__input));
+			_WorkingOutput __working_output(::std::forward<_Output>(__output));
+			::std::size_t __error_count = 0;
+			[[maybe_unused]] bool __drained = false;
+			for (;;) {
+				if (::ztd::ranges::empty(__working_input)) {
+					if constexpr (_Drain == __bulk_drain::__none) {
+						break;
+					}
+					else {
+						if (__state.is_complete()) {
+							break;
+						}
+						if constexpr (_Drain == __bulk_drain::__once) {
+							if (__drained) {
+								break;
+							}
+							__drained = true;
+						}
+					}
+				}
+				else {
+					if constexpr (__is_bulk_range_v<_WorkingInput, _InputUnitSize> // cf
+						&& __is_bulk_range_v<_WorkingOutput, _OutputUnitSize>) {
+						if (__bulk_step(__working_input, __working_output, __state)) {
+							continue;
+						}
+					}
+				}
+				// the bulk step stopped on something (or could not be handed the ranges directly): take a single
+				// step, so the error handler sees exactly the sequence in question
+				auto __step_result = __one_step(
+					::std::move(__working_input), ::std::move(__working_output), __error_handler, __state);
+				__error_count += __step_result.error_count;
+				__working_input  = ::std::move(__step_result.input);
+				__working_output = ::std::move(__step_result.output);
+				if (__step_result.error_code != encoding_error::ok) {
+					return _StepResult(::std::move(__working_input), ::std::move(__working_output), __state,
+						__step_result.error_code, __error_count);
+				}
+			}
+			return _StepResult(::std::move(__working_input), ::std::move(__working_output), __state,
+				encoding_error::ok, __error_count);
+		}
+	} // namespace __txt_detail
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#include <ztd/epilogue.hpp>
+
+#endif
@@ -0,0 +1,175 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#pragma once
+
+#ifndef ZTD_TEXT_DETAIL_CHUNK_FILL_HPP
+#define ZTD_TEXT_DETAIL_CHUNK_FILL_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/assert.hpp>
+#include <ztd/text/encoding_error.hpp>
+#include <ztd/text/max_units.hpp>
+#include <ztd/text/decode.hpp>
+#include <ztd/text/is_ignorable_error_handler.hpp>
+#include <ztd/text/detail/progress_handler.hpp>
+#include <ztd/text/detail/transcode_routines.hpp>
+#include <ztd/text/detail/update_input.hpp>
+
+#include <ztd/idk/span.hpp>
+#include <ztd/idk/type_traits.hpp>
+#include <ztd/idk/to_address.hpp>
+#include <ztd/ranges/adl.hpp>
+#include <ztd/ranges/algorithm.hpp>
+#include <ztd/ranges/reconstruct.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+#include <ztd/prologue.hpp>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	namespace __txt_detail {
+
+		template <typename _Encoding, ::std::size_t _ChunkSize>
+		inline constexpr ::std::size_t __decode_chunk_size_v
+			= _ChunkSize < max_code_points_v<_Encoding> ? max_code_points_v<_Encoding> : _ChunkSize;
+
+		template <typename _Encoding, ::std::size_t _ChunkSize>
+		inline constexpr ::std::size_t __decode_chunk_buffer_size_v
+			= __decode_chunk_size_v<_Encoding, _ChunkSize> + max_code_points_v<_Encoding>;
+
+		template <typename _Pointer>
+		struct __chunk_fill_result {
+			_Pointer _M_last;
+			encoding_error _M_error_code;
+		};
+
+		template <typename _Input>
+		constexpr bool __chunk_input_is_empty(const _Input& __input) noexcept {
+			if constexpr (is_detected_v<ranges::detect_adl_empty, const _Input&>) {
+				return ::ztd::ranges::empty(__input);
+			}
+			else {
+				return ::ztd::ranges::begin(__input) == ::ztd::ranges::end(__input);
+			}
+		}
+
+		// Decodes into [__first, __chunk_last) with as few calls as possible, leaving __input just past whatever was
+		// consumed. [__chunk_last, __last) is headroom of at least max_code_points_v: a sequence that does not fit
+		// at the end of the chunk, or the output of the error handler, goes there so nothing is ever lost.
+		template <typename _Input, typename _Encoding, typename _ErrorHandler, typename _State, typename _CodePoint>
+		constexpr __chunk_fill_result<_CodePoint*> __decode_fill_chunk(_Input& __input, _Encoding& __encoding,
+			_ErrorHandler& __error_handler, _State& __state, _CodePoint* __first, _CodePoint* __chunk_last,
+			_CodePoint* __last) {
+			using _UEncoding     = remove_cvref_t<_Encoding>;
+			using _UErrorHandler = remove_cvref_t<_ErrorHandler>;
+			using _Output        = ::ztd::span<_CodePoint>;
+
+			ZTD_TEXT_ASSERT_MESSAGE_I_("there must be enough headroom for one full decode operation",
+				static_cast<::std::size_t>(__last - __chunk_last) >= max_code_points_v<_UEncoding>);
+
+			_CodePoint* __current = __first;
+			if constexpr (ranges::is_range_bidirectional_range_v<_Input> // cf
+				&& ::std::is_empty_v<remove_cvref_t<_State>>) {
+				// Bulk decode: out-of-output errors are an artifact of the chunk boundary, so they must never reach
+				// the user's handler. Everything else is milled through it afterwards, like the intermediate
+				// storage loops do. A sequence that was read but not written is put back for the next refill,
+				// which is only sound when there is no state that reading it could have changed.
+				using _IntermediateHandler
+					= __progress_handler<is_ignorable_error_handler_v<_UErrorHandler>, _UEncoding>;
+				_IntermediateHandler __intermediate_handler {};
+				while (__current != __chunk_last && !__txt_detail::__chunk_input_is_empty(__input)) {
+					auto __result = ::ztd::text::decode_into_raw(::std::move(__input), __encoding,
+						_Output(__current, __chunk_last), __intermediate_handler, __state);
+					__current     = __result.output.data();
+					if (__result.error_code == encoding_error::insufficient_output_space) {
+						if (__intermediate_handler._M_code_points_progress_size() != 0) {
+							// the sequence was read but only partially written: finish it in the headroom
+							auto __progress = __intermediate_handler._M_code_points_progress();
+							ranges::__rng_detail::__copy_n_unsafe(
+								::ztd::ranges::cbegin(__progress), __progress.size(), __current);
+							__current += __progress.size();
+							__input = __txt_detail::__update_input<_Input>(::std::move(__result.input));
+						}
+						else if (__intermediate_handler._M_code_units_progress_size() != 0) {
+							// the sequence was read but nothing was written: put it back for the next refill
+							__input = __txt_detail::__update_input<_Input>(
+								::ztd::ranges::reconstruct(::std::in_place_type<_Input>,
+								     ::ztd::ranges::iter_recede(::ztd::ranges::begin(__result.input),
+								          __intermediate_handler._M_code_units_progress_size()),
+								     ::ztd::ranges::end(__result.input)));
+						}
+						else {
+							__input = __txt_detail::__update_input<_Input>(::std::move(__result.input));
+						}
+						return { __current, encoding_error::ok };
+					}
+					if (__result.error_code != encoding_error::ok) {
+						// let the real error handler write into the headroom, if it needs to
+						__result.output     = _Output(__current, __last);
+						auto __error_result = __error_handler(__encoding, ::std::move(__result),
+							__intermediate_handler._M_code_units_progress(),
+							__intermediate_handler._M_code_points_progress());
+						__current           = ::ztd::to_address(::ztd::ranges::begin(__error_result.output));
+						__input = __txt_detail::__update_input<_Input>(::std::move(__error_result.input));
+						return { __current, __error_result.error_code };
+					}
+					__input = __txt_detail::__update_input<_Input>(::std::move(__result.input));
+				}
+			}
+			else {
+				// Input ranges cannot be rewound, and the state of stateful encodings cannot be taken back, so a
+				// sequence can never be put back: only ever start a decode operation when it is guaranteed to fit.
+				while (__current < __chunk_last && !__txt_detail::__chunk_input_is_empty(__input)) {
+					_Output __output(__current, __last);
+					auto __result = __basic_encode_or_decode_one<__consume::__no, __transaction::__decode>(
+						::std::move(__input), __encoding, __output, __error_handler, __state);
+					__current     = ::ztd::to_address(::ztd::ranges::begin(__result.output));
+					__input       = __txt_detail::__update_input<_Input>(::std::move(__result.input));
+					if (__result.error_code != encoding_error::ok) {
+						return { __current, __result.error_code };
+					}
+				}
+			}
+			return { __current, encoding_error::ok };
+		}
+
+	} // namespace __txt_detail
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#include <ztd/epilogue.hpp>
+
+#endif
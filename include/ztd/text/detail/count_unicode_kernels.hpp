@@ -0,0 +1,208 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#pragma once
+
+#ifndef ZTD_TEXT_DETAIL_COUNT_UNICODE_KERNELS_HPP
+#define ZTD_TEXT_DETAIL_COUNT_UNICODE_KERNELS_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/code_point.hpp>
+#include <ztd/text/code_unit.hpp>
+#include <ztd/text/count_result.hpp>
+#include <ztd/text/decode_one.hpp>
+#include <ztd/text/encoding_error.hpp>
+#include <ztd/text/max_units.hpp>
+#include <ztd/text/transcode_one.hpp>
+#include <ztd/text/detail/span_reconstruct.hpp>
+#include <ztd/text/detail/transcode_unicode_kernels.hpp>
+#include <ztd/text/detail/unicode_kernels.hpp>
+
+#include <ztd/idk/span.hpp>
+#include <ztd/idk/tag.hpp>
+#include <ztd/idk/type_traits.hpp>
+#include <ztd/ranges/adl.hpp>
+#include <ztd/ranges/range.hpp>
+#include <ztd/ranges/subrange.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include <ztd/prologue.hpp>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	namespace __txt_impl {
+		//////
+		/// @brief Counts the code points in UTF-8, UTF-16, or UTF-32 input in bulk, using the vectorized validation
+		/// and counting kernels selected for the running CPU when the input is contiguous.
+		///
+		/// @remarks Well-formed runs are counted directly from the kinds of code units they contain, without
+		/// decoding them. The first ill-formed or incomplete sequence is handed to ztd::text::decode_one_into_raw,
+		/// so the error handler, error counts, and the returned input position are exactly what
+		/// ztd::text::basic_count_as_decoded would produce. Non-contiguous ranges and constant evaluation fall back
+		/// to ztd::text::basic_count_as_decoded directly.
+		template <typename _Encoding, typename _Input, typename _EncodingArg, typename _ErrorHandler,
+			typename _State, ::std::enable_if_t<__txt_detail::__unicode_kernel_width_v<_Encoding> != 0>* = nullptr>
+		constexpr auto __text_count_as_decoded(::ztd::tag<_Encoding>, _Input&& __input, _EncodingArg&& __encoding,
+			_ErrorHandler&& __error_handler, _State& __state) {
+			using _WorkingInput            = ::ztd::ranges::subrange_for_t<_Input>;
+			constexpr ::std::size_t _Width = __txt_detail::__unicode_kernel_width_v<_Encoding>;
+
+			if constexpr (__txt_detail::__is_unicode_kernel_range_v<_WorkingInput, _Width>) {
+#if ZTD_IS_ON(ZTD_STD_LIBRARY_IS_CONSTANT_EVALUATED)
+				if (!::std::is_constant_evaluated())
+#endif
+				{
+					using _Result    = count_result<_WorkingInput, _State>;
+					using _CodePoint = code_point_t<_Encoding>;
+
+					_WorkingInput __working_input(::std::forward<_Input>(__input));
+					_CodePoint __intermediate_storage[max_code_points_v<_Encoding>] {};
+					::ztd::span<_CodePoint, max_code_points_v<_Encoding>> __intermediate(__intermediate_storage);
+					::std::size_t __code_point_count = 0;
+					::std::size_t __error_count      = 0;
+					for (;;) {
+						if (::ztd::ranges::empty(__working_input)) {
+							break;
+						}
+						const auto __input_data = __txt_detail::__unicode_kernel_data(__working_input);
+						const ::std::size_t __valid_size = __txt_detail::__unicode_validate_kernel<_Width>(
+							__input_data, static_cast<::std::size_t>(::ztd::ranges::size(__working_input)));
+						__code_point_count
+							+= __txt_detail::__unicode_count_kernel<_Width, 32>(__input_data, __valid_size);
+						__working_input = __txt_detail::__unicode_kernel_advance(__working_input, __valid_size);
+						if (::ztd::ranges::empty(__working_input)) {
+							break;
+						}
+						// the validator stopped on an ill-formed or incomplete sequence: let the error
+						// handler deal with exactly that sequence, then resume
+						auto __result = ::ztd::text::decode_one_into_raw(
+							::std::move(__working_input), __encoding, __intermediate, __error_handler, __state);
+						__error_count += __result.error_count;
+						if (__result.error_code != encoding_error::ok) {
+							return _Result(::std::move(__result.input), __code_point_count, __state,
+								__result.error_code, __error_count);
+						}
+						__code_point_count += static_cast<::std::size_t>(::ztd::ranges::distance(
+							::ztd::ranges::begin(__intermediate), ::ztd::ranges::begin(__result.output)));
+						__working_input = ::std::move(__result.input);
+					}
+					return _Result(::std::move(__working_input), __code_point_count, __state, encoding_error::ok,
+						__error_count);
+				}
+			}
+			return basic_count_as_decoded(::std::forward<_Input>(__input), ::std::forward<_EncodingArg>(__encoding),
+				::std::forward<_ErrorHandler>(__error_handler), __state);
+		}
+
+		//////
+		/// @brief Counts the code units that transcoding between UTF-8, UTF-16, and UTF-32 produces, in bulk,
+		/// using the vectorized validation and counting kernels selected for the running CPU when the input is
+		/// contiguous.
+		///
+		/// @remarks Well-formed runs are counted directly from the kinds of code units they contain, without
+		/// transcoding them. The first ill-formed or incomplete sequence is handed to
+		/// ztd::text::transcode_one_into_raw, so error handlers, error counts, and the returned input position are
+		/// exactly what ztd::text::basic_count_as_transcoded would produce. Non-contiguous ranges and constant
+		/// evaluation fall back to ztd::text::basic_count_as_transcoded directly.
+		template <typename _FromEncoding, typename _ToEncoding, typename _Input, typename _FromEncodingArg,
+			typename _ToEncodingArg, typename _FromErrorHandler, typename _ToErrorHandler, typename _FromState,
+			typename _ToState, typename _Pivot,
+			::std::enable_if_t<__txt_detail::__unicode_kernel_width_v<_FromEncoding> != 0 // cf
+			     && __txt_detail::__unicode_kernel_width_v<_ToEncoding> != 0>* = nullptr>
+		constexpr auto __text_count_as_transcoded(::ztd::tag<_FromEncoding, _ToEncoding>, _Input&& __input,
+			_FromEncodingArg&& __from_encoding, _ToEncodingArg&& __to_encoding,
+			_FromErrorHandler&& __from_error_handler, _ToErrorHandler&& __to_error_handler, _FromState& __from_state,
+			_ToState& __to_state, _Pivot&& __pivot) {
+			using _WorkingInput = ::ztd::ranges::subrange_for_t<__txt_detail::__span_reconstruct_t<_Input, _Input>>;
+			constexpr ::std::size_t _FromWidth = __txt_detail::__unicode_kernel_width_v<_FromEncoding>;
+			constexpr ::std::size_t _ToWidth   = __txt_detail::__unicode_kernel_width_v<_ToEncoding>;
+
+			if constexpr (__txt_detail::__is_unicode_kernel_range_v<_WorkingInput, _FromWidth>) {
+#if ZTD_IS_ON(ZTD_STD_LIBRARY_IS_CONSTANT_EVALUATED)
+				if (!::std::is_constant_evaluated())
+#endif
+				{
+					using _Result   = count_transcode_result<_WorkingInput, _FromState, _ToState>;
+					using _CodeUnit = code_unit_t<_ToEncoding>;
+					constexpr ::std::size_t __output_max = max_transcode_code_units_v<_FromEncoding, _ToEncoding>;
+
+					_WorkingInput __working_input(
+						__txt_detail::__span_reconstruct<_Input>(::std::forward<_Input>(__input)));
+					_CodeUnit __output_storage[__output_max] {};
+					::ztd::span<_CodeUnit, __output_max> __output(__output_storage);
+					::std::size_t __code_unit_count = 0;
+					::std::size_t __error_count     = 0;
+					for (;;) {
+						if (::ztd::ranges::empty(__working_input)) {
+							break;
+						}
+						const auto __input_data = __txt_detail::__unicode_kernel_data(__working_input);
+						const ::std::size_t __valid_size = __txt_detail::__unicode_validate_kernel<_FromWidth>(
+							__input_data, static_cast<::std::size_t>(::ztd::ranges::size(__working_input)));
+						__code_unit_count += __txt_detail::__unicode_count_kernel<_FromWidth, _ToWidth>(
+							__input_data, __valid_size);
+						__working_input = __txt_detail::__unicode_kernel_advance(__working_input, __valid_size);
+						if (::ztd::ranges::empty(__working_input)) {
+							break;
+						}
+						auto __result = ::ztd::text::transcode_one_into_raw(::std::move(__working_input),
+							__from_encoding, __output, __to_encoding, __from_error_handler, __to_error_handler,
+							__from_state, __to_state, __pivot);
+						if (__result.error_code != encoding_error::ok) {
+							return _Result(::std::move(__result.input), __code_unit_count, __result.from_state,
+								__result.to_state, __result.error_code, __error_count);
+						}
+						__code_unit_count += static_cast<::std::size_t>(__result.output.data() - __output.data());
+						__error_count += __result.error_count;
+						__working_input = ::std::move(__result.input);
+					}
+					return _Result(::std::move(__working_input), __code_unit_count, __from_state, __to_state,
+						encoding_error::ok, __error_count);
+				}
+			}
+			return basic_count_as_transcoded(::std::forward<_Input>(__input),
+				::std::forward<_FromEncodingArg>(__from_encoding), ::std::forward<_ToEncodingArg>(__to_encoding),
+				::std::forward<_FromErrorHandler>(__from_error_handler),
+				::std::forward<_ToErrorHandler>(__to_error_handler), __from_state, __to_state,
+				::std::forward<_Pivot>(__pivot));
+		}
+	} // namespace __txt_impl
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#include <ztd/epilogue.hpp>
+
+#endif
@@ -337,11 +337,11 @@ namespace ztd { namespace text {
 				ztd::to_underlying(encoding_error::ok) | (ztd::to_underlying(encoding_error::ok) << 2));
 
 			constexpr encoding_error _M_from_error() const noexcept {
-				return static_cast<encoding_error>((_M_error_code & (0x02 << 0)) >> 0);
+				return static_cast<encoding_error>((_M_error_code & (0x03 << 0)) >> 0);
 			}
 
 			constexpr encoding_error _M_to_error() const noexcept {
-				return static_cast<encoding_error>((_M_error_code & (0x02 << 2)) >> 2);
+				return static_cast<encoding_error>((_M_error_code & (0x03 << 2)) >> 2);
 			}
 
 			constexpr void _M_set_errors(encoding_error __from_error, encoding_error __to_error) noexcept {
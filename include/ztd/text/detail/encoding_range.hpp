@@ -161,8 +161,9 @@ namespace ztd { namespace text {
 			     ::std::declval<_Encoding>(), ::std::declval<_Handler>(), ::std::declval<_State&>()));
 
 		template <typename _Input, typename _Encoding, typename _Handler, typename _State>
-		using __detect_adl_internal_text_count_as_encoded = decltype(__text_count_as_encoded(::std::declval<_Input>(),
-			::std::declval<_Encoding>(), ::std::declval<_Handler>(), ::std::declval<_State&>()));
+		using __detect_adl_internal_text_count_as_encoded
+			= decltype(__text_count_as_encoded(::ztd::tag<remove_cvref_t<_Encoding>> {}, ::std::declval<_Input>(),
+			     ::std::declval<_Encoding>(), ::std::declval<_Handler>(), ::std::declval<_State&>()));
 
 		// counting: transcode code units
 		template <typename _Input, typename _FromEncoding, typename _ToEncoding, typename _FromHandler,
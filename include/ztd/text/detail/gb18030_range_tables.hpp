@@ -0,0 +1,412 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#pragma once
+
+#ifndef ZTD_TEXT_DETAIL_GB18030_RANGE_TABLES_HPP
+#define ZTD_TEXT_DETAIL_GB18030_RANGE_TABLES_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/detail/unicode_kernels.hpp>
+#include <ztd/text/detail/multibyte_reverse_tables.hpp>
+
+#include <ztd/idk/charN_t.hpp>
+#include <ztd/encoding_tables/table_types.hpp>
+#include <ztd/encoding_tables/gb18030.tables.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+
+#include <ztd/prologue.hpp>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	namespace __txt_detail {
+		//////
+		/// @brief The most linear runs a GB18030 range table holds. The four-byte Basic Multilingual Plane area has
+		/// a little over 200 of them; a lookup that produces more leaves the table unavailable.
+		inline constexpr ::std::size_t __gb18030_range_capacity = 256;
+
+		//////
+		/// @brief One past the last four-byte index that maps into the Basic Multilingual Plane.
+		inline constexpr ::std::size_t __gb18030_bmp_index_limit = 39420;
+
+		//////
+		/// @brief The four-byte index of U+10000; the supplementary planes follow it linearly.
+		inline constexpr ::std::size_t __gb18030_supplementary_index = 189000;
+
+		//////
+		/// @brief A table of runs where consecutive four-byte indices map to consecutive code points, kept both in
+		/// index order (for decoding) and in code point order (for encoding).
+		///
+		/// @remarks Everything outside of a run still goes to the original lookups, so results never differ from
+		/// them. The whole table is a little under 5 KiB.
+		struct __gb18030_range_table {
+			::std::uint_least32_t _M_index_starts[__gb18030_range_capacity];
+			::std::uint_least32_t _M_code_points[__gb18030_range_capacity];
+			::std::uint_least32_t _M_sizes[__gb18030_range_capacity];
+			::std::uint_least32_t _M_code_point_starts[__gb18030_range_capacity];
+			::std::uint_least16_t _M_code_point_order[__gb18030_range_capacity];
+			::std::size_t _M_size;
+			bool _M_index_available;
+			bool _M_code_point_available;
+		};
+
+		//////
+		/// @brief The runs last used by a bulk loop. Most text stays inside one run, so checking it first avoids
+		/// the search almost every time.
+		struct __gb18030_range_cursor {
+			::std::size_t _M_index_run;
+			::std::size_t _M_code_point_run;
+		};
+
+		//////
+		/// @brief Finds the last of `__size` ascending keys that is not greater than `__key`, without a branch per
+		/// step: the comparison only picks which half the base moves to. Returns 0 if every key is greater.
+		inline ::std::size_t __gb18030_last_not_greater(
+			const ::std::uint_least32_t* __keys, ::std::size_t __size, ::std::size_t __key) noexcept {
+			const ::std::uint_least32_t* __base = __keys;
+			while (__size > 1) {
+				const ::std::size_t __half = __size / 2;
+				const bool __upper         = static_cast<::std::size_t>(__base[__half]) <= __key;
+				__base                     = __upper ? __base + __half : __base;
+				__size -= __half;
+			}
+			return static_cast<::std::size_t>(__base - __keys);
+		}
+
+		template <::ztd::et::basic_lookup_index_to_code_point_function* _LookupCodePoint,
+			::ztd::et::basic_lookup_code_point_to_index_function* _LookupIndex>
+		__gb18030_range_table __make_gb18030_range_table() noexcept {
+			__gb18030_range_table __table {};
+			bool __overflowed = false;
+			auto __add_run
+				= [&](::std::size_t __index, ::std::uint_least32_t __code_point, ::std::uint_least32_t __run_size) {
+					if (__table._M_size == __gb18030_range_capacity) {
+						__overflowed = true;
+						return;
+					}
+					__table._M_index_starts[__table._M_size] = static_cast<::std::uint_least32_t>(__index);
+					__table._M_code_points[__table._M_size]  = __code_point;
+					__table._M_sizes[__table._M_size]        = __run_size;
+					++__table._M_size;
+				};
+			for (::std::size_t __index = 0; __index < __gb18030_bmp_index_limit; ++__index) {
+				const ::std::optional<::std::uint_least32_t> __maybe_code = _LookupCodePoint(__index);
+				if (!__maybe_code) {
+					continue;
+				}
+				if (__table._M_size != 0) {
+					const ::std::size_t __last = __table._M_size - 1;
+					if (__table._M_index_starts[__last] + __table._M_sizes[__last] == __index
+						&& __table._M_code_points[__last] + __table._M_sizes[__last] == *__maybe_code) {
+						++__table._M_sizes[__last];
+						continue;
+					}
+				}
+				__add_run(__index, *__maybe_code, 1);
+			}
+			// the supplementary planes are one run; take it only if the lookup agrees at both of its ends
+			constexpr ::std::uint_least32_t __supplementary_size = 0x100000;
+			const ::std::optional<::std::uint_least32_t> __supplementary_first
+				= _LookupCodePoint(__gb18030_supplementary_index);
+			const ::std::optional<::std::uint_least32_t> __supplementary_last
+				= _LookupCodePoint(__gb18030_supplementary_index + __supplementary_size - 1);
+			if (__supplementary_first && *__supplementary_first == 0x10000 && __supplementary_last
+				&& *__supplementary_last == 0x10FFFF) {
+				__add_run(__gb18030_supplementary_index, 0x10000, __supplementary_size);
+			}
+			if (__overflowed || __table._M_size == 0) {
+				return __table;
+			}
+			__table._M_index_available = true;
+
+			// code point order: the runs are almost sorted already, so an insertion sort is plenty
+			bool __reversible = true;
+			for (::std::size_t __run = 0; __run < __table._M_size; ++__run) {
+				const ::std::uint_least32_t __first_code_point = __table._M_code_points[__run];
+				const ::std::uint_least32_t __last_code_point  = __first_code_point + __table._M_sizes[__run] - 1;
+				const ::std::optional<::std::size_t> __first_index = _LookupIndex(__first_code_point);
+				const ::std::optional<::std::size_t> __last_index  = _LookupIndex(__last_code_point);
+				if (!__first_index || *__first_index != __table._M_index_starts[__run] || !__last_index
+					|| *__last_index != __table._M_index_starts[__run] + __table._M_sizes[__run] - 1) {
+					__reversible = false;
+				}
+				::std::size_t __position = __run;
+				for (; __position > 0; --__position) {
+					if (__table._M_code_point_starts[__position - 1] < __first_code_point) {
+						break;
+					}
+					__table._M_code_point_starts[__position] = __table._M_code_point_starts[__position - 1];
+					__table._M_code_point_order[__position]  = __table._M_code_point_order[__position - 1];
+				}
+				__table._M_code_point_starts[__position] = __first_code_point;
+				__table._M_code_point_order[__position]  = static_cast<::std::uint_least16_t>(__run);
+			}
+			for (::std::size_t __position = 1; __position < __table._M_size; ++__position) {
+				const ::std::size_t __previous_run = __table._M_code_point_order[__position - 1];
+				if (__table._M_code_point_starts[__position - 1] + __table._M_sizes[__previous_run]
+					> __table._M_code_point_starts[__position]) {
+					// two runs share code points, so the search decides which index wins
+					__reversible = false;
+				}
+			}
+			__table._M_code_point_available = __reversible;
+			return __table;
+		}
+
+		//////
+		/// @brief The range table for the given lookups, built the first time it is asked for.
+		template <::ztd::et::basic_lookup_index_to_code_point_function* _LookupCodePoint,
+			::ztd::et::basic_lookup_code_point_to_index_function* _LookupIndex>
+		const __gb18030_range_table& __gb18030_range_table_instance() noexcept {
+			static const __gb18030_range_table __table
+				= __make_gb18030_range_table<_LookupCodePoint, _LookupIndex>();
+			return __table;
+		}
+
+		//////
+		/// @brief Looks up the code point for a four-byte index, trying the cursor's run before searching. The
+		/// original lookup is used during constant evaluation and for anything outside of the runs.
+		template <::ztd::et::basic_lookup_index_to_code_point_function* _LookupCodePoint,
+			::ztd::et::basic_lookup_code_point_to_index_function* _LookupIndex>
+		constexpr ::std::optional<::std::uint_least32_t> __gb18030_range_index_to_code_point(
+			::std::size_t __index, __gb18030_range_cursor& __cursor) noexcept {
+#if ZTD_IS_ON(ZTD_STD_LIBRARY_IS_CONSTANT_EVALUATED)
+			if (!::std::is_constant_evaluated())
+#endif
+			{
+				const __gb18030_range_table& __table
+					= __gb18030_range_table_instance<_LookupCodePoint, _LookupIndex>();
+				if (__table._M_index_available) {
+					::std::size_t __run = __cursor._M_index_run;
+					if (__index - __table._M_index_starts[__run] >= __table._M_sizes[__run]) {
+						__run = __gb18030_last_not_greater(__table._M_index_starts, __table._M_size, __index);
+						if (__index < __table._M_index_starts[__run]
+							|| __index - __table._M_index_starts[__run] >= __table._M_sizes[__run]) {
+							return _LookupCodePoint(__index);
+						}
+						__cursor._M_index_run = __run;
+					}
+					return static_cast<::std::uint_least32_t>(
+						__table._M_code_points[__run] + (__index - __table._M_index_starts[__run]));
+				}
+			}
+			return _LookupCodePoint(__index);
+		}
+
+		//////
+		/// @brief Looks up the four-byte index for a code point, trying the cursor's run before searching. The
+		/// original lookup is used during constant evaluation and for anything outside of the runs.
+		template <::ztd::et::basic_lookup_index_to_code_point_function* _LookupCodePoint,
+			::ztd::et::basic_lookup_code_point_to_index_function* _LookupIndex>
+		constexpr ::std::optional<::std::size_t> __gb18030_range_code_point_to_index(
+			::std::uint_least32_t __code_point, __gb18030_range_cursor& __cursor) noexcept {
+#if ZTD_IS_ON(ZTD_STD_LIBRARY_IS_CONSTANT_EVALUATED)
+			if (!::std::is_constant_evaluated())
+#endif
+			{
+				const __gb18030_range_table& __table
+					= __gb18030_range_table_instance<_LookupCodePoint, _LookupIndex>();
+				if (__table._M_code_point_available) {
+					::std::size_t __position = __cursor._M_code_point_run;
+					::std::size_t __run      = __table._M_code_point_order[__position];
+					if (__code_point - __table._M_code_point_starts[__position] >= __table._M_sizes[__run]) {
+						__position = __gb18030_last_not_greater(
+							__table._M_code_point_starts, __table._M_size, __code_point);
+						__run = __table._M_code_point_order[__position];
+						const ::std::uint_least32_t __start = __table._M_code_point_starts[__position];
+						if (__code_point < __start || __code_point - __start >= __table._M_sizes[__run]) {
+							return _LookupIndex(__code_point);
+						}
+						__cursor._M_code_point_run = __position;
+					}
+					return static_cast<::std::size_t>(__table._M_index_starts[__run])
+						+ (__code_point - __table._M_code_point_starts[__position]);
+				}
+			}
+			return _LookupIndex(__code_point);
+		}
+
+		//////
+		/// @brief The four-byte index → code point lookup ztd::text::basic_gb18030 uses.
+		constexpr ::std::optional<::std::uint_least32_t> __gb18030_four_byte_code_point(
+			::std::size_t __index, __gb18030_range_cursor& __cursor) noexcept {
+			return __gb18030_range_index_to_code_point<&::ztd::et::gb18030_ranges_index_to_code_point,
+				&::ztd::et::gb18030_ranges_code_point_to_index>(__index, __cursor);
+		}
+
+		//////
+		/// @brief The code point → four-byte index lookup ztd::text::basic_gb18030 uses.
+		constexpr ::std::optional<::std::size_t> __gb18030_four_byte_index(
+			::std::uint_least32_t __code_point, __gb18030_range_cursor& __cursor) noexcept {
+			return __gb18030_range_code_point_to_index<&::ztd::et::gb18030_ranges_index_to_code_point,
+				&::ztd::et::gb18030_ranges_code_point_to_index>(__code_point, __cursor);
+		}
+
+		//////
+		/// @brief The code point → two-byte index lookup GBK and GB18030 use.
+		constexpr ::std::optional<::std::size_t> __gb18030_two_byte_index(
+			::std::uint_least32_t __code_point) noexcept {
+			return __multibyte_code_point_to_index<126 * 190, &::ztd::et::gb18030_index_to_code_point,
+				&::ztd::et::gb18030_code_point_to_index>(__code_point);
+		}
+
+		//////
+		/// @brief Decodes as many complete, valid GBK or GB18030 sequences as possible from a contiguous input,
+		/// stopping before the first one that is incomplete, invalid, or does not fit in the output. The iterators
+		/// are left at the stopping point.
+		template <bool _IsGbk, typename _CodeUnit, typename _CodePoint, typename _InIt, typename _InLast,
+			typename _OutIt, typename _OutLast>
+		constexpr void __gb18030_decode_bulk(_InIt& __in_it, const _InLast& __in_last, _OutIt& __out_it,
+			const _OutLast& __out_last, __gb18030_range_cursor& __cursor) noexcept {
+			while (__in_it != __in_last && __out_it != __out_last) {
+				const ::std::size_t __available = static_cast<::std::size_t>(__in_last - __in_it);
+				const unsigned char __unit0     = static_cast<unsigned char>(static_cast<_CodeUnit>(__in_it[0]));
+				::std::optional<::std::uint_least32_t> __maybe_code;
+				::std::size_t __read = 1;
+				if (__unit0 <= 0x7F) {
+					__maybe_code = __unit0;
+				}
+				else if (__unit0 == 0x80) {
+					__maybe_code = 0x20AC;
+				}
+				else if (__unit0 == 0xFF || __available < 2) {
+					return;
+				}
+				else {
+					const unsigned char __unit1 = static_cast<unsigned char>(static_cast<_CodeUnit>(__in_it[1]));
+					if (__unit1 >= 0x30 && __unit1 <= 0x39) {
+						if constexpr (_IsGbk) {
+							return;
+						}
+						else {
+							if (__available < 4) {
+								return;
+							}
+							const unsigned char __unit2
+								= static_cast<unsigned char>(static_cast<_CodeUnit>(__in_it[2]));
+							const unsigned char __unit3
+								= static_cast<unsigned char>(static_cast<_CodeUnit>(__in_it[3]));
+							if (__unit2 < 0x81 || __unit2 > 0xFE || __unit3 < 0x30 || __unit3 > 0x39) {
+								return;
+							}
+							const ::std::size_t __lookup_index = ((__unit0 - 0x81) * (10 * 126 * 10))
+								+ ((__unit1 - 0x30) * (10 * 126)) + ((__unit2 - 0x81) * 10) + (__unit3 - 0x30);
+							__maybe_code = __gb18030_four_byte_code_point(__lookup_index, __cursor);
+							__read       = 4;
+						}
+					}
+					else if ((__unit1 >= 0x40 && __unit1 <= 0x7E) || (__unit1 >= 0x80 && __unit1 <= 0xFE)) {
+						const ::std::size_t __unit1_offset = __unit1 < 0x7F ? 0x40 : 0x41;
+						const ::std::size_t __lookup_index
+							= ((__unit0 - 0x81) * 190) + (__unit1 - __unit1_offset);
+						__maybe_code = ::ztd::et::gb18030_index_to_code_point(__lookup_index);
+						__read       = 2;
+					}
+					else {
+						return;
+					}
+				}
+				if (!__maybe_code) {
+					return;
+				}
+				*__out_it = static_cast<_CodePoint>(*__maybe_code);
+				++__out_it;
+				__in_it += __read;
+			}
+		}
+
+		//////
+		/// @brief Encodes as many code points as possible into a contiguous output, stopping before the first one
+		/// that cannot be encoded (or that GBK and GB18030 always send to the error handler) or that does not fit.
+		/// The iterators are left at the stopping point.
+		template <bool _IsGbk, typename _CodeUnit, typename _InIt, typename _InLast, typename _OutIt,
+			typename _OutLast>
+		constexpr void __gb18030_encode_bulk(_InIt& __in_it, const _InLast& __in_last, _OutIt& __out_it,
+			const _OutLast& __out_last, __gb18030_range_cursor& __cursor) noexcept {
+			for (; __in_it != __in_last; ++__in_it) {
+				const ::std::uint_least32_t __code_point = static_cast<ztd_char32_t>(*__in_it);
+				const ::std::size_t __available          = static_cast<::std::size_t>(__out_last - __out_it);
+				unsigned char __units[4]                 = {};
+				::std::size_t __written                  = 1;
+				if (__code_point <= 0x7F || (_IsGbk && __code_point == 0x80)) {
+					__units[0] = static_cast<unsigned char>(__code_point);
+				}
+				else if (__code_point == 0xE5E5) {
+					return;
+				}
+				else if (const ::std::optional<::std::size_t> __maybe_two_byte_index
+					= __gb18030_two_byte_index(__code_point)) {
+					const ::std::size_t __trail = *__maybe_two_byte_index % 190;
+					__units[0] = static_cast<unsigned char>((*__maybe_two_byte_index / 190) + 0x81);
+					__units[1] = static_cast<unsigned char>(__trail + (__trail < 0x3F ? 0x40 : 0x41));
+					__written  = 2;
+				}
+				else {
+					if constexpr (_IsGbk) {
+						return;
+					}
+					else {
+						const ::std::optional<::std::size_t> __maybe_index
+							= __gb18030_four_byte_index(__code_point, __cursor);
+						if (!__maybe_index) {
+							return;
+						}
+						const ::std::size_t __index = *__maybe_index;
+						__units[0] = static_cast<unsigned char>((__index / (10 * 126 * 10)) + 0x81);
+						const ::std::size_t __index1 = __index % (10 * 126 * 10);
+						__units[1] = static_cast<unsigned char>((__index1 / (10 * 126)) + 0x30);
+						__units[2] = static_cast<unsigned char>(((__index1 % (10 * 126)) / 10) + 0x81);
+						__units[3] = static_cast<unsigned char>((__index % 10) + 0x30);
+						__written  = 4;
+					}
+				}
+				if (__available < __written) {
+					return;
+				}
+				for (::std::size_t __unit_index = 0; __unit_index < __written; ++__unit_index) {
+					*__out_it = static_cast<_CodeUnit>(__units[__unit_index]);
+					++__out_it;
+				}
+			}
+		}
+	} // namespace __txt_detail
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#include <ztd/epilogue.hpp>
+
+#endif
@@ -0,0 +1,240 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#pragma once
+
+#ifndef ZTD_TEXT_DETAIL_ICONV_DESCRIPTOR_CACHE_HPP
+#define ZTD_TEXT_DETAIL_ICONV_DESCRIPTOR_CACHE_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/assert.hpp>
+
+#include <ztd/platform.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <ztd/prologue.hpp>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	//////
+	/// @brief A snapshot of how well the iconv conversion descriptor cache is doing.
+	struct iconv_descriptor_cache_statistics {
+		//////
+		/// @brief The number of times a ztd::text::basic_iconv state was handed an already-open descriptor.
+		::std::size_t hits;
+		//////
+		/// @brief The number of times a ztd::text::basic_iconv state had to open a brand new descriptor.
+		::std::size_t misses;
+		//////
+		/// @brief The number of open descriptors currently sitting in the cache, waiting to be reused.
+		::std::size_t pooled;
+	};
+
+#if ZTD_IS_ON(ZTD_PLATFORM_LIBICONV)
+	namespace __txt_detail {
+		class __iconv_descriptor_cache {
+		public:
+			inline static constexpr ::std::size_t _PoolSize = ZTD_TEXT_ICONV_DESCRIPTOR_CACHE_SIZE_I_;
+
+			// One per (to, from) pair that has ever been asked for. Pools are never removed once created, so
+			// states can keep a pointer to theirs rather than a copy of both names.
+			struct __pool {
+				::std::string _M_to_name;
+				::std::string _M_from_name;
+				::std::vector<::ztd::plat::icnv::descriptor> _M_descriptors;
+			};
+
+			static __iconv_descriptor_cache& _S_instance() noexcept {
+				// deliberately never destroyed: states with static storage duration may give their descriptors
+				// back while the program is exiting
+				alignas(__iconv_descriptor_cache) static unsigned char __storage[sizeof(__iconv_descriptor_cache)];
+				static __iconv_descriptor_cache* __instance = new (static_cast<void*>(__storage))
+					__iconv_descriptor_cache();
+				return *__instance;
+			}
+
+			// Anything that goes wrong with the cache itself (no memory for a new pool, a mutex that cannot be
+			// locked) is reported the same way as iconv failing to open the conversion, which every state already
+			// handles; or, when giving a descriptor back, by closing it rather than pooling it.
+
+			::ztd::plat::icnv::descriptor _M_acquire(::std::string_view __to_name, ::std::string_view __from_name,
+				__pool*& __target_pool) noexcept {
+				try {
+					::std::lock_guard<::std::mutex> __lock(this->_M_mutex);
+					__target_pool = ::std::addressof(this->_M_find_or_add(__to_name, __from_name));
+				}
+				catch (...) {
+					__target_pool = nullptr;
+					return ::ztd::plat::icnv::failure_descriptor;
+				}
+				return this->_M_acquire(__target_pool);
+			}
+
+			::ztd::plat::icnv::descriptor _M_acquire(__pool* __source_pool) noexcept {
+				if (__source_pool == nullptr) {
+					return ::ztd::plat::icnv::failure_descriptor;
+				}
+				try {
+					::std::lock_guard<::std::mutex> __lock(this->_M_mutex);
+					if (!__source_pool->_M_descriptors.empty()) {
+						::ztd::plat::icnv::descriptor __desc = __source_pool->_M_descriptors.back();
+						__source_pool->_M_descriptors.pop_back();
+						this->_M_hits.fetch_add(1, ::std::memory_order_relaxed);
+						return __desc;
+					}
+				}
+				catch (...) {
+					// fall through and open a fresh descriptor instead
+				}
+				this->_M_misses.fetch_add(1, ::std::memory_order_relaxed);
+				// the names never change once a pool exists, so they can be read without the lock
+				return ::ztd::plat::icnv::functions().open(
+					__source_pool->_M_to_name.c_str(), __source_pool->_M_from_name.c_str());
+			}
+
+			void _M_release(__pool* __source_pool, ::ztd::plat::icnv::descriptor __desc) noexcept {
+				if (!::ztd::plat::icnv::descriptor_is_valid(__desc)) {
+					return;
+				}
+				if (__source_pool != nullptr) {
+					try {
+						::std::lock_guard<::std::mutex> __lock(this->_M_mutex);
+						if (__source_pool->_M_descriptors.size() < _PoolSize) {
+							__source_pool->_M_descriptors.push_back(__desc);
+							return;
+						}
+					}
+					catch (...) {
+						// fall through and close it instead
+					}
+				}
+				int __close_result = ::ztd::plat::icnv::functions().close(__desc);
+				ZTD_TEXT_ASSERT(__close_result == ::ztd::plat::icnv::close_success);
+				(void)__close_result;
+			}
+
+			iconv_descriptor_cache_statistics _M_statistics() noexcept {
+				::std::size_t __pooled = 0;
+				try {
+					::std::lock_guard<::std::mutex> __lock(this->_M_mutex);
+					for (const auto& __source_pool : this->_M_pools) {
+						__pooled += __source_pool->_M_descriptors.size();
+					}
+				}
+				catch (...) {
+					__pooled = 0;
+				}
+				return { this->_M_hits.load(::std::memory_order_relaxed),
+					this->_M_misses.load(::std::memory_order_relaxed), __pooled };
+			}
+
+			void _M_clear() noexcept {
+				const auto& __iconv_functions = ::ztd::plat::icnv::functions();
+				try {
+					::std::lock_guard<::std::mutex> __lock(this->_M_mutex);
+					for (auto& __source_pool : this->_M_pools) {
+						for (::ztd::plat::icnv::descriptor __desc : __source_pool->_M_descriptors) {
+							__iconv_functions.close(__desc);
+						}
+						__source_pool->_M_descriptors.clear();
+					}
+				}
+				catch (...) {
+					// the pooled descriptors stay where they are, to be reused or closed later
+				}
+				this->_M_hits.store(0, ::std::memory_order_relaxed);
+				this->_M_misses.store(0, ::std::memory_order_relaxed);
+			}
+
+		private:
+			__pool& _M_find_or_add(::std::string_view __to_name, ::std::string_view __from_name) {
+				// there are only ever a handful of distinct conversions in a program: a linear search beats hashing
+				// two strings every time
+				for (auto& __source_pool : this->_M_pools) {
+					if (__source_pool->_M_to_name == __to_name && __source_pool->_M_from_name == __from_name) {
+						return *__source_pool;
+					}
+				}
+				auto __new_pool = ::std::make_unique<__pool>(
+					__pool { ::std::string(__to_name), ::std::string(__from_name), {} });
+				__new_pool->_M_descriptors.reserve(_PoolSize);
+				this->_M_pools.push_back(::std::move(__new_pool));
+				return *this->_M_pools.back();
+			}
+
+			::std::mutex _M_mutex;
+			::std::vector<::std::unique_ptr<__pool>> _M_pools;
+			::std::atomic<::std::size_t> _M_hits { 0 };
+			::std::atomic<::std::size_t> _M_misses { 0 };
+		};
+	} // namespace __txt_detail
+#endif
+
+	//////
+	/// @brief Returns how many ztd::text::basic_iconv states were served from the descriptor cache, how many had to
+	/// open a new descriptor, and how many descriptors are currently cached.
+	///
+	/// @remarks Always returns all zeroes if iconv is not available.
+	inline iconv_descriptor_cache_statistics iconv_descriptor_cache_stats() noexcept {
+#if ZTD_IS_ON(ZTD_PLATFORM_LIBICONV)
+		return __txt_detail::__iconv_descriptor_cache::_S_instance()._M_statistics();
+#else
+		return { 0, 0, 0 };
+#endif
+	}
+
+	//////
+	/// @brief Closes every descriptor currently waiting in the iconv descriptor cache and resets the hit and miss
+	/// counts.
+	///
+	/// @remarks Descriptors in use by live states are unaffected; they are returned to the (now empty) cache when
+	/// their state is destroyed.
+	inline void clear_iconv_descriptor_cache() noexcept {
+#if ZTD_IS_ON(ZTD_PLATFORM_LIBICONV)
+		__txt_detail::__iconv_descriptor_cache::_S_instance()._M_clear();
+#endif
+	}
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#include <ztd/epilogue.hpp>
+
+#endif
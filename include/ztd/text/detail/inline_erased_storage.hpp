@@ -0,0 +1,167 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#pragma once
+
+#ifndef ZTD_TEXT_DETAIL_INLINE_ERASED_STORAGE_HPP
+#define ZTD_TEXT_DETAIL_INLINE_ERASED_STORAGE_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include <ztd/prologue.hpp>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	namespace __txt_detail {
+		//////
+		/// @brief An owning pointer to a polymorphic `_Base` that keeps objects of up to `_InlineSize` bytes in a
+		/// buffer inside itself, and only goes to the heap for anything larger.
+		///
+		/// @remarks Only types that can be moved without throwing are stored inline, so that moving the pointer
+		/// itself can stay `noexcept`. `_Base` must have a virtual destructor.
+		template <typename _Base, ::std::size_t _InlineSize>
+		class __inline_erased_ptr {
+		private:
+			using __relocate_t = _Base* (*)(_Base*, void*) noexcept;
+
+		public:
+			template <typename _Type>
+			inline static constexpr bool _S_fits_inline_v = sizeof(_Type) <= _InlineSize // cf
+				&& alignof(_Type) <= alignof(::std::max_align_t)                          // cf
+				&& ::std::is_nothrow_move_constructible_v<_Type>;
+
+			__inline_erased_ptr() noexcept : _M_ptr(nullptr), _M_relocate(nullptr) {
+			}
+
+			__inline_erased_ptr(const __inline_erased_ptr&)            = delete;
+			__inline_erased_ptr& operator=(const __inline_erased_ptr&) = delete;
+
+			__inline_erased_ptr(__inline_erased_ptr&& __other) noexcept : _M_ptr(nullptr), _M_relocate(nullptr) {
+				this->_M_take(__other);
+			}
+
+			__inline_erased_ptr& operator=(__inline_erased_ptr&& __other) noexcept {
+				if (this != ::std::addressof(__other)) {
+					this->_M_reset();
+					this->_M_take(__other);
+				}
+				return *this;
+			}
+
+			~__inline_erased_ptr() {
+				this->_M_reset();
+			}
+
+			template <typename _Type, typename... _Args>
+			_Type& _M_emplace(_Args&&... __args) {
+				static_assert(::std::is_base_of_v<_Base, _Type>, "the stored type must derive from the base type");
+				this->_M_reset();
+				if constexpr (_S_fits_inline_v<_Type>) {
+					_Type* __object
+						= ::new (static_cast<void*>(this->_M_buffer)) _Type(::std::forward<_Args>(__args)...);
+					this->_M_ptr      = __object;
+					this->_M_relocate = &_S_relocate<_Type>;
+					return *__object;
+				}
+				else {
+					_Type* __object   = new _Type(::std::forward<_Args>(__args)...);
+					this->_M_ptr      = __object;
+					this->_M_relocate = nullptr;
+					return *__object;
+				}
+			}
+
+			_Base* _M_get() const noexcept {
+				return this->_M_ptr;
+			}
+
+			_Base* operator->() const noexcept {
+				return this->_M_ptr;
+			}
+
+			bool _M_is_inline() const noexcept {
+				return this->_M_relocate != nullptr;
+			}
+
+		private:
+			template <typename _Type>
+			static _Base* _S_relocate(_Base* __source, void* __destination) noexcept {
+				_Type* __typed_source = static_cast<_Type*>(__source);
+				_Type* __object       = ::new (__destination) _Type(::std::move(*__typed_source));
+				__typed_source->~_Type();
+				return __object;
+			}
+
+			void _M_take(__inline_erased_ptr& __other) noexcept {
+				if (__other._M_relocate != nullptr) {
+					// stored inline: the object itself has to move over into our buffer
+					this->_M_ptr = __other._M_relocate(__other._M_ptr, static_cast<void*>(this->_M_buffer));
+				}
+				else {
+					this->_M_ptr = __other._M_ptr;
+				}
+				this->_M_relocate   = __other._M_relocate;
+				__other._M_ptr      = nullptr;
+				__other._M_relocate = nullptr;
+			}
+
+			void _M_reset() noexcept {
+				if (this->_M_ptr == nullptr) {
+					return;
+				}
+				if (this->_M_relocate != nullptr) {
+					this->_M_ptr->~_Base();
+				}
+				else {
+					delete this->_M_ptr;
+				}
+				this->_M_ptr      = nullptr;
+				this->_M_relocate = nullptr;
+			}
+
+			alignas(::std::max_align_t) unsigned char _M_buffer[_InlineSize == 0 ? 1 : _InlineSize];
+			_Base* _M_ptr;
+			__relocate_t _M_relocate;
+		};
+	} // namespace __txt_detail
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#include <ztd/epilogue.hpp>
+
+#endif
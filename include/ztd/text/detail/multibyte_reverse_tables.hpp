@@ -0,0 +1,196 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#pragma once
+
+#ifndef ZTD_TEXT_DETAIL_MULTIBYTE_REVERSE_TABLES_HPP
+#define ZTD_TEXT_DETAIL_MULTIBYTE_REVERSE_TABLES_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/detail/unicode_kernels.hpp>
+
+#include <ztd/encoding_tables/table_types.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <optional>
+#include <type_traits>
+
+#include <ztd/prologue.hpp>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	namespace __txt_detail {
+		//////
+		/// @brief The number of 256-code point pages covered by the first level of a multibyte reverse table. This
+		/// covers planes 0 through 2, so the Supplementary Ideographic Plane characters of Big5-HKSCS are included;
+		/// anything above is looked up with the original search.
+		inline constexpr ::std::size_t __multibyte_reverse_page_limit = 0x300;
+
+		//////
+		/// @brief The bit used while building a multibyte reverse table to mark an entry whose code point appears at
+		/// more than one index and has already been settled by the original search.
+		inline constexpr ::std::uint_least16_t __multibyte_reverse_resolved = 0x8000;
+
+		//////
+		/// @brief A two-level code point → index table for the double-byte encodings' index tables: the first level
+		/// maps a code point's page (`code_point >> 8`) to one of the used pages (1-based, 0 meaning "nothing in
+		/// that page"), and the second level maps the low 8 bits to the index plus one (0 meaning "not mapped").
+		///
+		/// @remarks The table takes `sizeof(_M_page_index)` (1.5 KiB) plus 512 bytes for each page that holds at
+		/// least one mapped code point; ztd::text::__txt_detail::__multibyte_reverse_table::_M_footprint reports the
+		/// total. If the pages cannot be allocated, the table is left unavailable and every lookup goes to the
+		/// original search.
+		struct __multibyte_reverse_table {
+			::std::uint_least16_t _M_page_index[__multibyte_reverse_page_limit];
+			::std::unique_ptr<::std::uint_least16_t[]> _M_pages;
+			::std::size_t _M_page_count;
+
+			//////
+			/// @brief Whether the pages were allocated and the table can be used.
+			bool _M_available() const noexcept {
+				return this->_M_pages != nullptr;
+			}
+
+			//////
+			/// @brief The number of bytes the table occupies, including the page index.
+			::std::size_t _M_footprint() const noexcept {
+				return sizeof(*this) + (this->_M_page_count * 256 * sizeof(::std::uint_least16_t));
+			}
+
+			//////
+			/// @brief The index plus one for a code point below the page limit, or 0 if it is not mapped.
+			::std::size_t _M_entry(::std::uint_least32_t __code_point) const noexcept {
+				const ::std::uint_least16_t __page = this->_M_page_index[__code_point >> 8];
+				if (__page == 0) {
+					return 0;
+				}
+				return this->_M_pages[(static_cast<::std::size_t>(__page - 1) * 256) + (__code_point & 0xFF)];
+			}
+		};
+
+		// The reverse direction is derived from the forward direction: every index the search can return is one
+		// that decodes to the searched-for code point. Code points which appear at more than one index are settled
+		// by calling the search once, so encodings that prefer the first or the last index keep doing so.
+		template <::std::size_t _IndexLimit, ::ztd::et::basic_lookup_index_to_code_point_function* _LookupCodePoint,
+			::ztd::et::basic_lookup_code_point_to_index_function* _LookupIndex>
+		__multibyte_reverse_table __make_multibyte_reverse_table() noexcept {
+			static_assert(_IndexLimit < __multibyte_reverse_resolved,
+				"the index (plus one) must fit in an entry without the resolved bit");
+			__multibyte_reverse_table __table {};
+			for (::std::size_t __index = 0; __index < _IndexLimit; ++__index) {
+				const ::std::optional<::std::uint_least32_t> __maybe_code = _LookupCodePoint(__index);
+				if (!__maybe_code || (*__maybe_code >> 8) >= __multibyte_reverse_page_limit) {
+					continue;
+				}
+				::std::uint_least16_t& __page = __table._M_page_index[*__maybe_code >> 8];
+				if (__page == 0) {
+					++__table._M_page_count;
+					__page = static_cast<::std::uint_least16_t>(__table._M_page_count);
+				}
+			}
+			const ::std::size_t __entry_count = __table._M_page_count * 256;
+			__table._M_pages.reset(new (::std::nothrow) ::std::uint_least16_t[__entry_count]());
+			if (!__table._M_pages) {
+				return __table;
+			}
+			for (::std::size_t __index = 0; __index < _IndexLimit; ++__index) {
+				const ::std::optional<::std::uint_least32_t> __maybe_code = _LookupCodePoint(__index);
+				if (!__maybe_code || (*__maybe_code >> 8) >= __multibyte_reverse_page_limit) {
+					continue;
+				}
+				const ::std::size_t __page = __table._M_page_index[*__maybe_code >> 8];
+				::std::uint_least16_t& __entry
+					= __table._M_pages[((__page - 1) * 256) + (*__maybe_code & 0xFF)];
+				if (__entry == 0) {
+					__entry = static_cast<::std::uint_least16_t>(__index + 1);
+				}
+				else if ((__entry & __multibyte_reverse_resolved) == 0) {
+					const ::std::optional<::std::size_t> __maybe_index = _LookupIndex(*__maybe_code);
+					const ::std::size_t __resolved = __maybe_index ? *__maybe_index + 1 : 0;
+					__entry = static_cast<::std::uint_least16_t>(__multibyte_reverse_resolved | __resolved);
+				}
+			}
+			for (::std::size_t __entry_index = 0; __entry_index < __entry_count; ++__entry_index) {
+				__table._M_pages[__entry_index]
+					&= static_cast<::std::uint_least16_t>(~__multibyte_reverse_resolved);
+			}
+			return __table;
+		}
+
+		//////
+		/// @brief The reverse table for the given lookups, built the first time it is asked for.
+		template <::std::size_t _IndexLimit, ::ztd::et::basic_lookup_index_to_code_point_function* _LookupCodePoint,
+			::ztd::et::basic_lookup_code_point_to_index_function* _LookupIndex>
+		const __multibyte_reverse_table& __multibyte_reverse_table_instance() noexcept {
+			static const __multibyte_reverse_table __table
+				= __make_multibyte_reverse_table<_IndexLimit, _LookupCodePoint, _LookupIndex>();
+			return __table;
+		}
+
+		//////
+		/// @brief Looks up the index for a code point: through the reverse table at run time, and through the
+		/// original search during constant evaluation, above the page limit, or if the table could not be
+		/// allocated. The result is always the one the original search gives.
+		///
+		/// @tparam _IndexLimit One past the largest index the encoding's index table uses.
+		template <::std::size_t _IndexLimit, ::ztd::et::basic_lookup_index_to_code_point_function* _LookupCodePoint,
+			::ztd::et::basic_lookup_code_point_to_index_function* _LookupIndex>
+		constexpr ::std::optional<::std::size_t> __multibyte_code_point_to_index(
+			::std::uint_least32_t __code_point) noexcept {
+#if ZTD_IS_ON(ZTD_STD_LIBRARY_IS_CONSTANT_EVALUATED)
+			if (!::std::is_constant_evaluated() && (__code_point >> 8) < __multibyte_reverse_page_limit) {
+#else
+			if ((__code_point >> 8) < __multibyte_reverse_page_limit) {
+#endif
+				const __multibyte_reverse_table& __table
+					= __multibyte_reverse_table_instance<_IndexLimit, _LookupCodePoint, _LookupIndex>();
+				if (__table._M_available()) {
+					const ::std::size_t __entry = __table._M_entry(__code_point);
+					if (__entry == 0) {
+						return ::std::nullopt;
+					}
+					return __entry - 1;
+				}
+			}
+			return _LookupIndex(__code_point);
+		}
+	} // namespace __txt_detail
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#include <ztd/epilogue.hpp>
+
+#endif
@@ -0,0 +1,339 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#pragma once
+
+#ifndef ZTD_TEXT_DETAIL_NORMALIZATION_ROUTINES_HPP
+#define ZTD_TEXT_DETAIL_NORMALIZATION_ROUTINES_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/detail/normalization_tables.hpp>
+
+#include <ztd/idk/type_traits.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include <ztd/prologue.hpp>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	namespace __txt_detail {
+		//////
+		/// @brief The most non-starters the Stream-Safe Text Format (Unicode Standard Annex #15, D4) allows in a
+		/// row before a U+034F COMBINING GRAPHEME JOINER has to be inserted.
+		inline constexpr ::std::size_t __stream_safe_max_non_starters = 30;
+
+		inline constexpr ::std::uint_least32_t __combining_grapheme_joiner = 0x034F;
+
+		//////
+		/// @brief How many code points a single normalization segment can hold: a fully decomposed starter
+		/// followed by a stream-safe run of non-starters, plus the joiner that closes an over-long run.
+		inline constexpr ::std::size_t __normalization_segment_size
+			= __normalization_max_decomposition + __stream_safe_max_non_starters + 16;
+
+		inline constexpr ::std::uint_least32_t __hangul_s_base  = 0xAC00;
+		inline constexpr ::std::uint_least32_t __hangul_l_base  = 0x1100;
+		inline constexpr ::std::uint_least32_t __hangul_v_base  = 0x1161;
+		inline constexpr ::std::uint_least32_t __hangul_t_base  = 0x11A7;
+		inline constexpr ::std::uint_least32_t __hangul_l_count = 19;
+		inline constexpr ::std::uint_least32_t __hangul_v_count = 21;
+		inline constexpr ::std::uint_least32_t __hangul_t_count = 28;
+		inline constexpr ::std::uint_least32_t __hangul_n_count = __hangul_v_count * __hangul_t_count;
+		inline constexpr ::std::uint_least32_t __hangul_s_count = __hangul_l_count * __hangul_n_count;
+
+		constexpr ::std::uint_least32_t __normalization_record(::std::uint_least32_t __code_point) noexcept {
+			if (__code_point >= __normalization_trie_limit) {
+				return 0;
+			}
+			constexpr ::std::uint_least32_t __block_mask = (1u << __normalization_trie_shift) - 1u;
+			const ::std::size_t __block  = __normalization_trie_index[__code_point >> __normalization_trie_shift];
+			const ::std::size_t __offset = (__block << __normalization_trie_shift) + (__code_point & __block_mask);
+			return __normalization_trie_data[__offset];
+		}
+
+		constexpr unsigned char __normalization_combining_class(::std::uint_least32_t __record) noexcept {
+			return static_cast<unsigned char>(__record & __normalization_ccc_mask);
+		}
+
+		constexpr bool __is_hangul_syllable(::std::uint_least32_t __code_point) noexcept {
+			return __code_point >= __hangul_s_base && __code_point < (__hangul_s_base + __hangul_s_count);
+		}
+
+		template <bool _IsCompatibility, bool _IsComposing>
+		inline constexpr ::std::uint_least32_t __normalization_quick_check_limit = _IsComposing
+			? (_IsCompatibility ? __normalization_nfkc_quick_check_limit : __normalization_nfc_quick_check_limit)
+			: (_IsCompatibility ? __normalization_nfkd_quick_check_limit : __normalization_nfd_quick_check_limit);
+
+		template <bool _IsCompatibility>
+		inline constexpr ::std::uint_least32_t __normalization_decomposes
+			= _IsCompatibility ? __normalization_nfkd_no : __normalization_nfd_no;
+
+		//////
+		/// @brief Whether `__code_point` is a starter that the normalization form copies through as-is
+		/// (Quick_Check=Yes) and that nothing before it can reorder or compose with.
+		template <bool _IsCompatibility, bool _IsComposing>
+		constexpr bool __normalization_is_inert(::std::uint_least32_t __code_point) noexcept {
+			if (__code_point < __normalization_quick_check_limit<_IsCompatibility, _IsComposing>) {
+				return true;
+			}
+			constexpr ::std::uint_least32_t __quick_check_no = _IsComposing
+				? (_IsCompatibility ? __normalization_nfkc_no : __normalization_nfc_no)
+				: __normalization_decomposes<_IsCompatibility>;
+			constexpr ::std::uint_least32_t __mask = __normalization_ccc_mask | __quick_check_no
+				| (_IsComposing ? __normalization_composes_with_previous : 0u);
+			return (__normalization_record(__code_point) & __mask) == 0;
+		}
+
+		//////
+		/// @brief Writes the full decomposition of `__code_point` into `__output`, which must have room for
+		/// __normalization_max_decomposition code points.
+		///
+		/// @returns The number of code points written.
+		template <bool _IsCompatibility>
+		constexpr ::std::size_t __normalization_decompose(
+			::std::uint_least32_t __code_point, ::std::uint_least32_t* __output) noexcept {
+			if (__is_hangul_syllable(__code_point)) {
+				const ::std::uint_least32_t __s_index = __code_point - __hangul_s_base;
+				const ::std::uint_least32_t __t_index = __s_index % __hangul_t_count;
+				__output[0] = __hangul_l_base + (__s_index / __hangul_n_count);
+				__output[1] = __hangul_v_base + ((__s_index % __hangul_n_count) / __hangul_t_count);
+				if (__t_index == 0) {
+					return 2;
+				}
+				__output[2] = __hangul_t_base + __t_index;
+				return 3;
+			}
+			const ::std::uint_least32_t __record = __normalization_record(__code_point);
+			if ((__record & __normalization_decomposes<_IsCompatibility>) == 0) {
+				__output[0] = __code_point;
+				return 1;
+			}
+			const ::std::uint_least32_t* __mapping = __normalization_mapping_data + (__record >> 16);
+			if constexpr (_IsCompatibility) {
+				// skip past the canonical mapping, unless the compatibility one is the same
+				const ::std::uint_least32_t* __compatibility_mapping = __mapping + 1 + __mapping[0];
+				if (__compatibility_mapping[0] != 0) {
+					__mapping = __compatibility_mapping;
+				}
+			}
+			const ::std::size_t __size = static_cast<::std::size_t>(__mapping[0]);
+			for (::std::size_t __index = 0; __index < __size; ++__index) {
+				__output[__index] = __mapping[__index + 1];
+			}
+			return __size;
+		}
+
+		//////
+		/// @brief Whether there is a normalization boundary before `__code_point`: nothing before it can be
+		/// reordered past or composed with it (or with what it decomposes into).
+		template <bool _IsCompatibility, bool _IsComposing>
+		constexpr bool __normalization_has_boundary_before(::std::uint_least32_t __code_point) noexcept {
+			if (__code_point < __normalization_quick_check_limit<_IsCompatibility, _IsComposing>) {
+				return true;
+			}
+			::std::uint_least32_t __record = __normalization_record(__code_point);
+			if ((__record & __normalization_decomposes<_IsCompatibility>) != 0) {
+				if (__is_hangul_syllable(__code_point)) {
+					// decomposes to a leading jamo, which does not compose with anything before it
+					return true;
+				}
+				::std::uint_least32_t __decomposed[__normalization_max_decomposition] {};
+				__normalization_decompose<_IsCompatibility>(__code_point, __decomposed);
+				__record = __normalization_record(__decomposed[0]);
+			}
+			if (__normalization_combining_class(__record) != 0) {
+				return false;
+			}
+			if constexpr (_IsComposing) {
+				return (__record & __normalization_composes_with_previous) == 0;
+			}
+			else {
+				return true;
+			}
+		}
+
+		//////
+		/// @brief Finds the primary composite for `__first` followed by `__second`.
+		///
+		/// @returns The composite, or 0 if the pair does not compose.
+		constexpr ::std::uint_least32_t __normalization_compose(
+			::std::uint_least32_t __first, ::std::uint_least32_t __second) noexcept {
+			if (__first >= __hangul_l_base && __first < (__hangul_l_base + __hangul_l_count)) {
+				if (__second >= __hangul_v_base && __second < (__hangul_v_base + __hangul_v_count)) {
+					return __hangul_s_base
+						+ ((__first - __hangul_l_base) * __hangul_v_count + (__second - __hangul_v_base))
+						* __hangul_t_count;
+				}
+				return 0;
+			}
+			if (__is_hangul_syllable(__first) && ((__first - __hangul_s_base) % __hangul_t_count) == 0) {
+				if (__second > __hangul_t_base && __second < (__hangul_t_base + __hangul_t_count)) {
+					return __first + (__second - __hangul_t_base);
+				}
+				return 0;
+			}
+			if ((__normalization_record(__first) & __normalization_composes_with_next) == 0
+				|| (__normalization_record(__second) & __normalization_composes_with_previous) == 0) {
+				return 0;
+			}
+			constexpr ::std::size_t __size
+				= sizeof(__normalization_compositions) / sizeof(__normalization_compositions[0]);
+			const ::std::uint_least64_t __pair = (static_cast<::std::uint_least64_t>(__first) << 21)
+				| static_cast<::std::uint_least64_t>(__second);
+			::std::size_t __low  = 0;
+			::std::size_t __high = __size;
+			while (__low < __high) {
+				const ::std::size_t __middle = __low + ((__high - __low) / 2);
+				if (__normalization_compositions[__middle].__pair < __pair) {
+					__low = __middle + 1;
+				}
+				else {
+					__high = __middle;
+				}
+			}
+			if (__low != __size && __normalization_compositions[__low].__pair == __pair) {
+				return __normalization_compositions[__low].__composite;
+			}
+			return 0;
+		}
+
+		//////
+		/// @brief A fully-decomposed run of code points between two normalization boundaries, kept alongside
+		/// their combining classes.
+		struct __normalization_segment {
+			::std::uint_least32_t __code_points[__normalization_segment_size];
+			unsigned char __classes[__normalization_segment_size];
+			::std::size_t __size;
+			::std::size_t __trailing_non_starters;
+		};
+
+		//////
+		/// @brief Canonical Ordering Algorithm: stably sorts each run of non-starters by combining class. Runs are
+		/// bounded by the Stream-Safe limit, so an insertion sort is all that is needed.
+		constexpr void __normalization_reorder(__normalization_segment& __segment) noexcept {
+			for (::std::size_t __index = 1; __index < __segment.__size; ++__index) {
+				const unsigned char __class = __segment.__classes[__index];
+				if (__class == 0) {
+					continue;
+				}
+				const ::std::uint_least32_t __code_point = __segment.__code_points[__index];
+				::std::size_t __target                   = __index;
+				for (; __target > 0; --__target) {
+					const unsigned char __previous_class = __segment.__classes[__target - 1];
+					if (__previous_class == 0 || __previous_class <= __class) {
+						break;
+					}
+					__segment.__code_points[__target] = __segment.__code_points[__target - 1];
+					__segment.__classes[__target]     = __previous_class;
+				}
+				__segment.__code_points[__target] = __code_point;
+				__segment.__classes[__target]     = __class;
+			}
+		}
+
+		//////
+		/// @brief Canonical Composition Algorithm over an already reordered segment.
+		///
+		/// @tparam _IsContiguous Only compose a mark with a starter it directly follows, as FCC (Unicode
+		/// Technical Note #5) does.
+		template <bool _IsContiguous>
+		constexpr void __normalization_recompose(__normalization_segment& __segment) noexcept {
+			if (__segment.__size < 2) {
+				return;
+			}
+			// a segment that does not start with a starter has nothing to compose onto until one shows up
+			bool __has_starter            = __segment.__classes[0] == 0;
+			::std::size_t __starter_index = 0;
+			unsigned char __last_class    = __segment.__classes[0];
+			::std::size_t __write_index   = 1;
+			for (::std::size_t __index = 1; __index < __segment.__size; ++__index) {
+				const ::std::uint_least32_t __code_point = __segment.__code_points[__index];
+				const unsigned char __class              = __segment.__classes[__index];
+				if (__has_starter) {
+					// everything kept between the starter and here is a non-starter, and the last one has the
+					// highest combining class because the segment is already in canonical order
+					const bool __adjacent = __write_index == __starter_index + 1;
+					const bool __unblocked
+						= __adjacent || (!_IsContiguous && __last_class != 0 && __last_class < __class);
+					if (__unblocked) {
+						const ::std::uint_least32_t __composite
+							= __normalization_compose(__segment.__code_points[__starter_index], __code_point);
+						if (__composite != 0) {
+							__segment.__code_points[__starter_index] = __composite;
+							continue;
+						}
+					}
+				}
+				if (__class == 0) {
+					__has_starter   = true;
+					__starter_index = __write_index;
+				}
+				__last_class                           = __class;
+				__segment.__code_points[__write_index] = __code_point;
+				__segment.__classes[__write_index]     = __class;
+				++__write_index;
+			}
+			__segment.__size = __write_index;
+		}
+
+		template <typename _Last, typename _It>
+		using __detect_normalization_distance
+			= decltype(::std::declval<const _Last&>() - ::std::declval<const _It&>());
+
+		//////
+		/// @brief Whether `__count` more code points can be written starting at `__it`, without writing them.
+		template <typename _OutIt, typename _OutLast>
+		constexpr bool __normalization_output_has_room(
+			const _OutIt& __it, const _OutLast& __last, ::std::size_t __count) noexcept {
+			if constexpr (is_detected_v<__detect_normalization_distance, _OutLast, _OutIt>) {
+				return static_cast<::std::size_t>(__last - __it) >= __count;
+			}
+			else {
+				_OutIt __probe = __it;
+				for (; __count > 0; --__count, ++__probe) {
+					if (__probe == __last) {
+						return false;
+					}
+				}
+				return true;
+			}
+		}
+	} // namespace __txt_detail
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#include <ztd/epilogue.hpp>
+
+#endif
@@ -0,0 +1,2789 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#pragma once
+
+#ifndef ZTD_TEXT_DETAIL_NORMALIZATION_TABLES_HPP
+#define ZTD_TEXT_DETAIL_NORMALIZATION_TABLES_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+#include <ztd/prologue.hpp>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	namespace __txt_detail {
+		// Generated by tools/generate_normalization_tables.py from the Unicode 14.0.0 character database.
+		// Do not edit by hand.
+
+		// Each code point has a 32-bit record: the canonical combining class in the low byte, then the quick check
+		// and composition flags, then (in the top 16 bits) the offset of its decomposition mappings in
+		// __normalization_mapping_data.
+		inline constexpr ::std::uint_least32_t __normalization_ccc_mask               = 0x00ff;
+		inline constexpr ::std::uint_least32_t __normalization_nfd_no                 = 0x0100;
+		inline constexpr ::std::uint_least32_t __normalization_nfkd_no                = 0x0200;
+		inline constexpr ::std::uint_least32_t __normalization_nfc_no                 = 0x0400;
+		inline constexpr ::std::uint_least32_t __normalization_nfkc_no                = 0x0800;
+		inline constexpr ::std::uint_least32_t __normalization_composes_with_previous = 0x1000;
+		inline constexpr ::std::uint_least32_t __normalization_composes_with_next     = 0x2000;
+
+		// Everything below these is a starter that each form leaves untouched.
+		inline constexpr ::std::uint_least32_t __normalization_nfd_quick_check_limit  = 0x00c0;
+		inline constexpr ::std::uint_least32_t __normalization_nfkd_quick_check_limit = 0x00a0;
+		inline constexpr ::std::uint_least32_t __normalization_nfc_quick_check_limit  = 0x0300;
+		inline constexpr ::std::uint_least32_t __normalization_nfkc_quick_check_limit = 0x00a0;
+
+		// The longest full decomposition of any single code point, in either form.
+		inline constexpr ::std::size_t __normalization_max_decomposition = 18;
+
+		// Code points at or above this have no normalization properties at all.
+		inline constexpr ::std::uint_least32_t __normalization_trie_limit = 0x30000;
+		inline constexpr ::std::size_t __normalization_trie_shift = 5;
+
+		inline constexpr ::std::uint_least16_t __normalization_trie_index[6144] = {
+			0, 1, 2, 2, 0, 3, 4, 5, 6, 7, 8, 9, 0, 10, 11, 12, 13, 14, 0, 0, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24,
+			25, 26, 27, 28, 29, 30, 31, 0, 32, 33, 0, 0, 0, 0, 34, 35, 36, 0, 37, 38, 39, 40, 0, 0, 41, 42, 43, 44,
+			45, 0, 0, 0, 0, 46, 47, 48, 49, 0, 50, 0, 51, 52, 0, 53, 54, 0, 0, 55, 56, 57, 0, 58, 59, 0, 0, 60, 61,
+			0, 0, 55, 62, 0, 63, 64, 65, 0, 0, 60, 66, 0, 0, 67, 68, 0, 0, 69, 70, 0, 0, 0, 71, 0, 0, 72, 73, 0, 0,
+			74, 75, 0, 76, 77, 78, 79, 80, 81, 82, 0, 0, 83, 0, 0, 84, 0, 0, 85, 86, 0, 0, 87, 0, 88, 89, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 90, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 91, 92, 0, 0, 0, 0, 93, 0, 0, 0, 0, 0, 0, 94, 0, 0, 0, 95, 0, 0, 0, 0, 0, 0, 96, 0, 0, 97,
+			0, 98, 99, 0, 100, 101, 102, 103, 0, 104, 0, 105, 0, 106, 0, 0, 0, 0, 107, 108, 0, 109, 110, 111, 112,
+			113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133,
+			134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 0, 147, 148, 149, 150, 151, 152, 0,
+			153, 0, 154, 0, 0, 0, 0, 0, 0, 0, 0, 0, 155, 156, 157, 158, 159, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 160, 0, 0, 161, 0, 0,
+			162, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 163, 0, 0, 0, 164, 0, 0, 0, 165, 0, 0, 0, 166, 0, 0, 0, 0, 167,
+			0, 0, 168, 169, 170, 171, 172, 173, 174, 175, 0, 176, 177, 178, 179, 180, 181, 182, 183, 0, 184, 185,
+			186, 187, 0, 0, 0, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 204, 205, 0, 0, 206, 0, 0, 0, 207, 0, 0, 0, 208, 209, 210, 0, 0, 0, 0, 211, 212, 0, 213, 214,
+			0, 0, 215, 216, 0, 0, 0, 0, 0, 0, 217, 218, 219, 0, 0, 220, 221, 0, 0, 0, 61, 222, 223, 224, 225, 226,
+			227, 228, 222, 223, 224, 225, 226, 227, 228, 222, 223, 224, 225, 226, 227, 228, 222, 223, 224, 225, 226,
+			227, 228, 222, 223, 224, 225, 226, 227, 228, 222, 223, 224, 225, 226, 227, 228, 222, 223, 224, 225, 226,
+			227, 228, 222, 223, 224, 225, 226, 227, 228, 222, 223, 224, 225, 226, 227, 228, 222, 223, 224, 225, 226,
+			227, 228, 222, 223, 224, 225, 226, 227, 228, 222, 223, 224, 225, 226, 227, 228, 222, 223, 224, 225, 226,
+			227, 228, 222, 223, 224, 225, 226, 227, 228, 222, 223, 224, 225, 226, 227, 228, 222, 223, 224, 225, 226,
+			227, 228, 222, 223, 224, 225, 226, 227, 228, 222, 223, 224, 225, 226, 227, 228, 222, 223, 224, 225, 226,
+			227, 228, 222, 223, 224, 225, 226, 227, 228, 222, 223, 224, 225, 226, 227, 228, 222, 223, 224, 225, 226,
+			227, 228, 222, 223, 224, 225, 226, 227, 228, 222, 223, 224, 225, 226, 227, 228, 222, 223, 224, 225, 226,
+			227, 228, 222, 223, 224, 225, 226, 227, 228, 222, 223, 224, 225, 226, 227, 228, 222, 223, 224, 225, 226,
+			227, 228, 222, 223, 224, 225, 226, 227, 228, 222, 223, 224, 225, 226, 227, 228, 222, 223, 224, 225, 226,
+			227, 228, 222, 223, 224, 225, 226, 227, 228, 222, 223, 224, 225, 226, 227, 228, 222, 223, 224, 225, 226,
+			227, 228, 222, 223, 224, 225, 226, 227, 228, 222, 223, 224, 225, 226, 227, 228, 222, 223, 224, 225, 226,
+			227, 228, 222, 223, 224, 225, 226, 227, 228, 222, 223, 224, 225, 226, 227, 228, 222, 223, 224, 225, 226,
+			227, 228, 222, 223, 224, 225, 226, 227, 228, 222, 223, 224, 225, 226, 227, 228, 222, 223, 224, 225, 226,
+			227, 228, 222, 223, 224, 225, 226, 227, 228, 222, 223, 224, 225, 226, 227, 228, 222, 223, 224, 225, 226,
+			227, 228, 222, 223, 224, 225, 226, 227, 228, 222, 223, 224, 225, 226, 227, 228, 222, 223, 224, 225, 226,
+			227, 228, 222, 223, 224, 225, 226, 227, 229, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 0, 245, 246, 247, 248,
+			249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269,
+			270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 285, 0, 0, 0, 0, 0, 0, 0, 286, 0, 0, 0, 287, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 288, 289, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 290, 291, 0, 0, 0, 0, 0, 292, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 293, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 294, 0, 0, 0, 0, 295, 0, 296, 0, 0, 0, 0, 0, 209, 297, 298, 299, 0, 0, 300,
+			301, 0, 215, 0, 0, 302, 0, 0, 303, 0, 0, 0, 0, 0, 304, 0, 305, 306, 307, 0, 0, 0, 0, 0, 0, 308, 0, 0,
+			309, 310, 0, 0, 0, 0, 0, 0, 311, 312, 0, 0, 313, 0, 0, 0, 314, 0, 0, 0, 315, 0, 0, 0, 0, 0, 0, 0, 316,
+			0, 0, 0, 0, 0, 0, 0, 317, 318, 0, 0, 0, 0, 216, 0, 92, 319, 0, 320, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			313, 0, 0, 0, 0, 0, 0, 0, 0, 321, 0, 322, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 323, 0, 324, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 325, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 326, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 327, 328, 329, 330, 331, 0, 0, 0, 332, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346,
+			347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 365, 366, 0, 0, 0, 0, 0, 0, 0,
+			324, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 367, 0, 368, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 369, 0, 0, 0, 370,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 371, 372, 373, 374, 375, 376, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 377, 378, 379,
+			380, 381, 0, 0, 0, 382, 383, 384, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 385, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, 402,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+		};
+
+		inline constexpr ::std::uint_least32_t __normalization_trie_data[12896] = {
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2000,
+			0x2000, 0x2000, 0x0, 0x0, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000,
+			0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x0, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000,
+			0x2000, 0x2000, 0x2000, 0x2000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10a00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x42a00, 0x0, 0x80a00, 0x0, 0x0, 0x0, 0x0, 0xb0a00, 0x0, 0x0, 0xf0a00, 0x120a00, 0x150a00, 0x190a00,
+			0x0, 0x0, 0x1c0a00, 0x200a00, 0x230a00, 0x0, 0x260a00, 0x2b0a00, 0x300a00, 0x0, 0x350300, 0x390300,
+			0x3d2300, 0x410300, 0x452300, 0x492300, 0x2000, 0x4d2300, 0x510300, 0x550300, 0x592300, 0x5d0300,
+			0x610300, 0x650300, 0x690300, 0x6d2300, 0x0, 0x710300, 0x750300, 0x790300, 0x7d2300, 0x812300, 0x852300,
+			0x0, 0x2000, 0x890300, 0x8d0300, 0x910300, 0x952300, 0x990300, 0x0, 0x0, 0x9d0300, 0xa10300, 0xa52300,
+			0xa90300, 0xad2300, 0xb12300, 0x2000, 0xb52300, 0xb90300, 0xbd0300, 0xc12300, 0xc50300, 0xc90300,
+			0xcd0300, 0xd10300, 0xd52300, 0x0, 0xd90300, 0xdd0300, 0xe10300, 0xe52300, 0xe92300, 0xed2300, 0x0,
+			0x2000, 0xf10300, 0xf50300, 0xf90300, 0xfd2300, 0x1010300, 0x0, 0x1050300, 0x1090300, 0x10d0300,
+			0x1112300, 0x1152300, 0x1190300, 0x11d0300, 0x1210300, 0x1250300, 0x1290300, 0x12d0300, 0x1310300,
+			0x1350300, 0x1390300, 0x13d0300, 0x1410300, 0x1450300, 0x0, 0x0, 0x1492300, 0x14d2300, 0x1510300,
+			0x1550300, 0x1590300, 0x15d0300, 0x1610300, 0x1650300, 0x1690300, 0x16d0300, 0x1710300, 0x1750300,
+			0x1790300, 0x17d0300, 0x1810300, 0x1850300, 0x1890300, 0x18d0300, 0x1910300, 0x1950300, 0x0, 0x0,
+			0x1990300, 0x19d0300, 0x1a10300, 0x1a50300, 0x1a90300, 0x1ad0300, 0x1b10300, 0x1b50300, 0x1b90300, 0x0,
+			0x1bd0a00, 0x1c10a00, 0x1c50300, 0x1c90300, 0x1cd0300, 0x1d10300, 0x0, 0x1d50300, 0x1d90300, 0x1dd0300,
+			0x1e10300, 0x1e50300, 0x1e90300, 0x1ed0a00, 0x1f10a00, 0x0, 0x0, 0x1f50300, 0x1f90300, 0x1fd0300,
+			0x2010300, 0x2050300, 0x2090300, 0x20d0a00, 0x0, 0x0, 0x2112300, 0x2152300, 0x2190300, 0x21d0300,
+			0x2210300, 0x2250300, 0x0, 0x0, 0x2290300, 0x22d0300, 0x2310300, 0x2350300, 0x2390300, 0x23d0300,
+			0x2412300, 0x2452300, 0x2490300, 0x24d0300, 0x2510300, 0x2550300, 0x2592300, 0x25d2300, 0x2610300,
+			0x2650300, 0x2690300, 0x26d0300, 0x0, 0x0, 0x2712300, 0x2752300, 0x2792300, 0x27d2300, 0x2810300,
+			0x2850300, 0x2890300, 0x28d0300, 0x2910300, 0x2950300, 0x2990300, 0x29d0300, 0x2a10300, 0x2a50300,
+			0x2a90300, 0x2ad0300, 0x2b10300, 0x2b50300, 0x2b90300, 0x2bd0300, 0x2c10300, 0x2c50300, 0x2c90300,
+			0x2cd2a00, 0x2d02300, 0x2d42300, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x2d82300, 0x2dc2300, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x2e00a00, 0x2e50a00, 0x2ea0a00, 0x2ef0a00, 0x2f30a00, 0x2f70a00, 0x2fb0a00, 0x2ff0a00,
+			0x3030a00, 0x3070300, 0x30b0300, 0x30f0300, 0x3130300, 0x3170300, 0x31b0300, 0x31f0300, 0x3230300,
+			0x3270300, 0x32c0300, 0x3310300, 0x3360300, 0x33b0300, 0x3400300, 0x3450300, 0x34a0300, 0x0, 0x34f0300,
+			0x3540300, 0x3590300, 0x35e0300, 0x3630300, 0x3670300, 0x0, 0x0, 0x36b0300, 0x36f0300, 0x3730300,
+			0x3770300, 0x37b2300, 0x37f2300, 0x3830300, 0x3880300, 0x38d0300, 0x3910300, 0x3950300, 0x3990a00,
+			0x39d0a00, 0x3a10a00, 0x3a50300, 0x3a90300, 0x0, 0x0, 0x3ad0300, 0x3b10300, 0x3b50300, 0x3ba0300,
+			0x3bf0300, 0x3c30300, 0x3c70300, 0x3cb0300, 0x3cf0300, 0x3d30300, 0x3d70300, 0x3db0300, 0x3df0300,
+			0x3e30300, 0x3e70300, 0x3eb0300, 0x3ef0300, 0x3f30300, 0x3f70300, 0x3fb0300, 0x3ff0300, 0x4030300,
+			0x4070300, 0x40b0300, 0x40f0300, 0x4130300, 0x4170300, 0x41b0300, 0x41f0300, 0x4230300, 0x4270300,
+			0x42b0300, 0x42f0300, 0x4330300, 0x4370300, 0x43b0300, 0x0, 0x0, 0x43f0300, 0x4430300, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x4472300, 0x44b2300, 0x44f2300, 0x4532300, 0x4570300, 0x45c0300, 0x4610300, 0x4660300,
+			0x46b2300, 0x46f2300, 0x4730300, 0x4780300, 0x47d0300, 0x4810300, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x2000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4850a00, 0x4880a00, 0x48b0a00, 0x48e0a00,
+			0x4910a00, 0x4940a00, 0x4970a00, 0x49a0a00, 0x49d0a00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x4a00a00, 0x4a40a00, 0x4a80a00, 0x4ac0a00, 0x4b00a00, 0x4b40a00, 0x0, 0x0, 0x4b80a00, 0x4bb0a00,
+			0x4be0a00, 0x4c10a00, 0x4c40a00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10e6, 0x10e6, 0x10e6, 0x10e6, 0x10e6,
+			0xe6, 0x10e6, 0x10e6, 0x10e6, 0x10e6, 0x10e6, 0x10e6, 0x10e6, 0xe6, 0xe6, 0x10e6, 0xe6, 0x10e6, 0xe6,
+			0x10e6, 0x10e6, 0xe8, 0xdc, 0xdc, 0xdc, 0xdc, 0xe8, 0x10d8, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xca, 0xca,
+			0x10dc, 0x10dc, 0x10dc, 0x10dc, 0x10ca, 0x10ca, 0xdc, 0xdc, 0xdc, 0xdc, 0x10dc, 0x10dc, 0xdc, 0x10dc,
+			0x10dc, 0xdc, 0xdc, 0x1, 0x1, 0x1, 0x1, 0x1001, 0xdc, 0xdc, 0xdc, 0xdc, 0xe6, 0xe6, 0xe6, 0x4c70fe6,
+			0x4ca0fe6, 0x10e6, 0x4cd0fe6, 0x4d00fe6, 0x10f0, 0xe6, 0xdc, 0xdc, 0xdc, 0xe6, 0xe6, 0xe6, 0xdc, 0xdc,
+			0x0, 0xe6, 0xe6, 0xe6, 0xdc, 0xdc, 0xdc, 0xdc, 0xe6, 0xe8, 0xdc, 0xdc, 0xe6, 0xe9, 0xea, 0xea, 0xe9,
+			0xea, 0xea, 0xe9, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0x0,
+			0x0, 0x0, 0x0, 0x4d40f00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4d70a00, 0x0, 0x0, 0x0, 0x4db0f00, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x4de0a00, 0x4e20b00, 0x4e90300, 0x4ed0f00, 0x4f00300, 0x4f40300, 0x4f80300, 0x0, 0x4fc0300,
+			0x0, 0x5000300, 0x5040300, 0x5080300, 0x2000, 0x0, 0x0, 0x0, 0x2000, 0x0, 0x2000, 0x0, 0x2000, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x2000, 0x0, 0x2000, 0x0, 0x0, 0x0, 0x2000, 0x0, 0x0, 0x0, 0x2000, 0x50d0300, 0x5110300,
+			0x5152300, 0x5190300, 0x51d2300, 0x5210300, 0x5250300, 0x2000, 0x0, 0x0, 0x0, 0x2000, 0x0, 0x2000, 0x0,
+			0x2000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2000, 0x0, 0x2000, 0x0, 0x0, 0x0, 0x2000, 0x0, 0x0, 0x0, 0x2000,
+			0x52a2300, 0x52e2300, 0x5320300, 0x5360300, 0x53a2300, 0x0, 0x53e0a00, 0x5410a00, 0x5442a00, 0x5470b00,
+			0x54d0b00, 0x5530a00, 0x5560a00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5590a00, 0x55c0a00, 0x55f0a00, 0x0, 0x5620a00,
+			0x5650a00, 0x0, 0x0, 0x0, 0x5680a00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x56b0300, 0x56f0300, 0x0, 0x5730300,
+			0x0, 0x0, 0x2000, 0x5770300, 0x0, 0x0, 0x0, 0x0, 0x57b0300, 0x57f0300, 0x5830300, 0x0, 0x2000, 0x0, 0x0,
+			0x2000, 0x0, 0x2000, 0x2000, 0x2000, 0x2000, 0x5870300, 0x2000, 0x0, 0x0, 0x0, 0x2000, 0x0, 0x0, 0x0,
+			0x0, 0x2000, 0x0, 0x0, 0x0, 0x2000, 0x0, 0x0, 0x0, 0x2000, 0x0, 0x2000, 0x0, 0x0, 0x2000, 0x0, 0x0,
+			0x2000, 0x0, 0x2000, 0x2000, 0x2000, 0x2000, 0x58b0300, 0x2000, 0x0, 0x0, 0x0, 0x2000, 0x0, 0x0, 0x0,
+			0x0, 0x2000, 0x0, 0x0, 0x0, 0x2000, 0x0, 0x0, 0x0, 0x2000, 0x0, 0x2000, 0x0, 0x0, 0x58f0300, 0x5930300,
+			0x0, 0x5970300, 0x0, 0x0, 0x2000, 0x59b0300, 0x0, 0x0, 0x0, 0x0, 0x59f0300, 0x5a30300, 0x5a70300, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x2000, 0x2000, 0x5ab0300, 0x5af0300, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0xe6,
+			0xe6, 0xe6, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5b30300, 0x5b70300, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x5bb0300, 0x5bf0300, 0x5c30300, 0x5c70300, 0x0, 0x0, 0x5cb0300, 0x5cf0300,
+			0x2000, 0x2000, 0x5d30300, 0x5d70300, 0x5db0300, 0x5df0300, 0x5e30300, 0x5e70300, 0x0, 0x0, 0x5eb0300,
+			0x5ef0300, 0x5f30300, 0x5f70300, 0x5fb0300, 0x5ff0300, 0x2000, 0x2000, 0x6030300, 0x6070300, 0x60b0300,
+			0x60f0300, 0x6130300, 0x6170300, 0x61b0300, 0x61f0300, 0x6230300, 0x6270300, 0x62b0300, 0x62f0300, 0x0,
+			0x0, 0x6330300, 0x6370300, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x63b0a00,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdc, 0xe6, 0xe6, 0xe6, 0xe6, 0xdc, 0xe6, 0xe6, 0xe6, 0xde,
+			0xdc, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xe6, 0xe6, 0xdc, 0xe6,
+			0xe6, 0xde, 0xe4, 0xe6, 0xa, 0xb, 0xc, 0xd, 0xe, 0xf, 0x10, 0x11, 0x12, 0x13, 0x13, 0x14, 0x15, 0x16,
+			0x0, 0x17, 0x0, 0x18, 0x19, 0x0, 0xe6, 0xdc, 0x0, 0x12, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0x1e,
+			0x1f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x63f0300, 0x6430300, 0x6470300, 0x64b0300, 0x64f0300,
+			0x2000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2000, 0x0, 0x2000, 0x1b, 0x1c, 0x1d,
+			0x1e, 0x1f, 0x20, 0x21, 0x22, 0x10e6, 0x10e6, 0x10dc, 0xdc, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xdc, 0xe6,
+			0xe6, 0xdc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x23, 0x0,
+			0x0, 0x0, 0x0, 0x6530a00, 0x6570a00, 0x65b0a00, 0x65f0a00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6630300,
+			0x2000, 0x6670300, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2000,
+			0x66b0300, 0x0, 0x2000, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0x0, 0x0, 0xe6, 0xe6, 0xe6, 0xe6,
+			0xdc, 0xe6, 0x0, 0x0, 0xe6, 0xe6, 0x0, 0xdc, 0xe6, 0xe6, 0xdc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0xdc, 0xe6,
+			0xe6, 0xdc, 0xe6, 0xe6, 0xdc, 0xdc, 0xdc, 0xe6, 0xdc, 0xdc, 0xe6, 0xdc, 0xe6, 0xe6, 0xe6, 0xdc, 0xe6,
+			0xdc, 0xe6, 0xdc, 0xe6, 0xdc, 0xe6, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xdc, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdc,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0xe6, 0xe6, 0xe6, 0xe6, 0x0, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0x0,
+			0xe6, 0xe6, 0xe6, 0x0, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdc, 0xdc, 0xdc, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0xe6, 0xdc, 0xdc, 0xdc, 0xe6, 0xe6, 0xe6, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
+			0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0x0, 0xdc, 0xe6, 0xe6, 0xdc, 0xe6, 0xe6, 0xdc, 0xe6,
+			0xe6, 0xe6, 0xdc, 0xdc, 0xdc, 0x1b, 0x1c, 0x1d, 0xe6, 0xe6, 0xe6, 0xdc, 0xe6, 0xe6, 0xdc, 0xdc, 0xe6,
+			0xe6, 0xe6, 0xe6, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2000, 0x66f0300, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x2000, 0x6730300, 0x0, 0x2000, 0x6770300, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1007, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0x0, 0x0, 0x0, 0xe6,
+			0xdc, 0xe6, 0xe6, 0x0, 0x0, 0x0, 0x67b0f00, 0x67f0f00, 0x6830f00, 0x6870f00, 0x68b0f00, 0x68f0f00,
+			0x6930f00, 0x6970f00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0x0, 0x1000, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x2000, 0x0, 0x0, 0x0, 0x69b0300, 0x69f0300, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x1000, 0x0, 0x0, 0x0, 0x0, 0x6a30f00, 0x6a70f00, 0x0, 0x6ab0f00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x6af0f00, 0x0, 0x0, 0x6b30f00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x6b70f00, 0x6bb0f00, 0x6bf0f00, 0x0, 0x0, 0x6c30f00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x2000, 0x6c70300, 0x0, 0x0, 0x6cb0300, 0x6cf0300, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x1000, 0x1000, 0x0, 0x0, 0x0, 0x0, 0x6d30f00, 0x6d70f00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2000, 0x0, 0x6db0300, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1000, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x2000, 0x2000, 0x0, 0x0, 0x6df0300, 0x6e30300, 0x6e70300, 0x9, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x1000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x2000, 0x0, 0x6eb0300, 0x0, 0x0, 0x0, 0x0, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x54, 0x105b, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0x0, 0x0, 0x2000,
+			0x6ef0300, 0x0, 0x1000, 0x0, 0x0, 0x0, 0x2000, 0x6f30300, 0x6f70300, 0x0, 0x6fb2300, 0x6ff0300, 0x0,
+			0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1000, 0x1000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0x9, 0x0, 0x1000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2000, 0x2000,
+			0x0, 0x0, 0x7040300, 0x7080300, 0x70c0300, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1000,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1009, 0x0,
+			0x0, 0x0, 0x0, 0x1000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2000, 0x7100300, 0x0, 0x7142300,
+			0x7180300, 0x71d0300, 0x1000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x7210a00, 0x0, 0x0, 0x0, 0x0, 0x67, 0x67, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6b, 0x6b, 0x6b, 0x6b, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7250a00, 0x0, 0x0, 0x0, 0x0, 0x76, 0x76, 0x9, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7a, 0x7a, 0x7a, 0x7a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7290a00, 0x72d0a00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7310a00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0xdc, 0xdc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdc, 0x0, 0xdc, 0x0, 0xd8, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x7340f00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7380f00, 0x0, 0x0, 0x0,
+			0x0, 0x73c0f00, 0x0, 0x0, 0x0, 0x0, 0x7400f00, 0x0, 0x0, 0x0, 0x0, 0x7440f00, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7480f00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x81, 0x82, 0x74c0f00,
+			0x84, 0x7500f00, 0x7540f00, 0x7580a00, 0x75d0f00, 0x7610a00, 0x82, 0x82, 0x82, 0x82, 0x0, 0x0, 0x82,
+			0x7660f00, 0xe6, 0xe6, 0x9, 0x0, 0xe6, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x76a0f00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x76e0f00, 0x0, 0x0, 0x0, 0x0, 0x7720f00, 0x0,
+			0x0, 0x0, 0x0, 0x7760f00, 0x0, 0x0, 0x0, 0x0, 0x77a0f00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x77e0f00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdc, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2000, 0x7820300, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1000, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0x0, 0x9, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7860a00, 0x0, 0x0, 0x0, 0x2000,
+			0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000,
+			0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+			0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+			0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+			0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0xe6, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe4, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0xde, 0xe6, 0xdc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0xdc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0x0, 0x0, 0xdc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc,
+			0xdc, 0xe6, 0xe6, 0xdc, 0x0, 0xdc, 0xdc, 0xe6, 0xe6, 0xdc, 0xdc, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xdc,
+			0xe6, 0xe6, 0xe6, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2000, 0x7890300, 0x2000, 0x78d0300, 0x2000, 0x7910300, 0x2000,
+			0x7950300, 0x2000, 0x7990300, 0x0, 0x0, 0x2000, 0x79d0300, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x7, 0x1000, 0x0, 0x0, 0x0, 0x0, 0x2000, 0x7a10300, 0x2000, 0x7a50300, 0x2000, 0x2000,
+			0x7a90300, 0x7ad0300, 0x2000, 0x7b10300, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0xdc, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0x9, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0xe6, 0xe6, 0x0, 0x1,
+			0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xe6, 0xe6, 0xdc, 0xdc, 0xdc, 0xdc, 0xe6, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1,
+			0x1, 0x1, 0x0, 0x0, 0x0, 0x0, 0xdc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0x0, 0x0, 0x0, 0xe6, 0xe6, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7b50a00,
+			0x7b80a00, 0x7bb0a00, 0x0, 0x7be0a00, 0x7c10a00, 0x7c40a00, 0x7c70a00, 0x7ca0a00, 0x7cd0a00, 0x7d00a00,
+			0x7d30a00, 0x7d60a00, 0x7d90a00, 0x7dc0a00, 0x0, 0x7df0a00, 0x7e20a00, 0x7e50a00, 0x7e80a00, 0x7eb0a00,
+			0x7ee0a00, 0x7f10a00, 0x7f40a00, 0x7f70a00, 0x7fa0a00, 0x7fd0a00, 0x8000a00, 0x8030a00, 0x8060a00,
+			0x8090a00, 0x80c0a00, 0x80f0a00, 0x8120a00, 0x0, 0x8150a00, 0x8180a00, 0x81b0a00, 0x81e0a00, 0x8210a00,
+			0x8240a00, 0x8270a00, 0x82a0a00, 0x82d0a00, 0x8300a00, 0x8330a00, 0x8360a00, 0x8390a00, 0x83c0a00,
+			0x83f0a00, 0x8420a00, 0x8450a00, 0x8480a00, 0x84b0a00, 0x84e0a00, 0x8510a00, 0x8540a00, 0x8570a00,
+			0x85a0a00, 0x85d0a00, 0x8600a00, 0x8630a00, 0x8660a00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x8690a00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x86c0a00, 0x86f0a00, 0x8720a00, 0x8750a00, 0x8780a00, 0x87b0a00, 0x87e0a00, 0x8810a00, 0x8840a00,
+			0x8870a00, 0x88a0a00, 0x88d0a00, 0x8900a00, 0x8930a00, 0x8960a00, 0x8990a00, 0x89c0a00, 0x89f0a00,
+			0x8a20a00, 0x8a50a00, 0x8a80a00, 0x8ab0a00, 0x8ae0a00, 0x8b10a00, 0x8b40a00, 0x8b70a00, 0x8ba0a00,
+			0x8bd0a00, 0x8c00a00, 0x8c30a00, 0x8c60a00, 0x8c90a00, 0x8cc0a00, 0x8cf0a00, 0x8d20a00, 0x8d50a00,
+			0x8d80a00, 0xe6, 0xe6, 0xdc, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xdc, 0xe6, 0xe6, 0xea, 0xd6,
+			0xdc, 0xca, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
+			0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
+			0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe8, 0xe4, 0xe4, 0xdc, 0xda, 0xe6, 0xe9, 0xdc, 0xe6, 0xdc, 0x8db0300,
+			0x8df0300, 0x8e30300, 0x8e70300, 0x8eb0300, 0x8ef0300, 0x8f30300, 0x8f70300, 0x8fb0300, 0x9000300,
+			0x9050300, 0x9090300, 0x90d0300, 0x9110300, 0x9150300, 0x9190300, 0x91d0300, 0x9210300, 0x9250300,
+			0x9290300, 0x92d0300, 0x9320300, 0x9370300, 0x93c0300, 0x9410300, 0x9450300, 0x9490300, 0x94d0300,
+			0x9510300, 0x9560300, 0x95b0300, 0x95f0300, 0x9630300, 0x9670300, 0x96b0300, 0x96f0300, 0x9730300,
+			0x9770300, 0x97b0300, 0x97f0300, 0x9830300, 0x9870300, 0x98b0300, 0x98f0300, 0x9930300, 0x9970300,
+			0x99b0300, 0x9a00300, 0x9a50300, 0x9a90300, 0x9ad0300, 0x9b10300, 0x9b50300, 0x9b90300, 0x9bd2300,
+			0x9c12300, 0x9c50300, 0x9ca0300, 0x9cf0300, 0x9d30300, 0x9d70300, 0x9db0300, 0x9df0300, 0x9e30300,
+			0x9e70300, 0x9eb0300, 0x9ef0300, 0x9f30300, 0x9f70300, 0x9fb0300, 0x9ff0300, 0xa030300, 0xa070300,
+			0xa0b0300, 0xa0f0300, 0xa130300, 0xa170300, 0xa1c0300, 0xa210300, 0xa260300, 0xa2b0300, 0xa300300,
+			0xa350300, 0xa3a0300, 0xa3f0300, 0xa430300, 0xa470300, 0xa4b0300, 0xa4f0300, 0xa530300, 0xa572300,
+			0xa5b2300, 0xa5f0300, 0xa640300, 0xa690300, 0xa6d0300, 0xa710300, 0xa750300, 0xa792300, 0xa7d2300,
+			0xa810300, 0xa860300, 0xa8b0300, 0xa900300, 0xa950300, 0xa9a0300, 0xa9f0300, 0xaa30300, 0xaa70300,
+			0xaab0300, 0xaaf0300, 0xab30300, 0xab70300, 0xabb0300, 0xabf0300, 0xac30300, 0xac70300, 0xacb0300,
+			0xacf0300, 0xad30300, 0xad70300, 0xadc0300, 0xae10300, 0xae60300, 0xaeb0300, 0xaef0300, 0xaf30300,
+			0xaf70300, 0xafb0300, 0xaff0300, 0xb030300, 0xb070300, 0xb0b0300, 0xb0f0300, 0xb130300, 0xb170300,
+			0xb1b0300, 0xb1f0300, 0xb230300, 0xb270300, 0xb2b0300, 0xb2f0300, 0xb330300, 0xb370300, 0xb3b0300,
+			0xb3f0300, 0xb430300, 0xb470300, 0xb4b0300, 0xb4f0300, 0xb530300, 0xb570300, 0xb5b0300, 0xb5f0300,
+			0xb630a00, 0xb670b00, 0x0, 0x0, 0x0, 0x0, 0xb6d2300, 0xb712300, 0xb750300, 0xb790300, 0xb7d0300,
+			0xb820300, 0xb870300, 0xb8c0300, 0xb910300, 0xb960300, 0xb9b0300, 0xba00300, 0xba50300, 0xbaa0300,
+			0xbaf0300, 0xbb40300, 0xbb90300, 0xbbe0300, 0xbc30300, 0xbc80300, 0xbcd0300, 0xbd20300, 0xbd70300,
+			0xbdc0300, 0xbe12300, 0xbe52300, 0xbe90300, 0xbed0300, 0xbf10300, 0xbf50300, 0xbf90300, 0xbfe0300,
+			0xc030300, 0xc080300, 0xc0d0300, 0xc120300, 0xc170300, 0xc1c0300, 0xc210300, 0xc260300, 0xc2b0300,
+			0xc2f0300, 0xc330300, 0xc370300, 0xc3b2300, 0xc3f2300, 0xc430300, 0xc470300, 0xc4b0300, 0xc500300,
+			0xc550300, 0xc5a0300, 0xc5f0300, 0xc640300, 0xc690300, 0xc6e0300, 0xc730300, 0xc780300, 0xc7d0300,
+			0xc820300, 0xc870300, 0xc8c0300, 0xc910300, 0xc960300, 0xc9b0300, 0xca00300, 0xca50300, 0xcaa0300,
+			0xcaf0300, 0xcb30300, 0xcb70300, 0xcbb0300, 0xcbf0300, 0xcc40300, 0xcc90300, 0xcce0300, 0xcd30300,
+			0xcd80300, 0xcdd0300, 0xce20300, 0xce70300, 0xcec0300, 0xcf10300, 0xcf50300, 0xcf90300, 0xcfd0300,
+			0xd010300, 0xd050300, 0xd090300, 0xd0d0300, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd112300, 0xd152300,
+			0xd192300, 0xd1e2300, 0xd232300, 0xd282300, 0xd2d2300, 0xd322300, 0xd372300, 0xd3b2300, 0xd3f2300,
+			0xd442300, 0xd492300, 0xd4e2300, 0xd532300, 0xd582300, 0xd5d2300, 0xd612300, 0xd650300, 0xd6a0300,
+			0xd6f0300, 0xd740300, 0x0, 0x0, 0xd792300, 0xd7d2300, 0xd810300, 0xd860300, 0xd8b0300, 0xd900300, 0x0,
+			0x0, 0xd952300, 0xd992300, 0xd9d2300, 0xda22300, 0xda72300, 0xdac2300, 0xdb12300, 0xdb62300, 0xdbb2300,
+			0xdbf2300, 0xdc32300, 0xdc82300, 0xdcd2300, 0xdd22300, 0xdd72300, 0xddc2300, 0xde12300, 0xde52300,
+			0xde90300, 0xdee0300, 0xdf30300, 0xdf80300, 0xdfd0300, 0xe020300, 0xe072300, 0xe0b2300, 0xe0f0300,
+			0xe140300, 0xe190300, 0xe1e0300, 0xe230300, 0xe280300, 0xe2d2300, 0xe312300, 0xe350300, 0xe3a0300,
+			0xe3f0300, 0xe440300, 0x0, 0x0, 0xe492300, 0xe4d2300, 0xe510300, 0xe560300, 0xe5b0300, 0xe600300, 0x0,
+			0x0, 0xe652300, 0xe692300, 0xe6d0300, 0xe720300, 0xe770300, 0xe7c0300, 0xe810300, 0xe860300, 0x0,
+			0xe8b2300, 0x0, 0xe8f0300, 0x0, 0xe940300, 0x0, 0xe990300, 0xe9e2300, 0xea22300, 0xea62300, 0xeab2300,
+			0xeb02300, 0xeb52300, 0xeba2300, 0xebf2300, 0xec42300, 0xec82300, 0xecc2300, 0xed12300, 0xed62300,
+			0xedb2300, 0xee02300, 0xee52300, 0xeea2300, 0xeee0f00, 0xef20300, 0xef60f00, 0xefa2300, 0xefe0f00,
+			0xf020300, 0xf060f00, 0xf0a0300, 0xf0e0f00, 0xf120300, 0xf160f00, 0xf1a2300, 0xf1e0f00, 0x0, 0x0,
+			0xf220300, 0xf270300, 0xf2c0300, 0xf320300, 0xf380300, 0xf3e0300, 0xf440300, 0xf4a0300, 0xf500300,
+			0xf550300, 0xf5a0300, 0xf600300, 0xf660300, 0xf6c0300, 0xf720300, 0xf780300, 0xf7e0300, 0xf830300,
+			0xf880300, 0xf8e0300, 0xf940300, 0xf9a0300, 0xfa00300, 0xfa60300, 0xfac0300, 0xfb10300, 0xfb60300,
+			0xfbc0300, 0xfc20300, 0xfc80300, 0xfce0300, 0xfd40300, 0xfda0300, 0xfdf0300, 0xfe40300, 0xfea0300,
+			0xff00300, 0xff60300, 0xffc0300, 0x10020300, 0x10080300, 0x100d0300, 0x10120300, 0x10180300, 0x101e0300,
+			0x10240300, 0x102a0300, 0x10300300, 0x10360300, 0x103a0300, 0x103e0300, 0x10430300, 0x10470300, 0x0,
+			0x104c2300, 0x10500300, 0x10550300, 0x10590300, 0x105d0300, 0x10610f00, 0x10650300, 0x10690a00,
+			0x106d0f00, 0x10702a00, 0x10740a00, 0x10780b00, 0x107f0300, 0x10840300, 0x10880300, 0x0, 0x108d2300,
+			0x10910300, 0x10960300, 0x109a0f00, 0x109e0300, 0x10a20f00, 0x10a60300, 0x10aa0b00, 0x10b10b00,
+			0x10b80b00, 0x10bf0300, 0x10c30300, 0x10c70300, 0x10cc0f00, 0x0, 0x0, 0x10d10300, 0x10d50300,
+			0x10da0300, 0x10de0300, 0x10e20300, 0x10e60f00, 0x0, 0x10ea0b00, 0x10f10b00, 0x10f80b00, 0x10ff0300,
+			0x11030300, 0x11070300, 0x110c0f00, 0x11110300, 0x11150300, 0x11190300, 0x111d0300, 0x11220300,
+			0x11260300, 0x112a0300, 0x112e0f00, 0x11320300, 0x11360b00, 0x113d0f00, 0x11440f00, 0x0, 0x0,
+			0x11470300, 0x114c0300, 0x11500300, 0x0, 0x11552300, 0x11590300, 0x115e0300, 0x11620f00, 0x11660300,
+			0x116a0f00, 0x116e0300, 0x11720f00, 0x11772a00, 0x0, 0x117b0f00, 0x117f0f00, 0x11830a00, 0x11860a00,
+			0x11890a00, 0x118c0a00, 0x118f0a00, 0x11920a00, 0x11950a00, 0x11980a00, 0x119b0a00, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x119e0a00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x11a10a00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x11a50a00, 0x11a80a00, 0x11ac0a00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x11b10a00,
+			0x0, 0x0, 0x0, 0x11b40a00, 0x11b80a00, 0x0, 0x11bd0a00, 0x11c10a00, 0x0, 0x0, 0x0, 0x0, 0x11c60a00, 0x0,
+			0x11ca0a00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x11ce0a00, 0x11d20a00, 0x11d60a00, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x11da0a00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x11e00a00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x11e30a00,
+			0x11e60a00, 0x0, 0x0, 0x11e90a00, 0x11ec0a00, 0x11ef0a00, 0x11f20a00, 0x11f50a00, 0x11f80a00,
+			0x11fb0a00, 0x11fe0a00, 0x12010a00, 0x12040a00, 0x12070a00, 0x120a0a00, 0x120d0a00, 0x12100a00,
+			0x12130a00, 0x12160a00, 0x12190a00, 0x121c0a00, 0x121f0a00, 0x12220a00, 0x12250a00, 0x12280a00,
+			0x122b0a00, 0x122e0a00, 0x12310a00, 0x12340a00, 0x12370a00, 0x0, 0x123a0a00, 0x123d0a00, 0x12400a00,
+			0x12430a00, 0x12460a00, 0x12490a00, 0x124c0a00, 0x124f0a00, 0x12520a00, 0x12550a00, 0x12580a00,
+			0x125b0a00, 0x125e0a00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x12610a00, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0xe6, 0x1, 0x1,
+			0xe6, 0xe6, 0xe6, 0xe6, 0x1, 0x1, 0x1, 0xe6, 0xe6, 0x0, 0x0, 0x0, 0x0, 0xe6, 0x0, 0x0, 0x0, 0x1, 0x1,
+			0xe6, 0xdc, 0xe6, 0x1, 0x1, 0xdc, 0xdc, 0xdc, 0xdc, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x12650a00, 0x126a0a00, 0x126f0a00, 0x12720a00, 0x0, 0x12760a00,
+			0x127b0a00, 0x12800a00, 0x0, 0x12830a00, 0x12870a00, 0x128a0a00, 0x128d0a00, 0x12900a00, 0x12930a00,
+			0x12960a00, 0x12990a00, 0x129c0a00, 0x129f0a00, 0x12a20a00, 0x0, 0x12a50a00, 0x12a80a00, 0x0, 0x0,
+			0x12ac0a00, 0x12af0a00, 0x12b20a00, 0x12b50a00, 0x12b80a00, 0x0, 0x0, 0x12bb0a00, 0x12bf0a00,
+			0x12c40a00, 0x0, 0x12c80a00, 0x0, 0x12cb0f00, 0x0, 0x12ce0a00, 0x0, 0x12d10f00, 0x12d40f00, 0x12d80a00,
+			0x12db0a00, 0x0, 0x12de0a00, 0x12e10a00, 0x12e40a00, 0x0, 0x12e70a00, 0x12ea0a00, 0x12ed0a00,
+			0x12f00a00, 0x12f30a00, 0x12f60a00, 0x12f90a00, 0x0, 0x12fc0a00, 0x13010a00, 0x13040a00, 0x13070a00,
+			0x130a0a00, 0x130d0a00, 0x0, 0x0, 0x0, 0x0, 0x13100a00, 0x13130a00, 0x13160a00, 0x13190a00, 0x131c0a00,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x131f0a00, 0x13240a00, 0x13290a00, 0x132f0a00, 0x13340a00, 0x13390a00,
+			0x133e0a00, 0x13430a00, 0x13480a00, 0x134d0a00, 0x13520a00, 0x13570a00, 0x135c0a00, 0x13610a00,
+			0x13660a00, 0x136b0a00, 0x136f0a00, 0x13720a00, 0x13760a00, 0x137b0a00, 0x137f0a00, 0x13820a00,
+			0x13860a00, 0x138b0a00, 0x13910a00, 0x13950a00, 0x13980a00, 0x139c0a00, 0x13a10a00, 0x13a40a00,
+			0x13a70a00, 0x13aa0a00, 0x13ad0a00, 0x13b00a00, 0x13b40a00, 0x13b90a00, 0x13bd0a00, 0x13c00a00,
+			0x13c40a00, 0x13c90a00, 0x13cf0a00, 0x13d30a00, 0x13d60a00, 0x13da0a00, 0x13df0a00, 0x13e20a00,
+			0x13e50a00, 0x13e80a00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x13eb0a00, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x2000, 0x0, 0x2000, 0x0, 0x2000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x13f00300, 0x13f40300, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x13f80300, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x13fc0300, 0x14000300, 0x14040300, 0x2000, 0x0, 0x2000, 0x0, 0x2000,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2000, 0x14080300, 0x0, 0x0, 0x0,
+			0x2000, 0x140c0300, 0x0, 0x2000, 0x14100300, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2000, 0x14140300, 0x2000, 0x14180300, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x141c0a00, 0x14200a00, 0x0, 0x14250a00, 0x14290a00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x2000, 0x0, 0x0, 0x0, 0x0, 0x142e0300, 0x0, 0x2000, 0x14320300, 0x2000, 0x0, 0x14360300,
+			0x2000, 0x143a0300, 0x0, 0x0, 0x0, 0x2000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x143e0300, 0x2000, 0x14420300, 0x0, 0x2000, 0x2000, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x14460300, 0x144a0300, 0x144e0300, 0x14520300, 0x14560300, 0x2000, 0x2000, 0x145a0300,
+			0x145e0300, 0x2000, 0x2000, 0x14620300, 0x14660300, 0x2000, 0x2000, 0x2000, 0x2000, 0x0, 0x0,
+			0x146a0300, 0x146e0300, 0x2000, 0x2000, 0x14720300, 0x14760300, 0x2000, 0x2000, 0x147a0300, 0x147e0300,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2000, 0x2000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x2000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2000, 0x2000, 0x0, 0x2000, 0x14820300,
+			0x14860300, 0x148a0300, 0x148e0300, 0x0, 0x0, 0x2000, 0x2000, 0x2000, 0x2000, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x14920300, 0x14960300, 0x149a0300, 0x149e0300, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x14a20300, 0x14a60300, 0x14aa0300, 0x14ae0300, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x14b20f00, 0x14b50f00,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x14b80a00, 0x14bb0a00, 0x14be0a00, 0x14c10a00, 0x14c40a00, 0x14c70a00, 0x14ca0a00, 0x14cd0a00,
+			0x14d00a00, 0x14d30a00, 0x14d70a00, 0x14db0a00, 0x14df0a00, 0x14e30a00, 0x14e70a00, 0x14eb0a00,
+			0x14ef0a00, 0x14f30a00, 0x14f70a00, 0x14fb0a00, 0x14ff0a00, 0x15040a00, 0x15090a00, 0x150e0a00,
+			0x15130a00, 0x15180a00, 0x151d0a00, 0x15220a00, 0x15270a00, 0x152c0a00, 0x15320a00, 0x15380a00,
+			0x153e0a00, 0x15440a00, 0x154a0a00, 0x15500a00, 0x15560a00, 0x155c0a00, 0x15620a00, 0x15680a00,
+			0x156e0a00, 0x15720a00, 0x15760a00, 0x157a0a00, 0x157e0a00, 0x15820a00, 0x15860a00, 0x158a0a00,
+			0x158e0a00, 0x15920a00, 0x15970a00, 0x159c0a00, 0x15a10a00, 0x15a60a00, 0x15ab0a00, 0x15b00a00,
+			0x15b50a00, 0x15ba0a00, 0x15bf0a00, 0x15c40a00, 0x15c90a00, 0x15ce0a00, 0x15d30a00, 0x15d80a00,
+			0x15dd0a00, 0x15e20a00, 0x15e70a00, 0x15ec0a00, 0x15f10a00, 0x15f60a00, 0x15fb0a00, 0x16000a00,
+			0x16050a00, 0x160a0a00, 0x160f0a00, 0x16140a00, 0x16190a00, 0x161e0a00, 0x16230a00, 0x16280a00,
+			0x162d0a00, 0x16320a00, 0x16370a00, 0x163c0a00, 0x16410a00, 0x16460a00, 0x164b0a00, 0x164e0a00,
+			0x16510a00, 0x16540a00, 0x16570a00, 0x165a0a00, 0x165d0a00, 0x16600a00, 0x16630a00, 0x16660a00,
+			0x16690a00, 0x166c0a00, 0x166f0a00, 0x16720a00, 0x16750a00, 0x16780a00, 0x167b0a00, 0x167e0a00,
+			0x16810a00, 0x16840a00, 0x16870a00, 0x168a0a00, 0x168d0a00, 0x16900a00, 0x16930a00, 0x16960a00,
+			0x16990a00, 0x169c0a00, 0x169f0a00, 0x16a20a00, 0x16a50a00, 0x16a80a00, 0x16ab0a00, 0x16ae0a00,
+			0x16b10a00, 0x16b40a00, 0x16b70a00, 0x16ba0a00, 0x16bd0a00, 0x16c00a00, 0x16c30a00, 0x16c60a00,
+			0x16c90a00, 0x16cc0a00, 0x16cf0a00, 0x16d20a00, 0x16d50a00, 0x16d80a00, 0x16db0a00, 0x16de0a00,
+			0x16e10a00, 0x16e40a00, 0x16e70a00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x16ea0a00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x16f00a00, 0x16f50a00, 0x16f90a00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x16fe0f00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x17020a00, 0x17050a00,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0xe6, 0xe6,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x17080a00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
+			0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
+			0xe6, 0xe6, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x170b0a00, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x170e0a00, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x17110a00, 0x17140a00, 0x17170a00, 0x171a0a00, 0x171d0a00,
+			0x17200a00, 0x17230a00, 0x17260a00, 0x17290a00, 0x172c0a00, 0x172f0a00, 0x17320a00, 0x17350a00,
+			0x17380a00, 0x173b0a00, 0x173e0a00, 0x17410a00, 0x17440a00, 0x17470a00, 0x174a0a00, 0x174d0a00,
+			0x17500a00, 0x17530a00, 0x17560a00, 0x17590a00, 0x175c0a00, 0x175f0a00, 0x17620a00, 0x17650a00,
+			0x17680a00, 0x176b0a00, 0x176e0a00, 0x17710a00, 0x17740a00, 0x17770a00, 0x177a0a00, 0x177d0a00,
+			0x17800a00, 0x17830a00, 0x17860a00, 0x17890a00, 0x178c0a00, 0x178f0a00, 0x17920a00, 0x17950a00,
+			0x17980a00, 0x179b0a00, 0x179e0a00, 0x17a10a00, 0x17a40a00, 0x17a70a00, 0x17aa0a00, 0x17ad0a00,
+			0x17b00a00, 0x17b30a00, 0x17b60a00, 0x17b90a00, 0x17bc0a00, 0x17bf0a00, 0x17c20a00, 0x17c50a00,
+			0x17c80a00, 0x17cb0a00, 0x17ce0a00, 0x17d10a00, 0x17d40a00, 0x17d70a00, 0x17da0a00, 0x17dd0a00,
+			0x17e00a00, 0x17e30a00, 0x17e60a00, 0x17e90a00, 0x17ec0a00, 0x17ef0a00, 0x17f20a00, 0x17f50a00,
+			0x17f80a00, 0x17fb0a00, 0x17fe0a00, 0x18010a00, 0x18040a00, 0x18070a00, 0x180a0a00, 0x180d0a00,
+			0x18100a00, 0x18130a00, 0x18160a00, 0x18190a00, 0x181c0a00, 0x181f0a00, 0x18220a00, 0x18250a00,
+			0x18280a00, 0x182b0a00, 0x182e0a00, 0x18310a00, 0x18340a00, 0x18370a00, 0x183a0a00, 0x183d0a00,
+			0x18400a00, 0x18430a00, 0x18460a00, 0x18490a00, 0x184c0a00, 0x184f0a00, 0x18520a00, 0x18550a00,
+			0x18580a00, 0x185b0a00, 0x185e0a00, 0x18610a00, 0x18640a00, 0x18670a00, 0x186a0a00, 0x186d0a00,
+			0x18700a00, 0x18730a00, 0x18760a00, 0x18790a00, 0x187c0a00, 0x187f0a00, 0x18820a00, 0x18850a00,
+			0x18880a00, 0x188b0a00, 0x188e0a00, 0x18910a00, 0x18940a00, 0x18970a00, 0x189a0a00, 0x189d0a00,
+			0x18a00a00, 0x18a30a00, 0x18a60a00, 0x18a90a00, 0x18ac0a00, 0x18af0a00, 0x18b20a00, 0x18b50a00,
+			0x18b80a00, 0x18bb0a00, 0x18be0a00, 0x18c10a00, 0x18c40a00, 0x18c70a00, 0x18ca0a00, 0x18cd0a00,
+			0x18d00a00, 0x18d30a00, 0x18d60a00, 0x18d90a00, 0x18dc0a00, 0x18df0a00, 0x18e20a00, 0x18e50a00,
+			0x18e80a00, 0x18eb0a00, 0x18ee0a00, 0x18f10a00, 0x18f40a00, 0x18f70a00, 0x18fa0a00, 0x18fd0a00,
+			0x19000a00, 0x19030a00, 0x19060a00, 0x19090a00, 0x190c0a00, 0x190f0a00, 0x19120a00, 0x19150a00,
+			0x19180a00, 0x191b0a00, 0x191e0a00, 0x19210a00, 0x19240a00, 0x19270a00, 0x192a0a00, 0x192d0a00,
+			0x19300a00, 0x19330a00, 0x19360a00, 0x19390a00, 0x193c0a00, 0x193f0a00, 0x19420a00, 0x19450a00,
+			0x19480a00, 0x194b0a00, 0x194e0a00, 0x19510a00, 0x19540a00, 0x19570a00, 0x195a0a00, 0x195d0a00,
+			0x19600a00, 0x19630a00, 0x19660a00, 0x19690a00, 0x196c0a00, 0x196f0a00, 0x19720a00, 0x19750a00,
+			0x19780a00, 0x197b0a00, 0x197e0a00, 0x19810a00, 0x19840a00, 0x19870a00, 0x198a0a00, 0x198d0a00,
+			0x19900a00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19930a00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xda, 0xe4, 0xe8, 0xde, 0xe0,
+			0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19960a00, 0x0, 0x19990a00, 0x199c0a00, 0x199f0a00, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2000, 0x0, 0x0, 0x0, 0x0, 0x2000, 0x19a20300, 0x2000,
+			0x19a60300, 0x2000, 0x19aa0300, 0x2000, 0x19ae0300, 0x2000, 0x19b20300, 0x2000, 0x19b60300, 0x2000,
+			0x19ba0300, 0x2000, 0x19be0300, 0x2000, 0x19c20300, 0x2000, 0x19c60300, 0x2000, 0x19ca0300, 0x2000,
+			0x19ce0300, 0x0, 0x2000, 0x19d20300, 0x2000, 0x19d60300, 0x2000, 0x19da0300, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x2000, 0x19de0300, 0x19e20300, 0x2000, 0x19e60300, 0x19ea0300, 0x2000, 0x19ee0300, 0x19f20300, 0x2000,
+			0x19f60300, 0x19fa0300, 0x2000, 0x19fe0300, 0x1a020300, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1a060300, 0x0, 0x0, 0x0, 0x0, 0x1008,
+			0x1008, 0x1a0a0a00, 0x1a0e0a00, 0x2000, 0x1a120300, 0x1a160a00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2000,
+			0x0, 0x0, 0x0, 0x0, 0x2000, 0x1a1a0300, 0x2000, 0x1a1e0300, 0x2000, 0x1a220300, 0x2000, 0x1a260300,
+			0x2000, 0x1a2a0300, 0x2000, 0x1a2e0300, 0x2000, 0x1a320300, 0x2000, 0x1a360300, 0x2000, 0x1a3a0300,
+			0x2000, 0x1a3e0300, 0x2000, 0x1a420300, 0x2000, 0x1a460300, 0x0, 0x2000, 0x1a4a0300, 0x2000, 0x1a4e0300,
+			0x2000, 0x1a520300, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2000, 0x1a560300, 0x1a5a0300, 0x2000, 0x1a5e0300,
+			0x1a620300, 0x2000, 0x1a660300, 0x1a6a0300, 0x2000, 0x1a6e0300, 0x1a720300, 0x2000, 0x1a760300,
+			0x1a7a0300, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2000,
+			0x2000, 0x2000, 0x2000, 0x0, 0x1a7e0300, 0x0, 0x0, 0x1a820300, 0x1a860300, 0x1a8a0300, 0x1a8e0300, 0x0,
+			0x0, 0x2000, 0x1a920300, 0x1a960a00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x1a9a0a00, 0x1a9d0a00, 0x1aa00a00, 0x1aa30a00, 0x1aa60a00, 0x1aa90a00, 0x1aac0a00,
+			0x1aaf0a00, 0x1ab20a00, 0x1ab50a00, 0x1ab80a00, 0x1abb0a00, 0x1abe0a00, 0x1ac10a00, 0x1ac40a00,
+			0x1ac70a00, 0x1aca0a00, 0x1acd0a00, 0x1ad00a00, 0x1ad30a00, 0x1ad60a00, 0x1ad90a00, 0x1adc0a00,
+			0x1adf0a00, 0x1ae20a00, 0x1ae50a00, 0x1ae80a00, 0x1aeb0a00, 0x1aee0a00, 0x1af10a00, 0x1af40a00,
+			0x1af70a00, 0x1afa0a00, 0x1afd0a00, 0x1b000a00, 0x1b030a00, 0x1b060a00, 0x1b090a00, 0x1b0c0a00,
+			0x1b0f0a00, 0x1b120a00, 0x1b150a00, 0x1b180a00, 0x1b1b0a00, 0x1b1e0a00, 0x1b210a00, 0x1b240a00,
+			0x1b270a00, 0x1b2a0a00, 0x1b2d0a00, 0x1b300a00, 0x1b330a00, 0x1b360a00, 0x1b390a00, 0x1b3c0a00,
+			0x1b3f0a00, 0x1b420a00, 0x1b450a00, 0x1b480a00, 0x1b4b0a00, 0x1b4e0a00, 0x1b510a00, 0x1b540a00,
+			0x1b570a00, 0x1b5a0a00, 0x1b5d0a00, 0x1b600a00, 0x1b630a00, 0x1b660a00, 0x1b690a00, 0x1b6c0a00,
+			0x1b6f0a00, 0x1b720a00, 0x1b750a00, 0x1b780a00, 0x1b7b0a00, 0x1b7e0a00, 0x1b810a00, 0x1b840a00,
+			0x1b870a00, 0x1b8a0a00, 0x1b8d0a00, 0x1b900a00, 0x1b930a00, 0x1b960a00, 0x1b990a00, 0x1b9c0a00,
+			0x1b9f0a00, 0x1ba20a00, 0x1ba50a00, 0x1ba80a00, 0x1bab0a00, 0x1bae0a00, 0x1bb10a00, 0x0, 0x0, 0x0,
+			0x1bb40a00, 0x1bb70a00, 0x1bba0a00, 0x1bbd0a00, 0x1bc00a00, 0x1bc30a00, 0x1bc60a00, 0x1bc90a00,
+			0x1bcc0a00, 0x1bcf0a00, 0x1bd20a00, 0x1bd50a00, 0x1bd80a00, 0x1bdb0a00, 0x1bde0a00, 0x1be30a00,
+			0x1be80a00, 0x1bed0a00, 0x1bf20a00, 0x1bf70a00, 0x1bfc0a00, 0x1c010a00, 0x1c060a00, 0x1c0b0a00,
+			0x1c100a00, 0x1c150a00, 0x1c1a0a00, 0x1c1f0a00, 0x1c240a00, 0x1c2a0a00, 0x1c300a00, 0x1c360a00,
+			0x1c3c0a00, 0x1c420a00, 0x1c480a00, 0x1c4e0a00, 0x1c540a00, 0x1c5a0a00, 0x1c600a00, 0x1c660a00,
+			0x1c6c0a00, 0x1c720a00, 0x1c780a00, 0x1c7e0a00, 0x1c870a00, 0x0, 0x1c8f0a00, 0x1c940a00, 0x1c990a00,
+			0x1c9e0a00, 0x1ca30a00, 0x1ca80a00, 0x1cad0a00, 0x1cb20a00, 0x1cb70a00, 0x1cbc0a00, 0x1cc10a00,
+			0x1cc60a00, 0x1ccb0a00, 0x1cd00a00, 0x1cd50a00, 0x1cda0a00, 0x1cdf0a00, 0x1ce40a00, 0x1ce90a00,
+			0x1cee0a00, 0x1cf30a00, 0x1cf80a00, 0x1cfd0a00, 0x1d020a00, 0x1d070a00, 0x1d0c0a00, 0x1d110a00,
+			0x1d160a00, 0x1d1b0a00, 0x1d200a00, 0x1d250a00, 0x1d2a0a00, 0x1d2f0a00, 0x1d340a00, 0x1d390a00,
+			0x1d3e0a00, 0x1d430a00, 0x1d460a00, 0x1d490a00, 0x1d4c0a00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x1d4f0a00, 0x1d540a00, 0x1d580a00, 0x1d5c0a00, 0x1d600a00, 0x1d640a00, 0x1d680a00, 0x1d6c0a00,
+			0x1d700a00, 0x1d740a00, 0x1d780a00, 0x1d7c0a00, 0x1d800a00, 0x1d840a00, 0x1d880a00, 0x1d8c0a00,
+			0x1d900a00, 0x1d930a00, 0x1d960a00, 0x1d990a00, 0x1d9c0a00, 0x1d9f0a00, 0x1da20a00, 0x1da50a00,
+			0x1da80a00, 0x1dab0a00, 0x1dae0a00, 0x1db10a00, 0x1db40a00, 0x1db70a00, 0x1dba0a00, 0x1dbe0a00,
+			0x1dc20a00, 0x1dc60a00, 0x1dca0a00, 0x1dce0a00, 0x1dd20a00, 0x1dd60a00, 0x1dda0a00, 0x1dde0a00,
+			0x1de20a00, 0x1de60a00, 0x1dea0a00, 0x1dee0a00, 0x1df20a00, 0x1df90a00, 0x1dff0a00, 0x0, 0x1e030a00,
+			0x1e060a00, 0x1e090a00, 0x1e0c0a00, 0x1e0f0a00, 0x1e120a00, 0x1e150a00, 0x1e180a00, 0x1e1b0a00,
+			0x1e1e0a00, 0x1e210a00, 0x1e240a00, 0x1e270a00, 0x1e2a0a00, 0x1e2d0a00, 0x1e300a00, 0x1e330a00,
+			0x1e360a00, 0x1e390a00, 0x1e3c0a00, 0x1e3f0a00, 0x1e420a00, 0x1e450a00, 0x1e480a00, 0x1e4b0a00,
+			0x1e4e0a00, 0x1e510a00, 0x1e540a00, 0x1e570a00, 0x1e5a0a00, 0x1e5d0a00, 0x1e600a00, 0x1e630a00,
+			0x1e660a00, 0x1e690a00, 0x1e6c0a00, 0x1e6f0a00, 0x1e720a00, 0x1e750a00, 0x1e780a00, 0x1e7b0a00,
+			0x1e7e0a00, 0x1e810a00, 0x1e840a00, 0x1e870a00, 0x1e8a0a00, 0x1e8d0a00, 0x1e900a00, 0x1e930a00,
+			0x1e960a00, 0x1e9a0a00, 0x1e9e0a00, 0x1ea20a00, 0x1ea60a00, 0x1eaa0a00, 0x1eae0a00, 0x1eb20a00,
+			0x1eb60a00, 0x1eba0a00, 0x1ebe0a00, 0x1ec20a00, 0x1ec60a00, 0x1eca0a00, 0x1ece0a00, 0x1ed20a00,
+			0x1ed60a00, 0x1eda0a00, 0x1ede0a00, 0x1ee20a00, 0x1ee60a00, 0x1eea0a00, 0x1eee0a00, 0x1ef20a00,
+			0x1ef60a00, 0x1efb0a00, 0x1f000a00, 0x1f050a00, 0x1f090a00, 0x1f0e0a00, 0x1f120a00, 0x1f170a00,
+			0x1f1a0a00, 0x1f1d0a00, 0x1f200a00, 0x1f230a00, 0x1f260a00, 0x1f290a00, 0x1f2c0a00, 0x1f2f0a00,
+			0x1f320a00, 0x1f350a00, 0x1f380a00, 0x1f3b0a00, 0x1f3e0a00, 0x1f410a00, 0x1f440a00, 0x1f470a00,
+			0x1f4a0a00, 0x1f4d0a00, 0x1f500a00, 0x1f530a00, 0x1f560a00, 0x1f590a00, 0x1f5c0a00, 0x1f5f0a00,
+			0x1f620a00, 0x1f650a00, 0x1f680a00, 0x1f6b0a00, 0x1f6e0a00, 0x1f710a00, 0x1f740a00, 0x1f770a00,
+			0x1f7a0a00, 0x1f7d0a00, 0x1f800a00, 0x1f830a00, 0x1f860a00, 0x1f890a00, 0x1f8c0a00, 0x1f8f0a00,
+			0x1f920a00, 0x1f950a00, 0x1f980a00, 0x1f9b0a00, 0x1f9e0a00, 0x1fa10a00, 0x1fa40a00, 0x1fa80a00,
+			0x1faf0a00, 0x1fb50a00, 0x1fbc0a00, 0x1fc10a00, 0x1fc80a00, 0x1fcd0a00, 0x1fd20a00, 0x1fda0a00,
+			0x1fe00a00, 0x1fe50a00, 0x1fea0a00, 0x1fef0a00, 0x1ff50a00, 0x1ffb0a00, 0x20010a00, 0x20070a00,
+			0x200d0a00, 0x20130a00, 0x20190a00, 0x20210a00, 0x20250a00, 0x202d0a00, 0x20350a00, 0x203c0a00,
+			0x20420a00, 0x204a0a00, 0x20520a00, 0x20580a00, 0x205d0a00, 0x20620a00, 0x20680a00, 0x206e0a00,
+			0x20750a00, 0x207c0a00, 0x20810a00, 0x20860a00, 0x208c0a00, 0x20910a00, 0x20960a00, 0x209a0a00,
+			0x209e0a00, 0x20a30a00, 0x20a80a00, 0x20b00a00, 0x20b60a00, 0x20bd0a00, 0x20c50a00, 0x20cb0a00,
+			0x20d00a00, 0x20d50a00, 0x20dd0a00, 0x20e30a00, 0x20eb0a00, 0x20f00a00, 0x20f70a00, 0x20fc0a00,
+			0x21020a00, 0x21070a00, 0x210d0a00, 0x21140a00, 0x211a0a00, 0x21210a00, 0x21270a00, 0x212b0a00,
+			0x21320a00, 0x21370a00, 0x213c0a00, 0x21420a00, 0x21470a00, 0x214c0a00, 0x21510a00, 0x21580a00,
+			0x215e0a00, 0x21620a00, 0x216a0a00, 0x216f0a00, 0x21760a00, 0x217c0a00, 0x21820a00, 0x21870a00,
+			0x218c0a00, 0x21920a00, 0x21960a00, 0x219c0a00, 0x21a30a00, 0x21a70a00, 0x21af0a00, 0x21b40a00,
+			0x21b80a00, 0x21bc0a00, 0x21c00a00, 0x21c40a00, 0x21c80a00, 0x21cc0a00, 0x21d00a00, 0x21d40a00,
+			0x21d80a00, 0x21dc0a00, 0x21e10a00, 0x21e60a00, 0x21eb0a00, 0x21f00a00, 0x21f50a00, 0x21fa0a00,
+			0x21ff0a00, 0x22040a00, 0x22090a00, 0x220e0a00, 0x22130a00, 0x22180a00, 0x221d0a00, 0x22220a00,
+			0x22270a00, 0x222c0a00, 0x22300a00, 0x22340a00, 0x22390a00, 0x223d0a00, 0x22410a00, 0x22450a00,
+			0x224a0a00, 0x224f0a00, 0x22530a00, 0x22570a00, 0x225b0a00, 0x225f0a00, 0x22630a00, 0x22690a00,
+			0x226d0a00, 0x22710a00, 0x22750a00, 0x22790a00, 0x227d0a00, 0x22810a00, 0x22850a00, 0x22890a00,
+			0x228e0a00, 0x22940a00, 0x22980a00, 0x229c0a00, 0x22a00a00, 0x22a40a00, 0x22a80a00, 0x22ac0a00,
+			0x22b00a00, 0x22b50a00, 0x22ba0a00, 0x22bf0a00, 0x22c40a00, 0x22c80a00, 0x22cc0a00, 0x22d00a00,
+			0x22d40a00, 0x22d80a00, 0x22dc0a00, 0x22e00a00, 0x22e40a00, 0x22e80a00, 0x22ec0a00, 0x22f10a00,
+			0x22f60a00, 0x22fa0a00, 0x22ff0a00, 0x23040a00, 0x23090a00, 0x230d0a00, 0x23120a00, 0x23170a00,
+			0x231d0a00, 0x23210a00, 0x23260a00, 0x232b0a00, 0x23300a00, 0x23350a00, 0x233c0a00, 0x23440a00,
+			0x23480a00, 0x234c0a00, 0x23500a00, 0x23540a00, 0x23580a00, 0x235c0a00, 0x23600a00, 0x23640a00,
+			0x23680a00, 0x236c0a00, 0x23700a00, 0x23740a00, 0x23780a00, 0x237c0a00, 0x23800a00, 0x23840a00,
+			0x23880a00, 0x238c0a00, 0x23920a00, 0x23960a00, 0x239a0a00, 0x239e0a00, 0x23a40a00, 0x23a90a00,
+			0x23ad0a00, 0x23b10a00, 0x23b50a00, 0x23b90a00, 0x23bd0a00, 0x23c10a00, 0x23c50a00, 0x23c90a00,
+			0x23cd0a00, 0x23d10a00, 0x23d60a00, 0x23da0a00, 0x23de0a00, 0x23e30a00, 0x23e80a00, 0x23ec0a00,
+			0x23f20a00, 0x23f70a00, 0x23fb0a00, 0x23ff0a00, 0x24030a00, 0x24070a00, 0x240c0a00, 0x24110a00,
+			0x24150a00, 0x24190a00, 0x241d0a00, 0x24210a00, 0x24250a00, 0x24290a00, 0x242d0a00, 0x24310a00,
+			0x24350a00, 0x243a0a00, 0x243f0a00, 0x24440a00, 0x24490a00, 0x244e0a00, 0x24530a00, 0x24580a00,
+			0x245d0a00, 0x24620a00, 0x24670a00, 0x246c0a00, 0x24710a00, 0x24760a00, 0x247b0a00, 0x24800a00,
+			0x24850a00, 0x248a0a00, 0x248f0a00, 0x24940a00, 0x24990a00, 0x249e0a00, 0x24a30a00, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0x0, 0x0, 0x0, 0x0, 0xe6, 0xe6, 0xe6, 0xe6,
+			0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24a80a00,
+			0x24ab0a00, 0xe6, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0xe6, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24ae0a00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24b10a00, 0x24b40a00, 0x24b70a00, 0x0, 0x0, 0x0, 0x24ba0a00, 0x24bd0a00,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0xe6,
+			0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0xdc, 0xdc, 0xdc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0x0, 0xe6, 0xe6, 0xdc, 0x0, 0x0, 0xe6,
+			0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0xe6, 0x0, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24c00a00,
+			0x24c30a00, 0x24c60a00, 0x24c90a00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24cc0a00, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x2300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300,
+			0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300,
+			0x2300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300,
+			0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300,
+			0x2300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300,
+			0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300,
+			0x2300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300,
+			0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300,
+			0x2300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300,
+			0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300,
+			0x2300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300,
+			0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300,
+			0x2300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300,
+			0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300,
+			0x2300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300,
+			0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300,
+			0x300, 0x300, 0x300, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24cf0f00, 0x24d20f00, 0x24d50f00,
+			0x24d80f00, 0x24db0f00, 0x24de0f00, 0x24e10f00, 0x24e40f00, 0x24e70f00, 0x24ea0f00, 0x24ed0f00,
+			0x24f00f00, 0x24f30f00, 0x24f60f00, 0x24f90f00, 0x24fc0f00, 0x24ff0f00, 0x25020f00, 0x25050f00,
+			0x25080f00, 0x250b0f00, 0x250e0f00, 0x25110f00, 0x25140f00, 0x25170f00, 0x251a0f00, 0x251d0f00,
+			0x25200f00, 0x25230f00, 0x25260f00, 0x25290f00, 0x252c0f00, 0x252f0f00, 0x25320f00, 0x25350f00,
+			0x25380f00, 0x253b0f00, 0x253e0f00, 0x25410f00, 0x25440f00, 0x25470f00, 0x254a0f00, 0x254d0f00,
+			0x25500f00, 0x25530f00, 0x25560f00, 0x25590f00, 0x255c0f00, 0x255f0f00, 0x25620f00, 0x25650f00,
+			0x25680f00, 0x256b0f00, 0x256e0f00, 0x25710f00, 0x25740f00, 0x25770f00, 0x257a0f00, 0x257d0f00,
+			0x25800f00, 0x25830f00, 0x25860f00, 0x25890f00, 0x258c0f00, 0x258f0f00, 0x25920f00, 0x25950f00,
+			0x25980f00, 0x259b0f00, 0x259e0f00, 0x25a10f00, 0x25a40f00, 0x25a70f00, 0x25aa0f00, 0x25ad0f00,
+			0x25b00f00, 0x25b30f00, 0x25b60f00, 0x25b90f00, 0x25bc0f00, 0x25bf0f00, 0x25c20f00, 0x25c50f00,
+			0x25c80f00, 0x25cb0f00, 0x25ce0f00, 0x25d10f00, 0x25d40f00, 0x25d70f00, 0x25da0f00, 0x25dd0f00,
+			0x25e00f00, 0x25e30f00, 0x25e60f00, 0x25e90f00, 0x25ec0f00, 0x25ef0f00, 0x25f20f00, 0x25f50f00,
+			0x25f80f00, 0x25fb0f00, 0x25fe0f00, 0x26010f00, 0x26040f00, 0x26070f00, 0x260a0f00, 0x260d0f00,
+			0x26100f00, 0x26130f00, 0x26160f00, 0x26190f00, 0x261c0f00, 0x261f0f00, 0x26220f00, 0x26250f00,
+			0x26280f00, 0x262b0f00, 0x262e0f00, 0x26310f00, 0x26340f00, 0x26370f00, 0x263a0f00, 0x263d0f00,
+			0x26400f00, 0x26430f00, 0x26460f00, 0x26490f00, 0x264c0f00, 0x264f0f00, 0x26520f00, 0x26550f00,
+			0x26580f00, 0x265b0f00, 0x265e0f00, 0x26610f00, 0x26640f00, 0x26670f00, 0x266a0f00, 0x266d0f00,
+			0x26700f00, 0x26730f00, 0x26760f00, 0x26790f00, 0x267c0f00, 0x267f0f00, 0x26820f00, 0x26850f00,
+			0x26880f00, 0x268b0f00, 0x268e0f00, 0x26910f00, 0x26940f00, 0x26970f00, 0x269a0f00, 0x269d0f00,
+			0x26a00f00, 0x26a30f00, 0x26a60f00, 0x26a90f00, 0x26ac0f00, 0x26af0f00, 0x26b20f00, 0x26b50f00,
+			0x26b80f00, 0x26bb0f00, 0x26be0f00, 0x26c10f00, 0x26c40f00, 0x26c70f00, 0x26ca0f00, 0x26cd0f00,
+			0x26d00f00, 0x26d30f00, 0x26d60f00, 0x26d90f00, 0x26dc0f00, 0x26df0f00, 0x26e20f00, 0x26e50f00,
+			0x26e80f00, 0x26eb0f00, 0x26ee0f00, 0x26f10f00, 0x26f40f00, 0x26f70f00, 0x26fa0f00, 0x26fd0f00,
+			0x27000f00, 0x27030f00, 0x27060f00, 0x27090f00, 0x270c0f00, 0x270f0f00, 0x27120f00, 0x27150f00,
+			0x27180f00, 0x271b0f00, 0x271e0f00, 0x27210f00, 0x27240f00, 0x27270f00, 0x272a0f00, 0x272d0f00,
+			0x27300f00, 0x27330f00, 0x27360f00, 0x27390f00, 0x273c0f00, 0x273f0f00, 0x27420f00, 0x27450f00,
+			0x27480f00, 0x274b0f00, 0x274e0f00, 0x27510f00, 0x27540f00, 0x27570f00, 0x275a0f00, 0x275d0f00,
+			0x27600f00, 0x27630f00, 0x27660f00, 0x27690f00, 0x276c0f00, 0x276f0f00, 0x27720f00, 0x27750f00,
+			0x27780f00, 0x277b0f00, 0x277e0f00, 0x27810f00, 0x27840f00, 0x27870f00, 0x278a0f00, 0x278d0f00,
+			0x27900f00, 0x27930f00, 0x27960f00, 0x27990f00, 0x279c0f00, 0x279f0f00, 0x27a20f00, 0x27a50f00,
+			0x27a80f00, 0x27ab0f00, 0x27ae0f00, 0x27b10f00, 0x27b40f00, 0x27b70f00, 0x27ba0f00, 0x27bd0f00,
+			0x27c00f00, 0x27c30f00, 0x27c60f00, 0x27c90f00, 0x27cc0f00, 0x27cf0f00, 0x27d20f00, 0x27d50f00,
+			0x27d80f00, 0x27db0f00, 0x27de0f00, 0x27e10f00, 0x27e40f00, 0x27e70f00, 0x27ea0f00, 0x27ed0f00,
+			0x27f00f00, 0x27f30f00, 0x27f60f00, 0x0, 0x0, 0x27f90f00, 0x0, 0x27fc0f00, 0x0, 0x0, 0x27ff0f00,
+			0x28020f00, 0x28050f00, 0x28080f00, 0x280b0f00, 0x280e0f00, 0x28110f00, 0x28140f00, 0x28170f00,
+			0x281a0f00, 0x0, 0x281d0f00, 0x0, 0x28200f00, 0x0, 0x0, 0x28230f00, 0x28260f00, 0x0, 0x0, 0x0,
+			0x28290f00, 0x282c0f00, 0x282f0f00, 0x28320f00, 0x28350f00, 0x28380f00, 0x283b0f00, 0x283e0f00,
+			0x28410f00, 0x28440f00, 0x28470f00, 0x284a0f00, 0x284d0f00, 0x28500f00, 0x28530f00, 0x28560f00,
+			0x28590f00, 0x285c0f00, 0x285f0f00, 0x28620f00, 0x28650f00, 0x28680f00, 0x286b0f00, 0x286e0f00,
+			0x28710f00, 0x28740f00, 0x28770f00, 0x287a0f00, 0x287d0f00, 0x28800f00, 0x28830f00, 0x28860f00,
+			0x28890f00, 0x288c0f00, 0x288f0f00, 0x28920f00, 0x28950f00, 0x28980f00, 0x289b0f00, 0x289e0f00,
+			0x28a10f00, 0x28a40f00, 0x28a70f00, 0x28aa0f00, 0x28ad0f00, 0x28b00f00, 0x28b30f00, 0x28b60f00,
+			0x28b90f00, 0x28bc0f00, 0x28bf0f00, 0x28c20f00, 0x28c50f00, 0x28c80f00, 0x28cb0f00, 0x28ce0f00,
+			0x28d10f00, 0x28d40f00, 0x28d70f00, 0x28da0f00, 0x28dd0f00, 0x28e00f00, 0x28e30f00, 0x28e60f00,
+			0x28e90f00, 0x28ec0f00, 0x28ef0f00, 0x28f20f00, 0x0, 0x0, 0x28f50f00, 0x28f80f00, 0x28fb0f00,
+			0x28fe0f00, 0x29010f00, 0x29040f00, 0x29070f00, 0x290a0f00, 0x290d0f00, 0x29100f00, 0x29130f00,
+			0x29160f00, 0x29190f00, 0x291c0f00, 0x291f0f00, 0x29220f00, 0x29250f00, 0x29280f00, 0x292b0f00,
+			0x292e0f00, 0x29310f00, 0x29340f00, 0x29370f00, 0x293a0f00, 0x293d0f00, 0x29400f00, 0x29430f00,
+			0x29460f00, 0x29490f00, 0x294c0f00, 0x294f0f00, 0x29520f00, 0x29550f00, 0x29580f00, 0x295b0f00,
+			0x295e0f00, 0x29610f00, 0x29640f00, 0x29670f00, 0x296a0f00, 0x296d0f00, 0x29700f00, 0x29730f00,
+			0x29760f00, 0x29790f00, 0x297c0f00, 0x297f0f00, 0x29820f00, 0x29850f00, 0x29880f00, 0x298b0f00,
+			0x298e0f00, 0x29910f00, 0x29940f00, 0x29970f00, 0x299a0f00, 0x299d0f00, 0x29a00f00, 0x29a30f00,
+			0x29a60f00, 0x29a90f00, 0x29ac0f00, 0x29af0f00, 0x29b20f00, 0x29b50f00, 0x29b80f00, 0x29bb0f00,
+			0x29be0f00, 0x29c10f00, 0x29c40f00, 0x29c70f00, 0x29ca0f00, 0x29cd0f00, 0x29d00f00, 0x29d30f00,
+			0x29d60f00, 0x29d90f00, 0x29dc0f00, 0x29df0f00, 0x29e20f00, 0x29e50f00, 0x29e80f00, 0x29eb0f00,
+			0x29ee0f00, 0x29f10f00, 0x29f40f00, 0x29f70f00, 0x29fa0f00, 0x29fd0f00, 0x2a000f00, 0x2a030f00,
+			0x2a060f00, 0x2a090f00, 0x2a0c0f00, 0x2a0f0f00, 0x2a120f00, 0x2a150f00, 0x2a180f00, 0x2a1b0f00,
+			0x2a1e0f00, 0x2a210f00, 0x2a240f00, 0x2a270f00, 0x2a2a0f00, 0x2a2d0f00, 0x2a300f00, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x2a330a00, 0x2a370a00, 0x2a3b0a00, 0x2a3f0a00, 0x2a440a00, 0x2a490a00, 0x2a4d0a00, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2a510a00, 0x2a550a00, 0x2a590a00, 0x2a5d0a00,
+			0x2a610a00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2a650f00, 0x1a, 0x2a690f00, 0x2a6d0a00, 0x2a700a00, 0x2a730a00,
+			0x2a760a00, 0x2a790a00, 0x2a7c0a00, 0x2a7f0a00, 0x2a820a00, 0x2a850a00, 0x2a880a00, 0x2a8b0f00,
+			0x2a8f0f00, 0x2a930f00, 0x2a980f00, 0x2a9d0f00, 0x2aa10f00, 0x2aa50f00, 0x2aa90f00, 0x2aad0f00,
+			0x2ab10f00, 0x2ab50f00, 0x2ab90f00, 0x2abd0f00, 0x0, 0x2ac10f00, 0x2ac50f00, 0x2ac90f00, 0x2acd0f00,
+			0x2ad10f00, 0x0, 0x2ad50f00, 0x0, 0x2ad90f00, 0x2add0f00, 0x0, 0x2ae10f00, 0x2ae50f00, 0x0, 0x2ae90f00,
+			0x2aed0f00, 0x2af10f00, 0x2af50f00, 0x2af90f00, 0x2afd0f00, 0x2b010f00, 0x2b050f00, 0x2b090f00,
+			0x2b0d0a00, 0x2b110a00, 0x2b140a00, 0x2b170a00, 0x2b1a0a00, 0x2b1d0a00, 0x2b200a00, 0x2b230a00,
+			0x2b260a00, 0x2b290a00, 0x2b2c0a00, 0x2b2f0a00, 0x2b320a00, 0x2b350a00, 0x2b380a00, 0x2b3b0a00,
+			0x2b3e0a00, 0x2b410a00, 0x2b440a00, 0x2b470a00, 0x2b4a0a00, 0x2b4d0a00, 0x2b500a00, 0x2b530a00,
+			0x2b560a00, 0x2b590a00, 0x2b5c0a00, 0x2b5f0a00, 0x2b620a00, 0x2b650a00, 0x2b680a00, 0x2b6b0a00,
+			0x2b6e0a00, 0x2b710a00, 0x2b740a00, 0x2b770a00, 0x2b7a0a00, 0x2b7d0a00, 0x2b800a00, 0x2b830a00,
+			0x2b860a00, 0x2b890a00, 0x2b8c0a00, 0x2b8f0a00, 0x2b920a00, 0x2b950a00, 0x2b980a00, 0x2b9b0a00,
+			0x2b9e0a00, 0x2ba10a00, 0x2ba40a00, 0x2ba70a00, 0x2baa0a00, 0x2bad0a00, 0x2bb00a00, 0x2bb30a00,
+			0x2bb60a00, 0x2bb90a00, 0x2bbc0a00, 0x2bbf0a00, 0x2bc20a00, 0x2bc50a00, 0x2bc80a00, 0x2bcb0a00,
+			0x2bce0a00, 0x2bd10a00, 0x2bd40a00, 0x2bd70a00, 0x2bda0a00, 0x2bdd0a00, 0x2be00a00, 0x2be30a00,
+			0x2be60a00, 0x2be90a00, 0x2bec0a00, 0x2bef0a00, 0x2bf20a00, 0x2bf50a00, 0x2bf80a00, 0x2bfb0a00,
+			0x2bfe0a00, 0x2c010a00, 0x2c040a00, 0x2c070a00, 0x2c0a0a00, 0x2c0d0a00, 0x2c110a00, 0x2c150a00,
+			0x2c180a00, 0x2c1b0a00, 0x2c1e0a00, 0x2c210a00, 0x2c240a00, 0x2c270a00, 0x2c2a0a00, 0x2c2d0a00,
+			0x2c300a00, 0x2c330a00, 0x2c370a00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x2c3b0a00, 0x2c3e0a00, 0x2c410a00, 0x2c440a00, 0x2c470a00, 0x2c4a0a00, 0x2c4d0a00, 0x2c500a00,
+			0x2c530a00, 0x2c560a00, 0x2c590a00, 0x2c5d0a00, 0x2c600a00, 0x2c630a00, 0x2c660a00, 0x2c690a00,
+			0x2c6c0a00, 0x2c6f0a00, 0x2c720a00, 0x2c750a00, 0x2c780a00, 0x2c7b0a00, 0x2c7e0a00, 0x2c810a00,
+			0x2c860a00, 0x2c8b0a00, 0x2c900a00, 0x2c950a00, 0x2c9a0a00, 0x2c9f0a00, 0x2ca40a00, 0x2ca90a00,
+			0x2cae0a00, 0x2cb30a00, 0x2cb80a00, 0x2cbd0a00, 0x2cc20a00, 0x2cc70a00, 0x2ccc0a00, 0x2cd10a00,
+			0x2cd60a00, 0x2cdb0a00, 0x2cde0a00, 0x2ce10a00, 0x2ce40a00, 0x2ce70a00, 0x2cec0a00, 0x2cf10a00,
+			0x2cf60a00, 0x2cfb0a00, 0x2d000a00, 0x2d040a00, 0x2d080a00, 0x2d0c0a00, 0x2d100a00, 0x2d140a00,
+			0x2d180a00, 0x2d1c0a00, 0x2d200a00, 0x2d240a00, 0x2d280a00, 0x2d2c0a00, 0x2d300a00, 0x2d340a00,
+			0x2d380a00, 0x2d3c0a00, 0x2d400a00, 0x2d440a00, 0x2d480a00, 0x2d4c0a00, 0x2d500a00, 0x2d540a00,
+			0x2d580a00, 0x2d5c0a00, 0x2d600a00, 0x2d640a00, 0x2d680a00, 0x2d6c0a00, 0x2d700a00, 0x2d740a00,
+			0x2d780a00, 0x2d7c0a00, 0x2d800a00, 0x2d840a00, 0x2d880a00, 0x2d8c0a00, 0x2d900a00, 0x2d940a00,
+			0x2d980a00, 0x2d9c0a00, 0x2da00a00, 0x2da40a00, 0x2da80a00, 0x2dac0a00, 0x2db00a00, 0x2db40a00,
+			0x2db80a00, 0x2dbc0a00, 0x2dc00a00, 0x2dc40a00, 0x2dc80a00, 0x2dcc0a00, 0x2dd00a00, 0x2dd40a00,
+			0x2dd80a00, 0x2ddc0a00, 0x2de00a00, 0x2de40a00, 0x2de80a00, 0x2dec0a00, 0x2df00a00, 0x2df40a00,
+			0x2df80a00, 0x2dfc0a00, 0x2e000a00, 0x2e040a00, 0x2e080a00, 0x2e0c0a00, 0x2e100a00, 0x2e140a00,
+			0x2e180a00, 0x2e1c0a00, 0x2e200a00, 0x2e240a00, 0x2e280a00, 0x2e2c0a00, 0x2e300a00, 0x2e340a00,
+			0x2e380a00, 0x2e3c0a00, 0x2e400a00, 0x2e440a00, 0x2e480a00, 0x2e4c0a00, 0x2e500a00, 0x2e540a00,
+			0x2e580a00, 0x2e5c0a00, 0x2e600a00, 0x2e640a00, 0x2e690a00, 0x2e6e0a00, 0x2e730a00, 0x2e780a00,
+			0x2e7d0a00, 0x2e820a00, 0x2e870a00, 0x2e8c0a00, 0x2e910a00, 0x2e960a00, 0x2e9b0a00, 0x2ea00a00,
+			0x2ea40a00, 0x2ea80a00, 0x2eac0a00, 0x2eb00a00, 0x2eb40a00, 0x2eb80a00, 0x2ebc0a00, 0x2ec00a00,
+			0x2ec40a00, 0x2ec80a00, 0x2ecc0a00, 0x2ed00a00, 0x2ed40a00, 0x2ed80a00, 0x2edc0a00, 0x2ee00a00,
+			0x2ee40a00, 0x2ee80a00, 0x2eec0a00, 0x2ef00a00, 0x2ef40a00, 0x2ef80a00, 0x2efc0a00, 0x2f000a00,
+			0x2f040a00, 0x2f080a00, 0x2f0c0a00, 0x2f100a00, 0x2f140a00, 0x2f180a00, 0x2f1c0a00, 0x2f200a00,
+			0x2f240a00, 0x2f280a00, 0x2f2c0a00, 0x2f300a00, 0x2f340a00, 0x2f380a00, 0x2f3c0a00, 0x2f400a00,
+			0x2f440a00, 0x2f480a00, 0x2f4c0a00, 0x2f500a00, 0x2f540a00, 0x2f590a00, 0x2f5e0a00, 0x2f630a00,
+			0x2f680a00, 0x2f6d0a00, 0x2f710a00, 0x2f750a00, 0x2f790a00, 0x2f7d0a00, 0x2f810a00, 0x2f850a00,
+			0x2f890a00, 0x2f8d0a00, 0x2f910a00, 0x2f950a00, 0x2f990a00, 0x2f9d0a00, 0x2fa10a00, 0x2fa50a00,
+			0x2fa90a00, 0x2fad0a00, 0x2fb10a00, 0x2fb50a00, 0x2fb90a00, 0x2fbd0a00, 0x2fc10a00, 0x2fc50a00,
+			0x2fc90a00, 0x2fcd0a00, 0x2fd10a00, 0x2fd50a00, 0x2fd90a00, 0x2fdd0a00, 0x2fe10a00, 0x2fe50a00,
+			0x2fe90a00, 0x2fed0a00, 0x2ff10a00, 0x2ff50a00, 0x2ff90a00, 0x2ffd0a00, 0x30010a00, 0x30050a00,
+			0x30090a00, 0x300d0a00, 0x30110a00, 0x30150a00, 0x30190a00, 0x301d0a00, 0x30210a00, 0x30250a00,
+			0x30290a00, 0x302d0a00, 0x30310a00, 0x30350a00, 0x30390a00, 0x303d0a00, 0x30410a00, 0x30450a00,
+			0x30490a00, 0x304d0a00, 0x30510a00, 0x30550a00, 0x30590a00, 0x305d0a00, 0x30610a00, 0x30650a00,
+			0x30690a00, 0x306d0a00, 0x30710a00, 0x30750a00, 0x30790a00, 0x307e0a00, 0x30830a00, 0x30870a00,
+			0x308b0a00, 0x308f0a00, 0x30930a00, 0x30970a00, 0x309b0a00, 0x309f0a00, 0x30a30a00, 0x30a70a00,
+			0x30ab0a00, 0x30af0a00, 0x30b30a00, 0x30b70a00, 0x30bb0a00, 0x30bf0a00, 0x30c30a00, 0x30c70a00,
+			0x30cc0a00, 0x30d10a00, 0x30d60a00, 0x30da0a00, 0x30de0a00, 0x30e20a00, 0x30e60a00, 0x30ea0a00,
+			0x30ee0a00, 0x30f20a00, 0x30f60a00, 0x30fa0a00, 0x30fe0a00, 0x31020a00, 0x31060a00, 0x310a0a00,
+			0x310e0a00, 0x31120a00, 0x31160a00, 0x311a0a00, 0x311e0a00, 0x31220a00, 0x31260a00, 0x312a0a00,
+			0x312e0a00, 0x31320a00, 0x31360a00, 0x313a0a00, 0x313e0a00, 0x31420a00, 0x31460a00, 0x314a0a00,
+			0x314e0a00, 0x31520a00, 0x31560a00, 0x315a0a00, 0x315e0a00, 0x31620a00, 0x31660a00, 0x316a0a00,
+			0x316e0a00, 0x31720a00, 0x31760a00, 0x317a0a00, 0x317e0a00, 0x31820a00, 0x31860a00, 0x318a0a00,
+			0x318e0a00, 0x31920a00, 0x31960a00, 0x319a0a00, 0x319e0a00, 0x31a20a00, 0x31a60a00, 0x31aa0a00,
+			0x31ae0a00, 0x31b20a00, 0x31b60a00, 0x31ba0a00, 0x31be0a00, 0x31c20a00, 0x31c60a00, 0x31ca0a00,
+			0x31ce0a00, 0x31d20a00, 0x31d60a00, 0x31da0a00, 0x31de0a00, 0x31e20a00, 0x31e60a00, 0x31ea0a00,
+			0x31ee0a00, 0x31f20a00, 0x31f60a00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x31fa0a00, 0x31ff0a00, 0x32040a00, 0x32090a00, 0x320e0a00, 0x32130a00,
+			0x32180a00, 0x321d0a00, 0x32220a00, 0x32270a00, 0x322c0a00, 0x32310a00, 0x32360a00, 0x323b0a00,
+			0x32400a00, 0x32450a00, 0x324a0a00, 0x324f0a00, 0x32540a00, 0x32590a00, 0x325e0a00, 0x32630a00,
+			0x32680a00, 0x326d0a00, 0x32720a00, 0x32770a00, 0x327c0a00, 0x32810a00, 0x32860a00, 0x328b0a00,
+			0x32900a00, 0x32950a00, 0x329a0a00, 0x329f0a00, 0x32a40a00, 0x32a90a00, 0x32ae0a00, 0x32b30a00,
+			0x32b80a00, 0x32bd0a00, 0x32c20a00, 0x32c70a00, 0x32cc0a00, 0x32d10a00, 0x32d60a00, 0x32db0a00,
+			0x32e00a00, 0x32e50a00, 0x32ea0a00, 0x32ef0a00, 0x32f40a00, 0x32f90a00, 0x32fe0a00, 0x33030a00,
+			0x33080a00, 0x330d0a00, 0x33120a00, 0x33170a00, 0x331c0a00, 0x33210a00, 0x33260a00, 0x332b0a00,
+			0x33300a00, 0x33350a00, 0x0, 0x0, 0x333a0a00, 0x333f0a00, 0x33440a00, 0x33490a00, 0x334e0a00,
+			0x33530a00, 0x33580a00, 0x335d0a00, 0x33620a00, 0x33670a00, 0x336c0a00, 0x33710a00, 0x33760a00,
+			0x337b0a00, 0x33800a00, 0x33850a00, 0x338a0a00, 0x338f0a00, 0x33940a00, 0x33990a00, 0x339e0a00,
+			0x33a30a00, 0x33a80a00, 0x33ad0a00, 0x33b20a00, 0x33b70a00, 0x33bc0a00, 0x33c10a00, 0x33c60a00,
+			0x33cb0a00, 0x33d00a00, 0x33d50a00, 0x33da0a00, 0x33df0a00, 0x33e40a00, 0x33e90a00, 0x33ee0a00,
+			0x33f30a00, 0x33f80a00, 0x33fd0a00, 0x34020a00, 0x34070a00, 0x340c0a00, 0x34110a00, 0x34160a00,
+			0x341b0a00, 0x34200a00, 0x34250a00, 0x342a0a00, 0x342f0a00, 0x34340a00, 0x34390a00, 0x343e0a00,
+			0x34430a00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x34480a00, 0x344d0a00, 0x34520a00, 0x34580a00, 0x345e0a00, 0x34640a00, 0x346a0a00, 0x34700a00,
+			0x34760a00, 0x347c0a00, 0x34810a00, 0x34950a00, 0x349f0a00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x34a50a00, 0x34a80a00, 0x34ab0a00, 0x34ae0a00,
+			0x34b10a00, 0x34b40a00, 0x34b70a00, 0x34ba0a00, 0x34bd0a00, 0x34c00a00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xe6, 0xe6,
+			0x34c50a00, 0x34c90a00, 0x34cc0a00, 0x34cf0a00, 0x34d20a00, 0x34d50a00, 0x34d80a00, 0x34db0a00,
+			0x34de0a00, 0x34e10a00, 0x34e40a00, 0x34e70a00, 0x34ea0a00, 0x34ed0a00, 0x34f00a00, 0x34f30a00,
+			0x34f60a00, 0x34f90a00, 0x34fc0a00, 0x34ff0a00, 0x35020a00, 0x0, 0x0, 0x35050a00, 0x35080a00,
+			0x350b0a00, 0x350f0a00, 0x35130a00, 0x35170a00, 0x351b0a00, 0x351e0a00, 0x35210a00, 0x35240a00,
+			0x35270a00, 0x352a0a00, 0x0, 0x352d0a00, 0x35300a00, 0x35330a00, 0x35360a00, 0x35390a00, 0x353c0a00,
+			0x353f0a00, 0x35420a00, 0x35450a00, 0x35480a00, 0x354b0a00, 0x354e0a00, 0x35510a00, 0x35540a00,
+			0x35570a00, 0x355a0a00, 0x355d0a00, 0x35600a00, 0x35630a00, 0x0, 0x35660a00, 0x35690a00, 0x356c0a00,
+			0x356f0a00, 0x0, 0x0, 0x0, 0x0, 0x35720a00, 0x35760a00, 0x357a0a00, 0x0, 0x357e0a00, 0x0, 0x35820a00,
+			0x35860a00, 0x358a0a00, 0x358e0a00, 0x35920a00, 0x35960a00, 0x359a0a00, 0x359e0a00, 0x35a20a00,
+			0x35a60a00, 0x35aa0a00, 0x35ad0a00, 0x35b10a00, 0x35b50a00, 0x35b90a00, 0x35bd0a00, 0x35c10a00,
+			0x35c50a00, 0x35c90a00, 0x35cd0a00, 0x35d10a00, 0x35d50a00, 0x35d90a00, 0x35dd0a00, 0x35e00a00,
+			0x35e30a00, 0x35e60a00, 0x35e90a00, 0x35ec0a00, 0x35ef0a00, 0x35f20a00, 0x35f50a00, 0x35f80a00,
+			0x35fb0a00, 0x35fe0a00, 0x36010a00, 0x36040a00, 0x36070a00, 0x360a0a00, 0x360d0a00, 0x36100a00,
+			0x36130a00, 0x36160a00, 0x36190a00, 0x361c0a00, 0x361f0a00, 0x36220a00, 0x36250a00, 0x36280a00,
+			0x362b0a00, 0x362e0a00, 0x36310a00, 0x36340a00, 0x36370a00, 0x363a0a00, 0x363d0a00, 0x36400a00,
+			0x36430a00, 0x36460a00, 0x36490a00, 0x364c0a00, 0x364f0a00, 0x36520a00, 0x36550a00, 0x36580a00,
+			0x365b0a00, 0x365e0a00, 0x36610a00, 0x36640a00, 0x36670a00, 0x366a0a00, 0x366d0a00, 0x36700a00,
+			0x36730a00, 0x36760a00, 0x36790a00, 0x367c0a00, 0x367f0a00, 0x36820a00, 0x36850a00, 0x36880a00,
+			0x368b0a00, 0x368e0a00, 0x36910a00, 0x36940a00, 0x36970a00, 0x369a0a00, 0x369d0a00, 0x36a00a00,
+			0x36a30a00, 0x36a60a00, 0x36a90a00, 0x36ac0a00, 0x36af0a00, 0x36b20a00, 0x36b50a00, 0x36b80a00,
+			0x36bb0a00, 0x36be0a00, 0x36c10a00, 0x36c40a00, 0x36c70a00, 0x36ca0a00, 0x36cd0a00, 0x36d00a00,
+			0x36d30a00, 0x36d60a00, 0x36d90a00, 0x36dc0a00, 0x36df0a00, 0x36e20a00, 0x36e50a00, 0x36e80a00,
+			0x36eb0a00, 0x36ee0a00, 0x36f10a00, 0x36f40a00, 0x36f70a00, 0x36fa0a00, 0x36fd0a00, 0x37000a00,
+			0x37030a00, 0x37060a00, 0x37090a00, 0x370c0a00, 0x370f0a00, 0x37120a00, 0x37150a00, 0x371a0a00,
+			0x371f0a00, 0x37240a00, 0x37290a00, 0x372e0a00, 0x37330a00, 0x37370a00, 0x0, 0x0, 0x0, 0x0, 0x373b0a00,
+			0x373e0a00, 0x37410a00, 0x37440a00, 0x37470a00, 0x374a0a00, 0x374d0a00, 0x37500a00, 0x37530a00,
+			0x37560a00, 0x37590a00, 0x375c0a00, 0x375f0a00, 0x37620a00, 0x37650a00, 0x37680a00, 0x376b0a00,
+			0x376e0a00, 0x37710a00, 0x37740a00, 0x37770a00, 0x377a0a00, 0x377d0a00, 0x37800a00, 0x37830a00,
+			0x37860a00, 0x37890a00, 0x378c0a00, 0x378f0a00, 0x37920a00, 0x37950a00, 0x37980a00, 0x379b0a00,
+			0x379e0a00, 0x37a10a00, 0x37a40a00, 0x37a70a00, 0x37aa0a00, 0x37ad0a00, 0x37b00a00, 0x37b30a00,
+			0x37b60a00, 0x37b90a00, 0x37bc0a00, 0x37bf0a00, 0x37c20a00, 0x37c50a00, 0x37c80a00, 0x37cb0a00,
+			0x37ce0a00, 0x37d10a00, 0x37d40a00, 0x37d70a00, 0x37da0a00, 0x37dd0a00, 0x37e00a00, 0x37e30a00,
+			0x37e60a00, 0x37e90a00, 0x37ec0a00, 0x37ef0a00, 0x37f20a00, 0x37f50a00, 0x37f80a00, 0x37fb0a00,
+			0x37fe0a00, 0x38010a00, 0x38040a00, 0x38070a00, 0x380a0a00, 0x380d0a00, 0x38100a00, 0x38130a00,
+			0x38160a00, 0x38190a00, 0x381c0a00, 0x381f0a00, 0x38220a00, 0x38250a00, 0x38280a00, 0x382b0a00,
+			0x382e0a00, 0x38310a00, 0x38340a00, 0x38370a00, 0x383a0a00, 0x383d0a00, 0x38400a00, 0x38430a00,
+			0x38460a00, 0x38490a00, 0x384c0a00, 0x384f0a00, 0x38520a00, 0x38550a00, 0x38580a00, 0x385b0a00,
+			0x385e0a00, 0x38610a00, 0x38640a00, 0x38670a00, 0x386a0a00, 0x386d0a00, 0x38700a00, 0x38730a00,
+			0x38760a00, 0x38790a00, 0x387c0a00, 0x387f0a00, 0x38820a00, 0x38850a00, 0x38880a00, 0x388b0a00,
+			0x388e0a00, 0x38910a00, 0x38940a00, 0x38970a00, 0x389a0a00, 0x389d0a00, 0x38a00a00, 0x38a30a00,
+			0x38a60a00, 0x38a90a00, 0x38ac0a00, 0x38af0a00, 0x38b20a00, 0x38b50a00, 0x38b80a00, 0x38bb0a00,
+			0x38be0a00, 0x38c10a00, 0x38c40a00, 0x38c70a00, 0x38ca0a00, 0x38cd0a00, 0x38d00a00, 0x38d30a00,
+			0x38d60a00, 0x38d90a00, 0x38dc0a00, 0x38df0a00, 0x38e20a00, 0x38e50a00, 0x38e80a00, 0x38eb0a00,
+			0x38ee0a00, 0x38f10a00, 0x38f40a00, 0x38f70a00, 0x38fa0a00, 0x38fd0a00, 0x39000a00, 0x39030a00,
+			0x39060a00, 0x39090a00, 0x390c0a00, 0x390f0a00, 0x39120a00, 0x39150a00, 0x39180a00, 0x391b0a00,
+			0x391e0a00, 0x39210a00, 0x39240a00, 0x39270a00, 0x392a0a00, 0x392d0a00, 0x39300a00, 0x39330a00,
+			0x39360a00, 0x39390a00, 0x393c0a00, 0x393f0a00, 0x39420a00, 0x39450a00, 0x39480a00, 0x394b0a00,
+			0x394e0a00, 0x39510a00, 0x39540a00, 0x39570a00, 0x395a0a00, 0x395d0a00, 0x39600a00, 0x39630a00,
+			0x39660a00, 0x39690a00, 0x396c0a00, 0x396f0a00, 0x39720a00, 0x0, 0x0, 0x0, 0x39750a00, 0x39780a00,
+			0x397b0a00, 0x397e0a00, 0x39810a00, 0x39840a00, 0x0, 0x0, 0x39870a00, 0x398a0a00, 0x398d0a00,
+			0x39900a00, 0x39930a00, 0x39960a00, 0x0, 0x0, 0x39990a00, 0x399c0a00, 0x399f0a00, 0x39a20a00,
+			0x39a50a00, 0x39a80a00, 0x0, 0x0, 0x39ab0a00, 0x39ae0a00, 0x39b10a00, 0x0, 0x0, 0x0, 0x39b40a00,
+			0x39b70a00, 0x39ba0a00, 0x39bd0a00, 0x39c10a00, 0x39c40a00, 0x39c70a00, 0x0, 0x39ca0a00, 0x39cd0a00,
+			0x39d00a00, 0x39d30a00, 0x39d60a00, 0x39d90a00, 0x39dc0a00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdc, 0x0, 0x0, 0xdc,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x39df0a00, 0x39e20a00, 0x39e50a00, 0x39e80a00, 0x39eb0a00, 0x0, 0x39ee0a00, 0x39f10a00,
+			0x39f40a00, 0x39f70a00, 0x39fa0a00, 0x39fd0a00, 0x3a000a00, 0x3a030a00, 0x3a060a00, 0x3a090a00,
+			0x3a0c0a00, 0x3a0f0a00, 0x3a120a00, 0x3a150a00, 0x3a180a00, 0x3a1b0a00, 0x3a1e0a00, 0x3a210a00,
+			0x3a240a00, 0x3a270a00, 0x3a2a0a00, 0x3a2d0a00, 0x3a300a00, 0x3a330a00, 0x3a360a00, 0x3a390a00,
+			0x3a3c0a00, 0x3a3f0a00, 0x3a420a00, 0x3a450a00, 0x3a480a00, 0x3a4b0a00, 0x3a4e0a00, 0x3a510a00,
+			0x3a540a00, 0x3a570a00, 0x3a5a0a00, 0x3a5d0a00, 0x3a600a00, 0x3a630a00, 0x3a660a00, 0x3a690a00, 0x0,
+			0x3a6c0a00, 0x3a6f0a00, 0x3a720a00, 0x3a750a00, 0x3a780a00, 0x3a7b0a00, 0x3a7e0a00, 0x3a810a00,
+			0x3a840a00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0xdc, 0x0, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0xe6, 0x1, 0xdc, 0x0, 0x0, 0x0, 0x0, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0xdc, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0xe6, 0xe6, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0xe6, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdc, 0xdc, 0xe6, 0xe6, 0xe6, 0xdc, 0xe6, 0xdc, 0xdc,
+			0xdc, 0xdc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6,
+			0xdc, 0xe6, 0xdc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x2000, 0x3a870300, 0x2000, 0x3a8b0300, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2000,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x3a8f0300, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x9, 0x1007, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0xe6, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3a930300, 0x3a970300, 0x0, 0x2000,
+			0x2000, 0x9, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x7, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0x7, 0x0, 0x1000, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x2000, 0x0, 0x0, 0x0, 0x3a9b0300, 0x3a9f0300, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x1000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0xe6,
+			0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0x0, 0x0, 0x0, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0x0, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x2000, 0x1000, 0x3aa30300, 0x3aa70300, 0x1000, 0x3aab0300, 0x0, 0x0, 0x0, 0x9, 0x7, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1000,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2000, 0x2000, 0x3aaf0300, 0x3ab30300, 0x0, 0x0, 0x0, 0x9, 0x7,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x9, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1000, 0x0, 0x0, 0x0, 0x0, 0x2000, 0x0, 0x0, 0x3ab70300, 0x0, 0x0,
+			0x0, 0x0, 0x9, 0x9, 0x0, 0x0, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0x0,
+			0x9, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x6, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3abb0f00, 0x3abf0f00, 0x3ac30f00, 0x3ac80f00,
+			0x3acd0f00, 0x3ad20f00, 0x3ad70f00, 0xd8, 0xd8, 0x1, 0x1, 0x1, 0x0, 0x0, 0x0, 0xe2, 0xd8, 0xd8, 0xd8,
+			0xd8, 0xd8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0x0,
+			0x0, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xdc, 0xdc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6,
+			0xe6, 0xe6, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3adc0f00,
+			0x3ae00f00, 0x3ae40f00, 0x3ae90f00, 0x3aee0f00, 0x3af30f00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0xe6, 0xe6, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3af80a00, 0x3afb0a00, 0x3afe0a00,
+			0x3b010a00, 0x3b040a00, 0x3b070a00, 0x3b0a0a00, 0x3b0d0a00, 0x3b100a00, 0x3b130a00, 0x3b160a00,
+			0x3b190a00, 0x3b1c0a00, 0x3b1f0a00, 0x3b220a00, 0x3b250a00, 0x3b280a00, 0x3b2b0a00, 0x3b2e0a00,
+			0x3b310a00, 0x3b340a00, 0x3b370a00, 0x3b3a0a00, 0x3b3d0a00, 0x3b400a00, 0x3b430a00, 0x3b460a00,
+			0x3b490a00, 0x3b4c0a00, 0x3b4f0a00, 0x3b520a00, 0x3b550a00, 0x3b580a00, 0x3b5b0a00, 0x3b5e0a00,
+			0x3b610a00, 0x3b640a00, 0x3b670a00, 0x3b6a0a00, 0x3b6d0a00, 0x3b700a00, 0x3b730a00, 0x3b760a00,
+			0x3b790a00, 0x3b7c0a00, 0x3b7f0a00, 0x3b820a00, 0x3b850a00, 0x3b880a00, 0x3b8b0a00, 0x3b8e0a00,
+			0x3b910a00, 0x3b940a00, 0x3b970a00, 0x3b9a0a00, 0x3b9d0a00, 0x3ba00a00, 0x3ba30a00, 0x3ba60a00,
+			0x3ba90a00, 0x3bac0a00, 0x3baf0a00, 0x3bb20a00, 0x3bb50a00, 0x3bb80a00, 0x3bbb0a00, 0x3bbe0a00,
+			0x3bc10a00, 0x3bc40a00, 0x3bc70a00, 0x3bca0a00, 0x3bcd0a00, 0x3bd00a00, 0x3bd30a00, 0x3bd60a00,
+			0x3bd90a00, 0x3bdc0a00, 0x3bdf0a00, 0x3be20a00, 0x3be50a00, 0x3be80a00, 0x3beb0a00, 0x3bee0a00,
+			0x3bf10a00, 0x3bf40a00, 0x0, 0x3bf70a00, 0x3bfa0a00, 0x3bfd0a00, 0x3c000a00, 0x3c030a00, 0x3c060a00,
+			0x3c090a00, 0x3c0c0a00, 0x3c0f0a00, 0x3c120a00, 0x3c150a00, 0x3c180a00, 0x3c1b0a00, 0x3c1e0a00,
+			0x3c210a00, 0x3c240a00, 0x3c270a00, 0x3c2a0a00, 0x3c2d0a00, 0x3c300a00, 0x3c330a00, 0x3c360a00,
+			0x3c390a00, 0x3c3c0a00, 0x3c3f0a00, 0x3c420a00, 0x3c450a00, 0x3c480a00, 0x3c4b0a00, 0x3c4e0a00,
+			0x3c510a00, 0x3c540a00, 0x3c570a00, 0x3c5a0a00, 0x3c5d0a00, 0x3c600a00, 0x3c630a00, 0x3c660a00,
+			0x3c690a00, 0x3c6c0a00, 0x3c6f0a00, 0x3c720a00, 0x3c750a00, 0x3c780a00, 0x3c7b0a00, 0x3c7e0a00,
+			0x3c810a00, 0x3c840a00, 0x3c870a00, 0x3c8a0a00, 0x3c8d0a00, 0x3c900a00, 0x3c930a00, 0x3c960a00,
+			0x3c990a00, 0x3c9c0a00, 0x3c9f0a00, 0x3ca20a00, 0x3ca50a00, 0x3ca80a00, 0x3cab0a00, 0x3cae0a00,
+			0x3cb10a00, 0x3cb40a00, 0x3cb70a00, 0x3cba0a00, 0x3cbd0a00, 0x3cc00a00, 0x3cc30a00, 0x3cc60a00,
+			0x3cc90a00, 0x0, 0x3ccc0a00, 0x3ccf0a00, 0x0, 0x0, 0x3cd20a00, 0x0, 0x0, 0x3cd50a00, 0x3cd80a00, 0x0,
+			0x0, 0x3cdb0a00, 0x3cde0a00, 0x3ce10a00, 0x3ce40a00, 0x0, 0x3ce70a00, 0x3cea0a00, 0x3ced0a00,
+			0x3cf00a00, 0x3cf30a00, 0x3cf60a00, 0x3cf90a00, 0x3cfc0a00, 0x3cff0a00, 0x3d020a00, 0x3d050a00,
+			0x3d080a00, 0x0, 0x3d0b0a00, 0x0, 0x3d0e0a00, 0x3d110a00, 0x3d140a00, 0x3d170a00, 0x3d1a0a00,
+			0x3d1d0a00, 0x3d200a00, 0x0, 0x3d230a00, 0x3d260a00, 0x3d290a00, 0x3d2c0a00, 0x3d2f0a00, 0x3d320a00,
+			0x3d350a00, 0x3d380a00, 0x3d3b0a00, 0x3d3e0a00, 0x3d410a00, 0x3d440a00, 0x3d470a00, 0x3d4a0a00,
+			0x3d4d0a00, 0x3d500a00, 0x3d530a00, 0x3d560a00, 0x3d590a00, 0x3d5c0a00, 0x3d5f0a00, 0x3d620a00,
+			0x3d650a00, 0x3d680a00, 0x3d6b0a00, 0x3d6e0a00, 0x3d710a00, 0x3d740a00, 0x3d770a00, 0x3d7a0a00,
+			0x3d7d0a00, 0x3d800a00, 0x3d830a00, 0x3d860a00, 0x3d890a00, 0x3d8c0a00, 0x3d8f0a00, 0x3d920a00,
+			0x3d950a00, 0x3d980a00, 0x3d9b0a00, 0x3d9e0a00, 0x3da10a00, 0x3da40a00, 0x3da70a00, 0x3daa0a00,
+			0x3dad0a00, 0x3db00a00, 0x3db30a00, 0x3db60a00, 0x3db90a00, 0x3dbc0a00, 0x3dbf0a00, 0x3dc20a00,
+			0x3dc50a00, 0x3dc80a00, 0x3dcb0a00, 0x3dce0a00, 0x3dd10a00, 0x3dd40a00, 0x3dd70a00, 0x3dda0a00,
+			0x3ddd0a00, 0x3de00a00, 0x3de30a00, 0x0, 0x3de60a00, 0x3de90a00, 0x3dec0a00, 0x3def0a00, 0x0, 0x0,
+			0x3df20a00, 0x3df50a00, 0x3df80a00, 0x3dfb0a00, 0x3dfe0a00, 0x3e010a00, 0x3e040a00, 0x3e070a00, 0x0,
+			0x3e0a0a00, 0x3e0d0a00, 0x3e100a00, 0x3e130a00, 0x3e160a00, 0x3e190a00, 0x3e1c0a00, 0x0, 0x3e1f0a00,
+			0x3e220a00, 0x3e250a00, 0x3e280a00, 0x3e2b0a00, 0x3e2e0a00, 0x3e310a00, 0x3e340a00, 0x3e370a00,
+			0x3e3a0a00, 0x3e3d0a00, 0x3e400a00, 0x3e430a00, 0x3e460a00, 0x3e490a00, 0x3e4c0a00, 0x3e4f0a00,
+			0x3e520a00, 0x3e550a00, 0x3e580a00, 0x3e5b0a00, 0x3e5e0a00, 0x3e610a00, 0x3e640a00, 0x3e670a00,
+			0x3e6a0a00, 0x3e6d0a00, 0x3e700a00, 0x0, 0x3e730a00, 0x3e760a00, 0x3e790a00, 0x3e7c0a00, 0x0,
+			0x3e7f0a00, 0x3e820a00, 0x3e850a00, 0x3e880a00, 0x3e8b0a00, 0x0, 0x3e8e0a00, 0x0, 0x0, 0x0, 0x3e910a00,
+			0x3e940a00, 0x3e970a00, 0x3e9a0a00, 0x3e9d0a00, 0x3ea00a00, 0x3ea30a00, 0x0, 0x3ea60a00, 0x3ea90a00,
+			0x3eac0a00, 0x3eaf0a00, 0x3eb20a00, 0x3eb50a00, 0x3eb80a00, 0x3ebb0a00, 0x3ebe0a00, 0x3ec10a00,
+			0x3ec40a00, 0x3ec70a00, 0x3eca0a00, 0x3ecd0a00, 0x3ed00a00, 0x3ed30a00, 0x3ed60a00, 0x3ed90a00,
+			0x3edc0a00, 0x3edf0a00, 0x3ee20a00, 0x3ee50a00, 0x3ee80a00, 0x3eeb0a00, 0x3eee0a00, 0x3ef10a00,
+			0x3ef40a00, 0x3ef70a00, 0x3efa0a00, 0x3efd0a00, 0x3f000a00, 0x3f030a00, 0x3f060a00, 0x3f090a00,
+			0x3f0c0a00, 0x3f0f0a00, 0x3f120a00, 0x3f150a00, 0x3f180a00, 0x3f1b0a00, 0x3f1e0a00, 0x3f210a00,
+			0x3f240a00, 0x3f270a00, 0x3f2a0a00, 0x3f2d0a00, 0x3f300a00, 0x3f330a00, 0x3f360a00, 0x3f390a00,
+			0x3f3c0a00, 0x3f3f0a00, 0x3f420a00, 0x3f450a00, 0x3f480a00, 0x3f4b0a00, 0x3f4e0a00, 0x3f510a00,
+			0x3f540a00, 0x3f570a00, 0x3f5a0a00, 0x3f5d0a00, 0x3f600a00, 0x3f630a00, 0x3f660a00, 0x3f690a00,
+			0x3f6c0a00, 0x3f6f0a00, 0x3f720a00, 0x3f750a00, 0x3f780a00, 0x3f7b0a00, 0x3f7e0a00, 0x3f810a00,
+			0x3f840a00, 0x3f870a00, 0x3f8a0a00, 0x3f8d0a00, 0x3f900a00, 0x3f930a00, 0x3f960a00, 0x3f990a00,
+			0x3f9c0a00, 0x3f9f0a00, 0x3fa20a00, 0x3fa50a00, 0x3fa80a00, 0x3fab0a00, 0x3fae0a00, 0x3fb10a00,
+			0x3fb40a00, 0x3fb70a00, 0x3fba0a00, 0x3fbd0a00, 0x3fc00a00, 0x3fc30a00, 0x3fc60a00, 0x3fc90a00,
+			0x3fcc0a00, 0x3fcf0a00, 0x3fd20a00, 0x3fd50a00, 0x3fd80a00, 0x3fdb0a00, 0x3fde0a00, 0x3fe10a00,
+			0x3fe40a00, 0x3fe70a00, 0x3fea0a00, 0x3fed0a00, 0x3ff00a00, 0x3ff30a00, 0x3ff60a00, 0x3ff90a00,
+			0x3ffc0a00, 0x3fff0a00, 0x40020a00, 0x40050a00, 0x40080a00, 0x400b0a00, 0x400e0a00, 0x40110a00,
+			0x40140a00, 0x40170a00, 0x401a0a00, 0x401d0a00, 0x40200a00, 0x40230a00, 0x40260a00, 0x40290a00,
+			0x402c0a00, 0x402f0a00, 0x40320a00, 0x40350a00, 0x40380a00, 0x403b0a00, 0x403e0a00, 0x40410a00,
+			0x40440a00, 0x40470a00, 0x404a0a00, 0x404d0a00, 0x40500a00, 0x40530a00, 0x40560a00, 0x40590a00,
+			0x405c0a00, 0x405f0a00, 0x40620a00, 0x40650a00, 0x40680a00, 0x406b0a00, 0x406e0a00, 0x40710a00,
+			0x40740a00, 0x40770a00, 0x407a0a00, 0x407d0a00, 0x40800a00, 0x40830a00, 0x40860a00, 0x40890a00,
+			0x408c0a00, 0x408f0a00, 0x40920a00, 0x40950a00, 0x40980a00, 0x409b0a00, 0x409e0a00, 0x40a10a00,
+			0x40a40a00, 0x40a70a00, 0x40aa0a00, 0x40ad0a00, 0x40b00a00, 0x40b30a00, 0x40b60a00, 0x40b90a00,
+			0x40bc0a00, 0x40bf0a00, 0x40c20a00, 0x40c50a00, 0x40c80a00, 0x40cb0a00, 0x40ce0a00, 0x40d10a00,
+			0x40d40a00, 0x40d70a00, 0x40da0a00, 0x40dd0a00, 0x40e00a00, 0x40e30a00, 0x40e60a00, 0x40e90a00,
+			0x40ec0a00, 0x40ef0a00, 0x40f20a00, 0x40f50a00, 0x40f80a00, 0x40fb0a00, 0x40fe0a00, 0x41010a00,
+			0x41040a00, 0x41070a00, 0x410a0a00, 0x410d0a00, 0x41100a00, 0x41130a00, 0x41160a00, 0x41190a00,
+			0x411c0a00, 0x411f0a00, 0x41220a00, 0x41250a00, 0x41280a00, 0x412b0a00, 0x412e0a00, 0x41310a00,
+			0x41340a00, 0x41370a00, 0x413a0a00, 0x413d0a00, 0x41400a00, 0x41430a00, 0x41460a00, 0x41490a00,
+			0x414c0a00, 0x414f0a00, 0x41520a00, 0x41550a00, 0x41580a00, 0x415b0a00, 0x415e0a00, 0x41610a00,
+			0x41640a00, 0x41670a00, 0x416a0a00, 0x416d0a00, 0x41700a00, 0x41730a00, 0x41760a00, 0x41790a00,
+			0x417c0a00, 0x417f0a00, 0x41820a00, 0x41850a00, 0x41880a00, 0x418b0a00, 0x418e0a00, 0x41910a00,
+			0x41940a00, 0x41970a00, 0x419a0a00, 0x419d0a00, 0x41a00a00, 0x41a30a00, 0x41a60a00, 0x41a90a00,
+			0x41ac0a00, 0x41af0a00, 0x41b20a00, 0x41b50a00, 0x41b80a00, 0x41bb0a00, 0x41be0a00, 0x41c10a00,
+			0x41c40a00, 0x41c70a00, 0x41ca0a00, 0x41cd0a00, 0x41d00a00, 0x41d30a00, 0x41d60a00, 0x41d90a00,
+			0x41dc0a00, 0x41df0a00, 0x41e20a00, 0x41e50a00, 0x41e80a00, 0x41eb0a00, 0x41ee0a00, 0x41f10a00,
+			0x41f40a00, 0x41f70a00, 0x41fa0a00, 0x41fd0a00, 0x42000a00, 0x42030a00, 0x42060a00, 0x42090a00,
+			0x420c0a00, 0x420f0a00, 0x42120a00, 0x42150a00, 0x42180a00, 0x421b0a00, 0x421e0a00, 0x42210a00,
+			0x42240a00, 0x42270a00, 0x422a0a00, 0x422d0a00, 0x42300a00, 0x42330a00, 0x42360a00, 0x42390a00,
+			0x423c0a00, 0x423f0a00, 0x42420a00, 0x42450a00, 0x42480a00, 0x424b0a00, 0x424e0a00, 0x42510a00,
+			0x42540a00, 0x42570a00, 0x425a0a00, 0x425d0a00, 0x42600a00, 0x42630a00, 0x42660a00, 0x42690a00,
+			0x426c0a00, 0x426f0a00, 0x42720a00, 0x42750a00, 0x42780a00, 0x427b0a00, 0x427e0a00, 0x42810a00,
+			0x42840a00, 0x42870a00, 0x428a0a00, 0x428d0a00, 0x42900a00, 0x42930a00, 0x42960a00, 0x42990a00,
+			0x429c0a00, 0x429f0a00, 0x0, 0x0, 0x42a20a00, 0x42a50a00, 0x42a80a00, 0x42ab0a00, 0x42ae0a00,
+			0x42b10a00, 0x42b40a00, 0x42b70a00, 0x42ba0a00, 0x42bd0a00, 0x42c00a00, 0x42c30a00, 0x42c60a00,
+			0x42c90a00, 0x42cc0a00, 0x42cf0a00, 0x42d20a00, 0x42d50a00, 0x42d80a00, 0x42db0a00, 0x42de0a00,
+			0x42e10a00, 0x42e40a00, 0x42e70a00, 0x42ea0a00, 0x42ed0a00, 0x42f00a00, 0x42f30a00, 0x42f60a00,
+			0x42f90a00, 0x42fc0a00, 0x42ff0a00, 0x43020a00, 0x43050a00, 0x43080a00, 0x430b0a00, 0x430e0a00,
+			0x43110a00, 0x43140a00, 0x43170a00, 0x431a0a00, 0x431d0a00, 0x43200a00, 0x43230a00, 0x43260a00,
+			0x43290a00, 0x432c0a00, 0x432f0a00, 0x43320a00, 0x43350a00, 0x43380a00, 0x433b0a00, 0x433e0a00,
+			0x43410a00, 0x43440a00, 0x43470a00, 0x434a0a00, 0x434d0a00, 0x43500a00, 0x43530a00, 0x43560a00,
+			0x43590a00, 0x435c0a00, 0x435f0a00, 0x43620a00, 0x43650a00, 0x43680a00, 0x436b0a00, 0x436e0a00,
+			0x43710a00, 0x43740a00, 0x43770a00, 0x437a0a00, 0x437d0a00, 0x43800a00, 0x43830a00, 0x43860a00,
+			0x43890a00, 0x438c0a00, 0x438f0a00, 0x43920a00, 0x43950a00, 0x43980a00, 0x439b0a00, 0x439e0a00,
+			0x43a10a00, 0x43a40a00, 0x43a70a00, 0x43aa0a00, 0x43ad0a00, 0x43b00a00, 0x43b30a00, 0x43b60a00,
+			0x43b90a00, 0x43bc0a00, 0x43bf0a00, 0x43c20a00, 0x43c50a00, 0x43c80a00, 0x43cb0a00, 0x43ce0a00,
+			0x43d10a00, 0x43d40a00, 0x43d70a00, 0x43da0a00, 0x43dd0a00, 0x43e00a00, 0x43e30a00, 0x43e60a00,
+			0x43e90a00, 0x43ec0a00, 0x43ef0a00, 0x43f20a00, 0x43f50a00, 0x43f80a00, 0x43fb0a00, 0x43fe0a00,
+			0x44010a00, 0x44040a00, 0x44070a00, 0x440a0a00, 0x440d0a00, 0x44100a00, 0x44130a00, 0x44160a00,
+			0x44190a00, 0x441c0a00, 0x441f0a00, 0x44220a00, 0x44250a00, 0x44280a00, 0x442b0a00, 0x442e0a00,
+			0x44310a00, 0x44340a00, 0x44370a00, 0x443a0a00, 0x443d0a00, 0x44400a00, 0x44430a00, 0x44460a00,
+			0x44490a00, 0x444c0a00, 0x444f0a00, 0x44520a00, 0x44550a00, 0x44580a00, 0x445b0a00, 0x445e0a00,
+			0x44610a00, 0x44640a00, 0x44670a00, 0x446a0a00, 0x446d0a00, 0x44700a00, 0x44730a00, 0x44760a00,
+			0x44790a00, 0x447c0a00, 0x447f0a00, 0x44820a00, 0x44850a00, 0x44880a00, 0x448b0a00, 0x448e0a00,
+			0x44910a00, 0x44940a00, 0x44970a00, 0x449a0a00, 0x449d0a00, 0x44a00a00, 0x44a30a00, 0x44a60a00,
+			0x44a90a00, 0x44ac0a00, 0x44af0a00, 0x44b20a00, 0x44b50a00, 0x44b80a00, 0x44bb0a00, 0x44be0a00,
+			0x44c10a00, 0x44c40a00, 0x44c70a00, 0x44ca0a00, 0x44cd0a00, 0x44d00a00, 0x44d30a00, 0x44d60a00,
+			0x44d90a00, 0x44dc0a00, 0x44df0a00, 0x44e20a00, 0x44e50a00, 0x44e80a00, 0x44eb0a00, 0x44ee0a00,
+			0x44f10a00, 0x44f40a00, 0x44f70a00, 0x44fa0a00, 0x44fd0a00, 0x45000a00, 0x45030a00, 0x45060a00,
+			0x45090a00, 0x450c0a00, 0x450f0a00, 0x45120a00, 0x45150a00, 0x45180a00, 0x451b0a00, 0x451e0a00,
+			0x45210a00, 0x45240a00, 0x45270a00, 0x452a0a00, 0x452d0a00, 0x45300a00, 0x45330a00, 0x45360a00,
+			0x45390a00, 0x453c0a00, 0x453f0a00, 0x45420a00, 0x45450a00, 0x45480a00, 0x454b0a00, 0x454e0a00,
+			0x45510a00, 0x45540a00, 0x45570a00, 0x455a0a00, 0x455d0a00, 0x45600a00, 0x45630a00, 0x45660a00,
+			0x45690a00, 0x456c0a00, 0x456f0a00, 0x45720a00, 0x45750a00, 0x45780a00, 0x457b0a00, 0x457e0a00,
+			0x45810a00, 0x45840a00, 0x45870a00, 0x458a0a00, 0x458d0a00, 0x45900a00, 0x45930a00, 0x45960a00,
+			0x45990a00, 0x459c0a00, 0x459f0a00, 0x45a20a00, 0x45a50a00, 0x45a80a00, 0x45ab0a00, 0x45ae0a00,
+			0x45b10a00, 0x45b40a00, 0x45b70a00, 0x45ba0a00, 0x45bd0a00, 0x45c00a00, 0x45c30a00, 0x45c60a00,
+			0x45c90a00, 0x45cc0a00, 0x45cf0a00, 0x45d20a00, 0x45d50a00, 0x45d80a00, 0x45db0a00, 0x45de0a00,
+			0x45e10a00, 0x45e40a00, 0x45e70a00, 0x45ea0a00, 0x45ed0a00, 0x45f00a00, 0x45f30a00, 0x45f60a00,
+			0x45f90a00, 0x45fc0a00, 0x45ff0a00, 0x46020a00, 0x46050a00, 0x46080a00, 0x460b0a00, 0x0, 0x0,
+			0x460e0a00, 0x46110a00, 0x46140a00, 0x46170a00, 0x461a0a00, 0x461d0a00, 0x46200a00, 0x46230a00,
+			0x46260a00, 0x46290a00, 0x462c0a00, 0x462f0a00, 0x46320a00, 0x46350a00, 0x46380a00, 0x463b0a00,
+			0x463e0a00, 0x46410a00, 0x46440a00, 0x46470a00, 0x464a0a00, 0x464d0a00, 0x46500a00, 0x46530a00,
+			0x46560a00, 0x46590a00, 0x465c0a00, 0x465f0a00, 0x46620a00, 0x46650a00, 0x46680a00, 0x466b0a00,
+			0x466e0a00, 0x46710a00, 0x46740a00, 0x46770a00, 0x467a0a00, 0x467d0a00, 0x46800a00, 0x46830a00,
+			0x46860a00, 0x46890a00, 0x468c0a00, 0x468f0a00, 0x46920a00, 0x46950a00, 0x46980a00, 0x469b0a00,
+			0x469e0a00, 0x46a10a00, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0x0, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
+			0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0x0, 0x0, 0xe6, 0xe6, 0xe6,
+			0xe6, 0xe6, 0xe6, 0xe6, 0x0, 0xe6, 0xe6, 0x0, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6,
+			0xe6, 0xe6, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc,
+			0xdc, 0xdc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0xe6, 0xe6, 0xe6,
+			0xe6, 0xe6, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x46a40a00, 0x46a70a00, 0x46aa0a00, 0x46ad0a00, 0x0, 0x46b00a00, 0x46b30a00,
+			0x46b60a00, 0x46b90a00, 0x46bc0a00, 0x46bf0a00, 0x46c20a00, 0x46c50a00, 0x46c80a00, 0x46cb0a00,
+			0x46ce0a00, 0x46d10a00, 0x46d40a00, 0x46d70a00, 0x46da0a00, 0x46dd0a00, 0x46e00a00, 0x46e30a00,
+			0x46e60a00, 0x46e90a00, 0x46ec0a00, 0x46ef0a00, 0x46f20a00, 0x46f50a00, 0x46f80a00, 0x46fb0a00,
+			0x46fe0a00, 0x0, 0x47010a00, 0x47040a00, 0x0, 0x47070a00, 0x0, 0x0, 0x470a0a00, 0x0, 0x470d0a00,
+			0x47100a00, 0x47130a00, 0x47160a00, 0x47190a00, 0x471c0a00, 0x471f0a00, 0x47220a00, 0x47250a00,
+			0x47280a00, 0x0, 0x472b0a00, 0x472e0a00, 0x47310a00, 0x47340a00, 0x0, 0x47370a00, 0x0, 0x473a0a00, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x473d0a00, 0x0, 0x0, 0x0, 0x0, 0x47400a00, 0x0, 0x47430a00, 0x0, 0x47460a00,
+			0x0, 0x47490a00, 0x474c0a00, 0x474f0a00, 0x0, 0x47520a00, 0x47550a00, 0x0, 0x47580a00, 0x0, 0x0,
+			0x475b0a00, 0x0, 0x475e0a00, 0x0, 0x47610a00, 0x0, 0x47640a00, 0x0, 0x47670a00, 0x0, 0x476a0a00,
+			0x476d0a00, 0x0, 0x47700a00, 0x0, 0x0, 0x47730a00, 0x47760a00, 0x47790a00, 0x477c0a00, 0x0, 0x477f0a00,
+			0x47820a00, 0x47850a00, 0x47880a00, 0x478b0a00, 0x478e0a00, 0x47910a00, 0x0, 0x47940a00, 0x47970a00,
+			0x479a0a00, 0x479d0a00, 0x0, 0x47a00a00, 0x47a30a00, 0x47a60a00, 0x47a90a00, 0x0, 0x47ac0a00, 0x0,
+			0x47af0a00, 0x47b20a00, 0x47b50a00, 0x47b80a00, 0x47bb0a00, 0x47be0a00, 0x47c10a00, 0x47c40a00,
+			0x47c70a00, 0x47ca0a00, 0x0, 0x47cd0a00, 0x47d00a00, 0x47d30a00, 0x47d60a00, 0x47d90a00, 0x47dc0a00,
+			0x47df0a00, 0x47e20a00, 0x47e50a00, 0x47e80a00, 0x47eb0a00, 0x47ee0a00, 0x47f10a00, 0x47f40a00,
+			0x47f70a00, 0x47fa0a00, 0x47fd0a00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x48000a00, 0x48030a00, 0x48060a00, 0x0,
+			0x48090a00, 0x480c0a00, 0x480f0a00, 0x48120a00, 0x48150a00, 0x0, 0x48180a00, 0x481b0a00, 0x481e0a00,
+			0x48210a00, 0x48240a00, 0x48270a00, 0x482a0a00, 0x482d0a00, 0x48300a00, 0x48330a00, 0x48360a00,
+			0x48390a00, 0x483c0a00, 0x483f0a00, 0x48420a00, 0x48450a00, 0x48480a00, 0x0, 0x0, 0x0, 0x0, 0x484b0a00,
+			0x484f0a00, 0x48530a00, 0x48570a00, 0x485b0a00, 0x485f0a00, 0x48630a00, 0x48670a00, 0x486b0a00,
+			0x486f0a00, 0x48730a00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x48770a00, 0x487c0a00, 0x48810a00, 0x48860a00,
+			0x488b0a00, 0x48900a00, 0x48950a00, 0x489a0a00, 0x489f0a00, 0x48a40a00, 0x48a90a00, 0x48ae0a00,
+			0x48b30a00, 0x48b80a00, 0x48bd0a00, 0x48c20a00, 0x48c70a00, 0x48cc0a00, 0x48d10a00, 0x48d60a00,
+			0x48db0a00, 0x48e00a00, 0x48e50a00, 0x48ea0a00, 0x48ef0a00, 0x48f40a00, 0x48f90a00, 0x48fe0a00,
+			0x49010a00, 0x49040a00, 0x49080a00, 0x0, 0x490c0a00, 0x490f0a00, 0x49120a00, 0x49150a00, 0x49180a00,
+			0x491b0a00, 0x491e0a00, 0x49210a00, 0x49240a00, 0x49270a00, 0x492a0a00, 0x492d0a00, 0x49300a00,
+			0x49330a00, 0x49360a00, 0x49390a00, 0x493c0a00, 0x493f0a00, 0x49420a00, 0x49450a00, 0x49480a00,
+			0x494b0a00, 0x494e0a00, 0x49510a00, 0x49540a00, 0x49570a00, 0x495a0a00, 0x495e0a00, 0x49620a00,
+			0x49660a00, 0x496a0a00, 0x496f0a00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49730a00, 0x49770a00, 0x497b0a00,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x497f0a00, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49830a00, 0x49870a00, 0x498b0a00, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x498e0a00, 0x49910a00, 0x49940a00, 0x49970a00,
+			0x499b0a00, 0x499e0a00, 0x49a10a00, 0x49a40a00, 0x49a70a00, 0x49aa0a00, 0x49ad0a00, 0x49b00a00,
+			0x49b30a00, 0x49b60a00, 0x49b90a00, 0x49bc0a00, 0x49bf0a00, 0x49c20a00, 0x49c50a00, 0x49c80a00,
+			0x49cb0a00, 0x49ce0a00, 0x49d10a00, 0x49d40a00, 0x49d70a00, 0x49da0a00, 0x49dd0a00, 0x49e00a00,
+			0x49e30a00, 0x49e60a00, 0x49e90a00, 0x49ec0a00, 0x49ef0a00, 0x49f20a00, 0x49f50a00, 0x49f80a00,
+			0x49fb0a00, 0x49fe0a00, 0x4a010a00, 0x4a040a00, 0x4a070a00, 0x4a0a0a00, 0x4a0d0a00, 0x4a100a00, 0x0,
+			0x0, 0x0, 0x0, 0x4a130a00, 0x4a180a00, 0x4a1d0a00, 0x4a220a00, 0x4a270a00, 0x4a2c0a00, 0x4a310a00,
+			0x4a360a00, 0x4a3b0a00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4a400a00, 0x4a430a00, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			0x0, 0x0, 0x0, 0x0, 0x0, 0x4a460a00, 0x4a490a00, 0x4a4c0a00, 0x4a4f0a00, 0x4a520a00, 0x4a550a00,
+			0x4a580a00, 0x4a5b0a00, 0x4a5e0a00, 0x4a610a00, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4a640f00, 0x4a670f00,
+			0x4a6a0f00, 0x4a6d0f00, 0x4a700f00, 0x4a730f00, 0x4a760f00, 0x4a790f00, 0x4a7c0f00, 0x4a7f0f00,
+			0x4a820f00, 0x4a850f00, 0x4a880f00, 0x4a8b0f00, 0x4a8e0f00, 0x4a910f00, 0x4a940f00, 0x4a970f00,
+			0x4a9a0f00, 0x4a9d0f00, 0x4aa00f00, 0x4aa30f00, 0x4aa60f00, 0x4aa90f00, 0x4aac0f00, 0x4aaf0f00,
+			0x4ab20f00, 0x4ab50f00, 0x4ab80f00, 0x4abb0f00, 0x4abe0f00, 0x4ac10f00, 0x4ac40f00, 0x4ac70f00,
+			0x4aca0f00, 0x4acd0f00, 0x4ad00f00, 0x4ad30f00, 0x4ad60f00, 0x4ad90f00, 0x4adc0f00, 0x4adf0f00,
+			0x4ae20f00, 0x4ae50f00, 0x4ae80f00, 0x4aeb0f00, 0x4aee0f00, 0x4af10f00, 0x4af40f00, 0x4af70f00,
+			0x4afa0f00, 0x4afd0f00, 0x4b000f00, 0x4b030f00, 0x4b060f00, 0x4b090f00, 0x4b0c0f00, 0x4b0f0f00,
+			0x4b120f00, 0x4b150f00, 0x4b180f00, 0x4b1b0f00, 0x4b1e0f00, 0x4b210f00, 0x4b240f00, 0x4b270f00,
+			0x4b2a0f00, 0x4b2d0f00, 0x4b300f00, 0x4b330f00, 0x4b360f00, 0x4b390f00, 0x4b3c0f00, 0x4b3f0f00,
+			0x4b420f00, 0x4b450f00, 0x4b480f00, 0x4b4b0f00, 0x4b4e0f00, 0x4b510f00, 0x4b540f00, 0x4b570f00,
+			0x4b5a0f00, 0x4b5d0f00, 0x4b600f00, 0x4b630f00, 0x4b660f00, 0x4b690f00, 0x4b6c0f00, 0x4b6f0f00,
+			0x4b720f00, 0x4b750f00, 0x4b780f00, 0x4b7b0f00, 0x4b7e0f00, 0x4b810f00, 0x4b840f00, 0x4b870f00,
+			0x4b8a0f00, 0x4b8d0f00, 0x4b900f00, 0x4b930f00, 0x4b960f00, 0x4b990f00, 0x4b9c0f00, 0x4b9f0f00,
+			0x4ba20f00, 0x4ba50f00, 0x4ba80f00, 0x4bab0f00, 0x4bae0f00, 0x4bb10f00, 0x4bb40f00, 0x4bb70f00,
+			0x4bba0f00, 0x4bbd0f00, 0x4bc00f00, 0x4bc30f00, 0x4bc60f00, 0x4bc90f00, 0x4bcc0f00, 0x4bcf0f00,
+			0x4bd20f00, 0x4bd50f00, 0x4bd80f00, 0x4bdb0f00, 0x4bde0f00, 0x4be10f00, 0x4be40f00, 0x4be70f00,
+			0x4bea0f00, 0x4bed0f00, 0x4bf00f00, 0x4bf30f00, 0x4bf60f00, 0x4bf90f00, 0x4bfc0f00, 0x4bff0f00,
+			0x4c020f00, 0x4c050f00, 0x4c080f00, 0x4c0b0f00, 0x4c0e0f00, 0x4c110f00, 0x4c140f00, 0x4c170f00,
+			0x4c1a0f00, 0x4c1d0f00, 0x4c200f00, 0x4c230f00, 0x4c260f00, 0x4c290f00, 0x4c2c0f00, 0x4c2f0f00,
+			0x4c320f00, 0x4c350f00, 0x4c380f00, 0x4c3b0f00, 0x4c3e0f00, 0x4c410f00, 0x4c440f00, 0x4c470f00,
+			0x4c4a0f00, 0x4c4d0f00, 0x4c500f00, 0x4c530f00, 0x4c560f00, 0x4c590f00, 0x4c5c0f00, 0x4c5f0f00,
+			0x4c620f00, 0x4c650f00, 0x4c680f00, 0x4c6b0f00, 0x4c6e0f00, 0x4c710f00, 0x4c740f00, 0x4c770f00,
+			0x4c7a0f00, 0x4c7d0f00, 0x4c800f00, 0x4c830f00, 0x4c860f00, 0x4c890f00, 0x4c8c0f00, 0x4c8f0f00,
+			0x4c920f00, 0x4c950f00, 0x4c980f00, 0x4c9b0f00, 0x4c9e0f00, 0x4ca10f00, 0x4ca40f00, 0x4ca70f00,
+			0x4caa0f00, 0x4cad0f00, 0x4cb00f00, 0x4cb30f00, 0x4cb60f00, 0x4cb90f00, 0x4cbc0f00, 0x4cbf0f00,
+			0x4cc20f00, 0x4cc50f00, 0x4cc80f00, 0x4ccb0f00, 0x4cce0f00, 0x4cd10f00, 0x4cd40f00, 0x4cd70f00,
+			0x4cda0f00, 0x4cdd0f00, 0x4ce00f00, 0x4ce30f00, 0x4ce60f00, 0x4ce90f00, 0x4cec0f00, 0x4cef0f00,
+			0x4cf20f00, 0x4cf50f00, 0x4cf80f00, 0x4cfb0f00, 0x4cfe0f00, 0x4d010f00, 0x4d040f00, 0x4d070f00,
+			0x4d0a0f00, 0x4d0d0f00, 0x4d100f00, 0x4d130f00, 0x4d160f00, 0x4d190f00, 0x4d1c0f00, 0x4d1f0f00,
+			0x4d220f00, 0x4d250f00, 0x4d280f00, 0x4d2b0f00, 0x4d2e0f00, 0x4d310f00, 0x4d340f00, 0x4d370f00,
+			0x4d3a0f00, 0x4d3d0f00, 0x4d400f00, 0x4d430f00, 0x4d460f00, 0x4d490f00, 0x4d4c0f00, 0x4d4f0f00,
+			0x4d520f00, 0x4d550f00, 0x4d580f00, 0x4d5b0f00, 0x4d5e0f00, 0x4d610f00, 0x4d640f00, 0x4d670f00,
+			0x4d6a0f00, 0x4d6d0f00, 0x4d700f00, 0x4d730f00, 0x4d760f00, 0x4d790f00, 0x4d7c0f00, 0x4d7f0f00,
+			0x4d820f00, 0x4d850f00, 0x4d880f00, 0x4d8b0f00, 0x4d8e0f00, 0x4d910f00, 0x4d940f00, 0x4d970f00,
+			0x4d9a0f00, 0x4d9d0f00, 0x4da00f00, 0x4da30f00, 0x4da60f00, 0x4da90f00, 0x4dac0f00, 0x4daf0f00,
+			0x4db20f00, 0x4db50f00, 0x4db80f00, 0x4dbb0f00, 0x4dbe0f00, 0x4dc10f00, 0x4dc40f00, 0x4dc70f00,
+			0x4dca0f00, 0x4dcd0f00, 0x4dd00f00, 0x4dd30f00, 0x4dd60f00, 0x4dd90f00, 0x4ddc0f00, 0x4ddf0f00,
+			0x4de20f00, 0x4de50f00, 0x4de80f00, 0x4deb0f00, 0x4dee0f00, 0x4df10f00, 0x4df40f00, 0x4df70f00,
+			0x4dfa0f00, 0x4dfd0f00, 0x4e000f00, 0x4e030f00, 0x4e060f00, 0x4e090f00, 0x4e0c0f00, 0x4e0f0f00,
+			0x4e120f00, 0x4e150f00, 0x4e180f00, 0x4e1b0f00, 0x4e1e0f00, 0x4e210f00, 0x4e240f00, 0x4e270f00,
+			0x4e2a0f00, 0x4e2d0f00, 0x4e300f00, 0x4e330f00, 0x4e360f00, 0x4e390f00, 0x4e3c0f00, 0x4e3f0f00,
+			0x4e420f00, 0x4e450f00, 0x4e480f00, 0x4e4b0f00, 0x4e4e0f00, 0x4e510f00, 0x4e540f00, 0x4e570f00,
+			0x4e5a0f00, 0x4e5d0f00, 0x4e600f00, 0x4e630f00, 0x4e660f00, 0x4e690f00, 0x4e6c0f00, 0x4e6f0f00,
+			0x4e720f00, 0x4e750f00, 0x4e780f00, 0x4e7b0f00, 0x4e7e0f00, 0x4e810f00, 0x4e840f00, 0x4e870f00,
+			0x4e8a0f00, 0x4e8d0f00, 0x4e900f00, 0x4e930f00, 0x4e960f00, 0x4e990f00, 0x4e9c0f00, 0x4e9f0f00,
+			0x4ea20f00, 0x4ea50f00, 0x4ea80f00, 0x4eab0f00, 0x4eae0f00, 0x4eb10f00, 0x4eb40f00, 0x4eb70f00,
+			0x4eba0f00, 0x4ebd0f00, 0x4ec00f00, 0x4ec30f00, 0x4ec60f00, 0x4ec90f00, 0x4ecc0f00, 0x4ecf0f00,
+			0x4ed20f00, 0x4ed50f00, 0x4ed80f00, 0x4edb0f00, 0x4ede0f00, 0x4ee10f00, 0x4ee40f00, 0x4ee70f00,
+			0x4eea0f00, 0x4eed0f00, 0x4ef00f00, 0x4ef30f00, 0x4ef60f00, 0x4ef90f00, 0x4efc0f00, 0x4eff0f00,
+			0x4f020f00, 0x4f050f00, 0x4f080f00, 0x4f0b0f00, 0x4f0e0f00, 0x4f110f00, 0x4f140f00, 0x4f170f00,
+			0x4f1a0f00, 0x4f1d0f00, 0x4f200f00, 0x4f230f00, 0x4f260f00, 0x4f290f00, 0x4f2c0f00, 0x4f2f0f00,
+			0x4f320f00, 0x4f350f00, 0x4f380f00, 0x4f3b0f00, 0x4f3e0f00, 0x4f410f00, 0x4f440f00, 0x4f470f00,
+			0x4f4a0f00, 0x4f4d0f00, 0x4f500f00, 0x4f530f00, 0x4f560f00, 0x4f590f00, 0x4f5c0f00, 0x4f5f0f00,
+			0x4f620f00, 0x4f650f00, 0x4f680f00, 0x4f6b0f00, 0x4f6e0f00, 0x4f710f00, 0x4f740f00, 0x4f770f00,
+			0x4f7a0f00, 0x4f7d0f00, 0x4f800f00, 0x4f830f00, 0x4f860f00, 0x4f890f00, 0x4f8c0f00, 0x4f8f0f00,
+			0x4f920f00, 0x4f950f00, 0x4f980f00, 0x4f9b0f00, 0x4f9e0f00, 0x4fa10f00, 0x4fa40f00, 0x4fa70f00,
+			0x4faa0f00, 0x4fad0f00, 0x4fb00f00, 0x4fb30f00, 0x4fb60f00, 0x4fb90f00, 0x4fbc0f00, 0x4fbf0f00,
+			0x4fc20f00, 0x4fc50f00, 0x4fc80f00, 0x4fcb0f00, 0x4fce0f00, 0x4fd10f00, 0x4fd40f00, 0x4fd70f00,
+			0x4fda0f00, 0x4fdd0f00, 0x4fe00f00, 0x4fe30f00, 0x4fe60f00, 0x4fe90f00, 0x4fec0f00, 0x4fef0f00,
+			0x4ff20f00, 0x4ff50f00, 0x4ff80f00, 0x4ffb0f00, 0x4ffe0f00, 0x50010f00, 0x50040f00, 0x50070f00,
+			0x500a0f00, 0x500d0f00, 0x50100f00, 0x50130f00, 0x50160f00, 0x50190f00, 0x501c0f00, 0x501f0f00,
+			0x50220f00, 0x50250f00, 0x50280f00, 0x502b0f00, 0x502e0f00, 0x50310f00, 0x50340f00, 0x50370f00,
+			0x503a0f00, 0x503d0f00, 0x50400f00, 0x50430f00, 0x50460f00, 0x50490f00, 0x504c0f00, 0x504f0f00,
+			0x50520f00, 0x50550f00, 0x50580f00, 0x505b0f00, 0x505e0f00, 0x50610f00, 0x50640f00, 0x50670f00,
+			0x506a0f00, 0x506d0f00, 0x50700f00, 0x50730f00, 0x50760f00, 0x50790f00, 0x507c0f00, 0x507f0f00,
+			0x50820f00, 0x50850f00, 0x50880f00, 0x508b0f00, 0x508e0f00, 0x50910f00, 0x50940f00, 0x50970f00,
+			0x509a0f00, 0x509d0f00, 0x50a00f00, 0x50a30f00, 0x50a60f00, 0x50a90f00, 0x50ac0f00, 0x50af0f00,
+			0x50b20f00, 0x50b50f00, 0x50b80f00, 0x50bb0f00, 0x0, 0x0
+		};
+
+		// Full (recursively applied) decompositions: the canonical mapping's length and code points, then the
+		// compatibility mapping's length and code points. A length of 0 means no canonical mapping, or a
+		// compatibility mapping that is the same as the canonical one.
+		inline constexpr ::std::uint_least32_t __normalization_mapping_data[20670] = {
+			0x0, 0x0, 0x1, 0x20, 0x0, 0x2, 0x20, 0x308, 0x0, 0x1, 0x61, 0x0, 0x2, 0x20, 0x304, 0x0, 0x1, 0x32, 0x0,
+			0x1, 0x33, 0x0, 0x2, 0x20, 0x301, 0x0, 0x1, 0x3bc, 0x0, 0x2, 0x20, 0x327, 0x0, 0x1, 0x31, 0x0, 0x1,
+			0x6f, 0x0, 0x3, 0x31, 0x2044, 0x34, 0x0, 0x3, 0x31, 0x2044, 0x32, 0x0, 0x3, 0x33, 0x2044, 0x34, 0x2,
+			0x41, 0x300, 0x0, 0x2, 0x41, 0x301, 0x0, 0x2, 0x41, 0x302, 0x0, 0x2, 0x41, 0x303, 0x0, 0x2, 0x41, 0x308,
+			0x0, 0x2, 0x41, 0x30a, 0x0, 0x2, 0x43, 0x327, 0x0, 0x2, 0x45, 0x300, 0x0, 0x2, 0x45, 0x301, 0x0, 0x2,
+			0x45, 0x302, 0x0, 0x2, 0x45, 0x308, 0x0, 0x2, 0x49, 0x300, 0x0, 0x2, 0x49, 0x301, 0x0, 0x2, 0x49, 0x302,
+			0x0, 0x2, 0x49, 0x308, 0x0, 0x2, 0x4e, 0x303, 0x0, 0x2, 0x4f, 0x300, 0x0, 0x2, 0x4f, 0x301, 0x0, 0x2,
+			0x4f, 0x302, 0x0, 0x2, 0x4f, 0x303, 0x0, 0x2, 0x4f, 0x308, 0x0, 0x2, 0x55, 0x300, 0x0, 0x2, 0x55, 0x301,
+			0x0, 0x2, 0x55, 0x302, 0x0, 0x2, 0x55, 0x308, 0x0, 0x2, 0x59, 0x301, 0x0, 0x2, 0x61, 0x300, 0x0, 0x2,
+			0x61, 0x301, 0x0, 0x2, 0x61, 0x302, 0x0, 0x2, 0x61, 0x303, 0x0, 0x2, 0x61, 0x308, 0x0, 0x2, 0x61, 0x30a,
+			0x0, 0x2, 0x63, 0x327, 0x0, 0x2, 0x65, 0x300, 0x0, 0x2, 0x65, 0x301, 0x0, 0x2, 0x65, 0x302, 0x0, 0x2,
+			0x65, 0x308, 0x0, 0x2, 0x69, 0x300, 0x0, 0x2, 0x69, 0x301, 0x0, 0x2, 0x69, 0x302, 0x0, 0x2, 0x69, 0x308,
+			0x0, 0x2, 0x6e, 0x303, 0x0, 0x2, 0x6f, 0x300, 0x0, 0x2, 0x6f, 0x301, 0x0, 0x2, 0x6f, 0x302, 0x0, 0x2,
+			0x6f, 0x303, 0x0, 0x2, 0x6f, 0x308, 0x0, 0x2, 0x75, 0x300, 0x0, 0x2, 0x75, 0x301, 0x0, 0x2, 0x75, 0x302,
+			0x0, 0x2, 0x75, 0x308, 0x0, 0x2, 0x79, 0x301, 0x0, 0x2, 0x79, 0x308, 0x0, 0x2, 0x41, 0x304, 0x0, 0x2,
+			0x61, 0x304, 0x0, 0x2, 0x41, 0x306, 0x0, 0x2, 0x61, 0x306, 0x0, 0x2, 0x41, 0x328, 0x0, 0x2, 0x61, 0x328,
+			0x0, 0x2, 0x43, 0x301, 0x0, 0x2, 0x63, 0x301, 0x0, 0x2, 0x43, 0x302, 0x0, 0x2, 0x63, 0x302, 0x0, 0x2,
+			0x43, 0x307, 0x0, 0x2, 0x63, 0x307, 0x0, 0x2, 0x43, 0x30c, 0x0, 0x2, 0x63, 0x30c, 0x0, 0x2, 0x44, 0x30c,
+			0x0, 0x2, 0x64, 0x30c, 0x0, 0x2, 0x45, 0x304, 0x0, 0x2, 0x65, 0x304, 0x0, 0x2, 0x45, 0x306, 0x0, 0x2,
+			0x65, 0x306, 0x0, 0x2, 0x45, 0x307, 0x0, 0x2, 0x65, 0x307, 0x0, 0x2, 0x45, 0x328, 0x0, 0x2, 0x65, 0x328,
+			0x0, 0x2, 0x45, 0x30c, 0x0, 0x2, 0x65, 0x30c, 0x0, 0x2, 0x47, 0x302, 0x0, 0x2, 0x67, 0x302, 0x0, 0x2,
+			0x47, 0x306, 0x0, 0x2, 0x67, 0x306, 0x0, 0x2, 0x47, 0x307, 0x0, 0x2, 0x67, 0x307, 0x0, 0x2, 0x47, 0x327,
+			0x0, 0x2, 0x67, 0x327, 0x0, 0x2, 0x48, 0x302, 0x0, 0x2, 0x68, 0x302, 0x0, 0x2, 0x49, 0x303, 0x0, 0x2,
+			0x69, 0x303, 0x0, 0x2, 0x49, 0x304, 0x0, 0x2, 0x69, 0x304, 0x0, 0x2, 0x49, 0x306, 0x0, 0x2, 0x69, 0x306,
+			0x0, 0x2, 0x49, 0x328, 0x0, 0x2, 0x69, 0x328, 0x0, 0x2, 0x49, 0x307, 0x0, 0x0, 0x2, 0x49, 0x4a, 0x0,
+			0x2, 0x69, 0x6a, 0x2, 0x4a, 0x302, 0x0, 0x2, 0x6a, 0x302, 0x0, 0x2, 0x4b, 0x327, 0x0, 0x2, 0x6b, 0x327,
+			0x0, 0x2, 0x4c, 0x301, 0x0, 0x2, 0x6c, 0x301, 0x0, 0x2, 0x4c, 0x327, 0x0, 0x2, 0x6c, 0x327, 0x0, 0x2,
+			0x4c, 0x30c, 0x0, 0x2, 0x6c, 0x30c, 0x0, 0x0, 0x2, 0x4c, 0xb7, 0x0, 0x2, 0x6c, 0xb7, 0x2, 0x4e, 0x301,
+			0x0, 0x2, 0x6e, 0x301, 0x0, 0x2, 0x4e, 0x327, 0x0, 0x2, 0x6e, 0x327, 0x0, 0x2, 0x4e, 0x30c, 0x0, 0x2,
+			0x6e, 0x30c, 0x0, 0x0, 0x2, 0x2bc, 0x6e, 0x2, 0x4f, 0x304, 0x0, 0x2, 0x6f, 0x304, 0x0, 0x2, 0x4f, 0x306,
+			0x0, 0x2, 0x6f, 0x306, 0x0, 0x2, 0x4f, 0x30b, 0x0, 0x2, 0x6f, 0x30b, 0x0, 0x2, 0x52, 0x301, 0x0, 0x2,
+			0x72, 0x301, 0x0, 0x2, 0x52, 0x327, 0x0, 0x2, 0x72, 0x327, 0x0, 0x2, 0x52, 0x30c, 0x0, 0x2, 0x72, 0x30c,
+			0x0, 0x2, 0x53, 0x301, 0x0, 0x2, 0x73, 0x301, 0x0, 0x2, 0x53, 0x302, 0x0, 0x2, 0x73, 0x302, 0x0, 0x2,
+			0x53, 0x327, 0x0, 0x2, 0x73, 0x327, 0x0, 0x2, 0x53, 0x30c, 0x0, 0x2, 0x73, 0x30c, 0x0, 0x2, 0x54, 0x327,
+			0x0, 0x2, 0x74, 0x327, 0x0, 0x2, 0x54, 0x30c, 0x0, 0x2, 0x74, 0x30c, 0x0, 0x2, 0x55, 0x303, 0x0, 0x2,
+			0x75, 0x303, 0x0, 0x2, 0x55, 0x304, 0x0, 0x2, 0x75, 0x304, 0x0, 0x2, 0x55, 0x306, 0x0, 0x2, 0x75, 0x306,
+			0x0, 0x2, 0x55, 0x30a, 0x0, 0x2, 0x75, 0x30a, 0x0, 0x2, 0x55, 0x30b, 0x0, 0x2, 0x75, 0x30b, 0x0, 0x2,
+			0x55, 0x328, 0x0, 0x2, 0x75, 0x328, 0x0, 0x2, 0x57, 0x302, 0x0, 0x2, 0x77, 0x302, 0x0, 0x2, 0x59, 0x302,
+			0x0, 0x2, 0x79, 0x302, 0x0, 0x2, 0x59, 0x308, 0x0, 0x2, 0x5a, 0x301, 0x0, 0x2, 0x7a, 0x301, 0x0, 0x2,
+			0x5a, 0x307, 0x0, 0x2, 0x7a, 0x307, 0x0, 0x2, 0x5a, 0x30c, 0x0, 0x2, 0x7a, 0x30c, 0x0, 0x0, 0x1, 0x73,
+			0x2, 0x4f, 0x31b, 0x0, 0x2, 0x6f, 0x31b, 0x0, 0x2, 0x55, 0x31b, 0x0, 0x2, 0x75, 0x31b, 0x0, 0x0, 0x3,
+			0x44, 0x5a, 0x30c, 0x0, 0x3, 0x44, 0x7a, 0x30c, 0x0, 0x3, 0x64, 0x7a, 0x30c, 0x0, 0x2, 0x4c, 0x4a, 0x0,
+			0x2, 0x4c, 0x6a, 0x0, 0x2, 0x6c, 0x6a, 0x0, 0x2, 0x4e, 0x4a, 0x0, 0x2, 0x4e, 0x6a, 0x0, 0x2, 0x6e, 0x6a,
+			0x2, 0x41, 0x30c, 0x0, 0x2, 0x61, 0x30c, 0x0, 0x2, 0x49, 0x30c, 0x0, 0x2, 0x69, 0x30c, 0x0, 0x2, 0x4f,
+			0x30c, 0x0, 0x2, 0x6f, 0x30c, 0x0, 0x2, 0x55, 0x30c, 0x0, 0x2, 0x75, 0x30c, 0x0, 0x3, 0x55, 0x308,
+			0x304, 0x0, 0x3, 0x75, 0x308, 0x304, 0x0, 0x3, 0x55, 0x308, 0x301, 0x0, 0x3, 0x75, 0x308, 0x301, 0x0,
+			0x3, 0x55, 0x308, 0x30c, 0x0, 0x3, 0x75, 0x308, 0x30c, 0x0, 0x3, 0x55, 0x308, 0x300, 0x0, 0x3, 0x75,
+			0x308, 0x300, 0x0, 0x3, 0x41, 0x308, 0x304, 0x0, 0x3, 0x61, 0x308, 0x304, 0x0, 0x3, 0x41, 0x307, 0x304,
+			0x0, 0x3, 0x61, 0x307, 0x304, 0x0, 0x2, 0xc6, 0x304, 0x0, 0x2, 0xe6, 0x304, 0x0, 0x2, 0x47, 0x30c, 0x0,
+			0x2, 0x67, 0x30c, 0x0, 0x2, 0x4b, 0x30c, 0x0, 0x2, 0x6b, 0x30c, 0x0, 0x2, 0x4f, 0x328, 0x0, 0x2, 0x6f,
+			0x328, 0x0, 0x3, 0x4f, 0x328, 0x304, 0x0, 0x3, 0x6f, 0x328, 0x304, 0x0, 0x2, 0x1b7, 0x30c, 0x0, 0x2,
+			0x292, 0x30c, 0x0, 0x2, 0x6a, 0x30c, 0x0, 0x0, 0x2, 0x44, 0x5a, 0x0, 0x2, 0x44, 0x7a, 0x0, 0x2, 0x64,
+			0x7a, 0x2, 0x47, 0x301, 0x0, 0x2, 0x67, 0x301, 0x0, 0x2, 0x4e, 0x300, 0x0, 0x2, 0x6e, 0x300, 0x0, 0x3,
+			0x41, 0x30a, 0x301, 0x0, 0x3, 0x61, 0x30a, 0x301, 0x0, 0x2, 0xc6, 0x301, 0x0, 0x2, 0xe6, 0x301, 0x0,
+			0x2, 0xd8, 0x301, 0x0, 0x2, 0xf8, 0x301, 0x0, 0x2, 0x41, 0x30f, 0x0, 0x2, 0x61, 0x30f, 0x0, 0x2, 0x41,
+			0x311, 0x0, 0x2, 0x61, 0x311, 0x0, 0x2, 0x45, 0x30f, 0x0, 0x2, 0x65, 0x30f, 0x0, 0x2, 0x45, 0x311, 0x0,
+			0x2, 0x65, 0x311, 0x0, 0x2, 0x49, 0x30f, 0x0, 0x2, 0x69, 0x30f, 0x0, 0x2, 0x49, 0x311, 0x0, 0x2, 0x69,
+			0x311, 0x0, 0x2, 0x4f, 0x30f, 0x0, 0x2, 0x6f, 0x30f, 0x0, 0x2, 0x4f, 0x311, 0x0, 0x2, 0x6f, 0x311, 0x0,
+			0x2, 0x52, 0x30f, 0x0, 0x2, 0x72, 0x30f, 0x0, 0x2, 0x52, 0x311, 0x0, 0x2, 0x72, 0x311, 0x0, 0x2, 0x55,
+			0x30f, 0x0, 0x2, 0x75, 0x30f, 0x0, 0x2, 0x55, 0x311, 0x0, 0x2, 0x75, 0x311, 0x0, 0x2, 0x53, 0x326, 0x0,
+			0x2, 0x73, 0x326, 0x0, 0x2, 0x54, 0x326, 0x0, 0x2, 0x74, 0x326, 0x0, 0x2, 0x48, 0x30c, 0x0, 0x2, 0x68,
+			0x30c, 0x0, 0x2, 0x41, 0x307, 0x0, 0x2, 0x61, 0x307, 0x0, 0x2, 0x45, 0x327, 0x0, 0x2, 0x65, 0x327, 0x0,
+			0x3, 0x4f, 0x308, 0x304, 0x0, 0x3, 0x6f, 0x308, 0x304, 0x0, 0x3, 0x4f, 0x303, 0x304, 0x0, 0x3, 0x6f,
+			0x303, 0x304, 0x0, 0x2, 0x4f, 0x307, 0x0, 0x2, 0x6f, 0x307, 0x0, 0x3, 0x4f, 0x307, 0x304, 0x0, 0x3,
+			0x6f, 0x307, 0x304, 0x0, 0x2, 0x59, 0x304, 0x0, 0x2, 0x79, 0x304, 0x0, 0x0, 0x1, 0x68, 0x0, 0x1, 0x266,
+			0x0, 0x1, 0x6a, 0x0, 0x1, 0x72, 0x0, 0x1, 0x279, 0x0, 0x1, 0x27b, 0x0, 0x1, 0x281, 0x0, 0x1, 0x77, 0x0,
+			0x1, 0x79, 0x0, 0x2, 0x20, 0x306, 0x0, 0x2, 0x20, 0x307, 0x0, 0x2, 0x20, 0x30a, 0x0, 0x2, 0x20, 0x328,
+			0x0, 0x2, 0x20, 0x303, 0x0, 0x2, 0x20, 0x30b, 0x0, 0x1, 0x263, 0x0, 0x1, 0x6c, 0x0, 0x1, 0x73, 0x0, 0x1,
+			0x78, 0x0, 0x1, 0x295, 0x1, 0x300, 0x0, 0x1, 0x301, 0x0, 0x1, 0x313, 0x0, 0x2, 0x308, 0x301, 0x0, 0x1,
+			0x2b9, 0x0, 0x0, 0x2, 0x20, 0x345, 0x1, 0x3b, 0x0, 0x0, 0x2, 0x20, 0x301, 0x2, 0xa8, 0x301, 0x3, 0x20,
+			0x308, 0x301, 0x2, 0x391, 0x301, 0x0, 0x1, 0xb7, 0x0, 0x2, 0x395, 0x301, 0x0, 0x2, 0x397, 0x301, 0x0,
+			0x2, 0x399, 0x301, 0x0, 0x2, 0x39f, 0x301, 0x0, 0x2, 0x3a5, 0x301, 0x0, 0x2, 0x3a9, 0x301, 0x0, 0x3,
+			0x3b9, 0x308, 0x301, 0x0, 0x2, 0x399, 0x308, 0x0, 0x2, 0x3a5, 0x308, 0x0, 0x2, 0x3b1, 0x301, 0x0, 0x2,
+			0x3b5, 0x301, 0x0, 0x2, 0x3b7, 0x301, 0x0, 0x2, 0x3b9, 0x301, 0x0, 0x3, 0x3c5, 0x308, 0x301, 0x0, 0x2,
+			0x3b9, 0x308, 0x0, 0x2, 0x3c5, 0x308, 0x0, 0x2, 0x3bf, 0x301, 0x0, 0x2, 0x3c5, 0x301, 0x0, 0x2, 0x3c9,
+			0x301, 0x0, 0x0, 0x1, 0x3b2, 0x0, 0x1, 0x3b8, 0x0, 0x1, 0x3a5, 0x2, 0x3d2, 0x301, 0x2, 0x3a5, 0x301,
+			0x2, 0x3d2, 0x308, 0x2, 0x3a5, 0x308, 0x0, 0x1, 0x3c6, 0x0, 0x1, 0x3c0, 0x0, 0x1, 0x3ba, 0x0, 0x1,
+			0x3c1, 0x0, 0x1, 0x3c2, 0x0, 0x1, 0x398, 0x0, 0x1, 0x3b5, 0x0, 0x1, 0x3a3, 0x2, 0x415, 0x300, 0x0, 0x2,
+			0x415, 0x308, 0x0, 0x2, 0x413, 0x301, 0x0, 0x2, 0x406, 0x308, 0x0, 0x2, 0x41a, 0x301, 0x0, 0x2, 0x418,
+			0x300, 0x0, 0x2, 0x423, 0x306, 0x0, 0x2, 0x418, 0x306, 0x0, 0x2, 0x438, 0x306, 0x0, 0x2, 0x435, 0x300,
+			0x0, 0x2, 0x435, 0x308, 0x0, 0x2, 0x433, 0x301, 0x0, 0x2, 0x456, 0x308, 0x0, 0x2, 0x43a, 0x301, 0x0,
+			0x2, 0x438, 0x300, 0x0, 0x2, 0x443, 0x306, 0x0, 0x2, 0x474, 0x30f, 0x0, 0x2, 0x475, 0x30f, 0x0, 0x2,
+			0x416, 0x306, 0x0, 0x2, 0x436, 0x306, 0x0, 0x2, 0x410, 0x306, 0x0, 0x2, 0x430, 0x306, 0x0, 0x2, 0x410,
+			0x308, 0x0, 0x2, 0x430, 0x308, 0x0, 0x2, 0x415, 0x306, 0x0, 0x2, 0x435, 0x306, 0x0, 0x2, 0x4d8, 0x308,
+			0x0, 0x2, 0x4d9, 0x308, 0x0, 0x2, 0x416, 0x308, 0x0, 0x2, 0x436, 0x308, 0x0, 0x2, 0x417, 0x308, 0x0,
+			0x2, 0x437, 0x308, 0x0, 0x2, 0x418, 0x304, 0x0, 0x2, 0x438, 0x304, 0x0, 0x2, 0x418, 0x308, 0x0, 0x2,
+			0x438, 0x308, 0x0, 0x2, 0x41e, 0x308, 0x0, 0x2, 0x43e, 0x308, 0x0, 0x2, 0x4e8, 0x308, 0x0, 0x2, 0x4e9,
+			0x308, 0x0, 0x2, 0x42d, 0x308, 0x0, 0x2, 0x44d, 0x308, 0x0, 0x2, 0x423, 0x304, 0x0, 0x2, 0x443, 0x304,
+			0x0, 0x2, 0x423, 0x308, 0x0, 0x2, 0x443, 0x308, 0x0, 0x2, 0x423, 0x30b, 0x0, 0x2, 0x443, 0x30b, 0x0,
+			0x2, 0x427, 0x308, 0x0, 0x2, 0x447, 0x308, 0x0, 0x2, 0x42b, 0x308, 0x0, 0x2, 0x44b, 0x308, 0x0, 0x0,
+			0x2, 0x565, 0x582, 0x2, 0x627, 0x653, 0x0, 0x2, 0x627, 0x654, 0x0, 0x2, 0x648, 0x654, 0x0, 0x2, 0x627,
+			0x655, 0x0, 0x2, 0x64a, 0x654, 0x0, 0x0, 0x2, 0x627, 0x674, 0x0, 0x2, 0x648, 0x674, 0x0, 0x2, 0x6c7,
+			0x674, 0x0, 0x2, 0x64a, 0x674, 0x2, 0x6d5, 0x654, 0x0, 0x2, 0x6c1, 0x654, 0x0, 0x2, 0x6d2, 0x654, 0x0,
+			0x2, 0x928, 0x93c, 0x0, 0x2, 0x930, 0x93c, 0x0, 0x2, 0x933, 0x93c, 0x0, 0x2, 0x915, 0x93c, 0x0, 0x2,
+			0x916, 0x93c, 0x0, 0x2, 0x917, 0x93c, 0x0, 0x2, 0x91c, 0x93c, 0x0, 0x2, 0x921, 0x93c, 0x0, 0x2, 0x922,
+			0x93c, 0x0, 0x2, 0x92b, 0x93c, 0x0, 0x2, 0x92f, 0x93c, 0x0, 0x2, 0x9c7, 0x9be, 0x0, 0x2, 0x9c7, 0x9d7,
+			0x0, 0x2, 0x9a1, 0x9bc, 0x0, 0x2, 0x9a2, 0x9bc, 0x0, 0x2, 0x9af, 0x9bc, 0x0, 0x2, 0xa32, 0xa3c, 0x0,
+			0x2, 0xa38, 0xa3c, 0x0, 0x2, 0xa16, 0xa3c, 0x0, 0x2, 0xa17, 0xa3c, 0x0, 0x2, 0xa1c, 0xa3c, 0x0, 0x2,
+			0xa2b, 0xa3c, 0x0, 0x2, 0xb47, 0xb56, 0x0, 0x2, 0xb47, 0xb3e, 0x0, 0x2, 0xb47, 0xb57, 0x0, 0x2, 0xb21,
+			0xb3c, 0x0, 0x2, 0xb22, 0xb3c, 0x0, 0x2, 0xb92, 0xbd7, 0x0, 0x2, 0xbc6, 0xbbe, 0x0, 0x2, 0xbc7, 0xbbe,
+			0x0, 0x2, 0xbc6, 0xbd7, 0x0, 0x2, 0xc46, 0xc56, 0x0, 0x2, 0xcbf, 0xcd5, 0x0, 0x2, 0xcc6, 0xcd5, 0x0,
+			0x2, 0xcc6, 0xcd6, 0x0, 0x2, 0xcc6, 0xcc2, 0x0, 0x3, 0xcc6, 0xcc2, 0xcd5, 0x0, 0x2, 0xd46, 0xd3e, 0x0,
+			0x2, 0xd47, 0xd3e, 0x0, 0x2, 0xd46, 0xd57, 0x0, 0x2, 0xdd9, 0xdca, 0x0, 0x2, 0xdd9, 0xdcf, 0x0, 0x3,
+			0xdd9, 0xdcf, 0xdca, 0x0, 0x2, 0xdd9, 0xddf, 0x0, 0x0, 0x2, 0xe4d, 0xe32, 0x0, 0x2, 0xecd, 0xeb2, 0x0,
+			0x2, 0xeab, 0xe99, 0x0, 0x2, 0xeab, 0xea1, 0x0, 0x1, 0xf0b, 0x2, 0xf42, 0xfb7, 0x0, 0x2, 0xf4c, 0xfb7,
+			0x0, 0x2, 0xf51, 0xfb7, 0x0, 0x2, 0xf56, 0xfb7, 0x0, 0x2, 0xf5b, 0xfb7, 0x0, 0x2, 0xf40, 0xfb5, 0x0,
+			0x2, 0xf71, 0xf72, 0x0, 0x2, 0xf71, 0xf74, 0x0, 0x2, 0xfb2, 0xf80, 0x0, 0x0, 0x3, 0xfb2, 0xf71, 0xf80,
+			0x2, 0xfb3, 0xf80, 0x0, 0x0, 0x3, 0xfb3, 0xf71, 0xf80, 0x2, 0xf71, 0xf80, 0x0, 0x2, 0xf92, 0xfb7, 0x0,
+			0x2, 0xf9c, 0xfb7, 0x0, 0x2, 0xfa1, 0xfb7, 0x0, 0x2, 0xfa6, 0xfb7, 0x0, 0x2, 0xfab, 0xfb7, 0x0, 0x2,
+			0xf90, 0xfb5, 0x0, 0x2, 0x1025, 0x102e, 0x0, 0x0, 0x1, 0x10dc, 0x2, 0x1b05, 0x1b35, 0x0, 0x2, 0x1b07,
+			0x1b35, 0x0, 0x2, 0x1b09, 0x1b35, 0x0, 0x2, 0x1b0b, 0x1b35, 0x0, 0x2, 0x1b0d, 0x1b35, 0x0, 0x2, 0x1b11,
+			0x1b35, 0x0, 0x2, 0x1b3a, 0x1b35, 0x0, 0x2, 0x1b3c, 0x1b35, 0x0, 0x2, 0x1b3e, 0x1b35, 0x0, 0x2, 0x1b3f,
+			0x1b35, 0x0, 0x2, 0x1b42, 0x1b35, 0x0, 0x0, 0x1, 0x41, 0x0, 0x1, 0xc6, 0x0, 0x1, 0x42, 0x0, 0x1, 0x44,
+			0x0, 0x1, 0x45, 0x0, 0x1, 0x18e, 0x0, 0x1, 0x47, 0x0, 0x1, 0x48, 0x0, 0x1, 0x49, 0x0, 0x1, 0x4a, 0x0,
+			0x1, 0x4b, 0x0, 0x1, 0x4c, 0x0, 0x1, 0x4d, 0x0, 0x1, 0x4e, 0x0, 0x1, 0x4f, 0x0, 0x1, 0x222, 0x0, 0x1,
+			0x50, 0x0, 0x1, 0x52, 0x0, 0x1, 0x54, 0x0, 0x1, 0x55, 0x0, 0x1, 0x57, 0x0, 0x1, 0x61, 0x0, 0x1, 0x250,
+			0x0, 0x1, 0x251, 0x0, 0x1, 0x1d02, 0x0, 0x1, 0x62, 0x0, 0x1, 0x64, 0x0, 0x1, 0x65, 0x0, 0x1, 0x259, 0x0,
+			0x1, 0x25b, 0x0, 0x1, 0x25c, 0x0, 0x1, 0x67, 0x0, 0x1, 0x6b, 0x0, 0x1, 0x6d, 0x0, 0x1, 0x14b, 0x0, 0x1,
+			0x6f, 0x0, 0x1, 0x254, 0x0, 0x1, 0x1d16, 0x0, 0x1, 0x1d17, 0x0, 0x1, 0x70, 0x0, 0x1, 0x74, 0x0, 0x1,
+			0x75, 0x0, 0x1, 0x1d1d, 0x0, 0x1, 0x26f, 0x0, 0x1, 0x76, 0x0, 0x1, 0x1d25, 0x0, 0x1, 0x3b2, 0x0, 0x1,
+			0x3b3, 0x0, 0x1, 0x3b4, 0x0, 0x1, 0x3c6, 0x0, 0x1, 0x3c7, 0x0, 0x1, 0x69, 0x0, 0x1, 0x72, 0x0, 0x1,
+			0x75, 0x0, 0x1, 0x76, 0x0, 0x1, 0x3b2, 0x0, 0x1, 0x3b3, 0x0, 0x1, 0x3c1, 0x0, 0x1, 0x3c6, 0x0, 0x1,
+			0x3c7, 0x0, 0x1, 0x43d, 0x0, 0x1, 0x252, 0x0, 0x1, 0x63, 0x0, 0x1, 0x255, 0x0, 0x1, 0xf0, 0x0, 0x1,
+			0x25c, 0x0, 0x1, 0x66, 0x0, 0x1, 0x25f, 0x0, 0x1, 0x261, 0x0, 0x1, 0x265, 0x0, 0x1, 0x268, 0x0, 0x1,
+			0x269, 0x0, 0x1, 0x26a, 0x0, 0x1, 0x1d7b, 0x0, 0x1, 0x29d, 0x0, 0x1, 0x26d, 0x0, 0x1, 0x1d85, 0x0, 0x1,
+			0x29f, 0x0, 0x1, 0x271, 0x0, 0x1, 0x270, 0x0, 0x1, 0x272, 0x0, 0x1, 0x273, 0x0, 0x1, 0x274, 0x0, 0x1,
+			0x275, 0x0, 0x1, 0x278, 0x0, 0x1, 0x282, 0x0, 0x1, 0x283, 0x0, 0x1, 0x1ab, 0x0, 0x1, 0x289, 0x0, 0x1,
+			0x28a, 0x0, 0x1, 0x1d1c, 0x0, 0x1, 0x28b, 0x0, 0x1, 0x28c, 0x0, 0x1, 0x7a, 0x0, 0x1, 0x290, 0x0, 0x1,
+			0x291, 0x0, 0x1, 0x292, 0x0, 0x1, 0x3b8, 0x2, 0x41, 0x325, 0x0, 0x2, 0x61, 0x325, 0x0, 0x2, 0x42, 0x307,
+			0x0, 0x2, 0x62, 0x307, 0x0, 0x2, 0x42, 0x323, 0x0, 0x2, 0x62, 0x323, 0x0, 0x2, 0x42, 0x331, 0x0, 0x2,
+			0x62, 0x331, 0x0, 0x3, 0x43, 0x327, 0x301, 0x0, 0x3, 0x63, 0x327, 0x301, 0x0, 0x2, 0x44, 0x307, 0x0,
+			0x2, 0x64, 0x307, 0x0, 0x2, 0x44, 0x323, 0x0, 0x2, 0x64, 0x323, 0x0, 0x2, 0x44, 0x331, 0x0, 0x2, 0x64,
+			0x331, 0x0, 0x2, 0x44, 0x327, 0x0, 0x2, 0x64, 0x327, 0x0, 0x2, 0x44, 0x32d, 0x0, 0x2, 0x64, 0x32d, 0x0,
+			0x3, 0x45, 0x304, 0x300, 0x0, 0x3, 0x65, 0x304, 0x300, 0x0, 0x3, 0x45, 0x304, 0x301, 0x0, 0x3, 0x65,
+			0x304, 0x301, 0x0, 0x2, 0x45, 0x32d, 0x0, 0x2, 0x65, 0x32d, 0x0, 0x2, 0x45, 0x330, 0x0, 0x2, 0x65,
+			0x330, 0x0, 0x3, 0x45, 0x327, 0x306, 0x0, 0x3, 0x65, 0x327, 0x306, 0x0, 0x2, 0x46, 0x307, 0x0, 0x2,
+			0x66, 0x307, 0x0, 0x2, 0x47, 0x304, 0x0, 0x2, 0x67, 0x304, 0x0, 0x2, 0x48, 0x307, 0x0, 0x2, 0x68, 0x307,
+			0x0, 0x2, 0x48, 0x323, 0x0, 0x2, 0x68, 0x323, 0x0, 0x2, 0x48, 0x308, 0x0, 0x2, 0x68, 0x308, 0x0, 0x2,
+			0x48, 0x327, 0x0, 0x2, 0x68, 0x327, 0x0, 0x2, 0x48, 0x32e, 0x0, 0x2, 0x68, 0x32e, 0x0, 0x2, 0x49, 0x330,
+			0x0, 0x2, 0x69, 0x330, 0x0, 0x3, 0x49, 0x308, 0x301, 0x0, 0x3, 0x69, 0x308, 0x301, 0x0, 0x2, 0x4b,
+			0x301, 0x0, 0x2, 0x6b, 0x301, 0x0, 0x2, 0x4b, 0x323, 0x0, 0x2, 0x6b, 0x323, 0x0, 0x2, 0x4b, 0x331, 0x0,
+			0x2, 0x6b, 0x331, 0x0, 0x2, 0x4c, 0x323, 0x0, 0x2, 0x6c, 0x323, 0x0, 0x3, 0x4c, 0x323, 0x304, 0x0, 0x3,
+			0x6c, 0x323, 0x304, 0x0, 0x2, 0x4c, 0x331, 0x0, 0x2, 0x6c, 0x331, 0x0, 0x2, 0x4c, 0x32d, 0x0, 0x2, 0x6c,
+			0x32d, 0x0, 0x2, 0x4d, 0x301, 0x0, 0x2, 0x6d, 0x301, 0x0, 0x2, 0x4d, 0x307, 0x0, 0x2, 0x6d, 0x307, 0x0,
+			0x2, 0x4d, 0x323, 0x0, 0x2, 0x6d, 0x323, 0x0, 0x2, 0x4e, 0x307, 0x0, 0x2, 0x6e, 0x307, 0x0, 0x2, 0x4e,
+			0x323, 0x0, 0x2, 0x6e, 0x323, 0x0, 0x2, 0x4e, 0x331, 0x0, 0x2, 0x6e, 0x331, 0x0, 0x2, 0x4e, 0x32d, 0x0,
+			0x2, 0x6e, 0x32d, 0x0, 0x3, 0x4f, 0x303, 0x301, 0x0, 0x3, 0x6f, 0x303, 0x301, 0x0, 0x3, 0x4f, 0x303,
+			0x308, 0x0, 0x3, 0x6f, 0x303, 0x308, 0x0, 0x3, 0x4f, 0x304, 0x300, 0x0, 0x3, 0x6f, 0x304, 0x300, 0x0,
+			0x3, 0x4f, 0x304, 0x301, 0x0, 0x3, 0x6f, 0x304, 0x301, 0x0, 0x2, 0x50, 0x301, 0x0, 0x2, 0x70, 0x301,
+			0x0, 0x2, 0x50, 0x307, 0x0, 0x2, 0x70, 0x307, 0x0, 0x2, 0x52, 0x307, 0x0, 0x2, 0x72, 0x307, 0x0, 0x2,
+			0x52, 0x323, 0x0, 0x2, 0x72, 0x323, 0x0, 0x3, 0x52, 0x323, 0x304, 0x0, 0x3, 0x72, 0x323, 0x304, 0x0,
+			0x2, 0x52, 0x331, 0x0, 0x2, 0x72, 0x331, 0x0, 0x2, 0x53, 0x307, 0x0, 0x2, 0x73, 0x307, 0x0, 0x2, 0x53,
+			0x323, 0x0, 0x2, 0x73, 0x323, 0x0, 0x3, 0x53, 0x301, 0x307, 0x0, 0x3, 0x73, 0x301, 0x307, 0x0, 0x3,
+			0x53, 0x30c, 0x307, 0x0, 0x3, 0x73, 0x30c, 0x307, 0x0, 0x3, 0x53, 0x323, 0x307, 0x0, 0x3, 0x73, 0x323,
+			0x307, 0x0, 0x2, 0x54, 0x307, 0x0, 0x2, 0x74, 0x307, 0x0, 0x2, 0x54, 0x323, 0x0, 0x2, 0x74, 0x323, 0x0,
+			0x2, 0x54, 0x331, 0x0, 0x2, 0x74, 0x331, 0x0, 0x2, 0x54, 0x32d, 0x0, 0x2, 0x74, 0x32d, 0x0, 0x2, 0x55,
+			0x324, 0x0, 0x2, 0x75, 0x324, 0x0, 0x2, 0x55, 0x330, 0x0, 0x2, 0x75, 0x330, 0x0, 0x2, 0x55, 0x32d, 0x0,
+			0x2, 0x75, 0x32d, 0x0, 0x3, 0x55, 0x303, 0x301, 0x0, 0x3, 0x75, 0x303, 0x301, 0x0, 0x3, 0x55, 0x304,
+			0x308, 0x0, 0x3, 0x75, 0x304, 0x308, 0x0, 0x2, 0x56, 0x303, 0x0, 0x2, 0x76, 0x303, 0x0, 0x2, 0x56,
+			0x323, 0x0, 0x2, 0x76, 0x323, 0x0, 0x2, 0x57, 0x300, 0x0, 0x2, 0x77, 0x300, 0x0, 0x2, 0x57, 0x301, 0x0,
+			0x2, 0x77, 0x301, 0x0, 0x2, 0x57, 0x308, 0x0, 0x2, 0x77, 0x308, 0x0, 0x2, 0x57, 0x307, 0x0, 0x2, 0x77,
+			0x307, 0x0, 0x2, 0x57, 0x323, 0x0, 0x2, 0x77, 0x323, 0x0, 0x2, 0x58, 0x307, 0x0, 0x2, 0x78, 0x307, 0x0,
+			0x2, 0x58, 0x308, 0x0, 0x2, 0x78, 0x308, 0x0, 0x2, 0x59, 0x307, 0x0, 0x2, 0x79, 0x307, 0x0, 0x2, 0x5a,
+			0x302, 0x0, 0x2, 0x7a, 0x302, 0x0, 0x2, 0x5a, 0x323, 0x0, 0x2, 0x7a, 0x323, 0x0, 0x2, 0x5a, 0x331, 0x0,
+			0x2, 0x7a, 0x331, 0x0, 0x2, 0x68, 0x331, 0x0, 0x2, 0x74, 0x308, 0x0, 0x2, 0x77, 0x30a, 0x0, 0x2, 0x79,
+			0x30a, 0x0, 0x0, 0x2, 0x61, 0x2be, 0x2, 0x17f, 0x307, 0x2, 0x73, 0x307, 0x2, 0x41, 0x323, 0x0, 0x2,
+			0x61, 0x323, 0x0, 0x2, 0x41, 0x309, 0x0, 0x2, 0x61, 0x309, 0x0, 0x3, 0x41, 0x302, 0x301, 0x0, 0x3, 0x61,
+			0x302, 0x301, 0x0, 0x3, 0x41, 0x302, 0x300, 0x0, 0x3, 0x61, 0x302, 0x300, 0x0, 0x3, 0x41, 0x302, 0x309,
+			0x0, 0x3, 0x61, 0x302, 0x309, 0x0, 0x3, 0x41, 0x302, 0x303, 0x0, 0x3, 0x61, 0x302, 0x303, 0x0, 0x3,
+			0x41, 0x323, 0x302, 0x0, 0x3, 0x61, 0x323, 0x302, 0x0, 0x3, 0x41, 0x306, 0x301, 0x0, 0x3, 0x61, 0x306,
+			0x301, 0x0, 0x3, 0x41, 0x306, 0x300, 0x0, 0x3, 0x61, 0x306, 0x300, 0x0, 0x3, 0x41, 0x306, 0x309, 0x0,
+			0x3, 0x61, 0x306, 0x309, 0x0, 0x3, 0x41, 0x306, 0x303, 0x0, 0x3, 0x61, 0x306, 0x303, 0x0, 0x3, 0x41,
+			0x323, 0x306, 0x0, 0x3, 0x61, 0x323, 0x306, 0x0, 0x2, 0x45, 0x323, 0x0, 0x2, 0x65, 0x323, 0x0, 0x2,
+			0x45, 0x309, 0x0, 0x2, 0x65, 0x309, 0x0, 0x2, 0x45, 0x303, 0x0, 0x2, 0x65, 0x303, 0x0, 0x3, 0x45, 0x302,
+			0x301, 0x0, 0x3, 0x65, 0x302, 0x301, 0x0, 0x3, 0x45, 0x302, 0x300, 0x0, 0x3, 0x65, 0x302, 0x300, 0x0,
+			0x3, 0x45, 0x302, 0x309, 0x0, 0x3, 0x65, 0x302, 0x309, 0x0, 0x3, 0x45, 0x302, 0x303, 0x0, 0x3, 0x65,
+			0x302, 0x303, 0x0, 0x3, 0x45, 0x323, 0x302, 0x0, 0x3, 0x65, 0x323, 0x302, 0x0, 0x2, 0x49, 0x309, 0x0,
+			0x2, 0x69, 0x309, 0x0, 0x2, 0x49, 0x323, 0x0, 0x2, 0x69, 0x323, 0x0, 0x2, 0x4f, 0x323, 0x0, 0x2, 0x6f,
+			0x323, 0x0, 0x2, 0x4f, 0x309, 0x0, 0x2, 0x6f, 0x309, 0x0, 0x3, 0x4f, 0x302, 0x301, 0x0, 0x3, 0x6f,
+			0x302, 0x301, 0x0, 0x3, 0x4f, 0x302, 0x300, 0x0, 0x3, 0x6f, 0x302, 0x300, 0x0, 0x3, 0x4f, 0x302, 0x309,
+			0x0, 0x3, 0x6f, 0x302, 0x309, 0x0, 0x3, 0x4f, 0x302, 0x303, 0x0, 0x3, 0x6f, 0x302, 0x303, 0x0, 0x3,
+			0x4f, 0x323, 0x302, 0x0, 0x3, 0x6f, 0x323, 0x302, 0x0, 0x3, 0x4f, 0x31b, 0x301, 0x0, 0x3, 0x6f, 0x31b,
+			0x301, 0x0, 0x3, 0x4f, 0x31b, 0x300, 0x0, 0x3, 0x6f, 0x31b, 0x300, 0x0, 0x3, 0x4f, 0x31b, 0x309, 0x0,
+			0x3, 0x6f, 0x31b, 0x309, 0x0, 0x3, 0x4f, 0x31b, 0x303, 0x0, 0x3, 0x6f, 0x31b, 0x303, 0x0, 0x3, 0x4f,
+			0x31b, 0x323, 0x0, 0x3, 0x6f, 0x31b, 0x323, 0x0, 0x2, 0x55, 0x323, 0x0, 0x2, 0x75, 0x323, 0x0, 0x2,
+			0x55, 0x309, 0x0, 0x2, 0x75, 0x309, 0x0, 0x3, 0x55, 0x31b, 0x301, 0x0, 0x3, 0x75, 0x31b, 0x301, 0x0,
+			0x3, 0x55, 0x31b, 0x300, 0x0, 0x3, 0x75, 0x31b, 0x300, 0x0, 0x3, 0x55, 0x31b, 0x309, 0x0, 0x3, 0x75,
+			0x31b, 0x309, 0x0, 0x3, 0x55, 0x31b, 0x303, 0x0, 0x3, 0x75, 0x31b, 0x303, 0x0, 0x3, 0x55, 0x31b, 0x323,
+			0x0, 0x3, 0x75, 0x31b, 0x323, 0x0, 0x2, 0x59, 0x300, 0x0, 0x2, 0x79, 0x300, 0x0, 0x2, 0x59, 0x323, 0x0,
+			0x2, 0x79, 0x323, 0x0, 0x2, 0x59, 0x309, 0x0, 0x2, 0x79, 0x309, 0x0, 0x2, 0x59, 0x303, 0x0, 0x2, 0x79,
+			0x303, 0x0, 0x2, 0x3b1, 0x313, 0x0, 0x2, 0x3b1, 0x314, 0x0, 0x3, 0x3b1, 0x313, 0x300, 0x0, 0x3, 0x3b1,
+			0x314, 0x300, 0x0, 0x3, 0x3b1, 0x313, 0x301, 0x0, 0x3, 0x3b1, 0x314, 0x301, 0x0, 0x3, 0x3b1, 0x313,
+			0x342, 0x0, 0x3, 0x3b1, 0x314, 0x342, 0x0, 0x2, 0x391, 0x313, 0x0, 0x2, 0x391, 0x314, 0x0, 0x3, 0x391,
+			0x313, 0x300, 0x0, 0x3, 0x391, 0x314, 0x300, 0x0, 0x3, 0x391, 0x313, 0x301, 0x0, 0x3, 0x391, 0x314,
+			0x301, 0x0, 0x3, 0x391, 0x313, 0x342, 0x0, 0x3, 0x391, 0x314, 0x342, 0x0, 0x2, 0x3b5, 0x313, 0x0, 0x2,
+			0x3b5, 0x314, 0x0, 0x3, 0x3b5, 0x313, 0x300, 0x0, 0x3, 0x3b5, 0x314, 0x300, 0x0, 0x3, 0x3b5, 0x313,
+			0x301, 0x0, 0x3, 0x3b5, 0x314, 0x301, 0x0, 0x2, 0x395, 0x313, 0x0, 0x2, 0x395, 0x314, 0x0, 0x3, 0x395,
+			0x313, 0x300, 0x0, 0x3, 0x395, 0x314, 0x300, 0x0, 0x3, 0x395, 0x313, 0x301, 0x0, 0x3, 0x395, 0x314,
+			0x301, 0x0, 0x2, 0x3b7, 0x313, 0x0, 0x2, 0x3b7, 0x314, 0x0, 0x3, 0x3b7, 0x313, 0x300, 0x0, 0x3, 0x3b7,
+			0x314, 0x300, 0x0, 0x3, 0x3b7, 0x313, 0x301, 0x0, 0x3, 0x3b7, 0x314, 0x301, 0x0, 0x3, 0x3b7, 0x313,
+			0x342, 0x0, 0x3, 0x3b7, 0x314, 0x342, 0x0, 0x2, 0x397, 0x313, 0x0, 0x2, 0x397, 0x314, 0x0, 0x3, 0x397,
+			0x313, 0x300, 0x0, 0x3, 0x397, 0x314, 0x300, 0x0, 0x3, 0x397, 0x313, 0x301, 0x0, 0x3, 0x397, 0x314,
+			0x301, 0x0, 0x3, 0x397, 0x313, 0x342, 0x0, 0x3, 0x397, 0x314, 0x342, 0x0, 0x2, 0x3b9, 0x313, 0x0, 0x2,
+			0x3b9, 0x314, 0x0, 0x3, 0x3b9, 0x313, 0x300, 0x0, 0x3, 0x3b9, 0x314, 0x300, 0x0, 0x3, 0x3b9, 0x313,
+			0x301, 0x0, 0x3, 0x3b9, 0x314, 0x301, 0x0, 0x3, 0x3b9, 0x313, 0x342, 0x0, 0x3, 0x3b9, 0x314, 0x342, 0x0,
+			0x2, 0x399, 0x313, 0x0, 0x2, 0x399, 0x314, 0x0, 0x3, 0x399, 0x313, 0x300, 0x0, 0x3, 0x399, 0x314, 0x300,
+			0x0, 0x3, 0x399, 0x313, 0x301, 0x0, 0x3, 0x399, 0x314, 0x301, 0x0, 0x3, 0x399, 0x313, 0x342, 0x0, 0x3,
+			0x399, 0x314, 0x342, 0x0, 0x2, 0x3bf, 0x313, 0x0, 0x2, 0x3bf, 0x314, 0x0, 0x3, 0x3bf, 0x313, 0x300, 0x0,
+			0x3, 0x3bf, 0x314, 0x300, 0x0, 0x3, 0x3bf, 0x313, 0x301, 0x0, 0x3, 0x3bf, 0x314, 0x301, 0x0, 0x2, 0x39f,
+			0x313, 0x0, 0x2, 0x39f, 0x314, 0x0, 0x3, 0x39f, 0x313, 0x300, 0x0, 0x3, 0x39f, 0x314, 0x300, 0x0, 0x3,
+			0x39f, 0x313, 0x301, 0x0, 0x3, 0x39f, 0x314, 0x301, 0x0, 0x2, 0x3c5, 0x313, 0x0, 0x2, 0x3c5, 0x314, 0x0,
+			0x3, 0x3c5, 0x313, 0x300, 0x0, 0x3, 0x3c5, 0x314, 0x300, 0x0, 0x3, 0x3c5, 0x313, 0x301, 0x0, 0x3, 0x3c5,
+			0x314, 0x301, 0x0, 0x3, 0x3c5, 0x313, 0x342, 0x0, 0x3, 0x3c5, 0x314, 0x342, 0x0, 0x2, 0x3a5, 0x314, 0x0,
+			0x3, 0x3a5, 0x314, 0x300, 0x0, 0x3, 0x3a5, 0x314, 0x301, 0x0, 0x3, 0x3a5, 0x314, 0x342, 0x0, 0x2, 0x3c9,
+			0x313, 0x0, 0x2, 0x3c9, 0x314, 0x0, 0x3, 0x3c9, 0x313, 0x300, 0x0, 0x3, 0x3c9, 0x314, 0x300, 0x0, 0x3,
+			0x3c9, 0x313, 0x301, 0x0, 0x3, 0x3c9, 0x314, 0x301, 0x0, 0x3, 0x3c9, 0x313, 0x342, 0x0, 0x3, 0x3c9,
+			0x314, 0x342, 0x0, 0x2, 0x3a9, 0x313, 0x0, 0x2, 0x3a9, 0x314, 0x0, 0x3, 0x3a9, 0x313, 0x300, 0x0, 0x3,
+			0x3a9, 0x314, 0x300, 0x0, 0x3, 0x3a9, 0x313, 0x301, 0x0, 0x3, 0x3a9, 0x314, 0x301, 0x0, 0x3, 0x3a9,
+			0x313, 0x342, 0x0, 0x3, 0x3a9, 0x314, 0x342, 0x0, 0x2, 0x3b1, 0x300, 0x0, 0x2, 0x3b1, 0x301, 0x0, 0x2,
+			0x3b5, 0x300, 0x0, 0x2, 0x3b5, 0x301, 0x0, 0x2, 0x3b7, 0x300, 0x0, 0x2, 0x3b7, 0x301, 0x0, 0x2, 0x3b9,
+			0x300, 0x0, 0x2, 0x3b9, 0x301, 0x0, 0x2, 0x3bf, 0x300, 0x0, 0x2, 0x3bf, 0x301, 0x0, 0x2, 0x3c5, 0x300,
+			0x0, 0x2, 0x3c5, 0x301, 0x0, 0x2, 0x3c9, 0x300, 0x0, 0x2, 0x3c9, 0x301, 0x0, 0x3, 0x3b1, 0x313, 0x345,
+			0x0, 0x3, 0x3b1, 0x314, 0x345, 0x0, 0x4, 0x3b1, 0x313, 0x300, 0x345, 0x0, 0x4, 0x3b1, 0x314, 0x300,
+			0x345, 0x0, 0x4, 0x3b1, 0x313, 0x301, 0x345, 0x0, 0x4, 0x3b1, 0x314, 0x301, 0x345, 0x0, 0x4, 0x3b1,
+			0x313, 0x342, 0x345, 0x0, 0x4, 0x3b1, 0x314, 0x342, 0x345, 0x0, 0x3, 0x391, 0x313, 0x345, 0x0, 0x3,
+			0x391, 0x314, 0x345, 0x0, 0x4, 0x391, 0x313, 0x300, 0x345, 0x0, 0x4, 0x391, 0x314, 0x300, 0x345, 0x0,
+			0x4, 0x391, 0x313, 0x301, 0x345, 0x0, 0x4, 0x391, 0x314, 0x301, 0x345, 0x0, 0x4, 0x391, 0x313, 0x342,
+			0x345, 0x0, 0x4, 0x391, 0x314, 0x342, 0x345, 0x0, 0x3, 0x3b7, 0x313, 0x345, 0x0, 0x3, 0x3b7, 0x314,
+			0x345, 0x0, 0x4, 0x3b7, 0x313, 0x300, 0x345, 0x0, 0x4, 0x3b7, 0x314, 0x300, 0x345, 0x0, 0x4, 0x3b7,
+			0x313, 0x301, 0x345, 0x0, 0x4, 0x3b7, 0x314, 0x301, 0x345, 0x0, 0x4, 0x3b7, 0x313, 0x342, 0x345, 0x0,
+			0x4, 0x3b7, 0x314, 0x342, 0x345, 0x0, 0x3, 0x397, 0x313, 0x345, 0x0, 0x3, 0x397, 0x314, 0x345, 0x0, 0x4,
+			0x397, 0x313, 0x300, 0x345, 0x0, 0x4, 0x397, 0x314, 0x300, 0x345, 0x0, 0x4, 0x397, 0x313, 0x301, 0x345,
+			0x0, 0x4, 0x397, 0x314, 0x301, 0x345, 0x0, 0x4, 0x397, 0x313, 0x342, 0x345, 0x0, 0x4, 0x397, 0x314,
+			0x342, 0x345, 0x0, 0x3, 0x3c9, 0x313, 0x345, 0x0, 0x3, 0x3c9, 0x314, 0x345, 0x0, 0x4, 0x3c9, 0x313,
+			0x300, 0x345, 0x0, 0x4, 0x3c9, 0x314, 0x300, 0x345, 0x0, 0x4, 0x3c9, 0x313, 0x301, 0x345, 0x0, 0x4,
+			0x3c9, 0x314, 0x301, 0x345, 0x0, 0x4, 0x3c9, 0x313, 0x342, 0x345, 0x0, 0x4, 0x3c9, 0x314, 0x342, 0x345,
+			0x0, 0x3, 0x3a9, 0x313, 0x345, 0x0, 0x3, 0x3a9, 0x314, 0x345, 0x0, 0x4, 0x3a9, 0x313, 0x300, 0x345, 0x0,
+			0x4, 0x3a9, 0x314, 0x300, 0x345, 0x0, 0x4, 0x3a9, 0x313, 0x301, 0x345, 0x0, 0x4, 0x3a9, 0x314, 0x301,
+			0x345, 0x0, 0x4, 0x3a9, 0x313, 0x342, 0x345, 0x0, 0x4, 0x3a9, 0x314, 0x342, 0x345, 0x0, 0x2, 0x3b1,
+			0x306, 0x0, 0x2, 0x3b1, 0x304, 0x0, 0x3, 0x3b1, 0x300, 0x345, 0x0, 0x2, 0x3b1, 0x345, 0x0, 0x3, 0x3b1,
+			0x301, 0x345, 0x0, 0x2, 0x3b1, 0x342, 0x0, 0x3, 0x3b1, 0x342, 0x345, 0x0, 0x2, 0x391, 0x306, 0x0, 0x2,
+			0x391, 0x304, 0x0, 0x2, 0x391, 0x300, 0x0, 0x2, 0x391, 0x301, 0x0, 0x2, 0x391, 0x345, 0x0, 0x0, 0x2,
+			0x20, 0x313, 0x1, 0x3b9, 0x0, 0x0, 0x2, 0x20, 0x313, 0x0, 0x2, 0x20, 0x342, 0x2, 0xa8, 0x342, 0x3, 0x20,
+			0x308, 0x342, 0x3, 0x3b7, 0x300, 0x345, 0x0, 0x2, 0x3b7, 0x345, 0x0, 0x3, 0x3b7, 0x301, 0x345, 0x0, 0x2,
+			0x3b7, 0x342, 0x0, 0x3, 0x3b7, 0x342, 0x345, 0x0, 0x2, 0x395, 0x300, 0x0, 0x2, 0x395, 0x301, 0x0, 0x2,
+			0x397, 0x300, 0x0, 0x2, 0x397, 0x301, 0x0, 0x2, 0x397, 0x345, 0x0, 0x2, 0x1fbf, 0x300, 0x3, 0x20, 0x313,
+			0x300, 0x2, 0x1fbf, 0x301, 0x3, 0x20, 0x313, 0x301, 0x2, 0x1fbf, 0x342, 0x3, 0x20, 0x313, 0x342, 0x2,
+			0x3b9, 0x306, 0x0, 0x2, 0x3b9, 0x304, 0x0, 0x3, 0x3b9, 0x308, 0x300, 0x0, 0x3, 0x3b9, 0x308, 0x301, 0x0,
+			0x2, 0x3b9, 0x342, 0x0, 0x3, 0x3b9, 0x308, 0x342, 0x0, 0x2, 0x399, 0x306, 0x0, 0x2, 0x399, 0x304, 0x0,
+			0x2, 0x399, 0x300, 0x0, 0x2, 0x399, 0x301, 0x0, 0x2, 0x1ffe, 0x300, 0x3, 0x20, 0x314, 0x300, 0x2,
+			0x1ffe, 0x301, 0x3, 0x20, 0x314, 0x301, 0x2, 0x1ffe, 0x342, 0x3, 0x20, 0x314, 0x342, 0x2, 0x3c5, 0x306,
+			0x0, 0x2, 0x3c5, 0x304, 0x0, 0x3, 0x3c5, 0x308, 0x300, 0x0, 0x3, 0x3c5, 0x308, 0x301, 0x0, 0x2, 0x3c1,
+			0x313, 0x0, 0x2, 0x3c1, 0x314, 0x0, 0x2, 0x3c5, 0x342, 0x0, 0x3, 0x3c5, 0x308, 0x342, 0x0, 0x2, 0x3a5,
+			0x306, 0x0, 0x2, 0x3a5, 0x304, 0x0, 0x2, 0x3a5, 0x300, 0x0, 0x2, 0x3a5, 0x301, 0x0, 0x2, 0x3a1, 0x314,
+			0x0, 0x2, 0xa8, 0x300, 0x3, 0x20, 0x308, 0x300, 0x2, 0xa8, 0x301, 0x3, 0x20, 0x308, 0x301, 0x1, 0x60,
+			0x0, 0x3, 0x3c9, 0x300, 0x345, 0x0, 0x2, 0x3c9, 0x345, 0x0, 0x3, 0x3c9, 0x301, 0x345, 0x0, 0x2, 0x3c9,
+			0x342, 0x0, 0x3, 0x3c9, 0x342, 0x345, 0x0, 0x2, 0x39f, 0x300, 0x0, 0x2, 0x39f, 0x301, 0x0, 0x2, 0x3a9,
+			0x300, 0x0, 0x2, 0x3a9, 0x301, 0x0, 0x2, 0x3a9, 0x345, 0x0, 0x1, 0xb4, 0x2, 0x20, 0x301, 0x0, 0x2, 0x20,
+			0x314, 0x1, 0x2002, 0x1, 0x20, 0x1, 0x2003, 0x1, 0x20, 0x0, 0x1, 0x20, 0x0, 0x1, 0x20, 0x0, 0x1, 0x20,
+			0x0, 0x1, 0x20, 0x0, 0x1, 0x20, 0x0, 0x1, 0x20, 0x0, 0x1, 0x20, 0x0, 0x1, 0x20, 0x0, 0x1, 0x20, 0x0,
+			0x1, 0x2010, 0x0, 0x2, 0x20, 0x333, 0x0, 0x1, 0x2e, 0x0, 0x2, 0x2e, 0x2e, 0x0, 0x3, 0x2e, 0x2e, 0x2e,
+			0x0, 0x1, 0x20, 0x0, 0x2, 0x2032, 0x2032, 0x0, 0x3, 0x2032, 0x2032, 0x2032, 0x0, 0x2, 0x2035, 0x2035,
+			0x0, 0x3, 0x2035, 0x2035, 0x2035, 0x0, 0x2, 0x21, 0x21, 0x0, 0x2, 0x20, 0x305, 0x0, 0x2, 0x3f, 0x3f,
+			0x0, 0x2, 0x3f, 0x21, 0x0, 0x2, 0x21, 0x3f, 0x0, 0x4, 0x2032, 0x2032, 0x2032, 0x2032, 0x0, 0x1, 0x20,
+			0x0, 0x1, 0x30, 0x0, 0x1, 0x69, 0x0, 0x1, 0x34, 0x0, 0x1, 0x35, 0x0, 0x1, 0x36, 0x0, 0x1, 0x37, 0x0,
+			0x1, 0x38, 0x0, 0x1, 0x39, 0x0, 0x1, 0x2b, 0x0, 0x1, 0x2212, 0x0, 0x1, 0x3d, 0x0, 0x1, 0x28, 0x0, 0x1,
+			0x29, 0x0, 0x1, 0x6e, 0x0, 0x1, 0x30, 0x0, 0x1, 0x31, 0x0, 0x1, 0x32, 0x0, 0x1, 0x33, 0x0, 0x1, 0x34,
+			0x0, 0x1, 0x35, 0x0, 0x1, 0x36, 0x0, 0x1, 0x37, 0x0, 0x1, 0x38, 0x0, 0x1, 0x39, 0x0, 0x1, 0x2b, 0x0,
+			0x1, 0x2212, 0x0, 0x1, 0x3d, 0x0, 0x1, 0x28, 0x0, 0x1, 0x29, 0x0, 0x1, 0x61, 0x0, 0x1, 0x65, 0x0, 0x1,
+			0x6f, 0x0, 0x1, 0x78, 0x0, 0x1, 0x259, 0x0, 0x1, 0x68, 0x0, 0x1, 0x6b, 0x0, 0x1, 0x6c, 0x0, 0x1, 0x6d,
+			0x0, 0x1, 0x6e, 0x0, 0x1, 0x70, 0x0, 0x1, 0x73, 0x0, 0x1, 0x74, 0x0, 0x2, 0x52, 0x73, 0x0, 0x3, 0x61,
+			0x2f, 0x63, 0x0, 0x3, 0x61, 0x2f, 0x73, 0x0, 0x1, 0x43, 0x0, 0x2, 0xb0, 0x43, 0x0, 0x3, 0x63, 0x2f,
+			0x6f, 0x0, 0x3, 0x63, 0x2f, 0x75, 0x0, 0x1, 0x190, 0x0, 0x2, 0xb0, 0x46, 0x0, 0x1, 0x67, 0x0, 0x1, 0x48,
+			0x0, 0x1, 0x48, 0x0, 0x1, 0x48, 0x0, 0x1, 0x68, 0x0, 0x1, 0x127, 0x0, 0x1, 0x49, 0x0, 0x1, 0x49, 0x0,
+			0x1, 0x4c, 0x0, 0x1, 0x6c, 0x0, 0x1, 0x4e, 0x0, 0x2, 0x4e, 0x6f, 0x0, 0x1, 0x50, 0x0, 0x1, 0x51, 0x0,
+			0x1, 0x52, 0x0, 0x1, 0x52, 0x0, 0x1, 0x52, 0x0, 0x2, 0x53, 0x4d, 0x0, 0x3, 0x54, 0x45, 0x4c, 0x0, 0x2,
+			0x54, 0x4d, 0x0, 0x1, 0x5a, 0x1, 0x3a9, 0x0, 0x0, 0x1, 0x5a, 0x1, 0x4b, 0x0, 0x2, 0x41, 0x30a, 0x0, 0x0,
+			0x1, 0x42, 0x0, 0x1, 0x43, 0x0, 0x1, 0x65, 0x0, 0x1, 0x45, 0x0, 0x1, 0x46, 0x0, 0x1, 0x4d, 0x0, 0x1,
+			0x6f, 0x0, 0x1, 0x5d0, 0x0, 0x1, 0x5d1, 0x0, 0x1, 0x5d2, 0x0, 0x1, 0x5d3, 0x0, 0x1, 0x69, 0x0, 0x3,
+			0x46, 0x41, 0x58, 0x0, 0x1, 0x3c0, 0x0, 0x1, 0x3b3, 0x0, 0x1, 0x393, 0x0, 0x1, 0x3a0, 0x0, 0x1, 0x2211,
+			0x0, 0x1, 0x44, 0x0, 0x1, 0x64, 0x0, 0x1, 0x65, 0x0, 0x1, 0x69, 0x0, 0x1, 0x6a, 0x0, 0x3, 0x31, 0x2044,
+			0x37, 0x0, 0x3, 0x31, 0x2044, 0x39, 0x0, 0x4, 0x31, 0x2044, 0x31, 0x30, 0x0, 0x3, 0x31, 0x2044, 0x33,
+			0x0, 0x3, 0x32, 0x2044, 0x33, 0x0, 0x3, 0x31, 0x2044, 0x35, 0x0, 0x3, 0x32, 0x2044, 0x35, 0x0, 0x3,
+			0x33, 0x2044, 0x35, 0x0, 0x3, 0x34, 0x2044, 0x35, 0x0, 0x3, 0x31, 0x2044, 0x36, 0x0, 0x3, 0x35, 0x2044,
+			0x36, 0x0, 0x3, 0x31, 0x2044, 0x38, 0x0, 0x3, 0x33, 0x2044, 0x38, 0x0, 0x3, 0x35, 0x2044, 0x38, 0x0,
+			0x3, 0x37, 0x2044, 0x38, 0x0, 0x2, 0x31, 0x2044, 0x0, 0x1, 0x49, 0x0, 0x2, 0x49, 0x49, 0x0, 0x3, 0x49,
+			0x49, 0x49, 0x0, 0x2, 0x49, 0x56, 0x0, 0x1, 0x56, 0x0, 0x2, 0x56, 0x49, 0x0, 0x3, 0x56, 0x49, 0x49, 0x0,
+			0x4, 0x56, 0x49, 0x49, 0x49, 0x0, 0x2, 0x49, 0x58, 0x0, 0x1, 0x58, 0x0, 0x2, 0x58, 0x49, 0x0, 0x3, 0x58,
+			0x49, 0x49, 0x0, 0x1, 0x4c, 0x0, 0x1, 0x43, 0x0, 0x1, 0x44, 0x0, 0x1, 0x4d, 0x0, 0x1, 0x69, 0x0, 0x2,
+			0x69, 0x69, 0x0, 0x3, 0x69, 0x69, 0x69, 0x0, 0x2, 0x69, 0x76, 0x0, 0x1, 0x76, 0x0, 0x2, 0x76, 0x69, 0x0,
+			0x3, 0x76, 0x69, 0x69, 0x0, 0x4, 0x76, 0x69, 0x69, 0x69, 0x0, 0x2, 0x69, 0x78, 0x0, 0x1, 0x78, 0x0, 0x2,
+			0x78, 0x69, 0x0, 0x3, 0x78, 0x69, 0x69, 0x0, 0x1, 0x6c, 0x0, 0x1, 0x63, 0x0, 0x1, 0x64, 0x0, 0x1, 0x6d,
+			0x0, 0x3, 0x30, 0x2044, 0x33, 0x2, 0x2190, 0x338, 0x0, 0x2, 0x2192, 0x338, 0x0, 0x2, 0x2194, 0x338, 0x0,
+			0x2, 0x21d0, 0x338, 0x0, 0x2, 0x21d4, 0x338, 0x0, 0x2, 0x21d2, 0x338, 0x0, 0x2, 0x2203, 0x338, 0x0, 0x2,
+			0x2208, 0x338, 0x0, 0x2, 0x220b, 0x338, 0x0, 0x2, 0x2223, 0x338, 0x0, 0x2, 0x2225, 0x338, 0x0, 0x0, 0x2,
+			0x222b, 0x222b, 0x0, 0x3, 0x222b, 0x222b, 0x222b, 0x0, 0x2, 0x222e, 0x222e, 0x0, 0x3, 0x222e, 0x222e,
+			0x222e, 0x2, 0x223c, 0x338, 0x0, 0x2, 0x2243, 0x338, 0x0, 0x2, 0x2245, 0x338, 0x0, 0x2, 0x2248, 0x338,
+			0x0, 0x2, 0x3d, 0x338, 0x0, 0x2, 0x2261, 0x338, 0x0, 0x2, 0x224d, 0x338, 0x0, 0x2, 0x3c, 0x338, 0x0,
+			0x2, 0x3e, 0x338, 0x0, 0x2, 0x2264, 0x338, 0x0, 0x2, 0x2265, 0x338, 0x0, 0x2, 0x2272, 0x338, 0x0, 0x2,
+			0x2273, 0x338, 0x0, 0x2, 0x2276, 0x338, 0x0, 0x2, 0x2277, 0x338, 0x0, 0x2, 0x227a, 0x338, 0x0, 0x2,
+			0x227b, 0x338, 0x0, 0x2, 0x2282, 0x338, 0x0, 0x2, 0x2283, 0x338, 0x0, 0x2, 0x2286, 0x338, 0x0, 0x2,
+			0x2287, 0x338, 0x0, 0x2, 0x22a2, 0x338, 0x0, 0x2, 0x22a8, 0x338, 0x0, 0x2, 0x22a9, 0x338, 0x0, 0x2,
+			0x22ab, 0x338, 0x0, 0x2, 0x227c, 0x338, 0x0, 0x2, 0x227d, 0x338, 0x0, 0x2, 0x2291, 0x338, 0x0, 0x2,
+			0x2292, 0x338, 0x0, 0x2, 0x22b2, 0x338, 0x0, 0x2, 0x22b3, 0x338, 0x0, 0x2, 0x22b4, 0x338, 0x0, 0x2,
+			0x22b5, 0x338, 0x0, 0x1, 0x3008, 0x0, 0x1, 0x3009, 0x0, 0x0, 0x1, 0x31, 0x0, 0x1, 0x32, 0x0, 0x1, 0x33,
+			0x0, 0x1, 0x34, 0x0, 0x1, 0x35, 0x0, 0x1, 0x36, 0x0, 0x1, 0x37, 0x0, 0x1, 0x38, 0x0, 0x1, 0x39, 0x0,
+			0x2, 0x31, 0x30, 0x0, 0x2, 0x31, 0x31, 0x0, 0x2, 0x31, 0x32, 0x0, 0x2, 0x31, 0x33, 0x0, 0x2, 0x31, 0x34,
+			0x0, 0x2, 0x31, 0x35, 0x0, 0x2, 0x31, 0x36, 0x0, 0x2, 0x31, 0x37, 0x0, 0x2, 0x31, 0x38, 0x0, 0x2, 0x31,
+			0x39, 0x0, 0x2, 0x32, 0x30, 0x0, 0x3, 0x28, 0x31, 0x29, 0x0, 0x3, 0x28, 0x32, 0x29, 0x0, 0x3, 0x28,
+			0x33, 0x29, 0x0, 0x3, 0x28, 0x34, 0x29, 0x0, 0x3, 0x28, 0x35, 0x29, 0x0, 0x3, 0x28, 0x36, 0x29, 0x0,
+			0x3, 0x28, 0x37, 0x29, 0x0, 0x3, 0x28, 0x38, 0x29, 0x0, 0x3, 0x28, 0x39, 0x29, 0x0, 0x4, 0x28, 0x31,
+			0x30, 0x29, 0x0, 0x4, 0x28, 0x31, 0x31, 0x29, 0x0, 0x4, 0x28, 0x31, 0x32, 0x29, 0x0, 0x4, 0x28, 0x31,
+			0x33, 0x29, 0x0, 0x4, 0x28, 0x31, 0x34, 0x29, 0x0, 0x4, 0x28, 0x31, 0x35, 0x29, 0x0, 0x4, 0x28, 0x31,
+			0x36, 0x29, 0x0, 0x4, 0x28, 0x31, 0x37, 0x29, 0x0, 0x4, 0x28, 0x31, 0x38, 0x29, 0x0, 0x4, 0x28, 0x31,
+			0x39, 0x29, 0x0, 0x4, 0x28, 0x32, 0x30, 0x29, 0x0, 0x2, 0x31, 0x2e, 0x0, 0x2, 0x32, 0x2e, 0x0, 0x2,
+			0x33, 0x2e, 0x0, 0x2, 0x34, 0x2e, 0x0, 0x2, 0x35, 0x2e, 0x0, 0x2, 0x36, 0x2e, 0x0, 0x2, 0x37, 0x2e, 0x0,
+			0x2, 0x38, 0x2e, 0x0, 0x2, 0x39, 0x2e, 0x0, 0x3, 0x31, 0x30, 0x2e, 0x0, 0x3, 0x31, 0x31, 0x2e, 0x0, 0x3,
+			0x31, 0x32, 0x2e, 0x0, 0x3, 0x31, 0x33, 0x2e, 0x0, 0x3, 0x31, 0x34, 0x2e, 0x0, 0x3, 0x31, 0x35, 0x2e,
+			0x0, 0x3, 0x31, 0x36, 0x2e, 0x0, 0x3, 0x31, 0x37, 0x2e, 0x0, 0x3, 0x31, 0x38, 0x2e, 0x0, 0x3, 0x31,
+			0x39, 0x2e, 0x0, 0x3, 0x32, 0x30, 0x2e, 0x0, 0x3, 0x28, 0x61, 0x29, 0x0, 0x3, 0x28, 0x62, 0x29, 0x0,
+			0x3, 0x28, 0x63, 0x29, 0x0, 0x3, 0x28, 0x64, 0x29, 0x0, 0x3, 0x28, 0x65, 0x29, 0x0, 0x3, 0x28, 0x66,
+			0x29, 0x0, 0x3, 0x28, 0x67, 0x29, 0x0, 0x3, 0x28, 0x68, 0x29, 0x0, 0x3, 0x28, 0x69, 0x29, 0x0, 0x3,
+			0x28, 0x6a, 0x29, 0x0, 0x3, 0x28, 0x6b, 0x29, 0x0, 0x3, 0x28, 0x6c, 0x29, 0x0, 0x3, 0x28, 0x6d, 0x29,
+			0x0, 0x3, 0x28, 0x6e, 0x29, 0x0, 0x3, 0x28, 0x6f, 0x29, 0x0, 0x3, 0x28, 0x70, 0x29, 0x0, 0x3, 0x28,
+			0x71, 0x29, 0x0, 0x3, 0x28, 0x72, 0x29, 0x0, 0x3, 0x28, 0x73, 0x29, 0x0, 0x3, 0x28, 0x74, 0x29, 0x0,
+			0x3, 0x28, 0x75, 0x29, 0x0, 0x3, 0x28, 0x76, 0x29, 0x0, 0x3, 0x28, 0x77, 0x29, 0x0, 0x3, 0x28, 0x78,
+			0x29, 0x0, 0x3, 0x28, 0x79, 0x29, 0x0, 0x3, 0x28, 0x7a, 0x29, 0x0, 0x1, 0x41, 0x0, 0x1, 0x42, 0x0, 0x1,
+			0x43, 0x0, 0x1, 0x44, 0x0, 0x1, 0x45, 0x0, 0x1, 0x46, 0x0, 0x1, 0x47, 0x0, 0x1, 0x48, 0x0, 0x1, 0x49,
+			0x0, 0x1, 0x4a, 0x0, 0x1, 0x4b, 0x0, 0x1, 0x4c, 0x0, 0x1, 0x4d, 0x0, 0x1, 0x4e, 0x0, 0x1, 0x4f, 0x0,
+			0x1, 0x50, 0x0, 0x1, 0x51, 0x0, 0x1, 0x52, 0x0, 0x1, 0x53, 0x0, 0x1, 0x54, 0x0, 0x1, 0x55, 0x0, 0x1,
+			0x56, 0x0, 0x1, 0x57, 0x0, 0x1, 0x58, 0x0, 0x1, 0x59, 0x0, 0x1, 0x5a, 0x0, 0x1, 0x61, 0x0, 0x1, 0x62,
+			0x0, 0x1, 0x63, 0x0, 0x1, 0x64, 0x0, 0x1, 0x65, 0x0, 0x1, 0x66, 0x0, 0x1, 0x67, 0x0, 0x1, 0x68, 0x0,
+			0x1, 0x69, 0x0, 0x1, 0x6a, 0x0, 0x1, 0x6b, 0x0, 0x1, 0x6c, 0x0, 0x1, 0x6d, 0x0, 0x1, 0x6e, 0x0, 0x1,
+			0x6f, 0x0, 0x1, 0x70, 0x0, 0x1, 0x71, 0x0, 0x1, 0x72, 0x0, 0x1, 0x73, 0x0, 0x1, 0x74, 0x0, 0x1, 0x75,
+			0x0, 0x1, 0x76, 0x0, 0x1, 0x77, 0x0, 0x1, 0x78, 0x0, 0x1, 0x79, 0x0, 0x1, 0x7a, 0x0, 0x1, 0x30, 0x0,
+			0x4, 0x222b, 0x222b, 0x222b, 0x222b, 0x0, 0x3, 0x3a, 0x3a, 0x3d, 0x0, 0x2, 0x3d, 0x3d, 0x0, 0x3, 0x3d,
+			0x3d, 0x3d, 0x2, 0x2add, 0x338, 0x0, 0x0, 0x1, 0x6a, 0x0, 0x1, 0x56, 0x0, 0x1, 0x2d61, 0x0, 0x1, 0x6bcd,
+			0x0, 0x1, 0x9f9f, 0x0, 0x1, 0x4e00, 0x0, 0x1, 0x4e28, 0x0, 0x1, 0x4e36, 0x0, 0x1, 0x4e3f, 0x0, 0x1,
+			0x4e59, 0x0, 0x1, 0x4e85, 0x0, 0x1, 0x4e8c, 0x0, 0x1, 0x4ea0, 0x0, 0x1, 0x4eba, 0x0, 0x1, 0x513f, 0x0,
+			0x1, 0x5165, 0x0, 0x1, 0x516b, 0x0, 0x1, 0x5182, 0x0, 0x1, 0x5196, 0x0, 0x1, 0x51ab, 0x0, 0x1, 0x51e0,
+			0x0, 0x1, 0x51f5, 0x0, 0x1, 0x5200, 0x0, 0x1, 0x529b, 0x0, 0x1, 0x52f9, 0x0, 0x1, 0x5315, 0x0, 0x1,
+			0x531a, 0x0, 0x1, 0x5338, 0x0, 0x1, 0x5341, 0x0, 0x1, 0x535c, 0x0, 0x1, 0x5369, 0x0, 0x1, 0x5382, 0x0,
+			0x1, 0x53b6, 0x0, 0x1, 0x53c8, 0x0, 0x1, 0x53e3, 0x0, 0x1, 0x56d7, 0x0, 0x1, 0x571f, 0x0, 0x1, 0x58eb,
+			0x0, 0x1, 0x5902, 0x0, 0x1, 0x590a, 0x0, 0x1, 0x5915, 0x0, 0x1, 0x5927, 0x0, 0x1, 0x5973, 0x0, 0x1,
+			0x5b50, 0x0, 0x1, 0x5b80, 0x0, 0x1, 0x5bf8, 0x0, 0x1, 0x5c0f, 0x0, 0x1, 0x5c22, 0x0, 0x1, 0x5c38, 0x0,
+			0x1, 0x5c6e, 0x0, 0x1, 0x5c71, 0x0, 0x1, 0x5ddb, 0x0, 0x1, 0x5de5, 0x0, 0x1, 0x5df1, 0x0, 0x1, 0x5dfe,
+			0x0, 0x1, 0x5e72, 0x0, 0x1, 0x5e7a, 0x0, 0x1, 0x5e7f, 0x0, 0x1, 0x5ef4, 0x0, 0x1, 0x5efe, 0x0, 0x1,
+			0x5f0b, 0x0, 0x1, 0x5f13, 0x0, 0x1, 0x5f50, 0x0, 0x1, 0x5f61, 0x0, 0x1, 0x5f73, 0x0, 0x1, 0x5fc3, 0x0,
+			0x1, 0x6208, 0x0, 0x1, 0x6236, 0x0, 0x1, 0x624b, 0x0, 0x1, 0x652f, 0x0, 0x1, 0x6534, 0x0, 0x1, 0x6587,
+			0x0, 0x1, 0x6597, 0x0, 0x1, 0x65a4, 0x0, 0x1, 0x65b9, 0x0, 0x1, 0x65e0, 0x0, 0x1, 0x65e5, 0x0, 0x1,
+			0x66f0, 0x0, 0x1, 0x6708, 0x0, 0x1, 0x6728, 0x0, 0x1, 0x6b20, 0x0, 0x1, 0x6b62, 0x0, 0x1, 0x6b79, 0x0,
+			0x1, 0x6bb3, 0x0, 0x1, 0x6bcb, 0x0, 0x1, 0x6bd4, 0x0, 0x1, 0x6bdb, 0x0, 0x1, 0x6c0f, 0x0, 0x1, 0x6c14,
+			0x0, 0x1, 0x6c34, 0x0, 0x1, 0x706b, 0x0, 0x1, 0x722a, 0x0, 0x1, 0x7236, 0x0, 0x1, 0x723b, 0x0, 0x1,
+			0x723f, 0x0, 0x1, 0x7247, 0x0, 0x1, 0x7259, 0x0, 0x1, 0x725b, 0x0, 0x1, 0x72ac, 0x0, 0x1, 0x7384, 0x0,
+			0x1, 0x7389, 0x0, 0x1, 0x74dc, 0x0, 0x1, 0x74e6, 0x0, 0x1, 0x7518, 0x0, 0x1, 0x751f, 0x0, 0x1, 0x7528,
+			0x0, 0x1, 0x7530, 0x0, 0x1, 0x758b, 0x0, 0x1, 0x7592, 0x0, 0x1, 0x7676, 0x0, 0x1, 0x767d, 0x0, 0x1,
+			0x76ae, 0x0, 0x1, 0x76bf, 0x0, 0x1, 0x76ee, 0x0, 0x1, 0x77db, 0x0, 0x1, 0x77e2, 0x0, 0x1, 0x77f3, 0x0,
+			0x1, 0x793a, 0x0, 0x1, 0x79b8, 0x0, 0x1, 0x79be, 0x0, 0x1, 0x7a74, 0x0, 0x1, 0x7acb, 0x0, 0x1, 0x7af9,
+			0x0, 0x1, 0x7c73, 0x0, 0x1, 0x7cf8, 0x0, 0x1, 0x7f36, 0x0, 0x1, 0x7f51, 0x0, 0x1, 0x7f8a, 0x0, 0x1,
+			0x7fbd, 0x0, 0x1, 0x8001, 0x0, 0x1, 0x800c, 0x0, 0x1, 0x8012, 0x0, 0x1, 0x8033, 0x0, 0x1, 0x807f, 0x0,
+			0x1, 0x8089, 0x0, 0x1, 0x81e3, 0x0, 0x1, 0x81ea, 0x0, 0x1, 0x81f3, 0x0, 0x1, 0x81fc, 0x0, 0x1, 0x820c,
+			0x0, 0x1, 0x821b, 0x0, 0x1, 0x821f, 0x0, 0x1, 0x826e, 0x0, 0x1, 0x8272, 0x0, 0x1, 0x8278, 0x0, 0x1,
+			0x864d, 0x0, 0x1, 0x866b, 0x0, 0x1, 0x8840, 0x0, 0x1, 0x884c, 0x0, 0x1, 0x8863, 0x0, 0x1, 0x897e, 0x0,
+			0x1, 0x898b, 0x0, 0x1, 0x89d2, 0x0, 0x1, 0x8a00, 0x0, 0x1, 0x8c37, 0x0, 0x1, 0x8c46, 0x0, 0x1, 0x8c55,
+			0x0, 0x1, 0x8c78, 0x0, 0x1, 0x8c9d, 0x0, 0x1, 0x8d64, 0x0, 0x1, 0x8d70, 0x0, 0x1, 0x8db3, 0x0, 0x1,
+			0x8eab, 0x0, 0x1, 0x8eca, 0x0, 0x1, 0x8f9b, 0x0, 0x1, 0x8fb0, 0x0, 0x1, 0x8fb5, 0x0, 0x1, 0x9091, 0x0,
+			0x1, 0x9149, 0x0, 0x1, 0x91c6, 0x0, 0x1, 0x91cc, 0x0, 0x1, 0x91d1, 0x0, 0x1, 0x9577, 0x0, 0x1, 0x9580,
+			0x0, 0x1, 0x961c, 0x0, 0x1, 0x96b6, 0x0, 0x1, 0x96b9, 0x0, 0x1, 0x96e8, 0x0, 0x1, 0x9751, 0x0, 0x1,
+			0x975e, 0x0, 0x1, 0x9762, 0x0, 0x1, 0x9769, 0x0, 0x1, 0x97cb, 0x0, 0x1, 0x97ed, 0x0, 0x1, 0x97f3, 0x0,
+			0x1, 0x9801, 0x0, 0x1, 0x98a8, 0x0, 0x1, 0x98db, 0x0, 0x1, 0x98df, 0x0, 0x1, 0x9996, 0x0, 0x1, 0x9999,
+			0x0, 0x1, 0x99ac, 0x0, 0x1, 0x9aa8, 0x0, 0x1, 0x9ad8, 0x0, 0x1, 0x9adf, 0x0, 0x1, 0x9b25, 0x0, 0x1,
+			0x9b2f, 0x0, 0x1, 0x9b32, 0x0, 0x1, 0x9b3c, 0x0, 0x1, 0x9b5a, 0x0, 0x1, 0x9ce5, 0x0, 0x1, 0x9e75, 0x0,
+			0x1, 0x9e7f, 0x0, 0x1, 0x9ea5, 0x0, 0x1, 0x9ebb, 0x0, 0x1, 0x9ec3, 0x0, 0x1, 0x9ecd, 0x0, 0x1, 0x9ed1,
+			0x0, 0x1, 0x9ef9, 0x0, 0x1, 0x9efd, 0x0, 0x1, 0x9f0e, 0x0, 0x1, 0x9f13, 0x0, 0x1, 0x9f20, 0x0, 0x1,
+			0x9f3b, 0x0, 0x1, 0x9f4a, 0x0, 0x1, 0x9f52, 0x0, 0x1, 0x9f8d, 0x0, 0x1, 0x9f9c, 0x0, 0x1, 0x9fa0, 0x0,
+			0x1, 0x20, 0x0, 0x1, 0x3012, 0x0, 0x1, 0x5341, 0x0, 0x1, 0x5344, 0x0, 0x1, 0x5345, 0x2, 0x304b, 0x3099,
+			0x0, 0x2, 0x304d, 0x3099, 0x0, 0x2, 0x304f, 0x3099, 0x0, 0x2, 0x3051, 0x3099, 0x0, 0x2, 0x3053, 0x3099,
+			0x0, 0x2, 0x3055, 0x3099, 0x0, 0x2, 0x3057, 0x3099, 0x0, 0x2, 0x3059, 0x3099, 0x0, 0x2, 0x305b, 0x3099,
+			0x0, 0x2, 0x305d, 0x3099, 0x0, 0x2, 0x305f, 0x3099, 0x0, 0x2, 0x3061, 0x3099, 0x0, 0x2, 0x3064, 0x3099,
+			0x0, 0x2, 0x3066, 0x3099, 0x0, 0x2, 0x3068, 0x3099, 0x0, 0x2, 0x306f, 0x3099, 0x0, 0x2, 0x306f, 0x309a,
+			0x0, 0x2, 0x3072, 0x3099, 0x0, 0x2, 0x3072, 0x309a, 0x0, 0x2, 0x3075, 0x3099, 0x0, 0x2, 0x3075, 0x309a,
+			0x0, 0x2, 0x3078, 0x3099, 0x0, 0x2, 0x3078, 0x309a, 0x0, 0x2, 0x307b, 0x3099, 0x0, 0x2, 0x307b, 0x309a,
+			0x0, 0x2, 0x3046, 0x3099, 0x0, 0x0, 0x2, 0x20, 0x3099, 0x0, 0x2, 0x20, 0x309a, 0x2, 0x309d, 0x3099, 0x0,
+			0x0, 0x2, 0x3088, 0x308a, 0x2, 0x30ab, 0x3099, 0x0, 0x2, 0x30ad, 0x3099, 0x0, 0x2, 0x30af, 0x3099, 0x0,
+			0x2, 0x30b1, 0x3099, 0x0, 0x2, 0x30b3, 0x3099, 0x0, 0x2, 0x30b5, 0x3099, 0x0, 0x2, 0x30b7, 0x3099, 0x0,
+			0x2, 0x30b9, 0x3099, 0x0, 0x2, 0x30bb, 0x3099, 0x0, 0x2, 0x30bd, 0x3099, 0x0, 0x2, 0x30bf, 0x3099, 0x0,
+			0x2, 0x30c1, 0x3099, 0x0, 0x2, 0x30c4, 0x3099, 0x0, 0x2, 0x30c6, 0x3099, 0x0, 0x2, 0x30c8, 0x3099, 0x0,
+			0x2, 0x30cf, 0x3099, 0x0, 0x2, 0x30cf, 0x309a, 0x0, 0x2, 0x30d2, 0x3099, 0x0, 0x2, 0x30d2, 0x309a, 0x0,
+			0x2, 0x30d5, 0x3099, 0x0, 0x2, 0x30d5, 0x309a, 0x0, 0x2, 0x30d8, 0x3099, 0x0, 0x2, 0x30d8, 0x309a, 0x0,
+			0x2, 0x30db, 0x3099, 0x0, 0x2, 0x30db, 0x309a, 0x0, 0x2, 0x30a6, 0x3099, 0x0, 0x2, 0x30ef, 0x3099, 0x0,
+			0x2, 0x30f0, 0x3099, 0x0, 0x2, 0x30f1, 0x3099, 0x0, 0x2, 0x30f2, 0x3099, 0x0, 0x2, 0x30fd, 0x3099, 0x0,
+			0x0, 0x2, 0x30b3, 0x30c8, 0x0, 0x1, 0x1100, 0x0, 0x1, 0x1101, 0x0, 0x1, 0x11aa, 0x0, 0x1, 0x1102, 0x0,
+			0x1, 0x11ac, 0x0, 0x1, 0x11ad, 0x0, 0x1, 0x1103, 0x0, 0x1, 0x1104, 0x0, 0x1, 0x1105, 0x0, 0x1, 0x11b0,
+			0x0, 0x1, 0x11b1, 0x0, 0x1, 0x11b2, 0x0, 0x1, 0x11b3, 0x0, 0x1, 0x11b4, 0x0, 0x1, 0x11b5, 0x0, 0x1,
+			0x111a, 0x0, 0x1, 0x1106, 0x0, 0x1, 0x1107, 0x0, 0x1, 0x1108, 0x0, 0x1, 0x1121, 0x0, 0x1, 0x1109, 0x0,
+			0x1, 0x110a, 0x0, 0x1, 0x110b, 0x0, 0x1, 0x110c, 0x0, 0x1, 0x110d, 0x0, 0x1, 0x110e, 0x0, 0x1, 0x110f,
+			0x0, 0x1, 0x1110, 0x0, 0x1, 0x1111, 0x0, 0x1, 0x1112, 0x0, 0x1, 0x1161, 0x0, 0x1, 0x1162, 0x0, 0x1,
+			0x1163, 0x0, 0x1, 0x1164, 0x0, 0x1, 0x1165, 0x0, 0x1, 0x1166, 0x0, 0x1, 0x1167, 0x0, 0x1, 0x1168, 0x0,
+			0x1, 0x1169, 0x0, 0x1, 0x116a, 0x0, 0x1, 0x116b, 0x0, 0x1, 0x116c, 0x0, 0x1, 0x116d, 0x0, 0x1, 0x116e,
+			0x0, 0x1, 0x116f, 0x0, 0x1, 0x1170, 0x0, 0x1, 0x1171, 0x0, 0x1, 0x1172, 0x0, 0x1, 0x1173, 0x0, 0x1,
+			0x1174, 0x0, 0x1, 0x1175, 0x0, 0x1, 0x1160, 0x0, 0x1, 0x1114, 0x0, 0x1, 0x1115, 0x0, 0x1, 0x11c7, 0x0,
+			0x1, 0x11c8, 0x0, 0x1, 0x11cc, 0x0, 0x1, 0x11ce, 0x0, 0x1, 0x11d3, 0x0, 0x1, 0x11d7, 0x0, 0x1, 0x11d9,
+			0x0, 0x1, 0x111c, 0x0, 0x1, 0x11dd, 0x0, 0x1, 0x11df, 0x0, 0x1, 0x111d, 0x0, 0x1, 0x111e, 0x0, 0x1,
+			0x1120, 0x0, 0x1, 0x1122, 0x0, 0x1, 0x1123, 0x0, 0x1, 0x1127, 0x0, 0x1, 0x1129, 0x0, 0x1, 0x112b, 0x0,
+			0x1, 0x112c, 0x0, 0x1, 0x112d, 0x0, 0x1, 0x112e, 0x0, 0x1, 0x112f, 0x0, 0x1, 0x1132, 0x0, 0x1, 0x1136,
+			0x0, 0x1, 0x1140, 0x0, 0x1, 0x1147, 0x0, 0x1, 0x114c, 0x0, 0x1, 0x11f1, 0x0, 0x1, 0x11f2, 0x0, 0x1,
+			0x1157, 0x0, 0x1, 0x1158, 0x0, 0x1, 0x1159, 0x0, 0x1, 0x1184, 0x0, 0x1, 0x1185, 0x0, 0x1, 0x1188, 0x0,
+			0x1, 0x1191, 0x0, 0x1, 0x1192, 0x0, 0x1, 0x1194, 0x0, 0x1, 0x119e, 0x0, 0x1, 0x11a1, 0x0, 0x1, 0x4e00,
+			0x0, 0x1, 0x4e8c, 0x0, 0x1, 0x4e09, 0x0, 0x1, 0x56db, 0x0, 0x1, 0x4e0a, 0x0, 0x1, 0x4e2d, 0x0, 0x1,
+			0x4e0b, 0x0, 0x1, 0x7532, 0x0, 0x1, 0x4e59, 0x0, 0x1, 0x4e19, 0x0, 0x1, 0x4e01, 0x0, 0x1, 0x5929, 0x0,
+			0x1, 0x5730, 0x0, 0x1, 0x4eba, 0x0, 0x3, 0x28, 0x1100, 0x29, 0x0, 0x3, 0x28, 0x1102, 0x29, 0x0, 0x3,
+			0x28, 0x1103, 0x29, 0x0, 0x3, 0x28, 0x1105, 0x29, 0x0, 0x3, 0x28, 0x1106, 0x29, 0x0, 0x3, 0x28, 0x1107,
+			0x29, 0x0, 0x3, 0x28, 0x1109, 0x29, 0x0, 0x3, 0x28, 0x110b, 0x29, 0x0, 0x3, 0x28, 0x110c, 0x29, 0x0,
+			0x3, 0x28, 0x110e, 0x29, 0x0, 0x3, 0x28, 0x110f, 0x29, 0x0, 0x3, 0x28, 0x1110, 0x29, 0x0, 0x3, 0x28,
+			0x1111, 0x29, 0x0, 0x3, 0x28, 0x1112, 0x29, 0x0, 0x4, 0x28, 0x1100, 0x1161, 0x29, 0x0, 0x4, 0x28,
+			0x1102, 0x1161, 0x29, 0x0, 0x4, 0x28, 0x1103, 0x1161, 0x29, 0x0, 0x4, 0x28, 0x1105, 0x1161, 0x29, 0x0,
+			0x4, 0x28, 0x1106, 0x1161, 0x29, 0x0, 0x4, 0x28, 0x1107, 0x1161, 0x29, 0x0, 0x4, 0x28, 0x1109, 0x1161,
+			0x29, 0x0, 0x4, 0x28, 0x110b, 0x1161, 0x29, 0x0, 0x4, 0x28, 0x110c, 0x1161, 0x29, 0x0, 0x4, 0x28,
+			0x110e, 0x1161, 0x29, 0x0, 0x4, 0x28, 0x110f, 0x1161, 0x29, 0x0, 0x4, 0x28, 0x1110, 0x1161, 0x29, 0x0,
+			0x4, 0x28, 0x1111, 0x1161, 0x29, 0x0, 0x4, 0x28, 0x1112, 0x1161, 0x29, 0x0, 0x4, 0x28, 0x110c, 0x116e,
+			0x29, 0x0, 0x7, 0x28, 0x110b, 0x1169, 0x110c, 0x1165, 0x11ab, 0x29, 0x0, 0x6, 0x28, 0x110b, 0x1169,
+			0x1112, 0x116e, 0x29, 0x0, 0x3, 0x28, 0x4e00, 0x29, 0x0, 0x3, 0x28, 0x4e8c, 0x29, 0x0, 0x3, 0x28,
+			0x4e09, 0x29, 0x0, 0x3, 0x28, 0x56db, 0x29, 0x0, 0x3, 0x28, 0x4e94, 0x29, 0x0, 0x3, 0x28, 0x516d, 0x29,
+			0x0, 0x3, 0x28, 0x4e03, 0x29, 0x0, 0x3, 0x28, 0x516b, 0x29, 0x0, 0x3, 0x28, 0x4e5d, 0x29, 0x0, 0x3,
+			0x28, 0x5341, 0x29, 0x0, 0x3, 0x28, 0x6708, 0x29, 0x0, 0x3, 0x28, 0x706b, 0x29, 0x0, 0x3, 0x28, 0x6c34,
+			0x29, 0x0, 0x3, 0x28, 0x6728, 0x29, 0x0, 0x3, 0x28, 0x91d1, 0x29, 0x0, 0x3, 0x28, 0x571f, 0x29, 0x0,
+			0x3, 0x28, 0x65e5, 0x29, 0x0, 0x3, 0x28, 0x682a, 0x29, 0x0, 0x3, 0x28, 0x6709, 0x29, 0x0, 0x3, 0x28,
+			0x793e, 0x29, 0x0, 0x3, 0x28, 0x540d, 0x29, 0x0, 0x3, 0x28, 0x7279, 0x29, 0x0, 0x3, 0x28, 0x8ca1, 0x29,
+			0x0, 0x3, 0x28, 0x795d, 0x29, 0x0, 0x3, 0x28, 0x52b4, 0x29, 0x0, 0x3, 0x28, 0x4ee3, 0x29, 0x0, 0x3,
+			0x28, 0x547c, 0x29, 0x0, 0x3, 0x28, 0x5b66, 0x29, 0x0, 0x3, 0x28, 0x76e3, 0x29, 0x0, 0x3, 0x28, 0x4f01,
+			0x29, 0x0, 0x3, 0x28, 0x8cc7, 0x29, 0x0, 0x3, 0x28, 0x5354, 0x29, 0x0, 0x3, 0x28, 0x796d, 0x29, 0x0,
+			0x3, 0x28, 0x4f11, 0x29, 0x0, 0x3, 0x28, 0x81ea, 0x29, 0x0, 0x3, 0x28, 0x81f3, 0x29, 0x0, 0x1, 0x554f,
+			0x0, 0x1, 0x5e7c, 0x0, 0x1, 0x6587, 0x0, 0x1, 0x7b8f, 0x0, 0x3, 0x50, 0x54, 0x45, 0x0, 0x2, 0x32, 0x31,
+			0x0, 0x2, 0x32, 0x32, 0x0, 0x2, 0x32, 0x33, 0x0, 0x2, 0x32, 0x34, 0x0, 0x2, 0x32, 0x35, 0x0, 0x2, 0x32,
+			0x36, 0x0, 0x2, 0x32, 0x37, 0x0, 0x2, 0x32, 0x38, 0x0, 0x2, 0x32, 0x39, 0x0, 0x2, 0x33, 0x30, 0x0, 0x2,
+			0x33, 0x31, 0x0, 0x2, 0x33, 0x32, 0x0, 0x2, 0x33, 0x33, 0x0, 0x2, 0x33, 0x34, 0x0, 0x2, 0x33, 0x35, 0x0,
+			0x1, 0x1100, 0x0, 0x1, 0x1102, 0x0, 0x1, 0x1103, 0x0, 0x1, 0x1105, 0x0, 0x1, 0x1106, 0x0, 0x1, 0x1107,
+			0x0, 0x1, 0x1109, 0x0, 0x1, 0x110b, 0x0, 0x1, 0x110c, 0x0, 0x1, 0x110e, 0x0, 0x1, 0x110f, 0x0, 0x1,
+			0x1110, 0x0, 0x1, 0x1111, 0x0, 0x1, 0x1112, 0x0, 0x2, 0x1100, 0x1161, 0x0, 0x2, 0x1102, 0x1161, 0x0,
+			0x2, 0x1103, 0x1161, 0x0, 0x2, 0x1105, 0x1161, 0x0, 0x2, 0x1106, 0x1161, 0x0, 0x2, 0x1107, 0x1161, 0x0,
+			0x2, 0x1109, 0x1161, 0x0, 0x2, 0x110b, 0x1161, 0x0, 0x2, 0x110c, 0x1161, 0x0, 0x2, 0x110e, 0x1161, 0x0,
+			0x2, 0x110f, 0x1161, 0x0, 0x2, 0x1110, 0x1161, 0x0, 0x2, 0x1111, 0x1161, 0x0, 0x2, 0x1112, 0x1161, 0x0,
+			0x5, 0x110e, 0x1161, 0x11b7, 0x1100, 0x1169, 0x0, 0x4, 0x110c, 0x116e, 0x110b, 0x1174, 0x0, 0x2, 0x110b,
+			0x116e, 0x0, 0x1, 0x4e00, 0x0, 0x1, 0x4e8c, 0x0, 0x1, 0x4e09, 0x0, 0x1, 0x56db, 0x0, 0x1, 0x4e94, 0x0,
+			0x1, 0x516d, 0x0, 0x1, 0x4e03, 0x0, 0x1, 0x516b, 0x0, 0x1, 0x4e5d, 0x0, 0x1, 0x5341, 0x0, 0x1, 0x6708,
+			0x0, 0x1, 0x706b, 0x0, 0x1, 0x6c34, 0x0, 0x1, 0x6728, 0x0, 0x1, 0x91d1, 0x0, 0x1, 0x571f, 0x0, 0x1,
+			0x65e5, 0x0, 0x1, 0x682a, 0x0, 0x1, 0x6709, 0x0, 0x1, 0x793e, 0x0, 0x1, 0x540d, 0x0, 0x1, 0x7279, 0x0,
+			0x1, 0x8ca1, 0x0, 0x1, 0x795d, 0x0, 0x1, 0x52b4, 0x0, 0x1, 0x79d8, 0x0, 0x1, 0x7537, 0x0, 0x1, 0x5973,
+			0x0, 0x1, 0x9069, 0x0, 0x1, 0x512a, 0x0, 0x1, 0x5370, 0x0, 0x1, 0x6ce8, 0x0, 0x1, 0x9805, 0x0, 0x1,
+			0x4f11, 0x0, 0x1, 0x5199, 0x0, 0x1, 0x6b63, 0x0, 0x1, 0x4e0a, 0x0, 0x1, 0x4e2d, 0x0, 0x1, 0x4e0b, 0x0,
+			0x1, 0x5de6, 0x0, 0x1, 0x53f3, 0x0, 0x1, 0x533b, 0x0, 0x1, 0x5b97, 0x0, 0x1, 0x5b66, 0x0, 0x1, 0x76e3,
+			0x0, 0x1, 0x4f01, 0x0, 0x1, 0x8cc7, 0x0, 0x1, 0x5354, 0x0, 0x1, 0x591c, 0x0, 0x2, 0x33, 0x36, 0x0, 0x2,
+			0x33, 0x37, 0x0, 0x2, 0x33, 0x38, 0x0, 0x2, 0x33, 0x39, 0x0, 0x2, 0x34, 0x30, 0x0, 0x2, 0x34, 0x31, 0x0,
+			0x2, 0x34, 0x32, 0x0, 0x2, 0x34, 0x33, 0x0, 0x2, 0x34, 0x34, 0x0, 0x2, 0x34, 0x35, 0x0, 0x2, 0x34, 0x36,
+			0x0, 0x2, 0x34, 0x37, 0x0, 0x2, 0x34, 0x38, 0x0, 0x2, 0x34, 0x39, 0x0, 0x2, 0x35, 0x30, 0x0, 0x2, 0x31,
+			0x6708, 0x0, 0x2, 0x32, 0x6708, 0x0, 0x2, 0x33, 0x6708, 0x0, 0x2, 0x34, 0x6708, 0x0, 0x2, 0x35, 0x6708,
+			0x0, 0x2, 0x36, 0x6708, 0x0, 0x2, 0x37, 0x6708, 0x0, 0x2, 0x38, 0x6708, 0x0, 0x2, 0x39, 0x6708, 0x0,
+			0x3, 0x31, 0x30, 0x6708, 0x0, 0x3, 0x31, 0x31, 0x6708, 0x0, 0x3, 0x31, 0x32, 0x6708, 0x0, 0x2, 0x48,
+			0x67, 0x0, 0x3, 0x65, 0x72, 0x67, 0x0, 0x2, 0x65, 0x56, 0x0, 0x3, 0x4c, 0x54, 0x44, 0x0, 0x1, 0x30a2,
+			0x0, 0x1, 0x30a4, 0x0, 0x1, 0x30a6, 0x0, 0x1, 0x30a8, 0x0, 0x1, 0x30aa, 0x0, 0x1, 0x30ab, 0x0, 0x1,
+			0x30ad, 0x0, 0x1, 0x30af, 0x0, 0x1, 0x30b1, 0x0, 0x1, 0x30b3, 0x0, 0x1, 0x30b5, 0x0, 0x1, 0x30b7, 0x0,
+			0x1, 0x30b9, 0x0, 0x1, 0x30bb, 0x0, 0x1, 0x30bd, 0x0, 0x1, 0x30bf, 0x0, 0x1, 0x30c1, 0x0, 0x1, 0x30c4,
+			0x0, 0x1, 0x30c6, 0x0, 0x1, 0x30c8, 0x0, 0x1, 0x30ca, 0x0, 0x1, 0x30cb, 0x0, 0x1, 0x30cc, 0x0, 0x1,
+			0x30cd, 0x0, 0x1, 0x30ce, 0x0, 0x1, 0x30cf, 0x0, 0x1, 0x30d2, 0x0, 0x1, 0x30d5, 0x0, 0x1, 0x30d8, 0x0,
+			0x1, 0x30db, 0x0, 0x1, 0x30de, 0x0, 0x1, 0x30df, 0x0, 0x1, 0x30e0, 0x0, 0x1, 0x30e1, 0x0, 0x1, 0x30e2,
+			0x0, 0x1, 0x30e4, 0x0, 0x1, 0x30e6, 0x0, 0x1, 0x30e8, 0x0, 0x1, 0x30e9, 0x0, 0x1, 0x30ea, 0x0, 0x1,
+			0x30eb, 0x0, 0x1, 0x30ec, 0x0, 0x1, 0x30ed, 0x0, 0x1, 0x30ef, 0x0, 0x1, 0x30f0, 0x0, 0x1, 0x30f1, 0x0,
+			0x1, 0x30f2, 0x0, 0x2, 0x4ee4, 0x548c, 0x0, 0x5, 0x30a2, 0x30cf, 0x309a, 0x30fc, 0x30c8, 0x0, 0x4,
+			0x30a2, 0x30eb, 0x30d5, 0x30a1, 0x0, 0x5, 0x30a2, 0x30f3, 0x30d8, 0x309a, 0x30a2, 0x0, 0x3, 0x30a2,
+			0x30fc, 0x30eb, 0x0, 0x5, 0x30a4, 0x30cb, 0x30f3, 0x30af, 0x3099, 0x0, 0x3, 0x30a4, 0x30f3, 0x30c1, 0x0,
+			0x3, 0x30a6, 0x30a9, 0x30f3, 0x0, 0x6, 0x30a8, 0x30b9, 0x30af, 0x30fc, 0x30c8, 0x3099, 0x0, 0x4, 0x30a8,
+			0x30fc, 0x30ab, 0x30fc, 0x0, 0x3, 0x30aa, 0x30f3, 0x30b9, 0x0, 0x3, 0x30aa, 0x30fc, 0x30e0, 0x0, 0x3,
+			0x30ab, 0x30a4, 0x30ea, 0x0, 0x4, 0x30ab, 0x30e9, 0x30c3, 0x30c8, 0x0, 0x4, 0x30ab, 0x30ed, 0x30ea,
+			0x30fc, 0x0, 0x4, 0x30ab, 0x3099, 0x30ed, 0x30f3, 0x0, 0x4, 0x30ab, 0x3099, 0x30f3, 0x30de, 0x0, 0x4,
+			0x30ad, 0x3099, 0x30ab, 0x3099, 0x0, 0x4, 0x30ad, 0x3099, 0x30cb, 0x30fc, 0x0, 0x4, 0x30ad, 0x30e5,
+			0x30ea, 0x30fc, 0x0, 0x6, 0x30ad, 0x3099, 0x30eb, 0x30bf, 0x3099, 0x30fc, 0x0, 0x2, 0x30ad, 0x30ed, 0x0,
+			0x6, 0x30ad, 0x30ed, 0x30af, 0x3099, 0x30e9, 0x30e0, 0x0, 0x6, 0x30ad, 0x30ed, 0x30e1, 0x30fc, 0x30c8,
+			0x30eb, 0x0, 0x5, 0x30ad, 0x30ed, 0x30ef, 0x30c3, 0x30c8, 0x0, 0x4, 0x30af, 0x3099, 0x30e9, 0x30e0, 0x0,
+			0x6, 0x30af, 0x3099, 0x30e9, 0x30e0, 0x30c8, 0x30f3, 0x0, 0x6, 0x30af, 0x30eb, 0x30bb, 0x3099, 0x30a4,
+			0x30ed, 0x0, 0x4, 0x30af, 0x30ed, 0x30fc, 0x30cd, 0x0, 0x3, 0x30b1, 0x30fc, 0x30b9, 0x0, 0x3, 0x30b3,
+			0x30eb, 0x30ca, 0x0, 0x4, 0x30b3, 0x30fc, 0x30db, 0x309a, 0x0, 0x4, 0x30b5, 0x30a4, 0x30af, 0x30eb, 0x0,
+			0x5, 0x30b5, 0x30f3, 0x30c1, 0x30fc, 0x30e0, 0x0, 0x5, 0x30b7, 0x30ea, 0x30f3, 0x30af, 0x3099, 0x0, 0x3,
+			0x30bb, 0x30f3, 0x30c1, 0x0, 0x3, 0x30bb, 0x30f3, 0x30c8, 0x0, 0x4, 0x30bf, 0x3099, 0x30fc, 0x30b9, 0x0,
+			0x3, 0x30c6, 0x3099, 0x30b7, 0x0, 0x3, 0x30c8, 0x3099, 0x30eb, 0x0, 0x2, 0x30c8, 0x30f3, 0x0, 0x2,
+			0x30ca, 0x30ce, 0x0, 0x3, 0x30ce, 0x30c3, 0x30c8, 0x0, 0x3, 0x30cf, 0x30a4, 0x30c4, 0x0, 0x6, 0x30cf,
+			0x309a, 0x30fc, 0x30bb, 0x30f3, 0x30c8, 0x0, 0x4, 0x30cf, 0x309a, 0x30fc, 0x30c4, 0x0, 0x5, 0x30cf,
+			0x3099, 0x30fc, 0x30ec, 0x30eb, 0x0, 0x6, 0x30d2, 0x309a, 0x30a2, 0x30b9, 0x30c8, 0x30eb, 0x0, 0x4,
+			0x30d2, 0x309a, 0x30af, 0x30eb, 0x0, 0x3, 0x30d2, 0x309a, 0x30b3, 0x0, 0x3, 0x30d2, 0x3099, 0x30eb, 0x0,
+			0x6, 0x30d5, 0x30a1, 0x30e9, 0x30c3, 0x30c8, 0x3099, 0x0, 0x4, 0x30d5, 0x30a3, 0x30fc, 0x30c8, 0x0, 0x6,
+			0x30d5, 0x3099, 0x30c3, 0x30b7, 0x30a7, 0x30eb, 0x0, 0x3, 0x30d5, 0x30e9, 0x30f3, 0x0, 0x5, 0x30d8,
+			0x30af, 0x30bf, 0x30fc, 0x30eb, 0x0, 0x3, 0x30d8, 0x309a, 0x30bd, 0x0, 0x4, 0x30d8, 0x309a, 0x30cb,
+			0x30d2, 0x0, 0x3, 0x30d8, 0x30eb, 0x30c4, 0x0, 0x4, 0x30d8, 0x309a, 0x30f3, 0x30b9, 0x0, 0x5, 0x30d8,
+			0x309a, 0x30fc, 0x30b7, 0x3099, 0x0, 0x4, 0x30d8, 0x3099, 0x30fc, 0x30bf, 0x0, 0x5, 0x30db, 0x309a,
+			0x30a4, 0x30f3, 0x30c8, 0x0, 0x4, 0x30db, 0x3099, 0x30eb, 0x30c8, 0x0, 0x2, 0x30db, 0x30f3, 0x0, 0x5,
+			0x30db, 0x309a, 0x30f3, 0x30c8, 0x3099, 0x0, 0x3, 0x30db, 0x30fc, 0x30eb, 0x0, 0x3, 0x30db, 0x30fc,
+			0x30f3, 0x0, 0x4, 0x30de, 0x30a4, 0x30af, 0x30ed, 0x0, 0x3, 0x30de, 0x30a4, 0x30eb, 0x0, 0x3, 0x30de,
+			0x30c3, 0x30cf, 0x0, 0x3, 0x30de, 0x30eb, 0x30af, 0x0, 0x5, 0x30de, 0x30f3, 0x30b7, 0x30e7, 0x30f3, 0x0,
+			0x4, 0x30df, 0x30af, 0x30ed, 0x30f3, 0x0, 0x2, 0x30df, 0x30ea, 0x0, 0x6, 0x30df, 0x30ea, 0x30cf, 0x3099,
+			0x30fc, 0x30eb, 0x0, 0x3, 0x30e1, 0x30ab, 0x3099, 0x0, 0x5, 0x30e1, 0x30ab, 0x3099, 0x30c8, 0x30f3, 0x0,
+			0x4, 0x30e1, 0x30fc, 0x30c8, 0x30eb, 0x0, 0x4, 0x30e4, 0x30fc, 0x30c8, 0x3099, 0x0, 0x3, 0x30e4, 0x30fc,
+			0x30eb, 0x0, 0x3, 0x30e6, 0x30a2, 0x30f3, 0x0, 0x4, 0x30ea, 0x30c3, 0x30c8, 0x30eb, 0x0, 0x2, 0x30ea,
+			0x30e9, 0x0, 0x4, 0x30eb, 0x30d2, 0x309a, 0x30fc, 0x0, 0x5, 0x30eb, 0x30fc, 0x30d5, 0x3099, 0x30eb, 0x0,
+			0x2, 0x30ec, 0x30e0, 0x0, 0x6, 0x30ec, 0x30f3, 0x30c8, 0x30b1, 0x3099, 0x30f3, 0x0, 0x3, 0x30ef, 0x30c3,
+			0x30c8, 0x0, 0x2, 0x30, 0x70b9, 0x0, 0x2, 0x31, 0x70b9, 0x0, 0x2, 0x32, 0x70b9, 0x0, 0x2, 0x33, 0x70b9,
+			0x0, 0x2, 0x34, 0x70b9, 0x0, 0x2, 0x35, 0x70b9, 0x0, 0x2, 0x36, 0x70b9, 0x0, 0x2, 0x37, 0x70b9, 0x0,
+			0x2, 0x38, 0x70b9, 0x0, 0x2, 0x39, 0x70b9, 0x0, 0x3, 0x31, 0x30, 0x70b9, 0x0, 0x3, 0x31, 0x31, 0x70b9,
+			0x0, 0x3, 0x31, 0x32, 0x70b9, 0x0, 0x3, 0x31, 0x33, 0x70b9, 0x0, 0x3, 0x31, 0x34, 0x70b9, 0x0, 0x3,
+			0x31, 0x35, 0x70b9, 0x0, 0x3, 0x31, 0x36, 0x70b9, 0x0, 0x3, 0x31, 0x37, 0x70b9, 0x0, 0x3, 0x31, 0x38,
+			0x70b9, 0x0, 0x3, 0x31, 0x39, 0x70b9, 0x0, 0x3, 0x32, 0x30, 0x70b9, 0x0, 0x3, 0x32, 0x31, 0x70b9, 0x0,
+			0x3, 0x32, 0x32, 0x70b9, 0x0, 0x3, 0x32, 0x33, 0x70b9, 0x0, 0x3, 0x32, 0x34, 0x70b9, 0x0, 0x3, 0x68,
+			0x50, 0x61, 0x0, 0x2, 0x64, 0x61, 0x0, 0x2, 0x41, 0x55, 0x0, 0x3, 0x62, 0x61, 0x72, 0x0, 0x2, 0x6f,
+			0x56, 0x0, 0x2, 0x70, 0x63, 0x0, 0x2, 0x64, 0x6d, 0x0, 0x3, 0x64, 0x6d, 0x32, 0x0, 0x3, 0x64, 0x6d,
+			0x33, 0x0, 0x2, 0x49, 0x55, 0x0, 0x2, 0x5e73, 0x6210, 0x0, 0x2, 0x662d, 0x548c, 0x0, 0x2, 0x5927,
+			0x6b63, 0x0, 0x2, 0x660e, 0x6cbb, 0x0, 0x4, 0x682a, 0x5f0f, 0x4f1a, 0x793e, 0x0, 0x2, 0x70, 0x41, 0x0,
+			0x2, 0x6e, 0x41, 0x0, 0x2, 0x3bc, 0x41, 0x0, 0x2, 0x6d, 0x41, 0x0, 0x2, 0x6b, 0x41, 0x0, 0x2, 0x4b,
+			0x42, 0x0, 0x2, 0x4d, 0x42, 0x0, 0x2, 0x47, 0x42, 0x0, 0x3, 0x63, 0x61, 0x6c, 0x0, 0x4, 0x6b, 0x63,
+			0x61, 0x6c, 0x0, 0x2, 0x70, 0x46, 0x0, 0x2, 0x6e, 0x46, 0x0, 0x2, 0x3bc, 0x46, 0x0, 0x2, 0x3bc, 0x67,
+			0x0, 0x2, 0x6d, 0x67, 0x0, 0x2, 0x6b, 0x67, 0x0, 0x2, 0x48, 0x7a, 0x0, 0x3, 0x6b, 0x48, 0x7a, 0x0, 0x3,
+			0x4d, 0x48, 0x7a, 0x0, 0x3, 0x47, 0x48, 0x7a, 0x0, 0x3, 0x54, 0x48, 0x7a, 0x0, 0x2, 0x3bc, 0x6c, 0x0,
+			0x2, 0x6d, 0x6c, 0x0, 0x2, 0x64, 0x6c, 0x0, 0x2, 0x6b, 0x6c, 0x0, 0x2, 0x66, 0x6d, 0x0, 0x2, 0x6e, 0x6d,
+			0x0, 0x2, 0x3bc, 0x6d, 0x0, 0x2, 0x6d, 0x6d, 0x0, 0x2, 0x63, 0x6d, 0x0, 0x2, 0x6b, 0x6d, 0x0, 0x3, 0x6d,
+			0x6d, 0x32, 0x0, 0x3, 0x63, 0x6d, 0x32, 0x0, 0x2, 0x6d, 0x32, 0x0, 0x3, 0x6b, 0x6d, 0x32, 0x0, 0x3,
+			0x6d, 0x6d, 0x33, 0x0, 0x3, 0x63, 0x6d, 0x33, 0x0, 0x2, 0x6d, 0x33, 0x0, 0x3, 0x6b, 0x6d, 0x33, 0x0,
+			0x3, 0x6d, 0x2215, 0x73, 0x0, 0x4, 0x6d, 0x2215, 0x73, 0x32, 0x0, 0x2, 0x50, 0x61, 0x0, 0x3, 0x6b, 0x50,
+			0x61, 0x0, 0x3, 0x4d, 0x50, 0x61, 0x0, 0x3, 0x47, 0x50, 0x61, 0x0, 0x3, 0x72, 0x61, 0x64, 0x0, 0x5,
+			0x72, 0x61, 0x64, 0x2215, 0x73, 0x0, 0x6, 0x72, 0x61, 0x64, 0x2215, 0x73, 0x32, 0x0, 0x2, 0x70, 0x73,
+			0x0, 0x2, 0x6e, 0x73, 0x0, 0x2, 0x3bc, 0x73, 0x0, 0x2, 0x6d, 0x73, 0x0, 0x2, 0x70, 0x56, 0x0, 0x2, 0x6e,
+			0x56, 0x0, 0x2, 0x3bc, 0x56, 0x0, 0x2, 0x6d, 0x56, 0x0, 0x2, 0x6b, 0x56, 0x0, 0x2, 0x4d, 0x56, 0x0, 0x2,
+			0x70, 0x57, 0x0, 0x2, 0x6e, 0x57, 0x0, 0x2, 0x3bc, 0x57, 0x0, 0x2, 0x6d, 0x57, 0x0, 0x2, 0x6b, 0x57,
+			0x0, 0x2, 0x4d, 0x57, 0x0, 0x2, 0x6b, 0x3a9, 0x0, 0x2, 0x4d, 0x3a9, 0x0, 0x4, 0x61, 0x2e, 0x6d, 0x2e,
+			0x0, 0x2, 0x42, 0x71, 0x0, 0x2, 0x63, 0x63, 0x0, 0x2, 0x63, 0x64, 0x0, 0x4, 0x43, 0x2215, 0x6b, 0x67,
+			0x0, 0x3, 0x43, 0x6f, 0x2e, 0x0, 0x2, 0x64, 0x42, 0x0, 0x2, 0x47, 0x79, 0x0, 0x2, 0x68, 0x61, 0x0, 0x2,
+			0x48, 0x50, 0x0, 0x2, 0x69, 0x6e, 0x0, 0x2, 0x4b, 0x4b, 0x0, 0x2, 0x4b, 0x4d, 0x0, 0x2, 0x6b, 0x74, 0x0,
+			0x2, 0x6c, 0x6d, 0x0, 0x2, 0x6c, 0x6e, 0x0, 0x3, 0x6c, 0x6f, 0x67, 0x0, 0x2, 0x6c, 0x78, 0x0, 0x2, 0x6d,
+			0x62, 0x0, 0x3, 0x6d, 0x69, 0x6c, 0x0, 0x3, 0x6d, 0x6f, 0x6c, 0x0, 0x2, 0x50, 0x48, 0x0, 0x4, 0x70,
+			0x2e, 0x6d, 0x2e, 0x0, 0x3, 0x50, 0x50, 0x4d, 0x0, 0x2, 0x50, 0x52, 0x0, 0x2, 0x73, 0x72, 0x0, 0x2,
+			0x53, 0x76, 0x0, 0x2, 0x57, 0x62, 0x0, 0x3, 0x56, 0x2215, 0x6d, 0x0, 0x3, 0x41, 0x2215, 0x6d, 0x0, 0x2,
+			0x31, 0x65e5, 0x0, 0x2, 0x32, 0x65e5, 0x0, 0x2, 0x33, 0x65e5, 0x0, 0x2, 0x34, 0x65e5, 0x0, 0x2, 0x35,
+			0x65e5, 0x0, 0x2, 0x36, 0x65e5, 0x0, 0x2, 0x37, 0x65e5, 0x0, 0x2, 0x38, 0x65e5, 0x0, 0x2, 0x39, 0x65e5,
+			0x0, 0x3, 0x31, 0x30, 0x65e5, 0x0, 0x3, 0x31, 0x31, 0x65e5, 0x0, 0x3, 0x31, 0x32, 0x65e5, 0x0, 0x3,
+			0x31, 0x33, 0x65e5, 0x0, 0x3, 0x31, 0x34, 0x65e5, 0x0, 0x3, 0x31, 0x35, 0x65e5, 0x0, 0x3, 0x31, 0x36,
+			0x65e5, 0x0, 0x3, 0x31, 0x37, 0x65e5, 0x0, 0x3, 0x31, 0x38, 0x65e5, 0x0, 0x3, 0x31, 0x39, 0x65e5, 0x0,
+			0x3, 0x32, 0x30, 0x65e5, 0x0, 0x3, 0x32, 0x31, 0x65e5, 0x0, 0x3, 0x32, 0x32, 0x65e5, 0x0, 0x3, 0x32,
+			0x33, 0x65e5, 0x0, 0x3, 0x32, 0x34, 0x65e5, 0x0, 0x3, 0x32, 0x35, 0x65e5, 0x0, 0x3, 0x32, 0x36, 0x65e5,
+			0x0, 0x3, 0x32, 0x37, 0x65e5, 0x0, 0x3, 0x32, 0x38, 0x65e5, 0x0, 0x3, 0x32, 0x39, 0x65e5, 0x0, 0x3,
+			0x33, 0x30, 0x65e5, 0x0, 0x3, 0x33, 0x31, 0x65e5, 0x0, 0x3, 0x67, 0x61, 0x6c, 0x0, 0x1, 0x44a, 0x0, 0x1,
+			0x44c, 0x0, 0x1, 0xa76f, 0x0, 0x1, 0x43, 0x0, 0x1, 0x46, 0x0, 0x1, 0x51, 0x0, 0x1, 0x126, 0x0, 0x1,
+			0x153, 0x0, 0x1, 0xa727, 0x0, 0x1, 0xab37, 0x0, 0x1, 0x26b, 0x0, 0x1, 0xab52, 0x0, 0x1, 0x28d, 0x1,
+			0x8c48, 0x0, 0x1, 0x66f4, 0x0, 0x1, 0x8eca, 0x0, 0x1, 0x8cc8, 0x0, 0x1, 0x6ed1, 0x0, 0x1, 0x4e32, 0x0,
+			0x1, 0x53e5, 0x0, 0x1, 0x9f9c, 0x0, 0x1, 0x9f9c, 0x0, 0x1, 0x5951, 0x0, 0x1, 0x91d1, 0x0, 0x1, 0x5587,
+			0x0, 0x1, 0x5948, 0x0, 0x1, 0x61f6, 0x0, 0x1, 0x7669, 0x0, 0x1, 0x7f85, 0x0, 0x1, 0x863f, 0x0, 0x1,
+			0x87ba, 0x0, 0x1, 0x88f8, 0x0, 0x1, 0x908f, 0x0, 0x1, 0x6a02, 0x0, 0x1, 0x6d1b, 0x0, 0x1, 0x70d9, 0x0,
+			0x1, 0x73de, 0x0, 0x1, 0x843d, 0x0, 0x1, 0x916a, 0x0, 0x1, 0x99f1, 0x0, 0x1, 0x4e82, 0x0, 0x1, 0x5375,
+			0x0, 0x1, 0x6b04, 0x0, 0x1, 0x721b, 0x0, 0x1, 0x862d, 0x0, 0x1, 0x9e1e, 0x0, 0x1, 0x5d50, 0x0, 0x1,
+			0x6feb, 0x0, 0x1, 0x85cd, 0x0, 0x1, 0x8964, 0x0, 0x1, 0x62c9, 0x0, 0x1, 0x81d8, 0x0, 0x1, 0x881f, 0x0,
+			0x1, 0x5eca, 0x0, 0x1, 0x6717, 0x0, 0x1, 0x6d6a, 0x0, 0x1, 0x72fc, 0x0, 0x1, 0x90ce, 0x0, 0x1, 0x4f86,
+			0x0, 0x1, 0x51b7, 0x0, 0x1, 0x52de, 0x0, 0x1, 0x64c4, 0x0, 0x1, 0x6ad3, 0x0, 0x1, 0x7210, 0x0, 0x1,
+			0x76e7, 0x0, 0x1, 0x8001, 0x0, 0x1, 0x8606, 0x0, 0x1, 0x865c, 0x0, 0x1, 0x8def, 0x0, 0x1, 0x9732, 0x0,
+			0x1, 0x9b6f, 0x0, 0x1, 0x9dfa, 0x0, 0x1, 0x788c, 0x0, 0x1, 0x797f, 0x0, 0x1, 0x7da0, 0x0, 0x1, 0x83c9,
+			0x0, 0x1, 0x9304, 0x0, 0x1, 0x9e7f, 0x0, 0x1, 0x8ad6, 0x0, 0x1, 0x58df, 0x0, 0x1, 0x5f04, 0x0, 0x1,
+			0x7c60, 0x0, 0x1, 0x807e, 0x0, 0x1, 0x7262, 0x0, 0x1, 0x78ca, 0x0, 0x1, 0x8cc2, 0x0, 0x1, 0x96f7, 0x0,
+			0x1, 0x58d8, 0x0, 0x1, 0x5c62, 0x0, 0x1, 0x6a13, 0x0, 0x1, 0x6dda, 0x0, 0x1, 0x6f0f, 0x0, 0x1, 0x7d2f,
+			0x0, 0x1, 0x7e37, 0x0, 0x1, 0x964b, 0x0, 0x1, 0x52d2, 0x0, 0x1, 0x808b, 0x0, 0x1, 0x51dc, 0x0, 0x1,
+			0x51cc, 0x0, 0x1, 0x7a1c, 0x0, 0x1, 0x7dbe, 0x0, 0x1, 0x83f1, 0x0, 0x1, 0x9675, 0x0, 0x1, 0x8b80, 0x0,
+			0x1, 0x62cf, 0x0, 0x1, 0x6a02, 0x0, 0x1, 0x8afe, 0x0, 0x1, 0x4e39, 0x0, 0x1, 0x5be7, 0x0, 0x1, 0x6012,
+			0x0, 0x1, 0x7387, 0x0, 0x1, 0x7570, 0x0, 0x1, 0x5317, 0x0, 0x1, 0x78fb, 0x0, 0x1, 0x4fbf, 0x0, 0x1,
+			0x5fa9, 0x0, 0x1, 0x4e0d, 0x0, 0x1, 0x6ccc, 0x0, 0x1, 0x6578, 0x0, 0x1, 0x7d22, 0x0, 0x1, 0x53c3, 0x0,
+			0x1, 0x585e, 0x0, 0x1, 0x7701, 0x0, 0x1, 0x8449, 0x0, 0x1, 0x8aaa, 0x0, 0x1, 0x6bba, 0x0, 0x1, 0x8fb0,
+			0x0, 0x1, 0x6c88, 0x0, 0x1, 0x62fe, 0x0, 0x1, 0x82e5, 0x0, 0x1, 0x63a0, 0x0, 0x1, 0x7565, 0x0, 0x1,
+			0x4eae, 0x0, 0x1, 0x5169, 0x0, 0x1, 0x51c9, 0x0, 0x1, 0x6881, 0x0, 0x1, 0x7ce7, 0x0, 0x1, 0x826f, 0x0,
+			0x1, 0x8ad2, 0x0, 0x1, 0x91cf, 0x0, 0x1, 0x52f5, 0x0, 0x1, 0x5442, 0x0, 0x1, 0x5973, 0x0, 0x1, 0x5eec,
+			0x0, 0x1, 0x65c5, 0x0, 0x1, 0x6ffe, 0x0, 0x1, 0x792a, 0x0, 0x1, 0x95ad, 0x0, 0x1, 0x9a6a, 0x0, 0x1,
+			0x9e97, 0x0, 0x1, 0x9ece, 0x0, 0x1, 0x529b, 0x0, 0x1, 0x66c6, 0x0, 0x1, 0x6b77, 0x0, 0x1, 0x8f62, 0x0,
+			0x1, 0x5e74, 0x0, 0x1, 0x6190, 0x0, 0x1, 0x6200, 0x0, 0x1, 0x649a, 0x0, 0x1, 0x6f23, 0x0, 0x1, 0x7149,
+			0x0, 0x1, 0x7489, 0x0, 0x1, 0x79ca, 0x0, 0x1, 0x7df4, 0x0, 0x1, 0x806f, 0x0, 0x1, 0x8f26, 0x0, 0x1,
+			0x84ee, 0x0, 0x1, 0x9023, 0x0, 0x1, 0x934a, 0x0, 0x1, 0x5217, 0x0, 0x1, 0x52a3, 0x0, 0x1, 0x54bd, 0x0,
+			0x1, 0x70c8, 0x0, 0x1, 0x88c2, 0x0, 0x1, 0x8aaa, 0x0, 0x1, 0x5ec9, 0x0, 0x1, 0x5ff5, 0x0, 0x1, 0x637b,
+			0x0, 0x1, 0x6bae, 0x0, 0x1, 0x7c3e, 0x0, 0x1, 0x7375, 0x0, 0x1, 0x4ee4, 0x0, 0x1, 0x56f9, 0x0, 0x1,
+			0x5be7, 0x0, 0x1, 0x5dba, 0x0, 0x1, 0x601c, 0x0, 0x1, 0x73b2, 0x0, 0x1, 0x7469, 0x0, 0x1, 0x7f9a, 0x0,
+			0x1, 0x8046, 0x0, 0x1, 0x9234, 0x0, 0x1, 0x96f6, 0x0, 0x1, 0x9748, 0x0, 0x1, 0x9818, 0x0, 0x1, 0x4f8b,
+			0x0, 0x1, 0x79ae, 0x0, 0x1, 0x91b4, 0x0, 0x1, 0x96b8, 0x0, 0x1, 0x60e1, 0x0, 0x1, 0x4e86, 0x0, 0x1,
+			0x50da, 0x0, 0x1, 0x5bee, 0x0, 0x1, 0x5c3f, 0x0, 0x1, 0x6599, 0x0, 0x1, 0x6a02, 0x0, 0x1, 0x71ce, 0x0,
+			0x1, 0x7642, 0x0, 0x1, 0x84fc, 0x0, 0x1, 0x907c, 0x0, 0x1, 0x9f8d, 0x0, 0x1, 0x6688, 0x0, 0x1, 0x962e,
+			0x0, 0x1, 0x5289, 0x0, 0x1, 0x677b, 0x0, 0x1, 0x67f3, 0x0, 0x1, 0x6d41, 0x0, 0x1, 0x6e9c, 0x0, 0x1,
+			0x7409, 0x0, 0x1, 0x7559, 0x0, 0x1, 0x786b, 0x0, 0x1, 0x7d10, 0x0, 0x1, 0x985e, 0x0, 0x1, 0x516d, 0x0,
+			0x1, 0x622e, 0x0, 0x1, 0x9678, 0x0, 0x1, 0x502b, 0x0, 0x1, 0x5d19, 0x0, 0x1, 0x6dea, 0x0, 0x1, 0x8f2a,
+			0x0, 0x1, 0x5f8b, 0x0, 0x1, 0x6144, 0x0, 0x1, 0x6817, 0x0, 0x1, 0x7387, 0x0, 0x1, 0x9686, 0x0, 0x1,
+			0x5229, 0x0, 0x1, 0x540f, 0x0, 0x1, 0x5c65, 0x0, 0x1, 0x6613, 0x0, 0x1, 0x674e, 0x0, 0x1, 0x68a8, 0x0,
+			0x1, 0x6ce5, 0x0, 0x1, 0x7406, 0x0, 0x1, 0x75e2, 0x0, 0x1, 0x7f79, 0x0, 0x1, 0x88cf, 0x0, 0x1, 0x88e1,
+			0x0, 0x1, 0x91cc, 0x0, 0x1, 0x96e2, 0x0, 0x1, 0x533f, 0x0, 0x1, 0x6eba, 0x0, 0x1, 0x541d, 0x0, 0x1,
+			0x71d0, 0x0, 0x1, 0x7498, 0x0, 0x1, 0x85fa, 0x0, 0x1, 0x96a3, 0x0, 0x1, 0x9c57, 0x0, 0x1, 0x9e9f, 0x0,
+			0x1, 0x6797, 0x0, 0x1, 0x6dcb, 0x0, 0x1, 0x81e8, 0x0, 0x1, 0x7acb, 0x0, 0x1, 0x7b20, 0x0, 0x1, 0x7c92,
+			0x0, 0x1, 0x72c0, 0x0, 0x1, 0x7099, 0x0, 0x1, 0x8b58, 0x0, 0x1, 0x4ec0, 0x0, 0x1, 0x8336, 0x0, 0x1,
+			0x523a, 0x0, 0x1, 0x5207, 0x0, 0x1, 0x5ea6, 0x0, 0x1, 0x62d3, 0x0, 0x1, 0x7cd6, 0x0, 0x1, 0x5b85, 0x0,
+			0x1, 0x6d1e, 0x0, 0x1, 0x66b4, 0x0, 0x1, 0x8f3b, 0x0, 0x1, 0x884c, 0x0, 0x1, 0x964d, 0x0, 0x1, 0x898b,
+			0x0, 0x1, 0x5ed3, 0x0, 0x1, 0x5140, 0x0, 0x1, 0x55c0, 0x0, 0x1, 0x585a, 0x0, 0x1, 0x6674, 0x0, 0x1,
+			0x51de, 0x0, 0x1, 0x732a, 0x0, 0x1, 0x76ca, 0x0, 0x1, 0x793c, 0x0, 0x1, 0x795e, 0x0, 0x1, 0x7965, 0x0,
+			0x1, 0x798f, 0x0, 0x1, 0x9756, 0x0, 0x1, 0x7cbe, 0x0, 0x1, 0x7fbd, 0x0, 0x1, 0x8612, 0x0, 0x1, 0x8af8,
+			0x0, 0x1, 0x9038, 0x0, 0x1, 0x90fd, 0x0, 0x1, 0x98ef, 0x0, 0x1, 0x98fc, 0x0, 0x1, 0x9928, 0x0, 0x1,
+			0x9db4, 0x0, 0x1, 0x90de, 0x0, 0x1, 0x96b7, 0x0, 0x1, 0x4fae, 0x0, 0x1, 0x50e7, 0x0, 0x1, 0x514d, 0x0,
+			0x1, 0x52c9, 0x0, 0x1, 0x52e4, 0x0, 0x1, 0x5351, 0x0, 0x1, 0x559d, 0x0, 0x1, 0x5606, 0x0, 0x1, 0x5668,
+			0x0, 0x1, 0x5840, 0x0, 0x1, 0x58a8, 0x0, 0x1, 0x5c64, 0x0, 0x1, 0x5c6e, 0x0, 0x1, 0x6094, 0x0, 0x1,
+			0x6168, 0x0, 0x1, 0x618e, 0x0, 0x1, 0x61f2, 0x0, 0x1, 0x654f, 0x0, 0x1, 0x65e2, 0x0, 0x1, 0x6691, 0x0,
+			0x1, 0x6885, 0x0, 0x1, 0x6d77, 0x0, 0x1, 0x6e1a, 0x0, 0x1, 0x6f22, 0x0, 0x1, 0x716e, 0x0, 0x1, 0x722b,
+			0x0, 0x1, 0x7422, 0x0, 0x1, 0x7891, 0x0, 0x1, 0x793e, 0x0, 0x1, 0x7949, 0x0, 0x1, 0x7948, 0x0, 0x1,
+			0x7950, 0x0, 0x1, 0x7956, 0x0, 0x1, 0x795d, 0x0, 0x1, 0x798d, 0x0, 0x1, 0x798e, 0x0, 0x1, 0x7a40, 0x0,
+			0x1, 0x7a81, 0x0, 0x1, 0x7bc0, 0x0, 0x1, 0x7df4, 0x0, 0x1, 0x7e09, 0x0, 0x1, 0x7e41, 0x0, 0x1, 0x7f72,
+			0x0, 0x1, 0x8005, 0x0, 0x1, 0x81ed, 0x0, 0x1, 0x8279, 0x0, 0x1, 0x8279, 0x0, 0x1, 0x8457, 0x0, 0x1,
+			0x8910, 0x0, 0x1, 0x8996, 0x0, 0x1, 0x8b01, 0x0, 0x1, 0x8b39, 0x0, 0x1, 0x8cd3, 0x0, 0x1, 0x8d08, 0x0,
+			0x1, 0x8fb6, 0x0, 0x1, 0x9038, 0x0, 0x1, 0x96e3, 0x0, 0x1, 0x97ff, 0x0, 0x1, 0x983b, 0x0, 0x1, 0x6075,
+			0x0, 0x1, 0x242ee, 0x0, 0x1, 0x8218, 0x0, 0x1, 0x4e26, 0x0, 0x1, 0x51b5, 0x0, 0x1, 0x5168, 0x0, 0x1,
+			0x4f80, 0x0, 0x1, 0x5145, 0x0, 0x1, 0x5180, 0x0, 0x1, 0x52c7, 0x0, 0x1, 0x52fa, 0x0, 0x1, 0x559d, 0x0,
+			0x1, 0x5555, 0x0, 0x1, 0x5599, 0x0, 0x1, 0x55e2, 0x0, 0x1, 0x585a, 0x0, 0x1, 0x58b3, 0x0, 0x1, 0x5944,
+			0x0, 0x1, 0x5954, 0x0, 0x1, 0x5a62, 0x0, 0x1, 0x5b28, 0x0, 0x1, 0x5ed2, 0x0, 0x1, 0x5ed9, 0x0, 0x1,
+			0x5f69, 0x0, 0x1, 0x5fad, 0x0, 0x1, 0x60d8, 0x0, 0x1, 0x614e, 0x0, 0x1, 0x6108, 0x0, 0x1, 0x618e, 0x0,
+			0x1, 0x6160, 0x0, 0x1, 0x61f2, 0x0, 0x1, 0x6234, 0x0, 0x1, 0x63c4, 0x0, 0x1, 0x641c, 0x0, 0x1, 0x6452,
+			0x0, 0x1, 0x6556, 0x0, 0x1, 0x6674, 0x0, 0x1, 0x6717, 0x0, 0x1, 0x671b, 0x0, 0x1, 0x6756, 0x0, 0x1,
+			0x6b79, 0x0, 0x1, 0x6bba, 0x0, 0x1, 0x6d41, 0x0, 0x1, 0x6edb, 0x0, 0x1, 0x6ecb, 0x0, 0x1, 0x6f22, 0x0,
+			0x1, 0x701e, 0x0, 0x1, 0x716e, 0x0, 0x1, 0x77a7, 0x0, 0x1, 0x7235, 0x0, 0x1, 0x72af, 0x0, 0x1, 0x732a,
+			0x0, 0x1, 0x7471, 0x0, 0x1, 0x7506, 0x0, 0x1, 0x753b, 0x0, 0x1, 0x761d, 0x0, 0x1, 0x761f, 0x0, 0x1,
+			0x76ca, 0x0, 0x1, 0x76db, 0x0, 0x1, 0x76f4, 0x0, 0x1, 0x774a, 0x0, 0x1, 0x7740, 0x0, 0x1, 0x78cc, 0x0,
+			0x1, 0x7ab1, 0x0, 0x1, 0x7bc0, 0x0, 0x1, 0x7c7b, 0x0, 0x1, 0x7d5b, 0x0, 0x1, 0x7df4, 0x0, 0x1, 0x7f3e,
+			0x0, 0x1, 0x8005, 0x0, 0x1, 0x8352, 0x0, 0x1, 0x83ef, 0x0, 0x1, 0x8779, 0x0, 0x1, 0x8941, 0x0, 0x1,
+			0x8986, 0x0, 0x1, 0x8996, 0x0, 0x1, 0x8abf, 0x0, 0x1, 0x8af8, 0x0, 0x1, 0x8acb, 0x0, 0x1, 0x8b01, 0x0,
+			0x1, 0x8afe, 0x0, 0x1, 0x8aed, 0x0, 0x1, 0x8b39, 0x0, 0x1, 0x8b8a, 0x0, 0x1, 0x8d08, 0x0, 0x1, 0x8f38,
+			0x0, 0x1, 0x9072, 0x0, 0x1, 0x9199, 0x0, 0x1, 0x9276, 0x0, 0x1, 0x967c, 0x0, 0x1, 0x96e3, 0x0, 0x1,
+			0x9756, 0x0, 0x1, 0x97db, 0x0, 0x1, 0x97ff, 0x0, 0x1, 0x980b, 0x0, 0x1, 0x983b, 0x0, 0x1, 0x9b12, 0x0,
+			0x1, 0x9f9c, 0x0, 0x1, 0x2284a, 0x0, 0x1, 0x22844, 0x0, 0x1, 0x233d5, 0x0, 0x1, 0x3b9d, 0x0, 0x1,
+			0x4018, 0x0, 0x1, 0x4039, 0x0, 0x1, 0x25249, 0x0, 0x1, 0x25cd0, 0x0, 0x1, 0x27ed3, 0x0, 0x1, 0x9f43,
+			0x0, 0x1, 0x9f8e, 0x0, 0x0, 0x2, 0x66, 0x66, 0x0, 0x2, 0x66, 0x69, 0x0, 0x2, 0x66, 0x6c, 0x0, 0x3, 0x66,
+			0x66, 0x69, 0x0, 0x3, 0x66, 0x66, 0x6c, 0x0, 0x2, 0x73, 0x74, 0x0, 0x2, 0x73, 0x74, 0x0, 0x2, 0x574,
+			0x576, 0x0, 0x2, 0x574, 0x565, 0x0, 0x2, 0x574, 0x56b, 0x0, 0x2, 0x57e, 0x576, 0x0, 0x2, 0x574, 0x56d,
+			0x2, 0x5d9, 0x5b4, 0x0, 0x2, 0x5f2, 0x5b7, 0x0, 0x0, 0x1, 0x5e2, 0x0, 0x1, 0x5d0, 0x0, 0x1, 0x5d3, 0x0,
+			0x1, 0x5d4, 0x0, 0x1, 0x5db, 0x0, 0x1, 0x5dc, 0x0, 0x1, 0x5dd, 0x0, 0x1, 0x5e8, 0x0, 0x1, 0x5ea, 0x0,
+			0x1, 0x2b, 0x2, 0x5e9, 0x5c1, 0x0, 0x2, 0x5e9, 0x5c2, 0x0, 0x3, 0x5e9, 0x5bc, 0x5c1, 0x0, 0x3, 0x5e9,
+			0x5bc, 0x5c2, 0x0, 0x2, 0x5d0, 0x5b7, 0x0, 0x2, 0x5d0, 0x5b8, 0x0, 0x2, 0x5d0, 0x5bc, 0x0, 0x2, 0x5d1,
+			0x5bc, 0x0, 0x2, 0x5d2, 0x5bc, 0x0, 0x2, 0x5d3, 0x5bc, 0x0, 0x2, 0x5d4, 0x5bc, 0x0, 0x2, 0x5d5, 0x5bc,
+			0x0, 0x2, 0x5d6, 0x5bc, 0x0, 0x2, 0x5d8, 0x5bc, 0x0, 0x2, 0x5d9, 0x5bc, 0x0, 0x2, 0x5da, 0x5bc, 0x0,
+			0x2, 0x5db, 0x5bc, 0x0, 0x2, 0x5dc, 0x5bc, 0x0, 0x2, 0x5de, 0x5bc, 0x0, 0x2, 0x5e0, 0x5bc, 0x0, 0x2,
+			0x5e1, 0x5bc, 0x0, 0x2, 0x5e3, 0x5bc, 0x0, 0x2, 0x5e4, 0x5bc, 0x0, 0x2, 0x5e6, 0x5bc, 0x0, 0x2, 0x5e7,
+			0x5bc, 0x0, 0x2, 0x5e8, 0x5bc, 0x0, 0x2, 0x5e9, 0x5bc, 0x0, 0x2, 0x5ea, 0x5bc, 0x0, 0x2, 0x5d5, 0x5b9,
+			0x0, 0x2, 0x5d1, 0x5bf, 0x0, 0x2, 0x5db, 0x5bf, 0x0, 0x2, 0x5e4, 0x5bf, 0x0, 0x0, 0x2, 0x5d0, 0x5dc,
+			0x0, 0x1, 0x671, 0x0, 0x1, 0x671, 0x0, 0x1, 0x67b, 0x0, 0x1, 0x67b, 0x0, 0x1, 0x67b, 0x0, 0x1, 0x67b,
+			0x0, 0x1, 0x67e, 0x0, 0x1, 0x67e, 0x0, 0x1, 0x67e, 0x0, 0x1, 0x67e, 0x0, 0x1, 0x680, 0x0, 0x1, 0x680,
+			0x0, 0x1, 0x680, 0x0, 0x1, 0x680, 0x0, 0x1, 0x67a, 0x0, 0x1, 0x67a, 0x0, 0x1, 0x67a, 0x0, 0x1, 0x67a,
+			0x0, 0x1, 0x67f, 0x0, 0x1, 0x67f, 0x0, 0x1, 0x67f, 0x0, 0x1, 0x67f, 0x0, 0x1, 0x679, 0x0, 0x1, 0x679,
+			0x0, 0x1, 0x679, 0x0, 0x1, 0x679, 0x0, 0x1, 0x6a4, 0x0, 0x1, 0x6a4, 0x0, 0x1, 0x6a4, 0x0, 0x1, 0x6a4,
+			0x0, 0x1, 0x6a6, 0x0, 0x1, 0x6a6, 0x0, 0x1, 0x6a6, 0x0, 0x1, 0x6a6, 0x0, 0x1, 0x684, 0x0, 0x1, 0x684,
+			0x0, 0x1, 0x684, 0x0, 0x1, 0x684, 0x0, 0x1, 0x683, 0x0, 0x1, 0x683, 0x0, 0x1, 0x683, 0x0, 0x1, 0x683,
+			0x0, 0x1, 0x686, 0x0, 0x1, 0x686, 0x0, 0x1, 0x686, 0x0, 0x1, 0x686, 0x0, 0x1, 0x687, 0x0, 0x1, 0x687,
+			0x0, 0x1, 0x687, 0x0, 0x1, 0x687, 0x0, 0x1, 0x68d, 0x0, 0x1, 0x68d, 0x0, 0x1, 0x68c, 0x0, 0x1, 0x68c,
+			0x0, 0x1, 0x68e, 0x0, 0x1, 0x68e, 0x0, 0x1, 0x688, 0x0, 0x1, 0x688, 0x0, 0x1, 0x698, 0x0, 0x1, 0x698,
+			0x0, 0x1, 0x691, 0x0, 0x1, 0x691, 0x0, 0x1, 0x6a9, 0x0, 0x1, 0x6a9, 0x0, 0x1, 0x6a9, 0x0, 0x1, 0x6a9,
+			0x0, 0x1, 0x6af, 0x0, 0x1, 0x6af, 0x0, 0x1, 0x6af, 0x0, 0x1, 0x6af, 0x0, 0x1, 0x6b3, 0x0, 0x1, 0x6b3,
+			0x0, 0x1, 0x6b3, 0x0, 0x1, 0x6b3, 0x0, 0x1, 0x6b1, 0x0, 0x1, 0x6b1, 0x0, 0x1, 0x6b1, 0x0, 0x1, 0x6b1,
+			0x0, 0x1, 0x6ba, 0x0, 0x1, 0x6ba, 0x0, 0x1, 0x6bb, 0x0, 0x1, 0x6bb, 0x0, 0x1, 0x6bb, 0x0, 0x1, 0x6bb,
+			0x0, 0x2, 0x6d5, 0x654, 0x0, 0x2, 0x6d5, 0x654, 0x0, 0x1, 0x6c1, 0x0, 0x1, 0x6c1, 0x0, 0x1, 0x6c1, 0x0,
+			0x1, 0x6c1, 0x0, 0x1, 0x6be, 0x0, 0x1, 0x6be, 0x0, 0x1, 0x6be, 0x0, 0x1, 0x6be, 0x0, 0x1, 0x6d2, 0x0,
+			0x1, 0x6d2, 0x0, 0x2, 0x6d2, 0x654, 0x0, 0x2, 0x6d2, 0x654, 0x0, 0x1, 0x6ad, 0x0, 0x1, 0x6ad, 0x0, 0x1,
+			0x6ad, 0x0, 0x1, 0x6ad, 0x0, 0x1, 0x6c7, 0x0, 0x1, 0x6c7, 0x0, 0x1, 0x6c6, 0x0, 0x1, 0x6c6, 0x0, 0x1,
+			0x6c8, 0x0, 0x1, 0x6c8, 0x0, 0x2, 0x6c7, 0x674, 0x0, 0x1, 0x6cb, 0x0, 0x1, 0x6cb, 0x0, 0x1, 0x6c5, 0x0,
+			0x1, 0x6c5, 0x0, 0x1, 0x6c9, 0x0, 0x1, 0x6c9, 0x0, 0x1, 0x6d0, 0x0, 0x1, 0x6d0, 0x0, 0x1, 0x6d0, 0x0,
+			0x1, 0x6d0, 0x0, 0x1, 0x649, 0x0, 0x1, 0x649, 0x0, 0x3, 0x64a, 0x654, 0x627, 0x0, 0x3, 0x64a, 0x654,
+			0x627, 0x0, 0x3, 0x64a, 0x654, 0x6d5, 0x0, 0x3, 0x64a, 0x654, 0x6d5, 0x0, 0x3, 0x64a, 0x654, 0x648, 0x0,
+			0x3, 0x64a, 0x654, 0x648, 0x0, 0x3, 0x64a, 0x654, 0x6c7, 0x0, 0x3, 0x64a, 0x654, 0x6c7, 0x0, 0x3, 0x64a,
+			0x654, 0x6c6, 0x0, 0x3, 0x64a, 0x654, 0x6c6, 0x0, 0x3, 0x64a, 0x654, 0x6c8, 0x0, 0x3, 0x64a, 0x654,
+			0x6c8, 0x0, 0x3, 0x64a, 0x654, 0x6d0, 0x0, 0x3, 0x64a, 0x654, 0x6d0, 0x0, 0x3, 0x64a, 0x654, 0x6d0, 0x0,
+			0x3, 0x64a, 0x654, 0x649, 0x0, 0x3, 0x64a, 0x654, 0x649, 0x0, 0x3, 0x64a, 0x654, 0x649, 0x0, 0x1, 0x6cc,
+			0x0, 0x1, 0x6cc, 0x0, 0x1, 0x6cc, 0x0, 0x1, 0x6cc, 0x0, 0x3, 0x64a, 0x654, 0x62c, 0x0, 0x3, 0x64a,
+			0x654, 0x62d, 0x0, 0x3, 0x64a, 0x654, 0x645, 0x0, 0x3, 0x64a, 0x654, 0x649, 0x0, 0x3, 0x64a, 0x654,
+			0x64a, 0x0, 0x2, 0x628, 0x62c, 0x0, 0x2, 0x628, 0x62d, 0x0, 0x2, 0x628, 0x62e, 0x0, 0x2, 0x628, 0x645,
+			0x0, 0x2, 0x628, 0x649, 0x0, 0x2, 0x628, 0x64a, 0x0, 0x2, 0x62a, 0x62c, 0x0, 0x2, 0x62a, 0x62d, 0x0,
+			0x2, 0x62a, 0x62e, 0x0, 0x2, 0x62a, 0x645, 0x0, 0x2, 0x62a, 0x649, 0x0, 0x2, 0x62a, 0x64a, 0x0, 0x2,
+			0x62b, 0x62c, 0x0, 0x2, 0x62b, 0x645, 0x0, 0x2, 0x62b, 0x649, 0x0, 0x2, 0x62b, 0x64a, 0x0, 0x2, 0x62c,
+			0x62d, 0x0, 0x2, 0x62c, 0x645, 0x0, 0x2, 0x62d, 0x62c, 0x0, 0x2, 0x62d, 0x645, 0x0, 0x2, 0x62e, 0x62c,
+			0x0, 0x2, 0x62e, 0x62d, 0x0, 0x2, 0x62e, 0x645, 0x0, 0x2, 0x633, 0x62c, 0x0, 0x2, 0x633, 0x62d, 0x0,
+			0x2, 0x633, 0x62e, 0x0, 0x2, 0x633, 0x645, 0x0, 0x2, 0x635, 0x62d, 0x0, 0x2, 0x635, 0x645, 0x0, 0x2,
+			0x636, 0x62c, 0x0, 0x2, 0x636, 0x62d, 0x0, 0x2, 0x636, 0x62e, 0x0, 0x2, 0x636, 0x645, 0x0, 0x2, 0x637,
+			0x62d, 0x0, 0x2, 0x637, 0x645, 0x0, 0x2, 0x638, 0x645, 0x0, 0x2, 0x639, 0x62c, 0x0, 0x2, 0x639, 0x645,
+			0x0, 0x2, 0x63a, 0x62c, 0x0, 0x2, 0x63a, 0x645, 0x0, 0x2, 0x641, 0x62c, 0x0, 0x2, 0x641, 0x62d, 0x0,
+			0x2, 0x641, 0x62e, 0x0, 0x2, 0x641, 0x645, 0x0, 0x2, 0x641, 0x649, 0x0, 0x2, 0x641, 0x64a, 0x0, 0x2,
+			0x642, 0x62d, 0x0, 0x2, 0x642, 0x645, 0x0, 0x2, 0x642, 0x649, 0x0, 0x2, 0x642, 0x64a, 0x0, 0x2, 0x643,
+			0x627, 0x0, 0x2, 0x643, 0x62c, 0x0, 0x2, 0x643, 0x62d, 0x0, 0x2, 0x643, 0x62e, 0x0, 0x2, 0x643, 0x644,
+			0x0, 0x2, 0x643, 0x645, 0x0, 0x2, 0x643, 0x649, 0x0, 0x2, 0x643, 0x64a, 0x0, 0x2, 0x644, 0x62c, 0x0,
+			0x2, 0x644, 0x62d, 0x0, 0x2, 0x644, 0x62e, 0x0, 0x2, 0x644, 0x645, 0x0, 0x2, 0x644, 0x649, 0x0, 0x2,
+			0x644, 0x64a, 0x0, 0x2, 0x645, 0x62c, 0x0, 0x2, 0x645, 0x62d, 0x0, 0x2, 0x645, 0x62e, 0x0, 0x2, 0x645,
+			0x645, 0x0, 0x2, 0x645, 0x649, 0x0, 0x2, 0x645, 0x64a, 0x0, 0x2, 0x646, 0x62c, 0x0, 0x2, 0x646, 0x62d,
+			0x0, 0x2, 0x646, 0x62e, 0x0, 0x2, 0x646, 0x645, 0x0, 0x2, 0x646, 0x649, 0x0, 0x2, 0x646, 0x64a, 0x0,
+			0x2, 0x647, 0x62c, 0x0, 0x2, 0x647, 0x645, 0x0, 0x2, 0x647, 0x649, 0x0, 0x2, 0x647, 0x64a, 0x0, 0x2,
+			0x64a, 0x62c, 0x0, 0x2, 0x64a, 0x62d, 0x0, 0x2, 0x64a, 0x62e, 0x0, 0x2, 0x64a, 0x645, 0x0, 0x2, 0x64a,
+			0x649, 0x0, 0x2, 0x64a, 0x64a, 0x0, 0x2, 0x630, 0x670, 0x0, 0x2, 0x631, 0x670, 0x0, 0x2, 0x649, 0x670,
+			0x0, 0x3, 0x20, 0x64c, 0x651, 0x0, 0x3, 0x20, 0x64d, 0x651, 0x0, 0x3, 0x20, 0x64e, 0x651, 0x0, 0x3,
+			0x20, 0x64f, 0x651, 0x0, 0x3, 0x20, 0x650, 0x651, 0x0, 0x3, 0x20, 0x651, 0x670, 0x0, 0x3, 0x64a, 0x654,
+			0x631, 0x0, 0x3, 0x64a, 0x654, 0x632, 0x0, 0x3, 0x64a, 0x654, 0x645, 0x0, 0x3, 0x64a, 0x654, 0x646, 0x0,
+			0x3, 0x64a, 0x654, 0x649, 0x0, 0x3, 0x64a, 0x654, 0x64a, 0x0, 0x2, 0x628, 0x631, 0x0, 0x2, 0x628, 0x632,
+			0x0, 0x2, 0x628, 0x645, 0x0, 0x2, 0x628, 0x646, 0x0, 0x2, 0x628, 0x649, 0x0, 0x2, 0x628, 0x64a, 0x0,
+			0x2, 0x62a, 0x631, 0x0, 0x2, 0x62a, 0x632, 0x0, 0x2, 0x62a, 0x645, 0x0, 0x2, 0x62a, 0x646, 0x0, 0x2,
+			0x62a, 0x649, 0x0, 0x2, 0x62a, 0x64a, 0x0, 0x2, 0x62b, 0x631, 0x0, 0x2, 0x62b, 0x632, 0x0, 0x2, 0x62b,
+			0x645, 0x0, 0x2, 0x62b, 0x646, 0x0, 0x2, 0x62b, 0x649, 0x0, 0x2, 0x62b, 0x64a, 0x0, 0x2, 0x641, 0x649,
+			0x0, 0x2, 0x641, 0x64a, 0x0, 0x2, 0x642, 0x649, 0x0, 0x2, 0x642, 0x64a, 0x0, 0x2, 0x643, 0x627, 0x0,
+			0x2, 0x643, 0x644, 0x0, 0x2, 0x643, 0x645, 0x0, 0x2, 0x643, 0x649, 0x0, 0x2, 0x643, 0x64a, 0x0, 0x2,
+			0x644, 0x645, 0x0, 0x2, 0x644, 0x649, 0x0, 0x2, 0x644, 0x64a, 0x0, 0x2, 0x645, 0x627, 0x0, 0x2, 0x645,
+			0x645, 0x0, 0x2, 0x646, 0x631, 0x0, 0x2, 0x646, 0x632, 0x0, 0x2, 0x646, 0x645, 0x0, 0x2, 0x646, 0x646,
+			0x0, 0x2, 0x646, 0x649, 0x0, 0x2, 0x646, 0x64a, 0x0, 0x2, 0x649, 0x670, 0x0, 0x2, 0x64a, 0x631, 0x0,
+			0x2, 0x64a, 0x632, 0x0, 0x2, 0x64a, 0x645, 0x0, 0x2, 0x64a, 0x646, 0x0, 0x2, 0x64a, 0x649, 0x0, 0x2,
+			0x64a, 0x64a, 0x0, 0x3, 0x64a, 0x654, 0x62c, 0x0, 0x3, 0x64a, 0x654, 0x62d, 0x0, 0x3, 0x64a, 0x654,
+			0x62e, 0x0, 0x3, 0x64a, 0x654, 0x645, 0x0, 0x3, 0x64a, 0x654, 0x647, 0x0, 0x2, 0x628, 0x62c, 0x0, 0x2,
+			0x628, 0x62d, 0x0, 0x2, 0x628, 0x62e, 0x0, 0x2, 0x628, 0x645, 0x0, 0x2, 0x628, 0x647, 0x0, 0x2, 0x62a,
+			0x62c, 0x0, 0x2, 0x62a, 0x62d, 0x0, 0x2, 0x62a, 0x62e, 0x0, 0x2, 0x62a, 0x645, 0x0, 0x2, 0x62a, 0x647,
+			0x0, 0x2, 0x62b, 0x645, 0x0, 0x2, 0x62c, 0x62d, 0x0, 0x2, 0x62c, 0x645, 0x0, 0x2, 0x62d, 0x62c, 0x0,
+			0x2, 0x62d, 0x645, 0x0, 0x2, 0x62e, 0x62c, 0x0, 0x2, 0x62e, 0x645, 0x0, 0x2, 0x633, 0x62c, 0x0, 0x2,
+			0x633, 0x62d, 0x0, 0x2, 0x633, 0x62e, 0x0, 0x2, 0x633, 0x645, 0x0, 0x2, 0x635, 0x62d, 0x0, 0x2, 0x635,
+			0x62e, 0x0, 0x2, 0x635, 0x645, 0x0, 0x2, 0x636, 0x62c, 0x0, 0x2, 0x636, 0x62d, 0x0, 0x2, 0x636, 0x62e,
+			0x0, 0x2, 0x636, 0x645, 0x0, 0x2, 0x637, 0x62d, 0x0, 0x2, 0x638, 0x645, 0x0, 0x2, 0x639, 0x62c, 0x0,
+			0x2, 0x639, 0x645, 0x0, 0x2, 0x63a, 0x62c, 0x0, 0x2, 0x63a, 0x645, 0x0, 0x2, 0x641, 0x62c, 0x0, 0x2,
+			0x641, 0x62d, 0x0, 0x2, 0x641, 0x62e, 0x0, 0x2, 0x641, 0x645, 0x0, 0x2, 0x642, 0x62d, 0x0, 0x2, 0x642,
+			0x645, 0x0, 0x2, 0x643, 0x62c, 0x0, 0x2, 0x643, 0x62d, 0x0, 0x2, 0x643, 0x62e, 0x0, 0x2, 0x643, 0x644,
+			0x0, 0x2, 0x643, 0x645, 0x0, 0x2, 0x644, 0x62c, 0x0, 0x2, 0x644, 0x62d, 0x0, 0x2, 0x644, 0x62e, 0x0,
+			0x2, 0x644, 0x645, 0x0, 0x2, 0x644, 0x647, 0x0, 0x2, 0x645, 0x62c, 0x0, 0x2, 0x645, 0x62d, 0x0, 0x2,
+			0x645, 0x62e, 0x0, 0x2, 0x645, 0x645, 0x0, 0x2, 0x646, 0x62c, 0x0, 0x2, 0x646, 0x62d, 0x0, 0x2, 0x646,
+			0x62e, 0x0, 0x2, 0x646, 0x645, 0x0, 0x2, 0x646, 0x647, 0x0, 0x2, 0x647, 0x62c, 0x0, 0x2, 0x647, 0x645,
+			0x0, 0x2, 0x647, 0x670, 0x0, 0x2, 0x64a, 0x62c, 0x0, 0x2, 0x64a, 0x62d, 0x0, 0x2, 0x64a, 0x62e, 0x0,
+			0x2, 0x64a, 0x645, 0x0, 0x2, 0x64a, 0x647, 0x0, 0x3, 0x64a, 0x654, 0x645, 0x0, 0x3, 0x64a, 0x654, 0x647,
+			0x0, 0x2, 0x628, 0x645, 0x0, 0x2, 0x628, 0x647, 0x0, 0x2, 0x62a, 0x645, 0x0, 0x2, 0x62a, 0x647, 0x0,
+			0x2, 0x62b, 0x645, 0x0, 0x2, 0x62b, 0x647, 0x0, 0x2, 0x633, 0x645, 0x0, 0x2, 0x633, 0x647, 0x0, 0x2,
+			0x634, 0x645, 0x0, 0x2, 0x634, 0x647, 0x0, 0x2, 0x643, 0x644, 0x0, 0x2, 0x643, 0x645, 0x0, 0x2, 0x644,
+			0x645, 0x0, 0x2, 0x646, 0x645, 0x0, 0x2, 0x646, 0x647, 0x0, 0x2, 0x64a, 0x645, 0x0, 0x2, 0x64a, 0x647,
+			0x0, 0x3, 0x640, 0x64e, 0x651, 0x0, 0x3, 0x640, 0x64f, 0x651, 0x0, 0x3, 0x640, 0x650, 0x651, 0x0, 0x2,
+			0x637, 0x649, 0x0, 0x2, 0x637, 0x64a, 0x0, 0x2, 0x639, 0x649, 0x0, 0x2, 0x639, 0x64a, 0x0, 0x2, 0x63a,
+			0x649, 0x0, 0x2, 0x63a, 0x64a, 0x0, 0x2, 0x633, 0x649, 0x0, 0x2, 0x633, 0x64a, 0x0, 0x2, 0x634, 0x649,
+			0x0, 0x2, 0x634, 0x64a, 0x0, 0x2, 0x62d, 0x649, 0x0, 0x2, 0x62d, 0x64a, 0x0, 0x2, 0x62c, 0x649, 0x0,
+			0x2, 0x62c, 0x64a, 0x0, 0x2, 0x62e, 0x649, 0x0, 0x2, 0x62e, 0x64a, 0x0, 0x2, 0x635, 0x649, 0x0, 0x2,
+			0x635, 0x64a, 0x0, 0x2, 0x636, 0x649, 0x0, 0x2, 0x636, 0x64a, 0x0, 0x2, 0x634, 0x62c, 0x0, 0x2, 0x634,
+			0x62d, 0x0, 0x2, 0x634, 0x62e, 0x0, 0x2, 0x634, 0x645, 0x0, 0x2, 0x634, 0x631, 0x0, 0x2, 0x633, 0x631,
+			0x0, 0x2, 0x635, 0x631, 0x0, 0x2, 0x636, 0x631, 0x0, 0x2, 0x637, 0x649, 0x0, 0x2, 0x637, 0x64a, 0x0,
+			0x2, 0x639, 0x649, 0x0, 0x2, 0x639, 0x64a, 0x0, 0x2, 0x63a, 0x649, 0x0, 0x2, 0x63a, 0x64a, 0x0, 0x2,
+			0x633, 0x649, 0x0, 0x2, 0x633, 0x64a, 0x0, 0x2, 0x634, 0x649, 0x0, 0x2, 0x634, 0x64a, 0x0, 0x2, 0x62d,
+			0x649, 0x0, 0x2, 0x62d, 0x64a, 0x0, 0x2, 0x62c, 0x649, 0x0, 0x2, 0x62c, 0x64a, 0x0, 0x2, 0x62e, 0x649,
+			0x0, 0x2, 0x62e, 0x64a, 0x0, 0x2, 0x635, 0x649, 0x0, 0x2, 0x635, 0x64a, 0x0, 0x2, 0x636, 0x649, 0x0,
+			0x2, 0x636, 0x64a, 0x0, 0x2, 0x634, 0x62c, 0x0, 0x2, 0x634, 0x62d, 0x0, 0x2, 0x634, 0x62e, 0x0, 0x2,
+			0x634, 0x645, 0x0, 0x2, 0x634, 0x631, 0x0, 0x2, 0x633, 0x631, 0x0, 0x2, 0x635, 0x631, 0x0, 0x2, 0x636,
+			0x631, 0x0, 0x2, 0x634, 0x62c, 0x0, 0x2, 0x634, 0x62d, 0x0, 0x2, 0x634, 0x62e, 0x0, 0x2, 0x634, 0x645,
+			0x0, 0x2, 0x633, 0x647, 0x0, 0x2, 0x634, 0x647, 0x0, 0x2, 0x637, 0x645, 0x0, 0x2, 0x633, 0x62c, 0x0,
+			0x2, 0x633, 0x62d, 0x0, 0x2, 0x633, 0x62e, 0x0, 0x2, 0x634, 0x62c, 0x0, 0x2, 0x634, 0x62d, 0x0, 0x2,
+			0x634, 0x62e, 0x0, 0x2, 0x637, 0x645, 0x0, 0x2, 0x638, 0x645, 0x0, 0x2, 0x627, 0x64b, 0x0, 0x2, 0x627,
+			0x64b, 0x0, 0x3, 0x62a, 0x62c, 0x645, 0x0, 0x3, 0x62a, 0x62d, 0x62c, 0x0, 0x3, 0x62a, 0x62d, 0x62c, 0x0,
+			0x3, 0x62a, 0x62d, 0x645, 0x0, 0x3, 0x62a, 0x62e, 0x645, 0x0, 0x3, 0x62a, 0x645, 0x62c, 0x0, 0x3, 0x62a,
+			0x645, 0x62d, 0x0, 0x3, 0x62a, 0x645, 0x62e, 0x0, 0x3, 0x62c, 0x645, 0x62d, 0x0, 0x3, 0x62c, 0x645,
+			0x62d, 0x0, 0x3, 0x62d, 0x645, 0x64a, 0x0, 0x3, 0x62d, 0x645, 0x649, 0x0, 0x3, 0x633, 0x62d, 0x62c, 0x0,
+			0x3, 0x633, 0x62c, 0x62d, 0x0, 0x3, 0x633, 0x62c, 0x649, 0x0, 0x3, 0x633, 0x645, 0x62d, 0x0, 0x3, 0x633,
+			0x645, 0x62d, 0x0, 0x3, 0x633, 0x645, 0x62c, 0x0, 0x3, 0x633, 0x645, 0x645, 0x0, 0x3, 0x633, 0x645,
+			0x645, 0x0, 0x3, 0x635, 0x62d, 0x62d, 0x0, 0x3, 0x635, 0x62d, 0x62d, 0x0, 0x3, 0x635, 0x645, 0x645, 0x0,
+			0x3, 0x634, 0x62d, 0x645, 0x0, 0x3, 0x634, 0x62d, 0x645, 0x0, 0x3, 0x634, 0x62c, 0x64a, 0x0, 0x3, 0x634,
+			0x645, 0x62e, 0x0, 0x3, 0x634, 0x645, 0x62e, 0x0, 0x3, 0x634, 0x645, 0x645, 0x0, 0x3, 0x634, 0x645,
+			0x645, 0x0, 0x3, 0x636, 0x62d, 0x649, 0x0, 0x3, 0x636, 0x62e, 0x645, 0x0, 0x3, 0x636, 0x62e, 0x645, 0x0,
+			0x3, 0x637, 0x645, 0x62d, 0x0, 0x3, 0x637, 0x645, 0x62d, 0x0, 0x3, 0x637, 0x645, 0x645, 0x0, 0x3, 0x637,
+			0x645, 0x64a, 0x0, 0x3, 0x639, 0x62c, 0x645, 0x0, 0x3, 0x639, 0x645, 0x645, 0x0, 0x3, 0x639, 0x645,
+			0x645, 0x0, 0x3, 0x639, 0x645, 0x649, 0x0, 0x3, 0x63a, 0x645, 0x645, 0x0, 0x3, 0x63a, 0x645, 0x64a, 0x0,
+			0x3, 0x63a, 0x645, 0x649, 0x0, 0x3, 0x641, 0x62e, 0x645, 0x0, 0x3, 0x641, 0x62e, 0x645, 0x0, 0x3, 0x642,
+			0x645, 0x62d, 0x0, 0x3, 0x642, 0x645, 0x645, 0x0, 0x3, 0x644, 0x62d, 0x645, 0x0, 0x3, 0x644, 0x62d,
+			0x64a, 0x0, 0x3, 0x644, 0x62d, 0x649, 0x0, 0x3, 0x644, 0x62c, 0x62c, 0x0, 0x3, 0x644, 0x62c, 0x62c, 0x0,
+			0x3, 0x644, 0x62e, 0x645, 0x0, 0x3, 0x644, 0x62e, 0x645, 0x0, 0x3, 0x644, 0x645, 0x62d, 0x0, 0x3, 0x644,
+			0x645, 0x62d, 0x0, 0x3, 0x645, 0x62d, 0x62c, 0x0, 0x3, 0x645, 0x62d, 0x645, 0x0, 0x3, 0x645, 0x62d,
+			0x64a, 0x0, 0x3, 0x645, 0x62c, 0x62d, 0x0, 0x3, 0x645, 0x62c, 0x645, 0x0, 0x3, 0x645, 0x62e, 0x62c, 0x0,
+			0x3, 0x645, 0x62e, 0x645, 0x0, 0x3, 0x645, 0x62c, 0x62e, 0x0, 0x3, 0x647, 0x645, 0x62c, 0x0, 0x3, 0x647,
+			0x645, 0x645, 0x0, 0x3, 0x646, 0x62d, 0x645, 0x0, 0x3, 0x646, 0x62d, 0x649, 0x0, 0x3, 0x646, 0x62c,
+			0x645, 0x0, 0x3, 0x646, 0x62c, 0x645, 0x0, 0x3, 0x646, 0x62c, 0x649, 0x0, 0x3, 0x646, 0x645, 0x64a, 0x0,
+			0x3, 0x646, 0x645, 0x649, 0x0, 0x3, 0x64a, 0x645, 0x645, 0x0, 0x3, 0x64a, 0x645, 0x645, 0x0, 0x3, 0x628,
+			0x62e, 0x64a, 0x0, 0x3, 0x62a, 0x62c, 0x64a, 0x0, 0x3, 0x62a, 0x62c, 0x649, 0x0, 0x3, 0x62a, 0x62e,
+			0x64a, 0x0, 0x3, 0x62a, 0x62e, 0x649, 0x0, 0x3, 0x62a, 0x645, 0x64a, 0x0, 0x3, 0x62a, 0x645, 0x649, 0x0,
+			0x3, 0x62c, 0x645, 0x64a, 0x0, 0x3, 0x62c, 0x62d, 0x649, 0x0, 0x3, 0x62c, 0x645, 0x649, 0x0, 0x3, 0x633,
+			0x62e, 0x649, 0x0, 0x3, 0x635, 0x62d, 0x64a, 0x0, 0x3, 0x634, 0x62d, 0x64a, 0x0, 0x3, 0x636, 0x62d,
+			0x64a, 0x0, 0x3, 0x644, 0x62c, 0x64a, 0x0, 0x3, 0x644, 0x645, 0x64a, 0x0, 0x3, 0x64a, 0x62d, 0x64a, 0x0,
+			0x3, 0x64a, 0x62c, 0x64a, 0x0, 0x3, 0x64a, 0x645, 0x64a, 0x0, 0x3, 0x645, 0x645, 0x64a, 0x0, 0x3, 0x642,
+			0x645, 0x64a, 0x0, 0x3, 0x646, 0x62d, 0x64a, 0x0, 0x3, 0x642, 0x645, 0x62d, 0x0, 0x3, 0x644, 0x62d,
+			0x645, 0x0, 0x3, 0x639, 0x645, 0x64a, 0x0, 0x3, 0x643, 0x645, 0x64a, 0x0, 0x3, 0x646, 0x62c, 0x62d, 0x0,
+			0x3, 0x645, 0x62e, 0x64a, 0x0, 0x3, 0x644, 0x62c, 0x645, 0x0, 0x3, 0x643, 0x645, 0x645, 0x0, 0x3, 0x644,
+			0x62c, 0x645, 0x0, 0x3, 0x646, 0x62c, 0x62d, 0x0, 0x3, 0x62c, 0x62d, 0x64a, 0x0, 0x3, 0x62d, 0x62c,
+			0x64a, 0x0, 0x3, 0x645, 0x62c, 0x64a, 0x0, 0x3, 0x641, 0x645, 0x64a, 0x0, 0x3, 0x628, 0x62d, 0x64a, 0x0,
+			0x3, 0x643, 0x645, 0x645, 0x0, 0x3, 0x639, 0x62c, 0x645, 0x0, 0x3, 0x635, 0x645, 0x645, 0x0, 0x3, 0x633,
+			0x62e, 0x64a, 0x0, 0x3, 0x646, 0x62c, 0x64a, 0x0, 0x3, 0x635, 0x644, 0x6d2, 0x0, 0x3, 0x642, 0x644,
+			0x6d2, 0x0, 0x4, 0x627, 0x644, 0x644, 0x647, 0x0, 0x4, 0x627, 0x643, 0x628, 0x631, 0x0, 0x4, 0x645,
+			0x62d, 0x645, 0x62f, 0x0, 0x4, 0x635, 0x644, 0x639, 0x645, 0x0, 0x4, 0x631, 0x633, 0x648, 0x644, 0x0,
+			0x4, 0x639, 0x644, 0x64a, 0x647, 0x0, 0x4, 0x648, 0x633, 0x644, 0x645, 0x0, 0x3, 0x635, 0x644, 0x649,
+			0x0, 0x12, 0x635, 0x644, 0x649, 0x20, 0x627, 0x644, 0x644, 0x647, 0x20, 0x639, 0x644, 0x64a, 0x647,
+			0x20, 0x648, 0x633, 0x644, 0x645, 0x0, 0x8, 0x62c, 0x644, 0x20, 0x62c, 0x644, 0x627, 0x644, 0x647, 0x0,
+			0x4, 0x631, 0x6cc, 0x627, 0x644, 0x0, 0x1, 0x2c, 0x0, 0x1, 0x3001, 0x0, 0x1, 0x3002, 0x0, 0x1, 0x3a,
+			0x0, 0x1, 0x3b, 0x0, 0x1, 0x21, 0x0, 0x1, 0x3f, 0x0, 0x1, 0x3016, 0x0, 0x1, 0x3017, 0x0, 0x3, 0x2e,
+			0x2e, 0x2e, 0x0, 0x2, 0x2e, 0x2e, 0x0, 0x1, 0x2014, 0x0, 0x1, 0x2013, 0x0, 0x1, 0x5f, 0x0, 0x1, 0x5f,
+			0x0, 0x1, 0x28, 0x0, 0x1, 0x29, 0x0, 0x1, 0x7b, 0x0, 0x1, 0x7d, 0x0, 0x1, 0x3014, 0x0, 0x1, 0x3015, 0x0,
+			0x1, 0x3010, 0x0, 0x1, 0x3011, 0x0, 0x1, 0x300a, 0x0, 0x1, 0x300b, 0x0, 0x1, 0x3008, 0x0, 0x1, 0x3009,
+			0x0, 0x1, 0x300c, 0x0, 0x1, 0x300d, 0x0, 0x1, 0x300e, 0x0, 0x1, 0x300f, 0x0, 0x1, 0x5b, 0x0, 0x1, 0x5d,
+			0x0, 0x2, 0x20, 0x305, 0x0, 0x2, 0x20, 0x305, 0x0, 0x2, 0x20, 0x305, 0x0, 0x2, 0x20, 0x305, 0x0, 0x1,
+			0x5f, 0x0, 0x1, 0x5f, 0x0, 0x1, 0x5f, 0x0, 0x1, 0x2c, 0x0, 0x1, 0x3001, 0x0, 0x1, 0x2e, 0x0, 0x1, 0x3b,
+			0x0, 0x1, 0x3a, 0x0, 0x1, 0x3f, 0x0, 0x1, 0x21, 0x0, 0x1, 0x2014, 0x0, 0x1, 0x28, 0x0, 0x1, 0x29, 0x0,
+			0x1, 0x7b, 0x0, 0x1, 0x7d, 0x0, 0x1, 0x3014, 0x0, 0x1, 0x3015, 0x0, 0x1, 0x23, 0x0, 0x1, 0x26, 0x0, 0x1,
+			0x2a, 0x0, 0x1, 0x2b, 0x0, 0x1, 0x2d, 0x0, 0x1, 0x3c, 0x0, 0x1, 0x3e, 0x0, 0x1, 0x3d, 0x0, 0x1, 0x5c,
+			0x0, 0x1, 0x24, 0x0, 0x1, 0x25, 0x0, 0x1, 0x40, 0x0, 0x2, 0x20, 0x64b, 0x0, 0x2, 0x640, 0x64b, 0x0, 0x2,
+			0x20, 0x64c, 0x0, 0x2, 0x20, 0x64d, 0x0, 0x2, 0x20, 0x64e, 0x0, 0x2, 0x640, 0x64e, 0x0, 0x2, 0x20,
+			0x64f, 0x0, 0x2, 0x640, 0x64f, 0x0, 0x2, 0x20, 0x650, 0x0, 0x2, 0x640, 0x650, 0x0, 0x2, 0x20, 0x651,
+			0x0, 0x2, 0x640, 0x651, 0x0, 0x2, 0x20, 0x652, 0x0, 0x2, 0x640, 0x652, 0x0, 0x1, 0x621, 0x0, 0x2, 0x627,
+			0x653, 0x0, 0x2, 0x627, 0x653, 0x0, 0x2, 0x627, 0x654, 0x0, 0x2, 0x627, 0x654, 0x0, 0x2, 0x648, 0x654,
+			0x0, 0x2, 0x648, 0x654, 0x0, 0x2, 0x627, 0x655, 0x0, 0x2, 0x627, 0x655, 0x0, 0x2, 0x64a, 0x654, 0x0,
+			0x2, 0x64a, 0x654, 0x0, 0x2, 0x64a, 0x654, 0x0, 0x2, 0x64a, 0x654, 0x0, 0x1, 0x627, 0x0, 0x1, 0x627,
+			0x0, 0x1, 0x628, 0x0, 0x1, 0x628, 0x0, 0x1, 0x628, 0x0, 0x1, 0x628, 0x0, 0x1, 0x629, 0x0, 0x1, 0x629,
+			0x0, 0x1, 0x62a, 0x0, 0x1, 0x62a, 0x0, 0x1, 0x62a, 0x0, 0x1, 0x62a, 0x0, 0x1, 0x62b, 0x0, 0x1, 0x62b,
+			0x0, 0x1, 0x62b, 0x0, 0x1, 0x62b, 0x0, 0x1, 0x62c, 0x0, 0x1, 0x62c, 0x0, 0x1, 0x62c, 0x0, 0x1, 0x62c,
+			0x0, 0x1, 0x62d, 0x0, 0x1, 0x62d, 0x0, 0x1, 0x62d, 0x0, 0x1, 0x62d, 0x0, 0x1, 0x62e, 0x0, 0x1, 0x62e,
+			0x0, 0x1, 0x62e, 0x0, 0x1, 0x62e, 0x0, 0x1, 0x62f, 0x0, 0x1, 0x62f, 0x0, 0x1, 0x630, 0x0, 0x1, 0x630,
+			0x0, 0x1, 0x631, 0x0, 0x1, 0x631, 0x0, 0x1, 0x632, 0x0, 0x1, 0x632, 0x0, 0x1, 0x633, 0x0, 0x1, 0x633,
+			0x0, 0x1, 0x633, 0x0, 0x1, 0x633, 0x0, 0x1, 0x634, 0x0, 0x1, 0x634, 0x0, 0x1, 0x634, 0x0, 0x1, 0x634,
+			0x0, 0x1, 0x635, 0x0, 0x1, 0x635, 0x0, 0x1, 0x635, 0x0, 0x1, 0x635, 0x0, 0x1, 0x636, 0x0, 0x1, 0x636,
+			0x0, 0x1, 0x636, 0x0, 0x1, 0x636, 0x0, 0x1, 0x637, 0x0, 0x1, 0x637, 0x0, 0x1, 0x637, 0x0, 0x1, 0x637,
+			0x0, 0x1, 0x638, 0x0, 0x1, 0x638, 0x0, 0x1, 0x638, 0x0, 0x1, 0x638, 0x0, 0x1, 0x639, 0x0, 0x1, 0x639,
+			0x0, 0x1, 0x639, 0x0, 0x1, 0x639, 0x0, 0x1, 0x63a, 0x0, 0x1, 0x63a, 0x0, 0x1, 0x63a, 0x0, 0x1, 0x63a,
+			0x0, 0x1, 0x641, 0x0, 0x1, 0x641, 0x0, 0x1, 0x641, 0x0, 0x1, 0x641, 0x0, 0x1, 0x642, 0x0, 0x1, 0x642,
+			0x0, 0x1, 0x642, 0x0, 0x1, 0x642, 0x0, 0x1, 0x643, 0x0, 0x1, 0x643, 0x0, 0x1, 0x643, 0x0, 0x1, 0x643,
+			0x0, 0x1, 0x644, 0x0, 0x1, 0x644, 0x0, 0x1, 0x644, 0x0, 0x1, 0x644, 0x0, 0x1, 0x645, 0x0, 0x1, 0x645,
+			0x0, 0x1, 0x645, 0x0, 0x1, 0x645, 0x0, 0x1, 0x646, 0x0, 0x1, 0x646, 0x0, 0x1, 0x646, 0x0, 0x1, 0x646,
+			0x0, 0x1, 0x647, 0x0, 0x1, 0x647, 0x0, 0x1, 0x647, 0x0, 0x1, 0x647, 0x0, 0x1, 0x648, 0x0, 0x1, 0x648,
+			0x0, 0x1, 0x649, 0x0, 0x1, 0x649, 0x0, 0x1, 0x64a, 0x0, 0x1, 0x64a, 0x0, 0x1, 0x64a, 0x0, 0x1, 0x64a,
+			0x0, 0x3, 0x644, 0x627, 0x653, 0x0, 0x3, 0x644, 0x627, 0x653, 0x0, 0x3, 0x644, 0x627, 0x654, 0x0, 0x3,
+			0x644, 0x627, 0x654, 0x0, 0x3, 0x644, 0x627, 0x655, 0x0, 0x3, 0x644, 0x627, 0x655, 0x0, 0x2, 0x644,
+			0x627, 0x0, 0x2, 0x644, 0x627, 0x0, 0x1, 0x21, 0x0, 0x1, 0x22, 0x0, 0x1, 0x23, 0x0, 0x1, 0x24, 0x0, 0x1,
+			0x25, 0x0, 0x1, 0x26, 0x0, 0x1, 0x27, 0x0, 0x1, 0x28, 0x0, 0x1, 0x29, 0x0, 0x1, 0x2a, 0x0, 0x1, 0x2b,
+			0x0, 0x1, 0x2c, 0x0, 0x1, 0x2d, 0x0, 0x1, 0x2e, 0x0, 0x1, 0x2f, 0x0, 0x1, 0x30, 0x0, 0x1, 0x31, 0x0,
+			0x1, 0x32, 0x0, 0x1, 0x33, 0x0, 0x1, 0x34, 0x0, 0x1, 0x35, 0x0, 0x1, 0x36, 0x0, 0x1, 0x37, 0x0, 0x1,
+			0x38, 0x0, 0x1, 0x39, 0x0, 0x1, 0x3a, 0x0, 0x1, 0x3b, 0x0, 0x1, 0x3c, 0x0, 0x1, 0x3d, 0x0, 0x1, 0x3e,
+			0x0, 0x1, 0x3f, 0x0, 0x1, 0x40, 0x0, 0x1, 0x41, 0x0, 0x1, 0x42, 0x0, 0x1, 0x43, 0x0, 0x1, 0x44, 0x0,
+			0x1, 0x45, 0x0, 0x1, 0x46, 0x0, 0x1, 0x47, 0x0, 0x1, 0x48, 0x0, 0x1, 0x49, 0x0, 0x1, 0x4a, 0x0, 0x1,
+			0x4b, 0x0, 0x1, 0x4c, 0x0, 0x1, 0x4d, 0x0, 0x1, 0x4e, 0x0, 0x1, 0x4f, 0x0, 0x1, 0x50, 0x0, 0x1, 0x51,
+			0x0, 0x1, 0x52, 0x0, 0x1, 0x53, 0x0, 0x1, 0x54, 0x0, 0x1, 0x55, 0x0, 0x1, 0x56, 0x0, 0x1, 0x57, 0x0,
+			0x1, 0x58, 0x0, 0x1, 0x59, 0x0, 0x1, 0x5a, 0x0, 0x1, 0x5b, 0x0, 0x1, 0x5c, 0x0, 0x1, 0x5d, 0x0, 0x1,
+			0x5e, 0x0, 0x1, 0x5f, 0x0, 0x1, 0x60, 0x0, 0x1, 0x61, 0x0, 0x1, 0x62, 0x0, 0x1, 0x63, 0x0, 0x1, 0x64,
+			0x0, 0x1, 0x65, 0x0, 0x1, 0x66, 0x0, 0x1, 0x67, 0x0, 0x1, 0x68, 0x0, 0x1, 0x69, 0x0, 0x1, 0x6a, 0x0,
+			0x1, 0x6b, 0x0, 0x1, 0x6c, 0x0, 0x1, 0x6d, 0x0, 0x1, 0x6e, 0x0, 0x1, 0x6f, 0x0, 0x1, 0x70, 0x0, 0x1,
+			0x71, 0x0, 0x1, 0x72, 0x0, 0x1, 0x73, 0x0, 0x1, 0x74, 0x0, 0x1, 0x75, 0x0, 0x1, 0x76, 0x0, 0x1, 0x77,
+			0x0, 0x1, 0x78, 0x0, 0x1, 0x79, 0x0, 0x1, 0x7a, 0x0, 0x1, 0x7b, 0x0, 0x1, 0x7c, 0x0, 0x1, 0x7d, 0x0,
+			0x1, 0x7e, 0x0, 0x1, 0x2985, 0x0, 0x1, 0x2986, 0x0, 0x1, 0x3002, 0x0, 0x1, 0x300c, 0x0, 0x1, 0x300d,
+			0x0, 0x1, 0x3001, 0x0, 0x1, 0x30fb, 0x0, 0x1, 0x30f2, 0x0, 0x1, 0x30a1, 0x0, 0x1, 0x30a3, 0x0, 0x1,
+			0x30a5, 0x0, 0x1, 0x30a7, 0x0, 0x1, 0x30a9, 0x0, 0x1, 0x30e3, 0x0, 0x1, 0x30e5, 0x0, 0x1, 0x30e7, 0x0,
+			0x1, 0x30c3, 0x0, 0x1, 0x30fc, 0x0, 0x1, 0x30a2, 0x0, 0x1, 0x30a4, 0x0, 0x1, 0x30a6, 0x0, 0x1, 0x30a8,
+			0x0, 0x1, 0x30aa, 0x0, 0x1, 0x30ab, 0x0, 0x1, 0x30ad, 0x0, 0x1, 0x30af, 0x0, 0x1, 0x30b1, 0x0, 0x1,
+			0x30b3, 0x0, 0x1, 0x30b5, 0x0, 0x1, 0x30b7, 0x0, 0x1, 0x30b9, 0x0, 0x1, 0x30bb, 0x0, 0x1, 0x30bd, 0x0,
+			0x1, 0x30bf, 0x0, 0x1, 0x30c1, 0x0, 0x1, 0x30c4, 0x0, 0x1, 0x30c6, 0x0, 0x1, 0x30c8, 0x0, 0x1, 0x30ca,
+			0x0, 0x1, 0x30cb, 0x0, 0x1, 0x30cc, 0x0, 0x1, 0x30cd, 0x0, 0x1, 0x30ce, 0x0, 0x1, 0x30cf, 0x0, 0x1,
+			0x30d2, 0x0, 0x1, 0x30d5, 0x0, 0x1, 0x30d8, 0x0, 0x1, 0x30db, 0x0, 0x1, 0x30de, 0x0, 0x1, 0x30df, 0x0,
+			0x1, 0x30e0, 0x0, 0x1, 0x30e1, 0x0, 0x1, 0x30e2, 0x0, 0x1, 0x30e4, 0x0, 0x1, 0x30e6, 0x0, 0x1, 0x30e8,
+			0x0, 0x1, 0x30e9, 0x0, 0x1, 0x30ea, 0x0, 0x1, 0x30eb, 0x0, 0x1, 0x30ec, 0x0, 0x1, 0x30ed, 0x0, 0x1,
+			0x30ef, 0x0, 0x1, 0x30f3, 0x0, 0x1, 0x3099, 0x0, 0x1, 0x309a, 0x0, 0x1, 0x1160, 0x0, 0x1, 0x1100, 0x0,
+			0x1, 0x1101, 0x0, 0x1, 0x11aa, 0x0, 0x1, 0x1102, 0x0, 0x1, 0x11ac, 0x0, 0x1, 0x11ad, 0x0, 0x1, 0x1103,
+			0x0, 0x1, 0x1104, 0x0, 0x1, 0x1105, 0x0, 0x1, 0x11b0, 0x0, 0x1, 0x11b1, 0x0, 0x1, 0x11b2, 0x0, 0x1,
+			0x11b3, 0x0, 0x1, 0x11b4, 0x0, 0x1, 0x11b5, 0x0, 0x1, 0x111a, 0x0, 0x1, 0x1106, 0x0, 0x1, 0x1107, 0x0,
+			0x1, 0x1108, 0x0, 0x1, 0x1121, 0x0, 0x1, 0x1109, 0x0, 0x1, 0x110a, 0x0, 0x1, 0x110b, 0x0, 0x1, 0x110c,
+			0x0, 0x1, 0x110d, 0x0, 0x1, 0x110e, 0x0, 0x1, 0x110f, 0x0, 0x1, 0x1110, 0x0, 0x1, 0x1111, 0x0, 0x1,
+			0x1112, 0x0, 0x1, 0x1161, 0x0, 0x1, 0x1162, 0x0, 0x1, 0x1163, 0x0, 0x1, 0x1164, 0x0, 0x1, 0x1165, 0x0,
+			0x1, 0x1166, 0x0, 0x1, 0x1167, 0x0, 0x1, 0x1168, 0x0, 0x1, 0x1169, 0x0, 0x1, 0x116a, 0x0, 0x1, 0x116b,
+			0x0, 0x1, 0x116c, 0x0, 0x1, 0x116d, 0x0, 0x1, 0x116e, 0x0, 0x1, 0x116f, 0x0, 0x1, 0x1170, 0x0, 0x1,
+			0x1171, 0x0, 0x1, 0x1172, 0x0, 0x1, 0x1173, 0x0, 0x1, 0x1174, 0x0, 0x1, 0x1175, 0x0, 0x1, 0xa2, 0x0,
+			0x1, 0xa3, 0x0, 0x1, 0xac, 0x0, 0x2, 0x20, 0x304, 0x0, 0x1, 0xa6, 0x0, 0x1, 0xa5, 0x0, 0x1, 0x20a9, 0x0,
+			0x1, 0x2502, 0x0, 0x1, 0x2190, 0x0, 0x1, 0x2191, 0x0, 0x1, 0x2192, 0x0, 0x1, 0x2193, 0x0, 0x1, 0x25a0,
+			0x0, 0x1, 0x25cb, 0x0, 0x1, 0x2d0, 0x0, 0x1, 0x2d1, 0x0, 0x1, 0xe6, 0x0, 0x1, 0x299, 0x0, 0x1, 0x253,
+			0x0, 0x1, 0x2a3, 0x0, 0x1, 0xab66, 0x0, 0x1, 0x2a5, 0x0, 0x1, 0x2a4, 0x0, 0x1, 0x256, 0x0, 0x1, 0x257,
+			0x0, 0x1, 0x1d91, 0x0, 0x1, 0x258, 0x0, 0x1, 0x25e, 0x0, 0x1, 0x2a9, 0x0, 0x1, 0x264, 0x0, 0x1, 0x262,
+			0x0, 0x1, 0x260, 0x0, 0x1, 0x29b, 0x0, 0x1, 0x127, 0x0, 0x1, 0x29c, 0x0, 0x1, 0x267, 0x0, 0x1, 0x284,
+			0x0, 0x1, 0x2aa, 0x0, 0x1, 0x2ab, 0x0, 0x1, 0x26c, 0x0, 0x1, 0x1df04, 0x0, 0x1, 0xa78e, 0x0, 0x1, 0x26e,
+			0x0, 0x1, 0x1df05, 0x0, 0x1, 0x28e, 0x0, 0x1, 0x1df06, 0x0, 0x1, 0xf8, 0x0, 0x1, 0x276, 0x0, 0x1, 0x277,
+			0x0, 0x1, 0x71, 0x0, 0x1, 0x27a, 0x0, 0x1, 0x1df08, 0x0, 0x1, 0x27d, 0x0, 0x1, 0x27e, 0x0, 0x1, 0x280,
+			0x0, 0x1, 0x2a8, 0x0, 0x1, 0x2a6, 0x0, 0x1, 0xab67, 0x0, 0x1, 0x2a7, 0x0, 0x1, 0x288, 0x0, 0x1, 0x2c71,
+			0x0, 0x1, 0x28f, 0x0, 0x1, 0x2a1, 0x0, 0x1, 0x2a2, 0x0, 0x1, 0x298, 0x0, 0x1, 0x1c0, 0x0, 0x1, 0x1c1,
+			0x0, 0x1, 0x1c2, 0x0, 0x1, 0x1df0a, 0x0, 0x1, 0x1df1e, 0x2, 0x11099, 0x110ba, 0x0, 0x2, 0x1109b,
+			0x110ba, 0x0, 0x2, 0x110a5, 0x110ba, 0x0, 0x2, 0x11131, 0x11127, 0x0, 0x2, 0x11132, 0x11127, 0x0, 0x2,
+			0x11347, 0x1133e, 0x0, 0x2, 0x11347, 0x11357, 0x0, 0x2, 0x114b9, 0x114ba, 0x0, 0x2, 0x114b9, 0x114b0,
+			0x0, 0x2, 0x114b9, 0x114bd, 0x0, 0x2, 0x115b8, 0x115af, 0x0, 0x2, 0x115b9, 0x115af, 0x0, 0x2, 0x11935,
+			0x11930, 0x0, 0x2, 0x1d157, 0x1d165, 0x0, 0x2, 0x1d158, 0x1d165, 0x0, 0x3, 0x1d158, 0x1d165, 0x1d16e,
+			0x0, 0x3, 0x1d158, 0x1d165, 0x1d16f, 0x0, 0x3, 0x1d158, 0x1d165, 0x1d170, 0x0, 0x3, 0x1d158, 0x1d165,
+			0x1d171, 0x0, 0x3, 0x1d158, 0x1d165, 0x1d172, 0x0, 0x2, 0x1d1b9, 0x1d165, 0x0, 0x2, 0x1d1ba, 0x1d165,
+			0x0, 0x3, 0x1d1b9, 0x1d165, 0x1d16e, 0x0, 0x3, 0x1d1ba, 0x1d165, 0x1d16e, 0x0, 0x3, 0x1d1b9, 0x1d165,
+			0x1d16f, 0x0, 0x3, 0x1d1ba, 0x1d165, 0x1d16f, 0x0, 0x0, 0x1, 0x41, 0x0, 0x1, 0x42, 0x0, 0x1, 0x43, 0x0,
+			0x1, 0x44, 0x0, 0x1, 0x45, 0x0, 0x1, 0x46, 0x0, 0x1, 0x47, 0x0, 0x1, 0x48, 0x0, 0x1, 0x49, 0x0, 0x1,
+			0x4a, 0x0, 0x1, 0x4b, 0x0, 0x1, 0x4c, 0x0, 0x1, 0x4d, 0x0, 0x1, 0x4e, 0x0, 0x1, 0x4f, 0x0, 0x1, 0x50,
+			0x0, 0x1, 0x51, 0x0, 0x1, 0x52, 0x0, 0x1, 0x53, 0x0, 0x1, 0x54, 0x0, 0x1, 0x55, 0x0, 0x1, 0x56, 0x0,
+			0x1, 0x57, 0x0, 0x1, 0x58, 0x0, 0x1, 0x59, 0x0, 0x1, 0x5a, 0x0, 0x1, 0x61, 0x0, 0x1, 0x62, 0x0, 0x1,
+			0x63, 0x0, 0x1, 0x64, 0x0, 0x1, 0x65, 0x0, 0x1, 0x66, 0x0, 0x1, 0x67, 0x0, 0x1, 0x68, 0x0, 0x1, 0x69,
+			0x0, 0x1, 0x6a, 0x0, 0x1, 0x6b, 0x0, 0x1, 0x6c, 0x0, 0x1, 0x6d, 0x0, 0x1, 0x6e, 0x0, 0x1, 0x6f, 0x0,
+			0x1, 0x70, 0x0, 0x1, 0x71, 0x0, 0x1, 0x72, 0x0, 0x1, 0x73, 0x0, 0x1, 0x74, 0x0, 0x1, 0x75, 0x0, 0x1,
+			0x76, 0x0, 0x1, 0x77, 0x0, 0x1, 0x78, 0x0, 0x1, 0x79, 0x0, 0x1, 0x7a, 0x0, 0x1, 0x41, 0x0, 0x1, 0x42,
+			0x0, 0x1, 0x43, 0x0, 0x1, 0x44, 0x0, 0x1, 0x45, 0x0, 0x1, 0x46, 0x0, 0x1, 0x47, 0x0, 0x1, 0x48, 0x0,
+			0x1, 0x49, 0x0, 0x1, 0x4a, 0x0, 0x1, 0x4b, 0x0, 0x1, 0x4c, 0x0, 0x1, 0x4d, 0x0, 0x1, 0x4e, 0x0, 0x1,
+			0x4f, 0x0, 0x1, 0x50, 0x0, 0x1, 0x51, 0x0, 0x1, 0x52, 0x0, 0x1, 0x53, 0x0, 0x1, 0x54, 0x0, 0x1, 0x55,
+			0x0, 0x1, 0x56, 0x0, 0x1, 0x57, 0x0, 0x1, 0x58, 0x0, 0x1, 0x59, 0x0, 0x1, 0x5a, 0x0, 0x1, 0x61, 0x0,
+			0x1, 0x62, 0x0, 0x1, 0x63, 0x0, 0x1, 0x64, 0x0, 0x1, 0x65, 0x0, 0x1, 0x66, 0x0, 0x1, 0x67, 0x0, 0x1,
+			0x69, 0x0, 0x1, 0x6a, 0x0, 0x1, 0x6b, 0x0, 0x1, 0x6c, 0x0, 0x1, 0x6d, 0x0, 0x1, 0x6e, 0x0, 0x1, 0x6f,
+			0x0, 0x1, 0x70, 0x0, 0x1, 0x71, 0x0, 0x1, 0x72, 0x0, 0x1, 0x73, 0x0, 0x1, 0x74, 0x0, 0x1, 0x75, 0x0,
+			0x1, 0x76, 0x0, 0x1, 0x77, 0x0, 0x1, 0x78, 0x0, 0x1, 0x79, 0x0, 0x1, 0x7a, 0x0, 0x1, 0x41, 0x0, 0x1,
+			0x42, 0x0, 0x1, 0x43, 0x0, 0x1, 0x44, 0x0, 0x1, 0x45, 0x0, 0x1, 0x46, 0x0, 0x1, 0x47, 0x0, 0x1, 0x48,
+			0x0, 0x1, 0x49, 0x0, 0x1, 0x4a, 0x0, 0x1, 0x4b, 0x0, 0x1, 0x4c, 0x0, 0x1, 0x4d, 0x0, 0x1, 0x4e, 0x0,
+			0x1, 0x4f, 0x0, 0x1, 0x50, 0x0, 0x1, 0x51, 0x0, 0x1, 0x52, 0x0, 0x1, 0x53, 0x0, 0x1, 0x54, 0x0, 0x1,
+			0x55, 0x0, 0x1, 0x56, 0x0, 0x1, 0x57, 0x0, 0x1, 0x58, 0x0, 0x1, 0x59, 0x0, 0x1, 0x5a, 0x0, 0x1, 0x61,
+			0x0, 0x1, 0x62, 0x0, 0x1, 0x63, 0x0, 0x1, 0x64, 0x0, 0x1, 0x65, 0x0, 0x1, 0x66, 0x0, 0x1, 0x67, 0x0,
+			0x1, 0x68, 0x0, 0x1, 0x69, 0x0, 0x1, 0x6a, 0x0, 0x1, 0x6b, 0x0, 0x1, 0x6c, 0x0, 0x1, 0x6d, 0x0, 0x1,
+			0x6e, 0x0, 0x1, 0x6f, 0x0, 0x1, 0x70, 0x0, 0x1, 0x71, 0x0, 0x1, 0x72, 0x0, 0x1, 0x73, 0x0, 0x1, 0x74,
+			0x0, 0x1, 0x75, 0x0, 0x1, 0x76, 0x0, 0x1, 0x77, 0x0, 0x1, 0x78, 0x0, 0x1, 0x79, 0x0, 0x1, 0x7a, 0x0,
+			0x1, 0x41, 0x0, 0x1, 0x43, 0x0, 0x1, 0x44, 0x0, 0x1, 0x47, 0x0, 0x1, 0x4a, 0x0, 0x1, 0x4b, 0x0, 0x1,
+			0x4e, 0x0, 0x1, 0x4f, 0x0, 0x1, 0x50, 0x0, 0x1, 0x51, 0x0, 0x1, 0x53, 0x0, 0x1, 0x54, 0x0, 0x1, 0x55,
+			0x0, 0x1, 0x56, 0x0, 0x1, 0x57, 0x0, 0x1, 0x58, 0x0, 0x1, 0x59, 0x0, 0x1, 0x5a, 0x0, 0x1, 0x61, 0x0,
+			0x1, 0x62, 0x0, 0x1, 0x63, 0x0, 0x1, 0x64, 0x0, 0x1, 0x66, 0x0, 0x1, 0x68, 0x0, 0x1, 0x69, 0x0, 0x1,
+			0x6a, 0x0, 0x1, 0x6b, 0x0, 0x1, 0x6c, 0x0, 0x1, 0x6d, 0x0, 0x1, 0x6e, 0x0, 0x1, 0x70, 0x0, 0x1, 0x71,
+			0x0, 0x1, 0x72, 0x0, 0x1, 0x73, 0x0, 0x1, 0x74, 0x0, 0x1, 0x75, 0x0, 0x1, 0x76, 0x0, 0x1, 0x77, 0x0,
+			0x1, 0x78, 0x0, 0x1, 0x79, 0x0, 0x1, 0x7a, 0x0, 0x1, 0x41, 0x0, 0x1, 0x42, 0x0, 0x1, 0x43, 0x0, 0x1,
+			0x44, 0x0, 0x1, 0x45, 0x0, 0x1, 0x46, 0x0, 0x1, 0x47, 0x0, 0x1, 0x48, 0x0, 0x1, 0x49, 0x0, 0x1, 0x4a,
+			0x0, 0x1, 0x4b, 0x0, 0x1, 0x4c, 0x0, 0x1, 0x4d, 0x0, 0x1, 0x4e, 0x0, 0x1, 0x4f, 0x0, 0x1, 0x50, 0x0,
+			0x1, 0x51, 0x0, 0x1, 0x52, 0x0, 0x1, 0x53, 0x0, 0x1, 0x54, 0x0, 0x1, 0x55, 0x0, 0x1, 0x56, 0x0, 0x1,
+			0x57, 0x0, 0x1, 0x58, 0x0, 0x1, 0x59, 0x0, 0x1, 0x5a, 0x0, 0x1, 0x61, 0x0, 0x1, 0x62, 0x0, 0x1, 0x63,
+			0x0, 0x1, 0x64, 0x0, 0x1, 0x65, 0x0, 0x1, 0x66, 0x0, 0x1, 0x67, 0x0, 0x1, 0x68, 0x0, 0x1, 0x69, 0x0,
+			0x1, 0x6a, 0x0, 0x1, 0x6b, 0x0, 0x1, 0x6c, 0x0, 0x1, 0x6d, 0x0, 0x1, 0x6e, 0x0, 0x1, 0x6f, 0x0, 0x1,
+			0x70, 0x0, 0x1, 0x71, 0x0, 0x1, 0x72, 0x0, 0x1, 0x73, 0x0, 0x1, 0x74, 0x0, 0x1, 0x75, 0x0, 0x1, 0x76,
+			0x0, 0x1, 0x77, 0x0, 0x1, 0x78, 0x0, 0x1, 0x79, 0x0, 0x1, 0x7a, 0x0, 0x1, 0x41, 0x0, 0x1, 0x42, 0x0,
+			0x1, 0x44, 0x0, 0x1, 0x45, 0x0, 0x1, 0x46, 0x0, 0x1, 0x47, 0x0, 0x1, 0x4a, 0x0, 0x1, 0x4b, 0x0, 0x1,
+			0x4c, 0x0, 0x1, 0x4d, 0x0, 0x1, 0x4e, 0x0, 0x1, 0x4f, 0x0, 0x1, 0x50, 0x0, 0x1, 0x51, 0x0, 0x1, 0x53,
+			0x0, 0x1, 0x54, 0x0, 0x1, 0x55, 0x0, 0x1, 0x56, 0x0, 0x1, 0x57, 0x0, 0x1, 0x58, 0x0, 0x1, 0x59, 0x0,
+			0x1, 0x61, 0x0, 0x1, 0x62, 0x0, 0x1, 0x63, 0x0, 0x1, 0x64, 0x0, 0x1, 0x65, 0x0, 0x1, 0x66, 0x0, 0x1,
+			0x67, 0x0, 0x1, 0x68, 0x0, 0x1, 0x69, 0x0, 0x1, 0x6a, 0x0, 0x1, 0x6b, 0x0, 0x1, 0x6c, 0x0, 0x1, 0x6d,
+			0x0, 0x1, 0x6e, 0x0, 0x1, 0x6f, 0x0, 0x1, 0x70, 0x0, 0x1, 0x71, 0x0, 0x1, 0x72, 0x0, 0x1, 0x73, 0x0,
+			0x1, 0x74, 0x0, 0x1, 0x75, 0x0, 0x1, 0x76, 0x0, 0x1, 0x77, 0x0, 0x1, 0x78, 0x0, 0x1, 0x79, 0x0, 0x1,
+			0x7a, 0x0, 0x1, 0x41, 0x0, 0x1, 0x42, 0x0, 0x1, 0x44, 0x0, 0x1, 0x45, 0x0, 0x1, 0x46, 0x0, 0x1, 0x47,
+			0x0, 0x1, 0x49, 0x0, 0x1, 0x4a, 0x0, 0x1, 0x4b, 0x0, 0x1, 0x4c, 0x0, 0x1, 0x4d, 0x0, 0x1, 0x4f, 0x0,
+			0x1, 0x53, 0x0, 0x1, 0x54, 0x0, 0x1, 0x55, 0x0, 0x1, 0x56, 0x0, 0x1, 0x57, 0x0, 0x1, 0x58, 0x0, 0x1,
+			0x59, 0x0, 0x1, 0x61, 0x0, 0x1, 0x62, 0x0, 0x1, 0x63, 0x0, 0x1, 0x64, 0x0, 0x1, 0x65, 0x0, 0x1, 0x66,
+			0x0, 0x1, 0x67, 0x0, 0x1, 0x68, 0x0, 0x1, 0x69, 0x0, 0x1, 0x6a, 0x0, 0x1, 0x6b, 0x0, 0x1, 0x6c, 0x0,
+			0x1, 0x6d, 0x0, 0x1, 0x6e, 0x0, 0x1, 0x6f, 0x0, 0x1, 0x70, 0x0, 0x1, 0x71, 0x0, 0x1, 0x72, 0x0, 0x1,
+			0x73, 0x0, 0x1, 0x74, 0x0, 0x1, 0x75, 0x0, 0x1, 0x76, 0x0, 0x1, 0x77, 0x0, 0x1, 0x78, 0x0, 0x1, 0x79,
+			0x0, 0x1, 0x7a, 0x0, 0x1, 0x41, 0x0, 0x1, 0x42, 0x0, 0x1, 0x43, 0x0, 0x1, 0x44, 0x0, 0x1, 0x45, 0x0,
+			0x1, 0x46, 0x0, 0x1, 0x47, 0x0, 0x1, 0x48, 0x0, 0x1, 0x49, 0x0, 0x1, 0x4a, 0x0, 0x1, 0x4b, 0x0, 0x1,
+			0x4c, 0x0, 0x1, 0x4d, 0x0, 0x1, 0x4e, 0x0, 0x1, 0x4f, 0x0, 0x1, 0x50, 0x0, 0x1, 0x51, 0x0, 0x1, 0x52,
+			0x0, 0x1, 0x53, 0x0, 0x1, 0x54, 0x0, 0x1, 0x55, 0x0, 0x1, 0x56, 0x0, 0x1, 0x57, 0x0, 0x1, 0x58, 0x0,
+			0x1, 0x59, 0x0, 0x1, 0x5a, 0x0, 0x1, 0x61, 0x0, 0x1, 0x62, 0x0, 0x1, 0x63, 0x0, 0x1, 0x64, 0x0, 0x1,
+			0x65, 0x0, 0x1, 0x66, 0x0, 0x1, 0x67, 0x0, 0x1, 0x68, 0x0, 0x1, 0x69, 0x0, 0x1, 0x6a, 0x0, 0x1, 0x6b,
+			0x0, 0x1, 0x6c, 0x0, 0x1, 0x6d, 0x0, 0x1, 0x6e, 0x0, 0x1, 0x6f, 0x0, 0x1, 0x70, 0x0, 0x1, 0x71, 0x0,
+			0x1, 0x72, 0x0, 0x1, 0x73, 0x0, 0x1, 0x74, 0x0, 0x1, 0x75, 0x0, 0x1, 0x76, 0x0, 0x1, 0x77, 0x0, 0x1,
+			0x78, 0x0, 0x1, 0x79, 0x0, 0x1, 0x7a, 0x0, 0x1, 0x41, 0x0, 0x1, 0x42, 0x0, 0x1, 0x43, 0x0, 0x1, 0x44,
+			0x0, 0x1, 0x45, 0x0, 0x1, 0x46, 0x0, 0x1, 0x47, 0x0, 0x1, 0x48, 0x0, 0x1, 0x49, 0x0, 0x1, 0x4a, 0x0,
+			0x1, 0x4b, 0x0, 0x1, 0x4c, 0x0, 0x1, 0x4d, 0x0, 0x1, 0x4e, 0x0, 0x1, 0x4f, 0x0, 0x1, 0x50, 0x0, 0x1,
+			0x51, 0x0, 0x1, 0x52, 0x0, 0x1, 0x53, 0x0, 0x1, 0x54, 0x0, 0x1, 0x55, 0x0, 0x1, 0x56, 0x0, 0x1, 0x57,
+			0x0, 0x1, 0x58, 0x0, 0x1, 0x59, 0x0, 0x1, 0x5a, 0x0, 0x1, 0x61, 0x0, 0x1, 0x62, 0x0, 0x1, 0x63, 0x0,
+			0x1, 0x64, 0x0, 0x1, 0x65, 0x0, 0x1, 0x66, 0x0, 0x1, 0x67, 0x0, 0x1, 0x68, 0x0, 0x1, 0x69, 0x0, 0x1,
+			0x6a, 0x0, 0x1, 0x6b, 0x0, 0x1, 0x6c, 0x0, 0x1, 0x6d, 0x0, 0x1, 0x6e, 0x0, 0x1, 0x6f, 0x0, 0x1, 0x70,
+			0x0, 0x1, 0x71, 0x0, 0x1, 0x72, 0x0, 0x1, 0x73, 0x0, 0x1, 0x74, 0x0, 0x1, 0x75, 0x0, 0x1, 0x76, 0x0,
+			0x1, 0x77, 0x0, 0x1, 0x78, 0x0, 0x1, 0x79, 0x0, 0x1, 0x7a, 0x0, 0x1, 0x41, 0x0, 0x1, 0x42, 0x0, 0x1,
+			0x43, 0x0, 0x1, 0x44, 0x0, 0x1, 0x45, 0x0, 0x1, 0x46, 0x0, 0x1, 0x47, 0x0, 0x1, 0x48, 0x0, 0x1, 0x49,
+			0x0, 0x1, 0x4a, 0x0, 0x1, 0x4b, 0x0, 0x1, 0x4c, 0x0, 0x1, 0x4d, 0x0, 0x1, 0x4e, 0x0, 0x1, 0x4f, 0x0,
+			0x1, 0x50, 0x0, 0x1, 0x51, 0x0, 0x1, 0x52, 0x0, 0x1, 0x53, 0x0, 0x1, 0x54, 0x0, 0x1, 0x55, 0x0, 0x1,
+			0x56, 0x0, 0x1, 0x57, 0x0, 0x1, 0x58, 0x0, 0x1, 0x59, 0x0, 0x1, 0x5a, 0x0, 0x1, 0x61, 0x0, 0x1, 0x62,
+			0x0, 0x1, 0x63, 0x0, 0x1, 0x64, 0x0, 0x1, 0x65, 0x0, 0x1, 0x66, 0x0, 0x1, 0x67, 0x0, 0x1, 0x68, 0x0,
+			0x1, 0x69, 0x0, 0x1, 0x6a, 0x0, 0x1, 0x6b, 0x0, 0x1, 0x6c, 0x0, 0x1, 0x6d, 0x0, 0x1, 0x6e, 0x0, 0x1,
+			0x6f, 0x0, 0x1, 0x70, 0x0, 0x1, 0x71, 0x0, 0x1, 0x72, 0x0, 0x1, 0x73, 0x0, 0x1, 0x74, 0x0, 0x1, 0x75,
+			0x0, 0x1, 0x76, 0x0, 0x1, 0x77, 0x0, 0x1, 0x78, 0x0, 0x1, 0x79, 0x0, 0x1, 0x7a, 0x0, 0x1, 0x41, 0x0,
+			0x1, 0x42, 0x0, 0x1, 0x43, 0x0, 0x1, 0x44, 0x0, 0x1, 0x45, 0x0, 0x1, 0x46, 0x0, 0x1, 0x47, 0x0, 0x1,
+			0x48, 0x0, 0x1, 0x49, 0x0, 0x1, 0x4a, 0x0, 0x1, 0x4b, 0x0, 0x1, 0x4c, 0x0, 0x1, 0x4d, 0x0, 0x1, 0x4e,
+			0x0, 0x1, 0x4f, 0x0, 0x1, 0x50, 0x0, 0x1, 0x51, 0x0, 0x1, 0x52, 0x0, 0x1, 0x53, 0x0, 0x1, 0x54, 0x0,
+			0x1, 0x55, 0x0, 0x1, 0x56, 0x0, 0x1, 0x57, 0x0, 0x1, 0x58, 0x0, 0x1, 0x59, 0x0, 0x1, 0x5a, 0x0, 0x1,
+			0x61, 0x0, 0x1, 0x62, 0x0, 0x1, 0x63, 0x0, 0x1, 0x64, 0x0, 0x1, 0x65, 0x0, 0x1, 0x66, 0x0, 0x1, 0x67,
+			0x0, 0x1, 0x68, 0x0, 0x1, 0x69, 0x0, 0x1, 0x6a, 0x0, 0x1, 0x6b, 0x0, 0x1, 0x6c, 0x0, 0x1, 0x6d, 0x0,
+			0x1, 0x6e, 0x0, 0x1, 0x6f, 0x0, 0x1, 0x70, 0x0, 0x1, 0x71, 0x0, 0x1, 0x72, 0x0, 0x1, 0x73, 0x0, 0x1,
+			0x74, 0x0, 0x1, 0x75, 0x0, 0x1, 0x76, 0x0, 0x1, 0x77, 0x0, 0x1, 0x78, 0x0, 0x1, 0x79, 0x0, 0x1, 0x7a,
+			0x0, 0x1, 0x41, 0x0, 0x1, 0x42, 0x0, 0x1, 0x43, 0x0, 0x1, 0x44, 0x0, 0x1, 0x45, 0x0, 0x1, 0x46, 0x0,
+			0x1, 0x47, 0x0, 0x1, 0x48, 0x0, 0x1, 0x49, 0x0, 0x1, 0x4a, 0x0, 0x1, 0x4b, 0x0, 0x1, 0x4c, 0x0, 0x1,
+			0x4d, 0x0, 0x1, 0x4e, 0x0, 0x1, 0x4f, 0x0, 0x1, 0x50, 0x0, 0x1, 0x51, 0x0, 0x1, 0x52, 0x0, 0x1, 0x53,
+			0x0, 0x1, 0x54, 0x0, 0x1, 0x55, 0x0, 0x1, 0x56, 0x0, 0x1, 0x57, 0x0, 0x1, 0x58, 0x0, 0x1, 0x59, 0x0,
+			0x1, 0x5a, 0x0, 0x1, 0x61, 0x0, 0x1, 0x62, 0x0, 0x1, 0x63, 0x0, 0x1, 0x64, 0x0, 0x1, 0x65, 0x0, 0x1,
+			0x66, 0x0, 0x1, 0x67, 0x0, 0x1, 0x68, 0x0, 0x1, 0x69, 0x0, 0x1, 0x6a, 0x0, 0x1, 0x6b, 0x0, 0x1, 0x6c,
+			0x0, 0x1, 0x6d, 0x0, 0x1, 0x6e, 0x0, 0x1, 0x6f, 0x0, 0x1, 0x70, 0x0, 0x1, 0x71, 0x0, 0x1, 0x72, 0x0,
+			0x1, 0x73, 0x0, 0x1, 0x74, 0x0, 0x1, 0x75, 0x0, 0x1, 0x76, 0x0, 0x1, 0x77, 0x0, 0x1, 0x78, 0x0, 0x1,
+			0x79, 0x0, 0x1, 0x7a, 0x0, 0x1, 0x41, 0x0, 0x1, 0x42, 0x0, 0x1, 0x43, 0x0, 0x1, 0x44, 0x0, 0x1, 0x45,
+			0x0, 0x1, 0x46, 0x0, 0x1, 0x47, 0x0, 0x1, 0x48, 0x0, 0x1, 0x49, 0x0, 0x1, 0x4a, 0x0, 0x1, 0x4b, 0x0,
+			0x1, 0x4c, 0x0, 0x1, 0x4d, 0x0, 0x1, 0x4e, 0x0, 0x1, 0x4f, 0x0, 0x1, 0x50, 0x0, 0x1, 0x51, 0x0, 0x1,
+			0x52, 0x0, 0x1, 0x53, 0x0, 0x1, 0x54, 0x0, 0x1, 0x55, 0x0, 0x1, 0x56, 0x0, 0x1, 0x57, 0x0, 0x1, 0x58,
+			0x0, 0x1, 0x59, 0x0, 0x1, 0x5a, 0x0, 0x1, 0x61, 0x0, 0x1, 0x62, 0x0, 0x1, 0x63, 0x0, 0x1, 0x64, 0x0,
+			0x1, 0x65, 0x0, 0x1, 0x66, 0x0, 0x1, 0x67, 0x0, 0x1, 0x68, 0x0, 0x1, 0x69, 0x0, 0x1, 0x6a, 0x0, 0x1,
+			0x6b, 0x0, 0x1, 0x6c, 0x0, 0x1, 0x6d, 0x0, 0x1, 0x6e, 0x0, 0x1, 0x6f, 0x0, 0x1, 0x70, 0x0, 0x1, 0x71,
+			0x0, 0x1, 0x72, 0x0, 0x1, 0x73, 0x0, 0x1, 0x74, 0x0, 0x1, 0x75, 0x0, 0x1, 0x76, 0x0, 0x1, 0x77, 0x0,
+			0x1, 0x78, 0x0, 0x1, 0x79, 0x0, 0x1, 0x7a, 0x0, 0x1, 0x131, 0x0, 0x1, 0x237, 0x0, 0x1, 0x391, 0x0, 0x1,
+			0x392, 0x0, 0x1, 0x393, 0x0, 0x1, 0x394, 0x0, 0x1, 0x395, 0x0, 0x1, 0x396, 0x0, 0x1, 0x397, 0x0, 0x1,
+			0x398, 0x0, 0x1, 0x399, 0x0, 0x1, 0x39a, 0x0, 0x1, 0x39b, 0x0, 0x1, 0x39c, 0x0, 0x1, 0x39d, 0x0, 0x1,
+			0x39e, 0x0, 0x1, 0x39f, 0x0, 0x1, 0x3a0, 0x0, 0x1, 0x3a1, 0x0, 0x1, 0x398, 0x0, 0x1, 0x3a3, 0x0, 0x1,
+			0x3a4, 0x0, 0x1, 0x3a5, 0x0, 0x1, 0x3a6, 0x0, 0x1, 0x3a7, 0x0, 0x1, 0x3a8, 0x0, 0x1, 0x3a9, 0x0, 0x1,
+			0x2207, 0x0, 0x1, 0x3b1, 0x0, 0x1, 0x3b2, 0x0, 0x1, 0x3b3, 0x0, 0x1, 0x3b4, 0x0, 0x1, 0x3b5, 0x0, 0x1,
+			0x3b6, 0x0, 0x1, 0x3b7, 0x0, 0x1, 0x3b8, 0x0, 0x1, 0x3b9, 0x0, 0x1, 0x3ba, 0x0, 0x1, 0x3bb, 0x0, 0x1,
+			0x3bc, 0x0, 0x1, 0x3bd, 0x0, 0x1, 0x3be, 0x0, 0x1, 0x3bf, 0x0, 0x1, 0x3c0, 0x0, 0x1, 0x3c1, 0x0, 0x1,
+			0x3c2, 0x0, 0x1, 0x3c3, 0x0, 0x1, 0x3c4, 0x0, 0x1, 0x3c5, 0x0, 0x1, 0x3c6, 0x0, 0x1, 0x3c7, 0x0, 0x1,
+			0x3c8, 0x0, 0x1, 0x3c9, 0x0, 0x1, 0x2202, 0x0, 0x1, 0x3b5, 0x0, 0x1, 0x3b8, 0x0, 0x1, 0x3ba, 0x0, 0x1,
+			0x3c6, 0x0, 0x1, 0x3c1, 0x0, 0x1, 0x3c0, 0x0, 0x1, 0x391, 0x0, 0x1, 0x392, 0x0, 0x1, 0x393, 0x0, 0x1,
+			0x394, 0x0, 0x1, 0x395, 0x0, 0x1, 0x396, 0x0, 0x1, 0x397, 0x0, 0x1, 0x398, 0x0, 0x1, 0x399, 0x0, 0x1,
+			0x39a, 0x0, 0x1, 0x39b, 0x0, 0x1, 0x39c, 0x0, 0x1, 0x39d, 0x0, 0x1, 0x39e, 0x0, 0x1, 0x39f, 0x0, 0x1,
+			0x3a0, 0x0, 0x1, 0x3a1, 0x0, 0x1, 0x398, 0x0, 0x1, 0x3a3, 0x0, 0x1, 0x3a4, 0x0, 0x1, 0x3a5, 0x0, 0x1,
+			0x3a6, 0x0, 0x1, 0x3a7, 0x0, 0x1, 0x3a8, 0x0, 0x1, 0x3a9, 0x0, 0x1, 0x2207, 0x0, 0x1, 0x3b1, 0x0, 0x1,
+			0x3b2, 0x0, 0x1, 0x3b3, 0x0, 0x1, 0x3b4, 0x0, 0x1, 0x3b5, 0x0, 0x1, 0x3b6, 0x0, 0x1, 0x3b7, 0x0, 0x1,
+			0x3b8, 0x0, 0x1, 0x3b9, 0x0, 0x1, 0x3ba, 0x0, 0x1, 0x3bb, 0x0, 0x1, 0x3bc, 0x0, 0x1, 0x3bd, 0x0, 0x1,
+			0x3be, 0x0, 0x1, 0x3bf, 0x0, 0x1, 0x3c0, 0x0, 0x1, 0x3c1, 0x0, 0x1, 0x3c2, 0x0, 0x1, 0x3c3, 0x0, 0x1,
+			0x3c4, 0x0, 0x1, 0x3c5, 0x0, 0x1, 0x3c6, 0x0, 0x1, 0x3c7, 0x0, 0x1, 0x3c8, 0x0, 0x1, 0x3c9, 0x0, 0x1,
+			0x2202, 0x0, 0x1, 0x3b5, 0x0, 0x1, 0x3b8, 0x0, 0x1, 0x3ba, 0x0, 0x1, 0x3c6, 0x0, 0x1, 0x3c1, 0x0, 0x1,
+			0x3c0, 0x0, 0x1, 0x391, 0x0, 0x1, 0x392, 0x0, 0x1, 0x393, 0x0, 0x1, 0x394, 0x0, 0x1, 0x395, 0x0, 0x1,
+			0x396, 0x0, 0x1, 0x397, 0x0, 0x1, 0x398, 0x0, 0x1, 0x399, 0x0, 0x1, 0x39a, 0x0, 0x1, 0x39b, 0x0, 0x1,
+			0x39c, 0x0, 0x1, 0x39d, 0x0, 0x1, 0x39e, 0x0, 0x1, 0x39f, 0x0, 0x1, 0x3a0, 0x0, 0x1, 0x3a1, 0x0, 0x1,
+			0x398, 0x0, 0x1, 0x3a3, 0x0, 0x1, 0x3a4, 0x0, 0x1, 0x3a5, 0x0, 0x1, 0x3a6, 0x0, 0x1, 0x3a7, 0x0, 0x1,
+			0x3a8, 0x0, 0x1, 0x3a9, 0x0, 0x1, 0x2207, 0x0, 0x1, 0x3b1, 0x0, 0x1, 0x3b2, 0x0, 0x1, 0x3b3, 0x0, 0x1,
+			0x3b4, 0x0, 0x1, 0x3b5, 0x0, 0x1, 0x3b6, 0x0, 0x1, 0x3b7, 0x0, 0x1, 0x3b8, 0x0, 0x1, 0x3b9, 0x0, 0x1,
+			0x3ba, 0x0, 0x1, 0x3bb, 0x0, 0x1, 0x3bc, 0x0, 0x1, 0x3bd, 0x0, 0x1, 0x3be, 0x0, 0x1, 0x3bf, 0x0, 0x1,
+			0x3c0, 0x0, 0x1, 0x3c1, 0x0, 0x1, 0x3c2, 0x0, 0x1, 0x3c3, 0x0, 0x1, 0x3c4, 0x0, 0x1, 0x3c5, 0x0, 0x1,
+			0x3c6, 0x0, 0x1, 0x3c7, 0x0, 0x1, 0x3c8, 0x0, 0x1, 0x3c9, 0x0, 0x1, 0x2202, 0x0, 0x1, 0x3b5, 0x0, 0x1,
+			0x3b8, 0x0, 0x1, 0x3ba, 0x0, 0x1, 0x3c6, 0x0, 0x1, 0x3c1, 0x0, 0x1, 0x3c0, 0x0, 0x1, 0x391, 0x0, 0x1,
+			0x392, 0x0, 0x1, 0x393, 0x0, 0x1, 0x394, 0x0, 0x1, 0x395, 0x0, 0x1, 0x396, 0x0, 0x1, 0x397, 0x0, 0x1,
+			0x398, 0x0, 0x1, 0x399, 0x0, 0x1, 0x39a, 0x0, 0x1, 0x39b, 0x0, 0x1, 0x39c, 0x0, 0x1, 0x39d, 0x0, 0x1,
+			0x39e, 0x0, 0x1, 0x39f, 0x0, 0x1, 0x3a0, 0x0, 0x1, 0x3a1, 0x0, 0x1, 0x398, 0x0, 0x1, 0x3a3, 0x0, 0x1,
+			0x3a4, 0x0, 0x1, 0x3a5, 0x0, 0x1, 0x3a6, 0x0, 0x1, 0x3a7, 0x0, 0x1, 0x3a8, 0x0, 0x1, 0x3a9, 0x0, 0x1,
+			0x2207, 0x0, 0x1, 0x3b1, 0x0, 0x1, 0x3b2, 0x0, 0x1, 0x3b3, 0x0, 0x1, 0x3b4, 0x0, 0x1, 0x3b5, 0x0, 0x1,
+			0x3b6, 0x0, 0x1, 0x3b7, 0x0, 0x1, 0x3b8, 0x0, 0x1, 0x3b9, 0x0, 0x1, 0x3ba, 0x0, 0x1, 0x3bb, 0x0, 0x1,
+			0x3bc, 0x0, 0x1, 0x3bd, 0x0, 0x1, 0x3be, 0x0, 0x1, 0x3bf, 0x0, 0x1, 0x3c0, 0x0, 0x1, 0x3c1, 0x0, 0x1,
+			0x3c2, 0x0, 0x1, 0x3c3, 0x0, 0x1, 0x3c4, 0x0, 0x1, 0x3c5, 0x0, 0x1, 0x3c6, 0x0, 0x1, 0x3c7, 0x0, 0x1,
+			0x3c8, 0x0, 0x1, 0x3c9, 0x0, 0x1, 0x2202, 0x0, 0x1, 0x3b5, 0x0, 0x1, 0x3b8, 0x0, 0x1, 0x3ba, 0x0, 0x1,
+			0x3c6, 0x0, 0x1, 0x3c1, 0x0, 0x1, 0x3c0, 0x0, 0x1, 0x391, 0x0, 0x1, 0x392, 0x0, 0x1, 0x393, 0x0, 0x1,
+			0x394, 0x0, 0x1, 0x395, 0x0, 0x1, 0x396, 0x0, 0x1, 0x397, 0x0, 0x1, 0x398, 0x0, 0x1, 0x399, 0x0, 0x1,
+			0x39a, 0x0, 0x1, 0x39b, 0x0, 0x1, 0x39c, 0x0, 0x1, 0x39d, 0x0, 0x1, 0x39e, 0x0, 0x1, 0x39f, 0x0, 0x1,
+			0x3a0, 0x0, 0x1, 0x3a1, 0x0, 0x1, 0x398, 0x0, 0x1, 0x3a3, 0x0, 0x1, 0x3a4, 0x0, 0x1, 0x3a5, 0x0, 0x1,
+			0x3a6, 0x0, 0x1, 0x3a7, 0x0, 0x1, 0x3a8, 0x0, 0x1, 0x3a9, 0x0, 0x1, 0x2207, 0x0, 0x1, 0x3b1, 0x0, 0x1,
+			0x3b2, 0x0, 0x1, 0x3b3, 0x0, 0x1, 0x3b4, 0x0, 0x1, 0x3b5, 0x0, 0x1, 0x3b6, 0x0, 0x1, 0x3b7, 0x0, 0x1,
+			0x3b8, 0x0, 0x1, 0x3b9, 0x0, 0x1, 0x3ba, 0x0, 0x1, 0x3bb, 0x0, 0x1, 0x3bc, 0x0, 0x1, 0x3bd, 0x0, 0x1,
+			0x3be, 0x0, 0x1, 0x3bf, 0x0, 0x1, 0x3c0, 0x0, 0x1, 0x3c1, 0x0, 0x1, 0x3c2, 0x0, 0x1, 0x3c3, 0x0, 0x1,
+			0x3c4, 0x0, 0x1, 0x3c5, 0x0, 0x1, 0x3c6, 0x0, 0x1, 0x3c7, 0x0, 0x1, 0x3c8, 0x0, 0x1, 0x3c9, 0x0, 0x1,
+			0x2202, 0x0, 0x1, 0x3b5, 0x0, 0x1, 0x3b8, 0x0, 0x1, 0x3ba, 0x0, 0x1, 0x3c6, 0x0, 0x1, 0x3c1, 0x0, 0x1,
+			0x3c0, 0x0, 0x1, 0x3dc, 0x0, 0x1, 0x3dd, 0x0, 0x1, 0x30, 0x0, 0x1, 0x31, 0x0, 0x1, 0x32, 0x0, 0x1, 0x33,
+			0x0, 0x1, 0x34, 0x0, 0x1, 0x35, 0x0, 0x1, 0x36, 0x0, 0x1, 0x37, 0x0, 0x1, 0x38, 0x0, 0x1, 0x39, 0x0,
+			0x1, 0x30, 0x0, 0x1, 0x31, 0x0, 0x1, 0x32, 0x0, 0x1, 0x33, 0x0, 0x1, 0x34, 0x0, 0x1, 0x35, 0x0, 0x1,
+			0x36, 0x0, 0x1, 0x37, 0x0, 0x1, 0x38, 0x0, 0x1, 0x39, 0x0, 0x1, 0x30, 0x0, 0x1, 0x31, 0x0, 0x1, 0x32,
+			0x0, 0x1, 0x33, 0x0, 0x1, 0x34, 0x0, 0x1, 0x35, 0x0, 0x1, 0x36, 0x0, 0x1, 0x37, 0x0, 0x1, 0x38, 0x0,
+			0x1, 0x39, 0x0, 0x1, 0x30, 0x0, 0x1, 0x31, 0x0, 0x1, 0x32, 0x0, 0x1, 0x33, 0x0, 0x1, 0x34, 0x0, 0x1,
+			0x35, 0x0, 0x1, 0x36, 0x0, 0x1, 0x37, 0x0, 0x1, 0x38, 0x0, 0x1, 0x39, 0x0, 0x1, 0x30, 0x0, 0x1, 0x31,
+			0x0, 0x1, 0x32, 0x0, 0x1, 0x33, 0x0, 0x1, 0x34, 0x0, 0x1, 0x35, 0x0, 0x1, 0x36, 0x0, 0x1, 0x37, 0x0,
+			0x1, 0x38, 0x0, 0x1, 0x39, 0x0, 0x1, 0x627, 0x0, 0x1, 0x628, 0x0, 0x1, 0x62c, 0x0, 0x1, 0x62f, 0x0, 0x1,
+			0x648, 0x0, 0x1, 0x632, 0x0, 0x1, 0x62d, 0x0, 0x1, 0x637, 0x0, 0x1, 0x64a, 0x0, 0x1, 0x643, 0x0, 0x1,
+			0x644, 0x0, 0x1, 0x645, 0x0, 0x1, 0x646, 0x0, 0x1, 0x633, 0x0, 0x1, 0x639, 0x0, 0x1, 0x641, 0x0, 0x1,
+			0x635, 0x0, 0x1, 0x642, 0x0, 0x1, 0x631, 0x0, 0x1, 0x634, 0x0, 0x1, 0x62a, 0x0, 0x1, 0x62b, 0x0, 0x1,
+			0x62e, 0x0, 0x1, 0x630, 0x0, 0x1, 0x636, 0x0, 0x1, 0x638, 0x0, 0x1, 0x63a, 0x0, 0x1, 0x66e, 0x0, 0x1,
+			0x6ba, 0x0, 0x1, 0x6a1, 0x0, 0x1, 0x66f, 0x0, 0x1, 0x628, 0x0, 0x1, 0x62c, 0x0, 0x1, 0x647, 0x0, 0x1,
+			0x62d, 0x0, 0x1, 0x64a, 0x0, 0x1, 0x643, 0x0, 0x1, 0x644, 0x0, 0x1, 0x645, 0x0, 0x1, 0x646, 0x0, 0x1,
+			0x633, 0x0, 0x1, 0x639, 0x0, 0x1, 0x641, 0x0, 0x1, 0x635, 0x0, 0x1, 0x642, 0x0, 0x1, 0x634, 0x0, 0x1,
+			0x62a, 0x0, 0x1, 0x62b, 0x0, 0x1, 0x62e, 0x0, 0x1, 0x636, 0x0, 0x1, 0x63a, 0x0, 0x1, 0x62c, 0x0, 0x1,
+			0x62d, 0x0, 0x1, 0x64a, 0x0, 0x1, 0x644, 0x0, 0x1, 0x646, 0x0, 0x1, 0x633, 0x0, 0x1, 0x639, 0x0, 0x1,
+			0x635, 0x0, 0x1, 0x642, 0x0, 0x1, 0x634, 0x0, 0x1, 0x62e, 0x0, 0x1, 0x636, 0x0, 0x1, 0x63a, 0x0, 0x1,
+			0x6ba, 0x0, 0x1, 0x66f, 0x0, 0x1, 0x628, 0x0, 0x1, 0x62c, 0x0, 0x1, 0x647, 0x0, 0x1, 0x62d, 0x0, 0x1,
+			0x637, 0x0, 0x1, 0x64a, 0x0, 0x1, 0x643, 0x0, 0x1, 0x645, 0x0, 0x1, 0x646, 0x0, 0x1, 0x633, 0x0, 0x1,
+			0x639, 0x0, 0x1, 0x641, 0x0, 0x1, 0x635, 0x0, 0x1, 0x642, 0x0, 0x1, 0x634, 0x0, 0x1, 0x62a, 0x0, 0x1,
+			0x62b, 0x0, 0x1, 0x62e, 0x0, 0x1, 0x636, 0x0, 0x1, 0x638, 0x0, 0x1, 0x63a, 0x0, 0x1, 0x66e, 0x0, 0x1,
+			0x6a1, 0x0, 0x1, 0x627, 0x0, 0x1, 0x628, 0x0, 0x1, 0x62c, 0x0, 0x1, 0x62f, 0x0, 0x1, 0x647, 0x0, 0x1,
+			0x648, 0x0, 0x1, 0x632, 0x0, 0x1, 0x62d, 0x0, 0x1, 0x637, 0x0, 0x1, 0x64a, 0x0, 0x1, 0x644, 0x0, 0x1,
+			0x645, 0x0, 0x1, 0x646, 0x0, 0x1, 0x633, 0x0, 0x1, 0x639, 0x0, 0x1, 0x641, 0x0, 0x1, 0x635, 0x0, 0x1,
+			0x642, 0x0, 0x1, 0x631, 0x0, 0x1, 0x634, 0x0, 0x1, 0x62a, 0x0, 0x1, 0x62b, 0x0, 0x1, 0x62e, 0x0, 0x1,
+			0x630, 0x0, 0x1, 0x636, 0x0, 0x1, 0x638, 0x0, 0x1, 0x63a, 0x0, 0x1, 0x628, 0x0, 0x1, 0x62c, 0x0, 0x1,
+			0x62f, 0x0, 0x1, 0x648, 0x0, 0x1, 0x632, 0x0, 0x1, 0x62d, 0x0, 0x1, 0x637, 0x0, 0x1, 0x64a, 0x0, 0x1,
+			0x644, 0x0, 0x1, 0x645, 0x0, 0x1, 0x646, 0x0, 0x1, 0x633, 0x0, 0x1, 0x639, 0x0, 0x1, 0x641, 0x0, 0x1,
+			0x635, 0x0, 0x1, 0x642, 0x0, 0x1, 0x631, 0x0, 0x1, 0x634, 0x0, 0x1, 0x62a, 0x0, 0x1, 0x62b, 0x0, 0x1,
+			0x62e, 0x0, 0x1, 0x630, 0x0, 0x1, 0x636, 0x0, 0x1, 0x638, 0x0, 0x1, 0x63a, 0x0, 0x2, 0x30, 0x2e, 0x0,
+			0x2, 0x30, 0x2c, 0x0, 0x2, 0x31, 0x2c, 0x0, 0x2, 0x32, 0x2c, 0x0, 0x2, 0x33, 0x2c, 0x0, 0x2, 0x34, 0x2c,
+			0x0, 0x2, 0x35, 0x2c, 0x0, 0x2, 0x36, 0x2c, 0x0, 0x2, 0x37, 0x2c, 0x0, 0x2, 0x38, 0x2c, 0x0, 0x2, 0x39,
+			0x2c, 0x0, 0x3, 0x28, 0x41, 0x29, 0x0, 0x3, 0x28, 0x42, 0x29, 0x0, 0x3, 0x28, 0x43, 0x29, 0x0, 0x3,
+			0x28, 0x44, 0x29, 0x0, 0x3, 0x28, 0x45, 0x29, 0x0, 0x3, 0x28, 0x46, 0x29, 0x0, 0x3, 0x28, 0x47, 0x29,
+			0x0, 0x3, 0x28, 0x48, 0x29, 0x0, 0x3, 0x28, 0x49, 0x29, 0x0, 0x3, 0x28, 0x4a, 0x29, 0x0, 0x3, 0x28,
+			0x4b, 0x29, 0x0, 0x3, 0x28, 0x4c, 0x29, 0x0, 0x3, 0x28, 0x4d, 0x29, 0x0, 0x3, 0x28, 0x4e, 0x29, 0x0,
+			0x3, 0x28, 0x4f, 0x29, 0x0, 0x3, 0x28, 0x50, 0x29, 0x0, 0x3, 0x28, 0x51, 0x29, 0x0, 0x3, 0x28, 0x52,
+			0x29, 0x0, 0x3, 0x28, 0x53, 0x29, 0x0, 0x3, 0x28, 0x54, 0x29, 0x0, 0x3, 0x28, 0x55, 0x29, 0x0, 0x3,
+			0x28, 0x56, 0x29, 0x0, 0x3, 0x28, 0x57, 0x29, 0x0, 0x3, 0x28, 0x58, 0x29, 0x0, 0x3, 0x28, 0x59, 0x29,
+			0x0, 0x3, 0x28, 0x5a, 0x29, 0x0, 0x3, 0x3014, 0x53, 0x3015, 0x0, 0x1, 0x43, 0x0, 0x1, 0x52, 0x0, 0x2,
+			0x43, 0x44, 0x0, 0x2, 0x57, 0x5a, 0x0, 0x1, 0x41, 0x0, 0x1, 0x42, 0x0, 0x1, 0x43, 0x0, 0x1, 0x44, 0x0,
+			0x1, 0x45, 0x0, 0x1, 0x46, 0x0, 0x1, 0x47, 0x0, 0x1, 0x48, 0x0, 0x1, 0x49, 0x0, 0x1, 0x4a, 0x0, 0x1,
+			0x4b, 0x0, 0x1, 0x4c, 0x0, 0x1, 0x4d, 0x0, 0x1, 0x4e, 0x0, 0x1, 0x4f, 0x0, 0x1, 0x50, 0x0, 0x1, 0x51,
+			0x0, 0x1, 0x52, 0x0, 0x1, 0x53, 0x0, 0x1, 0x54, 0x0, 0x1, 0x55, 0x0, 0x1, 0x56, 0x0, 0x1, 0x57, 0x0,
+			0x1, 0x58, 0x0, 0x1, 0x59, 0x0, 0x1, 0x5a, 0x0, 0x2, 0x48, 0x56, 0x0, 0x2, 0x4d, 0x56, 0x0, 0x2, 0x53,
+			0x44, 0x0, 0x2, 0x53, 0x53, 0x0, 0x3, 0x50, 0x50, 0x56, 0x0, 0x2, 0x57, 0x43, 0x0, 0x2, 0x4d, 0x43, 0x0,
+			0x2, 0x4d, 0x44, 0x0, 0x2, 0x4d, 0x52, 0x0, 0x2, 0x44, 0x4a, 0x0, 0x2, 0x307b, 0x304b, 0x0, 0x2, 0x30b3,
+			0x30b3, 0x0, 0x1, 0x30b5, 0x0, 0x1, 0x624b, 0x0, 0x1, 0x5b57, 0x0, 0x1, 0x53cc, 0x0, 0x2, 0x30c6,
+			0x3099, 0x0, 0x1, 0x4e8c, 0x0, 0x1, 0x591a, 0x0, 0x1, 0x89e3, 0x0, 0x1, 0x5929, 0x0, 0x1, 0x4ea4, 0x0,
+			0x1, 0x6620, 0x0, 0x1, 0x7121, 0x0, 0x1, 0x6599, 0x0, 0x1, 0x524d, 0x0, 0x1, 0x5f8c, 0x0, 0x1, 0x518d,
+			0x0, 0x1, 0x65b0, 0x0, 0x1, 0x521d, 0x0, 0x1, 0x7d42, 0x0, 0x1, 0x751f, 0x0, 0x1, 0x8ca9, 0x0, 0x1,
+			0x58f0, 0x0, 0x1, 0x5439, 0x0, 0x1, 0x6f14, 0x0, 0x1, 0x6295, 0x0, 0x1, 0x6355, 0x0, 0x1, 0x4e00, 0x0,
+			0x1, 0x4e09, 0x0, 0x1, 0x904a, 0x0, 0x1, 0x5de6, 0x0, 0x1, 0x4e2d, 0x0, 0x1, 0x53f3, 0x0, 0x1, 0x6307,
+			0x0, 0x1, 0x8d70, 0x0, 0x1, 0x6253, 0x0, 0x1, 0x7981, 0x0, 0x1, 0x7a7a, 0x0, 0x1, 0x5408, 0x0, 0x1,
+			0x6e80, 0x0, 0x1, 0x6709, 0x0, 0x1, 0x6708, 0x0, 0x1, 0x7533, 0x0, 0x1, 0x5272, 0x0, 0x1, 0x55b6, 0x0,
+			0x1, 0x914d, 0x0, 0x3, 0x3014, 0x672c, 0x3015, 0x0, 0x3, 0x3014, 0x4e09, 0x3015, 0x0, 0x3, 0x3014,
+			0x4e8c, 0x3015, 0x0, 0x3, 0x3014, 0x5b89, 0x3015, 0x0, 0x3, 0x3014, 0x70b9, 0x3015, 0x0, 0x3, 0x3014,
+			0x6253, 0x3015, 0x0, 0x3, 0x3014, 0x76d7, 0x3015, 0x0, 0x3, 0x3014, 0x52dd, 0x3015, 0x0, 0x3, 0x3014,
+			0x6557, 0x3015, 0x0, 0x1, 0x5f97, 0x0, 0x1, 0x53ef, 0x0, 0x1, 0x30, 0x0, 0x1, 0x31, 0x0, 0x1, 0x32, 0x0,
+			0x1, 0x33, 0x0, 0x1, 0x34, 0x0, 0x1, 0x35, 0x0, 0x1, 0x36, 0x0, 0x1, 0x37, 0x0, 0x1, 0x38, 0x0, 0x1,
+			0x39, 0x1, 0x4e3d, 0x0, 0x1, 0x4e38, 0x0, 0x1, 0x4e41, 0x0, 0x1, 0x20122, 0x0, 0x1, 0x4f60, 0x0, 0x1,
+			0x4fae, 0x0, 0x1, 0x4fbb, 0x0, 0x1, 0x5002, 0x0, 0x1, 0x507a, 0x0, 0x1, 0x5099, 0x0, 0x1, 0x50e7, 0x0,
+			0x1, 0x50cf, 0x0, 0x1, 0x349e, 0x0, 0x1, 0x2063a, 0x0, 0x1, 0x514d, 0x0, 0x1, 0x5154, 0x0, 0x1, 0x5164,
+			0x0, 0x1, 0x5177, 0x0, 0x1, 0x2051c, 0x0, 0x1, 0x34b9, 0x0, 0x1, 0x5167, 0x0, 0x1, 0x518d, 0x0, 0x1,
+			0x2054b, 0x0, 0x1, 0x5197, 0x0, 0x1, 0x51a4, 0x0, 0x1, 0x4ecc, 0x0, 0x1, 0x51ac, 0x0, 0x1, 0x51b5, 0x0,
+			0x1, 0x291df, 0x0, 0x1, 0x51f5, 0x0, 0x1, 0x5203, 0x0, 0x1, 0x34df, 0x0, 0x1, 0x523b, 0x0, 0x1, 0x5246,
+			0x0, 0x1, 0x5272, 0x0, 0x1, 0x5277, 0x0, 0x1, 0x3515, 0x0, 0x1, 0x52c7, 0x0, 0x1, 0x52c9, 0x0, 0x1,
+			0x52e4, 0x0, 0x1, 0x52fa, 0x0, 0x1, 0x5305, 0x0, 0x1, 0x5306, 0x0, 0x1, 0x5317, 0x0, 0x1, 0x5349, 0x0,
+			0x1, 0x5351, 0x0, 0x1, 0x535a, 0x0, 0x1, 0x5373, 0x0, 0x1, 0x537d, 0x0, 0x1, 0x537f, 0x0, 0x1, 0x537f,
+			0x0, 0x1, 0x537f, 0x0, 0x1, 0x20a2c, 0x0, 0x1, 0x7070, 0x0, 0x1, 0x53ca, 0x0, 0x1, 0x53df, 0x0, 0x1,
+			0x20b63, 0x0, 0x1, 0x53eb, 0x0, 0x1, 0x53f1, 0x0, 0x1, 0x5406, 0x0, 0x1, 0x549e, 0x0, 0x1, 0x5438, 0x0,
+			0x1, 0x5448, 0x0, 0x1, 0x5468, 0x0, 0x1, 0x54a2, 0x0, 0x1, 0x54f6, 0x0, 0x1, 0x5510, 0x0, 0x1, 0x5553,
+			0x0, 0x1, 0x5563, 0x0, 0x1, 0x5584, 0x0, 0x1, 0x5584, 0x0, 0x1, 0x5599, 0x0, 0x1, 0x55ab, 0x0, 0x1,
+			0x55b3, 0x0, 0x1, 0x55c2, 0x0, 0x1, 0x5716, 0x0, 0x1, 0x5606, 0x0, 0x1, 0x5717, 0x0, 0x1, 0x5651, 0x0,
+			0x1, 0x5674, 0x0, 0x1, 0x5207, 0x0, 0x1, 0x58ee, 0x0, 0x1, 0x57ce, 0x0, 0x1, 0x57f4, 0x0, 0x1, 0x580d,
+			0x0, 0x1, 0x578b, 0x0, 0x1, 0x5832, 0x0, 0x1, 0x5831, 0x0, 0x1, 0x58ac, 0x0, 0x1, 0x214e4, 0x0, 0x1,
+			0x58f2, 0x0, 0x1, 0x58f7, 0x0, 0x1, 0x5906, 0x0, 0x1, 0x591a, 0x0, 0x1, 0x5922, 0x0, 0x1, 0x5962, 0x0,
+			0x1, 0x216a8, 0x0, 0x1, 0x216ea, 0x0, 0x1, 0x59ec, 0x0, 0x1, 0x5a1b, 0x0, 0x1, 0x5a27, 0x0, 0x1, 0x59d8,
+			0x0, 0x1, 0x5a66, 0x0, 0x1, 0x36ee, 0x0, 0x1, 0x36fc, 0x0, 0x1, 0x5b08, 0x0, 0x1, 0x5b3e, 0x0, 0x1,
+			0x5b3e, 0x0, 0x1, 0x219c8, 0x0, 0x1, 0x5bc3, 0x0, 0x1, 0x5bd8, 0x0, 0x1, 0x5be7, 0x0, 0x1, 0x5bf3, 0x0,
+			0x1, 0x21b18, 0x0, 0x1, 0x5bff, 0x0, 0x1, 0x5c06, 0x0, 0x1, 0x5f53, 0x0, 0x1, 0x5c22, 0x0, 0x1, 0x3781,
+			0x0, 0x1, 0x5c60, 0x0, 0x1, 0x5c6e, 0x0, 0x1, 0x5cc0, 0x0, 0x1, 0x5c8d, 0x0, 0x1, 0x21de4, 0x0, 0x1,
+			0x5d43, 0x0, 0x1, 0x21de6, 0x0, 0x1, 0x5d6e, 0x0, 0x1, 0x5d6b, 0x0, 0x1, 0x5d7c, 0x0, 0x1, 0x5de1, 0x0,
+			0x1, 0x5de2, 0x0, 0x1, 0x382f, 0x0, 0x1, 0x5dfd, 0x0, 0x1, 0x5e28, 0x0, 0x1, 0x5e3d, 0x0, 0x1, 0x5e69,
+			0x0, 0x1, 0x3862, 0x0, 0x1, 0x22183, 0x0, 0x1, 0x387c, 0x0, 0x1, 0x5eb0, 0x0, 0x1, 0x5eb3, 0x0, 0x1,
+			0x5eb6, 0x0, 0x1, 0x5eca, 0x0, 0x1, 0x2a392, 0x0, 0x1, 0x5efe, 0x0, 0x1, 0x22331, 0x0, 0x1, 0x22331,
+			0x0, 0x1, 0x8201, 0x0, 0x1, 0x5f22, 0x0, 0x1, 0x5f22, 0x0, 0x1, 0x38c7, 0x0, 0x1, 0x232b8, 0x0, 0x1,
+			0x261da, 0x0, 0x1, 0x5f62, 0x0, 0x1, 0x5f6b, 0x0, 0x1, 0x38e3, 0x0, 0x1, 0x5f9a, 0x0, 0x1, 0x5fcd, 0x0,
+			0x1, 0x5fd7, 0x0, 0x1, 0x5ff9, 0x0, 0x1, 0x6081, 0x0, 0x1, 0x393a, 0x0, 0x1, 0x391c, 0x0, 0x1, 0x6094,
+			0x0, 0x1, 0x226d4, 0x0, 0x1, 0x60c7, 0x0, 0x1, 0x6148, 0x0, 0x1, 0x614c, 0x0, 0x1, 0x614e, 0x0, 0x1,
+			0x614c, 0x0, 0x1, 0x617a, 0x0, 0x1, 0x618e, 0x0, 0x1, 0x61b2, 0x0, 0x1, 0x61a4, 0x0, 0x1, 0x61af, 0x0,
+			0x1, 0x61de, 0x0, 0x1, 0x61f2, 0x0, 0x1, 0x61f6, 0x0, 0x1, 0x6210, 0x0, 0x1, 0x621b, 0x0, 0x1, 0x625d,
+			0x0, 0x1, 0x62b1, 0x0, 0x1, 0x62d4, 0x0, 0x1, 0x6350, 0x0, 0x1, 0x22b0c, 0x0, 0x1, 0x633d, 0x0, 0x1,
+			0x62fc, 0x0, 0x1, 0x6368, 0x0, 0x1, 0x6383, 0x0, 0x1, 0x63e4, 0x0, 0x1, 0x22bf1, 0x0, 0x1, 0x6422, 0x0,
+			0x1, 0x63c5, 0x0, 0x1, 0x63a9, 0x0, 0x1, 0x3a2e, 0x0, 0x1, 0x6469, 0x0, 0x1, 0x647e, 0x0, 0x1, 0x649d,
+			0x0, 0x1, 0x6477, 0x0, 0x1, 0x3a6c, 0x0, 0x1, 0x654f, 0x0, 0x1, 0x656c, 0x0, 0x1, 0x2300a, 0x0, 0x1,
+			0x65e3, 0x0, 0x1, 0x66f8, 0x0, 0x1, 0x6649, 0x0, 0x1, 0x3b19, 0x0, 0x1, 0x6691, 0x0, 0x1, 0x3b08, 0x0,
+			0x1, 0x3ae4, 0x0, 0x1, 0x5192, 0x0, 0x1, 0x5195, 0x0, 0x1, 0x6700, 0x0, 0x1, 0x669c, 0x0, 0x1, 0x80ad,
+			0x0, 0x1, 0x43d9, 0x0, 0x1, 0x6717, 0x0, 0x1, 0x671b, 0x0, 0x1, 0x6721, 0x0, 0x1, 0x675e, 0x0, 0x1,
+			0x6753, 0x0, 0x1, 0x233c3, 0x0, 0x1, 0x3b49, 0x0, 0x1, 0x67fa, 0x0, 0x1, 0x6785, 0x0, 0x1, 0x6852, 0x0,
+			0x1, 0x6885, 0x0, 0x1, 0x2346d, 0x0, 0x1, 0x688e, 0x0, 0x1, 0x681f, 0x0, 0x1, 0x6914, 0x0, 0x1, 0x3b9d,
+			0x0, 0x1, 0x6942, 0x0, 0x1, 0x69a3, 0x0, 0x1, 0x69ea, 0x0, 0x1, 0x6aa8, 0x0, 0x1, 0x236a3, 0x0, 0x1,
+			0x6adb, 0x0, 0x1, 0x3c18, 0x0, 0x1, 0x6b21, 0x0, 0x1, 0x238a7, 0x0, 0x1, 0x6b54, 0x0, 0x1, 0x3c4e, 0x0,
+			0x1, 0x6b72, 0x0, 0x1, 0x6b9f, 0x0, 0x1, 0x6bba, 0x0, 0x1, 0x6bbb, 0x0, 0x1, 0x23a8d, 0x0, 0x1, 0x21d0b,
+			0x0, 0x1, 0x23afa, 0x0, 0x1, 0x6c4e, 0x0, 0x1, 0x23cbc, 0x0, 0x1, 0x6cbf, 0x0, 0x1, 0x6ccd, 0x0, 0x1,
+			0x6c67, 0x0, 0x1, 0x6d16, 0x0, 0x1, 0x6d3e, 0x0, 0x1, 0x6d77, 0x0, 0x1, 0x6d41, 0x0, 0x1, 0x6d69, 0x0,
+			0x1, 0x6d78, 0x0, 0x1, 0x6d85, 0x0, 0x1, 0x23d1e, 0x0, 0x1, 0x6d34, 0x0, 0x1, 0x6e2f, 0x0, 0x1, 0x6e6e,
+			0x0, 0x1, 0x3d33, 0x0, 0x1, 0x6ecb, 0x0, 0x1, 0x6ec7, 0x0, 0x1, 0x23ed1, 0x0, 0x1, 0x6df9, 0x0, 0x1,
+			0x6f6e, 0x0, 0x1, 0x23f5e, 0x0, 0x1, 0x23f8e, 0x0, 0x1, 0x6fc6, 0x0, 0x1, 0x7039, 0x0, 0x1, 0x701e, 0x0,
+			0x1, 0x701b, 0x0, 0x1, 0x3d96, 0x0, 0x1, 0x704a, 0x0, 0x1, 0x707d, 0x0, 0x1, 0x7077, 0x0, 0x1, 0x70ad,
+			0x0, 0x1, 0x20525, 0x0, 0x1, 0x7145, 0x0, 0x1, 0x24263, 0x0, 0x1, 0x719c, 0x0, 0x1, 0x243ab, 0x0, 0x1,
+			0x7228, 0x0, 0x1, 0x7235, 0x0, 0x1, 0x7250, 0x0, 0x1, 0x24608, 0x0, 0x1, 0x7280, 0x0, 0x1, 0x7295, 0x0,
+			0x1, 0x24735, 0x0, 0x1, 0x24814, 0x0, 0x1, 0x737a, 0x0, 0x1, 0x738b, 0x0, 0x1, 0x3eac, 0x0, 0x1, 0x73a5,
+			0x0, 0x1, 0x3eb8, 0x0, 0x1, 0x3eb8, 0x0, 0x1, 0x7447, 0x0, 0x1, 0x745c, 0x0, 0x1, 0x7471, 0x0, 0x1,
+			0x7485, 0x0, 0x1, 0x74ca, 0x0, 0x1, 0x3f1b, 0x0, 0x1, 0x7524, 0x0, 0x1, 0x24c36, 0x0, 0x1, 0x753e, 0x0,
+			0x1, 0x24c92, 0x0, 0x1, 0x7570, 0x0, 0x1, 0x2219f, 0x0, 0x1, 0x7610, 0x0, 0x1, 0x24fa1, 0x0, 0x1,
+			0x24fb8, 0x0, 0x1, 0x25044, 0x0, 0x1, 0x3ffc, 0x0, 0x1, 0x4008, 0x0, 0x1, 0x76f4, 0x0, 0x1, 0x250f3,
+			0x0, 0x1, 0x250f2, 0x0, 0x1, 0x25119, 0x0, 0x1, 0x25133, 0x0, 0x1, 0x771e, 0x0, 0x1, 0x771f, 0x0, 0x1,
+			0x771f, 0x0, 0x1, 0x774a, 0x0, 0x1, 0x4039, 0x0, 0x1, 0x778b, 0x0, 0x1, 0x4046, 0x0, 0x1, 0x4096, 0x0,
+			0x1, 0x2541d, 0x0, 0x1, 0x784e, 0x0, 0x1, 0x788c, 0x0, 0x1, 0x78cc, 0x0, 0x1, 0x40e3, 0x0, 0x1, 0x25626,
+			0x0, 0x1, 0x7956, 0x0, 0x1, 0x2569a, 0x0, 0x1, 0x256c5, 0x0, 0x1, 0x798f, 0x0, 0x1, 0x79eb, 0x0, 0x1,
+			0x412f, 0x0, 0x1, 0x7a40, 0x0, 0x1, 0x7a4a, 0x0, 0x1, 0x7a4f, 0x0, 0x1, 0x2597c, 0x0, 0x1, 0x25aa7, 0x0,
+			0x1, 0x25aa7, 0x0, 0x1, 0x7aee, 0x0, 0x1, 0x4202, 0x0, 0x1, 0x25bab, 0x0, 0x1, 0x7bc6, 0x0, 0x1, 0x7bc9,
+			0x0, 0x1, 0x4227, 0x0, 0x1, 0x25c80, 0x0, 0x1, 0x7cd2, 0x0, 0x1, 0x42a0, 0x0, 0x1, 0x7ce8, 0x0, 0x1,
+			0x7ce3, 0x0, 0x1, 0x7d00, 0x0, 0x1, 0x25f86, 0x0, 0x1, 0x7d63, 0x0, 0x1, 0x4301, 0x0, 0x1, 0x7dc7, 0x0,
+			0x1, 0x7e02, 0x0, 0x1, 0x7e45, 0x0, 0x1, 0x4334, 0x0, 0x1, 0x26228, 0x0, 0x1, 0x26247, 0x0, 0x1, 0x4359,
+			0x0, 0x1, 0x262d9, 0x0, 0x1, 0x7f7a, 0x0, 0x1, 0x2633e, 0x0, 0x1, 0x7f95, 0x0, 0x1, 0x7ffa, 0x0, 0x1,
+			0x8005, 0x0, 0x1, 0x264da, 0x0, 0x1, 0x26523, 0x0, 0x1, 0x8060, 0x0, 0x1, 0x265a8, 0x0, 0x1, 0x8070,
+			0x0, 0x1, 0x2335f, 0x0, 0x1, 0x43d5, 0x0, 0x1, 0x80b2, 0x0, 0x1, 0x8103, 0x0, 0x1, 0x440b, 0x0, 0x1,
+			0x813e, 0x0, 0x1, 0x5ab5, 0x0, 0x1, 0x267a7, 0x0, 0x1, 0x267b5, 0x0, 0x1, 0x23393, 0x0, 0x1, 0x2339c,
+			0x0, 0x1, 0x8201, 0x0, 0x1, 0x8204, 0x0, 0x1, 0x8f9e, 0x0, 0x1, 0x446b, 0x0, 0x1, 0x8291, 0x0, 0x1,
+			0x828b, 0x0, 0x1, 0x829d, 0x0, 0x1, 0x52b3, 0x0, 0x1, 0x82b1, 0x0, 0x1, 0x82b3, 0x0, 0x1, 0x82bd, 0x0,
+			0x1, 0x82e6, 0x0, 0x1, 0x26b3c, 0x0, 0x1, 0x82e5, 0x0, 0x1, 0x831d, 0x0, 0x1, 0x8363, 0x0, 0x1, 0x83ad,
+			0x0, 0x1, 0x8323, 0x0, 0x1, 0x83bd, 0x0, 0x1, 0x83e7, 0x0, 0x1, 0x8457, 0x0, 0x1, 0x8353, 0x0, 0x1,
+			0x83ca, 0x0, 0x1, 0x83cc, 0x0, 0x1, 0x83dc, 0x0, 0x1, 0x26c36, 0x0, 0x1, 0x26d6b, 0x0, 0x1, 0x26cd5,
+			0x0, 0x1, 0x452b, 0x0, 0x1, 0x84f1, 0x0, 0x1, 0x84f3, 0x0, 0x1, 0x8516, 0x0, 0x1, 0x273ca, 0x0, 0x1,
+			0x8564, 0x0, 0x1, 0x26f2c, 0x0, 0x1, 0x455d, 0x0, 0x1, 0x4561, 0x0, 0x1, 0x26fb1, 0x0, 0x1, 0x270d2,
+			0x0, 0x1, 0x456b, 0x0, 0x1, 0x8650, 0x0, 0x1, 0x865c, 0x0, 0x1, 0x8667, 0x0, 0x1, 0x8669, 0x0, 0x1,
+			0x86a9, 0x0, 0x1, 0x8688, 0x0, 0x1, 0x870e, 0x0, 0x1, 0x86e2, 0x0, 0x1, 0x8779, 0x0, 0x1, 0x8728, 0x0,
+			0x1, 0x876b, 0x0, 0x1, 0x8786, 0x0, 0x1, 0x45d7, 0x0, 0x1, 0x87e1, 0x0, 0x1, 0x8801, 0x0, 0x1, 0x45f9,
+			0x0, 0x1, 0x8860, 0x0, 0x1, 0x8863, 0x0, 0x1, 0x27667, 0x0, 0x1, 0x88d7, 0x0, 0x1, 0x88de, 0x0, 0x1,
+			0x4635, 0x0, 0x1, 0x88fa, 0x0, 0x1, 0x34bb, 0x0, 0x1, 0x278ae, 0x0, 0x1, 0x27966, 0x0, 0x1, 0x46be, 0x0,
+			0x1, 0x46c7, 0x0, 0x1, 0x8aa0, 0x0, 0x1, 0x8aed, 0x0, 0x1, 0x8b8a, 0x0, 0x1, 0x8c55, 0x0, 0x1, 0x27ca8,
+			0x0, 0x1, 0x8cab, 0x0, 0x1, 0x8cc1, 0x0, 0x1, 0x8d1b, 0x0, 0x1, 0x8d77, 0x0, 0x1, 0x27f2f, 0x0, 0x1,
+			0x20804, 0x0, 0x1, 0x8dcb, 0x0, 0x1, 0x8dbc, 0x0, 0x1, 0x8df0, 0x0, 0x1, 0x208de, 0x0, 0x1, 0x8ed4, 0x0,
+			0x1, 0x8f38, 0x0, 0x1, 0x285d2, 0x0, 0x1, 0x285ed, 0x0, 0x1, 0x9094, 0x0, 0x1, 0x90f1, 0x0, 0x1, 0x9111,
+			0x0, 0x1, 0x2872e, 0x0, 0x1, 0x911b, 0x0, 0x1, 0x9238, 0x0, 0x1, 0x92d7, 0x0, 0x1, 0x92d8, 0x0, 0x1,
+			0x927c, 0x0, 0x1, 0x93f9, 0x0, 0x1, 0x9415, 0x0, 0x1, 0x28bfa, 0x0, 0x1, 0x958b, 0x0, 0x1, 0x4995, 0x0,
+			0x1, 0x95b7, 0x0, 0x1, 0x28d77, 0x0, 0x1, 0x49e6, 0x0, 0x1, 0x96c3, 0x0, 0x1, 0x5db2, 0x0, 0x1, 0x9723,
+			0x0, 0x1, 0x29145, 0x0, 0x1, 0x2921a, 0x0, 0x1, 0x4a6e, 0x0, 0x1, 0x4a76, 0x0, 0x1, 0x97e0, 0x0, 0x1,
+			0x2940a, 0x0, 0x1, 0x4ab2, 0x0, 0x1, 0x29496, 0x0, 0x1, 0x980b, 0x0, 0x1, 0x980b, 0x0, 0x1, 0x9829, 0x0,
+			0x1, 0x295b6, 0x0, 0x1, 0x98e2, 0x0, 0x1, 0x4b33, 0x0, 0x1, 0x9929, 0x0, 0x1, 0x99a7, 0x0, 0x1, 0x99c2,
+			0x0, 0x1, 0x99fe, 0x0, 0x1, 0x4bce, 0x0, 0x1, 0x29b30, 0x0, 0x1, 0x9b12, 0x0, 0x1, 0x9c40, 0x0, 0x1,
+			0x9cfd, 0x0, 0x1, 0x4cce, 0x0, 0x1, 0x4ced, 0x0, 0x1, 0x9d67, 0x0, 0x1, 0x2a0ce, 0x0, 0x1, 0x4cf8, 0x0,
+			0x1, 0x2a105, 0x0, 0x1, 0x2a20e, 0x0, 0x1, 0x2a291, 0x0, 0x1, 0x9ebb, 0x0, 0x1, 0x4d56, 0x0, 0x1,
+			0x9ef9, 0x0, 0x1, 0x9efe, 0x0, 0x1, 0x9f05, 0x0, 0x1, 0x9f0f, 0x0, 0x1, 0x9f16, 0x0, 0x1, 0x9f3b, 0x0,
+			0x1, 0x2a600, 0x0
+		};
+
+		// Primary composites, sorted by (first << 21) | second.
+		struct __normalization_composition {
+			::std::uint_least64_t __pair;
+			::std::uint_least32_t __composite;
+		};
+
+		inline constexpr __normalization_composition __normalization_compositions[941] = {
+			{ 0x7800338, 0x226e }, { 0x7a00338, 0x2260 }, { 0x7c00338, 0x226f }, { 0x8200300, 0xc0 },
+			{ 0x8200301, 0xc1 }, { 0x8200302, 0xc2 }, { 0x8200303, 0xc3 }, { 0x8200304, 0x100 },
+			{ 0x8200306, 0x102 }, { 0x8200307, 0x226 }, { 0x8200308, 0xc4 }, { 0x8200309, 0x1ea2 },
+			{ 0x820030a, 0xc5 }, { 0x820030c, 0x1cd }, { 0x820030f, 0x200 }, { 0x8200311, 0x202 },
+			{ 0x8200323, 0x1ea0 }, { 0x8200325, 0x1e00 }, { 0x8200328, 0x104 }, { 0x8400307, 0x1e02 },
+			{ 0x8400323, 0x1e04 }, { 0x8400331, 0x1e06 }, { 0x8600301, 0x106 }, { 0x8600302, 0x108 },
+			{ 0x8600307, 0x10a }, { 0x860030c, 0x10c }, { 0x8600327, 0xc7 }, { 0x8800307, 0x1e0a },
+			{ 0x880030c, 0x10e }, { 0x8800323, 0x1e0c }, { 0x8800327, 0x1e10 }, { 0x880032d, 0x1e12 },
+			{ 0x8800331, 0x1e0e }, { 0x8a00300, 0xc8 }, { 0x8a00301, 0xc9 }, { 0x8a00302, 0xca },
+			{ 0x8a00303, 0x1ebc }, { 0x8a00304, 0x112 }, { 0x8a00306, 0x114 }, { 0x8a00307, 0x116 },
+			{ 0x8a00308, 0xcb }, { 0x8a00309, 0x1eba }, { 0x8a0030c, 0x11a }, { 0x8a0030f, 0x204 },
+			{ 0x8a00311, 0x206 }, { 0x8a00323, 0x1eb8 }, { 0x8a00327, 0x228 }, { 0x8a00328, 0x118 },
+			{ 0x8a0032d, 0x1e18 }, { 0x8a00330, 0x1e1a }, { 0x8c00307, 0x1e1e }, { 0x8e00301, 0x1f4 },
+			{ 0x8e00302, 0x11c }, { 0x8e00304, 0x1e20 }, { 0x8e00306, 0x11e }, { 0x8e00307, 0x120 },
+			{ 0x8e0030c, 0x1e6 }, { 0x8e00327, 0x122 }, { 0x9000302, 0x124 }, { 0x9000307, 0x1e22 },
+			{ 0x9000308, 0x1e26 }, { 0x900030c, 0x21e }, { 0x9000323, 0x1e24 }, { 0x9000327, 0x1e28 },
+			{ 0x900032e, 0x1e2a }, { 0x9200300, 0xcc }, { 0x9200301, 0xcd }, { 0x9200302, 0xce },
+			{ 0x9200303, 0x128 }, { 0x9200304, 0x12a }, { 0x9200306, 0x12c }, { 0x9200307, 0x130 },
+			{ 0x9200308, 0xcf }, { 0x9200309, 0x1ec8 }, { 0x920030c, 0x1cf }, { 0x920030f, 0x208 },
+			{ 0x9200311, 0x20a }, { 0x9200323, 0x1eca }, { 0x9200328, 0x12e }, { 0x9200330, 0x1e2c },
+			{ 0x9400302, 0x134 }, { 0x9600301, 0x1e30 }, { 0x960030c, 0x1e8 }, { 0x9600323, 0x1e32 },
+			{ 0x9600327, 0x136 }, { 0x9600331, 0x1e34 }, { 0x9800301, 0x139 }, { 0x980030c, 0x13d },
+			{ 0x9800323, 0x1e36 }, { 0x9800327, 0x13b }, { 0x980032d, 0x1e3c }, { 0x9800331, 0x1e3a },
+			{ 0x9a00301, 0x1e3e }, { 0x9a00307, 0x1e40 }, { 0x9a00323, 0x1e42 }, { 0x9c00300, 0x1f8 },
+			{ 0x9c00301, 0x143 }, { 0x9c00303, 0xd1 }, { 0x9c00307, 0x1e44 }, { 0x9c0030c, 0x147 },
+			{ 0x9c00323, 0x1e46 }, { 0x9c00327, 0x145 }, { 0x9c0032d, 0x1e4a }, { 0x9c00331, 0x1e48 },
+			{ 0x9e00300, 0xd2 }, { 0x9e00301, 0xd3 }, { 0x9e00302, 0xd4 }, { 0x9e00303, 0xd5 },
+			{ 0x9e00304, 0x14c }, { 0x9e00306, 0x14e }, { 0x9e00307, 0x22e }, { 0x9e00308, 0xd6 },
+			{ 0x9e00309, 0x1ece }, { 0x9e0030b, 0x150 }, { 0x9e0030c, 0x1d1 }, { 0x9e0030f, 0x20c },
+			{ 0x9e00311, 0x20e }, { 0x9e0031b, 0x1a0 }, { 0x9e00323, 0x1ecc }, { 0x9e00328, 0x1ea },
+			{ 0xa000301, 0x1e54 }, { 0xa000307, 0x1e56 }, { 0xa400301, 0x154 }, { 0xa400307, 0x1e58 },
+			{ 0xa40030c, 0x158 }, { 0xa40030f, 0x210 }, { 0xa400311, 0x212 }, { 0xa400323, 0x1e5a },
+			{ 0xa400327, 0x156 }, { 0xa400331, 0x1e5e }, { 0xa600301, 0x15a }, { 0xa600302, 0x15c },
+			{ 0xa600307, 0x1e60 }, { 0xa60030c, 0x160 }, { 0xa600323, 0x1e62 }, { 0xa600326, 0x218 },
+			{ 0xa600327, 0x15e }, { 0xa800307, 0x1e6a }, { 0xa80030c, 0x164 }, { 0xa800323, 0x1e6c },
+			{ 0xa800326, 0x21a }, { 0xa800327, 0x162 }, { 0xa80032d, 0x1e70 }, { 0xa800331, 0x1e6e },
+			{ 0xaa00300, 0xd9 }, { 0xaa00301, 0xda }, { 0xaa00302, 0xdb }, { 0xaa00303, 0x168 },
+			{ 0xaa00304, 0x16a }, { 0xaa00306, 0x16c }, { 0xaa00308, 0xdc }, { 0xaa00309, 0x1ee6 },
+			{ 0xaa0030a, 0x16e }, { 0xaa0030b, 0x170 }, { 0xaa0030c, 0x1d3 }, { 0xaa0030f, 0x214 },
+			{ 0xaa00311, 0x216 }, { 0xaa0031b, 0x1af }, { 0xaa00323, 0x1ee4 }, { 0xaa00324, 0x1e72 },
+			{ 0xaa00328, 0x172 }, { 0xaa0032d, 0x1e76 }, { 0xaa00330, 0x1e74 }, { 0xac00303, 0x1e7c },
+			{ 0xac00323, 0x1e7e }, { 0xae00300, 0x1e80 }, { 0xae00301, 0x1e82 }, { 0xae00302, 0x174 },
+			{ 0xae00307, 0x1e86 }, { 0xae00308, 0x1e84 }, { 0xae00323, 0x1e88 }, { 0xb000307, 0x1e8a },
+			{ 0xb000308, 0x1e8c }, { 0xb200300, 0x1ef2 }, { 0xb200301, 0xdd }, { 0xb200302, 0x176 },
+			{ 0xb200303, 0x1ef8 }, { 0xb200304, 0x232 }, { 0xb200307, 0x1e8e }, { 0xb200308, 0x178 },
+			{ 0xb200309, 0x1ef6 }, { 0xb200323, 0x1ef4 }, { 0xb400301, 0x179 }, { 0xb400302, 0x1e90 },
+			{ 0xb400307, 0x17b }, { 0xb40030c, 0x17d }, { 0xb400323, 0x1e92 }, { 0xb400331, 0x1e94 },
+			{ 0xc200300, 0xe0 }, { 0xc200301, 0xe1 }, { 0xc200302, 0xe2 }, { 0xc200303, 0xe3 },
+			{ 0xc200304, 0x101 }, { 0xc200306, 0x103 }, { 0xc200307, 0x227 }, { 0xc200308, 0xe4 },
+			{ 0xc200309, 0x1ea3 }, { 0xc20030a, 0xe5 }, { 0xc20030c, 0x1ce }, { 0xc20030f, 0x201 },
+			{ 0xc200311, 0x203 }, { 0xc200323, 0x1ea1 }, { 0xc200325, 0x1e01 }, { 0xc200328, 0x105 },
+			{ 0xc400307, 0x1e03 }, { 0xc400323, 0x1e05 }, { 0xc400331, 0x1e07 }, { 0xc600301, 0x107 },
+			{ 0xc600302, 0x109 }, { 0xc600307, 0x10b }, { 0xc60030c, 0x10d }, { 0xc600327, 0xe7 },
+			{ 0xc800307, 0x1e0b }, { 0xc80030c, 0x10f }, { 0xc800323, 0x1e0d }, { 0xc800327, 0x1e11 },
+			{ 0xc80032d, 0x1e13 }, { 0xc800331, 0x1e0f }, { 0xca00300, 0xe8 }, { 0xca00301, 0xe9 },
+			{ 0xca00302, 0xea }, { 0xca00303, 0x1ebd }, { 0xca00304, 0x113 }, { 0xca00306, 0x115 },
+			{ 0xca00307, 0x117 }, { 0xca00308, 0xeb }, { 0xca00309, 0x1ebb }, { 0xca0030c, 0x11b },
+			{ 0xca0030f, 0x205 }, { 0xca00311, 0x207 }, { 0xca00323, 0x1eb9 }, { 0xca00327, 0x229 },
+			{ 0xca00328, 0x119 }, { 0xca0032d, 0x1e19 }, { 0xca00330, 0x1e1b }, { 0xcc00307, 0x1e1f },
+			{ 0xce00301, 0x1f5 }, { 0xce00302, 0x11d }, { 0xce00304, 0x1e21 }, { 0xce00306, 0x11f },
+			{ 0xce00307, 0x121 }, { 0xce0030c, 0x1e7 }, { 0xce00327, 0x123 }, { 0xd000302, 0x125 },
+			{ 0xd000307, 0x1e23 }, { 0xd000308, 0x1e27 }, { 0xd00030c, 0x21f }, { 0xd000323, 0x1e25 },
+			{ 0xd000327, 0x1e29 }, { 0xd00032e, 0x1e2b }, { 0xd000331, 0x1e96 }, { 0xd200300, 0xec },
+			{ 0xd200301, 0xed }, { 0xd200302, 0xee }, { 0xd200303, 0x129 }, { 0xd200304, 0x12b },
+			{ 0xd200306, 0x12d }, { 0xd200308, 0xef }, { 0xd200309, 0x1ec9 }, { 0xd20030c, 0x1d0 },
+			{ 0xd20030f, 0x209 }, { 0xd200311, 0x20b }, { 0xd200323, 0x1ecb }, { 0xd200328, 0x12f },
+			{ 0xd200330, 0x1e2d }, { 0xd400302, 0x135 }, { 0xd40030c, 0x1f0 }, { 0xd600301, 0x1e31 },
+			{ 0xd60030c, 0x1e9 }, { 0xd600323, 0x1e33 }, { 0xd600327, 0x137 }, { 0xd600331, 0x1e35 },
+			{ 0xd800301, 0x13a }, { 0xd80030c, 0x13e }, { 0xd800323, 0x1e37 }, { 0xd800327, 0x13c },
+			{ 0xd80032d, 0x1e3d }, { 0xd800331, 0x1e3b }, { 0xda00301, 0x1e3f }, { 0xda00307, 0x1e41 },
+			{ 0xda00323, 0x1e43 }, { 0xdc00300, 0x1f9 }, { 0xdc00301, 0x144 }, { 0xdc00303, 0xf1 },
+			{ 0xdc00307, 0x1e45 }, { 0xdc0030c, 0x148 }, { 0xdc00323, 0x1e47 }, { 0xdc00327, 0x146 },
+			{ 0xdc0032d, 0x1e4b }, { 0xdc00331, 0x1e49 }, { 0xde00300, 0xf2 }, { 0xde00301, 0xf3 },
+			{ 0xde00302, 0xf4 }, { 0xde00303, 0xf5 }, { 0xde00304, 0x14d }, { 0xde00306, 0x14f },
+			{ 0xde00307, 0x22f }, { 0xde00308, 0xf6 }, { 0xde00309, 0x1ecf }, { 0xde0030b, 0x151 },
+			{ 0xde0030c, 0x1d2 }, { 0xde0030f, 0x20d }, { 0xde00311, 0x20f }, { 0xde0031b, 0x1a1 },
+			{ 0xde00323, 0x1ecd }, { 0xde00328, 0x1eb }, { 0xe000301, 0x1e55 }, { 0xe000307, 0x1e57 },
+			{ 0xe400301, 0x155 }, { 0xe400307, 0x1e59 }, { 0xe40030c, 0x159 }, { 0xe40030f, 0x211 },
+			{ 0xe400311, 0x213 }, { 0xe400323, 0x1e5b }, { 0xe400327, 0x157 }, { 0xe400331, 0x1e5f },
+			{ 0xe600301, 0x15b }, { 0xe600302, 0x15d }, { 0xe600307, 0x1e61 }, { 0xe60030c, 0x161 },
+			{ 0xe600323, 0x1e63 }, { 0xe600326, 0x219 }, { 0xe600327, 0x15f }, { 0xe800307, 0x1e6b },
+			{ 0xe800308, 0x1e97 }, { 0xe80030c, 0x165 }, { 0xe800323, 0x1e6d }, { 0xe800326, 0x21b },
+			{ 0xe800327, 0x163 }, { 0xe80032d, 0x1e71 }, { 0xe800331, 0x1e6f }, { 0xea00300, 0xf9 },
+			{ 0xea00301, 0xfa }, { 0xea00302, 0xfb }, { 0xea00303, 0x169 }, { 0xea00304, 0x16b },
+			{ 0xea00306, 0x16d }, { 0xea00308, 0xfc }, { 0xea00309, 0x1ee7 }, { 0xea0030a, 0x16f },
+			{ 0xea0030b, 0x171 }, { 0xea0030c, 0x1d4 }, { 0xea0030f, 0x215 }, { 0xea00311, 0x217 },
+			{ 0xea0031b, 0x1b0 }, { 0xea00323, 0x1ee5 }, { 0xea00324, 0x1e73 }, { 0xea00328, 0x173 },
+			{ 0xea0032d, 0x1e77 }, { 0xea00330, 0x1e75 }, { 0xec00303, 0x1e7d }, { 0xec00323, 0x1e7f },
+			{ 0xee00300, 0x1e81 }, { 0xee00301, 0x1e83 }, { 0xee00302, 0x175 }, { 0xee00307, 0x1e87 },
+			{ 0xee00308, 0x1e85 }, { 0xee0030a, 0x1e98 }, { 0xee00323, 0x1e89 }, { 0xf000307, 0x1e8b },
+			{ 0xf000308, 0x1e8d }, { 0xf200300, 0x1ef3 }, { 0xf200301, 0xfd }, { 0xf200302, 0x177 },
+			{ 0xf200303, 0x1ef9 }, { 0xf200304, 0x233 }, { 0xf200307, 0x1e8f }, { 0xf200308, 0xff },
+			{ 0xf200309, 0x1ef7 }, { 0xf20030a, 0x1e99 }, { 0xf200323, 0x1ef5 }, { 0xf400301, 0x17a },
+			{ 0xf400302, 0x1e91 }, { 0xf400307, 0x17c }, { 0xf40030c, 0x17e }, { 0xf400323, 0x1e93 },
+			{ 0xf400331, 0x1e95 }, { 0x15000300, 0x1fed }, { 0x15000301, 0x385 }, { 0x15000342, 0x1fc1 },
+			{ 0x18400300, 0x1ea6 }, { 0x18400301, 0x1ea4 }, { 0x18400303, 0x1eaa }, { 0x18400309, 0x1ea8 },
+			{ 0x18800304, 0x1de }, { 0x18a00301, 0x1fa }, { 0x18c00301, 0x1fc }, { 0x18c00304, 0x1e2 },
+			{ 0x18e00301, 0x1e08 }, { 0x19400300, 0x1ec0 }, { 0x19400301, 0x1ebe }, { 0x19400303, 0x1ec4 },
+			{ 0x19400309, 0x1ec2 }, { 0x19e00301, 0x1e2e }, { 0x1a800300, 0x1ed2 }, { 0x1a800301, 0x1ed0 },
+			{ 0x1a800303, 0x1ed6 }, { 0x1a800309, 0x1ed4 }, { 0x1aa00301, 0x1e4c }, { 0x1aa00304, 0x22c },
+			{ 0x1aa00308, 0x1e4e }, { 0x1ac00304, 0x22a }, { 0x1b000301, 0x1fe }, { 0x1b800300, 0x1db },
+			{ 0x1b800301, 0x1d7 }, { 0x1b800304, 0x1d5 }, { 0x1b80030c, 0x1d9 }, { 0x1c400300, 0x1ea7 },
+			{ 0x1c400301, 0x1ea5 }, { 0x1c400303, 0x1eab }, { 0x1c400309, 0x1ea9 }, { 0x1c800304, 0x1df },
+			{ 0x1ca00301, 0x1fb }, { 0x1cc00301, 0x1fd }, { 0x1cc00304, 0x1e3 }, { 0x1ce00301, 0x1e09 },
+			{ 0x1d400300, 0x1ec1 }, { 0x1d400301, 0x1ebf }, { 0x1d400303, 0x1ec5 }, { 0x1d400309, 0x1ec3 },
+			{ 0x1de00301, 0x1e2f }, { 0x1e800300, 0x1ed3 }, { 0x1e800301, 0x1ed1 }, { 0x1e800303, 0x1ed7 },
+			{ 0x1e800309, 0x1ed5 }, { 0x1ea00301, 0x1e4d }, { 0x1ea00304, 0x22d }, { 0x1ea00308, 0x1e4f },
+			{ 0x1ec00304, 0x22b }, { 0x1f000301, 0x1ff }, { 0x1f800300, 0x1dc }, { 0x1f800301, 0x1d8 },
+			{ 0x1f800304, 0x1d6 }, { 0x1f80030c, 0x1da }, { 0x20400300, 0x1eb0 }, { 0x20400301, 0x1eae },
+			{ 0x20400303, 0x1eb4 }, { 0x20400309, 0x1eb2 }, { 0x20600300, 0x1eb1 }, { 0x20600301, 0x1eaf },
+			{ 0x20600303, 0x1eb5 }, { 0x20600309, 0x1eb3 }, { 0x22400300, 0x1e14 }, { 0x22400301, 0x1e16 },
+			{ 0x22600300, 0x1e15 }, { 0x22600301, 0x1e17 }, { 0x29800300, 0x1e50 }, { 0x29800301, 0x1e52 },
+			{ 0x29a00300, 0x1e51 }, { 0x29a00301, 0x1e53 }, { 0x2b400307, 0x1e64 }, { 0x2b600307, 0x1e65 },
+			{ 0x2c000307, 0x1e66 }, { 0x2c200307, 0x1e67 }, { 0x2d000301, 0x1e78 }, { 0x2d200301, 0x1e79 },
+			{ 0x2d400308, 0x1e7a }, { 0x2d600308, 0x1e7b }, { 0x2fe00307, 0x1e9b }, { 0x34000300, 0x1edc },
+			{ 0x34000301, 0x1eda }, { 0x34000303, 0x1ee0 }, { 0x34000309, 0x1ede }, { 0x34000323, 0x1ee2 },
+			{ 0x34200300, 0x1edd }, { 0x34200301, 0x1edb }, { 0x34200303, 0x1ee1 }, { 0x34200309, 0x1edf },
+			{ 0x34200323, 0x1ee3 }, { 0x35e00300, 0x1eea }, { 0x35e00301, 0x1ee8 }, { 0x35e00303, 0x1eee },
+			{ 0x35e00309, 0x1eec }, { 0x35e00323, 0x1ef0 }, { 0x36000300, 0x1eeb }, { 0x36000301, 0x1ee9 },
+			{ 0x36000303, 0x1eef }, { 0x36000309, 0x1eed }, { 0x36000323, 0x1ef1 }, { 0x36e0030c, 0x1ee },
+			{ 0x3d400304, 0x1ec }, { 0x3d600304, 0x1ed }, { 0x44c00304, 0x1e0 }, { 0x44e00304, 0x1e1 },
+			{ 0x45000306, 0x1e1c }, { 0x45200306, 0x1e1d }, { 0x45c00304, 0x230 }, { 0x45e00304, 0x231 },
+			{ 0x5240030c, 0x1ef }, { 0x72200300, 0x1fba }, { 0x72200301, 0x386 }, { 0x72200304, 0x1fb9 },
+			{ 0x72200306, 0x1fb8 }, { 0x72200313, 0x1f08 }, { 0x72200314, 0x1f09 }, { 0x72200345, 0x1fbc },
+			{ 0x72a00300, 0x1fc8 }, { 0x72a00301, 0x388 }, { 0x72a00313, 0x1f18 }, { 0x72a00314, 0x1f19 },
+			{ 0x72e00300, 0x1fca }, { 0x72e00301, 0x389 }, { 0x72e00313, 0x1f28 }, { 0x72e00314, 0x1f29 },
+			{ 0x72e00345, 0x1fcc }, { 0x73200300, 0x1fda }, { 0x73200301, 0x38a }, { 0x73200304, 0x1fd9 },
+			{ 0x73200306, 0x1fd8 }, { 0x73200308, 0x3aa }, { 0x73200313, 0x1f38 }, { 0x73200314, 0x1f39 },
+			{ 0x73e00300, 0x1ff8 }, { 0x73e00301, 0x38c }, { 0x73e00313, 0x1f48 }, { 0x73e00314, 0x1f49 },
+			{ 0x74200314, 0x1fec }, { 0x74a00300, 0x1fea }, { 0x74a00301, 0x38e }, { 0x74a00304, 0x1fe9 },
+			{ 0x74a00306, 0x1fe8 }, { 0x74a00308, 0x3ab }, { 0x74a00314, 0x1f59 }, { 0x75200300, 0x1ffa },
+			{ 0x75200301, 0x38f }, { 0x75200313, 0x1f68 }, { 0x75200314, 0x1f69 }, { 0x75200345, 0x1ffc },
+			{ 0x75800345, 0x1fb4 }, { 0x75c00345, 0x1fc4 }, { 0x76200300, 0x1f70 }, { 0x76200301, 0x3ac },
+			{ 0x76200304, 0x1fb1 }, { 0x76200306, 0x1fb0 }, { 0x76200313, 0x1f00 }, { 0x76200314, 0x1f01 },
+			{ 0x76200342, 0x1fb6 }, { 0x76200345, 0x1fb3 }, { 0x76a00300, 0x1f72 }, { 0x76a00301, 0x3ad },
+			{ 0x76a00313, 0x1f10 }, { 0x76a00314, 0x1f11 }, { 0x76e00300, 0x1f74 }, { 0x76e00301, 0x3ae },
+			{ 0x76e00313, 0x1f20 }, { 0x76e00314, 0x1f21 }, { 0x76e00342, 0x1fc6 }, { 0x76e00345, 0x1fc3 },
+			{ 0x77200300, 0x1f76 }, { 0x77200301, 0x3af }, { 0x77200304, 0x1fd1 }, { 0x77200306, 0x1fd0 },
+			{ 0x77200308, 0x3ca }, { 0x77200313, 0x1f30 }, { 0x77200314, 0x1f31 }, { 0x77200342, 0x1fd6 },
+			{ 0x77e00300, 0x1f78 }, { 0x77e00301, 0x3cc }, { 0x77e00313, 0x1f40 }, { 0x77e00314, 0x1f41 },
+			{ 0x78200313, 0x1fe4 }, { 0x78200314, 0x1fe5 }, { 0x78a00300, 0x1f7a }, { 0x78a00301, 0x3cd },
+			{ 0x78a00304, 0x1fe1 }, { 0x78a00306, 0x1fe0 }, { 0x78a00308, 0x3cb }, { 0x78a00313, 0x1f50 },
+			{ 0x78a00314, 0x1f51 }, { 0x78a00342, 0x1fe6 }, { 0x79200300, 0x1f7c }, { 0x79200301, 0x3ce },
+			{ 0x79200313, 0x1f60 }, { 0x79200314, 0x1f61 }, { 0x79200342, 0x1ff6 }, { 0x79200345, 0x1ff3 },
+			{ 0x79400300, 0x1fd2 }, { 0x79400301, 0x390 }, { 0x79400342, 0x1fd7 }, { 0x79600300, 0x1fe2 },
+			{ 0x79600301, 0x3b0 }, { 0x79600342, 0x1fe7 }, { 0x79c00345, 0x1ff4 }, { 0x7a400301, 0x3d3 },
+			{ 0x7a400308, 0x3d4 }, { 0x80c00308, 0x407 }, { 0x82000306, 0x4d0 }, { 0x82000308, 0x4d2 },
+			{ 0x82600301, 0x403 }, { 0x82a00300, 0x400 }, { 0x82a00306, 0x4d6 }, { 0x82a00308, 0x401 },
+			{ 0x82c00306, 0x4c1 }, { 0x82c00308, 0x4dc }, { 0x82e00308, 0x4de }, { 0x83000300, 0x40d },
+			{ 0x83000304, 0x4e2 }, { 0x83000306, 0x419 }, { 0x83000308, 0x4e4 }, { 0x83400301, 0x40c },
+			{ 0x83c00308, 0x4e6 }, { 0x84600304, 0x4ee }, { 0x84600306, 0x40e }, { 0x84600308, 0x4f0 },
+			{ 0x8460030b, 0x4f2 }, { 0x84e00308, 0x4f4 }, { 0x85600308, 0x4f8 }, { 0x85a00308, 0x4ec },
+			{ 0x86000306, 0x4d1 }, { 0x86000308, 0x4d3 }, { 0x86600301, 0x453 }, { 0x86a00300, 0x450 },
+			{ 0x86a00306, 0x4d7 }, { 0x86a00308, 0x451 }, { 0x86c00306, 0x4c2 }, { 0x86c00308, 0x4dd },
+			{ 0x86e00308, 0x4df }, { 0x87000300, 0x45d }, { 0x87000304, 0x4e3 }, { 0x87000306, 0x439 },
+			{ 0x87000308, 0x4e5 }, { 0x87400301, 0x45c }, { 0x87c00308, 0x4e7 }, { 0x88600304, 0x4ef },
+			{ 0x88600306, 0x45e }, { 0x88600308, 0x4f1 }, { 0x8860030b, 0x4f3 }, { 0x88e00308, 0x4f5 },
+			{ 0x89600308, 0x4f9 }, { 0x89a00308, 0x4ed }, { 0x8ac00308, 0x457 }, { 0x8e80030f, 0x476 },
+			{ 0x8ea0030f, 0x477 }, { 0x9b000308, 0x4da }, { 0x9b200308, 0x4db }, { 0x9d000308, 0x4ea },
+			{ 0x9d200308, 0x4eb }, { 0xc4e00653, 0x622 }, { 0xc4e00654, 0x623 }, { 0xc4e00655, 0x625 },
+			{ 0xc9000654, 0x624 }, { 0xc9400654, 0x626 }, { 0xd8200654, 0x6c2 }, { 0xda400654, 0x6d3 },
+			{ 0xdaa00654, 0x6c0 }, { 0x12500093c, 0x929 }, { 0x12600093c, 0x931 }, { 0x12660093c, 0x934 },
+			{ 0x138e009be, 0x9cb }, { 0x138e009d7, 0x9cc }, { 0x168e00b3e, 0xb4b }, { 0x168e00b56, 0xb48 },
+			{ 0x168e00b57, 0xb4c }, { 0x172400bd7, 0xb94 }, { 0x178c00bbe, 0xbca }, { 0x178c00bd7, 0xbcc },
+			{ 0x178e00bbe, 0xbcb }, { 0x188c00c56, 0xc48 }, { 0x197e00cd5, 0xcc0 }, { 0x198c00cc2, 0xcca },
+			{ 0x198c00cd5, 0xcc7 }, { 0x198c00cd6, 0xcc8 }, { 0x199400cd5, 0xccb }, { 0x1a8c00d3e, 0xd4a },
+			{ 0x1a8c00d57, 0xd4c }, { 0x1a8e00d3e, 0xd4b }, { 0x1bb200dca, 0xdda }, { 0x1bb200dcf, 0xddc },
+			{ 0x1bb200ddf, 0xdde }, { 0x1bb800dca, 0xddd }, { 0x204a0102e, 0x1026 }, { 0x360a01b35, 0x1b06 },
+			{ 0x360e01b35, 0x1b08 }, { 0x361201b35, 0x1b0a }, { 0x361601b35, 0x1b0c }, { 0x361a01b35, 0x1b0e },
+			{ 0x362201b35, 0x1b12 }, { 0x367401b35, 0x1b3b }, { 0x367801b35, 0x1b3d }, { 0x367c01b35, 0x1b40 },
+			{ 0x367e01b35, 0x1b41 }, { 0x368401b35, 0x1b43 }, { 0x3c6c00304, 0x1e38 }, { 0x3c6e00304, 0x1e39 },
+			{ 0x3cb400304, 0x1e5c }, { 0x3cb600304, 0x1e5d }, { 0x3cc400307, 0x1e68 }, { 0x3cc600307, 0x1e69 },
+			{ 0x3d4000302, 0x1eac }, { 0x3d4000306, 0x1eb6 }, { 0x3d4200302, 0x1ead }, { 0x3d4200306, 0x1eb7 },
+			{ 0x3d7000302, 0x1ec6 }, { 0x3d7200302, 0x1ec7 }, { 0x3d9800302, 0x1ed8 }, { 0x3d9a00302, 0x1ed9 },
+			{ 0x3e0000300, 0x1f02 }, { 0x3e0000301, 0x1f04 }, { 0x3e0000342, 0x1f06 }, { 0x3e0000345, 0x1f80 },
+			{ 0x3e0200300, 0x1f03 }, { 0x3e0200301, 0x1f05 }, { 0x3e0200342, 0x1f07 }, { 0x3e0200345, 0x1f81 },
+			{ 0x3e0400345, 0x1f82 }, { 0x3e0600345, 0x1f83 }, { 0x3e0800345, 0x1f84 }, { 0x3e0a00345, 0x1f85 },
+			{ 0x3e0c00345, 0x1f86 }, { 0x3e0e00345, 0x1f87 }, { 0x3e1000300, 0x1f0a }, { 0x3e1000301, 0x1f0c },
+			{ 0x3e1000342, 0x1f0e }, { 0x3e1000345, 0x1f88 }, { 0x3e1200300, 0x1f0b }, { 0x3e1200301, 0x1f0d },
+			{ 0x3e1200342, 0x1f0f }, { 0x3e1200345, 0x1f89 }, { 0x3e1400345, 0x1f8a }, { 0x3e1600345, 0x1f8b },
+			{ 0x3e1800345, 0x1f8c }, { 0x3e1a00345, 0x1f8d }, { 0x3e1c00345, 0x1f8e }, { 0x3e1e00345, 0x1f8f },
+			{ 0x3e2000300, 0x1f12 }, { 0x3e2000301, 0x1f14 }, { 0x3e2200300, 0x1f13 }, { 0x3e2200301, 0x1f15 },
+			{ 0x3e3000300, 0x1f1a }, { 0x3e3000301, 0x1f1c }, { 0x3e3200300, 0x1f1b }, { 0x3e3200301, 0x1f1d },
+			{ 0x3e4000300, 0x1f22 }, { 0x3e4000301, 0x1f24 }, { 0x3e4000342, 0x1f26 }, { 0x3e4000345, 0x1f90 },
+			{ 0x3e4200300, 0x1f23 }, { 0x3e4200301, 0x1f25 }, { 0x3e4200342, 0x1f27 }, { 0x3e4200345, 0x1f91 },
+			{ 0x3e4400345, 0x1f92 }, { 0x3e4600345, 0x1f93 }, { 0x3e4800345, 0x1f94 }, { 0x3e4a00345, 0x1f95 },
+			{ 0x3e4c00345, 0x1f96 }, { 0x3e4e00345, 0x1f97 }, { 0x3e5000300, 0x1f2a }, { 0x3e5000301, 0x1f2c },
+			{ 0x3e5000342, 0x1f2e }, { 0x3e5000345, 0x1f98 }, { 0x3e5200300, 0x1f2b }, { 0x3e5200301, 0x1f2d },
+			{ 0x3e5200342, 0x1f2f }, { 0x3e5200345, 0x1f99 }, { 0x3e5400345, 0x1f9a }, { 0x3e5600345, 0x1f9b },
+			{ 0x3e5800345, 0x1f9c }, { 0x3e5a00345, 0x1f9d }, { 0x3e5c00345, 0x1f9e }, { 0x3e5e00345, 0x1f9f },
+			{ 0x3e6000300, 0x1f32 }, { 0x3e6000301, 0x1f34 }, { 0x3e6000342, 0x1f36 }, { 0x3e6200300, 0x1f33 },
+			{ 0x3e6200301, 0x1f35 }, { 0x3e6200342, 0x1f37 }, { 0x3e7000300, 0x1f3a }, { 0x3e7000301, 0x1f3c },
+			{ 0x3e7000342, 0x1f3e }, { 0x3e7200300, 0x1f3b }, { 0x3e7200301, 0x1f3d }, { 0x3e7200342, 0x1f3f },
+			{ 0x3e8000300, 0x1f42 }, { 0x3e8000301, 0x1f44 }, { 0x3e8200300, 0x1f43 }, { 0x3e8200301, 0x1f45 },
+			{ 0x3e9000300, 0x1f4a }, { 0x3e9000301, 0x1f4c }, { 0x3e9200300, 0x1f4b }, { 0x3e9200301, 0x1f4d },
+			{ 0x3ea000300, 0x1f52 }, { 0x3ea000301, 0x1f54 }, { 0x3ea000342, 0x1f56 }, { 0x3ea200300, 0x1f53 },
+			{ 0x3ea200301, 0x1f55 }, { 0x3ea200342, 0x1f57 }, { 0x3eb200300, 0x1f5b }, { 0x3eb200301, 0x1f5d },
+			{ 0x3eb200342, 0x1f5f }, { 0x3ec000300, 0x1f62 }, { 0x3ec000301, 0x1f64 }, { 0x3ec000342, 0x1f66 },
+			{ 0x3ec000345, 0x1fa0 }, { 0x3ec200300, 0x1f63 }, { 0x3ec200301, 0x1f65 }, { 0x3ec200342, 0x1f67 },
+			{ 0x3ec200345, 0x1fa1 }, { 0x3ec400345, 0x1fa2 }, { 0x3ec600345, 0x1fa3 }, { 0x3ec800345, 0x1fa4 },
+			{ 0x3eca00345, 0x1fa5 }, { 0x3ecc00345, 0x1fa6 }, { 0x3ece00345, 0x1fa7 }, { 0x3ed000300, 0x1f6a },
+			{ 0x3ed000301, 0x1f6c }, { 0x3ed000342, 0x1f6e }, { 0x3ed000345, 0x1fa8 }, { 0x3ed200300, 0x1f6b },
+			{ 0x3ed200301, 0x1f6d }, { 0x3ed200342, 0x1f6f }, { 0x3ed200345, 0x1fa9 }, { 0x3ed400345, 0x1faa },
+			{ 0x3ed600345, 0x1fab }, { 0x3ed800345, 0x1fac }, { 0x3eda00345, 0x1fad }, { 0x3edc00345, 0x1fae },
+			{ 0x3ede00345, 0x1faf }, { 0x3ee000345, 0x1fb2 }, { 0x3ee800345, 0x1fc2 }, { 0x3ef800345, 0x1ff2 },
+			{ 0x3f6c00345, 0x1fb7 }, { 0x3f7e00300, 0x1fcd }, { 0x3f7e00301, 0x1fce }, { 0x3f7e00342, 0x1fcf },
+			{ 0x3f8c00345, 0x1fc7 }, { 0x3fec00345, 0x1ff7 }, { 0x3ffc00300, 0x1fdd }, { 0x3ffc00301, 0x1fde },
+			{ 0x3ffc00342, 0x1fdf }, { 0x432000338, 0x219a }, { 0x432400338, 0x219b }, { 0x432800338, 0x21ae },
+			{ 0x43a000338, 0x21cd }, { 0x43a400338, 0x21cf }, { 0x43a800338, 0x21ce }, { 0x440600338, 0x2204 },
+			{ 0x441000338, 0x2209 }, { 0x441600338, 0x220c }, { 0x444600338, 0x2224 }, { 0x444a00338, 0x2226 },
+			{ 0x447800338, 0x2241 }, { 0x448600338, 0x2244 }, { 0x448a00338, 0x2247 }, { 0x449000338, 0x2249 },
+			{ 0x449a00338, 0x226d }, { 0x44c200338, 0x2262 }, { 0x44c800338, 0x2270 }, { 0x44ca00338, 0x2271 },
+			{ 0x44e400338, 0x2274 }, { 0x44e600338, 0x2275 }, { 0x44ec00338, 0x2278 }, { 0x44ee00338, 0x2279 },
+			{ 0x44f400338, 0x2280 }, { 0x44f600338, 0x2281 }, { 0x44f800338, 0x22e0 }, { 0x44fa00338, 0x22e1 },
+			{ 0x450400338, 0x2284 }, { 0x450600338, 0x2285 }, { 0x450c00338, 0x2288 }, { 0x450e00338, 0x2289 },
+			{ 0x452200338, 0x22e2 }, { 0x452400338, 0x22e3 }, { 0x454400338, 0x22ac }, { 0x455000338, 0x22ad },
+			{ 0x455200338, 0x22ae }, { 0x455600338, 0x22af }, { 0x456400338, 0x22ea }, { 0x456600338, 0x22eb },
+			{ 0x456800338, 0x22ec }, { 0x456a00338, 0x22ed }, { 0x608c03099, 0x3094 }, { 0x609603099, 0x304c },
+			{ 0x609a03099, 0x304e }, { 0x609e03099, 0x3050 }, { 0x60a203099, 0x3052 }, { 0x60a603099, 0x3054 },
+			{ 0x60aa03099, 0x3056 }, { 0x60ae03099, 0x3058 }, { 0x60b203099, 0x305a }, { 0x60b603099, 0x305c },
+			{ 0x60ba03099, 0x305e }, { 0x60be03099, 0x3060 }, { 0x60c203099, 0x3062 }, { 0x60c803099, 0x3065 },
+			{ 0x60cc03099, 0x3067 }, { 0x60d003099, 0x3069 }, { 0x60de03099, 0x3070 }, { 0x60de0309a, 0x3071 },
+			{ 0x60e403099, 0x3073 }, { 0x60e40309a, 0x3074 }, { 0x60ea03099, 0x3076 }, { 0x60ea0309a, 0x3077 },
+			{ 0x60f003099, 0x3079 }, { 0x60f00309a, 0x307a }, { 0x60f603099, 0x307c }, { 0x60f60309a, 0x307d },
+			{ 0x613a03099, 0x309e }, { 0x614c03099, 0x30f4 }, { 0x615603099, 0x30ac }, { 0x615a03099, 0x30ae },
+			{ 0x615e03099, 0x30b0 }, { 0x616203099, 0x30b2 }, { 0x616603099, 0x30b4 }, { 0x616a03099, 0x30b6 },
+			{ 0x616e03099, 0x30b8 }, { 0x617203099, 0x30ba }, { 0x617603099, 0x30bc }, { 0x617a03099, 0x30be },
+			{ 0x617e03099, 0x30c0 }, { 0x618203099, 0x30c2 }, { 0x618803099, 0x30c5 }, { 0x618c03099, 0x30c7 },
+			{ 0x619003099, 0x30c9 }, { 0x619e03099, 0x30d0 }, { 0x619e0309a, 0x30d1 }, { 0x61a403099, 0x30d3 },
+			{ 0x61a40309a, 0x30d4 }, { 0x61aa03099, 0x30d6 }, { 0x61aa0309a, 0x30d7 }, { 0x61b003099, 0x30d9 },
+			{ 0x61b00309a, 0x30da }, { 0x61b603099, 0x30dc }, { 0x61b60309a, 0x30dd }, { 0x61de03099, 0x30f7 },
+			{ 0x61e003099, 0x30f8 }, { 0x61e203099, 0x30f9 }, { 0x61e403099, 0x30fa }, { 0x61fa03099, 0x30fe },
+			{ 0x22132110ba, 0x1109a }, { 0x22136110ba, 0x1109c }, { 0x2214a110ba, 0x110ab },
+			{ 0x2226211127, 0x1112e }, { 0x2226411127, 0x1112f }, { 0x2268e1133e, 0x1134b },
+			{ 0x2268e11357, 0x1134c }, { 0x22972114b0, 0x114bc }, { 0x22972114ba, 0x114bb },
+			{ 0x22972114bd, 0x114be }, { 0x22b70115af, 0x115ba }, { 0x22b72115af, 0x115bb },
+			{ 0x2326a11930, 0x11938 }
+		};
+	} // namespace __txt_detail
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#include <ztd/epilogue.hpp>
+
+#endif
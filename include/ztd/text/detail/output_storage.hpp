@@ -0,0 +1,199 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#pragma once
+
+#ifndef ZTD_TEXT_DETAIL_OUTPUT_STORAGE_HPP
+#define ZTD_TEXT_DETAIL_OUTPUT_STORAGE_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/idk/span.hpp>
+#include <ztd/idk/type_traits.hpp>
+#include <ztd/ranges/adl.hpp>
+#include <ztd/ranges/range.hpp>
+#include <ztd/ranges/algorithm.hpp>
+#include <ztd/ranges/detail/insert_bulk.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include <ztd/prologue.hpp>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	namespace __txt_detail {
+		template <typename _Storage>
+		using __detect_storage_resize
+			= decltype(::std::declval<_Storage&>().resize(::std::declval<::std::size_t>()));
+
+		template <typename _Storage>
+		using __detect_storage_data = decltype(::std::declval<_Storage&>().data());
+
+		template <typename _Storage>
+		using __detect_storage_capacity = decltype(::std::declval<const _Storage&>().capacity());
+
+		template <typename _Storage>
+		using __detect_storage_shrink_to_fit = decltype(::std::declval<_Storage&>().shrink_to_fit());
+
+		template <typename _Storage, typename _Value, typename = void>
+		class __is_direct_output_storage : public ::std::false_type { };
+
+		template <typename _Storage, typename _Value>
+		class __is_direct_output_storage<_Storage, _Value,
+			::std::enable_if_t<is_detected_v<__detect_storage_resize, _Storage> // cf
+			     && is_detected_v<__detect_storage_data, _Storage>>>
+		: public ::std::integral_constant<bool,
+			  ::ztd::ranges::is_range_contiguous_range_v<_Storage> // cf
+			       && ::std::is_same_v<__detect_storage_data<_Storage>, _Value*>> { };
+
+		//////
+		/// @brief Whether the given container can be grown in place and written through a `_Value*`, so that
+		/// conversions can write straight into its tail rather than through an intermediate buffer.
+		template <typename _Storage, typename _Value>
+		inline constexpr bool __is_direct_output_storage_v = __is_direct_output_storage<_Storage, _Value>::value;
+
+		//////
+		/// @brief Output storage for the `*_to` conversions that goes through a fixed intermediate buffer and
+		/// bulk-inserts what was written into the container.
+		///
+		/// @remarks Every room handed out is the whole buffer: `_ChunkSize` code units to convert into, followed by
+		/// `_Headroom` code units for partially-written sequences and error handler output.
+		template <typename _Storage, typename _Value, ::std::size_t _ChunkSize, ::std::size_t _Headroom>
+		class __buffered_output_storage {
+		public:
+			constexpr __buffered_output_storage(_Storage& __output) noexcept
+			: _M_output(::std::addressof(__output)), _M_buffer() {
+			}
+
+			constexpr ::ztd::span<_Value> _M_room() noexcept {
+				return ::ztd::span<_Value>(this->_M_buffer, _ChunkSize + _Headroom);
+			}
+
+			constexpr void _M_commit(::std::size_t __written) {
+				ranges::__rng_detail::__container_insert_bulk(
+					*this->_M_output, ::ztd::span<_Value>(this->_M_buffer, __written));
+			}
+
+			template <typename _Range>
+			constexpr void _M_append(const _Range& __range) {
+				ranges::__rng_detail::__container_insert_bulk(*this->_M_output, __range);
+			}
+
+		private:
+			_Storage* _M_output;
+			_Value _M_buffer[_ChunkSize + _Headroom];
+		};
+
+		//////
+		/// @brief Output storage for the `*_to` conversions that resizes the container and hands out its tail, so
+		/// the encoding writes every code unit exactly where it ends up.
+		///
+		/// @remarks Any capacity that was reserved beforehand is used up first, without reallocating. Past that,
+		/// the container grows geometrically (by at least `_ChunkSize + _Headroom` code units) whenever less than
+		/// twice the headroom is left. It is trimmed back to what was committed when this object goes away,
+		/// including when an error handler throws.
+		template <typename _Storage, typename _Value, ::std::size_t _ChunkSize, ::std::size_t _Headroom>
+		class __direct_output_storage {
+		public:
+			constexpr __direct_output_storage(_Storage& __output) noexcept(noexcept(::ztd::ranges::size(__output)))
+			: _M_output(::std::addressof(__output))
+			, _M_committed(static_cast<::std::size_t>(::ztd::ranges::size(__output))) {
+			}
+
+			__direct_output_storage(const __direct_output_storage&)            = delete;
+			__direct_output_storage& operator=(const __direct_output_storage&) = delete;
+
+			~__direct_output_storage() {
+				this->_M_output->resize(this->_M_committed);
+			}
+
+			constexpr ::ztd::span<_Value> _M_room() {
+				this->_M_reserve_room(_Headroom * 2);
+				return ::ztd::span<_Value>(this->_M_output->data() + this->_M_committed,
+					static_cast<::std::size_t>(::ztd::ranges::size(*this->_M_output)) - this->_M_committed);
+			}
+
+			constexpr void _M_commit(::std::size_t __written) noexcept {
+				this->_M_committed += __written;
+			}
+
+			template <typename _Range>
+			constexpr void _M_append(const _Range& __range) {
+				const ::std::size_t __range_size = static_cast<::std::size_t>(::ztd::ranges::size(__range));
+				this->_M_reserve_room(__range_size);
+				ranges::__rng_detail::__copy_n_unsafe(::ztd::ranges::cbegin(__range), __range_size,
+					this->_M_output->data() + this->_M_committed);
+				this->_M_committed += __range_size;
+			}
+
+		private:
+			constexpr void _M_reserve_room(::std::size_t __room) {
+				const ::std::size_t __size = static_cast<::std::size_t>(::ztd::ranges::size(*this->_M_output));
+				if (__size - this->_M_committed >= __room) {
+					return;
+				}
+				if constexpr (is_detected_v<__detect_storage_capacity, _Storage>) {
+					// use up whatever was reserved up-front (e.g. by an output sizing policy) before reallocating
+					const ::std::size_t __capacity = static_cast<::std::size_t>(this->_M_output->capacity());
+					if (__capacity - this->_M_committed >= __room) {
+						this->_M_output->resize(__capacity);
+						return;
+					}
+				}
+				::std::size_t __grown_size = __size + (__size / 2);
+				if (__grown_size < this->_M_committed + _ChunkSize + _Headroom) {
+					__grown_size = this->_M_committed + _ChunkSize + _Headroom;
+				}
+				if (__grown_size < this->_M_committed + __room) {
+					__grown_size = this->_M_committed + __room;
+				}
+				this->_M_output->resize(__grown_size);
+			}
+
+			_Storage* _M_output;
+			::std::size_t _M_committed;
+		};
+
+		template <typename _Storage, typename _Value, ::std::size_t _ChunkSize, ::std::size_t _Headroom>
+		using __output_storage_t = ::std::conditional_t<__is_direct_output_storage_v<_Storage, _Value>,
+			__direct_output_storage<_Storage, _Value, _ChunkSize, _Headroom>,
+			__buffered_output_storage<_Storage, _Value, _ChunkSize, _Headroom>>;
+	} // namespace __txt_detail
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#include <ztd/epilogue.hpp>
+
+#endif
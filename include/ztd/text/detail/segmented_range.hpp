@@ -0,0 +1,564 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#pragma once
+
+#ifndef ZTD_TEXT_DETAIL_SEGMENTED_RANGE_HPP
+#define ZTD_TEXT_DETAIL_SEGMENTED_RANGE_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/forward.hpp>
+#include <ztd/text/encoding_error.hpp>
+#include <ztd/text/max_units.hpp>
+#include <ztd/text/decode_result.hpp>
+#include <ztd/text/encode_result.hpp>
+#include <ztd/text/transcode_result.hpp>
+#include <ztd/text/count_result.hpp>
+#include <ztd/text/validate_result.hpp>
+
+#include <ztd/idk/span.hpp>
+#include <ztd/idk/tag.hpp>
+#include <ztd/idk/to_address.hpp>
+#include <ztd/idk/type_traits.hpp>
+#include <ztd/ranges/adl.hpp>
+#include <ztd/ranges/range.hpp>
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include <ztd/prologue.hpp>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	namespace __txt_detail {
+		template <typename _It, typename _Sentinel>
+		using __detect_adl_text_segment = decltype(text_segment(
+			::ztd::tag<_It> {}, ::std::declval<const _It&>(), ::std::declval<const _Sentinel&>()));
+
+		template <typename _Input>
+		using __segment_iterator_t
+			= decltype(::ztd::ranges::cbegin(::std::declval<::std::remove_reference_t<_Input>&>()));
+
+		template <typename _Input>
+		using __segment_sentinel_t
+			= decltype(::ztd::ranges::cend(::std::declval<::std::remove_reference_t<_Input>&>()));
+
+		template <typename _Input>
+		using __segment_unit_t = ::std::remove_cv_t<::ztd::ranges::range_value_type_t<remove_cvref_t<_Input>>>;
+
+		template <typename _Input, typename = void>
+		inline constexpr bool __is_segmented_range_v = false;
+
+		//////
+		/// @brief Whether `_Input` is a non-contiguous range whose iterators provide the `text_segment` extension
+		/// point, so that it can be converted one contiguous segment at a time.
+		template <typename _Input>
+		inline constexpr bool __is_segmented_range_v<_Input,
+			::std::void_t<__segment_iterator_t<_Input>, __segment_sentinel_t<_Input>>>
+			= !::ztd::ranges::is_range_contiguous_range_v<remove_cvref_t<_Input>> // cf
+			&& is_detected_v<__detect_adl_text_segment, __segment_iterator_t<_Input>, __segment_sentinel_t<_Input>>;
+
+		//////
+		/// @brief Whether `_Input` can be converted one contiguous segment at a time with the given states.
+		///
+		/// @remarks A sequence cut off by the end of a segment is read again, together with the start of the next
+		/// segment. Reading the first part of it may already have changed a state, so only encodings whose states
+		/// are empty go through the segments.
+		template <typename _Input, typename... _States>
+		inline constexpr bool __is_segmentable_v
+			= __is_segmented_range_v<_Input> && (::std::is_empty_v<remove_cvref_t<_States>> && ...);
+
+		// what one run over a window of code units (or code points) did: how much of it was read, and whether it
+		// stopped on an error or only because the window ended partway through a sequence
+		struct __segment_step {
+			::std::size_t _M_read;
+			encoding_error _M_error_code;
+			bool _M_partial;
+		};
+
+		//////
+		/// @brief Wraps an error handler so that an incomplete sequence at the end of a window is kept for the next
+		/// segment instead of being handed to the wrapped error handler.
+		template <typename _ErrorHandler>
+		class __segment_carry_handler {
+		public:
+			constexpr __segment_carry_handler(_ErrorHandler& __error_handler) noexcept
+			: _M_error_handler(::std::addressof(__error_handler)), _M_carried(false), _M_carried_size(0) {
+			}
+
+			template <typename _Encoding, typename _Result, typename _InputProgress, typename _OutputProgress>
+			constexpr auto operator()(const _Encoding& __encoding, _Result __result,
+				const _InputProgress& __input_progress, const _OutputProgress& __output_progress) const {
+				if (__result.error_code == encoding_error::incomplete_sequence) {
+					// not an error (yet): the rest of the sequence is in the next segment
+					this->_M_carried      = true;
+					this->_M_carried_size = ::ztd::ranges::size(__input_progress);
+					__result.error_count  = 0;
+					return __result;
+				}
+				return (*this->_M_error_handler)(
+					__encoding, ::std::move(__result), __input_progress, __output_progress);
+			}
+
+			constexpr void _M_reset() noexcept {
+				this->_M_carried      = false;
+				this->_M_carried_size = 0;
+			}
+
+			_ErrorHandler* _M_error_handler;
+			mutable bool _M_carried;
+			mutable ::std::size_t _M_carried_size;
+		};
+
+		template <typename _Unit, typename _Range>
+		constexpr ::std::size_t __segment_used(
+			const ::ztd::span<const _Unit>& __window, const _Range& __rest) noexcept {
+			return static_cast<::std::size_t>(::ztd::to_address(::ztd::ranges::cbegin(__rest)) - __window.data());
+		}
+
+		template <typename _Unit, typename _Result>
+		constexpr __segment_step __segment_step_of(
+			const ::ztd::span<const _Unit>& __window, const _Result& __result) noexcept {
+			return __segment_step { __segment_used(__window, __result.input), __result.error_code, false };
+		}
+
+		template <typename _Unit, typename _Result, typename _ErrorHandler>
+		constexpr __segment_step __segment_step_of(const ::ztd::span<const _Unit>& __window, const _Result& __result,
+			const __segment_carry_handler<_ErrorHandler>& __carry_handler) noexcept {
+			const ::std::size_t __used = __segment_used(__window, __result.input);
+			if (__carry_handler._M_carried) {
+				// encodings either leave the input at the start of an incomplete sequence or move it past what
+				// they read of it (reporting those code units as progress): take whichever comes first
+				const ::std::size_t __carried_first = __window.size() - __carry_handler._M_carried_size;
+				return __segment_step { __used < __carried_first ? __used : __carried_first, encoding_error::ok,
+					true };
+			}
+			return __segment_step { __used, __result.error_code, false };
+		}
+
+		template <::std::size_t _CarryMax, typename _Unit, typename _Result>
+		constexpr __segment_step __segment_validation_step_of(
+			const ::ztd::span<const _Unit>& __window, const _Result& __result, bool __last_window) noexcept {
+			const ::std::size_t __used = __segment_used(__window, __result.input);
+			if (__result.valid) {
+				return __segment_step { __used, encoding_error::ok, false };
+			}
+			if (!__last_window && (__window.size() - __used) < _CarryMax) {
+				// validation cannot tell a sequence cut off by the end of the window from an invalid one: check it
+				// again together with the start of the next segment
+				return __segment_step { __used, encoding_error::ok, true };
+			}
+			return __segment_step { __used, encoding_error::invalid_sequence, false };
+		}
+
+		//////
+		/// @brief Runs `__run` over each contiguous segment of [`__first`, `__last`) as given by `text_segment`,
+		/// stitching sequences that straddle two segments together in a carry buffer of `_CarryMax` units.
+		///
+		/// @param[in, out] __first The start of the input. On return, it is where the input stopped being read.
+		/// @param[in] __last The end of the input.
+		/// @param[in] __run Called as `__run(window, last_window)` with a ztd::span of units, and returns a
+		/// ztd::text::__txt_detail::__segment_step. When `last_window` is `false`, a sequence cut off by the end of
+		/// the window must be reported as partial rather than as an error.
+		///
+		/// @returns The error code the input stopped on.
+		///
+		/// @remarks Segments are handed to `__run` directly, without copying; only a sequence that straddles two
+		/// segments is copied, together with at most enough of the next segment to complete it.
+		template <typename _Unit, ::std::size_t _CarryMax, typename _It, typename _Sentinel, typename _Run>
+		constexpr encoding_error __segmented_run(_It& __first, const _Sentinel& __last, _Run& __run) {
+			using _Window     = ::ztd::span<const _Unit>;
+			using _Difference = ::ztd::ranges::iterator_difference_type_t<_It>;
+
+			::std::array<_Unit, _CarryMax> __carry {};
+			::std::size_t __carry_size = 0;
+			_It __carry_first          = __first;
+			for (;;) {
+				if (__first == __last) {
+					if (__carry_size == 0) {
+						return encoding_error::ok;
+					}
+					// the input ended partway through the carried sequence
+					__segment_step __step = __run(_Window(__carry.data(), __carry_size), true);
+					__first               = ::std::move(__carry_first);
+					::ztd::ranges::iter_advance(__first, static_cast<_Difference>(__step._M_read));
+					return __step._M_error_code;
+				}
+				auto&& __segment                   = text_segment(::ztd::tag<_It> {}, __first, __last);
+				const _Unit* __segment_data        = ::ztd::to_address(::ztd::ranges::cbegin(__segment));
+				const ::std::size_t __segment_size = static_cast<::std::size_t>(::ztd::ranges::size(__segment));
+				_It __segment_last                 = __first;
+				::ztd::ranges::iter_advance(__segment_last, static_cast<_Difference>(__segment_size));
+				const bool __last_segment = __segment_last == __last;
+				if (__carry_size == 0) {
+					_Window __window(__segment_data, __segment_size);
+					__segment_step __step = __run(__window, __last_segment);
+					if (__step._M_partial && (__segment_size - __step._M_read) >= _CarryMax) {
+						// longer than any sequence can be: let the real error handler have it
+						::ztd::ranges::iter_advance(__first, static_cast<_Difference>(__step._M_read));
+						__window = __window.subspan(__step._M_read);
+						__step   = __run(__window, true);
+					}
+					if (__step._M_error_code != encoding_error::ok) {
+						::ztd::ranges::iter_advance(__first, static_cast<_Difference>(__step._M_read));
+						return __step._M_error_code;
+					}
+					if (__step._M_partial) {
+						__carry_size = __segment_size - __step._M_read;
+						for (::std::size_t __index = 0; __index < __carry_size; ++__index) {
+							__carry[__index] = __segment_data[__step._M_read + __index];
+						}
+						__carry_first = ::std::move(__first);
+						::ztd::ranges::iter_advance(__carry_first, static_cast<_Difference>(__step._M_read));
+					}
+					__first = ::std::move(__segment_last);
+					continue;
+				}
+				// finish the carried sequence with just enough of this segment to complete it
+				const ::std::size_t __borrowed = __segment_size < (_CarryMax - __carry_size)
+					? __segment_size
+					: (_CarryMax - __carry_size);
+				for (::std::size_t __index = 0; __index < __borrowed; ++__index) {
+					__carry[__carry_size + __index] = __segment_data[__index];
+				}
+				const bool __whole_segment = __borrowed == __segment_size;
+				_Window __window(__carry.data(), __carry_size + __borrowed);
+				__segment_step __step = __run(__window, __whole_segment && __last_segment);
+				::std::size_t __read  = __step._M_read;
+				if (__step._M_partial && __read < __carry_size && !__whole_segment) {
+					// the carried sequence is still not complete with a full carry buffer: it is not going to be
+					__step = __run(__window.subspan(__read), true);
+					__read += __step._M_read;
+				}
+				if (__step._M_error_code != encoding_error::ok) {
+					__first = ::std::move(__carry_first);
+					::ztd::ranges::iter_advance(__first, static_cast<_Difference>(__read));
+					return __step._M_error_code;
+				}
+				if (__step._M_partial && __read < __carry_size) {
+					// this whole segment still does not finish the sequence
+					__carry_size = __window.size() - __read;
+					for (::std::size_t __index = 0; __index < __carry_size; ++__index) {
+						__carry[__index] = __window[__read + __index];
+					}
+					::ztd::ranges::iter_advance(__carry_first, static_cast<_Difference>(__read));
+					__first = ::std::move(__segment_last);
+					continue;
+				}
+				// the carried sequence is done: go on from wherever the window stopped, in this segment
+				__carry_size = 0;
+				__first      = ::std::move(__carry_first);
+				::ztd::ranges::iter_advance(__first, static_cast<_Difference>(__read));
+			}
+		}
+
+		// builds the __run for ztd::text::__txt_detail::__segmented_run out of something that converts one window
+		// with a given error handler: partial windows go through the carry handler, the last one through the real one
+		template <typename _ErrorHandler, typename _Convert>
+		constexpr auto __segment_converting_run(
+			__segment_carry_handler<_ErrorHandler>& __carry_handler, _Convert& __convert) {
+			return [&__carry_handler, &__convert](const auto& __window, bool __last_window) {
+				if (__last_window) {
+					return __segment_step_of(__window, __convert(__window, *__carry_handler._M_error_handler));
+				}
+				__carry_handler._M_reset();
+				return __segment_step_of(__window, __convert(__window, __carry_handler), __carry_handler);
+			};
+		}
+
+		template <typename _Input, typename _Encoding, typename _Output, typename _ErrorHandler, typename _State>
+		constexpr auto __segmented_decode_into_raw(_Input&& __input, _Encoding&& __encoding, _Output&& __output,
+			_ErrorHandler&& __error_handler, _State& __state) {
+			using _SubInput      = ::ztd::ranges::csubrange_for_t<::std::remove_reference_t<_Input>>;
+			using _Unit          = __segment_unit_t<_Input>;
+			using _Window        = ::ztd::span<const _Unit>;
+			using _InitialOutput = ::ztd::ranges::subrange_for_t<::std::remove_reference_t<_Output>>;
+			using _WindowResult  = decltype(::ztd::text::decode_into_raw(::std::declval<_Window>(), __encoding,
+				::std::declval<_InitialOutput>(), __error_handler, __state));
+			using _WorkingOutput = decltype(::std::declval<_WindowResult>().output);
+			using _Result        = decode_result<_SubInput, _WorkingOutput, _State>;
+
+			auto __first = ::ztd::ranges::cbegin(__input);
+			auto __last  = ::ztd::ranges::cend(__input);
+			_WorkingOutput __working_output(::std::forward<_Output>(__output));
+			::std::size_t __error_count = 0;
+			__segment_carry_handler<::std::remove_reference_t<_ErrorHandler>> __carry_handler(__error_handler);
+			auto __convert = [&](const _Window& __window, auto& __window_error_handler) {
+				auto __result = ::ztd::text::decode_into_raw(
+					__window, __encoding, ::std::move(__working_output), __window_error_handler, __state);
+				__working_output = ::std::move(__result.output);
+				__error_count += __result.error_count;
+				return __result;
+			};
+			auto __run = __segment_converting_run(__carry_handler, __convert);
+			const encoding_error __error_code
+				= __segmented_run<_Unit, max_code_units_v<remove_cvref_t<_Encoding>>>(__first, __last, __run);
+			return _Result(_SubInput(::std::move(__first), ::std::move(__last)), ::std::move(__working_output),
+				__state, __error_code, __error_count);
+		}
+
+		template <typename _Input, typename _Encoding, typename _Output, typename _ErrorHandler, typename _State>
+		constexpr auto __segmented_encode_into_raw(_Input&& __input, _Encoding&& __encoding, _Output&& __output,
+			_ErrorHandler&& __error_handler, _State& __state) {
+			using _SubInput      = ::ztd::ranges::csubrange_for_t<::std::remove_reference_t<_Input>>;
+			using _Unit          = __segment_unit_t<_Input>;
+			using _Window        = ::ztd::span<const _Unit>;
+			using _InitialOutput = ::ztd::ranges::subrange_for_t<::std::remove_reference_t<_Output>>;
+			using _WindowResult  = decltype(::ztd::text::encode_into_raw(::std::declval<_Window>(), __encoding,
+				::std::declval<_InitialOutput>(), __error_handler, __state));
+			using _WorkingOutput = decltype(::std::declval<_WindowResult>().output);
+			using _Result        = encode_result<_SubInput, _WorkingOutput, _State>;
+
+			auto __first = ::ztd::ranges::cbegin(__input);
+			auto __last  = ::ztd::ranges::cend(__input);
+			_WorkingOutput __working_output(::std::forward<_Output>(__output));
+			::std::size_t __error_count = 0;
+			__segment_carry_handler<::std::remove_reference_t<_ErrorHandler>> __carry_handler(__error_handler);
+			auto __convert = [&](const _Window& __window, auto& __window_error_handler) {
+				auto __result = ::ztd::text::encode_into_raw(
+					__window, __encoding, ::std::move(__working_output), __window_error_handler, __state);
+				__working_output = ::std::move(__result.output);
+				__error_count += __result.error_count;
+				return __result;
+			};
+			auto __run = __segment_converting_run(__carry_handler, __convert);
+			const encoding_error __error_code
+				= __segmented_run<_Unit, max_code_points_v<remove_cvref_t<_Encoding>>>(__first, __last, __run);
+			return _Result(_SubInput(::std::move(__first), ::std::move(__last)), ::std::move(__working_output),
+				__state, __error_code, __error_count);
+		}
+
+		template <typename _Input, typename _FromEncoding, typename _Output, typename _ToEncoding,
+			typename _FromErrorHandler, typename _ToErrorHandler, typename _FromState, typename _ToState,
+			typename _Pivot>
+		constexpr auto __segmented_transcode_into_raw(_Input&& __input, _FromEncoding&& __from_encoding,
+			_Output&& __output, _ToEncoding&& __to_encoding, _FromErrorHandler&& __from_error_handler,
+			_ToErrorHandler&& __to_error_handler, _FromState& __from_state, _ToState& __to_state,
+			_Pivot&& __pivot) {
+			using _SubInput      = ::ztd::ranges::csubrange_for_t<::std::remove_reference_t<_Input>>;
+			using _Unit          = __segment_unit_t<_Input>;
+			using _Window        = ::ztd::span<const _Unit>;
+			using _InitialOutput = ::ztd::ranges::subrange_for_t<::std::remove_reference_t<_Output>>;
+			using _WindowResult  = decltype(::ztd::text::transcode_into_raw(::std::declval<_Window>(),
+				__from_encoding, ::std::declval<_InitialOutput>(), __to_encoding, __from_error_handler,
+				__to_error_handler, __from_state, __to_state, __pivot));
+			using _WorkingOutput = decltype(::std::declval<_WindowResult>().output);
+			using _Result
+				= transcode_result<_SubInput, _WorkingOutput, _FromState, _ToState, remove_cvref_t<_Pivot>>;
+
+			auto __first = ::ztd::ranges::cbegin(__input);
+			auto __last  = ::ztd::ranges::cend(__input);
+			_WorkingOutput __working_output(::std::forward<_Output>(__output));
+			::std::size_t __error_count       = 0;
+			::std::size_t __pivot_error_count = 0;
+			encoding_error __pivot_error_code = encoding_error::ok;
+			__segment_carry_handler<::std::remove_reference_t<_FromErrorHandler>> __carry_handler(
+				__from_error_handler);
+			auto __convert = [&](const _Window& __window, auto& __window_error_handler) {
+				auto __result = ::ztd::text::transcode_into_raw(__window, __from_encoding,
+					::std::move(__working_output), __to_encoding, __window_error_handler, __to_error_handler,
+					__from_state, __to_state, __pivot);
+				__working_output = ::std::move(__result.output);
+				__error_count += __result.error_count;
+				__pivot_error_count += __result.pivot_error_count;
+				__pivot_error_code = __result.pivot_error_code;
+				return __result;
+			};
+			auto __run = __segment_converting_run(__carry_handler, __convert);
+			const encoding_error __error_code
+				= __segmented_run<_Unit, max_code_units_v<remove_cvref_t<_FromEncoding>>>(__first, __last, __run);
+			return _Result(_SubInput(::std::move(__first), ::std::move(__last)), ::std::move(__working_output),
+				__from_state, __to_state, __error_code, __error_count, ::std::forward<_Pivot>(__pivot),
+				__pivot_error_code, __pivot_error_count);
+		}
+
+		template <typename _Input, typename _Encoding, typename _ErrorHandler, typename _State>
+		constexpr auto __segmented_count_as_decoded(
+			_Input&& __input, _Encoding&& __encoding, _ErrorHandler&& __error_handler, _State& __state) {
+			using _SubInput = ::ztd::ranges::csubrange_for_t<::std::remove_reference_t<_Input>>;
+			using _Unit     = __segment_unit_t<_Input>;
+			using _Window   = ::ztd::span<const _Unit>;
+			using _Result   = count_result<_SubInput, _State>;
+
+			auto __first                = ::ztd::ranges::cbegin(__input);
+			auto __last                 = ::ztd::ranges::cend(__input);
+			::std::size_t __count       = 0;
+			::std::size_t __error_count = 0;
+			__segment_carry_handler<::std::remove_reference_t<_ErrorHandler>> __carry_handler(__error_handler);
+			auto __convert = [&](const _Window& __window, auto& __window_error_handler) {
+				auto __result
+					= ::ztd::text::count_as_decoded(__window, __encoding, __window_error_handler, __state);
+				__count += __result.count;
+				__error_count += __result.error_count;
+				return __result;
+			};
+			auto __run = __segment_converting_run(__carry_handler, __convert);
+			const encoding_error __error_code
+				= __segmented_run<_Unit, max_code_units_v<remove_cvref_t<_Encoding>>>(__first, __last, __run);
+			return _Result(_SubInput(::std::move(__first), ::std::move(__last)), __count, __state, __error_code,
+				__error_count);
+		}
+
+		template <typename _Input, typename _Encoding, typename _ErrorHandler, typename _State>
+		constexpr auto __segmented_count_as_encoded(
+			_Input&& __input, _Encoding&& __encoding, _ErrorHandler&& __error_handler, _State& __state) {
+			using _SubInput = ::ztd::ranges::csubrange_for_t<::std::remove_reference_t<_Input>>;
+			using _Unit     = __segment_unit_t<_Input>;
+			using _Window   = ::ztd::span<const _Unit>;
+			using _Result   = count_result<_SubInput, _State>;
+
+			auto __first                = ::ztd::ranges::cbegin(__input);
+			auto __last                 = ::ztd::ranges::cend(__input);
+			::std::size_t __count       = 0;
+			::std::size_t __error_count = 0;
+			__segment_carry_handler<::std::remove_reference_t<_ErrorHandler>> __carry_handler(__error_handler);
+			auto __convert = [&](const _Window& __window, auto& __window_error_handler) {
+				auto __result
+					= ::ztd::text::count_as_encoded(__window, __encoding, __window_error_handler, __state);
+				__count += __result.count;
+				__error_count += __result.error_count;
+				return __result;
+			};
+			auto __run = __segment_converting_run(__carry_handler, __convert);
+			const encoding_error __error_code
+				= __segmented_run<_Unit, max_code_points_v<remove_cvref_t<_Encoding>>>(__first, __last, __run);
+			return _Result(_SubInput(::std::move(__first), ::std::move(__last)), __count, __state, __error_code,
+				__error_count);
+		}
+
+		template <typename _Input, typename _FromEncoding, typename _ToEncoding, typename _FromErrorHandler,
+			typename _ToErrorHandler, typename _FromState, typename _ToState, typename _Pivot>
+		constexpr auto __segmented_count_as_transcoded(_Input&& __input, _FromEncoding&& __from_encoding,
+			_ToEncoding&& __to_encoding, _FromErrorHandler&& __from_error_handler,
+			_ToErrorHandler&& __to_error_handler, _FromState& __from_state, _ToState& __to_state,
+			_Pivot&& __pivot) {
+			using _SubInput = ::ztd::ranges::csubrange_for_t<::std::remove_reference_t<_Input>>;
+			using _Unit     = __segment_unit_t<_Input>;
+			using _Window   = ::ztd::span<const _Unit>;
+			using _Result   = count_transcode_result<_SubInput, _FromState, _ToState>;
+
+			auto __first                = ::ztd::ranges::cbegin(__input);
+			auto __last                 = ::ztd::ranges::cend(__input);
+			::std::size_t __count       = 0;
+			::std::size_t __error_count = 0;
+			__segment_carry_handler<::std::remove_reference_t<_FromErrorHandler>> __carry_handler(
+				__from_error_handler);
+			auto __convert = [&](const _Window& __window, auto& __window_error_handler) {
+				auto __result = ::ztd::text::count_as_transcoded(__window, __from_encoding, __to_encoding,
+					__window_error_handler, __to_error_handler, __from_state, __to_state, __pivot);
+				__count += __result.count;
+				__error_count += __result.error_count;
+				return __result;
+			};
+			auto __run = __segment_converting_run(__carry_handler, __convert);
+			const encoding_error __error_code
+				= __segmented_run<_Unit, max_code_units_v<remove_cvref_t<_FromEncoding>>>(__first, __last, __run);
+			return _Result(_SubInput(::std::move(__first), ::std::move(__last)), __count, __from_state, __to_state,
+				__error_code, __error_count);
+		}
+
+		template <typename _Input, typename _Encoding, typename _DecodeState, typename _EncodeState>
+		constexpr auto __segmented_validate_decodable_as(
+			_Input&& __input, _Encoding&& __encoding, _DecodeState& __decode_state, _EncodeState& __encode_state) {
+			using _SubInput = ::ztd::ranges::csubrange_for_t<::std::remove_reference_t<_Input>>;
+			using _Unit     = __segment_unit_t<_Input>;
+			using _Window   = ::ztd::span<const _Unit>;
+			using _Result   = validate_pivotless_transcode_result<_SubInput, _DecodeState, _EncodeState>;
+			constexpr ::std::size_t _CarryMax = max_code_units_v<remove_cvref_t<_Encoding>>;
+
+			auto __first = ::ztd::ranges::cbegin(__input);
+			auto __last  = ::ztd::ranges::cend(__input);
+			auto __run   = [&](const _Window& __window, bool __last_window) {
+				auto __result
+					= ::ztd::text::validate_decodable_as(__window, __encoding, __decode_state, __encode_state);
+				return __segment_validation_step_of<_CarryMax>(__window, __result, __last_window);
+			};
+			const encoding_error __error_code = __segmented_run<_Unit, _CarryMax>(__first, __last, __run);
+			return _Result(_SubInput(::std::move(__first), ::std::move(__last)), __error_code == encoding_error::ok,
+				__decode_state, __encode_state);
+		}
+
+		template <typename _Input, typename _Encoding, typename _EncodeState, typename _DecodeState>
+		constexpr auto __segmented_validate_encodable_as(
+			_Input&& __input, _Encoding&& __encoding, _EncodeState& __encode_state, _DecodeState& __decode_state) {
+			using _SubInput = ::ztd::ranges::csubrange_for_t<::std::remove_reference_t<_Input>>;
+			using _Unit     = __segment_unit_t<_Input>;
+			using _Window   = ::ztd::span<const _Unit>;
+			using _Result   = validate_pivotless_transcode_result<_SubInput, _EncodeState, _DecodeState>;
+			constexpr ::std::size_t _CarryMax = max_code_points_v<remove_cvref_t<_Encoding>>;
+
+			auto __first = ::ztd::ranges::cbegin(__input);
+			auto __last  = ::ztd::ranges::cend(__input);
+			auto __run   = [&](const _Window& __window, bool __last_window) {
+				auto __result
+					= ::ztd::text::validate_encodable_as(__window, __encoding, __encode_state, __decode_state);
+				return __segment_validation_step_of<_CarryMax>(__window, __result, __last_window);
+			};
+			const encoding_error __error_code = __segmented_run<_Unit, _CarryMax>(__first, __last, __run);
+			return _Result(_SubInput(::std::move(__first), ::std::move(__last)), __error_code == encoding_error::ok,
+				__encode_state, __decode_state);
+		}
+
+		template <typename _Input, typename _FromEncoding, typename _ToEncoding, typename _DecodeState,
+			typename _EncodeState, typename _Pivot>
+		constexpr auto __segmented_validate_transcodable_as(_Input&& __input, _FromEncoding&& __from_encoding,
+			_ToEncoding&& __to_encoding, _DecodeState& __decode_state, _EncodeState& __encode_state,
+			_Pivot&& __pivot) {
+			using _SubInput = ::ztd::ranges::csubrange_for_t<::std::remove_reference_t<_Input>>;
+			using _Unit     = __segment_unit_t<_Input>;
+			using _Window   = ::ztd::span<const _Unit>;
+			using _Result   = validate_pivotless_transcode_result<_SubInput, _DecodeState, _EncodeState>;
+			constexpr ::std::size_t _CarryMax = max_code_units_v<remove_cvref_t<_FromEncoding>>;
+
+			auto __first = ::ztd::ranges::cbegin(__input);
+			auto __last  = ::ztd::ranges::cend(__input);
+			auto __run   = [&](const _Window& __window, bool __last_window) {
+				auto __result = ::ztd::text::validate_transcodable_as(
+					__window, __from_encoding, __to_encoding, __decode_state, __encode_state, __pivot);
+				return __segment_validation_step_of<_CarryMax>(__window, __result, __last_window);
+			};
+			const encoding_error __error_code = __segmented_run<_Unit, _CarryMax>(__first, __last, __run);
+			return _Result(_SubInput(::std::move(__first), ::std::move(__last)), __error_code == encoding_error::ok,
+				__decode_state, __encode_state);
+		}
+
+	} // namespace __txt_detail
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#include <ztd/epilogue.hpp>
+
+#endif
@@ -0,0 +1,276 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#pragma once
+
+#ifndef ZTD_TEXT_DETAIL_SINGLE_BYTE_LOOKUP_TABLES_HPP
+#define ZTD_TEXT_DETAIL_SINGLE_BYTE_LOOKUP_TABLES_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/detail/unicode_kernels.hpp>
+
+#include <ztd/ranges/adl.hpp>
+#include <ztd/ranges/iterator.hpp>
+#include <ztd/encoding_tables/table_types.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <memory>
+#include <type_traits>
+
+#include <ztd/prologue.hpp>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	namespace __txt_detail {
+		//////
+		/// @brief The marker for a byte that does not decode to anything in a single-byte decode table.
+		inline constexpr ::std::uint_least32_t __single_byte_no_code_point = 0xFFFFFFFF;
+
+		//////
+		/// @brief The number of 256-code point pages covered by the first level of a single-byte encode table.
+		/// This covers planes 0 and 1; anything above is looked up with the original search.
+		inline constexpr ::std::size_t __single_byte_encode_page_limit = 0x200;
+
+		//////
+		/// @brief The marker bit in a second-level encode table entry which says the entry is mapped. The low 8
+		/// bits hold the byte.
+		inline constexpr ::std::uint_least16_t __single_byte_encode_mapped = 0x100;
+
+		//////
+		/// @brief A flat byte → code point table, with ztd::text::__txt_detail::__single_byte_no_code_point marking
+		/// unmapped bytes.
+		struct __single_byte_decode_table {
+			::std::uint_least32_t __code_points[256];
+		};
+
+		//////
+		/// @brief A two-level code point → byte table: the first level maps a code point's page (`code_point >> 8`)
+		/// to one of the used pages (1-based, 0 meaning "nothing in that page"), and the second level maps the low 8
+		/// bits to the byte.
+		template <::std::size_t _PageCount>
+		struct __single_byte_encode_table {
+			::std::uint_least16_t __page_index[__single_byte_encode_page_limit];
+			::std::uint_least16_t __pages[_PageCount][256];
+		};
+
+		// The two ways the encoding_tables lookups are used: either the lookup covers every byte, or the bottom half
+		// is ASCII and the lookup only covers the top half. Encoding always goes through index + 0x80.
+		template <bool _AsciiLow, ::ztd::et::basic_lookup_index_to_code_point_function* _LookupCodePoint>
+		constexpr ::std::optional<::std::uint_least32_t> __single_byte_search_code_point(
+			::std::size_t __byte) noexcept {
+			if constexpr (_AsciiLow) {
+				if (__byte < 0x80) {
+					return static_cast<::std::uint_least32_t>(__byte);
+				}
+				return _LookupCodePoint(__byte - 0x80);
+			}
+			else {
+				return _LookupCodePoint(__byte);
+			}
+		}
+
+		template <bool _AsciiLow, ::ztd::et::basic_lookup_code_point_to_index_function* _LookupIndex>
+		constexpr ::std::uint_least16_t __single_byte_search_byte(::std::uint_least32_t __code_point) noexcept {
+			if constexpr (_AsciiLow) {
+				if (__code_point < 0x80) {
+					return static_cast<::std::uint_least16_t>(__single_byte_encode_mapped | __code_point);
+				}
+			}
+			const ::std::optional<::std::size_t> __maybe_index = _LookupIndex(__code_point);
+			if (!__maybe_index) {
+				return 0;
+			}
+			return static_cast<::std::uint_least16_t>(
+				__single_byte_encode_mapped | static_cast<unsigned char>(*__maybe_index + 0x80));
+		}
+
+		template <bool _AsciiLow, ::ztd::et::basic_lookup_index_to_code_point_function* _LookupCodePoint>
+		constexpr __single_byte_decode_table __make_single_byte_decode_table() noexcept {
+			__single_byte_decode_table __table {};
+			for (::std::size_t __byte = 0; __byte < 256; ++__byte) {
+				const ::std::optional<::std::uint_least32_t> __maybe_code
+					= __single_byte_search_code_point<_AsciiLow, _LookupCodePoint>(__byte);
+				__table.__code_points[__byte] = __maybe_code ? *__maybe_code : __single_byte_no_code_point;
+			}
+			return __table;
+		}
+
+		// The encode direction is derived from the decode direction: every code point the search can find is one
+		// some byte decodes to. The stored byte still comes from the search, so results are identical.
+		template <bool _AsciiLow, ::ztd::et::basic_lookup_index_to_code_point_function* _LookupCodePoint,
+			::ztd::et::basic_lookup_code_point_to_index_function* _LookupIndex>
+		constexpr ::std::size_t __single_byte_encode_page_count() noexcept {
+			bool __page_used[__single_byte_encode_page_limit] {};
+			::std::size_t __page_count = 0;
+			for (::std::size_t __byte = 0; __byte < 256; ++__byte) {
+				const ::std::optional<::std::uint_least32_t> __maybe_code
+					= __single_byte_search_code_point<_AsciiLow, _LookupCodePoint>(__byte);
+				if (!__maybe_code || (*__maybe_code >> 8) >= __single_byte_encode_page_limit
+					|| __single_byte_search_byte<_AsciiLow, _LookupIndex>(*__maybe_code) == 0) {
+					continue;
+				}
+				const ::std::size_t __page = static_cast<::std::size_t>(*__maybe_code >> 8);
+				if (!__page_used[__page]) {
+					__page_used[__page] = true;
+					++__page_count;
+				}
+			}
+			// keep the array well-formed even for a table with nothing in it
+			return __page_count == 0 ? 1 : __page_count;
+		}
+
+		template <bool _AsciiLow, ::ztd::et::basic_lookup_index_to_code_point_function* _LookupCodePoint,
+			::ztd::et::basic_lookup_code_point_to_index_function* _LookupIndex>
+		constexpr auto __make_single_byte_encode_table() noexcept {
+			constexpr ::std::size_t __page_count
+				= __single_byte_encode_page_count<_AsciiLow, _LookupCodePoint, _LookupIndex>();
+			__single_byte_encode_table<__page_count> __table {};
+			::std::uint_least16_t __next_page = 0;
+			for (::std::size_t __byte = 0; __byte < 256; ++__byte) {
+				const ::std::optional<::std::uint_least32_t> __maybe_code
+					= __single_byte_search_code_point<_AsciiLow, _LookupCodePoint>(__byte);
+				if (!__maybe_code || (*__maybe_code >> 8) >= __single_byte_encode_page_limit) {
+					continue;
+				}
+				const ::std::uint_least16_t __entry
+					= __single_byte_search_byte<_AsciiLow, _LookupIndex>(*__maybe_code);
+				if (__entry == 0) {
+					continue;
+				}
+				const ::std::size_t __page = static_cast<::std::size_t>(*__maybe_code >> 8);
+				if (__table.__page_index[__page] == 0) {
+					++__next_page;
+					__table.__page_index[__page] = __next_page;
+				}
+				__table.__pages[__table.__page_index[__page] - 1][*__maybe_code & 0xFF] = __entry;
+			}
+			return __table;
+		}
+
+		template <bool _AsciiLow, ::ztd::et::basic_lookup_index_to_code_point_function* _LookupCodePoint>
+		inline constexpr __single_byte_decode_table __single_byte_decode_table_v
+			= __make_single_byte_decode_table<_AsciiLow, _LookupCodePoint>();
+
+		template <bool _AsciiLow, ::ztd::et::basic_lookup_index_to_code_point_function* _LookupCodePoint,
+			::ztd::et::basic_lookup_code_point_to_index_function* _LookupIndex>
+		inline constexpr auto __single_byte_encode_table_v
+			= __make_single_byte_encode_table<_AsciiLow, _LookupCodePoint, _LookupIndex>();
+
+		//////
+		/// @brief Looks up the byte for a code point. Returns an entry with
+		/// ztd::text::__txt_detail::__single_byte_encode_mapped set and the byte in the low 8 bits, or 0 if the code
+		/// point cannot be encoded.
+		template <bool _AsciiLow, ::ztd::et::basic_lookup_index_to_code_point_function* _LookupCodePoint,
+			::ztd::et::basic_lookup_code_point_to_index_function* _LookupIndex>
+		constexpr ::std::uint_least16_t __single_byte_encode_lookup(::std::uint_least32_t __code_point) noexcept {
+			constexpr const auto& __table = __single_byte_encode_table_v<_AsciiLow, _LookupCodePoint, _LookupIndex>;
+			if ((__code_point >> 8) < __single_byte_encode_page_limit) {
+				const ::std::uint_least16_t __page = __table.__page_index[__code_point >> 8];
+				if (__page == 0) {
+					return 0;
+				}
+				return __table.__pages[__page - 1][__code_point & 0xFF];
+			}
+			return __single_byte_search_byte<_AsciiLow, _LookupIndex>(__code_point);
+		}
+
+		//////
+		/// @brief Decodes as many bytes as possible through the table, stopping before the first unmapped byte or
+		/// when the output is full. The iterators are left at the stopping point.
+		///
+		/// @tparam _UseKernel Whether the input and output are contiguous, sized, and of a layout the vectorized
+		/// table lookup kernel can write directly.
+		template <bool _UseKernel, bool _AsciiLow,
+			::ztd::et::basic_lookup_index_to_code_point_function* _LookupCodePoint, typename _CodeUnit,
+			typename _CodePoint, typename _InIt, typename _InLast, typename _OutIt, typename _OutLast>
+		constexpr void __single_byte_decode_bulk(
+			_InIt& __in_it, const _InLast& __in_last, _OutIt& __out_it, const _OutLast& __out_last) noexcept {
+			constexpr const __single_byte_decode_table& __table
+				= __single_byte_decode_table_v<_AsciiLow, _LookupCodePoint>;
+			if constexpr (_UseKernel) {
+#if ZTD_IS_ON(ZTD_STD_LIBRARY_IS_CONSTANT_EVALUATED)
+				if (!::std::is_constant_evaluated())
+#endif
+				{
+					const ::std::size_t __input_size  = static_cast<::std::size_t>(__in_last - __in_it);
+					const ::std::size_t __output_size = static_cast<::std::size_t>(__out_last - __out_it);
+					const ::std::size_t __size = __input_size < __output_size ? __input_size : __output_size;
+					if (__size != 0) {
+						const ::std::size_t __converted
+							= __unicode_kernels().__lookup_8_to_32(::std::addressof(*__in_it), __size,
+							     ::std::addressof(*__out_it), __table.__code_points);
+						using _InDifference  = ::ztd::ranges::iterator_difference_type_t<_InIt>;
+						using _OutDifference = ::ztd::ranges::iterator_difference_type_t<_OutIt>;
+						::ztd::ranges::iter_advance(__in_it, static_cast<_InDifference>(__converted));
+						::ztd::ranges::iter_advance(__out_it, static_cast<_OutDifference>(__converted));
+					}
+				}
+			}
+			for (; __in_it != __in_last && __out_it != __out_last; ++__in_it, ++__out_it) {
+				const ::std::uint_least32_t __code
+					= __table.__code_points[static_cast<unsigned char>(static_cast<_CodeUnit>(*__in_it))];
+				if (__code == __single_byte_no_code_point) {
+					break;
+				}
+				*__out_it = static_cast<_CodePoint>(__code);
+			}
+		}
+
+		//////
+		/// @brief Encodes as many code points as possible through the two-level table, stopping before the first
+		/// code point that cannot be encoded or when the output is full. The iterators are left at the stopping
+		/// point.
+		template <bool _AsciiLow, ::ztd::et::basic_lookup_index_to_code_point_function* _LookupCodePoint,
+			::ztd::et::basic_lookup_code_point_to_index_function* _LookupIndex, typename _CodeUnit, typename _InIt,
+			typename _InLast, typename _OutIt, typename _OutLast>
+		constexpr void __single_byte_encode_bulk(
+			_InIt& __in_it, const _InLast& __in_last, _OutIt& __out_it, const _OutLast& __out_last) noexcept {
+			for (; __in_it != __in_last && __out_it != __out_last; ++__in_it, ++__out_it) {
+				const ::std::uint_least16_t __entry
+					= __single_byte_encode_lookup<_AsciiLow, _LookupCodePoint, _LookupIndex>(
+					     static_cast<ztd_char32_t>(*__in_it));
+				if (__entry == 0) {
+					break;
+				}
+				*__out_it = static_cast<_CodeUnit>(static_cast<unsigned char>(__entry));
+			}
+		}
+	} // namespace __txt_detail
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#include <ztd/epilogue.hpp>
+
+#endif
@@ -0,0 +1,388 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#pragma once
+
+#ifndef ZTD_TEXT_DETAIL_SPLICE_STORAGE_HPP
+#define ZTD_TEXT_DETAIL_SPLICE_STORAGE_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/code_point.hpp>
+#include <ztd/text/code_unit.hpp>
+#include <ztd/text/max_units.hpp>
+#include <ztd/text/state.hpp>
+#include <ztd/text/encode.hpp>
+#include <ztd/text/transcode.hpp>
+#include <ztd/text/count_as_encoded.hpp>
+#include <ztd/text/count_as_transcoded.hpp>
+#include <ztd/text/detail/encoding_range.hpp>
+#include <ztd/text/detail/output_storage.hpp>
+
+#include <ztd/idk/span.hpp>
+#include <ztd/idk/type_traits.hpp>
+#include <ztd/ranges/adl.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <cstddef>
+
+#include <ztd/prologue.hpp>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	namespace __txt_detail {
+		//////
+		/// @brief Whether the given storage can be grown in place and written through a pointer, so that a splice
+		/// can transcode straight into its tail rather than through an intermediate buffer.
+		template <typename _Storage>
+		inline constexpr bool __is_direct_splice_storage_v
+			= ::ztd::ranges::is_range_contiguous_range_v<_Storage> // cf
+			&& is_detected_v<__detect_storage_resize, _Storage>   // cf
+			&& is_detected_v<__detect_storage_data, _Storage>;
+
+		//////
+		/// @brief Shrinks the storage back to the last committed size if a splice is interrupted (e.g., by a
+		/// throwing error handler), so no unwritten code units are ever left in the storage.
+		template <typename _Storage>
+		class __splice_storage_guard {
+		public:
+			constexpr __splice_storage_guard(_Storage& __storage, ::std::size_t __committed_size) noexcept
+			: _M_storage(::std::addressof(__storage)), _M_committed_size(__committed_size) {
+			}
+
+			__splice_storage_guard(const __splice_storage_guard&)            = delete;
+			__splice_storage_guard& operator=(const __splice_storage_guard&) = delete;
+
+			constexpr void _M_release() noexcept {
+				this->_M_storage = nullptr;
+			}
+
+			~__splice_storage_guard() {
+				if (this->_M_storage != nullptr) {
+					this->_M_storage->resize(this->_M_committed_size);
+				}
+			}
+
+		private:
+			_Storage* _M_storage;
+			::std::size_t _M_committed_size;
+		};
+
+		//////
+		/// @brief Moves the code units appended past `__old_size` into position `__offset`, then removes the
+		/// `__erase_count` code units that used to sit there.
+		template <typename _Storage>
+		constexpr void __splice_appended_tail(
+			_Storage& __storage, ::std::size_t __offset, ::std::size_t __erase_count, ::std::size_t __old_size) {
+			if (__offset + __erase_count != __old_size) {
+				auto __first = ::ztd::ranges::begin(__storage);
+				::std::rotate(::std::next(__first, __offset + __erase_count), ::std::next(__first, __old_size),
+					::ztd::ranges::end(__storage));
+			}
+			if (__erase_count != 0) {
+				auto __first = ::std::next(::ztd::ranges::begin(__storage), __offset);
+				__storage.erase(__first, ::std::next(__first, __erase_count));
+			}
+		}
+
+		//////
+		/// @brief Gives back the capacity an upper-bound size hint grew the storage by, once most of it went unused.
+		///
+		/// @remarks Only done when the splice itself caused the storage to grow, so capacity reserved up-front by
+		/// the caller is kept.
+		template <typename _Storage>
+		constexpr void __splice_storage_shrink(_Storage& __storage, ::std::size_t __old_capacity) {
+			if constexpr (is_detected_v<__detect_storage_capacity, _Storage> // cf
+				&& is_detected_v<__detect_storage_shrink_to_fit, _Storage>) {
+				const ::std::size_t __capacity = static_cast<::std::size_t>(__storage.capacity());
+				const ::std::size_t __size     = static_cast<::std::size_t>(::ztd::ranges::size(__storage));
+				// more than half of it unused is more than ordinary geometric growth would leave behind
+				if (__capacity > __old_capacity && __capacity - __size > __size) {
+					__storage.shrink_to_fit();
+				}
+			}
+			else {
+				(void)__storage;
+				(void)__old_capacity;
+			}
+		}
+
+		template <typename _Storage>
+		constexpr ::std::size_t __splice_storage_capacity(const _Storage& __storage) noexcept {
+			if constexpr (is_detected_v<__detect_storage_capacity, _Storage>) {
+				return static_cast<::std::size_t>(__storage.capacity());
+			}
+			else {
+				(void)__storage;
+				return 0;
+			}
+		}
+
+		//////
+		/// @brief Whether ztd::text::count_as_encoded reaches a dedicated counting routine for these arguments, through
+		/// either the public or the internal extension point, making an exact size cheap enough to compute up-front.
+		template <typename _Input, typename _Encoding, typename _ErrorHandler>
+		inline constexpr bool __is_encode_splice_size_exact_v
+			= is_detected_v<__detect_adl_text_count_as_encoded, _Input&, _Encoding&, _ErrorHandler&,
+			       encode_state_t<remove_cvref_t<_Encoding>>> // cf
+			|| is_detected_v<__detect_adl_internal_text_count_as_encoded, _Input&, _Encoding&, _ErrorHandler&,
+			     encode_state_t<remove_cvref_t<_Encoding>>>;
+
+		//////
+		/// @brief Whether ztd::text::count_as_transcoded reaches a dedicated counting routine for these arguments,
+		/// through either the public or the internal extension point.
+		template <typename _Input, typename _FromEncoding, typename _ToEncoding, typename _FromErrorHandler,
+			typename _ToErrorHandler>
+		inline constexpr bool __is_transcode_splice_size_exact_v
+			= is_detected_v<__detect_adl_text_count_as_transcoded, _Input&, _FromEncoding&, _ToEncoding&,
+			       _FromErrorHandler&, _ToErrorHandler&, decode_state_t<remove_cvref_t<_FromEncoding>>,
+			       encode_state_t<remove_cvref_t<_ToEncoding>>,
+			       ::ztd::ranges::subrange<code_point_t<remove_cvref_t<_FromEncoding>>*>&> // cf
+			|| is_detected_v<__detect_adl_internal_text_count_as_transcoded, _Input&, _FromEncoding&, _ToEncoding&,
+			     _FromErrorHandler&, _ToErrorHandler&, decode_state_t<remove_cvref_t<_FromEncoding>>,
+			     encode_state_t<remove_cvref_t<_ToEncoding>>,
+			     ::ztd::ranges::subrange<code_point_t<remove_cvref_t<_FromEncoding>>*>&>;
+
+		template <typename _Input, typename _Encoding, typename _ErrorHandler>
+		constexpr ::std::size_t __encode_splice_size_hint(
+			_Input& __input, _Encoding& __encoding, _ErrorHandler& __error_handler) {
+			using _UEncoding = remove_cvref_t<_Encoding>;
+			using _State     = encode_state_t<_UEncoding>;
+			if constexpr (__is_encode_splice_size_exact_v<_Input, _Encoding, _ErrorHandler>) {
+				// the encoding has a dedicated counting routine: an exact size is cheap enough
+				_State __state = ::ztd::text::make_encode_state(__encoding);
+				return ::ztd::text::count_as_encoded(__input, __encoding, __error_handler, __state).count;
+			}
+			else {
+				(void)__encoding;
+				(void)__error_handler;
+				return static_cast<::std::size_t>(::ztd::ranges::size(__input)) * max_code_units_v<_UEncoding>;
+			}
+		}
+
+		template <typename _Input, typename _FromEncoding, typename _ToEncoding, typename _FromErrorHandler,
+			typename _ToErrorHandler>
+		constexpr ::std::size_t __transcode_splice_size_hint(_Input& __input, _FromEncoding& __from_encoding,
+			_ToEncoding& __to_encoding, _FromErrorHandler& __from_error_handler,
+			_ToErrorHandler& __to_error_handler) {
+			using _UFromEncoding = remove_cvref_t<_FromEncoding>;
+			using _UToEncoding   = remove_cvref_t<_ToEncoding>;
+			using _FromState     = decode_state_t<_UFromEncoding>;
+			using _ToState       = encode_state_t<_UToEncoding>;
+			using _CodePoint     = code_point_t<_UFromEncoding>;
+			using _PivotRange    = ::ztd::ranges::subrange<_CodePoint*>;
+			const ::std::size_t __input_size = static_cast<::std::size_t>(::ztd::ranges::size(__input));
+			if constexpr (::std::is_same_v<_UFromEncoding, _UToEncoding>) {
+				// same encoding on both sides: valid input maps one code unit to one code unit
+				(void)__from_encoding;
+				(void)__to_encoding;
+				(void)__from_error_handler;
+				(void)__to_error_handler;
+				return __input_size;
+			}
+			else if constexpr (__is_transcode_splice_size_exact_v<_Input, _FromEncoding, _ToEncoding,
+				                   _FromErrorHandler, _ToErrorHandler>) {
+				// the encoding pair has a dedicated counting routine: an exact size is cheap enough
+				_CodePoint __pivot_buffer[max_code_points_v<_UFromEncoding>] {};
+				_PivotRange __pivot(__pivot_buffer);
+				_FromState __from_state = ::ztd::text::make_decode_state(__from_encoding);
+				_ToState __to_state     = ::ztd::text::make_encode_state(__to_encoding);
+				return ::ztd::text::count_as_transcoded(__input, __from_encoding, __to_encoding, __from_error_handler,
+					__to_error_handler, __from_state, __to_state, __pivot)
+					.count;
+			}
+			else {
+				// every input code unit yields at most one full decode step worth of output
+				(void)__from_encoding;
+				(void)__to_encoding;
+				(void)__from_error_handler;
+				(void)__to_error_handler;
+				return __input_size * max_code_points_v<_UFromEncoding> * max_code_units_v<_UToEncoding>;
+			}
+		}
+
+		//////
+		/// @brief Encodes `__input` into `__storage`, replacing the `__erase_count` code units at `__offset`.
+		///
+		/// @returns The number of code units written into the storage.
+		///
+		/// @remarks When the storage is contiguous and resizable and the input is sized, the storage is grown once
+		/// by an exact (when cheap) or upper-bound size, the output is written directly into the new tail, and the
+		/// storage is then shrunk to what was actually written. If an error handler produces more than the bound,
+		/// the rest of the input is encoded from where it stopped (with the same state) through the container path
+		/// used by ztd::text::encode_to, which is also what any other storage or input goes through. Capacity
+		/// grown for an upper bound that went mostly unused is given back afterwards.
+		template <typename _Storage, typename _Input, typename _Encoding, typename _ErrorHandler>
+		constexpr ::std::size_t __encode_splice_into_storage(_Storage& __storage, ::std::size_t __offset,
+			::std::size_t __erase_count, _Input& __input, _Encoding& __encoding, _ErrorHandler& __error_handler) {
+			using _UEncoding = remove_cvref_t<_Encoding>;
+			using _CodeUnit  = code_unit_t<_UEncoding>;
+			using _State     = encode_state_t<_UEncoding>;
+			constexpr bool __size_hint_is_upper_bound = is_detected_v<::ztd::ranges::detect_adl_size, _Input&> // cf
+				&& !__is_encode_splice_size_exact_v<_Input, _Encoding, _ErrorHandler>;
+
+			const ::std::size_t __old_size     = static_cast<::std::size_t>(::ztd::ranges::size(__storage));
+			const ::std::size_t __old_capacity = __splice_storage_capacity(__storage);
+			_State __state                     = ::ztd::text::make_encode_state(__encoding);
+			if constexpr (__is_direct_splice_storage_v<_Storage>
+				&& is_detected_v<::ztd::ranges::detect_adl_size, _Input&>) {
+				const ::std::size_t __size_hint
+					= __encode_splice_size_hint(__input, __encoding, __error_handler)
+					+ max_encode_code_units_v<_UEncoding>;
+				__splice_storage_guard<_Storage> __guard(__storage, __old_size);
+				__storage.resize(__old_size + __size_hint);
+				_CodeUnit* __tail = __storage.data() + __old_size;
+				::ztd::span<_CodeUnit> __output(__tail, __size_hint);
+				auto __result
+					= ::ztd::text::encode_into_raw(__input, __encoding, __output, __error_handler, __state);
+				const ::std::size_t __written = static_cast<::std::size_t>(__result.output.data() - __tail);
+				__storage.resize(__old_size + __written);
+				if (__result.error_code == encoding_error::insufficient_output_space) {
+					// the hint was too small: keep what was written and carry on from where the encoding stopped,
+					// with the same state, so the error handler never sees the same input twice
+					__txt_detail::__intermediate_encode_to_storage(
+						::std::move(__result.input), __encoding, __storage, __error_handler, __state);
+				}
+				__guard._M_release();
+			}
+			else {
+				if constexpr (is_detected_v<::ztd::ranges::detect_adl_size, _Input&>) {
+					using _SizeType = decltype(::ztd::ranges::size(__storage));
+					if constexpr (is_detected_v<::ztd::ranges::detect_reserve_with_size, _Storage, _SizeType>) {
+						__storage.reserve(static_cast<_SizeType>(
+							__old_size + __encode_splice_size_hint(__input, __encoding, __error_handler)));
+					}
+				}
+				__txt_detail::__intermediate_encode_to_storage(
+					__input, __encoding, __storage, __error_handler, __state);
+			}
+			const ::std::size_t __written
+				= static_cast<::std::size_t>(::ztd::ranges::size(__storage)) - __old_size;
+			__splice_appended_tail(__storage, __offset, __erase_count, __old_size);
+			if constexpr (__size_hint_is_upper_bound) {
+				__splice_storage_shrink(__storage, __old_capacity);
+			}
+			else {
+				(void)__old_capacity;
+			}
+			return __written;
+		}
+
+		//////
+		/// @brief Transcodes `__input` into `__storage`, replacing the `__erase_count` code units at `__offset`.
+		///
+		/// @returns The number of code units written into the storage.
+		///
+		/// @remarks Follows the same strategy as ztd::text::__txt_detail::__encode_splice_into_storage, with the
+		/// buffered fallback being the one used by ztd::text::transcode_to.
+		template <typename _Storage, typename _Input, typename _FromEncoding, typename _ToEncoding,
+			typename _FromErrorHandler, typename _ToErrorHandler>
+		constexpr ::std::size_t __transcode_splice_into_storage(_Storage& __storage, ::std::size_t __offset,
+			::std::size_t __erase_count, _Input& __input, _FromEncoding& __from_encoding, _ToEncoding& __to_encoding,
+			_FromErrorHandler& __from_error_handler, _ToErrorHandler& __to_error_handler) {
+			using _UFromEncoding = remove_cvref_t<_FromEncoding>;
+			using _UToEncoding   = remove_cvref_t<_ToEncoding>;
+			using _CodeUnit      = code_unit_t<_UToEncoding>;
+			using _CodePoint     = code_point_t<_UFromEncoding>;
+			using _FromState     = decode_state_t<_UFromEncoding>;
+			using _ToState       = encode_state_t<_UToEncoding>;
+			using _PivotRange    = ::ztd::ranges::subrange<_CodePoint*>;
+
+			constexpr ::std::size_t __pivot_buffer_max
+				= ZTD_TEXT_INTERMEDIATE_TRANSCODE_BUFFER_SIZE_I_(_CodePoint) < max_code_points_v<_UFromEncoding>
+				? max_code_points_v<_UFromEncoding>
+				: ZTD_TEXT_INTERMEDIATE_TRANSCODE_BUFFER_SIZE_I_(_CodePoint);
+
+			constexpr bool __size_hint_is_upper_bound = is_detected_v<::ztd::ranges::detect_adl_size, _Input&> // cf
+				&& !::std::is_same_v<_UFromEncoding, _UToEncoding>                                             // cf
+				&& !__is_transcode_splice_size_exact_v<_Input, _FromEncoding, _ToEncoding, _FromErrorHandler,
+				     _ToErrorHandler>;
+
+			const ::std::size_t __old_size     = static_cast<::std::size_t>(::ztd::ranges::size(__storage));
+			const ::std::size_t __old_capacity = __splice_storage_capacity(__storage);
+			_FromState __from_state            = ::ztd::text::make_decode_state(__from_encoding);
+			_ToState __to_state                = ::ztd::text::make_encode_state(__to_encoding);
+			_CodePoint __pivot_buffer[__pivot_buffer_max] {};
+			_PivotRange __pivot(__pivot_buffer);
+			if constexpr (__is_direct_splice_storage_v<_Storage>
+				&& is_detected_v<::ztd::ranges::detect_adl_size, _Input&>) {
+				const ::std::size_t __size_hint
+					= __transcode_splice_size_hint(
+					       __input, __from_encoding, __to_encoding, __from_error_handler, __to_error_handler)
+					+ max_transcode_code_units_v<_UFromEncoding, _UToEncoding>;
+				__splice_storage_guard<_Storage> __guard(__storage, __old_size);
+				__storage.resize(__old_size + __size_hint);
+				_CodeUnit* __tail = __storage.data() + __old_size;
+				::ztd::span<_CodeUnit> __output(__tail, __size_hint);
+				auto __result = ::ztd::text::transcode_into_raw(__input, __from_encoding, __output, __to_encoding,
+					__from_error_handler, __to_error_handler, __from_state, __to_state);
+				const ::std::size_t __written = static_cast<::std::size_t>(__result.output.data() - __tail);
+				__storage.resize(__old_size + __written);
+				if (__result.error_code == encoding_error::insufficient_output_space) {
+					// same as encoding: resume from where the transcode stopped rather than starting over
+					__txt_detail::__intermediate_transcode_to_storage(::std::move(__result.input), __from_encoding,
+						__storage, __to_encoding, __from_error_handler, __to_error_handler, __from_state,
+						__to_state, __pivot);
+				}
+				__guard._M_release();
+			}
+			else {
+				if constexpr (is_detected_v<::ztd::ranges::detect_adl_size, _Input&>) {
+					using _SizeType = decltype(::ztd::ranges::size(__storage));
+					if constexpr (is_detected_v<::ztd::ranges::detect_reserve_with_size, _Storage, _SizeType>) {
+						__storage.reserve(static_cast<_SizeType>(__old_size
+							+ __transcode_splice_size_hint(__input, __from_encoding, __to_encoding,
+							     __from_error_handler, __to_error_handler)));
+					}
+				}
+				__txt_detail::__intermediate_transcode_to_storage(__input, __from_encoding, __storage,
+					__to_encoding, __from_error_handler, __to_error_handler, __from_state, __to_state, __pivot);
+			}
+			const ::std::size_t __written
+				= static_cast<::std::size_t>(::ztd::ranges::size(__storage)) - __old_size;
+			__splice_appended_tail(__storage, __offset, __erase_count, __old_size);
+			if constexpr (__size_hint_is_upper_bound) {
+				__splice_storage_shrink(__storage, __old_capacity);
+			}
+			else {
+				(void)__old_capacity;
+			}
+			return __written;
+		}
+	} // namespace __txt_detail
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#include <ztd/epilogue.hpp>
+
+#endif
@@ -0,0 +1,190 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#pragma once
+
+#ifndef ZTD_TEXT_DETAIL_TRANSCODE_CUNEICODE_REGISTRY_HPP
+#define ZTD_TEXT_DETAIL_TRANSCODE_CUNEICODE_REGISTRY_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/cuneicode_registry_encoding.hpp>
+#include <ztd/text/encoding_error.hpp>
+#include <ztd/text/transcode_one.hpp>
+#include <ztd/text/detail/bulk_convert.hpp>
+
+#include <ztd/idk/tag.hpp>
+#include <ztd/idk/type_traits.hpp>
+#include <ztd/ranges/adl.hpp>
+#include <ztd/ranges/range.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include <ztd/prologue.hpp>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	namespace __txt_detail {
+		template <typename _CodeUnit, typename _CodePoint>
+		::std::true_type __is_cnc_registry_encoding_test(
+			const basic_cuneicode_registry_encoding<_CodeUnit, _CodePoint>*);
+		::std::false_type __is_cnc_registry_encoding_test(const void*);
+
+		//////
+		/// @brief Whether or not the given type is (or derives from) a ztd::text::basic_cuneicode_registry_encoding.
+		template <typename _Type>
+		inline constexpr bool __is_cnc_registry_encoding_v
+			= decltype(__is_cnc_registry_encoding_test(static_cast<const _Type*>(nullptr)))::value;
+
+		struct __cnc_registry_transcoder {
+			template <typename _FromCodeUnit, typename _FromCodePoint, typename _ToCodeUnit, typename _ToCodePoint,
+				typename _Input, typename _Output, typename _FromErrorHandler, typename _ToErrorHandler,
+				typename _FromState, typename _ToState, typename _Pivot>
+			static auto _S_transcode(_Input&& __input,
+				const basic_cuneicode_registry_encoding<_FromCodeUnit, _FromCodePoint>& __from_encoding,
+				_Output&& __output,
+				const basic_cuneicode_registry_encoding<_ToCodeUnit, _ToCodePoint>& __to_encoding,
+				_FromErrorHandler&& __from_error_handler, _ToErrorHandler&& __to_error_handler,
+				_FromState& __from_state, _ToState& __to_state, _Pivot&& __pivot) {
+				using _FromRegistryEncoding = basic_cuneicode_registry_encoding<_FromCodeUnit, _FromCodePoint>;
+				using _ToRegistryEncoding   = basic_cuneicode_registry_encoding<_ToCodeUnit, _ToCodePoint>;
+				using _InitialInput  = ::ztd::ranges::csubrange_for_t<::std::remove_reference_t<_Input>>;
+				using _InitialOutput = ::ztd::ranges::subrange_for_t<::std::remove_reference_t<_Output>>;
+				using _Result = decltype(transcode_one_into_raw(::std::declval<_InitialInput>(), __from_encoding,
+					::std::declval<_InitialOutput>(), __to_encoding, __from_error_handler, __to_error_handler,
+					__from_state, __to_state, __pivot));
+				using _WorkingInput  = decltype(::std::declval<_Result>().input);
+				using _WorkingOutput = decltype(::std::declval<_Result>().output);
+
+				if constexpr (__txt_detail::__is_bulk_range_v<_WorkingInput, sizeof(_FromCodeUnit)> // cf
+					&& __txt_detail::__is_bulk_range_v<_WorkingOutput, sizeof(_ToCodeUnit)>) {
+					if (__from_encoding._M_paths->_M_registry == __to_encoding._M_paths->_M_registry) {
+						// the registry picks a direct conversion between the two names if it has one, and only
+						// pivots internally otherwise; either way, it is resolved once per pair of encodings
+						__cnc_conversion_handle __direct(
+							__from_encoding._M_paths->_M_direct_pool(__to_encoding._M_paths->_M_name));
+						if (__direct._M_is_valid()) {
+							// the direct conversion starts from the initial state, and so must the states used for
+							// the sequences it cannot convert
+							__from_state._M_restart();
+							__to_state._M_restart();
+							_WorkingInput __working_input(::std::forward<_Input>(__input));
+							_WorkingOutput __working_output(::std::forward<_Output>(__output));
+							::std::size_t __error_count       = 0;
+							::std::size_t __pivot_error_count = 0;
+							for (;;) {
+								if (::ztd::ranges::empty(__working_input)) {
+									break;
+								}
+								if (__direct._M_is_valid()) {
+									if (_FromRegistryEncoding::template _S_convert_bulk<_FromCodeUnit, _ToCodeUnit>(
+										     __direct._M_conversion, __working_input, __working_output)) {
+										continue;
+									}
+									if (::ztd::ranges::empty(__working_input)) {
+										break;
+									}
+								}
+								// the conversion stopped on something: go through the two encodings for
+								// exactly that sequence, so each error handler sees what it would otherwise
+								auto __transcode_result = transcode_one_into_raw(::std::move(__working_input),
+									__from_encoding, ::std::move(__working_output), __to_encoding,
+									__from_error_handler, __to_error_handler, __from_state, __to_state,
+									__pivot);
+								__error_count += __transcode_result.error_count;
+								__pivot_error_count += __transcode_result.pivot_error_count;
+								__working_input  = ::std::move(__transcode_result.input);
+								__working_output = ::std::move(__transcode_result.output);
+								if (__transcode_result.error_code != encoding_error::ok) {
+									return _Result(::std::move(__working_input), ::std::move(__working_output),
+										__from_state, __to_state, __transcode_result.error_code,
+										__error_count, ::std::move(__transcode_result.pivot),
+										__transcode_result.pivot_error_code, __pivot_error_count);
+								}
+								// the direct conversion stopped partway into that sequence, and the states only
+								// know about that one sequence: start all three over from the same place
+								__direct._M_restart();
+								__from_state._M_restart();
+								__to_state._M_restart();
+							}
+							return _Result(::std::move(__working_input), ::std::move(__working_output),
+								__from_state, __to_state, encoding_error::ok, __error_count,
+								::std::forward<_Pivot>(__pivot), encoding_error::ok, __pivot_error_count);
+						}
+					}
+				}
+				return basic_transcode_into_raw(::std::forward<_Input>(__input), __from_encoding,
+					::std::forward<_Output>(__output), __to_encoding,
+					::std::forward<_FromErrorHandler>(__from_error_handler),
+					::std::forward<_ToErrorHandler>(__to_error_handler), __from_state, __to_state,
+					::std::forward<_Pivot>(__pivot));
+			}
+		};
+	} // namespace __txt_detail
+
+	//////
+	/// @brief Transcodes between two ztd::text::basic_cuneicode_registry_encoding-based encodings with one cuneicode
+	/// conversion that goes directly from the source's name to the destination's name, handing whole (contiguous)
+	/// input and output ranges to `cnc_conv` at once.
+	///
+	/// @remarks The conversion is resolved once per pair of encodings and pooled. Where it stops (an ill-formed or
+	/// incomplete sequence, a character the destination cannot represent, or not enough output space), that one
+	/// sequence is transcoded with ztd::text::transcode_one_into_raw through `__from_state` and `__to_state`, so error
+	/// handlers and the returned ranges behave as they do without this extension point. The direct conversion does
+	/// not share state with `__from_state` or `__to_state`, so all three are started over from the initial state
+	/// wherever one hands off to the other: both states before the conversion begins, and all three after every
+	/// sequence the states convert. The direct conversion and both states are held by handles that give their
+	/// conversions back to the pool however the transcode is left. Encodings from different registries and
+	/// non-contiguous ranges fall back to ztd::text::basic_transcode_into_raw.
+	template <typename _FromRegistryEncoding, typename _ToRegistryEncoding, typename _Input, typename _FromEncoding,
+		typename _Output, typename _ToEncoding, typename _FromErrorHandler, typename _ToErrorHandler,
+		typename _FromState, typename _ToState, typename _Pivot,
+		::std::enable_if_t<__txt_detail::__is_cnc_registry_encoding_v<_FromRegistryEncoding> // cf
+		     && __txt_detail::__is_cnc_registry_encoding_v<_ToRegistryEncoding>>* = nullptr>
+	auto __text_transcode(::ztd::tag<_FromRegistryEncoding, _ToRegistryEncoding>, _Input&& __input,
+		_FromEncoding&& __from_encoding, _Output&& __output, _ToEncoding&& __to_encoding,
+		_FromErrorHandler&& __from_error_handler, _ToErrorHandler&& __to_error_handler, _FromState& __from_state,
+		_ToState& __to_state, _Pivot&& __pivot) {
+		return __txt_detail::__cnc_registry_transcoder::_S_transcode(::std::forward<_Input>(__input),
+			__from_encoding, ::std::forward<_Output>(__output), __to_encoding,
+			::std::forward<_FromErrorHandler>(__from_error_handler),
+			::std::forward<_ToErrorHandler>(__to_error_handler), __from_state, __to_state,
+			::std::forward<_Pivot>(__pivot));
+	}
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#include <ztd/epilogue.hpp>
+
+#endif
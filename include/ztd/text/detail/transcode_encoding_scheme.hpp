@@ -0,0 +1,281 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#pragma once
+
+#ifndef ZTD_TEXT_DETAIL_TRANSCODE_ENCODING_SCHEME_HPP
+#define ZTD_TEXT_DETAIL_TRANSCODE_ENCODING_SCHEME_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/basic_encoding_scheme.hpp>
+#include <ztd/text/encoding_error.hpp>
+#include <ztd/text/transcode_one.hpp>
+#include <ztd/text/detail/unicode_kernels.hpp>
+#include <ztd/text/detail/transcode_unicode_kernels.hpp>
+
+#include <ztd/idk/endian.hpp>
+#include <ztd/idk/tag.hpp>
+#include <ztd/idk/type_traits.hpp>
+#include <ztd/ranges/adl.hpp>
+#include <ztd/ranges/range.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include <ztd/prologue.hpp>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	namespace __txt_detail {
+		//////
+		/// @brief The code unit width of a UTF-16 or UTF-32 ztd::text::encoding_scheme over single bytes, or `0` if
+		/// the bulk Unicode kernels cannot be used on the encoding scheme.
+		template <typename _Encoding>
+		struct __unicode_kernel_scheme {
+			inline static constexpr ::std::size_t __width = 0;
+		};
+
+		template <typename _Encoding, endian _Endian, typename _Byte>
+		struct __unicode_kernel_scheme<encoding_scheme<_Encoding, _Endian, _Byte>> {
+		private:
+			inline static constexpr ::std::size_t __base_width
+				= __unicode_kernel_width_v<unwrap_remove_cvref_t<_Encoding>>;
+
+		public:
+			using __code_unit = code_unit_t<unwrap_remove_cvref_t<_Encoding>>;
+
+			inline static constexpr ::std::size_t __width
+				= (sizeof(_Byte) == 1 && (__base_width == 16 || __base_width == 32)) ? __base_width : 0;
+			inline static constexpr bool __swap = _Endian != endian::native;
+		};
+
+		template <typename _Encoding>
+		inline constexpr ::std::size_t __unicode_kernel_scheme_width_v = __unicode_kernel_scheme<_Encoding>::__width;
+
+		template <typename _Scheme>
+		struct __unicode_scheme_transcoder {
+			using _CodeUnit = typename __unicode_kernel_scheme<_Scheme>::__code_unit;
+
+			inline static constexpr ::std::size_t _SchemeWidth = __unicode_kernel_scheme<_Scheme>::__width;
+			inline static constexpr bool _Swap                 = __unicode_kernel_scheme<_Scheme>::__swap;
+			inline static constexpr ::std::size_t _BlockSize
+				= ZTD_TEXT_INTERMEDIATE_TRANSCODE_BUFFER_SIZE_I_(_CodeUnit);
+
+			//////
+			/// @brief Swaps one block of the scheme's bytes into native code units and transcodes it straight into
+			/// the UTF-8 output.
+			///
+			/// @returns Whether or not anything was transcoded.
+			template <typename _WorkingInput, typename _WorkingOutput>
+			static bool _S_from_scheme_block(_WorkingInput& __working_input, _WorkingOutput& __working_output) {
+				const ::std::size_t __output_size
+					= static_cast<::std::size_t>(::ztd::ranges::size(__working_output));
+				::std::size_t __block_size
+					= static_cast<::std::size_t>(::ztd::ranges::size(__working_input)) / sizeof(_CodeUnit);
+				if (__block_size > _BlockSize) {
+					__block_size = _BlockSize;
+				}
+				if (__block_size == 0 || __output_size == 0) {
+					return false;
+				}
+				_CodeUnit __units[_BlockSize];
+				__unicode_copy_units_kernel<_SchemeWidth, _Swap>(
+					__unicode_kernel_data(__working_input), __block_size, __units);
+				const __unicode_kernel_result __result = __unicode_transcode_kernel<_SchemeWidth, 8>(
+					__units, __block_size, __unicode_kernel_data(__working_output), __output_size);
+				if (__result.__read == 0) {
+					return false;
+				}
+				__working_input  = __unicode_kernel_advance(__working_input, __result.__read * sizeof(_CodeUnit));
+				__working_output = __unicode_kernel_advance(__working_output, __result.__written);
+				return true;
+			}
+
+			//////
+			/// @brief Transcodes one block of the UTF-8 input into native code units and swaps them into the
+			/// scheme's bytes on the way to the output.
+			///
+			/// @returns Whether or not anything was transcoded.
+			template <typename _WorkingInput, typename _WorkingOutput>
+			static bool _S_to_scheme_block(_WorkingInput& __working_input, _WorkingOutput& __working_output) {
+				::std::size_t __output_size
+					= static_cast<::std::size_t>(::ztd::ranges::size(__working_output)) / sizeof(_CodeUnit);
+				if (__output_size > _BlockSize) {
+					__output_size = _BlockSize;
+				}
+				if (__output_size == 0) {
+					return false;
+				}
+				_CodeUnit __units[_BlockSize];
+				const __unicode_kernel_result __result = __unicode_transcode_kernel<8, _SchemeWidth>(
+					__unicode_kernel_data(__working_input),
+					static_cast<::std::size_t>(::ztd::ranges::size(__working_input)), __units, __output_size);
+				if (__result.__read == 0) {
+					return false;
+				}
+				__unicode_copy_units_kernel<_SchemeWidth, _Swap>(
+					__units, __result.__written, __unicode_kernel_data(__working_output));
+				__working_input  = __unicode_kernel_advance(__working_input, __result.__read);
+				__working_output
+					= __unicode_kernel_advance(__working_output, __result.__written * sizeof(_CodeUnit));
+				return true;
+			}
+
+			template <bool _FromScheme, typename _Input, typename _FromEncoding, typename _Output,
+				typename _ToEncoding, typename _FromErrorHandler, typename _ToErrorHandler, typename _FromState,
+				typename _ToState, typename _Pivot>
+			static constexpr auto _S_transcode(_Input&& __input, _FromEncoding&& __from_encoding, _Output&& __output,
+				_ToEncoding&& __to_encoding, _FromErrorHandler&& __from_error_handler,
+				_ToErrorHandler&& __to_error_handler, _FromState& __from_state, _ToState& __to_state,
+				_Pivot&& __pivot) {
+				using _InitialInput  = ::ztd::ranges::csubrange_for_t<::std::remove_reference_t<_Input>>;
+				using _InitialOutput = ::ztd::ranges::subrange_for_t<::std::remove_reference_t<_Output>>;
+				using _Result = decltype(transcode_one_into_raw(::std::declval<_InitialInput>(), __from_encoding,
+					::std::declval<_InitialOutput>(), __to_encoding, __from_error_handler, __to_error_handler,
+					__from_state, __to_state, __pivot));
+				using _WorkingInput  = decltype(::std::declval<_Result>().input);
+				using _WorkingOutput = decltype(::std::declval<_Result>().output);
+
+				// both sides are byte-sized: the scheme's bytes on one, UTF-8 code units on the other
+				if constexpr (__is_unicode_kernel_range_v<_WorkingInput, 8>                              // cf
+					&& __is_unicode_kernel_range_v<_WorkingOutput, 8>                                   // cf
+					&& ::std::is_trivially_copyable_v<::ztd::ranges::range_value_type_t<_WorkingInput>> // cf
+					&& ::std::is_trivially_copyable_v<::ztd::ranges::range_value_type_t<_WorkingOutput>>) {
+#if ZTD_IS_ON(ZTD_STD_LIBRARY_IS_CONSTANT_EVALUATED)
+					if (!::std::is_constant_evaluated())
+#endif
+					{
+						_WorkingInput __working_input(::std::forward<_Input>(__input));
+						_WorkingOutput __working_output(::std::forward<_Output>(__output));
+						::std::size_t __error_count       = 0;
+						::std::size_t __pivot_error_count = 0;
+						for (;;) {
+							if (::ztd::ranges::empty(__working_input)) {
+								break;
+							}
+							bool __progressed = false;
+							if constexpr (_FromScheme) {
+								__progressed = _S_from_scheme_block(__working_input, __working_output);
+							}
+							else {
+								__progressed = _S_to_scheme_block(__working_input, __working_output);
+							}
+							if (__progressed) {
+								continue;
+							}
+							// the kernels stopped on something (an error, a sequence split across blocks, or a
+							// full output): go through both encodings for exactly that sequence
+							auto __transcode_result = transcode_one_into_raw(::std::move(__working_input),
+								__from_encoding, ::std::move(__working_output), __to_encoding,
+								__from_error_handler, __to_error_handler, __from_state, __to_state, __pivot);
+							__error_count += __transcode_result.error_count;
+							__pivot_error_count += __transcode_result.pivot_error_count;
+							__working_input  = ::std::move(__transcode_result.input);
+							__working_output = ::std::move(__transcode_result.output);
+							if (__transcode_result.error_code != encoding_error::ok) {
+								return _Result(::std::move(__working_input), ::std::move(__working_output),
+									__from_state, __to_state, __transcode_result.error_code, __error_count,
+									::std::move(__transcode_result.pivot), __transcode_result.pivot_error_code,
+									__pivot_error_count);
+							}
+						}
+						return _Result(::std::move(__working_input), ::std::move(__working_output), __from_state,
+							__to_state, encoding_error::ok, __error_count, ::std::forward<_Pivot>(__pivot),
+							encoding_error::ok, __pivot_error_count);
+					}
+				}
+				return basic_transcode_into_raw(::std::forward<_Input>(__input),
+					::std::forward<_FromEncoding>(__from_encoding), ::std::forward<_Output>(__output),
+					::std::forward<_ToEncoding>(__to_encoding),
+					::std::forward<_FromErrorHandler>(__from_error_handler),
+					::std::forward<_ToErrorHandler>(__to_error_handler), __from_state, __to_state,
+					::std::forward<_Pivot>(__pivot));
+			}
+		};
+	} // namespace __txt_detail
+
+	//////
+	/// @brief Transcodes from a UTF-16 or UTF-32 ztd::text::encoding_scheme to UTF-8 one block at a time: each block
+	/// is byte-swapped (if needed) into native code units and handed to the bulk Unicode kernels, without going
+	/// through individual code points.
+	///
+	/// @remarks Where the kernels stop (an ill-formed sequence, a sequence split across blocks, or not enough output
+	/// space), that one sequence is transcoded with ztd::text::transcode_one_into_raw, so error handlers and the
+	/// returned ranges behave as they do without this extension point. Non-contiguous ranges and constant evaluation
+	/// fall back to ztd::text::basic_transcode_into_raw.
+	template <typename _FromScheme, typename _ToEncoding, typename _Input, typename _FromEncodingArg,
+		typename _Output, typename _ToEncodingArg, typename _FromErrorHandler, typename _ToErrorHandler,
+		typename _FromState, typename _ToState, typename _Pivot,
+		::std::enable_if_t<__txt_detail::__unicode_kernel_scheme_width_v<_FromScheme> != 0 // cf
+		     && __txt_detail::__unicode_kernel_width_v<_ToEncoding> == 8>* = nullptr>
+	constexpr auto __text_transcode(::ztd::tag<_FromScheme, _ToEncoding>, _Input&& __input,
+		_FromEncodingArg&& __from_encoding, _Output&& __output, _ToEncodingArg&& __to_encoding,
+		_FromErrorHandler&& __from_error_handler, _ToErrorHandler&& __to_error_handler, _FromState& __from_state,
+		_ToState& __to_state, _Pivot&& __pivot) {
+		return __txt_detail::__unicode_scheme_transcoder<_FromScheme>::template _S_transcode<true>(
+			::std::forward<_Input>(__input), ::std::forward<_FromEncodingArg>(__from_encoding),
+			::std::forward<_Output>(__output), ::std::forward<_ToEncodingArg>(__to_encoding),
+			::std::forward<_FromErrorHandler>(__from_error_handler),
+			::std::forward<_ToErrorHandler>(__to_error_handler), __from_state, __to_state,
+			::std::forward<_Pivot>(__pivot));
+	}
+
+	//////
+	/// @brief Transcodes from UTF-8 to a UTF-16 or UTF-32 ztd::text::encoding_scheme one block at a time: each block
+	/// is converted by the bulk Unicode kernels into native code units, then byte-swapped (if needed) into the
+	/// output.
+	///
+	/// @remarks Behaves like the ztd::text::encoding_scheme to UTF-8 extension point, in the other direction.
+	template <typename _FromEncoding, typename _ToScheme, typename _Input, typename _FromEncodingArg,
+		typename _Output, typename _ToEncodingArg, typename _FromErrorHandler, typename _ToErrorHandler,
+		typename _FromState, typename _ToState, typename _Pivot,
+		::std::enable_if_t<__txt_detail::__unicode_kernel_width_v<_FromEncoding> == 8 // cf
+		     && __txt_detail::__unicode_kernel_scheme_width_v<_ToScheme> != 0>* = nullptr>
+	constexpr auto __text_transcode(::ztd::tag<_FromEncoding, _ToScheme>, _Input&& __input,
+		_FromEncodingArg&& __from_encoding, _Output&& __output, _ToEncodingArg&& __to_encoding,
+		_FromErrorHandler&& __from_error_handler, _ToErrorHandler&& __to_error_handler, _FromState& __from_state,
+		_ToState& __to_state, _Pivot&& __pivot) {
+		return __txt_detail::__unicode_scheme_transcoder<_ToScheme>::template _S_transcode<false>(
+			::std::forward<_Input>(__input), ::std::forward<_FromEncodingArg>(__from_encoding),
+			::std::forward<_Output>(__output), ::std::forward<_ToEncodingArg>(__to_encoding),
+			::std::forward<_FromErrorHandler>(__from_error_handler),
+			::std::forward<_ToErrorHandler>(__to_error_handler), __from_state, __to_state,
+			::std::forward<_Pivot>(__pivot));
+	}
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#include <ztd/epilogue.hpp>
+
+#endif
@@ -0,0 +1,239 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#pragma once
+
+#ifndef ZTD_TEXT_DETAIL_TRANSCODE_ICONV_HPP
+#define ZTD_TEXT_DETAIL_TRANSCODE_ICONV_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/basic_iconv.hpp>
+#include <ztd/text/encoding_error.hpp>
+#include <ztd/text/transcode_one.hpp>
+#include <ztd/text/detail/bulk_convert.hpp>
+#include <ztd/text/detail/iconv_descriptor_cache.hpp>
+
+#include <ztd/idk/tag.hpp>
+#include <ztd/idk/type_traits.hpp>
+#include <ztd/ranges/adl.hpp>
+#include <ztd/ranges/range.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include <ztd/prologue.hpp>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+#if ZTD_IS_ON(ZTD_PLATFORM_LIBICONV)
+	namespace __txt_detail {
+		template <typename _CodeUnit, typename _CodePoint>
+		::std::true_type __is_basic_iconv_test(const basic_iconv<_CodeUnit, _CodePoint>*);
+		::std::false_type __is_basic_iconv_test(const void*);
+
+		//////
+		/// @brief Whether or not the given type is (or derives from) a ztd::text::basic_iconv.
+		template <typename _Type>
+		inline constexpr bool __is_basic_iconv_v
+			= decltype(__is_basic_iconv_test(static_cast<const _Type*>(nullptr)))::value;
+
+		//////
+		/// @brief Gives a descriptor back to the cache it came from, even when an error handler throws.
+		struct __iconv_descriptor_release {
+			__iconv_descriptor_cache& _M_cache;
+			__iconv_descriptor_cache::__pool* _M_pool;
+			::ztd::plat::icnv::descriptor _M_desc;
+
+			~__iconv_descriptor_release() {
+				this->_M_cache._M_release(this->_M_pool, this->_M_desc);
+			}
+		};
+
+		struct __iconv_transcoder {
+			template <typename _FromCodeUnit, typename _FromCodePoint, typename _ToCodeUnit, typename _ToCodePoint,
+				typename _FromState, typename _ToState>
+			static void _S_reset_states(const basic_iconv<_FromCodeUnit, _FromCodePoint>& __from_encoding,
+				const basic_iconv<_ToCodeUnit, _ToCodePoint>& __to_encoding, _FromState& __from_state,
+				_ToState& __to_state) noexcept {
+				using _FromIconv = basic_iconv<_FromCodeUnit, _FromCodePoint>;
+				using _ToIconv   = basic_iconv<_ToCodeUnit, _ToCodePoint>;
+				if (__from_state._M_is_valid()) {
+					_FromIconv::_M_reset_descriptor(
+						__from_encoding._M_to_name, __from_state._M_conv_descriptor, sizeof(_FromCodeUnit));
+				}
+				if (__to_state._M_is_valid()) {
+					_ToIconv::_M_reset_descriptor(
+						__to_encoding._M_from_name, __to_state._M_conv_descriptor, sizeof(_ToCodePoint));
+				}
+			}
+
+			template <typename _FromCodeUnit, typename _FromCodePoint, typename _ToCodeUnit, typename _ToCodePoint,
+				typename _Input, typename _Output, typename _FromErrorHandler, typename _ToErrorHandler,
+				typename _FromState, typename _ToState, typename _Pivot>
+			static auto _S_transcode(_Input&& __input,
+				const basic_iconv<_FromCodeUnit, _FromCodePoint>& __from_encoding, _Output&& __output,
+				const basic_iconv<_ToCodeUnit, _ToCodePoint>& __to_encoding,
+				_FromErrorHandler&& __from_error_handler, _ToErrorHandler&& __to_error_handler,
+				_FromState& __from_state, _ToState& __to_state, _Pivot&& __pivot) {
+				using _FromIconv     = basic_iconv<_FromCodeUnit, _FromCodePoint>;
+				using _ToIconv       = basic_iconv<_ToCodeUnit, _ToCodePoint>;
+				using _InitialInput  = ::ztd::ranges::csubrange_for_t<::std::remove_reference_t<_Input>>;
+				using _InitialOutput = ::ztd::ranges::subrange_for_t<::std::remove_reference_t<_Output>>;
+				using _Result = decltype(transcode_one_into_raw(::std::declval<_InitialInput>(), __from_encoding,
+					::std::declval<_InitialOutput>(), __to_encoding, __from_error_handler, __to_error_handler,
+					__from_state, __to_state, __pivot));
+				using _WorkingInput  = decltype(::std::declval<_Result>().input);
+				using _WorkingOutput = decltype(::std::declval<_Result>().output);
+
+				if constexpr (__txt_detail::__is_bulk_range_v<_WorkingInput, sizeof(_FromCodeUnit)> // cf
+					&& __txt_detail::__is_bulk_range_v<_WorkingOutput, sizeof(_ToCodeUnit)>) {
+					// one descriptor straight from the source code units to the destination code units, so the
+					// whole input goes through iconv without a code point pivot in between
+					__iconv_descriptor_cache& __cache        = __iconv_descriptor_cache::_S_instance();
+					__iconv_descriptor_cache::__pool* __pool = nullptr;
+					::ztd::plat::icnv::descriptor __desc
+						= __cache._M_acquire(__to_encoding._M_from_name, __from_encoding._M_from_name, __pool);
+					if (::ztd::plat::icnv::descriptor_is_valid(__desc)) {
+						__iconv_descriptor_release __release { __cache, __pool, __desc };
+						_ToIconv::_M_reset_descriptor(__to_encoding._M_from_name, __desc, sizeof(_FromCodeUnit));
+						// the direct descriptor starts in the initial shift state, and so must the states used for
+						// the sequences it cannot convert
+						_S_reset_states(__from_encoding, __to_encoding, __from_state, __to_state);
+						_WorkingInput __working_input(::std::forward<_Input>(__input));
+						_WorkingOutput __working_output(::std::forward<_Output>(__output));
+						::std::size_t __error_count       = 0;
+						::std::size_t __pivot_error_count = 0;
+						for (;;) {
+							if (::ztd::ranges::empty(__working_input)) {
+								break;
+							}
+							if (_FromIconv::template _S_convert_bulk<_FromCodeUnit, _ToCodeUnit>(
+								     __desc, __working_input, __working_output)) {
+								continue;
+							}
+							if (::ztd::ranges::empty(__working_input)) {
+								break;
+							}
+							// iconv stopped on something: bring the output back to the initial shift state, then go
+							// through the two encodings for exactly that sequence, so each error handler sees what
+							// it would without the direct descriptor
+							if (!_ToIconv::template _S_flush_bulk<_ToCodeUnit>(__desc, __working_output)) {
+								return _Result(::std::move(__working_input), ::std::move(__working_output),
+									__from_state, __to_state, encoding_error::insufficient_output_space,
+									__error_count, ::std::forward<_Pivot>(__pivot), encoding_error::ok,
+									__pivot_error_count);
+							}
+							auto __transcode_result = transcode_one_into_raw(::std::move(__working_input),
+								__from_encoding, ::std::move(__working_output), __to_encoding,
+								__from_error_handler, __to_error_handler, __from_state, __to_state, __pivot);
+							__error_count += __transcode_result.error_count;
+							__pivot_error_count += __transcode_result.pivot_error_count;
+							__working_input  = ::std::move(__transcode_result.input);
+							__working_output = ::std::move(__transcode_result.output);
+							if (__transcode_result.error_code != encoding_error::ok) {
+								return _Result(::std::move(__working_input), ::std::move(__working_output),
+									__from_state, __to_state, __transcode_result.error_code, __error_count,
+									::std::move(__transcode_result.pivot), __transcode_result.pivot_error_code,
+									__pivot_error_count);
+							}
+							// the direct descriptor carries on from the initial shift state: put the output and
+							// both states there as well
+							if (__to_state._M_is_valid()
+								&& !_ToIconv::template _S_flush_bulk<_ToCodeUnit>(
+								     __to_state._M_conv_descriptor, __working_output)) {
+								return _Result(::std::move(__working_input), ::std::move(__working_output),
+									__from_state, __to_state, encoding_error::insufficient_output_space,
+									__error_count, ::std::forward<_Pivot>(__pivot), encoding_error::ok,
+									__pivot_error_count);
+							}
+							_S_reset_states(__from_encoding, __to_encoding, __from_state, __to_state);
+						}
+						// nothing else will use the direct descriptor: finish its shift sequence, if it has one
+						if (!_ToIconv::template _S_flush_bulk<_ToCodeUnit>(__desc, __working_output)) {
+							return _Result(::std::move(__working_input), ::std::move(__working_output),
+								__from_state, __to_state, encoding_error::insufficient_output_space, __error_count,
+								::std::forward<_Pivot>(__pivot), encoding_error::ok, __pivot_error_count);
+						}
+						return _Result(::std::move(__working_input), ::std::move(__working_output), __from_state,
+							__to_state, encoding_error::ok, __error_count, ::std::forward<_Pivot>(__pivot),
+							encoding_error::ok, __pivot_error_count);
+					}
+				}
+				return basic_transcode_into_raw(::std::forward<_Input>(__input), __from_encoding,
+					::std::forward<_Output>(__output), __to_encoding,
+					::std::forward<_FromErrorHandler>(__from_error_handler),
+					::std::forward<_ToErrorHandler>(__to_error_handler), __from_state, __to_state,
+					::std::forward<_Pivot>(__pivot));
+			}
+		};
+	} // namespace __txt_detail
+
+	//////
+	/// @brief Transcodes between two ztd::text::basic_iconv-based encodings with a single conversion descriptor that
+	/// goes directly from the source's code units to the destination's code units, handing whole (contiguous) input
+	/// and output ranges to iconv at once.
+	///
+	/// @remarks Where iconv stops (an illegal or incomplete sequence, a character the destination cannot represent,
+	/// or not enough output space), that one sequence is transcoded with ztd::text::transcode_one_into_raw through
+	/// `__from_state` and `__to_state`, so error handlers and the returned ranges behave as they do without this
+	/// extension point. The direct descriptor does not share shift state with `__from_state` or `__to_state`, so
+	/// all three are kept in the initial shift state wherever one hands off to the other: both states are reset
+	/// before the conversion starts and after every sequence they convert, and the output is returned to its
+	/// initial shift state before each such sequence and at the end of the input. Stateful encodings that are
+	/// transcoded across several calls therefore restart from their initial shift state on each call. If the
+	/// output has no room left for the sequence that returns it to its initial shift state, the result reports
+	/// ztd::text::encoding_error::insufficient_output_space. Non-contiguous ranges fall back to
+	/// ztd::text::basic_transcode_into_raw.
+	template <typename _FromIconv, typename _ToIconv, typename _Input, typename _FromEncoding, typename _Output,
+		typename _ToEncoding, typename _FromErrorHandler, typename _ToErrorHandler, typename _FromState,
+		typename _ToState, typename _Pivot,
+		::std::enable_if_t<__txt_detail::__is_basic_iconv_v<_FromIconv> // cf
+		     && __txt_detail::__is_basic_iconv_v<_ToIconv>>* = nullptr>
+	auto __text_transcode(::ztd::tag<_FromIconv, _ToIconv>, _Input&& __input, _FromEncoding&& __from_encoding,
+		_Output&& __output, _ToEncoding&& __to_encoding,
+		_FromErrorHandler&& __from_error_handler, _ToErrorHandler&& __to_error_handler, _FromState& __from_state,
+		_ToState& __to_state, _Pivot&& __pivot) {
+		return __txt_detail::__iconv_transcoder::_S_transcode(::std::forward<_Input>(__input), __from_encoding,
+			::std::forward<_Output>(__output), __to_encoding,
+			::std::forward<_FromErrorHandler>(__from_error_handler),
+			::std::forward<_ToErrorHandler>(__to_error_handler), __from_state, __to_state,
+			::std::forward<_Pivot>(__pivot));
+	}
+#endif
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#include <ztd/epilogue.hpp>
+
+#endif
@@ -0,0 +1,194 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#pragma once
+
+#ifndef ZTD_TEXT_DETAIL_TRANSCODE_UNICODE_KERNELS_HPP
+#define ZTD_TEXT_DETAIL_TRANSCODE_UNICODE_KERNELS_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/encoding_error.hpp>
+#include <ztd/text/state.hpp>
+#include <ztd/text/transcode_one.hpp>
+#include <ztd/text/utf8.hpp>
+#include <ztd/text/utf16.hpp>
+#include <ztd/text/utf32.hpp>
+#include <ztd/text/detail/unicode_kernels.hpp>
+
+#include <ztd/idk/span.hpp>
+#include <ztd/idk/tag.hpp>
+#include <ztd/idk/type_traits.hpp>
+#include <ztd/ranges/adl.hpp>
+#include <ztd/ranges/reconstruct.hpp>
+#include <ztd/ranges/range.hpp>
+
+#include <climits>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include <ztd/prologue.hpp>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	namespace __txt_detail {
+		//////
+		/// @brief Whether or not transcoding from `_FromEncoding` to `_ToEncoding` can be handled by the bulk
+		/// Unicode kernels.
+		template <typename _FromEncoding, typename _ToEncoding>
+		inline constexpr bool __is_unicode_kernel_transcode_v = __unicode_kernel_width_v<_FromEncoding> != 0
+			&& __unicode_kernel_width_v<_ToEncoding> != 0
+			&& __unicode_kernel_width_v<_FromEncoding> != __unicode_kernel_width_v<_ToEncoding>;
+
+		//////
+		/// @brief Whether or not the given (working) range can be handed to the bulk Unicode kernels as a pointer
+		/// and a size, with code units of the given bit width.
+		template <typename _Range, ::std::size_t _Width>
+		inline constexpr bool __is_unicode_kernel_range_v = ::ztd::ranges::is_range_contiguous_range_v<_Range> // cf
+			&& ::ztd::ranges::is_sized_range_v<_Range>                                                    // cf
+			&& (sizeof(::ztd::ranges::range_value_type_t<_Range>) * CHAR_BIT) == _Width;
+
+		template <typename _Range>
+		auto* __unicode_kernel_data(_Range& __range) noexcept {
+			return ::std::addressof(*::ztd::ranges::begin(__range));
+		}
+
+		template <typename _Range>
+		_Range __unicode_kernel_advance(_Range& __range, ::std::size_t __count) {
+			auto __first = ::ztd::ranges::begin(__range);
+			using _Difference = ::ztd::ranges::range_difference_type_t<_Range>;
+			::ztd::ranges::iter_advance(__first, static_cast<_Difference>(__count));
+			return ::ztd::ranges::reconstruct(
+				::std::in_place_type<_Range>, ::std::move(__first), ::ztd::ranges::end(__range));
+		}
+	} // namespace __txt_detail
+
+	namespace __txt_impl {
+		//////
+		/// @brief Transcodes between UTF-8, UTF-16, and UTF-32 in bulk, using the vectorized kernels selected for
+		/// the running CPU when both the input and output are contiguous.
+		///
+		/// @remarks Well-formed runs are converted directly by the kernels; the first ill-formed or incomplete
+		/// sequence (or the first sequence that does not fit in the output) is handed to
+		/// ztd::text::transcode_one_into_raw, so error handlers, error counts, and the returned input/output
+		/// positions are exactly what ztd::text::basic_transcode_into_raw would produce. Non-contiguous ranges and
+		/// constant evaluation fall back to ztd::text::basic_transcode_into_raw directly.
+		template <typename _FromEncoding, typename _ToEncoding, typename _Input, typename _FromEncodingArg,
+			typename _Output, typename _ToEncodingArg, typename _FromErrorHandler, typename _ToErrorHandler,
+			typename _FromState, typename _ToState, typename _Pivot,
+			::std::enable_if_t<__txt_detail::__is_unicode_kernel_transcode_v<_FromEncoding, _ToEncoding>>* = nullptr>
+		constexpr auto __text_transcode(::ztd::tag<_FromEncoding, _ToEncoding>, _Input&& __input,
+			_FromEncodingArg&& __from_encoding, _Output&& __output, _ToEncodingArg&& __to_encoding,
+			_FromErrorHandler&& __from_error_handler, _ToErrorHandler&& __to_error_handler, _FromState& __from_state,
+			_ToState& __to_state, _Pivot&& __pivot) {
+			using _InitialInput  = ::ztd::ranges::csubrange_for_t<::std::remove_reference_t<_Input>>;
+			using _InitialOutput = ::ztd::ranges::subrange_for_t<::std::remove_reference_t<_Output>>;
+			using _Result        = decltype(transcode_one_into_raw(::std::declval<_InitialInput>(), __from_encoding,
+				       ::std::declval<_InitialOutput>(), __to_encoding, __from_error_handler, __to_error_handler,
+				       __from_state, __to_state, __pivot));
+			using _WorkingInput  = decltype(::std::declval<_Result>().input);
+			using _WorkingOutput = decltype(::std::declval<_Result>().output);
+			constexpr ::std::size_t _FromWidth = __txt_detail::__unicode_kernel_width_v<_FromEncoding>;
+			constexpr ::std::size_t _ToWidth   = __txt_detail::__unicode_kernel_width_v<_ToEncoding>;
+
+			if constexpr (__txt_detail::__is_unicode_kernel_range_v<_WorkingInput, _FromWidth> // cf
+				&& __txt_detail::__is_unicode_kernel_range_v<_WorkingOutput, _ToWidth>) {
+#if ZTD_IS_ON(ZTD_STD_LIBRARY_IS_CONSTANT_EVALUATED)
+				if (!::std::is_constant_evaluated())
+#endif
+				{
+					_WorkingInput __working_input(::std::forward<_Input>(__input));
+					_WorkingOutput __working_output(::std::forward<_Output>(__output));
+					::std::size_t __error_count       = 0;
+					::std::size_t __pivot_error_count = 0;
+					for (;;) {
+						if (::ztd::ranges::empty(__working_input)) {
+							break;
+						}
+						const ::std::size_t __output_size
+							= static_cast<::std::size_t>(::ztd::ranges::size(__working_output));
+						const auto __output_data = __output_size == 0
+							? nullptr
+							: __txt_detail::__unicode_kernel_data(__working_output);
+						const __txt_detail::__unicode_kernel_result __bulk_result
+							= __txt_detail::__unicode_transcode_kernel<_FromWidth, _ToWidth>(
+							     __txt_detail::__unicode_kernel_data(__working_input),
+							     static_cast<::std::size_t>(::ztd::ranges::size(__working_input)), __output_data,
+							     __output_size);
+						__working_input
+							= __txt_detail::__unicode_kernel_advance(__working_input, __bulk_result.__read);
+						__working_output
+							= __txt_detail::__unicode_kernel_advance(__working_output, __bulk_result.__written);
+						if (::ztd::ranges::empty(__working_input)) {
+							break;
+						}
+						// the kernel stopped on something it does not handle: let the single-step machinery
+						// deal with exactly that sequence, then resume
+						auto __transcode_result
+							= ::ztd::text::transcode_one_into_raw(::std::move(__working_input), __from_encoding,
+							     ::std::move(__working_output), __to_encoding, __from_error_handler,
+							     __to_error_handler, __from_state, __to_state, __pivot);
+						__error_count += __transcode_result.error_count;
+						__pivot_error_count += __transcode_result.pivot_error_count;
+						__working_input  = ::std::move(__transcode_result.input);
+						__working_output = ::std::move(__transcode_result.output);
+						if (__transcode_result.error_code != encoding_error::ok) {
+							return _Result(::std::move(__working_input), ::std::move(__working_output),
+								__from_state, __to_state, __transcode_result.error_code, __error_count,
+								::std::move(__transcode_result.pivot), __transcode_result.pivot_error_code,
+								__pivot_error_count);
+						}
+						if (::ztd::ranges::empty(__working_input)) {
+							break;
+						}
+					}
+					return _Result(::std::move(__working_input), ::std::move(__working_output), __from_state,
+						__to_state, encoding_error::ok, __error_count, ::std::forward<_Pivot>(__pivot),
+						encoding_error::ok, __pivot_error_count);
+				}
+			}
+			return basic_transcode_into_raw(::std::forward<_Input>(__input),
+				::std::forward<_FromEncodingArg>(__from_encoding), ::std::forward<_Output>(__output),
+				::std::forward<_ToEncodingArg>(__to_encoding),
+				::std::forward<_FromErrorHandler>(__from_error_handler),
+				::std::forward<_ToErrorHandler>(__to_error_handler), __from_state, __to_state,
+				::std::forward<_Pivot>(__pivot));
+		}
+	} // namespace __txt_impl
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#include <ztd/epilogue.hpp>
+
+#endif
@@ -0,0 +1,2197 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#pragma once
+
+#ifndef ZTD_TEXT_DETAIL_UNICODE_KERNELS_HPP
+#define ZTD_TEXT_DETAIL_UNICODE_KERNELS_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/forward.hpp>
+
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#if ZTD_IS_ON(ZTD_TEXT_SIMD_I_) \
+     && (defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86))
+	#define ZTD_TEXT_SIMD_X86_I_ ZTD_ON
+#else
+	#define ZTD_TEXT_SIMD_X86_I_ ZTD_OFF
+#endif
+
+#if ZTD_IS_ON(ZTD_TEXT_SIMD_I_) && (defined(__aarch64__) || defined(_M_ARM64))
+	#define ZTD_TEXT_SIMD_NEON_I_ ZTD_ON
+#else
+	#define ZTD_TEXT_SIMD_NEON_I_ ZTD_OFF
+#endif
+
+#if ZTD_IS_ON(ZTD_TEXT_SIMD_X86_I_)
+	#include <immintrin.h>
+	#if defined(_MSC_VER)
+		#include <intrin.h>
+	#endif
+#elif ZTD_IS_ON(ZTD_TEXT_SIMD_NEON_I_)
+	#include <arm_neon.h>
+#endif
+
+#if (defined(__GNUC__) || defined(__clang__)) && !defined(_MSC_VER)
+	#define ZTD_TEXT_SIMD_TARGET_I_(...) __attribute__((target(__VA_ARGS__)))
+#else
+	#define ZTD_TEXT_SIMD_TARGET_I_(...)
+#endif
+
+#include <ztd/prologue.hpp>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	namespace __txt_detail {
+		template <typename _Encoding>
+		struct __unicode_kernel_width : ::std::integral_constant<::std::size_t, 0> { };
+
+		template <typename _CodeUnit, typename _CodePoint>
+		struct __unicode_kernel_width<basic_utf8<_CodeUnit, _CodePoint>>
+		: ::std::integral_constant<::std::size_t, (sizeof(_CodeUnit) * CHAR_BIT) == 8 ? 8 : 0> { };
+
+		template <typename _CodeUnit, typename _CodePoint>
+		struct __unicode_kernel_width<basic_utf16<_CodeUnit, _CodePoint>>
+		: ::std::integral_constant<::std::size_t, (sizeof(_CodeUnit) * CHAR_BIT) == 16 ? 16 : 0> { };
+
+		template <typename _CodeUnit, typename _CodePoint>
+		struct __unicode_kernel_width<basic_utf32<_CodeUnit, _CodePoint>>
+		: ::std::integral_constant<::std::size_t, (sizeof(_CodeUnit) * CHAR_BIT) == 32 ? 32 : 0> { };
+
+		//////
+		/// @brief The code unit bit width the bulk Unicode kernels use for the given encoding, or 0 if the
+		/// encoding is not one of the strict UTF-8/16/32 encodings they implement.
+		template <typename _Encoding>
+		inline constexpr ::std::size_t __unicode_kernel_width_v = __unicode_kernel_width<_Encoding>::value;
+
+		//////
+		/// @brief The instruction set level selected for the bulk Unicode kernels.
+		enum class __simd_level : unsigned char { __scalar = 0, __sse4_2 = 1, __avx2 = 2, __neon = 3 };
+
+		//////
+		/// @brief A primitive kernel: converts the longest prefix of `__size` input units that it can handle
+		/// directly, writing one output unit per input unit. Returns the number of units converted.
+		using __unicode_kernel_fn = ::std::size_t (*)(const void*, ::std::size_t, void*) noexcept;
+
+		//////
+		/// @brief A table lookup kernel: maps each 8-bit input unit through a 256-entry table of 32-bit values,
+		/// stopping before the first unit whose entry is `0xFFFFFFFF`. Returns the number of units converted.
+		using __lookup_kernel_fn
+			= ::std::size_t (*)(const void*, ::std::size_t, void*, const ::std::uint_least32_t*) noexcept;
+
+		//////
+		/// @brief A validation kernel: returns the length of the longest prefix of the `__size` input units that is
+		/// made up entirely of complete, well-formed sequences.
+		using __validate_kernel_fn = ::std::size_t (*)(const void*, ::std::size_t) noexcept;
+
+		//////
+		/// @brief A counting kernel: returns how many code units of another Unicode Transformation Format (or how
+		/// many code points) the `__size` input units become. The input must already be known to be well-formed.
+		using __count_kernel_fn = ::std::size_t (*)(const void*, ::std::size_t) noexcept;
+
+		//////
+		/// @brief The set of primitive kernels chosen for the running CPU.
+		struct __unicode_kernel_table {
+			__simd_level __level;
+			//////
+			/// @brief ASCII UTF-8 → UTF-16 widening.
+			__unicode_kernel_fn __ascii_8_to_16;
+			//////
+			/// @brief ASCII UTF-8 → UTF-32 widening.
+			__unicode_kernel_fn __ascii_8_to_32;
+			//////
+			/// @brief ASCII UTF-16 → UTF-8 narrowing.
+			__unicode_kernel_fn __ascii_16_to_8;
+			//////
+			/// @brief ASCII UTF-32 → UTF-8 narrowing.
+			__unicode_kernel_fn __ascii_32_to_8;
+			//////
+			/// @brief Non-surrogate UTF-16 → UTF-32 widening.
+			__unicode_kernel_fn __bmp_16_to_32;
+			//////
+			/// @brief Basic Multilingual Plane, non-surrogate UTF-32 → UTF-16 narrowing.
+			__unicode_kernel_fn __bmp_32_to_16;
+			//////
+			/// @brief 8-bit → 32-bit table lookup, for single-byte encodings.
+			__lookup_kernel_fn __lookup_8_to_32;
+			//////
+			/// @brief UTF-8 validation.
+			__validate_kernel_fn __validate_utf8;
+			//////
+			/// @brief UTF-16 validation.
+			__validate_kernel_fn __validate_utf16;
+			//////
+			/// @brief UTF-32 validation.
+			__validate_kernel_fn __validate_utf32;
+			//////
+			/// @brief Counting UTF-16 code units for UTF-8 input.
+			__count_kernel_fn __count_8_to_16;
+			//////
+			/// @brief Counting code points (UTF-32 code units) for UTF-8 input.
+			__count_kernel_fn __count_8_to_32;
+			//////
+			/// @brief Counting UTF-8 code units for UTF-16 input.
+			__count_kernel_fn __count_16_to_8;
+			//////
+			/// @brief Counting code points (UTF-32 code units) for UTF-16 input.
+			__count_kernel_fn __count_16_to_32;
+			//////
+			/// @brief Counting UTF-8 code units for UTF-32 input.
+			__count_kernel_fn __count_32_to_8;
+			//////
+			/// @brief Counting UTF-16 code units for UTF-32 input.
+			__count_kernel_fn __count_32_to_16;
+			//////
+			/// @brief Reversing the byte order of each 16-bit code unit.
+			__unicode_kernel_fn __byteswap_16;
+			//////
+			/// @brief Reversing the byte order of each 32-bit code unit.
+			__unicode_kernel_fn __byteswap_32;
+		};
+
+		//////
+		/// @brief The result of a bulk Unicode kernel: how many input units were read and how many output units
+		/// were written. Processing stops before the first invalid or incomplete sequence, or when the output
+		/// cannot fit the next complete sequence.
+		struct __unicode_kernel_result {
+			::std::size_t __read;
+			::std::size_t __written;
+		};
+
+		// Storage is accessed through memcpy so the same primitives can serve every code unit type of a given
+		// width (char/char8_t/unsigned char, char16_t/wchar_t, char32_t/wchar_t) without aliasing violations.
+		inline ::std::uint_least16_t __kernel_load_16(const unsigned char* __source) noexcept {
+			::std::uint16_t __value;
+			::std::memcpy(&__value, __source, sizeof(__value));
+			return __value;
+		}
+
+		inline ::std::uint_least32_t __kernel_load_32(const unsigned char* __source) noexcept {
+			::std::uint32_t __value;
+			::std::memcpy(&__value, __source, sizeof(__value));
+			return __value;
+		}
+
+		inline void __kernel_store_16(unsigned char* __destination, ::std::uint_least32_t __value) noexcept {
+			const ::std::uint16_t __narrow = static_cast<::std::uint16_t>(__value);
+			::std::memcpy(__destination, &__narrow, sizeof(__narrow));
+		}
+
+		inline void __kernel_store_32(unsigned char* __destination, ::std::uint_least32_t __value) noexcept {
+			const ::std::uint32_t __wide = static_cast<::std::uint32_t>(__value);
+			::std::memcpy(__destination, &__wide, sizeof(__wide));
+		}
+
+		template <typename _Unit>
+		constexpr ::std::uint_least32_t __kernel_unit(_Unit __unit) noexcept {
+			if constexpr (sizeof(_Unit) == 1) {
+				return static_cast<unsigned char>(__unit);
+			}
+			else if constexpr (sizeof(_Unit) == 2) {
+				return static_cast<::std::uint_least16_t>(__unit);
+			}
+			else {
+				return static_cast<::std::uint_least32_t>(__unit);
+			}
+		}
+
+		//////
+		/// @brief Reads one strictly well-formed UTF-8 sequence. Returns its length, or 0 if the sequence is
+		/// invalid or incomplete.
+		template <typename _InUnit>
+		inline ::std::size_t __kernel_read_utf8(
+			const _InUnit* __input, ::std::size_t __size, ::std::uint_least32_t& __code_point) noexcept {
+			const ::std::uint_least32_t __lead = __kernel_unit(__input[0]);
+			if (__lead < 0x80) {
+				__code_point = __lead;
+				return 1;
+			}
+			if (__lead < 0xC2) {
+				return 0;
+			}
+			if (__lead < 0xE0) {
+				if (__size < 2) {
+					return 0;
+				}
+				const ::std::uint_least32_t __unit1 = __kernel_unit(__input[1]);
+				if ((__unit1 & 0xC0) != 0x80) {
+					return 0;
+				}
+				__code_point = ((__lead & 0x1F) << 6) | (__unit1 & 0x3F);
+				return 2;
+			}
+			if (__lead < 0xF0) {
+				if (__size < 3) {
+					return 0;
+				}
+				const ::std::uint_least32_t __unit1 = __kernel_unit(__input[1]);
+				const ::std::uint_least32_t __unit2 = __kernel_unit(__input[2]);
+				const ::std::uint_least32_t __lower = __lead == 0xE0 ? 0xA0 : 0x80;
+				const ::std::uint_least32_t __upper = __lead == 0xED ? 0x9F : 0xBF;
+				if (__unit1 < __lower || __unit1 > __upper || (__unit2 & 0xC0) != 0x80) {
+					return 0;
+				}
+				__code_point = ((__lead & 0x0F) << 12) | ((__unit1 & 0x3F) << 6) | (__unit2 & 0x3F);
+				return 3;
+			}
+			if (__lead < 0xF5) {
+				if (__size < 4) {
+					return 0;
+				}
+				const ::std::uint_least32_t __unit1 = __kernel_unit(__input[1]);
+				const ::std::uint_least32_t __unit2 = __kernel_unit(__input[2]);
+				const ::std::uint_least32_t __unit3 = __kernel_unit(__input[3]);
+				const ::std::uint_least32_t __lower = __lead == 0xF0 ? 0x90 : 0x80;
+				const ::std::uint_least32_t __upper = __lead == 0xF4 ? 0x8F : 0xBF;
+				if (__unit1 < __lower || __unit1 > __upper || (__unit2 & 0xC0) != 0x80
+					|| (__unit3 & 0xC0) != 0x80) {
+					return 0;
+				}
+				__code_point = ((__lead & 0x07) << 18) | ((__unit1 & 0x3F) << 12) | ((__unit2 & 0x3F) << 6)
+					| (__unit3 & 0x3F);
+				return 4;
+			}
+			return 0;
+		}
+
+		//////
+		/// @brief Reads one well-formed UTF-16 sequence. Returns its length, or 0 if the sequence is an unpaired
+		/// surrogate or incomplete.
+		template <typename _InUnit>
+		inline ::std::size_t __kernel_read_utf16(
+			const _InUnit* __input, ::std::size_t __size, ::std::uint_least32_t& __code_point) noexcept {
+			const ::std::uint_least32_t __lead = __kernel_unit(__input[0]);
+			if ((__lead & 0xF800) != 0xD800) {
+				__code_point = __lead;
+				return 1;
+			}
+			if (__lead > 0xDBFF || __size < 2) {
+				return 0;
+			}
+			const ::std::uint_least32_t __trail = __kernel_unit(__input[1]);
+			if ((__trail & 0xFC00) != 0xDC00) {
+				return 0;
+			}
+			__code_point = 0x10000 + ((__lead - 0xD800) << 10) + (__trail - 0xDC00);
+			return 2;
+		}
+
+		//////
+		/// @brief Reads one valid UTF-32 code unit. Returns 1, or 0 if it is a surrogate or out of range.
+		template <typename _InUnit>
+		inline ::std::size_t __kernel_read_utf32(
+			const _InUnit* __input, ::std::size_t, ::std::uint_least32_t& __code_point) noexcept {
+			const ::std::uint_least32_t __unit = __kernel_unit(__input[0]);
+			if (__unit > 0x10FFFF || (__unit & 0xFFFFF800) == 0xD800) {
+				return 0;
+			}
+			__code_point = __unit;
+			return 1;
+		}
+
+		inline ::std::size_t __scalar_ascii_8_to_16(
+			const void* __vinput, ::std::size_t __size, void* __voutput) noexcept {
+			const unsigned char* __input = static_cast<const unsigned char*>(__vinput);
+			unsigned char* __output      = static_cast<unsigned char*>(__voutput);
+			::std::size_t __index        = 0;
+			for (; __index + 8 <= __size; __index += 8) {
+				::std::uint64_t __block;
+				::std::memcpy(&__block, __input + __index, sizeof(__block));
+				if ((__block & 0x8080808080808080ull) != 0) {
+					break;
+				}
+				for (::std::size_t __lane = 0; __lane < 8; ++__lane) {
+					__kernel_store_16(__output + ((__index + __lane) * 2), __input[__index + __lane]);
+				}
+			}
+			for (; __index < __size; ++__index) {
+				if (__input[__index] >= 0x80) {
+					break;
+				}
+				__kernel_store_16(__output + (__index * 2), __input[__index]);
+			}
+			return __index;
+		}
+
+		inline ::std::size_t __scalar_ascii_8_to_32(
+			const void* __vinput, ::std::size_t __size, void* __voutput) noexcept {
+			const unsigned char* __input = static_cast<const unsigned char*>(__vinput);
+			unsigned char* __output      = static_cast<unsigned char*>(__voutput);
+			::std::size_t __index        = 0;
+			for (; __index + 8 <= __size; __index += 8) {
+				::std::uint64_t __block;
+				::std::memcpy(&__block, __input + __index, sizeof(__block));
+				if ((__block & 0x8080808080808080ull) != 0) {
+					break;
+				}
+				for (::std::size_t __lane = 0; __lane < 8; ++__lane) {
+					__kernel_store_32(__output + ((__index + __lane) * 4), __input[__index + __lane]);
+				}
+			}
+			for (; __index < __size; ++__index) {
+				if (__input[__index] >= 0x80) {
+					break;
+				}
+				__kernel_store_32(__output + (__index * 4), __input[__index]);
+			}
+			return __index;
+		}
+
+		inline ::std::size_t __scalar_ascii_16_to_8(
+			const void* __vinput, ::std::size_t __size, void* __voutput) noexcept {
+			const unsigned char* __input = static_cast<const unsigned char*>(__vinput);
+			unsigned char* __output      = static_cast<unsigned char*>(__voutput);
+			::std::size_t __index        = 0;
+			for (; __index + 4 <= __size; __index += 4) {
+				::std::uint64_t __block;
+				::std::memcpy(&__block, __input + (__index * 2), sizeof(__block));
+				if ((__block & 0xFF80FF80FF80FF80ull) != 0) {
+					break;
+				}
+				for (::std::size_t __lane = 0; __lane < 4; ++__lane) {
+					__output[__index + __lane]
+						= static_cast<unsigned char>(__kernel_load_16(__input + ((__index + __lane) * 2)));
+				}
+			}
+			for (; __index < __size; ++__index) {
+				const ::std::uint_least16_t __unit = __kernel_load_16(__input + (__index * 2));
+				if (__unit >= 0x80) {
+					break;
+				}
+				__output[__index] = static_cast<unsigned char>(__unit);
+			}
+			return __index;
+		}
+
+		inline ::std::size_t __scalar_ascii_32_to_8(
+			const void* __vinput, ::std::size_t __size, void* __voutput) noexcept {
+			const unsigned char* __input = static_cast<const unsigned char*>(__vinput);
+			unsigned char* __output      = static_cast<unsigned char*>(__voutput);
+			::std::size_t __index        = 0;
+			for (; __index + 2 <= __size; __index += 2) {
+				::std::uint64_t __block;
+				::std::memcpy(&__block, __input + (__index * 4), sizeof(__block));
+				if ((__block & 0xFFFFFF80FFFFFF80ull) != 0) {
+					break;
+				}
+				__output[__index]     = static_cast<unsigned char>(__kernel_load_32(__input + (__index * 4)));
+				__output[__index + 1] = static_cast<unsigned char>(__kernel_load_32(__input + (__index * 4) + 4));
+			}
+			for (; __index < __size; ++__index) {
+				const ::std::uint_least32_t __unit = __kernel_load_32(__input + (__index * 4));
+				if (__unit >= 0x80) {
+					break;
+				}
+				__output[__index] = static_cast<unsigned char>(__unit);
+			}
+			return __index;
+		}
+
+		inline ::std::size_t __scalar_bmp_16_to_32(
+			const void* __vinput, ::std::size_t __size, void* __voutput) noexcept {
+			const unsigned char* __input = static_cast<const unsigned char*>(__vinput);
+			unsigned char* __output      = static_cast<unsigned char*>(__voutput);
+			::std::size_t __index        = 0;
+			for (; __index < __size; ++__index) {
+				const ::std::uint_least16_t __unit = __kernel_load_16(__input + (__index * 2));
+				if ((__unit & 0xF800) == 0xD800) {
+					break;
+				}
+				__kernel_store_32(__output + (__index * 4), __unit);
+			}
+			return __index;
+		}
+
+		inline ::std::size_t __scalar_bmp_32_to_16(
+			const void* __vinput, ::std::size_t __size, void* __voutput) noexcept {
+			const unsigned char* __input = static_cast<const unsigned char*>(__vinput);
+			unsigned char* __output      = static_cast<unsigned char*>(__voutput);
+			::std::size_t __index        = 0;
+			for (; __index < __size; ++__index) {
+				const ::std::uint_least32_t __unit = __kernel_load_32(__input + (__index * 4));
+				if (__unit > 0xFFFF || (__unit & 0xF800) == 0xD800) {
+					break;
+				}
+				__kernel_store_16(__output + (__index * 2), __unit);
+			}
+			return __index;
+		}
+
+		inline ::std::size_t __scalar_lookup_8_to_32(const void* __vinput, ::std::size_t __size, void* __voutput,
+			const ::std::uint_least32_t* __table) noexcept {
+			const unsigned char* __input = static_cast<const unsigned char*>(__vinput);
+			unsigned char* __output      = static_cast<unsigned char*>(__voutput);
+			::std::size_t __index        = 0;
+			for (; __index < __size; ++__index) {
+				const ::std::uint_least32_t __value = __table[__input[__index]];
+				if (__value == 0xFFFFFFFF) {
+					break;
+				}
+				__kernel_store_32(__output + (__index * 4), __value);
+			}
+			return __index;
+		}
+
+		inline ::std::size_t __scalar_validate_utf8(const void* __vinput, ::std::size_t __size) noexcept {
+			const unsigned char* __input = static_cast<const unsigned char*>(__vinput);
+			::std::size_t __index        = 0;
+			while (__index < __size) {
+				if (__index + 8 <= __size) {
+					::std::uint64_t __block;
+					::std::memcpy(&__block, __input + __index, sizeof(__block));
+					if ((__block & 0x8080808080808080ull) == 0) {
+						__index += 8;
+						continue;
+					}
+				}
+				::std::uint_least32_t __code_point = 0;
+				const ::std::size_t __read_size
+					= __kernel_read_utf8(__input + __index, __size - __index, __code_point);
+				if (__read_size == 0) {
+					break;
+				}
+				__index += __read_size;
+			}
+			return __index;
+		}
+
+		inline ::std::size_t __scalar_validate_utf16(const void* __vinput, ::std::size_t __size) noexcept {
+			const unsigned char* __input = static_cast<const unsigned char*>(__vinput);
+			::std::size_t __index        = 0;
+			while (__index < __size) {
+				const ::std::uint_least16_t __unit = __kernel_load_16(__input + (__index * 2));
+				if ((__unit & 0xF800) != 0xD800) {
+					++__index;
+					continue;
+				}
+				if (__unit > 0xDBFF || __index + 1 == __size) {
+					break;
+				}
+				if ((__kernel_load_16(__input + ((__index + 1) * 2)) & 0xFC00) != 0xDC00) {
+					break;
+				}
+				__index += 2;
+			}
+			return __index;
+		}
+
+		inline ::std::size_t __scalar_validate_utf32(const void* __vinput, ::std::size_t __size) noexcept {
+			const unsigned char* __input = static_cast<const unsigned char*>(__vinput);
+			::std::size_t __index        = 0;
+			for (; __index < __size; ++__index) {
+				const ::std::uint_least32_t __unit = __kernel_load_32(__input + (__index * 4));
+				if (__unit > 0x10FFFF || (__unit & 0xFFFFF800) == 0xD800) {
+					break;
+				}
+			}
+			return __index;
+		}
+
+		inline ::std::size_t __kernel_popcount(::std::uint64_t __bits) noexcept {
+			__bits = __bits - ((__bits >> 1) & 0x5555555555555555ull);
+			__bits = (__bits & 0x3333333333333333ull) + ((__bits >> 2) & 0x3333333333333333ull);
+			__bits = (__bits + (__bits >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+			return static_cast<::std::size_t>((__bits * 0x0101010101010101ull) >> 56);
+		}
+
+		// The counting kernels below expect input that has already been validated: they only look at which kind of
+		// unit each one is (continuation, lead of a 4-byte sequence, trailing surrogate, and so on).
+
+		inline ::std::size_t __scalar_count_8_to_16(const void* __vinput, ::std::size_t __size) noexcept {
+			const unsigned char* __input = static_cast<const unsigned char*>(__vinput);
+			::std::size_t __count        = __size;
+			::std::size_t __index        = 0;
+			for (; __index + 8 <= __size; __index += 8) {
+				::std::uint64_t __block;
+				::std::memcpy(&__block, __input + __index, sizeof(__block));
+				const ::std::uint64_t __continuations = __block & ~(__block << 1) & 0x8080808080808080ull;
+				const ::std::uint64_t __four_byte_leads
+					= __block & (__block << 1) & (__block << 2) & (__block << 3) & 0x8080808080808080ull;
+				__count = __count - __kernel_popcount(__continuations) + __kernel_popcount(__four_byte_leads);
+			}
+			for (; __index < __size; ++__index) {
+				const unsigned char __unit = __input[__index];
+				if ((__unit & 0xC0) == 0x80) {
+					--__count;
+				}
+				else if (__unit >= 0xF0) {
+					++__count;
+				}
+			}
+			return __count;
+		}
+
+		inline ::std::size_t __scalar_count_8_to_32(const void* __vinput, ::std::size_t __size) noexcept {
+			const unsigned char* __input = static_cast<const unsigned char*>(__vinput);
+			::std::size_t __count        = __size;
+			::std::size_t __index        = 0;
+			for (; __index + 8 <= __size; __index += 8) {
+				::std::uint64_t __block;
+				::std::memcpy(&__block, __input + __index, sizeof(__block));
+				__count -= __kernel_popcount(__block & ~(__block << 1) & 0x8080808080808080ull);
+			}
+			for (; __index < __size; ++__index) {
+				if ((__input[__index] & 0xC0) == 0x80) {
+					--__count;
+				}
+			}
+			return __count;
+		}
+
+		inline ::std::size_t __scalar_count_16_to_8(const void* __vinput, ::std::size_t __size) noexcept {
+			const unsigned char* __input = static_cast<const unsigned char*>(__vinput);
+			::std::size_t __count        = 0;
+			for (::std::size_t __index = 0; __index < __size; ++__index) {
+				const ::std::uint_least16_t __unit = __kernel_load_16(__input + (__index * 2));
+				// each half of a surrogate pair accounts for 2 of the 4 UTF-8 code units
+				__count += __unit < 0x80 ? 1 : (__unit < 0x800 || (__unit & 0xF800) == 0xD800) ? 2 : 3;
+			}
+			return __count;
+		}
+
+		inline ::std::size_t __scalar_count_16_to_32(const void* __vinput, ::std::size_t __size) noexcept {
+			const unsigned char* __input = static_cast<const unsigned char*>(__vinput);
+			::std::size_t __count        = __size;
+			for (::std::size_t __index = 0; __index < __size; ++__index) {
+				if ((__kernel_load_16(__input + (__index * 2)) & 0xFC00) == 0xDC00) {
+					--__count;
+				}
+			}
+			return __count;
+		}
+
+		inline ::std::size_t __scalar_count_32_to_8(const void* __vinput, ::std::size_t __size) noexcept {
+			const unsigned char* __input = static_cast<const unsigned char*>(__vinput);
+			::std::size_t __count        = 0;
+			for (::std::size_t __index = 0; __index < __size; ++__index) {
+				const ::std::uint_least32_t __unit = __kernel_load_32(__input + (__index * 4));
+				__count += __unit < 0x80 ? 1 : __unit < 0x800 ? 2 : __unit < 0x10000 ? 3 : 4;
+			}
+			return __count;
+		}
+
+		inline ::std::size_t __scalar_count_32_to_16(const void* __vinput, ::std::size_t __size) noexcept {
+			const unsigned char* __input = static_cast<const unsigned char*>(__vinput);
+			::std::size_t __count        = __size;
+			for (::std::size_t __index = 0; __index < __size; ++__index) {
+				if (__kernel_load_32(__input + (__index * 4)) > 0xFFFF) {
+					++__count;
+				}
+			}
+			return __count;
+		}
+
+		inline ::std::size_t __scalar_byteswap_16(
+			const void* __vinput, ::std::size_t __size, void* __voutput) noexcept {
+			const unsigned char* __input = static_cast<const unsigned char*>(__vinput);
+			unsigned char* __output      = static_cast<unsigned char*>(__voutput);
+			for (::std::size_t __index = 0; __index < __size; ++__index) {
+				const ::std::uint_least32_t __unit = __kernel_load_16(__input + (__index * 2));
+				__kernel_store_16(__output + (__index * 2), (__unit >> 8) | (__unit << 8));
+			}
+			return __size;
+		}
+
+		inline ::std::size_t __scalar_byteswap_32(
+			const void* __vinput, ::std::size_t __size, void* __voutput) noexcept {
+			const unsigned char* __input = static_cast<const unsigned char*>(__vinput);
+			unsigned char* __output      = static_cast<unsigned char*>(__voutput);
+			for (::std::size_t __index = 0; __index < __size; ++__index) {
+				const ::std::uint_least32_t __unit = __kernel_load_32(__input + (__index * 4));
+				__kernel_store_32(__output + (__index * 4),
+					(__unit >> 24) | ((__unit >> 8) & 0xFF00) | ((__unit << 8) & 0xFF0000) | (__unit << 24));
+			}
+			return __size;
+		}
+
+		// The vectorized UTF-8 validators classify each pair of adjacent bytes with three 16-entry lookups (the
+		// high and low nibbles of the first byte, the high nibble of the second); a pair is ill-formed exactly when
+		// all three lookups share a bit. Only the third and fourth bytes of longer sequences need a separate check.
+		enum __utf8_pair_error : unsigned char {
+			__utf8_too_short      = 1 << 0,
+			__utf8_too_long       = 1 << 1,
+			__utf8_overlong_3     = 1 << 2,
+			__utf8_too_large      = 1 << 3,
+			__utf8_surrogate      = 1 << 4,
+			__utf8_overlong_2     = 1 << 5,
+			__utf8_too_large_1000 = 1 << 6,
+			__utf8_overlong_4     = 1 << 6,
+			__utf8_two_continues  = 1 << 7,
+			__utf8_carry          = __utf8_too_short | __utf8_too_long | __utf8_two_continues
+		};
+
+		inline constexpr unsigned char __utf8_first_high_nibble_errors[16] = {
+			// 0xxx: ASCII
+			__utf8_too_long, __utf8_too_long, __utf8_too_long, __utf8_too_long, __utf8_too_long, __utf8_too_long,
+			__utf8_too_long, __utf8_too_long,
+			// 10xx: continuation
+			__utf8_two_continues, __utf8_two_continues, __utf8_two_continues, __utf8_two_continues,
+			// 1100: 2-byte lead, always overlong when followed by its continuation
+			__utf8_too_short | __utf8_overlong_2,
+			// 1101: 2-byte lead
+			__utf8_too_short,
+			// 1110: 3-byte lead
+			__utf8_too_short | __utf8_overlong_3 | __utf8_surrogate,
+			// 1111: 4-byte lead (or worse)
+			__utf8_too_short | __utf8_too_large | __utf8_too_large_1000 | __utf8_overlong_4,
+		};
+
+		inline constexpr unsigned char __utf8_first_low_nibble_errors[16] = {
+			__utf8_carry | __utf8_overlong_3 | __utf8_overlong_2 | __utf8_overlong_4,
+			__utf8_carry | __utf8_overlong_2,
+			__utf8_carry,
+			__utf8_carry,
+			__utf8_carry | __utf8_too_large,
+			__utf8_carry | __utf8_too_large | __utf8_too_large_1000,
+			__utf8_carry | __utf8_too_large | __utf8_too_large_1000,
+			__utf8_carry | __utf8_too_large | __utf8_too_large_1000,
+			__utf8_carry | __utf8_too_large | __utf8_too_large_1000,
+			__utf8_carry | __utf8_too_large | __utf8_too_large_1000,
+			__utf8_carry | __utf8_too_large | __utf8_too_large_1000,
+			__utf8_carry | __utf8_too_large | __utf8_too_large_1000,
+			__utf8_carry | __utf8_too_large | __utf8_too_large_1000,
+			__utf8_carry | __utf8_too_large | __utf8_too_large_1000 | __utf8_surrogate,
+			__utf8_carry | __utf8_too_large | __utf8_too_large_1000,
+			__utf8_carry | __utf8_too_large | __utf8_too_large_1000,
+		};
+
+		inline constexpr unsigned char __utf8_second_high_nibble_errors[16] = {
+			// 0xxx: ASCII
+			__utf8_too_short, __utf8_too_short, __utf8_too_short, __utf8_too_short, __utf8_too_short,
+			__utf8_too_short, __utf8_too_short, __utf8_too_short,
+			// 1000
+			__utf8_too_long | __utf8_overlong_2 | __utf8_two_continues | __utf8_overlong_3 | __utf8_too_large_1000
+				| __utf8_overlong_4,
+			// 1001
+			__utf8_too_long | __utf8_overlong_2 | __utf8_two_continues | __utf8_overlong_3 | __utf8_too_large,
+			// 101x
+			__utf8_too_long | __utf8_overlong_2 | __utf8_two_continues | __utf8_surrogate | __utf8_too_large,
+			__utf8_too_long | __utf8_overlong_2 | __utf8_two_continues | __utf8_surrogate | __utf8_too_large,
+			// 11xx: lead
+			__utf8_too_short, __utf8_too_short, __utf8_too_short, __utf8_too_short,
+		};
+
+		// a block whose last bytes exceed these limits ends in the middle of a sequence
+		inline constexpr unsigned char __utf8_incomplete_limits[32] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xDF, 0xBF };
+
+		//////
+		/// @brief Backs up from `__index` to the start of the UTF-8 sequence straddling it, if there is one, so that
+		/// the scalar validator can re-check that sequence whole.
+		inline ::std::size_t __utf8_sequence_start(const unsigned char* __input, ::std::size_t __index) noexcept {
+			::std::size_t __start = __index;
+			while (__start > 0 && __index - __start < 3 && (__input[__start - 1] & 0xC0) == 0x80) {
+				--__start;
+			}
+			if (__start > 0 && __input[__start - 1] >= 0xC0) {
+				return __start - 1;
+			}
+			return __index;
+		}
+
+#if ZTD_IS_ON(ZTD_TEXT_SIMD_X86_I_)
+		ZTD_TEXT_SIMD_TARGET_I_("sse4.2")
+		inline ::std::size_t __sse4_2_ascii_8_to_16(
+			const void* __vinput, ::std::size_t __size, void* __voutput) noexcept {
+			const unsigned char* __input = static_cast<const unsigned char*>(__vinput);
+			unsigned char* __output      = static_cast<unsigned char*>(__voutput);
+			const __m128i __zero         = _mm_setzero_si128();
+			::std::size_t __index        = 0;
+			for (; __index + 16 <= __size; __index += 16) {
+				const __m128i __block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(__input + __index));
+				if (_mm_movemask_epi8(__block) != 0) {
+					break;
+				}
+				unsigned char* __target = __output + (__index * 2);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(__target), _mm_unpacklo_epi8(__block, __zero));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(__target + 16), _mm_unpackhi_epi8(__block, __zero));
+			}
+			return __index + __scalar_ascii_8_to_16(__input + __index, __size - __index, __output + (__index * 2));
+		}
+
+		ZTD_TEXT_SIMD_TARGET_I_("sse4.2")
+		inline ::std::size_t __sse4_2_ascii_8_to_32(
+			const void* __vinput, ::std::size_t __size, void* __voutput) noexcept {
+			const unsigned char* __input = static_cast<const unsigned char*>(__vinput);
+			unsigned char* __output      = static_cast<unsigned char*>(__voutput);
+			::std::size_t __index        = 0;
+			for (; __index + 16 <= __size; __index += 16) {
+				const __m128i __block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(__input + __index));
+				if (_mm_movemask_epi8(__block) != 0) {
+					break;
+				}
+				unsigned char* __target = __output + (__index * 4);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(__target), _mm_cvtepu8_epi32(__block));
+				_mm_storeu_si128(
+					reinterpret_cast<__m128i*>(__target + 16), _mm_cvtepu8_epi32(_mm_srli_si128(__block, 4)));
+				_mm_storeu_si128(
+					reinterpret_cast<__m128i*>(__target + 32), _mm_cvtepu8_epi32(_mm_srli_si128(__block, 8)));
+				_mm_storeu_si128(
+					reinterpret_cast<__m128i*>(__target + 48), _mm_cvtepu8_epi32(_mm_srli_si128(__block, 12)));
+			}
+			return __index + __scalar_ascii_8_to_32(__input + __index, __size - __index, __output + (__index * 4));
+		}
+
+		ZTD_TEXT_SIMD_TARGET_I_("sse4.2")
+		inline ::std::size_t __sse4_2_ascii_16_to_8(
+			const void* __vinput, ::std::size_t __size, void* __voutput) noexcept {
+			const unsigned char* __input = static_cast<const unsigned char*>(__vinput);
+			unsigned char* __output      = static_cast<unsigned char*>(__voutput);
+			const __m128i __non_ascii    = _mm_set1_epi16(static_cast<short>(0xFF80));
+			::std::size_t __index        = 0;
+			for (; __index + 16 <= __size; __index += 16) {
+				const unsigned char* __source = __input + (__index * 2);
+				const __m128i __low  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(__source));
+				const __m128i __high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(__source + 16));
+				if (!_mm_testz_si128(_mm_or_si128(__low, __high), __non_ascii)) {
+					break;
+				}
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(__output + __index), _mm_packus_epi16(__low, __high));
+			}
+			return __index + __scalar_ascii_16_to_8(__input + (__index * 2), __size - __index, __output + __index);
+		}
+
+		ZTD_TEXT_SIMD_TARGET_I_("sse4.2")
+		inline ::std::size_t __sse4_2_ascii_32_to_8(
+			const void* __vinput, ::std::size_t __size, void* __voutput) noexcept {
+			const unsigned char* __input = static_cast<const unsigned char*>(__vinput);
+			unsigned char* __output      = static_cast<unsigned char*>(__voutput);
+			const __m128i __non_ascii    = _mm_set1_epi32(static_cast<int>(0xFFFFFF80));
+			::std::size_t __index        = 0;
+			for (; __index + 16 <= __size; __index += 16) {
+				const unsigned char* __source = __input + (__index * 4);
+				const __m128i __block0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(__source));
+				const __m128i __block1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(__source + 16));
+				const __m128i __block2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(__source + 32));
+				const __m128i __block3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(__source + 48));
+				const __m128i __all
+					= _mm_or_si128(_mm_or_si128(__block0, __block1), _mm_or_si128(__block2, __block3));
+				if (!_mm_testz_si128(__all, __non_ascii)) {
+					break;
+				}
+				const __m128i __packed01 = _mm_packus_epi32(__block0, __block1);
+				const __m128i __packed23 = _mm_packus_epi32(__block2, __block3);
+				_mm_storeu_si128(
+					reinterpret_cast<__m128i*>(__output + __index), _mm_packus_epi16(__packed01, __packed23));
+			}
+			return __index + __scalar_ascii_32_to_8(__input + (__index * 4), __size - __index, __output + __index);
+		}
+
+		ZTD_TEXT_SIMD_TARGET_I_("sse4.2")
+		inline ::std::size_t __sse4_2_bmp_16_to_32(
+			const void* __vinput, ::std::size_t __size, void* __voutput) noexcept {
+			const unsigned char* __input  = static_cast<const unsigned char*>(__vinput);
+			unsigned char* __output       = static_cast<unsigned char*>(__voutput);
+			const __m128i __surrogate_bits = _mm_set1_epi16(static_cast<short>(0xF800));
+			const __m128i __surrogate      = _mm_set1_epi16(static_cast<short>(0xD800));
+			::std::size_t __index         = 0;
+			for (; __index + 8 <= __size; __index += 8) {
+				const __m128i __block
+					= _mm_loadu_si128(reinterpret_cast<const __m128i*>(__input + (__index * 2)));
+				const __m128i __surrogates = _mm_cmpeq_epi16(_mm_and_si128(__block, __surrogate_bits), __surrogate);
+				if (_mm_movemask_epi8(__surrogates) != 0) {
+					break;
+				}
+				unsigned char* __target = __output + (__index * 4);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(__target), _mm_cvtepu16_epi32(__block));
+				_mm_storeu_si128(
+					reinterpret_cast<__m128i*>(__target + 16), _mm_cvtepu16_epi32(_mm_srli_si128(__block, 8)));
+			}
+			return __index
+				+ __scalar_bmp_16_to_32(__input + (__index * 2), __size - __index, __output + (__index * 4));
+		}
+
+		ZTD_TEXT_SIMD_TARGET_I_("sse4.2")
+		inline ::std::size_t __sse4_2_bmp_32_to_16(
+			const void* __vinput, ::std::size_t __size, void* __voutput) noexcept {
+			const unsigned char* __input   = static_cast<const unsigned char*>(__vinput);
+			unsigned char* __output        = static_cast<unsigned char*>(__voutput);
+			const __m128i __beyond_bmp     = _mm_set1_epi32(static_cast<int>(0xFFFF0000));
+			const __m128i __surrogate_bits = _mm_set1_epi32(0xF800);
+			const __m128i __surrogate      = _mm_set1_epi32(0xD800);
+			::std::size_t __index          = 0;
+			for (; __index + 8 <= __size; __index += 8) {
+				const unsigned char* __source = __input + (__index * 4);
+				const __m128i __low  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(__source));
+				const __m128i __high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(__source + 16));
+				if (!_mm_testz_si128(_mm_or_si128(__low, __high), __beyond_bmp)) {
+					break;
+				}
+				const __m128i __surrogates
+					= _mm_or_si128(_mm_cmpeq_epi32(_mm_and_si128(__low, __surrogate_bits), __surrogate),
+					     _mm_cmpeq_epi32(_mm_and_si128(__high, __surrogate_bits), __surrogate));
+				if (_mm_movemask_epi8(__surrogates) != 0) {
+					break;
+				}
+				_mm_storeu_si128(
+					reinterpret_cast<__m128i*>(__output + (__index * 2)), _mm_packus_epi32(__low, __high));
+			}
+			return __index
+				+ __scalar_bmp_32_to_16(__input + (__index * 4), __size - __index, __output + (__index * 2));
+		}
+
+		ZTD_TEXT_SIMD_TARGET_I_("sse4.2")
+		inline __m128i __sse4_2_utf8_block_errors(__m128i __block, __m128i __previous_block) noexcept {
+			const __m128i __first_high_table
+				= _mm_loadu_si128(reinterpret_cast<const __m128i*>(__utf8_first_high_nibble_errors));
+			const __m128i __first_low_table
+				= _mm_loadu_si128(reinterpret_cast<const __m128i*>(__utf8_first_low_nibble_errors));
+			const __m128i __second_high_table
+				= _mm_loadu_si128(reinterpret_cast<const __m128i*>(__utf8_second_high_nibble_errors));
+			const __m128i __low_nibble  = _mm_set1_epi8(0x0F);
+			const __m128i __previous1   = _mm_alignr_epi8(__block, __previous_block, 15);
+			const __m128i __previous2   = _mm_alignr_epi8(__block, __previous_block, 14);
+			const __m128i __previous3   = _mm_alignr_epi8(__block, __previous_block, 13);
+			const __m128i __first_high  = _mm_shuffle_epi8(
+				__first_high_table, _mm_and_si128(_mm_srli_epi16(__previous1, 4), __low_nibble));
+			const __m128i __first_low
+				= _mm_shuffle_epi8(__first_low_table, _mm_and_si128(__previous1, __low_nibble));
+			const __m128i __second_high = _mm_shuffle_epi8(
+				__second_high_table, _mm_and_si128(_mm_srli_epi16(__block, 4), __low_nibble));
+			const __m128i __pair_errors = _mm_and_si128(_mm_and_si128(__first_high, __first_low), __second_high);
+			const __m128i __third_bytes = _mm_subs_epu8(__previous2, _mm_set1_epi8(static_cast<char>(0xE0 - 0x80)));
+			const __m128i __fourth_bytes
+				= _mm_subs_epu8(__previous3, _mm_set1_epi8(static_cast<char>(0xF0 - 0x80)));
+			const __m128i __must_continue = _mm_and_si128(
+				_mm_or_si128(__third_bytes, __fourth_bytes), _mm_set1_epi8(static_cast<char>(0x80)));
+			return _mm_xor_si128(__must_continue, __pair_errors);
+		}
+
+		ZTD_TEXT_SIMD_TARGET_I_("sse4.2")
+		inline ::std::size_t __sse4_2_validate_utf8(const void* __vinput, ::std::size_t __size) noexcept {
+			const unsigned char* __input = static_cast<const unsigned char*>(__vinput);
+			const __m128i __incomplete_limits
+				= _mm_loadu_si128(reinterpret_cast<const __m128i*>(__utf8_incomplete_limits + 16));
+			__m128i __previous_block      = _mm_setzero_si128();
+			__m128i __previous_incomplete = _mm_setzero_si128();
+			::std::size_t __index         = 0;
+			for (; __index + 16 <= __size; __index += 16) {
+				const __m128i __block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(__input + __index));
+				__m128i __errors;
+				if (_mm_movemask_epi8(__block) == 0) {
+					__errors              = __previous_incomplete;
+					__previous_incomplete = _mm_setzero_si128();
+				}
+				else {
+					__errors              = __sse4_2_utf8_block_errors(__block, __previous_block);
+					__previous_incomplete = _mm_subs_epu8(__block, __incomplete_limits);
+				}
+				if (!_mm_testz_si128(__errors, __errors)) {
+					break;
+				}
+				__previous_block = __block;
+			}
+			// the scalar validator finishes the tail (and pins down the exact position of any error)
+			const ::std::size_t __resume = __utf8_sequence_start(__input, __index);
+			return __resume + __scalar_validate_utf8(__input + __resume, __size - __resume);
+		}
+
+		ZTD_TEXT_SIMD_TARGET_I_("sse4.2")
+		inline ::std::size_t __sse4_2_validate_utf16(const void* __vinput, ::std::size_t __size) noexcept {
+			const unsigned char* __input   = static_cast<const unsigned char*>(__vinput);
+			const __m128i __surrogate_bits = _mm_set1_epi16(static_cast<short>(0xFC00));
+			const __m128i __lead           = _mm_set1_epi16(static_cast<short>(0xD800));
+			const __m128i __trail          = _mm_set1_epi16(static_cast<short>(0xDC00));
+			__m128i __previous_leads       = _mm_setzero_si128();
+			::std::size_t __index          = 0;
+			for (; __index + 8 <= __size; __index += 8) {
+				const __m128i __block
+					= _mm_loadu_si128(reinterpret_cast<const __m128i*>(__input + (__index * 2)));
+				const __m128i __surrogates = _mm_and_si128(__block, __surrogate_bits);
+				const __m128i __leads      = _mm_cmpeq_epi16(__surrogates, __lead);
+				const __m128i __trails     = _mm_cmpeq_epi16(__surrogates, __trail);
+				// every trail must directly follow a lead, and every lead must be directly followed by a trail
+				const __m128i __expected_trails = _mm_alignr_epi8(__leads, __previous_leads, 14);
+				if (_mm_movemask_epi8(_mm_xor_si128(__expected_trails, __trails)) != 0) {
+					break;
+				}
+				__previous_leads = __leads;
+			}
+			const ::std::size_t __resume = __index - (_mm_extract_epi16(__previous_leads, 7) != 0 ? 1 : 0);
+			return __resume + __scalar_validate_utf16(__input + (__resume * 2), __size - __resume);
+		}
+
+		ZTD_TEXT_SIMD_TARGET_I_("sse4.2")
+		inline ::std::size_t __sse4_2_validate_utf32(const void* __vinput, ::std::size_t __size) noexcept {
+			const unsigned char* __input   = static_cast<const unsigned char*>(__vinput);
+			const __m128i __maximum        = _mm_set1_epi32(0x10FFFF);
+			const __m128i __surrogate_bits = _mm_set1_epi32(static_cast<int>(0xFFFFF800));
+			const __m128i __surrogate      = _mm_set1_epi32(0xD800);
+			::std::size_t __index          = 0;
+			for (; __index + 8 <= __size; __index += 8) {
+				const unsigned char* __source = __input + (__index * 4);
+				const __m128i __low  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(__source));
+				const __m128i __high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(__source + 16));
+				const __m128i __too_large
+					= _mm_or_si128(_mm_xor_si128(_mm_max_epu32(__low, __maximum), __maximum),
+					     _mm_xor_si128(_mm_max_epu32(__high, __maximum), __maximum));
+				const __m128i __surrogates
+					= _mm_or_si128(_mm_cmpeq_epi32(_mm_and_si128(__low, __surrogate_bits), __surrogate),
+					     _mm_cmpeq_epi32(_mm_and_si128(__high, __surrogate_bits), __surrogate));
+				const __m128i __errors = _mm_or_si128(__too_large, __surrogates);
+				if (!_mm_testz_si128(__errors, __errors)) {
+					break;
+				}
+			}
+			return __index + __scalar_validate_utf32(__input + (__index * 4), __size - __index);
+		}
+
+		ZTD_TEXT_SIMD_TARGET_I_("sse4.2")
+		inline ::std::size_t __sse4_2_count_8_to_16(const void* __vinput, ::std::size_t __size) noexcept {
+			const unsigned char* __input = static_cast<const unsigned char*>(__vinput);
+			const __m128i __continuation = _mm_set1_epi8(static_cast<char>(0xC0));
+			const __m128i __four_byte    = _mm_set1_epi8(static_cast<char>(0xF0));
+			::std::size_t __count        = 0;
+			::std::size_t __index        = 0;
+			for (; __index + 16 <= __size; __index += 16) {
+				const __m128i __block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(__input + __index));
+				// signed: 0x80 through 0xBF are exactly the values below 0xC0
+				const int __continuations = _mm_movemask_epi8(_mm_cmplt_epi8(__block, __continuation));
+				const int __four_byte_leads
+					= _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_max_epu8(__block, __four_byte), __block));
+				__count += 16 - __kernel_popcount(static_cast<unsigned int>(__continuations))
+					+ __kernel_popcount(static_cast<unsigned int>(__four_byte_leads));
+			}
+			return __count + __scalar_count_8_to_16(__input + __index, __size - __index);
+		}
+
+		ZTD_TEXT_SIMD_TARGET_I_("sse4.2")
+		inline ::std::size_t __sse4_2_count_8_to_32(const void* __vinput, ::std::size_t __size) noexcept {
+			const unsigned char* __input = static_cast<const unsigned char*>(__vinput);
+			const __m128i __continuation = _mm_set1_epi8(static_cast<char>(0xC0));
+			::std::size_t __count        = 0;
+			::std::size_t __index        = 0;
+			for (; __index + 16 <= __size; __index += 16) {
+				const __m128i __block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(__input + __index));
+				const int __continuations = _mm_movemask_epi8(_mm_cmplt_epi8(__block, __continuation));
+				__count += 16 - __kernel_popcount(static_cast<unsigned int>(__continuations));
+			}
+			return __count + __scalar_count_8_to_32(__input + __index, __size - __index);
+		}
+
+		ZTD_TEXT_SIMD_TARGET_I_("sse4.2")
+		inline ::std::size_t __sse4_2_count_16_to_8(const void* __vinput, ::std::size_t __size) noexcept {
+			const unsigned char* __input   = static_cast<const unsigned char*>(__vinput);
+			const __m128i __two_units      = _mm_set1_epi16(0x80);
+			const __m128i __three_units    = _mm_set1_epi16(0x800);
+			const __m128i __surrogate_bits = _mm_set1_epi16(static_cast<short>(0xF800));
+			const __m128i __surrogate      = _mm_set1_epi16(static_cast<short>(0xD800));
+			::std::size_t __count          = 0;
+			::std::size_t __index          = 0;
+			for (; __index + 8 <= __size; __index += 8) {
+				const __m128i __block
+					= _mm_loadu_si128(reinterpret_cast<const __m128i*>(__input + (__index * 2)));
+				const int __at_least_two
+					= _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_max_epu16(__block, __two_units), __block));
+				const int __at_least_three
+					= _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_max_epu16(__block, __three_units), __block));
+				const int __surrogates
+					= _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(__block, __surrogate_bits), __surrogate));
+				// 2 mask bits per code unit
+				__count += 8
+					+ ((__kernel_popcount(static_cast<unsigned int>(__at_least_two))
+					       + __kernel_popcount(static_cast<unsigned int>(__at_least_three))
+					       - __kernel_popcount(static_cast<unsigned int>(__surrogates)))
+					     / 2);
+			}
+			return __count + __scalar_count_16_to_8(__input + (__index * 2), __size - __index);
+		}
+
+		ZTD_TEXT_SIMD_TARGET_I_("sse4.2")
+		inline ::std::size_t __sse4_2_count_16_to_32(const void* __vinput, ::std::size_t __size) noexcept {
+			const unsigned char* __input   = static_cast<const unsigned char*>(__vinput);
+			const __m128i __surrogate_bits = _mm_set1_epi16(static_cast<short>(0xFC00));
+			const __m128i __trail          = _mm_set1_epi16(static_cast<short>(0xDC00));
+			::std::size_t __count          = 0;
+			::std::size_t __index          = 0;
+			for (; __index + 8 <= __size; __index += 8) {
+				const __m128i __block
+					= _mm_loadu_si128(reinterpret_cast<const __m128i*>(__input + (__index * 2)));
+				const int __trails
+					= _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(__block, __surrogate_bits), __trail));
+				__count += 8 - (__kernel_popcount(static_cast<unsigned int>(__trails)) / 2);
+			}
+			return __count + __scalar_count_16_to_32(__input + (__index * 2), __size - __index);
+		}
+
+		ZTD_TEXT_SIMD_TARGET_I_("sse4.2")
+		inline ::std::size_t __sse4_2_count_32_to_8(const void* __vinput, ::std::size_t __size) noexcept {
+			const unsigned char* __input = static_cast<const unsigned char*>(__vinput);
+			const __m128i __two_units    = _mm_set1_epi32(0x80);
+			const __m128i __three_units  = _mm_set1_epi32(0x800);
+			const __m128i __four_units   = _mm_set1_epi32(0x10000);
+			::std::size_t __count        = 0;
+			::std::size_t __index        = 0;
+			for (; __index + 4 <= __size; __index += 4) {
+				const __m128i __block
+					= _mm_loadu_si128(reinterpret_cast<const __m128i*>(__input + (__index * 4)));
+				const int __at_least_two = _mm_movemask_ps(
+					_mm_castsi128_ps(_mm_cmpeq_epi32(_mm_max_epu32(__block, __two_units), __block)));
+				const int __at_least_three = _mm_movemask_ps(
+					_mm_castsi128_ps(_mm_cmpeq_epi32(_mm_max_epu32(__block, __three_units), __block)));
+				const int __at_least_four = _mm_movemask_ps(
+					_mm_castsi128_ps(_mm_cmpeq_epi32(_mm_max_epu32(__block, __four_units), __block)));
+				__count += 4 + __kernel_popcount(static_cast<unsigned int>(__at_least_two))
+					+ __kernel_popcount(static_cast<unsigned int>(__at_least_three))
+					+ __kernel_popcount(static_cast<unsigned int>(__at_least_four));
+			}
+			return __count + __scalar_count_32_to_8(__input + (__index * 4), __size - __index);
+		}
+
+		ZTD_TEXT_SIMD_TARGET_I_("sse4.2")
+		inline ::std::size_t __sse4_2_count_32_to_16(const void* __vinput, ::std::size_t __size) noexcept {
+			const unsigned char* __input = static_cast<const unsigned char*>(__vinput);
+			const __m128i __two_units    = _mm_set1_epi32(0x10000);
+			::std::size_t __count        = 0;
+			::std::size_t __index        = 0;
+			for (; __index + 4 <= __size; __index += 4) {
+				const __m128i __block
+					= _mm_loadu_si128(reinterpret_cast<const __m128i*>(__input + (__index * 4)));
+				const int __pairs = _mm_movemask_ps(
+					_mm_castsi128_ps(_mm_cmpeq_epi32(_mm_max_epu32(__block, __two_units), __block)));
+				__count += 4 + __kernel_popcount(static_cast<unsigned int>(__pairs));
+			}
+			return __count + __scalar_count_32_to_16(__input + (__index * 4), __size - __index);
+		}
+
+		ZTD_TEXT_SIMD_TARGET_I_("sse4.2")
+		inline ::std::size_t __sse4_2_byteswap_16(
+			const void* __vinput, ::std::size_t __size, void* __voutput) noexcept {
+			const unsigned char* __input = static_cast<const unsigned char*>(__vinput);
+			unsigned char* __output      = static_cast<unsigned char*>(__voutput);
+			const __m128i __swap         = _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+			::std::size_t __index        = 0;
+			for (; __index + 8 <= __size; __index += 8) {
+				const __m128i __block
+					= _mm_loadu_si128(reinterpret_cast<const __m128i*>(__input + (__index * 2)));
+				_mm_storeu_si128(
+					reinterpret_cast<__m128i*>(__output + (__index * 2)), _mm_shuffle_epi8(__block, __swap));
+			}
+			return __index
+				+ __scalar_byteswap_16(__input + (__index * 2), __size - __index, __output + (__index * 2));
+		}
+
+		ZTD_TEXT_SIMD_TARGET_I_("sse4.2")
+		inline ::std::size_t __sse4_2_byteswap_32(
+			const void* __vinput, ::std::size_t __size, void* __voutput) noexcept {
+			const unsigned char* __input = static_cast<const unsigned char*>(__vinput);
+			unsigned char* __output      = static_cast<unsigned char*>(__voutput);
+			const __m128i __swap         = _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+			::std::size_t __index        = 0;
+			for (; __index + 4 <= __size; __index += 4) {
+				const __m128i __block
+					= _mm_loadu_si128(reinterpret_cast<const __m128i*>(__input + (__index * 4)));
+				_mm_storeu_si128(
+					reinterpret_cast<__m128i*>(__output + (__index * 4)), _mm_shuffle_epi8(__block, __swap));
+			}
+			return __index
+				+ __scalar_byteswap_32(__input + (__index * 4), __size - __index, __output + (__index * 4));
+		}
+
+		ZTD_TEXT_SIMD_TARGET_I_("avx2")
+		inline ::std::size_t __avx2_ascii_8_to_16(
+			const void* __vinput, ::std::size_t __size, void* __voutput) noexcept {
+			const unsigned char* __input = static_cast<const unsigned char*>(__vinput);
+			unsigned char* __output      = static_cast<unsigned char*>(__voutput);
+			::std::size_t __index        = 0;
+			for (; __index + 32 <= __size; __index += 32) {
+				const __m256i __block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(__input + __index));
+				if (_mm256_movemask_epi8(__block) != 0) {
+					break;
+				}
+				unsigned char* __target = __output + (__index * 2);
+				_mm256_storeu_si256(
+					reinterpret_cast<__m256i*>(__target), _mm256_cvtepu8_epi16(_mm256_castsi256_si128(__block)));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(__target + 32),
+					_mm256_cvtepu8_epi16(_mm256_extracti128_si256(__block, 1)));
+			}
+			return __index + __sse4_2_ascii_8_to_16(__input + __index, __size - __index, __output + (__index * 2));
+		}
+
+		ZTD_TEXT_SIMD_TARGET_I_("avx2")
+		inline ::std::size_t __avx2_ascii_8_to_32(
+			const void* __vinput, ::std::size_t __size, void* __voutput) noexcept {
+			const unsigned char* __input = static_cast<const unsigned char*>(__vinput);
+			unsigned char* __output      = static_cast<unsigned char*>(__voutput);
+			::std::size_t __index        = 0;
+			for (; __index + 32 <= __size; __index += 32) {
+				const __m256i __block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(__input + __index));
+				if (_mm256_movemask_epi8(__block) != 0) {
+					break;
+				}
+				const __m128i __low     = _mm256_castsi256_si128(__block);
+				const __m128i __high    = _mm256_extracti128_si256(__block, 1);
+				unsigned char* __target = __output + (__index * 4);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(__target), _mm256_cvtepu8_epi32(__low));
+				_mm256_storeu_si256(
+					reinterpret_cast<__m256i*>(__target + 32), _mm256_cvtepu8_epi32(_mm_srli_si128(__low, 8)));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(__target + 64), _mm256_cvtepu8_epi32(__high));
+				_mm256_storeu_si256(
+					reinterpret_cast<__m256i*>(__target + 96), _mm256_cvtepu8_epi32(_mm_srli_si128(__high, 8)));
+			}
+			return __index + __sse4_2_ascii_8_to_32(__input + __index, __size - __index, __output + (__index * 4));
+		}
+
+		ZTD_TEXT_SIMD_TARGET_I_("avx2")
+		inline ::std::size_t __avx2_ascii_16_to_8(
+			const void* __vinput, ::std::size_t __size, void* __voutput) noexcept {
+			const unsigned char* __input = static_cast<const unsigned char*>(__vinput);
+			unsigned char* __output      = static_cast<unsigned char*>(__voutput);
+			const __m256i __non_ascii    = _mm256_set1_epi16(static_cast<short>(0xFF80));
+			::std::size_t __index        = 0;
+			for (; __index + 32 <= __size; __index += 32) {
+				const unsigned char* __source = __input + (__index * 2);
+				const __m256i __low  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(__source));
+				const __m256i __high = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(__source + 32));
+				if (!_mm256_testz_si256(_mm256_or_si256(__low, __high), __non_ascii)) {
+					break;
+				}
+				// packus works per 128-bit lane: put the quarters back in order afterwards
+				const __m256i __packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(__low, __high), 0xD8);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(__output + __index), __packed);
+			}
+			return __index + __sse4_2_ascii_16_to_8(__input + (__index * 2), __size - __index, __output + __index);
+		}
+
+		ZTD_TEXT_SIMD_TARGET_I_("avx2")
+		inline ::std::size_t __avx2_bmp_16_to_32(
+			const void* __vinput, ::std::size_t __size, void* __voutput) noexcept {
+			const unsigned char* __input   = static_cast<const unsigned char*>(__vinput);
+			unsigned char* __output        = static_cast<unsigned char*>(__voutput);
+			const __m256i __surrogate_bits = _mm256_set1_epi16(static_cast<short>(0xF800));
+			const __m256i __surrogate      = _mm256_set1_epi16(static_cast<short>(0xD800));
+			::std::size_t __index          = 0;
+			for (; __index + 16 <= __size; __index += 16) {
+				const __m256i __block
+					= _mm256_loadu_si256(reinterpret_cast<const __m256i*>(__input + (__index * 2)));
+				const __m256i __surrogates
+					= _mm256_cmpeq_epi16(_mm256_and_si256(__block, __surrogate_bits), __surrogate);
+				if (_mm256_movemask_epi8(__surrogates) != 0) {
+					break;
+				}
+				unsigned char* __target = __output + (__index * 4);
+				_mm256_storeu_si256(
+					reinterpret_cast<__m256i*>(__target), _mm256_cvtepu16_epi32(_mm256_castsi256_si128(__block)));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(__target + 32),
+					_mm256_cvtepu16_epi32(_mm256_extracti128_si256(__block, 1)));
+			}
+			return __index
+				+ __sse4_2_bmp_16_to_32(__input + (__index * 2), __size - __index, __output + (__index * 4));
+		}
+
+		ZTD_TEXT_SIMD_TARGET_I_("avx2")
+		inline ::std::size_t __avx2_bmp_32_to_16(
+			const void* __vinput, ::std::size_t __size, void* __voutput) noexcept {
+			const unsigned char* __input   = static_cast<const unsigned char*>(__vinput);
+			unsigned char* __output        = static_cast<unsigned char*>(__voutput);
+			const __m256i __beyond_bmp     = _mm256_set1_epi32(static_cast<int>(0xFFFF0000));
+			const __m256i __surrogate_bits = _mm256_set1_epi32(0xF800);
+			const __m256i __surrogate      = _mm256_set1_epi32(0xD800);
+			::std::size_t __index          = 0;
+			for (; __index + 16 <= __size; __index += 16) {
+				const unsigned char* __source = __input + (__index * 4);
+				const __m256i __low  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(__source));
+				const __m256i __high = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(__source + 32));
+				if (!_mm256_testz_si256(_mm256_or_si256(__low, __high), __beyond_bmp)) {
+					break;
+				}
+				const __m256i __surrogates
+					= _mm256_or_si256(_mm256_cmpeq_epi32(_mm256_and_si256(__low, __surrogate_bits), __surrogate),
+					     _mm256_cmpeq_epi32(_mm256_and_si256(__high, __surrogate_bits), __surrogate));
+				if (_mm256_movemask_epi8(__surrogates) != 0) {
+					break;
+				}
+				const __m256i __packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(__low, __high), 0xD8);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(__output + (__index * 2)), __packed);
+			}
+			return __index
+				+ __sse4_2_bmp_32_to_16(__input + (__index * 4), __size - __index, __output + (__index * 2));
+		}
+
+		ZTD_TEXT_SIMD_TARGET_I_("avx2")
+		inline ::std::size_t __avx2_lookup_8_to_32(const void* __vinput, ::std::size_t __size, void* __voutput,
+			const ::std::uint_least32_t* __table) noexcept {
+			static_assert(sizeof(::std::uint_least32_t) == 4, "the gather needs 32-bit table entries");
+			const unsigned char* __input = static_cast<const unsigned char*>(__vinput);
+			unsigned char* __output      = static_cast<unsigned char*>(__voutput);
+			const int* __gather_table    = reinterpret_cast<const int*>(__table);
+			const __m256i __absent       = _mm256_set1_epi32(-1);
+			::std::size_t __index        = 0;
+			for (; __index + 8 <= __size; __index += 8) {
+				const __m128i __units = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(__input + __index));
+				const __m256i __values
+					= _mm256_i32gather_epi32(__gather_table, _mm256_cvtepu8_epi32(__units), 4);
+				if (_mm256_movemask_epi8(_mm256_cmpeq_epi32(__values, __absent)) != 0) {
+					break;
+				}
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(__output + (__index * 4)), __values);
+			}
+			return __index
+				+ __scalar_lookup_8_to_32(__input + __index, __size - __index, __output + (__index * 4), __table);
+		}
+		ZTD_TEXT_SIMD_TARGET_I_("avx2")
+		inline __m256i __avx2_utf8_block_errors(__m256i __block, __m256i __previous_block) noexcept {
+			const __m256i __first_high_table = _mm256_broadcastsi128_si256(
+				_mm_loadu_si128(reinterpret_cast<const __m128i*>(__utf8_first_high_nibble_errors)));
+			const __m256i __first_low_table = _mm256_broadcastsi128_si256(
+				_mm_loadu_si128(reinterpret_cast<const __m128i*>(__utf8_first_low_nibble_errors)));
+			const __m256i __second_high_table = _mm256_broadcastsi128_si256(
+				_mm_loadu_si128(reinterpret_cast<const __m128i*>(__utf8_second_high_nibble_errors)));
+			const __m256i __low_nibble = _mm256_set1_epi8(0x0F);
+			// the 16 bytes before each 128-bit lane of the block
+			const __m256i __carried     = _mm256_permute2x128_si256(__previous_block, __block, 0x21);
+			const __m256i __previous1   = _mm256_alignr_epi8(__block, __carried, 15);
+			const __m256i __previous2   = _mm256_alignr_epi8(__block, __carried, 14);
+			const __m256i __previous3   = _mm256_alignr_epi8(__block, __carried, 13);
+			const __m256i __first_high  = _mm256_shuffle_epi8(
+				__first_high_table, _mm256_and_si256(_mm256_srli_epi16(__previous1, 4), __low_nibble));
+			const __m256i __first_low   = _mm256_shuffle_epi8(
+				__first_low_table, _mm256_and_si256(__previous1, __low_nibble));
+			const __m256i __second_high = _mm256_shuffle_epi8(
+				__second_high_table, _mm256_and_si256(_mm256_srli_epi16(__block, 4), __low_nibble));
+			const __m256i __pair_errors
+				= _mm256_and_si256(_mm256_and_si256(__first_high, __first_low), __second_high);
+			const __m256i __third_bytes
+				= _mm256_subs_epu8(__previous2, _mm256_set1_epi8(static_cast<char>(0xE0 - 0x80)));
+			const __m256i __fourth_bytes
+				= _mm256_subs_epu8(__previous3, _mm256_set1_epi8(static_cast<char>(0xF0 - 0x80)));
+			const __m256i __must_continue = _mm256_and_si256(
+				_mm256_or_si256(__third_bytes, __fourth_bytes), _mm256_set1_epi8(static_cast<char>(0x80)));
+			return _mm256_xor_si256(__must_continue, __pair_errors);
+		}
+
+		ZTD_TEXT_SIMD_TARGET_I_("avx2")
+		inline ::std::size_t __avx2_validate_utf8(const void* __vinput, ::std::size_t __size) noexcept {
+			const unsigned char* __input = static_cast<const unsigned char*>(__vinput);
+			const __m256i __incomplete_limits
+				= _mm256_loadu_si256(reinterpret_cast<const __m256i*>(__utf8_incomplete_limits));
+			__m256i __previous_block      = _mm256_setzero_si256();
+			__m256i __previous_incomplete = _mm256_setzero_si256();
+			::std::size_t __index         = 0;
+			for (; __index + 32 <= __size; __index += 32) {
+				const __m256i __block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(__input + __index));
+				__m256i __errors;
+				if (_mm256_movemask_epi8(__block) == 0) {
+					__errors              = __previous_incomplete;
+					__previous_incomplete = _mm256_setzero_si256();
+				}
+				else {
+					__errors              = __avx2_utf8_block_errors(__block, __previous_block);
+					__previous_incomplete = _mm256_subs_epu8(__block, __incomplete_limits);
+				}
+				if (!_mm256_testz_si256(__errors, __errors)) {
+					break;
+				}
+				__previous_block = __block;
+			}
+			const ::std::size_t __resume = __utf8_sequence_start(__input, __index);
+			return __resume + __sse4_2_validate_utf8(__input + __resume, __size - __resume);
+		}
+
+		ZTD_TEXT_SIMD_TARGET_I_("avx2")
+		inline ::std::size_t __avx2_validate_utf16(const void* __vinput, ::std::size_t __size) noexcept {
+			const unsigned char* __input   = static_cast<const unsigned char*>(__vinput);
+			const __m256i __surrogate_bits = _mm256_set1_epi16(static_cast<short>(0xFC00));
+			const __m256i __lead           = _mm256_set1_epi16(static_cast<short>(0xD800));
+			const __m256i __trail          = _mm256_set1_epi16(static_cast<short>(0xDC00));
+			__m256i __previous_leads       = _mm256_setzero_si256();
+			::std::size_t __index          = 0;
+			for (; __index + 16 <= __size; __index += 16) {
+				const __m256i __block
+					= _mm256_loadu_si256(reinterpret_cast<const __m256i*>(__input + (__index * 2)));
+				const __m256i __surrogates      = _mm256_and_si256(__block, __surrogate_bits);
+				const __m256i __leads           = _mm256_cmpeq_epi16(__surrogates, __lead);
+				const __m256i __trails          = _mm256_cmpeq_epi16(__surrogates, __trail);
+				const __m256i __carried         = _mm256_permute2x128_si256(__previous_leads, __leads, 0x21);
+				const __m256i __expected_trails = _mm256_alignr_epi8(__leads, __carried, 14);
+				if (_mm256_movemask_epi8(_mm256_xor_si256(__expected_trails, __trails)) != 0) {
+					break;
+				}
+				__previous_leads = __leads;
+			}
+			const ::std::size_t __resume = __index - (_mm256_extract_epi16(__previous_leads, 15) != 0 ? 1 : 0);
+			return __resume + __sse4_2_validate_utf16(__input + (__resume * 2), __size - __resume);
+		}
+
+		ZTD_TEXT_SIMD_TARGET_I_("avx2")
+		inline ::std::size_t __avx2_validate_utf32(const void* __vinput, ::std::size_t __size) noexcept {
+			const unsigned char* __input   = static_cast<const unsigned char*>(__vinput);
+			const __m256i __maximum        = _mm256_set1_epi32(0x10FFFF);
+			const __m256i __surrogate_bits = _mm256_set1_epi32(static_cast<int>(0xFFFFF800));
+			const __m256i __surrogate      = _mm256_set1_epi32(0xD800);
+			::std::size_t __index          = 0;
+			for (; __index + 16 <= __size; __index += 16) {
+				const unsigned char* __source = __input + (__index * 4);
+				const __m256i __low  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(__source));
+				const __m256i __high = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(__source + 32));
+				const __m256i __too_large
+					= _mm256_or_si256(_mm256_xor_si256(_mm256_max_epu32(__low, __maximum), __maximum),
+					     _mm256_xor_si256(_mm256_max_epu32(__high, __maximum), __maximum));
+				const __m256i __surrogates
+					= _mm256_or_si256(_mm256_cmpeq_epi32(_mm256_and_si256(__low, __surrogate_bits), __surrogate),
+					     _mm256_cmpeq_epi32(_mm256_and_si256(__high, __surrogate_bits), __surrogate));
+				const __m256i __errors = _mm256_or_si256(__too_large, __surrogates);
+				if (!_mm256_testz_si256(__errors, __errors)) {
+					break;
+				}
+			}
+			return __index + __sse4_2_validate_utf32(__input + (__index * 4), __size - __index);
+		}
+
+		ZTD_TEXT_SIMD_TARGET_I_("avx2")
+		inline ::std::size_t __avx2_count_8_to_16(const void* __vinput, ::std::size_t __size) noexcept {
+			const unsigned char* __input = static_cast<const unsigned char*>(__vinput);
+			const __m256i __continuation = _mm256_set1_epi8(static_cast<char>(0xC0));
+			const __m256i __four_byte    = _mm256_set1_epi8(static_cast<char>(0xF0));
+			::std::size_t __count        = 0;
+			::std::size_t __index        = 0;
+			for (; __index + 32 <= __size; __index += 32) {
+				const __m256i __block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(__input + __index));
+				const int __continuations = _mm256_movemask_epi8(_mm256_cmpgt_epi8(__continuation, __block));
+				const int __four_byte_leads
+					= _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_max_epu8(__block, __four_byte), __block));
+				__count += 32 - __kernel_popcount(static_cast<unsigned int>(__continuations))
+					+ __kernel_popcount(static_cast<unsigned int>(__four_byte_leads));
+			}
+			return __count + __sse4_2_count_8_to_16(__input + __index, __size - __index);
+		}
+
+		ZTD_TEXT_SIMD_TARGET_I_("avx2")
+		inline ::std::size_t __avx2_count_8_to_32(const void* __vinput, ::std::size_t __size) noexcept {
+			const unsigned char* __input = static_cast<const unsigned char*>(__vinput);
+			const __m256i __continuation = _mm256_set1_epi8(static_cast<char>(0xC0));
+			::std::size_t __count        = 0;
+			::std::size_t __index        = 0;
+			for (; __index + 32 <= __size; __index += 32) {
+				const __m256i __block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(__input + __index));
+				const int __continuations = _mm256_movemask_epi8(_mm256_cmpgt_epi8(__continuation, __block));
+				__count += 32 - __kernel_popcount(static_cast<unsigned int>(__continuations));
+			}
+			return __count + __sse4_2_count_8_to_32(__input + __index, __size - __index);
+		}
+
+		ZTD_TEXT_SIMD_TARGET_I_("avx2")
+		inline ::std::size_t __avx2_count_16_to_8(const void* __vinput, ::std::size_t __size) noexcept {
+			const unsigned char* __input   = static_cast<const unsigned char*>(__vinput);
+			const __m256i __two_units      = _mm256_set1_epi16(0x80);
+			const __m256i __three_units    = _mm256_set1_epi16(0x800);
+			const __m256i __surrogate_bits = _mm256_set1_epi16(static_cast<short>(0xF800));
+			const __m256i __surrogate      = _mm256_set1_epi16(static_cast<short>(0xD800));
+			::std::size_t __count          = 0;
+			::std::size_t __index          = 0;
+			for (; __index + 16 <= __size; __index += 16) {
+				const __m256i __block
+					= _mm256_loadu_si256(reinterpret_cast<const __m256i*>(__input + (__index * 2)));
+				const int __at_least_two
+					= _mm256_movemask_epi8(_mm256_cmpeq_epi16(_mm256_max_epu16(__block, __two_units), __block));
+				const int __at_least_three
+					= _mm256_movemask_epi8(_mm256_cmpeq_epi16(_mm256_max_epu16(__block, __three_units), __block));
+				const int __surrogates = _mm256_movemask_epi8(
+					_mm256_cmpeq_epi16(_mm256_and_si256(__block, __surrogate_bits), __surrogate));
+				__count += 16
+					+ ((__kernel_popcount(static_cast<unsigned int>(__at_least_two))
+					       + __kernel_popcount(static_cast<unsigned int>(__at_least_three))
+					       - __kernel_popcount(static_cast<unsigned int>(__surrogates)))
+					     / 2);
+			}
+			return __count + __sse4_2_count_16_to_8(__input + (__index * 2), __size - __index);
+		}
+
+		ZTD_TEXT_SIMD_TARGET_I_("avx2")
+		inline ::std::size_t __avx2_count_16_to_32(const void* __vinput, ::std::size_t __size) noexcept {
+			const unsigned char* __input   = static_cast<const unsigned char*>(__vinput);
+			const __m256i __surrogate_bits = _mm256_set1_epi16(static_cast<short>(0xFC00));
+			const __m256i __trail          = _mm256_set1_epi16(static_cast<short>(0xDC00));
+			::std::size_t __count          = 0;
+			::std::size_t __index          = 0;
+			for (; __index + 16 <= __size; __index += 16) {
+				const __m256i __block
+					= _mm256_loadu_si256(reinterpret_cast<const __m256i*>(__input + (__index * 2)));
+				const int __trails = _mm256_movemask_epi8(
+					_mm256_cmpeq_epi16(_mm256_and_si256(__block, __surrogate_bits), __trail));
+				__count += 16 - (__kernel_popcount(static_cast<unsigned int>(__trails)) / 2);
+			}
+			return __count + __sse4_2_count_16_to_32(__input + (__index * 2), __size - __index);
+		}
+
+		ZTD_TEXT_SIMD_TARGET_I_("avx2")
+		inline ::std::size_t __avx2_count_32_to_8(const void* __vinput, ::std::size_t __size) noexcept {
+			const unsigned char* __input = static_cast<const unsigned char*>(__vinput);
+			const __m256i __two_units    = _mm256_set1_epi32(0x80);
+			const __m256i __three_units  = _mm256_set1_epi32(0x800);
+			const __m256i __four_units   = _mm256_set1_epi32(0x10000);
+			::std::size_t __count        = 0;
+			::std::size_t __index        = 0;
+			for (; __index + 8 <= __size; __index += 8) {
+				const __m256i __block
+					= _mm256_loadu_si256(reinterpret_cast<const __m256i*>(__input + (__index * 4)));
+				const int __at_least_two = _mm256_movemask_ps(
+					_mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_max_epu32(__block, __two_units), __block)));
+				const int __at_least_three = _mm256_movemask_ps(
+					_mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_max_epu32(__block, __three_units), __block)));
+				const int __at_least_four = _mm256_movemask_ps(
+					_mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_max_epu32(__block, __four_units), __block)));
+				__count += 8 + __kernel_popcount(static_cast<unsigned int>(__at_least_two))
+					+ __kernel_popcount(static_cast<unsigned int>(__at_least_three))
+					+ __kernel_popcount(static_cast<unsigned int>(__at_least_four));
+			}
+			return __count + __sse4_2_count_32_to_8(__input + (__index * 4), __size - __index);
+		}
+
+		ZTD_TEXT_SIMD_TARGET_I_("avx2")
+		inline ::std::size_t __avx2_count_32_to_16(const void* __vinput, ::std::size_t __size) noexcept {
+			const unsigned char* __input = static_cast<const unsigned char*>(__vinput);
+			const __m256i __two_units    = _mm256_set1_epi32(0x10000);
+			::std::size_t __count        = 0;
+			::std::size_t __index        = 0;
+			for (; __index + 8 <= __size; __index += 8) {
+				const __m256i __block
+					= _mm256_loadu_si256(reinterpret_cast<const __m256i*>(__input + (__index * 4)));
+				const int __pairs = _mm256_movemask_ps(
+					_mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_max_epu32(__block, __two_units), __block)));
+				__count += 8 + __kernel_popcount(static_cast<unsigned int>(__pairs));
+			}
+			return __count + __sse4_2_count_32_to_16(__input + (__index * 4), __size - __index);
+		}
+
+		ZTD_TEXT_SIMD_TARGET_I_("avx2")
+		inline ::std::size_t __avx2_byteswap_16(
+			const void* __vinput, ::std::size_t __size, void* __voutput) noexcept {
+			// the shuffle works per 128-bit lane, so both lanes use the same pattern
+			const unsigned char* __input = static_cast<const unsigned char*>(__vinput);
+			unsigned char* __output      = static_cast<unsigned char*>(__voutput);
+			const __m256i __swap         = _mm256_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14,
+				1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+			::std::size_t __index        = 0;
+			for (; __index + 16 <= __size; __index += 16) {
+				const __m256i __block
+					= _mm256_loadu_si256(reinterpret_cast<const __m256i*>(__input + (__index * 2)));
+				_mm256_storeu_si256(
+					reinterpret_cast<__m256i*>(__output + (__index * 2)), _mm256_shuffle_epi8(__block, __swap));
+			}
+			return __index
+				+ __sse4_2_byteswap_16(__input + (__index * 2), __size - __index, __output + (__index * 2));
+		}
+
+		ZTD_TEXT_SIMD_TARGET_I_("avx2")
+		inline ::std::size_t __avx2_byteswap_32(
+			const void* __vinput, ::std::size_t __size, void* __voutput) noexcept {
+			const unsigned char* __input = static_cast<const unsigned char*>(__vinput);
+			unsigned char* __output      = static_cast<unsigned char*>(__voutput);
+			const __m256i __swap         = _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+				3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+			::std::size_t __index        = 0;
+			for (; __index + 8 <= __size; __index += 8) {
+				const __m256i __block
+					= _mm256_loadu_si256(reinterpret_cast<const __m256i*>(__input + (__index * 4)));
+				_mm256_storeu_si256(
+					reinterpret_cast<__m256i*>(__output + (__index * 4)), _mm256_shuffle_epi8(__block, __swap));
+			}
+			return __index
+				+ __sse4_2_byteswap_32(__input + (__index * 4), __size - __index, __output + (__index * 4));
+		}
+
+#endif
+
+#if ZTD_IS_ON(ZTD_TEXT_SIMD_NEON_I_)
+		inline ::std::size_t __neon_ascii_8_to_16(
+			const void* __vinput, ::std::size_t __size, void* __voutput) noexcept {
+			const unsigned char* __input = static_cast<const unsigned char*>(__vinput);
+			unsigned char* __output      = static_cast<unsigned char*>(__voutput);
+			::std::size_t __index        = 0;
+			for (; __index + 16 <= __size; __index += 16) {
+				const uint8x16_t __block = vld1q_u8(__input + __index);
+				if (vmaxvq_u8(__block) >= 0x80) {
+					break;
+				}
+				::std::uint16_t* __target = reinterpret_cast<::std::uint16_t*>(__output + (__index * 2));
+				vst1q_u16(__target, vmovl_u8(vget_low_u8(__block)));
+				vst1q_u16(__target + 8, vmovl_high_u8(__block));
+			}
+			return __index + __scalar_ascii_8_to_16(__input + __index, __size - __index, __output + (__index * 2));
+		}
+
+		inline ::std::size_t __neon_ascii_8_to_32(
+			const void* __vinput, ::std::size_t __size, void* __voutput) noexcept {
+			const unsigned char* __input = static_cast<const unsigned char*>(__vinput);
+			unsigned char* __output      = static_cast<unsigned char*>(__voutput);
+			::std::size_t __index        = 0;
+			for (; __index + 16 <= __size; __index += 16) {
+				const uint8x16_t __block = vld1q_u8(__input + __index);
+				if (vmaxvq_u8(__block) >= 0x80) {
+					break;
+				}
+				const uint16x8_t __low    = vmovl_u8(vget_low_u8(__block));
+				const uint16x8_t __high   = vmovl_high_u8(__block);
+				::std::uint32_t* __target = reinterpret_cast<::std::uint32_t*>(__output + (__index * 4));
+				vst1q_u32(__target, vmovl_u16(vget_low_u16(__low)));
+				vst1q_u32(__target + 4, vmovl_high_u16(__low));
+				vst1q_u32(__target + 8, vmovl_u16(vget_low_u16(__high)));
+				vst1q_u32(__target + 12, vmovl_high_u16(__high));
+			}
+			return __index + __scalar_ascii_8_to_32(__input + __index, __size - __index, __output + (__index * 4));
+		}
+
+		inline ::std::size_t __neon_ascii_16_to_8(
+			const void* __vinput, ::std::size_t __size, void* __voutput) noexcept {
+			const unsigned char* __input = static_cast<const unsigned char*>(__vinput);
+			unsigned char* __output      = static_cast<unsigned char*>(__voutput);
+			::std::size_t __index        = 0;
+			for (; __index + 16 <= __size; __index += 16) {
+				const ::std::uint16_t* __source = reinterpret_cast<const ::std::uint16_t*>(__input + (__index * 2));
+				const uint16x8_t __low          = vld1q_u16(__source);
+				const uint16x8_t __high         = vld1q_u16(__source + 8);
+				if (vmaxvq_u16(vorrq_u16(__low, __high)) >= 0x80) {
+					break;
+				}
+				vst1q_u8(__output + __index, vcombine_u8(vmovn_u16(__low), vmovn_u16(__high)));
+			}
+			return __index + __scalar_ascii_16_to_8(__input + (__index * 2), __size - __index, __output + __index);
+		}
+
+		inline ::std::size_t __neon_ascii_32_to_8(
+			const void* __vinput, ::std::size_t __size, void* __voutput) noexcept {
+			const unsigned char* __input = static_cast<const unsigned char*>(__vinput);
+			unsigned char* __output      = static_cast<unsigned char*>(__voutput);
+			::std::size_t __index        = 0;
+			for (; __index + 16 <= __size; __index += 16) {
+				const ::std::uint32_t* __source = reinterpret_cast<const ::std::uint32_t*>(__input + (__index * 4));
+				const uint32x4_t __block0       = vld1q_u32(__source);
+				const uint32x4_t __block1       = vld1q_u32(__source + 4);
+				const uint32x4_t __block2       = vld1q_u32(__source + 8);
+				const uint32x4_t __block3       = vld1q_u32(__source + 12);
+				const uint32x4_t __all = vorrq_u32(vorrq_u32(__block0, __block1), vorrq_u32(__block2, __block3));
+				if (vmaxvq_u32(__all) >= 0x80) {
+					break;
+				}
+				const uint16x8_t __packed01 = vcombine_u16(vmovn_u32(__block0), vmovn_u32(__block1));
+				const uint16x8_t __packed23 = vcombine_u16(vmovn_u32(__block2), vmovn_u32(__block3));
+				vst1q_u8(__output + __index, vcombine_u8(vmovn_u16(__packed01), vmovn_u16(__packed23)));
+			}
+			return __index + __scalar_ascii_32_to_8(__input + (__index * 4), __size - __index, __output + __index);
+		}
+
+		inline ::std::size_t __neon_bmp_16_to_32(
+			const void* __vinput, ::std::size_t __size, void* __voutput) noexcept {
+			const unsigned char* __input      = static_cast<const unsigned char*>(__vinput);
+			unsigned char* __output           = static_cast<unsigned char*>(__voutput);
+			const uint16x8_t __surrogate_bits = vdupq_n_u16(0xF800);
+			const uint16x8_t __surrogate      = vdupq_n_u16(0xD800);
+			::std::size_t __index             = 0;
+			for (; __index + 8 <= __size; __index += 8) {
+				const uint16x8_t __block
+					= vld1q_u16(reinterpret_cast<const ::std::uint16_t*>(__input + (__index * 2)));
+				if (vmaxvq_u16(vceqq_u16(vandq_u16(__block, __surrogate_bits), __surrogate)) != 0) {
+					break;
+				}
+				::std::uint32_t* __target = reinterpret_cast<::std::uint32_t*>(__output + (__index * 4));
+				vst1q_u32(__target, vmovl_u16(vget_low_u16(__block)));
+				vst1q_u32(__target + 4, vmovl_high_u16(__block));
+			}
+			return __index
+				+ __scalar_bmp_16_to_32(__input + (__index * 2), __size - __index, __output + (__index * 4));
+		}
+
+		inline ::std::size_t __neon_bmp_32_to_16(
+			const void* __vinput, ::std::size_t __size, void* __voutput) noexcept {
+			const unsigned char* __input      = static_cast<const unsigned char*>(__vinput);
+			unsigned char* __output           = static_cast<unsigned char*>(__voutput);
+			const uint32x4_t __surrogate_bits = vdupq_n_u32(0xF800);
+			const uint32x4_t __surrogate      = vdupq_n_u32(0xD800);
+			::std::size_t __index             = 0;
+			for (; __index + 8 <= __size; __index += 8) {
+				const ::std::uint32_t* __source = reinterpret_cast<const ::std::uint32_t*>(__input + (__index * 4));
+				const uint32x4_t __low          = vld1q_u32(__source);
+				const uint32x4_t __high         = vld1q_u32(__source + 4);
+				if (vmaxvq_u32(vorrq_u32(__low, __high)) > 0xFFFF) {
+					break;
+				}
+				const uint32x4_t __surrogates
+					= vorrq_u32(vceqq_u32(vandq_u32(__low, __surrogate_bits), __surrogate),
+					     vceqq_u32(vandq_u32(__high, __surrogate_bits), __surrogate));
+				if (vmaxvq_u32(__surrogates) != 0) {
+					break;
+				}
+				vst1q_u16(reinterpret_cast<::std::uint16_t*>(__output + (__index * 2)),
+					vcombine_u16(vmovn_u32(__low), vmovn_u32(__high)));
+			}
+			return __index
+				+ __scalar_bmp_32_to_16(__input + (__index * 4), __size - __index, __output + (__index * 2));
+		}
+		inline uint8x16_t __neon_utf8_block_errors(uint8x16_t __block, uint8x16_t __previous_block) noexcept {
+			const uint8x16_t __low_nibble   = vdupq_n_u8(0x0F);
+			const uint8x16_t __previous1    = vextq_u8(__previous_block, __block, 15);
+			const uint8x16_t __previous2    = vextq_u8(__previous_block, __block, 14);
+			const uint8x16_t __previous3    = vextq_u8(__previous_block, __block, 13);
+			const uint8x16_t __first_high
+				= vqtbl1q_u8(vld1q_u8(__utf8_first_high_nibble_errors), vshrq_n_u8(__previous1, 4));
+			const uint8x16_t __first_low
+				= vqtbl1q_u8(vld1q_u8(__utf8_first_low_nibble_errors), vandq_u8(__previous1, __low_nibble));
+			const uint8x16_t __second_high
+				= vqtbl1q_u8(vld1q_u8(__utf8_second_high_nibble_errors), vshrq_n_u8(__block, 4));
+			const uint8x16_t __pair_errors  = vandq_u8(vandq_u8(__first_high, __first_low), __second_high);
+			const uint8x16_t __third_bytes  = vqsubq_u8(__previous2, vdupq_n_u8(0xE0 - 0x80));
+			const uint8x16_t __fourth_bytes = vqsubq_u8(__previous3, vdupq_n_u8(0xF0 - 0x80));
+			const uint8x16_t __must_continue = vandq_u8(vorrq_u8(__third_bytes, __fourth_bytes), vdupq_n_u8(0x80));
+			return veorq_u8(__must_continue, __pair_errors);
+		}
+
+		inline ::std::size_t __neon_validate_utf8(const void* __vinput, ::std::size_t __size) noexcept {
+			const unsigned char* __input         = static_cast<const unsigned char*>(__vinput);
+			const uint8x16_t __incomplete_limits = vld1q_u8(__utf8_incomplete_limits + 16);
+			uint8x16_t __previous_block          = vdupq_n_u8(0);
+			uint8x16_t __previous_incomplete     = vdupq_n_u8(0);
+			::std::size_t __index                = 0;
+			for (; __index + 16 <= __size; __index += 16) {
+				const uint8x16_t __block = vld1q_u8(__input + __index);
+				uint8x16_t __errors;
+				if (vmaxvq_u8(__block) < 0x80) {
+					__errors              = __previous_incomplete;
+					__previous_incomplete = vdupq_n_u8(0);
+				}
+				else {
+					__errors              = __neon_utf8_block_errors(__block, __previous_block);
+					__previous_incomplete = vqsubq_u8(__block, __incomplete_limits);
+				}
+				if (vmaxvq_u8(__errors) != 0) {
+					break;
+				}
+				__previous_block = __block;
+			}
+			const ::std::size_t __resume = __utf8_sequence_start(__input, __index);
+			return __resume + __scalar_validate_utf8(__input + __resume, __size - __resume);
+		}
+
+		inline ::std::size_t __neon_validate_utf16(const void* __vinput, ::std::size_t __size) noexcept {
+			const unsigned char* __input      = static_cast<const unsigned char*>(__vinput);
+			const uint16x8_t __surrogate_bits = vdupq_n_u16(0xFC00);
+			const uint16x8_t __lead           = vdupq_n_u16(0xD800);
+			const uint16x8_t __trail          = vdupq_n_u16(0xDC00);
+			uint16x8_t __previous_leads       = vdupq_n_u16(0);
+			::std::size_t __index             = 0;
+			for (; __index + 8 <= __size; __index += 8) {
+				const uint16x8_t __block
+					= vld1q_u16(reinterpret_cast<const ::std::uint16_t*>(__input + (__index * 2)));
+				const uint16x8_t __surrogates      = vandq_u16(__block, __surrogate_bits);
+				const uint16x8_t __leads           = vceqq_u16(__surrogates, __lead);
+				const uint16x8_t __trails          = vceqq_u16(__surrogates, __trail);
+				const uint16x8_t __expected_trails = vextq_u16(__previous_leads, __leads, 7);
+				if (vmaxvq_u16(veorq_u16(__expected_trails, __trails)) != 0) {
+					break;
+				}
+				__previous_leads = __leads;
+			}
+			const ::std::size_t __resume = __index - (vgetq_lane_u16(__previous_leads, 7) != 0 ? 1 : 0);
+			return __resume + __scalar_validate_utf16(__input + (__resume * 2), __size - __resume);
+		}
+
+		inline ::std::size_t __neon_validate_utf32(const void* __vinput, ::std::size_t __size) noexcept {
+			const unsigned char* __input      = static_cast<const unsigned char*>(__vinput);
+			const uint32x4_t __surrogate_bits = vdupq_n_u32(0xFFFFF800);
+			const uint32x4_t __surrogate      = vdupq_n_u32(0xD800);
+			::std::size_t __index             = 0;
+			for (; __index + 8 <= __size; __index += 8) {
+				const ::std::uint32_t* __source = reinterpret_cast<const ::std::uint32_t*>(__input + (__index * 4));
+				const uint32x4_t __low          = vld1q_u32(__source);
+				const uint32x4_t __high         = vld1q_u32(__source + 4);
+				if (vmaxvq_u32(vorrq_u32(__low, __high)) > 0x10FFFF) {
+					break;
+				}
+				const uint32x4_t __surrogates
+					= vorrq_u32(vceqq_u32(vandq_u32(__low, __surrogate_bits), __surrogate),
+					     vceqq_u32(vandq_u32(__high, __surrogate_bits), __surrogate));
+				if (vmaxvq_u32(__surrogates) != 0) {
+					break;
+				}
+			}
+			return __index + __scalar_validate_utf32(__input + (__index * 4), __size - __index);
+		}
+
+		inline ::std::size_t __neon_count_8_to_16(const void* __vinput, ::std::size_t __size) noexcept {
+			const unsigned char* __input = static_cast<const unsigned char*>(__vinput);
+			::std::size_t __count        = 0;
+			::std::size_t __index        = 0;
+			for (; __index + 16 <= __size; __index += 16) {
+				const uint8x16_t __block = vld1q_u8(__input + __index);
+				const uint8x16_t __continuations
+					= vandq_u8(vcgeq_u8(__block, vdupq_n_u8(0x80)), vcltq_u8(__block, vdupq_n_u8(0xC0)));
+				const uint8x16_t __four_byte_leads = vcgeq_u8(__block, vdupq_n_u8(0xF0));
+				__count += 16 - vaddvq_u8(vshrq_n_u8(__continuations, 7))
+					+ vaddvq_u8(vshrq_n_u8(__four_byte_leads, 7));
+			}
+			return __count + __scalar_count_8_to_16(__input + __index, __size - __index);
+		}
+
+		inline ::std::size_t __neon_count_8_to_32(const void* __vinput, ::std::size_t __size) noexcept {
+			const unsigned char* __input = static_cast<const unsigned char*>(__vinput);
+			::std::size_t __count        = 0;
+			::std::size_t __index        = 0;
+			for (; __index + 16 <= __size; __index += 16) {
+				const uint8x16_t __block = vld1q_u8(__input + __index);
+				const uint8x16_t __continuations
+					= vandq_u8(vcgeq_u8(__block, vdupq_n_u8(0x80)), vcltq_u8(__block, vdupq_n_u8(0xC0)));
+				__count += 16 - vaddvq_u8(vshrq_n_u8(__continuations, 7));
+			}
+			return __count + __scalar_count_8_to_32(__input + __index, __size - __index);
+		}
+
+		inline ::std::size_t __neon_count_16_to_8(const void* __vinput, ::std::size_t __size) noexcept {
+			const unsigned char* __input = static_cast<const unsigned char*>(__vinput);
+			::std::size_t __count        = 0;
+			::std::size_t __index        = 0;
+			for (; __index + 8 <= __size; __index += 8) {
+				const uint16x8_t __block
+					= vld1q_u16(reinterpret_cast<const ::std::uint16_t*>(__input + (__index * 2)));
+				const uint16x8_t __at_least_two   = vshrq_n_u16(vcgeq_u16(__block, vdupq_n_u16(0x80)), 15);
+				const uint16x8_t __at_least_three = vshrq_n_u16(vcgeq_u16(__block, vdupq_n_u16(0x800)), 15);
+				const uint16x8_t __surrogates
+					= vshrq_n_u16(vceqq_u16(vandq_u16(__block, vdupq_n_u16(0xF800)), vdupq_n_u16(0xD800)), 15);
+				__count += 8 + vaddvq_u16(vsubq_u16(vaddq_u16(__at_least_two, __at_least_three), __surrogates));
+			}
+			return __count + __scalar_count_16_to_8(__input + (__index * 2), __size - __index);
+		}
+
+		inline ::std::size_t __neon_count_16_to_32(const void* __vinput, ::std::size_t __size) noexcept {
+			const unsigned char* __input = static_cast<const unsigned char*>(__vinput);
+			::std::size_t __count        = 0;
+			::std::size_t __index        = 0;
+			for (; __index + 8 <= __size; __index += 8) {
+				const uint16x8_t __block
+					= vld1q_u16(reinterpret_cast<const ::std::uint16_t*>(__input + (__index * 2)));
+				const uint16x8_t __trails
+					= vceqq_u16(vandq_u16(__block, vdupq_n_u16(0xFC00)), vdupq_n_u16(0xDC00));
+				__count += 8 - vaddvq_u16(vshrq_n_u16(__trails, 15));
+			}
+			return __count + __scalar_count_16_to_32(__input + (__index * 2), __size - __index);
+		}
+
+		inline ::std::size_t __neon_count_32_to_8(const void* __vinput, ::std::size_t __size) noexcept {
+			const unsigned char* __input = static_cast<const unsigned char*>(__vinput);
+			::std::size_t __count        = 0;
+			::std::size_t __index        = 0;
+			for (; __index + 4 <= __size; __index += 4) {
+				const uint32x4_t __block
+					= vld1q_u32(reinterpret_cast<const ::std::uint32_t*>(__input + (__index * 4)));
+				const uint32x4_t __at_least_two   = vshrq_n_u32(vcgeq_u32(__block, vdupq_n_u32(0x80)), 31);
+				const uint32x4_t __at_least_three = vshrq_n_u32(vcgeq_u32(__block, vdupq_n_u32(0x800)), 31);
+				const uint32x4_t __at_least_four  = vshrq_n_u32(vcgeq_u32(__block, vdupq_n_u32(0x10000)), 31);
+				const uint32x4_t __extra_units
+					= vaddq_u32(vaddq_u32(__at_least_two, __at_least_three), __at_least_four);
+				__count += 4 + vaddvq_u32(__extra_units);
+			}
+			return __count + __scalar_count_32_to_8(__input + (__index * 4), __size - __index);
+		}
+
+		inline ::std::size_t __neon_count_32_to_16(const void* __vinput, ::std::size_t __size) noexcept {
+			const unsigned char* __input = static_cast<const unsigned char*>(__vinput);
+			::std::size_t __count        = 0;
+			::std::size_t __index        = 0;
+			for (; __index + 4 <= __size; __index += 4) {
+				const uint32x4_t __block
+					= vld1q_u32(reinterpret_cast<const ::std::uint32_t*>(__input + (__index * 4)));
+				__count += 4 + vaddvq_u32(vshrq_n_u32(vcgeq_u32(__block, vdupq_n_u32(0x10000)), 31));
+			}
+			return __count + __scalar_count_32_to_16(__input + (__index * 4), __size - __index);
+		}
+
+		inline ::std::size_t __neon_byteswap_16(
+			const void* __vinput, ::std::size_t __size, void* __voutput) noexcept {
+			const unsigned char* __input = static_cast<const unsigned char*>(__vinput);
+			unsigned char* __output      = static_cast<unsigned char*>(__voutput);
+			::std::size_t __index        = 0;
+			for (; __index + 8 <= __size; __index += 8) {
+				vst1q_u8(__output + (__index * 2), vrev16q_u8(vld1q_u8(__input + (__index * 2))));
+			}
+			return __index
+				+ __scalar_byteswap_16(__input + (__index * 2), __size - __index, __output + (__index * 2));
+		}
+
+		inline ::std::size_t __neon_byteswap_32(
+			const void* __vinput, ::std::size_t __size, void* __voutput) noexcept {
+			const unsigned char* __input = static_cast<const unsigned char*>(__vinput);
+			unsigned char* __output      = static_cast<unsigned char*>(__voutput);
+			::std::size_t __index        = 0;
+			for (; __index + 4 <= __size; __index += 4) {
+				vst1q_u8(__output + (__index * 4), vrev32q_u8(vld1q_u8(__input + (__index * 4))));
+			}
+			return __index
+				+ __scalar_byteswap_32(__input + (__index * 4), __size - __index, __output + (__index * 4));
+		}
+
+#endif
+
+		inline __simd_level __detect_simd_level() noexcept {
+#if ZTD_IS_ON(ZTD_TEXT_SIMD_X86_I_)
+	#if defined(_MSC_VER)
+			int __info[4] = {};
+			__cpuid(__info, 0);
+			const int __max_leaf = __info[0];
+			if (__max_leaf < 1) {
+				return __simd_level::__scalar;
+			}
+			__cpuid(__info, 1);
+			const bool __has_sse4_2  = (__info[2] & (1 << 20)) != 0;
+			const bool __has_osxsave = (__info[2] & (1 << 27)) != 0;
+			const bool __has_avx     = (__info[2] & (1 << 28)) != 0;
+			bool __has_avx2          = false;
+			if (__max_leaf >= 7 && __has_osxsave && __has_avx) {
+				// the operating system must also save the upper halves of the YMM registers
+				if ((_xgetbv(0) & 0x6) == 0x6) {
+					__cpuidex(__info, 7, 0);
+					__has_avx2 = (__info[1] & (1 << 5)) != 0;
+				}
+			}
+	#else
+			__builtin_cpu_init();
+			const bool __has_sse4_2 = __builtin_cpu_supports("sse4.2");
+			const bool __has_avx2   = __builtin_cpu_supports("avx2");
+	#endif
+			if (__has_avx2 && __has_sse4_2) {
+				return __simd_level::__avx2;
+			}
+			if (__has_sse4_2) {
+				return __simd_level::__sse4_2;
+			}
+			return __simd_level::__scalar;
+#elif ZTD_IS_ON(ZTD_TEXT_SIMD_NEON_I_)
+			// Advanced SIMD is mandatory on AArch64
+			return __simd_level::__neon;
+#else
+			return __simd_level::__scalar;
+#endif
+		}
+
+		inline __unicode_kernel_table __make_unicode_kernel_table(__simd_level __level) noexcept {
+			switch (__level) {
+#if ZTD_IS_ON(ZTD_TEXT_SIMD_X86_I_)
+			case __simd_level::__avx2:
+				return __unicode_kernel_table { __level, &__avx2_ascii_8_to_16, &__avx2_ascii_8_to_32,
+					&__avx2_ascii_16_to_8, &__sse4_2_ascii_32_to_8, &__avx2_bmp_16_to_32, &__avx2_bmp_32_to_16,
+					&__avx2_lookup_8_to_32, &__avx2_validate_utf8, &__avx2_validate_utf16,
+					&__avx2_validate_utf32, &__avx2_count_8_to_16, &__avx2_count_8_to_32,
+					&__avx2_count_16_to_8, &__avx2_count_16_to_32, &__avx2_count_32_to_8, &__avx2_count_32_to_16,
+					&__avx2_byteswap_16, &__avx2_byteswap_32 };
+			case __simd_level::__sse4_2:
+				return __unicode_kernel_table { __level, &__sse4_2_ascii_8_to_16, &__sse4_2_ascii_8_to_32,
+					&__sse4_2_ascii_16_to_8, &__sse4_2_ascii_32_to_8, &__sse4_2_bmp_16_to_32,
+					&__sse4_2_bmp_32_to_16, &__scalar_lookup_8_to_32, &__sse4_2_validate_utf8,
+					&__sse4_2_validate_utf16, &__sse4_2_validate_utf32, &__sse4_2_count_8_to_16,
+					&__sse4_2_count_8_to_32, &__sse4_2_count_16_to_8, &__sse4_2_count_16_to_32,
+					&__sse4_2_count_32_to_8, &__sse4_2_count_32_to_16, &__sse4_2_byteswap_16,
+					&__sse4_2_byteswap_32 };
+#endif
+#if ZTD_IS_ON(ZTD_TEXT_SIMD_NEON_I_)
+			case __simd_level::__neon:
+				return __unicode_kernel_table { __level, &__neon_ascii_8_to_16, &__neon_ascii_8_to_32,
+					&__neon_ascii_16_to_8, &__neon_ascii_32_to_8, &__neon_bmp_16_to_32, &__neon_bmp_32_to_16,
+					&__scalar_lookup_8_to_32, &__neon_validate_utf8, &__neon_validate_utf16,
+					&__neon_validate_utf32, &__neon_count_8_to_16, &__neon_count_8_to_32,
+					&__neon_count_16_to_8, &__neon_count_16_to_32, &__neon_count_32_to_8, &__neon_count_32_to_16,
+					&__neon_byteswap_16, &__neon_byteswap_32 };
+#endif
+			default:
+				break;
+			}
+			return __unicode_kernel_table { __simd_level::__scalar, &__scalar_ascii_8_to_16, &__scalar_ascii_8_to_32,
+				&__scalar_ascii_16_to_8, &__scalar_ascii_32_to_8, &__scalar_bmp_16_to_32, &__scalar_bmp_32_to_16,
+				&__scalar_lookup_8_to_32, &__scalar_validate_utf8, &__scalar_validate_utf16,
+				&__scalar_validate_utf32, &__scalar_count_8_to_16, &__scalar_count_8_to_32, &__scalar_count_16_to_8,
+				&__scalar_count_16_to_32, &__scalar_count_32_to_8, &__scalar_count_32_to_16, &__scalar_byteswap_16,
+				&__scalar_byteswap_32 };
+		}
+
+		//////
+		/// @brief The primitive kernels for the running CPU. Detection happens once, on first use.
+		inline const __unicode_kernel_table& __unicode_kernels() noexcept {
+			static const __unicode_kernel_table __table = __make_unicode_kernel_table(__detect_simd_level());
+			return __table;
+		}
+
+		template <typename _OutUnit>
+		inline ::std::size_t __kernel_write_utf8(
+			_OutUnit* __output, ::std::size_t __size, ::std::uint_least32_t __code_point) noexcept {
+			if (__code_point < 0x80) {
+				if (__size < 1) {
+					return 0;
+				}
+				__output[0] = static_cast<_OutUnit>(__code_point);
+				return 1;
+			}
+			if (__code_point < 0x800) {
+				if (__size < 2) {
+					return 0;
+				}
+				__output[0] = static_cast<_OutUnit>(0xC0 | (__code_point >> 6));
+				__output[1] = static_cast<_OutUnit>(0x80 | (__code_point & 0x3F));
+				return 2;
+			}
+			if (__code_point < 0x10000) {
+				if (__size < 3) {
+					return 0;
+				}
+				__output[0] = static_cast<_OutUnit>(0xE0 | (__code_point >> 12));
+				__output[1] = static_cast<_OutUnit>(0x80 | ((__code_point >> 6) & 0x3F));
+				__output[2] = static_cast<_OutUnit>(0x80 | (__code_point & 0x3F));
+				return 3;
+			}
+			if (__size < 4) {
+				return 0;
+			}
+			__output[0] = static_cast<_OutUnit>(0xF0 | (__code_point >> 18));
+			__output[1] = static_cast<_OutUnit>(0x80 | ((__code_point >> 12) & 0x3F));
+			__output[2] = static_cast<_OutUnit>(0x80 | ((__code_point >> 6) & 0x3F));
+			__output[3] = static_cast<_OutUnit>(0x80 | (__code_point & 0x3F));
+			return 4;
+		}
+
+		template <typename _OutUnit>
+		inline ::std::size_t __kernel_write_utf16(
+			_OutUnit* __output, ::std::size_t __size, ::std::uint_least32_t __code_point) noexcept {
+			if (__code_point < 0x10000) {
+				if (__size < 1) {
+					return 0;
+				}
+				__output[0] = static_cast<_OutUnit>(__code_point);
+				return 1;
+			}
+			if (__size < 2) {
+				return 0;
+			}
+			const ::std::uint_least32_t __offset = __code_point - 0x10000;
+			__output[0]                          = static_cast<_OutUnit>(0xD800 + (__offset >> 10));
+			__output[1]                          = static_cast<_OutUnit>(0xDC00 + (__offset & 0x3FF));
+			return 2;
+		}
+
+		template <typename _OutUnit>
+		inline ::std::size_t __kernel_write_utf32(
+			_OutUnit* __output, ::std::size_t __size, ::std::uint_least32_t __code_point) noexcept {
+			if (__size < 1) {
+				return 0;
+			}
+			__output[0] = static_cast<_OutUnit>(__code_point);
+			return 1;
+		}
+
+		//////
+		/// @brief Transcodes as much of `__input` as possible from one Unicode Transformation Format to another,
+		/// using the CPU-selected primitives for runs of ASCII (or, between UTF-16 and UTF-32, runs of
+		/// non-surrogate code units) and a strict scalar path for everything else.
+		///
+		/// @tparam _FromWidth The bit width of the input encoding's code units (8, 16, or 32).
+		/// @tparam _ToWidth The bit width of the output encoding's code units (8, 16, or 32).
+		///
+		/// @remarks Stops before the first ill-formed or incomplete input sequence and before any sequence whose
+		/// output would not completely fit, so the caller can take over exactly there with the full single-step
+		/// machinery (error handlers, state, and so on).
+		template <::std::size_t _FromWidth, ::std::size_t _ToWidth, typename _InUnit, typename _OutUnit>
+		inline __unicode_kernel_result __unicode_transcode_kernel(const _InUnit* __input, ::std::size_t __input_size,
+			_OutUnit* __output, ::std::size_t __output_size) noexcept {
+			static_assert(sizeof(_InUnit) * CHAR_BIT == _FromWidth && sizeof(_OutUnit) * CHAR_BIT == _ToWidth,
+				"the code unit types must match the kernel's widths");
+			static_assert(_FromWidth != _ToWidth, "the kernel only converts between different widths");
+			const __unicode_kernel_table& __kernels = __unicode_kernels();
+			__unicode_kernel_fn __fast_run          = nullptr;
+			if constexpr (_FromWidth == 8 && _ToWidth == 16) {
+				__fast_run = __kernels.__ascii_8_to_16;
+			}
+			else if constexpr (_FromWidth == 8 && _ToWidth == 32) {
+				__fast_run = __kernels.__ascii_8_to_32;
+			}
+			else if constexpr (_FromWidth == 16 && _ToWidth == 8) {
+				__fast_run = __kernels.__ascii_16_to_8;
+			}
+			else if constexpr (_FromWidth == 32 && _ToWidth == 8) {
+				__fast_run = __kernels.__ascii_32_to_8;
+			}
+			else if constexpr (_FromWidth == 16 && _ToWidth == 32) {
+				__fast_run = __kernels.__bmp_16_to_32;
+			}
+			else {
+				__fast_run = __kernels.__bmp_32_to_16;
+			}
+			::std::size_t __read                         = 0;
+			::std::size_t __written                      = 0;
+			while (__read < __input_size) {
+				const ::std::uint_least32_t __lead = __kernel_unit(__input[__read]);
+				bool __is_fast_unit = false;
+				if constexpr (_FromWidth == 8 || _ToWidth == 8) {
+					__is_fast_unit = __lead < 0x80;
+				}
+				else {
+					__is_fast_unit = __lead <= 0xFFFF && (__lead & 0xF800) != 0xD800;
+				}
+				if (__is_fast_unit) {
+					const ::std::size_t __available_input  = __input_size - __read;
+					const ::std::size_t __available_output = __output_size - __written;
+					const ::std::size_t __limit
+						= __available_input < __available_output ? __available_input : __available_output;
+					if (__limit == 0) {
+						break;
+					}
+					const ::std::size_t __converted = __fast_run(__input + __read, __limit, __output + __written);
+					__read += __converted;
+					__written += __converted;
+					continue;
+				}
+				::std::uint_least32_t __code_point = 0;
+				::std::size_t __read_size          = 0;
+				if constexpr (_FromWidth == 8) {
+					__read_size = __kernel_read_utf8(__input + __read, __input_size - __read, __code_point);
+				}
+				else if constexpr (_FromWidth == 16) {
+					__read_size = __kernel_read_utf16(__input + __read, __input_size - __read, __code_point);
+				}
+				else {
+					__read_size = __kernel_read_utf32(__input + __read, __input_size - __read, __code_point);
+				}
+				if (__read_size == 0) {
+					break;
+				}
+				::std::size_t __write_size = 0;
+				if constexpr (_ToWidth == 8) {
+					__write_size
+						= __kernel_write_utf8(__output + __written, __output_size - __written, __code_point);
+				}
+				else if constexpr (_ToWidth == 16) {
+					__write_size
+						= __kernel_write_utf16(__output + __written, __output_size - __written, __code_point);
+				}
+				else {
+					__write_size
+						= __kernel_write_utf32(__output + __written, __output_size - __written, __code_point);
+				}
+				if (__write_size == 0) {
+					break;
+				}
+				__read += __read_size;
+				__written += __write_size;
+			}
+			return __unicode_kernel_result { __read, __written };
+		}
+
+		//////
+		/// @brief Returns how many code units at the start of `__input` form complete, well-formed sequences of the
+		/// Unicode Transformation Format with the given code unit bit width, using the CPU-selected validators.
+		///
+		/// @tparam _Width The bit width of the encoding's code units (8, 16, or 32).
+		///
+		/// @remarks The returned length is always the exact position of the first ill-formed or incomplete
+		/// sequence (or `__input_size`, if there is none).
+		template <::std::size_t _Width, typename _InUnit>
+		inline ::std::size_t __unicode_validate_kernel(const _InUnit* __input, ::std::size_t __input_size) noexcept {
+			static_assert(sizeof(_InUnit) * CHAR_BIT == _Width, "the code unit type must match the kernel's width");
+			const __unicode_kernel_table& __kernels = __unicode_kernels();
+			if constexpr (_Width == 8) {
+				return __kernels.__validate_utf8(__input, __input_size);
+			}
+			else if constexpr (_Width == 16) {
+				return __kernels.__validate_utf16(__input, __input_size);
+			}
+			else {
+				return __kernels.__validate_utf32(__input, __input_size);
+			}
+		}
+
+		//////
+		/// @brief Returns how many code units of the Unicode Transformation Format with `_ToWidth`-bit code units
+		/// the well-formed `__input` becomes, using the CPU-selected counting kernels. With a `_ToWidth` of 32, this
+		/// is the number of code points.
+		///
+		/// @tparam _FromWidth The bit width of the input encoding's code units (8, 16, or 32).
+		/// @tparam _ToWidth The bit width of the output encoding's code units (8, 16, or 32).
+		///
+		/// @remarks `__input` must be well-formed in its entirety (e.g., the prefix found by
+		/// ztd::text::__txt_detail::__unicode_validate_kernel).
+		template <::std::size_t _FromWidth, ::std::size_t _ToWidth, typename _InUnit>
+		inline ::std::size_t __unicode_count_kernel(const _InUnit* __input, ::std::size_t __input_size) noexcept {
+			static_assert(
+				sizeof(_InUnit) * CHAR_BIT == _FromWidth, "the code unit type must match the kernel's width");
+			const __unicode_kernel_table& __kernels = __unicode_kernels();
+			if constexpr (_FromWidth == _ToWidth) {
+				(void)__kernels;
+				(void)__input;
+				return __input_size;
+			}
+			else if constexpr (_FromWidth == 8 && _ToWidth == 16) {
+				return __kernels.__count_8_to_16(__input, __input_size);
+			}
+			else if constexpr (_FromWidth == 8 && _ToWidth == 32) {
+				return __kernels.__count_8_to_32(__input, __input_size);
+			}
+			else if constexpr (_FromWidth == 16 && _ToWidth == 8) {
+				return __kernels.__count_16_to_8(__input, __input_size);
+			}
+			else if constexpr (_FromWidth == 16 && _ToWidth == 32) {
+				return __kernels.__count_16_to_32(__input, __input_size);
+			}
+			else if constexpr (_FromWidth == 32 && _ToWidth == 8) {
+				return __kernels.__count_32_to_8(__input, __input_size);
+			}
+			else {
+				return __kernels.__count_32_to_16(__input, __input_size);
+			}
+		}
+
+		//////
+		/// @brief Copies `__size` code units with the given bit width from `__input` to `__output`, reversing the
+		/// byte order of each one along the way if `_Swap` is `true`, using the CPU-selected shuffles.
+		///
+		/// @tparam _Width The bit width of the code units (16 or 32).
+		/// @tparam _Swap Whether the input and output byte orders differ.
+		template <::std::size_t _Width, bool _Swap>
+		inline void __unicode_copy_units_kernel(const void* __input, ::std::size_t __size, void* __output) noexcept {
+			static_assert(_Width == 16 || _Width == 32, "only 16-bit and 32-bit code units have a byte order");
+			if constexpr (!_Swap) {
+				::std::memcpy(__output, __input, __size * (_Width / CHAR_BIT));
+			}
+			else if constexpr (_Width == 16) {
+				__unicode_kernels().__byteswap_16(__input, __size, __output);
+			}
+			else {
+				__unicode_kernels().__byteswap_32(__input, __size, __output);
+			}
+		}
+	} // namespace __txt_detail
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#include <ztd/epilogue.hpp>
+
+#endif
@@ -0,0 +1,107 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#pragma once
+
+#ifndef ZTD_TEXT_DETAIL_VALIDATE_UNICODE_KERNELS_HPP
+#define ZTD_TEXT_DETAIL_VALIDATE_UNICODE_KERNELS_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/detail/span_reconstruct.hpp>
+#include <ztd/text/detail/transcode_unicode_kernels.hpp>
+#include <ztd/text/detail/unicode_kernels.hpp>
+
+#include <ztd/idk/tag.hpp>
+#include <ztd/idk/type_traits.hpp>
+#include <ztd/ranges/adl.hpp>
+#include <ztd/ranges/range.hpp>
+#include <ztd/ranges/subrange.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include <ztd/prologue.hpp>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	namespace __txt_impl {
+		//////
+		/// @brief Validates UTF-8, UTF-16, or UTF-32 in bulk, using the vectorized validators selected for the
+		/// running CPU when the input is contiguous.
+		///
+		/// @remarks The validators find the exact position of the first ill-formed or incomplete sequence; the rest
+		/// of the input is then handed to ztd::text::basic_validate_decodable_as, so the returned input position and
+		/// states are exactly what it would have produced for the whole input. Non-contiguous ranges and constant
+		/// evaluation go to ztd::text::basic_validate_decodable_as directly.
+		template <typename _Encoding, typename _Input, typename _EncodingArg, typename _DecodeState,
+			typename _EncodeState,
+			::std::enable_if_t<__txt_detail::__unicode_kernel_width_v<_Encoding> != 0>* = nullptr>
+		constexpr auto __text_validate_decodable_as(::ztd::tag<_Encoding>, _Input&& __input,
+			_EncodingArg&& __encoding, _DecodeState& __decode_state, _EncodeState& __encode_state) {
+			using _InitialInput           = __txt_detail::__span_reconstruct_t<_Input, _Input>;
+			using _WorkingInput           = ::ztd::ranges::subrange_for_t<_InitialInput>;
+			constexpr ::std::size_t _Width = __txt_detail::__unicode_kernel_width_v<_Encoding>;
+
+			if constexpr (__txt_detail::__is_unicode_kernel_range_v<_WorkingInput, _Width>) {
+				_WorkingInput __working_input(
+					__txt_detail::__span_reconstruct<_Input>(::std::forward<_Input>(__input)));
+#if ZTD_IS_ON(ZTD_STD_LIBRARY_IS_CONSTANT_EVALUATED)
+				if (!::std::is_constant_evaluated())
+#endif
+				{
+					const ::std::size_t __input_size
+						= static_cast<::std::size_t>(::ztd::ranges::size(__working_input));
+					if (__input_size != 0) {
+						const ::std::size_t __valid_size = __txt_detail::__unicode_validate_kernel<_Width>(
+							__txt_detail::__unicode_kernel_data(__working_input), __input_size);
+						__working_input = __txt_detail::__unicode_kernel_advance(__working_input, __valid_size);
+					}
+				}
+				// an empty remainder is trivially valid; otherwise, this reports the error exactly where the
+				// single-step loop would have
+				return basic_validate_decodable_as(::std::move(__working_input),
+					::std::forward<_EncodingArg>(__encoding), __decode_state, __encode_state);
+			}
+			else {
+				return basic_validate_decodable_as(::std::forward<_Input>(__input),
+					::std::forward<_EncodingArg>(__encoding), __decode_state, __encode_state);
+			}
+		}
+	} // namespace __txt_impl
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#include <ztd/epilogue.hpp>
+
+#endif
@@ -67,6 +67,10 @@ namespace ztd { namespace text {
 			  (is_code_points_replaceable_v<_Encoding> && !is_code_points_maybe_replaceable_v<_Encoding>)
 			       || is_unicode_code_point_v<code_point_t<_Encoding>>> { };
 
+		template <typename _Encoding>
+		struct __decode_error_handler_always_returns_ok<_Encoding, run_replacement_handler_t>
+		: public __decode_error_handler_always_returns_ok<_Encoding, replacement_handler_t> { };
+
 		template <typename _Encoding>
 		struct __decode_error_handler_always_returns_ok<_Encoding, throw_handler_t> : public ::std::true_type { };
 
@@ -97,6 +101,10 @@ namespace ztd { namespace text {
 			  (is_code_units_replaceable_v<_Encoding> && !is_code_units_maybe_replaceable_v<_Encoding>)
 			       || is_unicode_code_point_v<code_unit_t<_Encoding>>> { };
 
+		template <typename _Encoding>
+		struct __encode_error_handler_always_returns_ok<_Encoding, run_replacement_handler_t>
+		: public __encode_error_handler_always_returns_ok<_Encoding, replacement_handler_t> { };
+
 		template <typename _Encoding>
 		struct __encode_error_handler_always_returns_ok<_Encoding, throw_handler_t> : public ::std::true_type { };
 
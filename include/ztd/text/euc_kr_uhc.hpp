@@ -41,6 +41,7 @@
 #include <ztd/text/is_ignorable_error_handler.hpp>
 #include <ztd/text/detail/empty_state.hpp>
 #include <ztd/text/detail/replacement_units.hpp>
+#include <ztd/text/detail/multibyte_reverse_tables.hpp>
 
 #include <ztd/encoding_tables/euc_kr_uhc.tables.hpp>
 #include <ztd/ranges/adl.hpp>
@@ -259,7 +260,10 @@ namespace ztd { namespace text {
 					ztd::text::encoding_error::ok);
 			}
 
-			::std::optional<::std::size_t> __maybe_index = ::ztd::et::euc_kr_uhc_code_point_to_index(__code_point32);
+			::std::optional<::std::size_t> __maybe_index
+				= __txt_detail::__multibyte_code_point_to_index<126 * 190,
+				     &::ztd::et::euc_kr_uhc_index_to_code_point,
+				     &::ztd::et::euc_kr_uhc_code_point_to_index>(__code_point32);
 			if (__maybe_index) {
 				const ::std::size_t __index = *__maybe_index;
 				::std::size_t __first       = (__index / 190) + 0x81;
@@ -144,7 +144,7 @@ namespace ztd { namespace text {
 	template <typename, typename, typename, typename, typename>
 	class basic_text_view;
 
-	template <typename, typename, typename>
+	template <typename, typename, typename, typename>
 	class basic_text;
 
 	template <typename _Input, typename _Encoding, typename _Output, typename _ErrorHandler, typename _State>
@@ -187,6 +187,47 @@ namespace ztd { namespace text {
 		_ToEncoding&& __to_encoding, _FromErrorHandler&& __from_error_handler, _ToErrorHandler&& __to_error_handler,
 		_FromState& __from_state, _ToState& __to_state, _Pivot&& __pivot);
 
+	template <typename _Input, typename _Encoding, typename _Output, typename _ErrorHandler, typename _State>
+	constexpr auto decode_into_raw(_Input&& __input, _Encoding&& __encoding, _Output&& __output,
+		_ErrorHandler&& __error_handler, _State& __state);
+
+	template <typename _Input, typename _Encoding, typename _Output, typename _ErrorHandler, typename _State>
+	constexpr auto encode_into_raw(_Input&& __input, _Encoding&& __encoding, _Output&& __output,
+		_ErrorHandler&& __error_handler, _State& __state);
+
+	template <typename _Input, typename _FromEncoding, typename _Output, typename _ToEncoding,
+		typename _FromErrorHandler, typename _ToErrorHandler, typename _FromState, typename _ToState, typename _Pivot>
+	constexpr auto transcode_into_raw(_Input&& __input, _FromEncoding&& __from_encoding, _Output&& __output,
+		_ToEncoding&& __to_encoding, _FromErrorHandler&& __from_error_handler, _ToErrorHandler&& __to_error_handler,
+		_FromState& __from_state, _ToState& __to_state, _Pivot&& __pivot);
+
+	template <typename _Input, typename _Encoding, typename _ErrorHandler, typename _State>
+	constexpr auto count_as_decoded(
+		_Input&& __input, _Encoding&& __encoding, _ErrorHandler&& __error_handler, _State& __state);
+
+	template <typename _Input, typename _Encoding, typename _ErrorHandler, typename _State>
+	constexpr auto count_as_encoded(
+		_Input&& __input, _Encoding&& __encoding, _ErrorHandler&& __error_handler, _State& __state);
+
+	template <typename _Input, typename _FromEncoding, typename _ToEncoding, typename _FromErrorHandler,
+		typename _ToErrorHandler, typename _FromState, typename _ToState, typename _Pivot>
+	constexpr auto count_as_transcoded(_Input&& __input, _FromEncoding&& __from_encoding, _ToEncoding&& __to_encoding,
+		_FromErrorHandler&& __from_error_handler, _ToErrorHandler&& __to_error_handler, _FromState& __from_state,
+		_ToState& __to_state, _Pivot&& __pivot);
+
+	template <typename _Input, typename _Encoding, typename _DecodeState, typename _EncodeState>
+	constexpr auto validate_decodable_as(
+		_Input&& __input, _Encoding&& __encoding, _DecodeState& __decode_state, _EncodeState& __encode_state);
+
+	template <typename _Input, typename _Encoding, typename _EncodeState, typename _DecodeState>
+	constexpr auto validate_encodable_as(
+		_Input&& __input, _Encoding&& __encoding, _EncodeState& __encode_state, _DecodeState& __decode_state);
+
+	template <typename _Input, typename _FromEncoding, typename _ToEncoding, typename _DecodeState,
+		typename _EncodeState, typename _Pivot>
+	constexpr auto validate_transcodable_as(_Input&& __input, _FromEncoding&& __from_encoding,
+		_ToEncoding&& __to_encoding, _DecodeState& __decode_state, _EncodeState& __encode_state, _Pivot&& __pivot);
+
 	namespace __txt_detail {
 #if ZTD_IS_ON(ZTD_TEXT_DEFAULT_HANDLER_THROWS)
 		using __default_handler_base_t = throw_handler_t;
@@ -45,11 +45,15 @@
 #include <ztd/text/utf8.hpp>
 #include <ztd/text/utf16.hpp>
 #include <ztd/text/assert.hpp>
+#include <ztd/text/detail/bulk_convert.hpp>
 #include <ztd/text/detail/progress_handler.hpp>
 #include <ztd/text/detail/encoding_name.hpp>
+#include <ztd/text/detail/unicode_kernels.hpp>
 
 #include <ztd/ranges/range.hpp>
+#include <ztd/ranges/reconstruct.hpp>
 #include <ztd/idk/span.hpp>
+#include <ztd/idk/tag.hpp>
 #include <ztd/idk/encoding_detection.hpp>
 #include <ztd/idk/type_traits.hpp>
 #include <ztd/idk/mbstate_t.hpp>
@@ -66,8 +70,15 @@ extern "C" {
 }
 #endif
 // clang-format on
+#include <clocale>
 #include <cwchar>
 #include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <string_view>
+#include <type_traits>
+#include <utility>
 
 #include <ztd/prologue.hpp>
 
@@ -75,6 +86,27 @@ namespace ztd { namespace text {
 	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
 
 	namespace __txt_detail {
+		//////
+		/// @brief Whether or not the locale is the "C" (or "POSIX") locale, or names ASCII as its code set: every
+		/// byte below 0x80 is then the code point of the same value.
+		inline bool __is_execution_encoding_ascii() noexcept {
+			const char* __name = ::std::setlocale(LC_CTYPE, nullptr);
+			if (__name == nullptr) {
+				return false;
+			}
+			const ::std::string_view __locale_name(__name);
+			if (__locale_name == "C" || __locale_name == "POSIX") {
+				return true;
+			}
+			const ::std::size_t __code_set_start = __locale_name.find('.');
+			if (__code_set_start == ::std::string_view::npos) {
+				return false;
+			}
+			const ::std::string_view __code_set
+				= __locale_name.substr(__code_set_start + 1, __locale_name.find('@') - (__code_set_start + 1));
+			return __code_set == "ASCII" || __code_set == "US-ASCII" || __code_set == "ANSI_X3.4-1968";
+		}
+
 		class __execution_decode_state {
 		public:
 			//////
@@ -83,13 +115,36 @@ namespace ztd { namespace text {
 			//////
 			/// @brief Whether or not there might be some accumulated data in the state.
 			bool __output_pending;
+			//////
+			/// @brief Whether or not the locale was using UTF-8 when this state was created (or last refreshed).
+			bool __is_utf8;
+			//////
+			/// @brief Whether or not the locale was the "C" locale (or otherwise ASCII) when this state was created
+			/// (or last refreshed).
+			bool __is_ascii;
 
 			//////
 			/// @brief Zero-initializes to its initial state, which includes the initial conversion sequence.
-			__execution_decode_state() noexcept : __narrow_state(), __output_pending(false) {
+			///
+			/// @remarks The locale's encoding is checked once, here, rather than on every call.
+			__execution_decode_state() noexcept
+			: __narrow_state()
+			, __output_pending(false)
+			, __is_utf8(::ztd::is_execution_encoding_utf8())
+			, __is_ascii(__is_execution_encoding_ascii()) {
 				ZTD_TEXT_ASSERT_I_(::std::mbsinit(&__narrow_state) != 0);
 			}
 
+			//////
+			/// @brief Checks the locale's encoding again. Call this after changing the locale (e.g., with
+			/// `std::setlocale`) if this state is to be used for more decoding.
+			///
+			/// @remarks This should only be done while the state is complete (see `is_complete`).
+			void refresh_locale() noexcept {
+				this->__is_utf8  = ::ztd::is_execution_encoding_utf8();
+				this->__is_ascii = __is_execution_encoding_ascii();
+			}
+
 			//////
 			/// @brief Finds out whether or not the state contains any unused data that needs to complete an
 			/// indivisible unit of work.
@@ -109,13 +164,35 @@ namespace ztd { namespace text {
 			//////
 			/// @brief Whether or not there might be some accumulated data in the state.
 			bool __output_pending;
+			//////
+			/// @brief Whether or not the locale was using UTF-8 when this state was created (or last refreshed).
+			bool __is_utf8;
+			//////
+			/// @brief Whether or not the locale was the "C" locale (or otherwise ASCII) when this state was created
+			/// (or last refreshed).
+			bool __is_ascii;
 
 			//////
 			/// @brief Zero-initializes to its initial state, which includes the initial conversion sequence.
-			__execution_encode_state() noexcept : __narrow_state(), __output_pending(false) {
+			///
+			/// @remarks The locale's encoding is checked once, here, rather than on every call.
+			__execution_encode_state() noexcept
+			: __narrow_state()
+			, __output_pending(false)
+			, __is_utf8(::ztd::is_execution_encoding_utf8())
+			, __is_ascii(__is_execution_encoding_ascii()) {
 				ZTD_TEXT_ASSERT_I_(::std::mbsinit(&this->__narrow_state) != 0);
 			}
 
+			//////
+			/// @brief Checks the locale's encoding again. Call this after changing the locale (e.g., with
+			/// `std::setlocale`) if this state is to be used for more encoding.
+			///
+			/// @remarks This should only be done while the state is complete (see `is_complete`).
+			void refresh_locale() noexcept {
+				this->__is_utf8  = ::ztd::is_execution_encoding_utf8();
+				this->__is_ascii = __is_execution_encoding_ascii();
+			}
 
 			//////
 			/// @brief Finds out whether or not the state contains any unused data that needs to complete an
@@ -245,7 +322,7 @@ namespace ztd { namespace text {
 				using _Result        = encode_result<_SubInput, _SubOutput, encode_state>;
 				constexpr bool __call_error_handler = !is_ignorable_error_handler_v<_UErrorHandler>;
 
-				if (ztd::is_execution_encoding_utf8()) {
+				if (__s.__is_utf8) {
 					// just go straight to UTF8
 					using __execution_utf8 = __txt_impl::__utf8_with<__execution_cuchar, code_unit, code_point,
 						decode_state, encode_state>;
@@ -423,7 +500,7 @@ namespace ztd { namespace text {
 				using _Result        = decode_result<_SubInput, _SubOutput, decode_state>;
 				constexpr bool __call_error_handler = !is_ignorable_error_handler_v<_UErrorHandler>;
 
-				if (ztd::is_execution_encoding_utf8()) {
+				if (__s.__is_utf8) {
 					// just go straight to UTF8
 					using __execution_utf8 = __txt_impl::__utf8_with<__execution_cuchar, code_unit, code_point,
 						decode_state, encode_state>;
@@ -627,6 +704,199 @@ namespace ztd { namespace text {
 						_SubOutput(::std::move(__out_it), ::std::move(__out_last)), __s, encoding_error::ok);
 				}
 			}
+
+		private:
+			// When the state says the locale is UTF-8, whole blocks go through the in-library UTF-8 kernels rather
+			// than through mbrtoc32/c32rtomb one code point at a time; when it says the locale is the "C" locale,
+			// runs of ASCII go through the in-library ASCII kernels and only the rest goes through the C library
+			//////
+			/// @brief Decodes one block of well-formed UTF-8 straight into the output, and moves both ranges past
+			/// what was read and written.
+			///
+			/// @returns Whether or not anything was decoded.
+			template <typename _WorkingInput, typename _WorkingOutput>
+			static bool _S_decode_block(_WorkingInput& __working_input, _WorkingOutput& __working_output) noexcept {
+				constexpr ::std::size_t __block_size_max = ZTD_TEXT_INTERMEDIATE_DECODE_BUFFER_SIZE_I_(char32_t);
+				::std::size_t __output_size = static_cast<::std::size_t>(::ztd::ranges::size(__working_output));
+				if (__output_size > __block_size_max) {
+					__output_size = __block_size_max;
+				}
+				if (__output_size == 0) {
+					return false;
+				}
+				char32_t __code_points[__block_size_max];
+				const __txt_detail::__unicode_kernel_result __result
+					= __txt_detail::__unicode_transcode_kernel<8, 32>(__txt_detail::__bulk_data(__working_input),
+					     static_cast<::std::size_t>(::ztd::ranges::size(__working_input)), __code_points,
+					     __output_size);
+				if (__result.__read == 0) {
+					return false;
+				}
+				::std::memcpy(__txt_detail::__bulk_data(__working_output), __code_points,
+					__result.__written * sizeof(char32_t));
+				__working_input  = __txt_detail::__bulk_advance(__working_input, __result.__read);
+				__working_output = __txt_detail::__bulk_advance(__working_output, __result.__written);
+				return true;
+			}
+
+			//////
+			/// @brief Encodes one block of valid code points straight into the output as UTF-8, and moves both
+			/// ranges past what was read and written.
+			///
+			/// @returns Whether or not anything was encoded.
+			template <typename _WorkingInput, typename _WorkingOutput>
+			static bool _S_encode_block(_WorkingInput& __working_input, _WorkingOutput& __working_output) noexcept {
+				constexpr ::std::size_t __block_size_max = ZTD_TEXT_INTERMEDIATE_ENCODE_BUFFER_SIZE_I_(char32_t);
+				::std::size_t __block_size = static_cast<::std::size_t>(::ztd::ranges::size(__working_input));
+				if (__block_size > __block_size_max) {
+					__block_size = __block_size_max;
+				}
+				const ::std::size_t __output_size
+					= static_cast<::std::size_t>(::ztd::ranges::size(__working_output));
+				if (__block_size == 0 || __output_size == 0) {
+					return false;
+				}
+				char32_t __code_points[__block_size_max];
+				::std::memcpy(
+					__code_points, __txt_detail::__bulk_data(__working_input), __block_size * sizeof(char32_t));
+				const __txt_detail::__unicode_kernel_result __result
+					= __txt_detail::__unicode_transcode_kernel<32, 8>(
+					     __code_points, __block_size, __txt_detail::__bulk_data(__working_output), __output_size);
+				if (__result.__read == 0) {
+					return false;
+				}
+				__working_input  = __txt_detail::__bulk_advance(__working_input, __result.__read);
+				__working_output = __txt_detail::__bulk_advance(__working_output, __result.__written);
+				return true;
+			}
+
+			//////
+			/// @brief Decodes the run of ASCII at the start of the input straight into the output, and moves both
+			/// ranges past what was read and written.
+			///
+			/// @returns Whether or not anything was decoded.
+			template <typename _WorkingInput, typename _WorkingOutput>
+			static bool _S_decode_ascii_block(
+				_WorkingInput& __working_input, _WorkingOutput& __working_output) noexcept {
+				::std::size_t __block_size = static_cast<::std::size_t>(::ztd::ranges::size(__working_input));
+				const ::std::size_t __output_size
+					= static_cast<::std::size_t>(::ztd::ranges::size(__working_output));
+				if (__block_size > __output_size) {
+					__block_size = __output_size;
+				}
+				if (__block_size == 0) {
+					return false;
+				}
+				const ::std::size_t __converted = __txt_detail::__unicode_kernels().__ascii_8_to_32(
+					__txt_detail::__bulk_data(__working_input), __block_size,
+					__txt_detail::__bulk_data(__working_output));
+				if (__converted == 0) {
+					return false;
+				}
+				__working_input  = __txt_detail::__bulk_advance(__working_input, __converted);
+				__working_output = __txt_detail::__bulk_advance(__working_output, __converted);
+				return true;
+			}
+
+			//////
+			/// @brief Encodes the run of ASCII code points at the start of the input straight into the output, and
+			/// moves both ranges past what was read and written.
+			///
+			/// @returns Whether or not anything was encoded.
+			template <typename _WorkingInput, typename _WorkingOutput>
+			static bool _S_encode_ascii_block(
+				_WorkingInput& __working_input, _WorkingOutput& __working_output) noexcept {
+				::std::size_t __block_size = static_cast<::std::size_t>(::ztd::ranges::size(__working_input));
+				const ::std::size_t __output_size
+					= static_cast<::std::size_t>(::ztd::ranges::size(__working_output));
+				if (__block_size > __output_size) {
+					__block_size = __output_size;
+				}
+				if (__block_size == 0) {
+					return false;
+				}
+				const ::std::size_t __converted = __txt_detail::__unicode_kernels().__ascii_32_to_8(
+					__txt_detail::__bulk_data(__working_input), __block_size,
+					__txt_detail::__bulk_data(__working_output));
+				if (__converted == 0) {
+					return false;
+				}
+				__working_input  = __txt_detail::__bulk_advance(__working_input, __converted);
+				__working_output = __txt_detail::__bulk_advance(__working_output, __converted);
+				return true;
+			}
+
+			template <bool _IsDecode, typename _Input, typename _Output, typename _ErrorHandler, typename _State>
+			static constexpr auto _S_convert_one(
+				_Input&& __input, _Output&& __output, _ErrorHandler& __error_handler, _State& __state) {
+				if constexpr (_IsDecode) {
+					return decode_one(::std::forward<_Input>(__input), ::std::forward<_Output>(__output),
+						__error_handler, __state);
+				}
+				else {
+					return encode_one(::std::forward<_Input>(__input), ::std::forward<_Output>(__output),
+						__error_handler, __state);
+				}
+			}
+
+			template <bool _IsDecode, typename _Input, typename _Output, typename _ErrorHandler, typename _State>
+			static constexpr auto _S_convert(
+				_Input&& __input, _Output&& __output, _ErrorHandler& __error_handler, _State& __state) {
+				using _Drain                            = __txt_detail::__bulk_drain;
+				constexpr ::std::size_t _InputUnitSize  = _IsDecode ? sizeof(code_unit) : sizeof(char32_t);
+				constexpr ::std::size_t _OutputUnitSize = _IsDecode ? sizeof(char32_t) : sizeof(code_unit);
+				return __txt_detail::__bulk_convert<_InputUnitSize, _OutputUnitSize, _Drain::__none>(
+					::std::forward<_Input>(__input), ::std::forward<_Output>(__output), __error_handler, __state,
+					[](auto& __working_input, auto& __working_output, _State& __bulk_state) {
+						// neither UTF-8 nor ASCII, or the kernels stopped on something (an error, a byte or code point
+						// outside of ASCII, or a full output): the rest goes through the C library
+#if ZTD_IS_ON(ZTD_STD_LIBRARY_IS_CONSTANT_EVALUATED)
+						if (::std::is_constant_evaluated()) {
+							return false;
+						}
+#endif
+						if (__bulk_state.__is_utf8) {
+							if constexpr (_IsDecode) {
+								return _S_decode_block(__working_input, __working_output);
+							}
+							else {
+								return _S_encode_block(__working_input, __working_output);
+							}
+						}
+						if (__bulk_state.__is_ascii && __bulk_state.is_complete()) {
+							if constexpr (_IsDecode) {
+								return _S_decode_ascii_block(__working_input, __working_output);
+							}
+							else {
+								return _S_encode_ascii_block(__working_input, __working_output);
+							}
+						}
+						return false;
+					},
+					[](auto&& __step_input, auto&& __step_output, auto& __step_error_handler, _State& __step_state) {
+						return _S_convert_one<_IsDecode>(::std::forward<decltype(__step_input)>(__step_input),
+							::std::forward<decltype(__step_output)>(__step_output), __step_error_handler,
+							__step_state);
+					});
+			}
+
+			template <typename _Encoding, typename _Input, typename _Output, typename _ErrorHandler,
+				::std::enable_if_t<::std::is_base_of_v<__execution_cuchar, _Encoding>>* = nullptr>
+			friend constexpr auto __text_decode(::ztd::tag<_Encoding>, _Input&& __input,
+				type_identity_t<const __execution_cuchar&>, _Output&& __output, _ErrorHandler&& __error_handler,
+				decode_state& __state) {
+				return _S_convert<true>(
+					::std::forward<_Input>(__input), ::std::forward<_Output>(__output), __error_handler, __state);
+			}
+
+			template <typename _Encoding, typename _Input, typename _Output, typename _ErrorHandler,
+				::std::enable_if_t<::std::is_base_of_v<__execution_cuchar, _Encoding>>* = nullptr>
+			friend constexpr auto __text_encode(::ztd::tag<_Encoding>, _Input&& __input,
+				type_identity_t<const __execution_cuchar&>, _Output&& __output, _ErrorHandler&& __error_handler,
+				encode_state& __state) {
+				return _S_convert<false>(
+					::std::forward<_Input>(__input), ::std::forward<_Output>(__output), __error_handler, __state);
+			}
 		};
 	} // namespace __txt_impl
 
@@ -42,13 +42,23 @@
 #include <ztd/text/decode_result.hpp>
 #include <ztd/text/encode_result.hpp>
 #include <ztd/text/is_ignorable_error_handler.hpp>
+#include <ztd/text/detail/bulk_convert.hpp>
+#include <ztd/text/detail/is_lossless.hpp>
 
 #include <ztd/cuneicode.h>
 #include <ztd/idk/ebco.hpp>
 #include <ztd/idk/to_address.hpp>
 #include <ztd/idk/size.hpp>
+#include <ztd/idk/tag.hpp>
+#include <ztd/idk/type_traits.hpp>
 #include <ztd/ranges/adl.hpp>
 #include <ztd/ranges/range.hpp>
+#include <ztd/ranges/reconstruct.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
 
 #include <ztd/prologue.hpp>
 
@@ -330,6 +340,146 @@ namespace ztd { namespace text {
 				return _Result(_SubInput(::std::move(__in_it), ::std::move(__in_last)),
 					_SubOutput(::std::move(__out_it), ::std::move(__out_last)), __state, encoding_error::ok);
 			}
+
+			//////
+			/// @brief Decodes as much of the input as possible into the output, handing whole spans of code units to
+			/// the cuneicode function at once.
+			///
+			/// @tparam _Input The input range type.
+			/// @tparam _Output The output range type.
+			/// @tparam _ErrorHandler The error handler type.
+			///
+			/// @param __input The input range.
+			/// @param __output The output range.
+			/// @param __error_handler The error handler; this will be called whenever an error occurs during
+			/// decoding.
+			/// @param __state A reference to the decode state.
+			///
+			/// @return A ztd::text::decode_result structure with the appropriate input and output types
+			/// reconstructed, possibly filtered through an error handler if necessary.
+			///
+			/// @remarks When both the input and output are contiguous and sized, they are passed straight through to
+			/// the cuneicode function. Only where it stops (an ill-formed or incomplete sequence, or not enough
+			/// output space) is ztd::text::__txt_impl::__fixed_cuneicode::decode_one used, so the error handler sees
+			/// exactly what it would when decoding one unit of information at a time. Other ranges are decoded one
+			/// unit of information at a time.
+			template <typename _Input, typename _Output, typename _ErrorHandler>
+			static auto decode(
+				_Input&& __input, _Output&& __output, _ErrorHandler&& __error_handler, decode_state& __state) {
+				static_assert(
+					__txt_detail::__is_decode_lossless_or_deliberate_v<_Derived, remove_cvref_t<_ErrorHandler>>,
+					ZTD_TEXT_LOSSY_DECODE_MESSAGE_I_);
+				return _S_convert<_FunctionCodeUnit, _FunctionCodePoint>(::std::forward<_Input>(__input),
+					::std::forward<_Output>(__output), __error_handler, __state, __decode_func,
+					[](auto&& __step_input, auto&& __step_output, auto& __step_error_handler,
+						decode_state& __step_state) {
+						return decode_one(::std::forward<decltype(__step_input)>(__step_input),
+							::std::forward<decltype(__step_output)>(__step_output), __step_error_handler,
+							__step_state);
+					});
+			}
+
+			//////
+			/// @brief Encodes as much of the input as possible into the output, handing whole spans of code points
+			/// to the cuneicode function at once.
+			///
+			/// @tparam _Input The input range type.
+			/// @tparam _Output The output range type.
+			/// @tparam _ErrorHandler The error handler type.
+			///
+			/// @param __input The input range.
+			/// @param __output The output range.
+			/// @param __error_handler The error handler; this will be called whenever an error occurs during
+			/// encoding.
+			/// @param __state A reference to the encode state.
+			///
+			/// @return A ztd::text::encode_result structure with the appropriate input and output types
+			/// reconstructed, possibly filtered through an error handler if necessary.
+			///
+			/// @remarks When both the input and output are contiguous and sized, they are passed straight through to
+			/// the cuneicode function. Only where it stops (an unrepresentable code point, or not enough output
+			/// space) is ztd::text::__txt_impl::__fixed_cuneicode::encode_one used, so the error handler sees
+			/// exactly what it would when encoding one unit of information at a time. Other ranges are encoded one
+			/// unit of information at a time.
+			template <typename _Input, typename _Output, typename _ErrorHandler>
+			static auto encode(
+				_Input&& __input, _Output&& __output, _ErrorHandler&& __error_handler, encode_state& __state) {
+				static_assert(
+					__txt_detail::__is_encode_lossless_or_deliberate_v<_Derived, remove_cvref_t<_ErrorHandler>>,
+					ZTD_TEXT_LOSSY_ENCODE_MESSAGE_I_);
+				return _S_convert<_FunctionCodePoint, _FunctionCodeUnit>(::std::forward<_Input>(__input),
+					::std::forward<_Output>(__output), __error_handler, __state, __encode_func,
+					[](auto&& __step_input, auto&& __step_output, auto& __step_error_handler,
+						encode_state& __step_state) {
+						return encode_one(::std::forward<decltype(__step_input)>(__step_input),
+							::std::forward<decltype(__step_output)>(__step_output), __step_error_handler,
+							__step_state);
+					});
+			}
+
+		private:
+			//////
+			/// @brief Runs `__func` over as much of the (contiguous) input and output as it can in one call, and
+			/// moves both ranges past what it read and wrote.
+			///
+			/// @returns Whether or not the function converted the entire input.
+			template <typename _InputUnit, typename _OutputUnit, typename _Func, typename _WorkingInput,
+				typename _WorkingOutput, typename _State>
+			static bool _S_convert_bulk(
+				_Func __func, _WorkingInput& __working_input, _WorkingOutput& __working_output, _State& __state) {
+				const ::std::size_t __initial_in_size
+					= static_cast<::std::size_t>(::ztd::ranges::size(__working_input));
+				const ::std::size_t __initial_out_size
+					= static_cast<::std::size_t>(::ztd::ranges::size(__working_output));
+				if (__initial_out_size == 0) {
+					return false;
+				}
+				::std::size_t __in_size  = __initial_in_size;
+				::std::size_t __out_size = __initial_out_size;
+				const _InputUnit* __typed_in_ptr = reinterpret_cast<const _InputUnit*>(
+					::std::addressof(*::ztd::ranges::begin(__working_input)));
+				_OutputUnit* __typed_out_ptr = reinterpret_cast<_OutputUnit*>(
+					::std::addressof(*::ztd::ranges::begin(__working_output)));
+				cnc_mcerr __err = __func(&__out_size, &__typed_out_ptr, &__in_size, &__typed_in_ptr, &__state);
+				__working_input  = __txt_detail::__bulk_advance(__working_input, __initial_in_size - __in_size);
+				__working_output = __txt_detail::__bulk_advance(__working_output, __initial_out_size - __out_size);
+				return __err == cnc_mcerr_ok && __in_size == 0;
+			}
+
+			template <typename _InputUnit, typename _OutputUnit, typename _Input, typename _Output,
+				typename _ErrorHandler, typename _State, typename _Func, typename _OneStep>
+			static auto _S_convert(_Input&& __input, _Output&& __output, _ErrorHandler& __error_handler,
+				_State& __state, _Func __func, _OneStep&& __one_step) {
+				// some encodings (e.g. punycode) hold on to everything until the input runs out: keep stepping with
+				// no input until the state has been drained
+				using _Drain = __txt_detail::__bulk_drain;
+				return __txt_detail::__bulk_convert<sizeof(_InputUnit), sizeof(_OutputUnit), _Drain::__until_complete>(
+					::std::forward<_Input>(__input), ::std::forward<_Output>(__output), __error_handler, __state,
+					[__func](auto& __working_input, auto& __working_output, _State& __bulk_state) {
+						return _S_convert_bulk<_InputUnit, _OutputUnit>(
+						            __func, __working_input, __working_output, __bulk_state)
+						     || ::ztd::ranges::empty(__working_input);
+					},
+					::std::forward<_OneStep>(__one_step));
+			}
+
+			template <typename _Encoding, typename _Input, typename _Output, typename _ErrorHandler,
+				::std::enable_if_t<::std::is_base_of_v<__fixed_cuneicode, _Encoding>>* = nullptr>
+			friend auto __text_decode(::ztd::tag<_Encoding>, _Input&& __input,
+				type_identity_t<const __fixed_cuneicode&>, _Output&& __output, _ErrorHandler&& __error_handler,
+				decode_state& __state) {
+				return __fixed_cuneicode::decode(::std::forward<_Input>(__input),
+					::std::forward<_Output>(__output), ::std::forward<_ErrorHandler>(__error_handler), __state);
+			}
+
+			template <typename _Encoding, typename _Input, typename _Output, typename _ErrorHandler,
+				::std::enable_if_t<::std::is_base_of_v<__fixed_cuneicode, _Encoding>>* = nullptr>
+			friend auto __text_encode(::ztd::tag<_Encoding>, _Input&& __input,
+				type_identity_t<const __fixed_cuneicode&>, _Output&& __output, _ErrorHandler&& __error_handler,
+				encode_state& __state) {
+				return __fixed_cuneicode::encode(::std::forward<_Input>(__input),
+					::std::forward<_Output>(__output), ::std::forward<_ErrorHandler>(__error_handler), __state);
+			}
 		};
 	} // namespace __txt_impl
 
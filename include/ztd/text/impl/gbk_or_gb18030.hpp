@@ -41,12 +41,16 @@
 #include <ztd/text/is_ignorable_error_handler.hpp>
 #include <ztd/text/detail/empty_state.hpp>
 #include <ztd/text/detail/replacement_units.hpp>
+#include <ztd/text/detail/gb18030_range_tables.hpp>
 
 #include <ztd/encoding_tables/gb18030.tables.hpp>
 #include <ztd/idk/size.hpp>
+#include <ztd/idk/tag.hpp>
 #include <ztd/ranges/adl.hpp>
+#include <ztd/ranges/range.hpp>
 
 #include <climits>
+#include <type_traits>
 
 #include <ztd/prologue.hpp>
 
@@ -222,12 +226,16 @@ namespace ztd { namespace text {
 					const unsigned char __second_byte = static_cast<unsigned char>(__units[1]);
 
 					auto __lookup_and_write_out = [&](::std::size_t __lookup_index, auto __use_ranges_type_value) {
-						constexpr bool __use_ranges    = decltype(__use_ranges_type_value)::value;
-						constexpr auto __to_code_point = __use_ranges
-							? &::ztd::et::gb18030_ranges_index_to_code_point
-							: &::ztd::et::gb18030_index_to_code_point;
-						const ::std::optional<::std::uint_least32_t> __maybe_code
-							= __to_code_point(__lookup_index);
+						constexpr bool __use_ranges = decltype(__use_ranges_type_value)::value;
+						::std::optional<::std::uint_least32_t> __maybe_code;
+						if constexpr (__use_ranges) {
+							__txt_detail::__gb18030_range_cursor __cursor {};
+							__maybe_code
+								= __txt_detail::__gb18030_four_byte_code_point(__lookup_index, __cursor);
+						}
+						else {
+							__maybe_code = ::ztd::et::gb18030_index_to_code_point(__lookup_index);
+						}
 						if (__maybe_code) {
 							if constexpr (__call_error_handler) {
 								if (__out_it == __out_last) {
@@ -443,7 +451,7 @@ namespace ztd { namespace text {
 				}
 
 				::std::optional<::std::size_t> __maybe_lookup_gbk_index
-					= ::ztd::et::gb18030_code_point_to_index(__code_point32);
+					= __txt_detail::__gb18030_two_byte_index(__code_point32);
 				if (__maybe_lookup_gbk_index) {
 					if constexpr (__call_error_handler) {
 						if (__out_it == __out_last) {
@@ -486,8 +494,9 @@ namespace ztd { namespace text {
 				}
 
 				if constexpr (!_IsGbk) {
+					__txt_detail::__gb18030_range_cursor __cursor {};
 					::std::optional<::std::size_t> __maybe_lookup_index
-						= ztd::et::gb18030_ranges_code_point_to_index(__code_point32);
+						= __txt_detail::__gb18030_four_byte_index(__code_point32, __cursor);
 					if (__maybe_lookup_index) {
 						const ::std::size_t __lookup_index = *__maybe_lookup_index;
 						code_unit __units[4]               = {};
@@ -535,6 +544,97 @@ namespace ztd { namespace text {
 					::ztd::span<const code_point, 0>(), ::ztd::span<const code_unit, 0>());
 			}
 
+			//////
+			/// @brief Decodes contiguous input in bulk: runs of complete, valid sequences are converted in one loop
+			/// that keeps the last-used four-byte range at hand, and the first sequence that needs the error
+			/// handler (or no longer fits in the output) goes through decode_one before the loop resumes.
+			template <typename _Input, typename _Output, typename _ErrorHandler,
+				typename _UInput = remove_cvref_t<_Input>,
+				::std::enable_if_t<::ztd::ranges::is_range_contiguous_range_v<_UInput> // cf
+				     && ::ztd::ranges::is_sized_range_v<_UInput>>* = nullptr>
+			friend constexpr auto __text_decode(::ztd::tag<_Derived>, _Input&& __input, const _Derived& __encoding,
+				_Output&& __output, _ErrorHandler&& __error_handler, state& __state) {
+				using _SubInput  = ztd::ranges::csubrange_for_t<::std::remove_reference_t<_Input>>;
+				using _SubOutput = ztd::ranges::subrange_for_t<::std::remove_reference_t<_Output>>;
+				using _Result    = decode_result<_SubInput, _SubOutput, state>;
+
+				auto __in_it                                  = ::ztd::ranges::cbegin(__input);
+				auto __in_last                                = ::ztd::ranges::cend(__input);
+				auto __out_it                                 = ::ztd::ranges::begin(__output);
+				auto __out_last                               = ::ztd::ranges::end(__output);
+				__txt_detail::__gb18030_range_cursor __cursor = {};
+				::std::size_t __error_count                   = 0;
+				for (;;) {
+					__txt_detail::__gb18030_decode_bulk<_IsGbk, code_unit, code_point>(
+						__in_it, __in_last, __out_it, __out_last, __cursor);
+					if (__in_it == __in_last) {
+						return _Result(_SubInput(::std::move(__in_it), ::std::move(__in_last)),
+							_SubOutput(::std::move(__out_it), ::std::move(__out_last)), __state,
+							ztd::text::encoding_error::ok, __error_count);
+					}
+					auto __one_result
+						= __encoding.decode_one(_SubInput(::std::move(__in_it), ::std::move(__in_last)),
+						     _SubOutput(::std::move(__out_it), ::std::move(__out_last)), __error_handler,
+						     __state);
+					__error_count += __one_result.error_count;
+					__in_it    = ::ztd::ranges::cbegin(__one_result.input);
+					__in_last  = ::ztd::ranges::cend(__one_result.input);
+					__out_it   = ::ztd::ranges::begin(__one_result.output);
+					__out_last = ::ztd::ranges::end(__one_result.output);
+					if (__one_result.error_code != ztd::text::encoding_error::ok) {
+						return _Result(_SubInput(::std::move(__in_it), ::std::move(__in_last)),
+							_SubOutput(::std::move(__out_it), ::std::move(__out_last)), __state,
+							__one_result.error_code, __error_count);
+					}
+				}
+			}
+
+			//////
+			/// @brief Encodes contiguous input into contiguous output in bulk, the same way as the bulk decode: the
+			/// first code point that needs the error handler (or does not fit) goes through encode_one.
+			template <typename _Input, typename _Output, typename _ErrorHandler,
+				typename _UInput = remove_cvref_t<_Input>, typename _UOutput = remove_cvref_t<_Output>,
+				::std::enable_if_t<::ztd::ranges::is_range_contiguous_range_v<_UInput> // cf
+				     && ::ztd::ranges::is_sized_range_v<_UInput>                      // cf
+				     && ::ztd::ranges::is_range_contiguous_range_v<_UOutput>          // cf
+				     && ::ztd::ranges::is_sized_range_v<_UOutput>>* = nullptr>
+			friend constexpr auto __text_encode(::ztd::tag<_Derived>, _Input&& __input, const _Derived& __encoding,
+				_Output&& __output, _ErrorHandler&& __error_handler, state& __state) {
+				using _SubInput  = ztd::ranges::csubrange_for_t<::std::remove_reference_t<_Input>>;
+				using _SubOutput = ztd::ranges::subrange_for_t<::std::remove_reference_t<_Output>>;
+				using _Result    = encode_result<_SubInput, _SubOutput, state>;
+
+				auto __in_it                                  = ::ztd::ranges::cbegin(__input);
+				auto __in_last                                = ::ztd::ranges::cend(__input);
+				auto __out_it                                 = ::ztd::ranges::begin(__output);
+				auto __out_last                               = ::ztd::ranges::end(__output);
+				__txt_detail::__gb18030_range_cursor __cursor = {};
+				::std::size_t __error_count                   = 0;
+				for (;;) {
+					__txt_detail::__gb18030_encode_bulk<_IsGbk, code_unit>(
+						__in_it, __in_last, __out_it, __out_last, __cursor);
+					if (__in_it == __in_last) {
+						return _Result(_SubInput(::std::move(__in_it), ::std::move(__in_last)),
+							_SubOutput(::std::move(__out_it), ::std::move(__out_last)), __state,
+							ztd::text::encoding_error::ok, __error_count);
+					}
+					auto __one_result
+						= __encoding.encode_one(_SubInput(::std::move(__in_it), ::std::move(__in_last)),
+						     _SubOutput(::std::move(__out_it), ::std::move(__out_last)), __error_handler,
+						     __state);
+					__error_count += __one_result.error_count;
+					__in_it    = ::ztd::ranges::cbegin(__one_result.input);
+					__in_last  = ::ztd::ranges::cend(__one_result.input);
+					__out_it   = ::ztd::ranges::begin(__one_result.output);
+					__out_last = ::ztd::ranges::end(__one_result.output);
+					if (__one_result.error_code != ztd::text::encoding_error::ok) {
+						return _Result(_SubInput(::std::move(__in_it), ::std::move(__in_last)),
+							_SubOutput(::std::move(__out_it), ::std::move(__out_last)), __state,
+							__one_result.error_code, __error_count);
+					}
+				}
+			}
+
 		private:
 			static_assert((sizeof(code_point) * CHAR_BIT) > (_IsGbk ? 15 : 21),
 				"The code point type for a GBK encoding must be at least 16 bits wide. The code point type for a "
@@ -41,12 +41,16 @@
 #include <ztd/text/is_ignorable_error_handler.hpp>
 #include <ztd/text/detail/empty_state.hpp>
 #include <ztd/text/detail/replacement_units.hpp>
+#include <ztd/text/detail/single_byte_lookup_tables.hpp>
 
+#include <ztd/idk/tag.hpp>
 #include <ztd/ranges/adl.hpp>
+#include <ztd/ranges/range.hpp>
 #include <ztd/encoding_tables/table_types.hpp>
 
 #include <optional>
 #include <cstddef>
+#include <type_traits>
 
 #include <ztd/prologue.hpp>
 
@@ -122,9 +126,10 @@ namespace ztd { namespace text {
 						ztd::text::encoding_error::ok);
 				}
 				else {
-					::std::size_t __lookup_index = static_cast<::std::size_t>(__unit0) - 0x80u;
-					const ::std::optional<::std::uint_least32_t> __maybe_code = _LookupCodePoint(__lookup_index);
-					if (__maybe_code) {
+					const ::std::uint_least32_t __code
+						= __txt_detail::__single_byte_decode_table_v<true, _LookupCodePoint>
+						       .__code_points[__unit0];
+					if (__code != __txt_detail::__single_byte_no_code_point) {
 						if constexpr (__call_error_handler) {
 							if (__out_it == __out_last) {
 								_Derived __self {};
@@ -136,7 +141,7 @@ namespace ztd { namespace text {
 									::ztd::span<const code_point, 0>());
 							}
 						}
-						const code_point __code_point = static_cast<code_point>(*__maybe_code);
+						const code_point __code_point = static_cast<code_point>(__code);
 						*__out_it                     = __code_point;
 						++__in_it;
 						++__out_it;
@@ -196,8 +201,10 @@ namespace ztd { namespace text {
 						ztd::text::encoding_error::ok);
 				}
 				else {
-					const ::std::optional<::std::size_t> __maybe_index = _LookupIndex(__code_point32);
-					if (__maybe_index) {
+					const ::std::uint_least16_t __entry
+						= __txt_detail::__single_byte_encode_lookup<true, _LookupCodePoint, _LookupIndex>(
+						     __code_point32);
+					if (__entry != 0) {
 						if constexpr (__call_error_handler) {
 							if (__out_it == __out_last) {
 								// output is empty :(
@@ -208,7 +215,7 @@ namespace ztd { namespace text {
 									::ztd::span<const code_point, 0>(), ::ztd::span<const code_unit, 0>());
 							}
 						}
-						const code_unit __code_unit = static_cast<code_unit>(*__maybe_index + 0x80);
+						const code_unit __code_unit = static_cast<code_unit>(static_cast<unsigned char>(__entry));
 						*__out_it                   = __code_unit;
 						++__in_it;
 						++__out_it;
@@ -225,6 +232,101 @@ namespace ztd { namespace text {
 					     ztd::text::encoding_error::invalid_sequence),
 					::ztd::span<const code_point, 0>(), ::ztd::span<const code_unit, 0>());
 			}
+
+			//////
+			/// @brief Decodes in bulk by walking the byte → code point table, handing the first byte that needs
+			/// an error handler (or no longer fits in the output) to a single decode step before resuming.
+			template <typename _Input, typename _Output, typename _ErrorHandler, typename _Self = _Derived,
+				::std::enable_if_t<::std::is_base_of_v<__single_ascii_byte_high_bit_lookup_encoding, _Self>>*
+				= nullptr>
+			friend constexpr auto __text_decode(::ztd::tag<_Derived>, _Input&& __input, const _Derived& __encoding,
+				_Output&& __output, _ErrorHandler&& __error_handler, state& __state) {
+				using _UInput    = remove_cvref_t<_Input>;
+				using _UOutput   = remove_cvref_t<_Output>;
+				using _SubInput  = ztd::ranges::csubrange_for_t<::std::remove_reference_t<_Input>>;
+				using _SubOutput = ztd::ranges::subrange_for_t<::std::remove_reference_t<_Output>>;
+				using _Result    = decode_result<_SubInput, _SubOutput, state>;
+				constexpr bool __use_kernel = ::ztd::ranges::is_range_contiguous_range_v<_UInput> // cf
+					&& ::ztd::ranges::is_sized_range_v<_UInput>                                  // cf
+					&& ::ztd::ranges::is_range_contiguous_range_v<_UOutput>                      // cf
+					&& ::ztd::ranges::is_sized_range_v<_UOutput>                                 // cf
+					&& sizeof(::ztd::ranges::range_value_type_t<_UInput>) == 1                   // cf
+					&& sizeof(code_point) == sizeof(::std::uint_least32_t)                       // cf
+					&& ::std::is_trivially_copyable_v<code_point>;
+
+				auto __in_it    = ::ztd::ranges::cbegin(__input);
+				auto __in_last  = ::ztd::ranges::cend(__input);
+				auto __out_it   = ::ztd::ranges::begin(__output);
+				auto __out_last = ::ztd::ranges::end(__output);
+				::std::size_t __error_count = 0;
+				for (;;) {
+					__txt_detail::__single_byte_decode_bulk<__use_kernel, true, _LookupCodePoint, code_unit,
+						code_point>(__in_it, __in_last, __out_it, __out_last);
+					if (__in_it == __in_last) {
+						break;
+					}
+					// the table stopped on something it does not handle: take a single step so the error handler
+					// sees exactly that unit, then go back to the table
+					auto __step_result = __encoding.decode_one(_SubInput(::std::move(__in_it), ::std::move(__in_last)),
+						_SubOutput(::std::move(__out_it), ::std::move(__out_last)), __error_handler, __state);
+					__error_count += __step_result.error_count;
+					__in_it    = ::ztd::ranges::begin(__step_result.input);
+					__in_last  = ::ztd::ranges::end(__step_result.input);
+					__out_it   = ::ztd::ranges::begin(__step_result.output);
+					__out_last = ::ztd::ranges::end(__step_result.output);
+					if (__step_result.error_code != ztd::text::encoding_error::ok) {
+						return _Result(_SubInput(::std::move(__in_it), ::std::move(__in_last)),
+							_SubOutput(::std::move(__out_it), ::std::move(__out_last)), __state,
+							__step_result.error_code, __error_count);
+					}
+				}
+				return _Result(_SubInput(::std::move(__in_it), ::std::move(__in_last)),
+					_SubOutput(::std::move(__out_it), ::std::move(__out_last)), __state,
+					ztd::text::encoding_error::ok, __error_count);
+			}
+
+			//////
+			/// @brief Encodes in bulk through the two-level code point → byte table, handing the first code point
+			/// that needs an error handler (or no longer fits in the output) to a single encode step before resuming.
+			template <typename _Input, typename _Output, typename _ErrorHandler, typename _Self = _Derived,
+				::std::enable_if_t<::std::is_base_of_v<__single_ascii_byte_high_bit_lookup_encoding, _Self>>*
+				= nullptr>
+			friend constexpr auto __text_encode(::ztd::tag<_Derived>, _Input&& __input, const _Derived& __encoding,
+				_Output&& __output, _ErrorHandler&& __error_handler, state& __state) {
+				using _SubInput  = ztd::ranges::csubrange_for_t<::std::remove_reference_t<_Input>>;
+				using _SubOutput = ztd::ranges::subrange_for_t<::std::remove_reference_t<_Output>>;
+				using _Result    = encode_result<_SubInput, _SubOutput, state>;
+
+				auto __in_it    = ::ztd::ranges::cbegin(__input);
+				auto __in_last  = ::ztd::ranges::cend(__input);
+				auto __out_it   = ::ztd::ranges::begin(__output);
+				auto __out_last = ::ztd::ranges::end(__output);
+				::std::size_t __error_count = 0;
+				for (;;) {
+					__txt_detail::__single_byte_encode_bulk<true, _LookupCodePoint, _LookupIndex, code_unit>(
+						__in_it, __in_last, __out_it, __out_last);
+					if (__in_it == __in_last) {
+						break;
+					}
+					// the table stopped on something it does not handle: take a single step so the error handler
+					// sees exactly that code point, then go back to the table
+					auto __step_result = __encoding.encode_one(_SubInput(::std::move(__in_it), ::std::move(__in_last)),
+						_SubOutput(::std::move(__out_it), ::std::move(__out_last)), __error_handler, __state);
+					__error_count += __step_result.error_count;
+					__in_it    = ::ztd::ranges::begin(__step_result.input);
+					__in_last  = ::ztd::ranges::end(__step_result.input);
+					__out_it   = ::ztd::ranges::begin(__step_result.output);
+					__out_last = ::ztd::ranges::end(__step_result.output);
+					if (__step_result.error_code != ztd::text::encoding_error::ok) {
+						return _Result(_SubInput(::std::move(__in_it), ::std::move(__in_last)),
+							_SubOutput(::std::move(__out_it), ::std::move(__out_last)), __state,
+							__step_result.error_code, __error_count);
+					}
+				}
+				return _Result(_SubInput(::std::move(__in_it), ::std::move(__in_last)),
+					_SubOutput(::std::move(__out_it), ::std::move(__out_last)), __state,
+					ztd::text::encoding_error::ok, __error_count);
+			}
 		};
 	} // namespace __txt_impl
 
@@ -48,7 +48,7 @@ namespace ztd { namespace text {
 
 	namespace __txt_detail {
 		template <typename _Type>
-		using __detect_is_self_synchronizing_code = decltype(_Type::is_self_synchronizing_code::value);
+		using __detect_is_self_synchronizing_code = decltype(_Type::self_synchronizing_code::value);
 
 		template <typename _Encoding, typename = void>
 		struct __is_self_synchronizing_code_sfinae
@@ -36,6 +36,17 @@
 #include <ztd/text/version.hpp>
 
 #include <ztd/text/no_normalization.hpp>
+#include <ztd/text/normalization_result.hpp>
+#include <ztd/text/detail/normalization_routines.hpp>
+
+#include <ztd/idk/type_traits.hpp>
+#include <ztd/ranges/adl.hpp>
+#include <ztd/ranges/range.hpp>
+#include <ztd/ranges/subrange.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
 
 #include <ztd/prologue.hpp>
 
@@ -43,6 +54,191 @@ namespace ztd { namespace text {
 	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
 
 	namespace __txt_impl {
+		//////
+		/// @internal
+		///
+		/// @brief The normalization algorithm shared by all of the Unicode Normalization Forms: full
+		/// decomposition, canonical reordering, and (optionally) canonical composition, applied one segment at a
+		/// time between normalization boundaries.
+		///
+		/// @tparam _IsCompatibility Whether compatibility decompositions are applied, or only canonical ones.
+		/// @tparam _IsComposing Whether the decomposed text is recomposed afterwards.
+		/// @tparam _IsContiguous Whether composition is limited to marks directly following their starter.
+		///
+		/// @remarks Runs of starters that are Quick_Check=Yes for the form are copied straight through; only the
+		/// segments around everything else are decomposed, reordered, and recomposed. Segments are held in a
+		/// fixed-size buffer: over-long runs of non-starters are broken up with U+034F COMBINING GRAPHEME JOINER
+		/// per the Stream-Safe Text Format of Unicode Standard Annex #15.
+		template <bool _IsCompatibility, bool _IsComposing, bool _IsContiguous>
+		class __unicode_normalization {
+		public:
+			//////
+			/// @brief Normalizes as much of the input as fits into the output.
+			///
+			/// @param[in] __input The input range of code points to read from.
+			/// @param[in] __output The output range to write the normalized code points to.
+			///
+			/// @returns A ztd::text::normalization_result with the input moved past everything that was normalized.
+			/// If the output ran out first, the error code is ztd::text::normalization_error::insufficient_output
+			/// and the input stops at a segment boundary.
+			template <typename _Input, typename _Output>
+			constexpr auto operator()(_Input&& __input, _Output&& __output) const noexcept {
+				using _UInput    = remove_cvref_t<_Input>;
+				using _UOutput   = remove_cvref_t<_Output>;
+				using _SubInput  = ztd::ranges::csubrange_for_t<::std::remove_reference_t<_Input>>;
+				using _SubOutput = ztd::ranges::subrange_for_t<::std::remove_reference_t<_Output>>;
+				using _Result    = normalization_result<_SubInput, _SubOutput>;
+				using _CodePoint = ::ztd::ranges::range_value_type_t<_UInput>;
+				constexpr bool __is_bulk_copyable = ::ztd::ranges::is_range_contiguous_range_v<_UInput> // cf
+					&& ::ztd::ranges::is_sized_range_v<_UInput>                                       // cf
+					&& ::ztd::ranges::is_range_contiguous_range_v<_UOutput>                          // cf
+					&& ::ztd::ranges::is_sized_range_v<_UOutput>;
+
+				auto __in_it    = ::ztd::ranges::cbegin(__input);
+				auto __in_last  = ::ztd::ranges::cend(__input);
+				auto __out_it   = ::ztd::ranges::begin(__output);
+				auto __out_last = ::ztd::ranges::end(__output);
+				__txt_detail::__normalization_segment __segment {};
+				::std::uint_least32_t __decomposed[__txt_detail::__normalization_max_decomposition] {};
+				unsigned char __decomposed_classes[__txt_detail::__normalization_max_decomposition] {};
+				for (;;) {
+					// Quick_Check=Yes: copy untouched starters straight through
+					if constexpr (__is_bulk_copyable) {
+						auto __run_last = __in_it;
+						for (; __run_last != __in_last; ++__run_last) {
+							const ::std::uint_least32_t __code_point
+								= static_cast<::std::uint_least32_t>(*__run_last);
+							if (!__txt_detail::__normalization_is_inert<_IsCompatibility, _IsComposing>(
+								     __code_point)) {
+								break;
+							}
+						}
+						if constexpr (_IsComposing) {
+							// the last starter of the run may still compose with what comes after it
+							if (__run_last != __in_last && __run_last != __in_it
+								&& !__txt_detail::__normalization_has_boundary_before<_IsCompatibility,
+								     _IsComposing>(static_cast<::std::uint_least32_t>(*__run_last))) {
+								--__run_last;
+							}
+						}
+						const auto __run_size        = __run_last - __in_it;
+						const auto __output_size     = __out_last - __out_it;
+						const bool __output_is_short = __output_size < __run_size;
+						const auto __copy_size       = __output_is_short ? __output_size : __run_size;
+						__out_it = ::std::copy(__in_it, __in_it + __copy_size, __out_it);
+						__in_it += __copy_size;
+						if (__output_is_short) {
+							return _Result(_SubInput(::std::move(__in_it), ::std::move(__in_last)),
+								_SubOutput(::std::move(__out_it), ::std::move(__out_last)),
+								normalization_error::insufficient_output);
+						}
+					}
+					else {
+						while (__in_it != __in_last) {
+							const ::std::uint_least32_t __code_point
+								= static_cast<::std::uint_least32_t>(*__in_it);
+							if (!__txt_detail::__normalization_is_inert<_IsCompatibility, _IsComposing>(
+								     __code_point)) {
+								break;
+							}
+							if constexpr (_IsComposing) {
+								// the starter may still compose with what comes after it
+								auto __next_it = __in_it;
+								++__next_it;
+								if (__next_it != __in_last
+									&& !__txt_detail::__normalization_has_boundary_before<_IsCompatibility,
+									     _IsComposing>(static_cast<::std::uint_least32_t>(*__next_it))) {
+									break;
+								}
+							}
+							if (__out_it == __out_last) {
+								return _Result(_SubInput(::std::move(__in_it), ::std::move(__in_last)),
+									_SubOutput(::std::move(__out_it), ::std::move(__out_last)),
+									normalization_error::insufficient_output);
+							}
+							*__out_it = static_cast<_CodePoint>(__code_point);
+							++__in_it;
+							++__out_it;
+						}
+					}
+					if (__in_it == __in_last) {
+						break;
+					}
+
+					// everything else: gather the segment up to the next boundary, fully decomposed
+					auto __segment_last               = __in_it;
+					bool __needs_joiner               = false;
+					__segment.__size                  = 0;
+					__segment.__trailing_non_starters = 0;
+					do {
+						const ::std::size_t __decomposed_size
+							= __txt_detail::__normalization_decompose<_IsCompatibility>(
+							     static_cast<::std::uint_least32_t>(*__segment_last), __decomposed);
+						::std::size_t __leading_non_starters = 0;
+						::std::size_t __last_starter_end     = 0;
+						for (::std::size_t __index = 0; __index < __decomposed_size; ++__index) {
+							__decomposed_classes[__index] = __txt_detail::__normalization_combining_class(
+								__txt_detail::__normalization_record(__decomposed[__index]));
+							if (__decomposed_classes[__index] == 0) {
+								__last_starter_end = __index + 1;
+							}
+							else if (__last_starter_end == 0) {
+								++__leading_non_starters;
+							}
+						}
+						if (__segment.__size != 0) {
+							if (__segment.__trailing_non_starters + __leading_non_starters
+								> __txt_detail::__stream_safe_max_non_starters) {
+								__needs_joiner = true;
+								break;
+							}
+							if ((__segment.__size + __decomposed_size)
+								> __txt_detail::__normalization_segment_size) {
+								break;
+							}
+						}
+						for (::std::size_t __index = 0; __index < __decomposed_size; ++__index) {
+							__segment.__code_points[__segment.__size + __index] = __decomposed[__index];
+							__segment.__classes[__segment.__size + __index]     = __decomposed_classes[__index];
+						}
+						__segment.__size += __decomposed_size;
+						if (__last_starter_end == 0) {
+							__segment.__trailing_non_starters += __decomposed_size;
+						}
+						else {
+							__segment.__trailing_non_starters = __decomposed_size - __last_starter_end;
+						}
+						++__segment_last;
+					} while (__segment_last != __in_last
+						&& !__txt_detail::__normalization_has_boundary_before<_IsCompatibility, _IsComposing>(
+						     static_cast<::std::uint_least32_t>(*__segment_last)));
+
+					__txt_detail::__normalization_reorder(__segment);
+					if constexpr (_IsComposing) {
+						__txt_detail::__normalization_recompose<_IsContiguous>(__segment);
+					}
+					const ::std::size_t __segment_output_size = __segment.__size + (__needs_joiner ? 1 : 0);
+					if (!__txt_detail::__normalization_output_has_room(
+						     __out_it, __out_last, __segment_output_size)) {
+						return _Result(_SubInput(::std::move(__in_it), ::std::move(__in_last)),
+							_SubOutput(::std::move(__out_it), ::std::move(__out_last)),
+							normalization_error::insufficient_output);
+					}
+					for (::std::size_t __index = 0; __index < __segment.__size; ++__index) {
+						*__out_it = static_cast<_CodePoint>(__segment.__code_points[__index]);
+						++__out_it;
+					}
+					if (__needs_joiner) {
+						*__out_it = static_cast<_CodePoint>(__txt_detail::__combining_grapheme_joiner);
+						++__out_it;
+					}
+					__in_it = ::std::move(__segment_last);
+				}
+				return _Result(_SubInput(::std::move(__in_it), ::std::move(__in_last)),
+					_SubOutput(::std::move(__out_it), ::std::move(__out_last)), normalization_error::ok);
+			}
+		};
+
 		//////
 		/// @internal
 		///
@@ -52,9 +248,9 @@ namespace ztd { namespace text {
 		/// @tparam _IsCompatibility Whether or not this Normalization Form is NFKC (Compatibility Composed), or NFC
 		/// (Canonical Composed).
 		///
-		/// @remarks From from Unicode Technical Report #15. FIXME: currently does nothing.
+		/// @remarks From from Unicode Technical Report #15.
 		template <bool _IsCompatibility>
-		struct __nfc : public no_normalization { };
+		struct __nfc : public __unicode_normalization<_IsCompatibility, true, false> { };
 
 		//////
 		/// @internal
@@ -65,37 +261,38 @@ namespace ztd { namespace text {
 		/// @tparam _IsCompatibility Whether or not this Normalization Form is NFKD (Compatibility Decomposed), or NFD
 		/// (Canonical Decomposed).
 		///
-		/// @remarks From from Unicode Technical Report #15. FIXME: currently does nothing.
+		/// @remarks From from Unicode Technical Report #15.
 		template <bool _IsCompatibility>
-		struct __nfd : public no_normalization { };
+		struct __nfd : public __unicode_normalization<_IsCompatibility, false, false> { };
 	} // namespace __txt_impl
 
 
 	//////
 	/// @brief The Normalization Form C (Canonical, Composed, from Unicode Technical Report #15).
 	///
-	/// @remarks From from Unicode Technical Report #15. FIXME: currently does nothing.
+	/// @remarks From from Unicode Technical Report #15.
 	class nfc : public __txt_impl::__nfc<false> { };
 	//////
 	/// @brief The Normalization Form D (Canonical, Decomposed, from Unicode Technical Report #15).
 	///
-	/// @remarks From from Unicode Technical Report #15. FIXME: currently does nothing.
+	/// @remarks From from Unicode Technical Report #15.
 	class nfd : public __txt_impl::__nfd<false> { };
 	//////
 	/// @brief The Normalization Form KC (Compatibility, Composed, from Unicode Technical Report #15).
 	///
-	/// @remarks From from Unicode Technical Report #15. FIXME: currently does nothing.
+	/// @remarks From from Unicode Technical Report #15.
 	class nfkc : public __txt_impl::__nfc<true> { };
 	//////
 	/// @brief The Normalization Form KD (Compatibility, Decomposed, from Unicode Technical Report #15).
 	///
-	/// @remarks From from Unicode Technical Report #15. FIXME: currently does nothing.
+	/// @remarks From from Unicode Technical Report #15.
 	class nfkd : public __txt_impl::__nfd<true> { };
 	//////
 	/// @brief The Normalization Form C, Stream-Safe (Fast Composed, Contiguous, from Unicode Technical Report #15).
 	///
-	/// @remarks From from Unicode Technical Report #15. FIXME: currently does nothing.
-	class fcc : public no_normalization { };
+	/// @remarks From from Unicode Technical Note #5. Like Normalization Form C, except that a mark only composes
+	/// with the starter it directly follows.
+	class fcc : public __txt_impl::__unicode_normalization<false, true, true> { };
 
 	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
 }} // namespace ztd::text
@@ -39,6 +39,7 @@
 #include <ztd/text/assert.hpp>
 
 #include <ztd/idk/ebco.hpp>
+#include <ztd/idk/span.hpp>
 #include <ztd/idk/unwrap.hpp>
 #include <ztd/idk/type_traits.hpp>
 #include <ztd/ranges/default_sentinel.hpp>
@@ -46,6 +47,7 @@
 #include <ztd/ranges/unbounded.hpp>
 #include <ztd/inline_containers.hpp>
 
+#include <cstddef>
 #include <vector>
 
 #include <ztd/prologue.hpp>
@@ -68,6 +70,14 @@ namespace ztd { namespace text {
 
 		template <typename _Range, typename _NormalizationForm>
 		using __default_normal_storage_t = typename __default_normal_storage<_Range, _NormalizationForm>::type;
+
+		template <typename _NormalizationForm>
+		using __detect_max_output = decltype(_NormalizationForm::max_output);
+
+		//////
+		/// @brief How many code points a ztd::text::normalized_iterator asks a normalization form without a
+		/// `max_output` for at once. Must hold at least one whole normalization segment.
+		inline constexpr ::std::size_t __normalized_iterator_chunk_size = 256;
 	} // namespace __txt_detail
 
 	using normalized_sentinel_t = ranges::default_sentinel_t;
@@ -227,18 +237,30 @@ namespace ztd { namespace text {
 		}
 
 		constexpr void _M_get_more() noexcept {
-			using _Unbounded = ::ztd::ranges::unbounded_view<::std::back_insert_iterator<_Storage>>;
-			auto& __norm     = this->__base_normalization_form_t::get_value();
-			auto& __range    = this->__base_range_t::get_value();
-			this->_M_normalized.clear();
-			_Unbounded __output(::std::back_inserter(this->_M_normalized));
-			auto __result = __norm(__range, __output);
-			__range       = ::std::move(__result.input);
-			ZTD_TEXT_ASSERT(__result.error_code == normalization_error::ok);
+			auto& __norm  = this->__base_normalization_form_t::get_value();
+			auto& __range = this->__base_range_t::get_value();
+			if constexpr (is_detected_v<__txt_detail::__detect_max_output, _UNormalizationForm>) {
+				using _Unbounded = ::ztd::ranges::unbounded_view<::std::back_insert_iterator<_Storage>>;
+				this->_M_normalized.clear();
+				_Unbounded __output(::std::back_inserter(this->_M_normalized));
+				auto __result = __norm(__range, __output);
+				__range       = ::std::move(__result.input);
+				ZTD_TEXT_ASSERT(__result.error_code == normalization_error::ok);
+			}
+			else {
+				// normalize a chunk at a time: the form stops at a segment boundary once the chunk is full
+				this->_M_normalized.resize(__txt_detail::__normalized_iterator_chunk_size);
+				::ztd::span<value_type> __output(this->_M_normalized.data(), this->_M_normalized.size());
+				auto __result = __norm(__range, __output);
+				__range       = ::std::move(__result.input);
+				this->_M_normalized.resize(::ztd::ranges::size(__output) - ::ztd::ranges::size(__result.output));
+				ZTD_TEXT_ASSERT(__result.error_code == normalization_error::ok
+					|| __result.error_code == normalization_error::insufficient_output);
+			}
 		}
 
 		_Storage _M_normalized;
-		unsigned char _M_cursor = 0;
+		::std::size_t _M_cursor = 0;
 	};
 
 
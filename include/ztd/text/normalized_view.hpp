@@ -68,22 +68,22 @@ namespace ztd { namespace text {
 		using normalization_form = _NormalizationForm;
 
 		//////
-		/// @brief Constructs with the given `__normalization_form`.
+		/// @brief Constructs with the given `__range`, using a default-constructed normalization form.
 		///
-		/// @param[in] __normalization_form The normalization form object to use for this iterator.
-		constexpr normalized_view(normalization_form __normalization_form) noexcept(
-			::std::is_nothrow_constructible_v<iterator, normalization_form>)
-		: _M_it(::std::move(__normalization_form)) {
+		/// @param[in] __range The range this normalization iterator will walk over.
+		constexpr normalized_view(range_type __range) noexcept(
+			::std::is_nothrow_constructible_v<iterator, range_type>)
+		: _M_it(::std::move(__range)) {
 		}
 
 		//////
-		/// @brief Constructs with the given `__normalization_form`.
+		/// @brief Constructs with the given `__range` and `__normalization_form`.
 		///
-		/// @param[in] __normalization_form The normalization form object to use for this iterator.
 		/// @param[in] __range The range this normalization iterator will walk over.
-		constexpr normalized_view(normalization_form __normalization_form, range_type __range) noexcept(
-			::std::is_nothrow_constructible_v<iterator, normalization_form, range_type>)
-		: _M_it(::std::move(__normalization_form), ::std::move(__range)) {
+		/// @param[in] __normalization_form The normalization form object to use for this iterator.
+		constexpr normalized_view(range_type __range, normalization_form __normalization_form) noexcept(
+			::std::is_nothrow_constructible_v<iterator, range_type, normalization_form>)
+		: _M_it(::std::move(__range), ::std::move(__normalization_form)) {
 		}
 
 		//////
@@ -0,0 +1,239 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#pragma once
+
+#ifndef ZTD_TEXT_OUTPUT_SIZING_HPP
+#define ZTD_TEXT_OUTPUT_SIZING_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/idk/type_traits.hpp>
+#include <ztd/ranges/adl.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+#include <ztd/prologue.hpp>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	//////
+	/// @addtogroup ztd_text_output_sizing Output Sizing Policies
+	///
+	/// @{
+
+	//////
+	/// @brief Reserves a multiple of the input's size that suits the encodings involved. This is what the `*_to`
+	/// functions use when no sizing policy is given.
+	class default_output_sizing_t { };
+
+	//////
+	/// @brief Counts the output with ztd::text::count_as_decoded, ztd::text::count_as_encoded or
+	/// ztd::text::count_as_transcoded first, then reserves exactly that much.
+	///
+	/// @remarks A few extra code units (or code points) are reserved past the count, which the conversion needs as
+	/// scratch space while writing its last sequences. This reads the input twice and calls the error handler(s)
+	/// during both passes, with a copy of the state(s) during the counting pass. Inputs that can only be read once,
+	/// and states that cannot be copied, fall back to ztd::text::default_output_sizing_t.
+	class exact_output_sizing_t { };
+
+	//////
+	/// @brief Reserves the most output the input could possibly produce, so that the conversion never has to grow the
+	/// container, at the cost of (often) reserving a lot more than is used.
+	///
+	/// @remarks The bound is the input's size times the most code points (for decoding) or code units (for encoding
+	/// and transcoding) a single input code unit (or code point, for encoding) can turn into.
+	class upper_bound_output_sizing_t { };
+
+	//////
+	/// @brief Reserves what the previous conversions between the same encodings turned out to need for the same
+	/// amount of input.
+	///
+	/// @remarks The ratio of output to input is tracked per pair of encodings and per thread, as a moving average
+	/// updated after each conversion of a sized input. Until a thread has seen a conversion for a given pair, this
+	/// behaves like ztd::text::default_output_sizing_t.
+	class adaptive_output_sizing_t { };
+
+	//////
+	/// @brief Reserves a size given by the caller (plus the same few code units of scratch space as
+	/// ztd::text::exact_output_sizing_t).
+	class user_hint_output_sizing_t {
+	public:
+		//////
+		/// @brief Constructs a sizing policy that reserves room for `__size` code units or code points.
+		constexpr explicit user_hint_output_sizing_t(::std::size_t __size) noexcept : _M_size(__size) {
+		}
+
+		//////
+		/// @brief The number of code units or code points that will be reserved.
+		constexpr ::std::size_t size() const noexcept {
+			return this->_M_size;
+		}
+
+	private:
+		::std::size_t _M_size;
+	};
+
+	//////
+	/// @brief An instance of ztd::text::default_output_sizing_t for ease of use.
+	inline constexpr default_output_sizing_t default_output_sizing = {};
+
+	//////
+	/// @brief An instance of ztd::text::exact_output_sizing_t for ease of use.
+	inline constexpr exact_output_sizing_t exact_output_sizing = {};
+
+	//////
+	/// @brief An instance of ztd::text::upper_bound_output_sizing_t for ease of use.
+	inline constexpr upper_bound_output_sizing_t upper_bound_output_sizing = {};
+
+	//////
+	/// @brief An instance of ztd::text::adaptive_output_sizing_t for ease of use.
+	inline constexpr adaptive_output_sizing_t adaptive_output_sizing = {};
+
+	//////
+	/// @brief Whether or not the given type is one of the output sizing policies that can be passed as the first
+	/// argument of the `*_to` functions.
+	template <typename _Type>
+	class is_output_sizing_policy : public ::std::false_type { };
+
+	template <>
+	class is_output_sizing_policy<default_output_sizing_t> : public ::std::true_type { };
+
+	template <>
+	class is_output_sizing_policy<exact_output_sizing_t> : public ::std::true_type { };
+
+	template <>
+	class is_output_sizing_policy<upper_bound_output_sizing_t> : public ::std::true_type { };
+
+	template <>
+	class is_output_sizing_policy<adaptive_output_sizing_t> : public ::std::true_type { };
+
+	template <>
+	class is_output_sizing_policy<user_hint_output_sizing_t> : public ::std::true_type { };
+
+	//////
+	/// @brief A `::value` alias for ztd::text::is_output_sizing_policy.
+	template <typename _Type>
+	inline constexpr bool is_output_sizing_policy_v = is_output_sizing_policy<_Type>::value;
+
+	//////
+	/// @}
+
+	namespace __txt_detail {
+		// the adaptive ratio is kept in fixed point: output elements per this many input elements
+		inline constexpr ::std::size_t __adaptive_ratio_scale = 256;
+
+		template <typename _Key>
+		inline ::std::size_t& __adaptive_output_ratio() noexcept {
+			// 0 until this thread has finished a conversion described by _Key
+			thread_local ::std::size_t __ratio = 0;
+			return __ratio;
+		}
+
+		template <typename _Input>
+		constexpr ::std::size_t __output_sizing_input_size(const _Input& __input) noexcept {
+			if constexpr (is_detected_v<ranges::detect_adl_size, const _Input&>) {
+				return static_cast<::std::size_t>(::ztd::ranges::size(__input));
+			}
+			else {
+				(void)__input;
+				return 0;
+			}
+		}
+
+		//////
+		/// @brief How much to reserve for a conversion described by `_Key` (a ztd::tag of what is converted from
+		/// and to), or `0` to not reserve anything.
+		///
+		/// @param[in] __default_size The size ztd::text::default_output_sizing_t reserves.
+		/// @param[in] __upper_bound The most output the input can produce.
+		/// @param[in] __headroom The room the conversion wants to have left over while writing its last sequences,
+		/// added to the other policies' sizes so that reaching the end does not need a reallocation.
+		/// @param[in] __count Called with `__default_size` to count the output for ztd::text::exact_output_sizing_t;
+		/// returns `__default_size` if the input cannot be counted.
+		template <typename _Key, typename _SizingPolicy, typename _Count>
+		constexpr ::std::size_t __output_size_hint(const _SizingPolicy& __sizing, ::std::size_t __input_size,
+			::std::size_t __default_size, ::std::size_t __upper_bound, ::std::size_t __headroom, _Count&& __count) {
+			using _USizingPolicy = remove_cvref_t<_SizingPolicy>;
+			static_assert(is_output_sizing_policy_v<_USizingPolicy>,
+				"the sizing policy must be one of the ztd::text output sizing policies");
+			if constexpr (::std::is_same_v<_USizingPolicy, exact_output_sizing_t>) {
+				return __count(__default_size) + __headroom;
+			}
+			else if constexpr (::std::is_same_v<_USizingPolicy, upper_bound_output_sizing_t>) {
+				return __upper_bound + __headroom;
+			}
+			else if constexpr (::std::is_same_v<_USizingPolicy, adaptive_output_sizing_t>) {
+				const ::std::size_t __ratio = __adaptive_output_ratio<_Key>();
+				if (__ratio == 0) {
+					return __default_size;
+				}
+				// a little slack, so that a slightly-larger-than-usual expansion does not have to grow the output
+				const ::std::size_t __estimate = (__input_size * __ratio) / __adaptive_ratio_scale;
+				return __estimate + (__estimate / 8) + __headroom;
+			}
+			else if constexpr (::std::is_same_v<_USizingPolicy, user_hint_output_sizing_t>) {
+				return __sizing.size() + __headroom;
+			}
+			else {
+				return __default_size;
+			}
+		}
+
+		//////
+		/// @brief Lets ztd::text::adaptive_output_sizing_t learn from a finished conversion described by `_Key`.
+		template <typename _Key, typename _SizingPolicy>
+		constexpr void __record_output_size(
+			const _SizingPolicy&, ::std::size_t __input_size, ::std::size_t __output_size) noexcept {
+			if constexpr (::std::is_same_v<remove_cvref_t<_SizingPolicy>, adaptive_output_sizing_t>) {
+				if (__input_size == 0) {
+					return;
+				}
+				const ::std::size_t __observed = (__output_size * __adaptive_ratio_scale) / __input_size;
+				::std::size_t& __ratio         = __adaptive_output_ratio<_Key>();
+				const ::std::size_t __averaged = __ratio == 0 ? __observed : ((__ratio * 3) + __observed) / 4;
+				// never store 0, which means "nothing seen yet"
+				__ratio = __averaged == 0 ? 1 : __averaged;
+			}
+			else {
+				(void)__input_size;
+				(void)__output_size;
+			}
+		}
+	} // namespace __txt_detail
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#include <ztd/epilogue.hpp>
+
+#endif
@@ -0,0 +1,646 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#pragma once
+
+#ifndef ZTD_TEXT_PARALLEL_TRANSCODE_HPP
+#define ZTD_TEXT_PARALLEL_TRANSCODE_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/code_unit.hpp>
+#include <ztd/text/count_as_transcoded.hpp>
+#include <ztd/text/default_handler.hpp>
+#include <ztd/text/encoding_error.hpp>
+#include <ztd/text/is_self_synchronizing_code.hpp>
+#include <ztd/text/is_unicode_code_point.hpp>
+#include <ztd/text/is_unicode_encoding.hpp>
+#include <ztd/text/max_units.hpp>
+#include <ztd/text/state.hpp>
+#include <ztd/text/transcode.hpp>
+#include <ztd/text/transcode_result.hpp>
+#include <ztd/text/detail/span_reconstruct.hpp>
+
+#include <ztd/idk/charN_t.hpp>
+#include <ztd/idk/char_traits.hpp>
+#include <ztd/idk/span.hpp>
+#include <ztd/idk/to_address.hpp>
+#include <ztd/idk/type_traits.hpp>
+#include <ztd/idk/detail/unicode.hpp>
+#include <ztd/ranges/adl.hpp>
+#include <ztd/ranges/range.hpp>
+
+#include <cstddef>
+#include <exception>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <ztd/prologue.hpp>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	//////
+	/// @brief Describes how ztd::text::parallel_transcode and its related functions split their work across threads.
+	class parallel_policy {
+	public:
+		//////
+		/// @brief The maximum number of threads (including the calling thread) to use. A value of `0` means
+		/// `std::thread::hardware_concurrency()`.
+		::std::size_t thread_count = 0;
+		//////
+		/// @brief The smallest number of input code units a single thread is given. Inputs smaller than twice this
+		/// amount are transcoded on the calling thread.
+		::std::size_t minimum_chunk_size = ZTD_TEXT_PARALLEL_TRANSCODE_MINIMUM_CHUNK_SIZE_I_;
+	};
+
+	//////
+	/// @brief A default ztd::text::parallel_policy, using every hardware thread and the default minimum chunk size.
+	inline constexpr parallel_policy parallel = {};
+
+	namespace __txt_detail {
+		template <typename _Encoding>
+		inline constexpr bool __is_parallel_decode_splittable_v
+			= is_self_synchronizing_code_v<_Encoding>                                  // cf
+			&& (max_code_units_v<_Encoding> == 1 || is_unicode_encoding_v<_Encoding>) // cf
+			&& is_decode_state_independent_v<_Encoding>                               // cf
+			&& ::std::is_empty_v<decode_state_t<_Encoding>>;
+
+		//////
+		/// @brief Whether or not an input can be split into independently transcoded pieces for this pair of
+		/// encodings.
+		///
+		/// @remarks The input must be a self-synchronizing code we know how to find the sequence boundaries for,
+		/// and neither side may carry state from one piece of the input to the next.
+		template <typename _FromEncoding, typename _ToEncoding>
+		inline constexpr bool __is_parallel_transcodable_v
+			= __is_parallel_decode_splittable_v<_FromEncoding> // cf
+			&& is_encode_state_independent_v<_ToEncoding>    // cf
+			&& ::std::is_empty_v<encode_state_t<_ToEncoding>>;
+
+		//////
+		/// @brief Whether or not the input can be split right before `__position` such that decoding the two pieces
+		/// separately yields exactly what decoding them together does, errors included.
+		///
+		/// @remarks The unit at `__position` must be one that every error recovery routine stops at, and the units
+		/// before it must end in a complete sequence (of whatever validity), so that no sequence nor error straddles
+		/// the split.
+		template <typename _Encoding, typename _CodeUnit>
+		constexpr bool __is_parallel_split_point(const _CodeUnit* __first, const _CodeUnit* __position) noexcept {
+			if constexpr (max_code_units_v<_Encoding> == 1) {
+				(void)__first;
+				(void)__position;
+				return true;
+			}
+			else if constexpr (sizeof(_CodeUnit) == 1) {
+				const uchar8_t __unit = static_cast<uchar8_t>(*__position);
+				// ASCII (sans NUL) and 2-/3-byte leads: every UTF-8 variant resynchronizes here
+				if ((__unit < 0x01 || __unit > 0x7F) && (__unit < 0xC2 || __unit > 0xEF)) {
+					return false;
+				}
+				const _CodeUnit* __lead    = __position - 1;
+				::std::size_t __trail_size = 0;
+				for (; __trail_size < 3 && __lead != __first; --__lead, ++__trail_size) {
+					if ((static_cast<uchar8_t>(*__lead) & 0xC0) != 0x80) {
+						break;
+					}
+				}
+				const uchar8_t __lead_unit = static_cast<uchar8_t>(*__lead);
+				if (__lead_unit < 0x80) {
+					return __trail_size == 0;
+				}
+				if (__lead_unit < 0xC2 || __lead_unit > 0xF4) {
+					return false;
+				}
+				const ::std::size_t __lead_length = __lead_unit >= 0xF0 ? 4 : (__lead_unit >= 0xE0 ? 3 : 2);
+				return __lead_length == __trail_size + 1;
+			}
+			else if constexpr (sizeof(_CodeUnit) == 2) {
+				const ztd_char32_t __unit     = static_cast<ztd_char32_t>(static_cast<char16_t>(*__position));
+				const ztd_char32_t __previous = static_cast<ztd_char32_t>(static_cast<char16_t>(__position[-1]));
+				(void)__first;
+				return !__ztd_idk_detail_is_surrogate(__unit) && !__ztd_idk_detail_is_lead_surrogate(__previous);
+			}
+			else {
+				const ztd_char32_t __unit = static_cast<ztd_char32_t>(*__position);
+				(void)__first;
+				return __unit <= __ztd_idk_detail_last_unicode_code_point && !__ztd_idk_detail_is_surrogate(__unit);
+			}
+		}
+
+		struct __parallel_chunk {
+			::std::size_t _M_input_first;
+			::std::size_t _M_input_last;
+			::std::size_t _M_output_first = 0;
+			::std::size_t _M_output_size  = 0;
+			::std::size_t _M_error_count  = 0;
+			encoding_error _M_error_code  = encoding_error::ok;
+			::std::exception_ptr _M_exception;
+		};
+
+		inline ::std::size_t __parallel_chunk_count(
+			const parallel_policy& __policy, ::std::size_t __input_size) noexcept {
+			::std::size_t __thread_count = __policy.thread_count;
+			if (__thread_count == 0) {
+				__thread_count = static_cast<::std::size_t>(::std::thread::hardware_concurrency());
+			}
+			const ::std::size_t __minimum_chunk_size
+				= __policy.minimum_chunk_size == 0 ? 1 : __policy.minimum_chunk_size;
+			const ::std::size_t __chunk_count = __input_size / __minimum_chunk_size;
+			if (__chunk_count < __thread_count) {
+				return __chunk_count == 0 ? 1 : __chunk_count;
+			}
+			return __thread_count == 0 ? 1 : __thread_count;
+		}
+
+		//////
+		/// @brief Calls `__function(__index)` for every index in [0, `__count`), one thread per index. Index 0 runs
+		/// on the calling thread.
+		///
+		/// @remarks `__function` must not throw. If a thread cannot be started, the remaining indices run on the
+		/// calling thread instead.
+		template <typename _Function>
+		void __parallel_for_each_index(::std::size_t __count, _Function& __function) {
+			::std::vector<::std::thread> __workers;
+			::std::size_t __index = 1;
+			try {
+				__workers.reserve(__count - 1);
+				for (; __index < __count; ++__index) {
+					__workers.emplace_back([&__function, __index]() { __function(__index); });
+				}
+			}
+			catch (...) {
+				for (; __index < __count; ++__index) {
+					__function(__index);
+				}
+			}
+			__function(0);
+			for (::std::thread& __worker : __workers) {
+				__worker.join();
+			}
+		}
+
+		template <typename _FromEncoding, typename _CodeUnit>
+		::std::vector<__parallel_chunk> __parallel_split(
+			::ztd::span<const _CodeUnit> __input, ::std::size_t __chunk_count) {
+			const _CodeUnit* const __first = __input.data();
+			const ::std::size_t __size     = __input.size();
+			::std::vector<__parallel_chunk> __chunks;
+			__chunks.reserve(__chunk_count);
+			::std::size_t __previous = 0;
+			for (::std::size_t __index = 1; __index < __chunk_count; ++__index) {
+				::std::size_t __split = (__size / __chunk_count) * __index;
+				if (__split <= __previous) {
+					__split = __previous + 1;
+				}
+				for (; __split < __size; ++__split) {
+					if (__is_parallel_split_point<_FromEncoding>(__first, __first + __split)) {
+						break;
+					}
+				}
+				if (__split >= __size) {
+					break;
+				}
+				__chunks.push_back(__parallel_chunk { __previous, __split });
+				__previous = __split;
+			}
+			__chunks.push_back(__parallel_chunk { __previous, __size });
+			return __chunks;
+		}
+
+		//////
+		/// @brief Transcodes `__input` by splitting it into pieces, counting the output of each piece in parallel,
+		/// and then transcoding every piece in parallel directly into its place in the output.
+		///
+		/// @remarks `__prepare_output` is called once, with the total number of code units that will be written, and
+		/// must return the ztd::span to write into (which may be smaller). Only the pieces up to and including the
+		/// first one that fails (or runs out of output space) are transcoded, so the returned positions, error code
+		/// and error count are those of a single, sequential ztd::text::transcode_into_raw call.
+		template <typename _FromEncoding, typename _ToEncoding, typename _FromErrorHandler, typename _ToErrorHandler,
+			typename _InputCodeUnit, typename _PrepareOutput>
+		auto __parallel_transcode_chunks(::ztd::span<const _InputCodeUnit> __input, ::std::size_t __chunk_count,
+			const _FromEncoding& __from_encoding, const _ToEncoding& __to_encoding,
+			const _FromErrorHandler& __from_error_handler, const _ToErrorHandler& __to_error_handler,
+			_PrepareOutput& __prepare_output) {
+			using _OutputSpan = decltype(__prepare_output(::std::size_t {}));
+			using _Result     = stateless_transcode_result<::ztd::span<const _InputCodeUnit>, _OutputSpan>;
+
+			::std::vector<__parallel_chunk> __chunks = __parallel_split<_FromEncoding>(__input, __chunk_count);
+			auto __chunk_input                       = [&__input](const __parallel_chunk& __chunk) {
+				return __input.subspan(__chunk._M_input_first, __chunk._M_input_last - __chunk._M_input_first);
+			};
+
+			auto __count_chunk = [&](::std::size_t __index) noexcept {
+				__parallel_chunk& __chunk = __chunks[__index];
+				try {
+					_FromErrorHandler __chunk_from_error_handler(__from_error_handler);
+					_ToErrorHandler __chunk_to_error_handler(__to_error_handler);
+					decode_state_t<_FromEncoding> __from_state = ::ztd::text::make_decode_state(__from_encoding);
+					encode_state_t<_ToEncoding> __to_state     = ::ztd::text::make_encode_state(__to_encoding);
+					auto __count_result = ::ztd::text::count_as_transcoded(__chunk_input(__chunk), __from_encoding,
+						__to_encoding, __chunk_from_error_handler, __chunk_to_error_handler, __from_state,
+						__to_state);
+					__chunk._M_output_size = __count_result.count;
+					__chunk._M_error_code  = __count_result.error_code;
+				}
+				catch (...) {
+					__chunk._M_exception = ::std::current_exception();
+				}
+			};
+			__parallel_for_each_index(__chunks.size(), __count_chunk);
+
+			// lay the pieces out one after another, stopping at the first one a sequential pass would stop at
+			::std::size_t __last_chunk    = __chunks.size() - 1;
+			::std::size_t __output_offset = 0;
+			for (::std::size_t __index = 0; __index < __chunks.size(); ++__index) {
+				__parallel_chunk& __chunk = __chunks[__index];
+				if (__chunk._M_exception) {
+					::std::rethrow_exception(__chunk._M_exception);
+				}
+				__chunk._M_output_first = __output_offset;
+				__output_offset += __chunk._M_output_size;
+				if (__chunk._M_error_code != encoding_error::ok) {
+					__last_chunk = __index;
+					break;
+				}
+			}
+			_OutputSpan __output = __prepare_output(__output_offset);
+			for (::std::size_t __index = 0; __index <= __last_chunk; ++__index) {
+				__parallel_chunk& __chunk = __chunks[__index];
+				if (__chunk._M_output_first + __chunk._M_output_size > __output.size()) {
+					__chunk._M_output_size = __output.size() - __chunk._M_output_first;
+					__last_chunk           = __index;
+					break;
+				}
+			}
+
+			auto __transcode_chunk = [&](::std::size_t __index) noexcept {
+				__parallel_chunk& __chunk = __chunks[__index];
+				try {
+					_FromErrorHandler __chunk_from_error_handler(__from_error_handler);
+					_ToErrorHandler __chunk_to_error_handler(__to_error_handler);
+					decode_state_t<_FromEncoding> __from_state = ::ztd::text::make_decode_state(__from_encoding);
+					encode_state_t<_ToEncoding> __to_state     = ::ztd::text::make_encode_state(__to_encoding);
+					::ztd::span<const _InputCodeUnit> __chunk_units = __chunk_input(__chunk);
+					_OutputSpan __chunk_output = __output.subspan(__chunk._M_output_first, __chunk._M_output_size);
+					auto __result = ::ztd::text::transcode_into_raw(__chunk_units, __from_encoding, __chunk_output,
+						__to_encoding, __chunk_from_error_handler, __chunk_to_error_handler, __from_state,
+						__to_state);
+					__chunk._M_input_last = __chunk._M_input_first
+						+ static_cast<::std::size_t>(
+						     ::ztd::to_address(::ztd::ranges::begin(__result.input)) - __chunk_units.data());
+					__chunk._M_output_size = static_cast<::std::size_t>(
+						::ztd::to_address(::ztd::ranges::begin(__result.output)) - __chunk_output.data());
+					__chunk._M_error_code  = __result.error_code;
+					__chunk._M_error_count = __result.error_count;
+				}
+				catch (...) {
+					__chunk._M_exception = ::std::current_exception();
+				}
+			};
+			__parallel_for_each_index(__last_chunk + 1, __transcode_chunk);
+
+			::std::size_t __error_count = 0;
+			for (::std::size_t __index = 0;; ++__index) {
+				__parallel_chunk& __chunk = __chunks[__index];
+				if (__chunk._M_exception) {
+					::std::rethrow_exception(__chunk._M_exception);
+				}
+				__error_count += __chunk._M_error_count;
+				if (__index == __last_chunk || __chunk._M_error_code != encoding_error::ok) {
+					const ::std::size_t __written = __chunk._M_output_first + __chunk._M_output_size;
+					return _Result(__input.subspan(__chunk._M_input_last), __output.subspan(__written),
+						__chunk._M_error_code, __error_count);
+				}
+			}
+		}
+
+		template <typename _Span, typename _Range>
+		_Span __parallel_remaining_span(_Span __original, _Range& __remaining) noexcept {
+			const auto* __remaining_first = ::ztd::to_address(::ztd::ranges::begin(__remaining));
+			return __original.subspan(static_cast<::std::size_t>(__remaining_first - __original.data()));
+		}
+
+		template <typename _Input>
+		auto __parallel_input_span(_Input&& __input) {
+			auto __reconstructed_input = __txt_detail::__span_reconstruct<_Input>(::std::forward<_Input>(__input));
+			using _ReconstructedInput  = decltype(__reconstructed_input);
+			using _CodeUnit            = ::ztd::ranges::range_value_type_t<_ReconstructedInput>;
+			static_assert(::ztd::ranges::is_range_contiguous_range_v<_ReconstructedInput> // cf
+				     && ::ztd::ranges::is_sized_range_v<_ReconstructedInput>,
+				"the input to a parallel transcode must be a contiguous, sized range of code units");
+			return ::ztd::span<const _CodeUnit>(::ztd::to_address(::ztd::ranges::begin(__reconstructed_input)),
+				static_cast<::std::size_t>(::ztd::ranges::size(__reconstructed_input)));
+		}
+	} // namespace __txt_detail
+
+	//////
+	/// @addtogroup ztd_text_parallel_transcode ztd::text::parallel_transcode
+	///
+	/// @brief These functions transcode large, contiguous inputs by splitting them into pieces and converting the
+	/// pieces on several threads at once.
+	///
+	/// @{
+
+	//////
+	/// @brief Converts the code units of the given contiguous input through the from encoding to code units of the
+	/// to encoding into the contiguous output, using several threads for large inputs.
+	///
+	/// @param[in] __policy The ztd::text::parallel_policy deciding how many threads to use and how small the
+	/// pieces of the input may get.
+	/// @param[in] __input A contiguous, sized range of code units to transcode.
+	/// @param[in] __from_encoding The encoding that will be used to decode the input's code units into
+	/// intermediate code points.
+	/// @param[in] __output A contiguous, sized range of code units to write the transcoded output into.
+	/// @param[in] __to_encoding The encoding that will be used to encode the intermediate code points into the
+	/// final code units.
+	/// @param[in] __from_error_handler The error handler for the `__from_encoding` 's decode step.
+	/// @param[in] __to_error_handler The error handler for the `__to_encoding` 's encode step.
+	///
+	/// @returns A ztd::text::stateless_transcode_result whose input and output are ztd::span s over what is left of
+	/// `__input` and `__output` .
+	///
+	/// @remarks When the input is split, every piece starts at a unit the `__from_encoding` is guaranteed to
+	/// resynchronize at, so the output, the error code, the error count, and the returned positions are the same as
+	/// a single call to ztd::text::transcode_into_raw. The error handlers are copied once per piece and, like the
+	/// encodings, used from several threads at once; output past the returned position is left unspecified when an
+	/// error stops the conversion. Splitting only happens when ztd::text::is_self_synchronizing_code_v holds for the
+	/// `__from_encoding` (with a known way to find its sequence boundaries) and neither encoding keeps state between
+	/// sequences; otherwise, or when the input is smaller than two of the policy's minimum chunk sizes, this is
+	/// exactly a call to ztd::text::transcode_into_raw on the calling thread.
+	template <typename _Input, typename _FromEncoding, typename _Output, typename _ToEncoding,
+		typename _FromErrorHandler, typename _ToErrorHandler>
+	auto parallel_transcode_into_raw(const parallel_policy& __policy, _Input&& __input,
+		_FromEncoding&& __from_encoding, _Output&& __output, _ToEncoding&& __to_encoding,
+		_FromErrorHandler&& __from_error_handler, _ToErrorHandler&& __to_error_handler) {
+		using _UFromEncoding     = remove_cvref_t<_FromEncoding>;
+		using _UToEncoding       = remove_cvref_t<_ToEncoding>;
+		using _UFromErrorHandler = remove_cvref_t<_FromErrorHandler>;
+		using _UToErrorHandler   = remove_cvref_t<_ToErrorHandler>;
+		using _UOutput           = remove_cvref_t<_Output>;
+		using _OutputCodeUnit    = ::ztd::ranges::range_value_type_t<_UOutput>;
+		using _OutputSpan        = ::ztd::span<_OutputCodeUnit>;
+		static_assert(::ztd::ranges::is_range_contiguous_range_v<_UOutput> // cf
+			     && ::ztd::ranges::is_sized_range_v<_UOutput>,
+			"the output of a parallel transcode must be a contiguous, sized range of code units");
+
+		auto __input_units = __txt_detail::__parallel_input_span(::std::forward<_Input>(__input));
+		_OutputSpan __output_units(::ztd::to_address(::ztd::ranges::begin(__output)),
+			static_cast<::std::size_t>(::ztd::ranges::size(__output)));
+		using _Result = stateless_transcode_result<decltype(__input_units), _OutputSpan>;
+
+		if constexpr (__txt_detail::__is_parallel_transcodable_v<_UFromEncoding, _UToEncoding>) {
+			const ::std::size_t __chunk_count = __txt_detail::__parallel_chunk_count(__policy, __input_units.size());
+			if (__chunk_count > 1) {
+				auto __prepare_output = [&__output_units](::std::size_t) { return __output_units; };
+				return __txt_detail::__parallel_transcode_chunks<_UFromEncoding, _UToEncoding, _UFromErrorHandler,
+					_UToErrorHandler>(__input_units, __chunk_count, __from_encoding, __to_encoding,
+					__from_error_handler, __to_error_handler, __prepare_output);
+			}
+		}
+		else {
+			(void)__policy;
+		}
+		auto __result = ::ztd::text::transcode_into_raw(__input_units, __from_encoding, __output_units, __to_encoding,
+			__from_error_handler, __to_error_handler);
+		return _Result(__txt_detail::__parallel_remaining_span(__input_units, __result.input),
+			__txt_detail::__parallel_remaining_span(__output_units, __result.output), __result.error_code,
+			__result.error_count);
+	}
+
+	//////
+	/// @brief Converts the code units of the given contiguous input through the from encoding to code units of the
+	/// to encoding into the contiguous output, using several threads for large inputs.
+	///
+	/// @param[in] __policy The ztd::text::parallel_policy deciding how many threads to use and how small the
+	/// pieces of the input may get.
+	/// @param[in] __input A contiguous, sized range of code units to transcode.
+	/// @param[in] __from_encoding The encoding that will be used to decode the input's code units into
+	/// intermediate code points.
+	/// @param[in] __output A contiguous, sized range of code units to write the transcoded output into.
+	/// @param[in] __to_encoding The encoding that will be used to encode the intermediate code points into the
+	/// final code units.
+	/// @param[in] __from_error_handler The error handler for the `__from_encoding` 's decode step.
+	///
+	/// @remarks This function creates a `to_error_handler` from a class like ztd::text::default_handler_t, but that
+	/// is marked as careless since you did not explicitly provide it.
+	template <typename _Input, typename _FromEncoding, typename _Output, typename _ToEncoding,
+		typename _FromErrorHandler>
+	auto parallel_transcode_into_raw(const parallel_policy& __policy, _Input&& __input,
+		_FromEncoding&& __from_encoding, _Output&& __output, _ToEncoding&& __to_encoding,
+		_FromErrorHandler&& __from_error_handler) {
+		auto __handler = __txt_detail::__duplicate_or_be_careless(__from_error_handler);
+
+		return ::ztd::text::parallel_transcode_into_raw(__policy, ::std::forward<_Input>(__input),
+			::std::forward<_FromEncoding>(__from_encoding), ::std::forward<_Output>(__output),
+			::std::forward<_ToEncoding>(__to_encoding), ::std::forward<_FromErrorHandler>(__from_error_handler),
+			__handler);
+	}
+
+	//////
+	/// @brief Converts the code units of the given contiguous input through the from encoding to code units of the
+	/// to encoding into the contiguous output, using several threads for large inputs.
+	///
+	/// @param[in] __policy The ztd::text::parallel_policy deciding how many threads to use and how small the
+	/// pieces of the input may get.
+	/// @param[in] __input A contiguous, sized range of code units to transcode.
+	/// @param[in] __from_encoding The encoding that will be used to decode the input's code units into
+	/// intermediate code points.
+	/// @param[in] __output A contiguous, sized range of code units to write the transcoded output into.
+	/// @param[in] __to_encoding The encoding that will be used to encode the intermediate code points into the
+	/// final code units.
+	///
+	/// @remarks This function creates a `from_error_handler` from a class like ztd::text::default_handler_t, but that
+	/// is marked as careless since you did not explicitly provide it.
+	template <typename _Input, typename _FromEncoding, typename _Output, typename _ToEncoding>
+	auto parallel_transcode_into_raw(const parallel_policy& __policy, _Input&& __input,
+		_FromEncoding&& __from_encoding, _Output&& __output, _ToEncoding&& __to_encoding) {
+		default_handler_t __handler {};
+
+		return ::ztd::text::parallel_transcode_into_raw(__policy, ::std::forward<_Input>(__input),
+			::std::forward<_FromEncoding>(__from_encoding), ::std::forward<_Output>(__output),
+			::std::forward<_ToEncoding>(__to_encoding), __handler);
+	}
+
+	//////
+	/// @brief Converts the code units of the given contiguous input through the from encoding to code units of the
+	/// to encoding, using several threads for large inputs, and returns the output in a result structure.
+	///
+	/// @tparam _OutputContainer The contiguous container to default-construct, `resize` and write into. Typically, a
+	/// `std::basic_string` or a `std::vector` of some sort.
+	///
+	/// @param[in] __policy The ztd::text::parallel_policy deciding how many threads to use and how small the
+	/// pieces of the input may get.
+	/// @param[in] __input A contiguous, sized range of code units to transcode.
+	/// @param[in] __from_encoding The encoding that will be used to decode the input's code units into
+	/// intermediate code points.
+	/// @param[in] __to_encoding The encoding that will be used to encode the intermediate code points into the
+	/// final code units.
+	/// @param[in] __from_error_handler The error handler for the `__from_encoding` 's decode step.
+	/// @param[in] __to_error_handler The error handler for the `__to_encoding` 's encode step.
+	///
+	/// @returns A ztd::text::stateless_transcode_result whose input is a ztd::span over what is left of `__input`
+	/// and whose output is the `_OutputContainer` .
+	///
+	/// @remarks When the input is split, the counts of every piece are added up first, so the container is sized
+	/// exactly once before the pieces are written into it. See ztd::text::parallel_transcode_into_raw for when the
+	/// input is split and what is guaranteed about the results.
+	template <typename _OutputContainer = void, typename _Input, typename _FromEncoding, typename _ToEncoding,
+		typename _FromErrorHandler, typename _ToErrorHandler>
+	auto parallel_transcode_to(const parallel_policy& __policy, _Input&& __input, _FromEncoding&& __from_encoding,
+		_ToEncoding&& __to_encoding, _FromErrorHandler&& __from_error_handler, _ToErrorHandler&& __to_error_handler) {
+		using _UFromEncoding            = remove_cvref_t<_FromEncoding>;
+		using _UToEncoding              = remove_cvref_t<_ToEncoding>;
+		using _UFromErrorHandler        = remove_cvref_t<_FromErrorHandler>;
+		using _UToErrorHandler          = remove_cvref_t<_ToErrorHandler>;
+		using _OutputCodeUnit           = code_unit_t<_UToEncoding>;
+		constexpr bool _IsVoidContainer = ::std::is_void_v<remove_cvref_t<_OutputContainer>>;
+		constexpr bool _IsStringable
+			= (is_char_traitable_v<_OutputCodeUnit> || is_unicode_code_point_v<_OutputCodeUnit>);
+		using _RealOutputContainer = ::std::conditional_t<_IsVoidContainer,
+			::std::conditional_t<_IsStringable, ::std::basic_string<_OutputCodeUnit>,
+			     ::std::vector<_OutputCodeUnit>>,
+			_OutputContainer>;
+
+		auto __input_units = __txt_detail::__parallel_input_span(::std::forward<_Input>(__input));
+		using _Result      = stateless_transcode_result<decltype(__input_units), _RealOutputContainer>;
+
+		if constexpr (__txt_detail::__is_parallel_transcodable_v<_UFromEncoding, _UToEncoding>) {
+			const ::std::size_t __chunk_count = __txt_detail::__parallel_chunk_count(__policy, __input_units.size());
+			if (__chunk_count > 1) {
+				_RealOutputContainer __output {};
+				auto __prepare_output = [&__output](::std::size_t __output_size) {
+					__output.resize(__output_size);
+					return ::ztd::span<_OutputCodeUnit>(::ztd::ranges::data(__output), __output.size());
+				};
+				auto __result = __txt_detail::__parallel_transcode_chunks<_UFromEncoding, _UToEncoding,
+					_UFromErrorHandler, _UToErrorHandler>(__input_units, __chunk_count, __from_encoding,
+					__to_encoding, __from_error_handler, __to_error_handler, __prepare_output);
+				return _Result(::std::move(__result.input), ::std::move(__output), __result.error_code,
+					__result.error_count);
+			}
+		}
+		else {
+			(void)__policy;
+		}
+		auto __result = ::ztd::text::transcode_to<_RealOutputContainer>(__input_units, __from_encoding,
+			__to_encoding, __from_error_handler, __to_error_handler);
+		return _Result(__txt_detail::__parallel_remaining_span(__input_units, __result.input),
+			::std::move(__result.output), __result.error_code, __result.error_count);
+	}
+
+	//////
+	/// @brief Converts the code units of the given contiguous input through the from encoding to code units of the
+	/// to encoding, using several threads for large inputs, and returns the output in a result structure.
+	///
+	/// @tparam _OutputContainer The contiguous container to default-construct, `resize` and write into.
+	///
+	/// @param[in] __policy The ztd::text::parallel_policy deciding how many threads to use and how small the
+	/// pieces of the input may get.
+	/// @param[in] __input A contiguous, sized range of code units to transcode.
+	/// @param[in] __from_encoding The encoding that will be used to decode the input's code units into
+	/// intermediate code points.
+	/// @param[in] __to_encoding The encoding that will be used to encode the intermediate code points into the
+	/// final code units.
+	///
+	/// @remarks This function creates a `from_error_handler` from a class like ztd::text::default_handler_t, but that
+	/// is marked as careless since you did not explicitly provide it.
+	template <typename _OutputContainer = void, typename _Input, typename _FromEncoding, typename _ToEncoding>
+	auto parallel_transcode_to(
+		const parallel_policy& __policy, _Input&& __input, _FromEncoding&& __from_encoding,
+		_ToEncoding&& __to_encoding) {
+		default_handler_t __handler {};
+		auto __to_handler = __txt_detail::__duplicate_or_be_careless(__handler);
+
+		return ::ztd::text::parallel_transcode_to<_OutputContainer>(__policy, ::std::forward<_Input>(__input),
+			::std::forward<_FromEncoding>(__from_encoding), ::std::forward<_ToEncoding>(__to_encoding), __handler,
+			__to_handler);
+	}
+
+	//////
+	/// @brief Converts the code units of the given contiguous input through the from encoding to code units of the
+	/// to encoding, using several threads for large inputs, and returns the output container.
+	///
+	/// @tparam _OutputContainer The contiguous container to default-construct, `resize` and write into.
+	///
+	/// @param[in] __policy The ztd::text::parallel_policy deciding how many threads to use and how small the
+	/// pieces of the input may get.
+	/// @param[in] __input A contiguous, sized range of code units to transcode.
+	/// @param[in] __from_encoding The encoding that will be used to decode the input's code units into
+	/// intermediate code points.
+	/// @param[in] __to_encoding The encoding that will be used to encode the intermediate code points into the
+	/// final code units.
+	/// @param[in] __from_error_handler The error handler for the `__from_encoding` 's decode step.
+	/// @param[in] __to_error_handler The error handler for the `__to_encoding` 's encode step.
+	template <typename _OutputContainer = void, typename _Input, typename _FromEncoding, typename _ToEncoding,
+		typename _FromErrorHandler, typename _ToErrorHandler>
+	auto parallel_transcode(const parallel_policy& __policy, _Input&& __input, _FromEncoding&& __from_encoding,
+		_ToEncoding&& __to_encoding, _FromErrorHandler&& __from_error_handler, _ToErrorHandler&& __to_error_handler) {
+		auto __result = ::ztd::text::parallel_transcode_to<_OutputContainer>(__policy,
+			::std::forward<_Input>(__input), ::std::forward<_FromEncoding>(__from_encoding),
+			::std::forward<_ToEncoding>(__to_encoding), ::std::forward<_FromErrorHandler>(__from_error_handler),
+			::std::forward<_ToErrorHandler>(__to_error_handler));
+		return ::std::move(__result.output);
+	}
+
+	//////
+	/// @brief Converts the code units of the given contiguous input through the from encoding to code units of the
+	/// to encoding, using several threads for large inputs, and returns the output container.
+	///
+	/// @tparam _OutputContainer The contiguous container to default-construct, `resize` and write into.
+	///
+	/// @param[in] __policy The ztd::text::parallel_policy deciding how many threads to use and how small the
+	/// pieces of the input may get.
+	/// @param[in] __input A contiguous, sized range of code units to transcode.
+	/// @param[in] __from_encoding The encoding that will be used to decode the input's code units into
+	/// intermediate code points.
+	/// @param[in] __to_encoding The encoding that will be used to encode the intermediate code points into the
+	/// final code units.
+	template <typename _OutputContainer = void, typename _Input, typename _FromEncoding, typename _ToEncoding>
+	auto parallel_transcode(
+		const parallel_policy& __policy, _Input&& __input, _FromEncoding&& __from_encoding,
+		_ToEncoding&& __to_encoding) {
+		auto __result = ::ztd::text::parallel_transcode_to<_OutputContainer>(__policy,
+			::std::forward<_Input>(__input), ::std::forward<_FromEncoding>(__from_encoding),
+			::std::forward<_ToEncoding>(__to_encoding));
+		return ::std::move(__result.output);
+	}
+
+	//////
+	/// @}
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#include <ztd/epilogue.hpp>
+
+#endif
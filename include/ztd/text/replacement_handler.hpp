@@ -46,6 +46,7 @@
 #include <ztd/text/is_unicode_code_point.hpp>
 #include <ztd/text/skip_input_error.hpp>
 #include <ztd/text/detail/pass_through_handler.hpp>
+#include <ztd/text/detail/progress_handler.hpp>
 
 #include <ztd/ranges/range.hpp>
 #include <ztd/ranges/reconstruct.hpp>
@@ -618,6 +619,175 @@ namespace ztd { namespace text {
 		}
 	};
 
+	//////
+	/// @brief An error handler that replaces bad code points and code units exactly like
+	/// ztd::text::replacement_handler_t, but deals with a whole run of consecutive errors in a single call.
+	///
+	/// @remarks After replacing the error it was called for, the handler keeps going over the input that follows
+	/// with the encoding's own `decode_one`/`encode_one`: every following sequence that is also in error is
+	/// replaced and skipped right there, until a sequence converts cleanly (its output is kept) or the output runs
+	/// out of room. Heavily corrupted input therefore costs one error handler call per run of errors rather than
+	/// one per error. What counts as a single error (and how much input each one skips) is up to the encoding,
+	/// just as with ztd::text::replacement_handler_t, and the result's `error_count` includes every error in the
+	/// run. When `collapse_runs` is `true`, the whole run gets a single replacement sequence instead of one per
+	/// error.
+	class run_replacement_handler_t {
+	private:
+		template <bool _IsDecode, typename _Encoding, typename _Input, typename _Output, typename _ErrorHandler,
+			typename _State>
+		static constexpr auto _S_one(const _Encoding& __encoding, _Input&& __input, _Output&& __output,
+			_ErrorHandler& __error_handler, _State& __state) {
+			if constexpr (_IsDecode) {
+				return __encoding.decode_one(
+					::std::forward<_Input>(__input), ::std::forward<_Output>(__output), __error_handler, __state);
+			}
+			else {
+				return __encoding.encode_one(
+					::std::forward<_Input>(__input), ::std::forward<_Output>(__output), __error_handler, __state);
+			}
+		}
+
+		template <bool _Replace, typename _Encoding, typename _Result, typename _InputProgress,
+			typename _OutputProgress>
+		static constexpr auto _S_replace_one(const _Encoding& __encoding, _Result&& __result,
+			const _InputProgress& __input_progress, const _OutputProgress& __output_progress) {
+			if constexpr (_Replace) {
+				return replacement_handler_t {}(
+					__encoding, ::std::forward<_Result>(__result), __input_progress, __output_progress);
+			}
+			else {
+				auto __skipped = ::ztd::text::skip_input_error(
+					__encoding, ::std::forward<_Result>(__result), __input_progress, __output_progress);
+				__skipped.error_code = encoding_error::ok;
+				return __skipped;
+			}
+		}
+
+		template <bool _Replace, bool _IsDecode, typename _Encoding, typename _Probe, typename _Progress>
+		static constexpr auto _S_replace_probe(const _Encoding& __encoding, _Probe&& __probe, _Progress& __progress) {
+			if constexpr (_IsDecode) {
+				return _S_replace_one<_Replace>(__encoding, ::std::forward<_Probe>(__probe),
+					__progress._M_code_units_progress(), __progress._M_code_points_progress());
+			}
+			else {
+				return _S_replace_one<_Replace>(__encoding, ::std::forward<_Probe>(__probe),
+					__progress._M_code_points_progress(), __progress._M_code_units_progress());
+			}
+		}
+
+		template <typename _Result, typename _Replaced>
+		static constexpr void _S_take(_Result& __result, _Replaced&& __replaced) {
+			__result.input      = ::std::move(__replaced.input);
+			__result.output     = ::std::move(__replaced.output);
+			__result.error_code = __replaced.error_code;
+			__result.error_count += 1;
+		}
+
+		template <typename _Encoding, typename _Result>
+		constexpr _Result _M_replace_run(const _Encoding& __encoding, _Result __result) const {
+			using _WorkingInput      = decltype(__result.input);
+			using _WorkingOutput     = decltype(__result.output);
+			using _State             = ::std::remove_reference_t<decltype(__result.state.get())>;
+			using _Progress          = __txt_detail::__progress_handler<false, _Encoding>;
+			constexpr bool _IsDecode = is_specialization_of_v<_Result, decode_result>;
+			using _Probe             = decltype(_S_one<_IsDecode>(__encoding, ::std::declval<_WorkingInput>(),
+				::std::declval<_WorkingOutput>(), ::std::declval<_Progress&>(), ::std::declval<_State&>()));
+			using _Replaced  = decltype(_S_replace_probe<true, _IsDecode>(
+				__encoding, ::std::declval<_Probe>(), ::std::declval<_Progress&>()));
+			using _Collapsed = decltype(_S_replace_probe<false, _IsDecode>(
+				__encoding, ::std::declval<_Probe>(), ::std::declval<_Progress&>()));
+
+			if constexpr (::std::is_same_v<_WorkingInput, decltype(::std::declval<_Probe>().input)>     // cf
+				&& ::std::is_same_v<_WorkingOutput, decltype(::std::declval<_Probe>().output)>         // cf
+				&& ::std::is_same_v<_WorkingInput, decltype(::std::declval<_Replaced>().input)>        // cf
+				&& ::std::is_same_v<_WorkingOutput, decltype(::std::declval<_Replaced>().output)>      // cf
+				&& ::std::is_same_v<_WorkingInput, decltype(::std::declval<_Collapsed>().input)>       // cf
+				&& ::std::is_same_v<_WorkingOutput, decltype(::std::declval<_Collapsed>().output)>) {
+				for (;;) {
+					if (__result.error_code != encoding_error::ok || ::ztd::ranges::empty(__result.input)) {
+						break;
+					}
+					_Progress __progress {};
+					auto __probe = _S_one<_IsDecode>(__encoding, ::std::move(__result.input),
+						::std::move(__result.output), __progress, __result.state.get());
+					if (__probe.error_code == encoding_error::ok
+						|| __probe.error_code == encoding_error::insufficient_output_space) {
+						// a good sequence (kept as-is) or no more room: the run is over, and the caller picks up
+						// from here as usual
+						__result.input  = ::std::move(__probe.input);
+						__result.output = ::std::move(__probe.output);
+						break;
+					}
+					if (this->collapse_runs) {
+						_S_take(__result,
+							_S_replace_probe<false, _IsDecode>(__encoding, ::std::move(__probe), __progress));
+					}
+					else {
+						_S_take(__result,
+							_S_replace_probe<true, _IsDecode>(__encoding, ::std::move(__probe), __progress));
+					}
+				}
+			}
+			return __result;
+		}
+
+	public:
+		//////
+		/// @brief Whether a whole run of consecutive errors is replaced with a single replacement sequence, rather
+		/// than one replacement sequence per error.
+		bool collapse_runs = false;
+
+		//////
+		/// @brief Constructs a handler that writes one replacement sequence per error.
+		constexpr run_replacement_handler_t() noexcept = default;
+
+		//////
+		/// @brief Constructs a handler that, if `__collapse_runs` is `true`, writes a single replacement sequence
+		/// for each run of consecutive errors.
+		constexpr run_replacement_handler_t(bool __collapse_runs) noexcept : collapse_runs(__collapse_runs) {
+		}
+
+		//////
+		/// @brief The function call for inserting replacement code units at the point of failure (and for every
+		/// error directly after it), before returning flow back to the caller of the encode operation.
+		///
+		/// @param[in] __encoding The Encoding that experienced the error.
+		/// @param[in] __result The current state of the encode operation.
+		/// @param[in] __input_progress How much input was (potentially irreversibly) read from the input range
+		/// before undergoing the attempted encode operation.
+		/// @param[in] __output_progress How much output was (potentially irreversibly) written to the output
+		/// range before undergoing the attempted encode operation.
+		template <typename _Encoding, typename _Input, typename _Output, typename _State, typename _InputProgress,
+			typename _OutputProgress>
+		constexpr auto operator()(const _Encoding& __encoding, encode_result<_Input, _Output, _State> __result,
+			const _InputProgress& __input_progress, const _OutputProgress& __output_progress) const {
+			return this->_M_replace_run(__encoding,
+				_S_replace_one<true>(__encoding, ::std::move(__result), __input_progress, __output_progress));
+		}
+
+		//////
+		/// @brief The function call for inserting replacement code points at the point of failure (and for every
+		/// error directly after it), before returning flow back to the caller of the decode operation.
+		///
+		/// @param[in] __encoding The Encoding that experienced the error.
+		/// @param[in] __result The current state of the decode operation.
+		/// @param[in] __input_progress How much input was (potentially irreversibly) read from the input range
+		/// before undergoing the attempted decode operation.
+		/// @param[in] __output_progress How much output was (potentially irreversibly) written to the output
+		/// range before undergoing the attempted decode operation.
+		template <typename _Encoding, typename _Input, typename _Output, typename _State, typename _InputProgress,
+			typename _OutputProgress>
+		constexpr auto operator()(const _Encoding& __encoding, decode_result<_Input, _Output, _State> __result,
+			const _InputProgress& __input_progress, const _OutputProgress& __output_progress) const {
+			return this->_M_replace_run(__encoding,
+				_S_replace_one<true>(__encoding, ::std::move(__result), __input_progress, __output_progress));
+		}
+	};
+
+	//////
+	/// @brief A convenience variable for passing the run_replacement_handler_t handler to functions.
+	inline constexpr run_replacement_handler_t run_replacement_handler = {};
+
 	template <typename _CodePoints, typename _CodeUnits>
 	replacement_of_handler(_CodePoints&&, _CodeUnits&&)
 		-> replacement_of_handler<::std::remove_reference_t<_CodePoints>, ::std::remove_reference_t<_CodeUnits>>;
@@ -41,6 +41,7 @@
 #include <ztd/text/is_ignorable_error_handler.hpp>
 #include <ztd/text/detail/empty_state.hpp>
 #include <ztd/text/detail/replacement_units.hpp>
+#include <ztd/text/detail/multibyte_reverse_tables.hpp>
 
 #include <ztd/encoding_tables/shift_jis_x0208.tables.hpp>
 #include <ztd/ranges/adl.hpp>
@@ -370,7 +371,9 @@ namespace ztd { namespace text {
 			}
 
 			::std::optional<::std::size_t> __maybe_index
-				= ::ztd::et::shift_jis_x0208_code_point_to_index(__code_point);
+				= __txt_detail::__multibyte_code_point_to_index<60 * 188,
+				     &::ztd::et::shift_jis_x0208_index_to_code_point,
+				     &::ztd::et::shift_jis_x0208_code_point_to_index>(__code_point);
 			if (__maybe_index) {
 				::std::size_t __index         = *__maybe_index;
 				::std::size_t __first         = __index / 188;
@@ -0,0 +1,349 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#pragma once
+
+#ifndef ZTD_TEXT_STREAM_TRANSCODER_HPP
+#define ZTD_TEXT_STREAM_TRANSCODER_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/code_unit.hpp>
+#include <ztd/text/default_handler.hpp>
+#include <ztd/text/encoding_error.hpp>
+#include <ztd/text/incomplete_handler.hpp>
+#include <ztd/text/max_units.hpp>
+#include <ztd/text/state.hpp>
+#include <ztd/text/transcode.hpp>
+#include <ztd/text/transcode_one.hpp>
+#include <ztd/text/transcode_result.hpp>
+
+#include <ztd/idk/span.hpp>
+#include <ztd/idk/to_address.hpp>
+#include <ztd/idk/type_traits.hpp>
+#include <ztd/ranges/adl.hpp>
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include <ztd/prologue.hpp>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	//////
+	/// @brief Transcodes a stream of code units that arrives in arbitrary pieces (network packets, file reads, and
+	/// similar), carrying any sequence that is split across two pieces over to the next one.
+	///
+	/// @tparam _FromEncoding The encoding of the incoming code units.
+	/// @tparam _ToEncoding The encoding of the outgoing code units.
+	/// @tparam _FromErrorHandler The error handler for decoding the incoming code units.
+	/// @tparam _ToErrorHandler The error handler for encoding into the outgoing code units.
+	///
+	/// @remarks Each piece is handed to ztd::text::transcode_into_raw as-is and written straight into the caller's
+	/// output, so pieces are never copied or buffered. The only storage is a fixed carry buffer of
+	/// ztd::text::max_code_units_v<_FromEncoding> code units: when a piece ends partway through a sequence, a
+	/// ztd::text::basic_incomplete_handler wrapped around `_FromErrorHandler` catches the incomplete sequence, and
+	/// its code units are kept until the next call to `feed` completes them. Memory use is therefore constant no
+	/// matter how large the stream is, and nothing is ever allocated. The decode and encode states live in the
+	/// object, so stateful encodings also work across pieces. Reading part of a sequence may already have changed
+	/// the decode state, so a carried sequence is read again from a copy of the decode state taken before it was
+	/// started: encodings with a non-empty decode state therefore need a copyable one, and are transcoded one
+	/// sequence at a time.
+	template <typename _FromEncoding, typename _ToEncoding, typename _FromErrorHandler = default_handler_t,
+		typename _ToErrorHandler = default_handler_t>
+	class stream_transcoder {
+	private:
+		using _FromCodeUnit         = code_unit_t<_FromEncoding>;
+		using _ToCodeUnit           = code_unit_t<_ToEncoding>;
+		using _CarryingErrorHandler = basic_incomplete_handler<_FromEncoding, _FromErrorHandler>;
+		using _FromState            = decode_state_t<_FromEncoding>;
+		using _ToState              = encode_state_t<_ToEncoding>;
+		using _InputSpan            = ::ztd::span<const _FromCodeUnit>;
+		using _OutputSpan           = ::ztd::span<_ToCodeUnit>;
+
+		static constexpr ::std::size_t _S_carry_max = max_code_units_v<_FromEncoding>;
+		static constexpr bool _S_is_from_stateless  = ::std::is_empty_v<_FromState>;
+
+		static_assert(_S_is_from_stateless
+			     || (::std::is_copy_constructible_v<_FromState> && ::std::is_copy_assignable_v<_FromState>),
+			"a stream_transcoder needs to be able to copy a non-empty decode state, to put it back when a sequence "
+			"is carried over to the next piece");
+
+		template <typename _Span, typename _Range>
+		static constexpr ::std::size_t _S_used(const _Span& __all, const _Range& __rest) noexcept {
+			return static_cast<::std::size_t>(::ztd::to_address(::ztd::ranges::begin(__rest)) - __all.data());
+		}
+
+		template <typename _Span, typename _Range>
+		static constexpr _Span _S_remaining(const _Span& __all, const _Range& __rest) noexcept {
+			return __all.subspan(_S_used(__all, __rest));
+		}
+
+		// consumes __read code units of the carry window (the carried code units followed by however many code
+		// units were borrowed from the front of __input), and advances __input past whatever was borrowed
+		constexpr void _M_consume_carry(::std::size_t __read, _InputSpan& __input) noexcept {
+			const ::std::size_t __carried = this->_M_carry_size;
+			if (__read >= __carried) {
+				this->_M_carry_size = 0;
+				__input             = __input.subspan(__read - __carried);
+				return;
+			}
+			for (::std::size_t __index = __read; __index < __carried; ++__index) {
+				this->_M_carry[__index - __read] = this->_M_carry[__index];
+			}
+			this->_M_carry_size = __carried - __read;
+		}
+
+		// keeps the code units of the sequence the incomplete handler caught at the end of a piece
+		constexpr void _M_carry_partial() noexcept {
+			auto __partial = this->_M_from_error_handler.code_units();
+			for (::std::size_t __index = 0; __index < __partial.size(); ++__index) {
+				this->_M_carry[__index] = __partial[__index];
+			}
+			this->_M_carry_size = __partial.size();
+		}
+
+	public:
+		//////
+		/// @brief The encoding of the incoming code units.
+		using from_encoding_type = _FromEncoding;
+		//////
+		/// @brief The encoding of the outgoing code units.
+		using to_encoding_type = _ToEncoding;
+		//////
+		/// @brief The error handler used when decoding the incoming code units.
+		using from_error_handler_type = _FromErrorHandler;
+		//////
+		/// @brief The error handler used when encoding the outgoing code units.
+		using to_error_handler_type = _ToErrorHandler;
+		//////
+		/// @brief The result of ztd::text::stream_transcoder::feed and ztd::text::stream_transcoder::finish.
+		using result_type = stateless_transcode_result<_InputSpan, _OutputSpan>;
+
+		//////
+		/// @brief Constructs a ztd::text::stream_transcoder with default-constructed encodings and error handlers.
+		constexpr stream_transcoder() : stream_transcoder(_FromEncoding {}, _ToEncoding {}) {
+		}
+
+		//////
+		/// @brief Constructs a ztd::text::stream_transcoder with the given encodings and default-constructed error
+		/// handlers.
+		///
+		/// @param[in] __from_encoding The encoding of the incoming code units.
+		/// @param[in] __to_encoding The encoding of the outgoing code units.
+		constexpr stream_transcoder(_FromEncoding __from_encoding, _ToEncoding __to_encoding)
+		: stream_transcoder(
+			::std::move(__from_encoding), ::std::move(__to_encoding), _FromErrorHandler {}, _ToErrorHandler {}) {
+		}
+
+		//////
+		/// @brief Constructs a ztd::text::stream_transcoder with the given encodings and error handlers.
+		///
+		/// @param[in] __from_encoding The encoding of the incoming code units.
+		/// @param[in] __to_encoding The encoding of the outgoing code units.
+		/// @param[in] __from_error_handler The error handler for decoding the incoming code units. Incomplete
+		/// sequences at the end of a piece never reach it; see ztd::text::stream_transcoder::finish.
+		/// @param[in] __to_error_handler The error handler for encoding into the outgoing code units.
+		constexpr stream_transcoder(_FromEncoding __from_encoding, _ToEncoding __to_encoding,
+			_FromErrorHandler __from_error_handler, _ToErrorHandler __to_error_handler)
+		: _M_from_encoding(::std::move(__from_encoding))
+		, _M_to_encoding(::std::move(__to_encoding))
+		, _M_from_error_handler(::std::move(__from_error_handler))
+		, _M_to_error_handler(::std::move(__to_error_handler))
+		, _M_from_state(::ztd::text::make_decode_state(this->_M_from_encoding))
+		, _M_to_state(::ztd::text::make_encode_state(this->_M_to_encoding))
+		, _M_carry()
+		, _M_carry_size(0) {
+		}
+
+		//////
+		/// @brief Transcodes the next piece of the stream into `__output`.
+		///
+		/// @param[in] __input The next piece of incoming code units.
+		/// @param[in] __output Where to write the outgoing code units.
+		///
+		/// @returns The unused part of `__input` and `__output`, the error code, and the number of errors handled.
+		/// If the error code is ztd::text::encoding_error::insufficient_output_space, call this again with the
+		/// returned `input` and more output space. A sequence cut off by the end of `__input` is not an error: it is
+		/// carried over and completed by the next call, and the returned `input` is empty.
+		constexpr result_type feed(_InputSpan __input, _OutputSpan __output) {
+			::std::size_t __error_count = 0;
+			while (this->_M_carry_size > 0) {
+				// finish the carried sequence with just enough of this piece to complete it
+				if (__input.empty()) {
+					return result_type(__input, __output, encoding_error::ok, __error_count);
+				}
+				const ::std::size_t __carried = this->_M_carry_size;
+				const ::std::size_t __borrowed
+					= __input.size() < (_S_carry_max - __carried) ? __input.size() : (_S_carry_max - __carried);
+				for (::std::size_t __index = 0; __index < __borrowed; ++__index) {
+					this->_M_carry[__carried + __index] = __input[__index];
+				}
+				_InputSpan __window(this->_M_carry.data(), __carried + __borrowed);
+				_FromState __sequence_state = this->_M_from_state;
+				auto __result = ::ztd::text::transcode_one_into_raw(__window, this->_M_from_encoding, __output,
+					this->_M_to_encoding, this->_M_from_error_handler, this->_M_to_error_handler,
+					this->_M_from_state, this->_M_to_state);
+				if (__result.error_code == encoding_error::incomplete_sequence && __borrowed == __input.size()) {
+					// this whole piece still does not finish the sequence: it is read again from the start next
+					// time, so the state has to be what it was before this attempt
+					this->_M_from_state = __sequence_state;
+					this->_M_carry_size = __window.size();
+					return result_type(__input.subspan(__borrowed), __output, encoding_error::ok, __error_count);
+				}
+				__error_count += __result.error_count;
+				__output = _S_remaining(__output, __result.output);
+				this->_M_consume_carry(_S_used(__window, __result.input), __input);
+				if (__result.error_code != encoding_error::ok) {
+					return result_type(__input, __output, __result.error_code, __error_count);
+				}
+			}
+			if (__input.empty()) {
+				return result_type(__input, __output, encoding_error::ok, __error_count);
+			}
+			if constexpr (_S_is_from_stateless) {
+				auto __result = ::ztd::text::transcode_into_raw(__input, this->_M_from_encoding, __output,
+					this->_M_to_encoding, this->_M_from_error_handler, this->_M_to_error_handler,
+					this->_M_from_state, this->_M_to_state);
+				_InputSpan __input_rest   = _S_remaining(__input, __result.input);
+				_OutputSpan __output_rest = _S_remaining(__output, __result.output);
+				if (__result.error_code == encoding_error::incomplete_sequence) {
+					// the piece ended partway through a sequence: the incomplete handler kept what was read of it
+					this->_M_carry_partial();
+					// ... and the incomplete sequence itself is not an error (yet)
+					__error_count += __result.error_count > 0 ? __result.error_count - 1 : 0;
+					return result_type(__input_rest, __output_rest, encoding_error::ok, __error_count);
+				}
+				__error_count += __result.error_count;
+				return result_type(__input_rest, __output_rest, __result.error_code, __error_count);
+			}
+			else {
+				// the state each sequence starts in has to be kept until the sequence is known to be complete,
+				// so this goes one sequence at a time
+				while (!__input.empty()) {
+					_FromState __sequence_state = this->_M_from_state;
+					auto __result = ::ztd::text::transcode_one_into_raw(__input, this->_M_from_encoding, __output,
+						this->_M_to_encoding, this->_M_from_error_handler, this->_M_to_error_handler,
+						this->_M_from_state, this->_M_to_state);
+					__input  = _S_remaining(__input, __result.input);
+					__output = _S_remaining(__output, __result.output);
+					if (__result.error_code == encoding_error::incomplete_sequence) {
+						this->_M_from_state = __sequence_state;
+						this->_M_carry_partial();
+						__error_count += __result.error_count > 0 ? __result.error_count - 1 : 0;
+						return result_type(__input, __output, encoding_error::ok, __error_count);
+					}
+					__error_count += __result.error_count;
+					if (__result.error_code != encoding_error::ok) {
+						return result_type(__input, __output, __result.error_code, __error_count);
+					}
+				}
+				return result_type(__input, __output, encoding_error::ok, __error_count);
+			}
+		}
+
+		//////
+		/// @brief Ends the stream, transcoding any carried code units into `__output`.
+		///
+		/// @param[in] __output Where to write the outgoing code units.
+		///
+		/// @returns The carried code units that could not be used (empty on success), the unused part of
+		/// `__output`, the error code, and the number of errors handled.
+		///
+		/// @remarks A sequence that was still incomplete when the stream ended goes to `_FromErrorHandler` as a
+		/// ztd::text::encoding_error::incomplete_sequence. If the error code is
+		/// ztd::text::encoding_error::insufficient_output_space, call this again with more output space. On
+		/// success, the states are reset so that this object can be used for a new stream.
+		constexpr result_type finish(_OutputSpan __output) {
+			::std::size_t __error_count = 0;
+			if (this->_M_carry_size > 0) {
+				_InputSpan __window(this->_M_carry.data(), this->_M_carry_size);
+				auto __result = ::ztd::text::transcode_into_raw(__window, this->_M_from_encoding, __output,
+					this->_M_to_encoding, this->_M_from_error_handler.base(), this->_M_to_error_handler,
+					this->_M_from_state, this->_M_to_state);
+				_InputSpan __unused = {};
+				__error_count += __result.error_count;
+				__output = _S_remaining(__output, __result.output);
+				this->_M_consume_carry(_S_used(__window, __result.input), __unused);
+				if (__result.error_code != encoding_error::ok) {
+					return result_type(_InputSpan(this->_M_carry.data(), this->_M_carry_size), __output,
+						__result.error_code, __error_count);
+				}
+			}
+			this->reset();
+			return result_type(_InputSpan(this->_M_carry.data(), 0), __output, encoding_error::ok, __error_count);
+		}
+
+		//////
+		/// @brief Drops any carried code units and resets both states, to start a new stream.
+		constexpr void reset() {
+			this->_M_from_state = ::ztd::text::make_decode_state(this->_M_from_encoding);
+			this->_M_to_state   = ::ztd::text::make_encode_state(this->_M_to_encoding);
+			this->_M_carry_size = 0;
+		}
+
+		//////
+		/// @brief The code units of an incomplete sequence carried over from the last piece, if any.
+		constexpr _InputSpan carried() const noexcept {
+			return _InputSpan(this->_M_carry.data(), this->_M_carry_size);
+		}
+
+		//////
+		/// @brief The encoding of the incoming code units.
+		constexpr const _FromEncoding& from_encoding() const noexcept {
+			return this->_M_from_encoding;
+		}
+
+		//////
+		/// @brief The encoding of the outgoing code units.
+		constexpr const _ToEncoding& to_encoding() const noexcept {
+			return this->_M_to_encoding;
+		}
+
+	private:
+		_FromEncoding _M_from_encoding;
+		_ToEncoding _M_to_encoding;
+		_CarryingErrorHandler _M_from_error_handler;
+		_ToErrorHandler _M_to_error_handler;
+		_FromState _M_from_state;
+		_ToState _M_to_state;
+		::std::array<_FromCodeUnit, _S_carry_max> _M_carry;
+		::std::size_t _M_carry_size;
+	};
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#include <ztd/epilogue.hpp>
+
+#endif
@@ -44,13 +44,21 @@
 #include <ztd/text/transcode_result.hpp>
 #include <ztd/text/is_unicode_code_point.hpp>
 #include <ztd/text/transcode_one.hpp>
+#include <ztd/text/count_as_transcoded.hpp>
+#include <ztd/text/output_sizing.hpp>
 #include <ztd/text/encode.hpp>
 #include <ztd/text/decode.hpp>
 #include <ztd/text/detail/is_lossless.hpp>
 #include <ztd/text/detail/encoding_range.hpp>
+#include <ztd/text/detail/segmented_range.hpp>
 #include <ztd/text/detail/transcode_extension_points.hpp>
+#include <ztd/text/detail/transcode_unicode_kernels.hpp>
+#include <ztd/text/detail/transcode_encoding_scheme.hpp>
+#include <ztd/text/detail/transcode_iconv.hpp>
+#include <ztd/text/detail/transcode_cuneicode_registry.hpp>
 #include <ztd/text/detail/span_reconstruct.hpp>
 #include <ztd/text/detail/forward_if_move_only.hpp>
+#include <ztd/text/detail/output_storage.hpp>
 
 #include <ztd/idk/tag.hpp>
 #include <ztd/idk/span.hpp>
@@ -145,9 +153,9 @@ namespace ztd { namespace text {
 			__working_output = ::std::move(__transcode_result.output);
 			if (__transcode_result.error_code != encoding_error::ok) {
 				return _Result(::std::move(__working_input), ::std::move(__working_output), __from_state,
-					__to_state, __transcode_result.error_code, __transcode_result.error_count,
+					__to_state, __transcode_result.error_code, __error_count,
 					::std::move(__transcode_result.pivot), __transcode_result.pivot_error_code,
-					__transcode_result.pivot_error_count);
+					__pivot_error_count);
 			}
 			if (::ztd::ranges::empty(__working_input)) {
 				if (!::ztd::text::is_state_complete(__from_encoding, __from_state)) {
@@ -231,7 +239,14 @@ namespace ztd { namespace text {
 				return _Result(::std::move(__result.in), ::std::move(__result.out), __from_state, __to_state,
 					encoding_error::ok, 0, ::std::forward<_Pivot>(__pivot), encoding_error::ok, 0);
 			}
-			else if constexpr (is_detected_v<__txt_detail::__detect_adl_internal_text_transcode_one, _Input,
+			else if constexpr (__txt_detail::__is_segmentable_v<_Input, _FromState, _ToState>) {
+				return __txt_detail::__segmented_transcode_into_raw(::std::forward<_Input>(__input),
+					::std::forward<_FromEncoding>(__from_encoding), ::std::forward<_Output>(__output),
+					::std::forward<_ToEncoding>(__to_encoding),
+					::std::forward<_FromErrorHandler>(__from_error_handler),
+					::std::forward<_ToErrorHandler>(__to_error_handler), __from_state, __to_state, __pivot);
+			}
+			else if constexpr (is_detected_v<__txt_detail::__detect_adl_internal_text_transcode, _Input,
 				                   _FromEncoding, _Output, _ToEncoding, _FromErrorHandler, _ToErrorHandler,
 				                   _FromState, _ToState, _Pivot>) {
 				return __text_transcode(
@@ -499,6 +514,8 @@ namespace ztd { namespace text {
 				   __from_encoding, ::std::declval<_IntermediateOutput>(), __to_encoding, __from_error_handler,
 				   __to_error_handler, __from_state, __to_state, __pivot));
 			using _WorkingInput       = decltype(::std::declval<_TranscodeResult>().input);
+			using _Storage            = __output_storage_t<_OutputContainer, _IntermediateOutputValueType,
+				           _IntermediateOutputMax, _MinimumIntermediateOutputMax>;
 
 			static_assert(__txt_detail::__is_decode_lossless_or_deliberate_v<remove_cvref_t<_FromEncoding>,
 				              remove_cvref_t<_FromErrorHandler>>,
@@ -508,7 +525,7 @@ namespace ztd { namespace text {
 				ZTD_TEXT_LOSSY_TRANSCODE_ENCODE_MESSAGE_I_);
 
 			_WorkingInput __working_input(::ztd::ranges::cbegin(__input), ::ztd::ranges::cend(__input));
-			_IntermediateOutputValueType __intermediate_output_storage[_IntermediateOutputMax] {};
+			_Storage __storage(__output);
 			_FromProgressHandler __from_progress_handler {};
 			_ToProgressHandler __to_progress_handler {};
 			::std::size_t __error_count       = 0;
@@ -516,19 +533,19 @@ namespace ztd { namespace text {
 			for (;;) {
 				__from_progress_handler.clear();
 				__to_progress_handler.clear();
-				_IntermediateOutput __intermediate_output(__intermediate_output_storage, _IntermediateOutputMax);
+				// the last _MinimumIntermediateOutputMax code units of the room are left alone, so that the room
+				// fetched again below always has enough space for one whole transcoded sequence
+				::ztd::span<_IntermediateOutputValueType> __room = __storage._M_room();
+				_IntermediateOutput __intermediate_output(
+					__room.data(), __room.data() + (__room.size() - _MinimumIntermediateOutputMax));
 				auto __result = ::ztd::text::transcode_into_raw(::std::move(__working_input), __from_encoding,
 					__intermediate_output, __to_encoding, __from_progress_handler, __to_progress_handler,
 					__from_state, __to_state, __pivot);
-				::std::size_t __intermediate_written_count
-					= static_cast<std::size_t>(__result.output.data() - __intermediate_output.data());
-				_IntermediateOutput __written_intermediate(
-					__intermediate_output.begin(), __intermediate_output.begin() + __intermediate_written_count);
-				ranges::__rng_detail::__container_insert_bulk(__output, __written_intermediate);
+				__storage._M_commit(
+					static_cast<std::size_t>(__result.output.data() - __intermediate_output.data()));
 				if (__result.error_code == encoding_error::insufficient_output_space) {
 					if (__to_progress_handler._M_code_units_progress_size() != 0) {
-						ranges::__rng_detail::__container_insert_bulk(
-							__output, __to_progress_handler._M_code_units_progress());
+						__storage._M_append(__to_progress_handler._M_code_units_progress());
 						__error_count += __result.error_count;
 						__pivot_error_count += __result.pivot_error_count;
 						__working_input
@@ -540,15 +557,14 @@ namespace ztd { namespace text {
 						// re-serialize with enough space all over again to avoid issues.
 						::std::size_t __pivot_remnant_count = static_cast<std::size_t>(
 							::ztd::ranges::size(__pivot) - ::ztd::ranges::size(__result.pivot));
-						auto __pivot_remnant = ::ztd::ranges::reconstruct(::std::in_place_type<_Pivot>,
+						auto __pivot_remnant  = ::ztd::ranges::reconstruct(::std::in_place_type<_Pivot>,
 							ztd::ranges::cbegin(__pivot), ztd::ranges::cbegin(__pivot) + __pivot_remnant_count);
-						auto __pivot_result  = ::ztd::text::encode_into_raw(__pivot_remnant, __to_encoding,
-							 __intermediate_output, __to_error_handler, __to_state);
-						::std::size_t __intermediate_written_count = static_cast<std::size_t>(
-							__pivot_result.output.data() - __intermediate_output.data());
-						_IntermediateOutput __pivot_intermediate_output(__intermediate_output.begin(),
-							__intermediate_output.begin() + __intermediate_written_count);
-						ranges::__rng_detail::__container_insert_bulk(__output, __pivot_intermediate_output);
+						__room                = __storage._M_room();
+						__intermediate_output = _IntermediateOutput(__room.data(), __room.data() + __room.size());
+						auto __pivot_result   = ::ztd::text::encode_into_raw(__pivot_remnant, __to_encoding,
+							  __intermediate_output, __to_error_handler, __to_state);
+						__storage._M_commit(static_cast<std::size_t>(
+							__pivot_result.output.data() - __intermediate_output.data()));
 						__error_count += __pivot_result.error_count;
 						__pivot_error_count += __result.pivot_error_count;
 						if (__pivot_result.error_code == encoding_error::ok) {
@@ -569,6 +585,9 @@ namespace ztd { namespace text {
 						decltype(__result.pivot), _FromState>;
 					using _ErrorEncodeResult = ::ztd::text::encode_result<decltype(__result.pivot),
 						decltype(__result.output), _ToState>;
+					// the error handlers write into a fresh room, right after everything committed so far
+					__room                = __storage._M_room();
+					__intermediate_output = _IntermediateOutput(__room.data(), __room.data() + __room.size());
 					if (__result.pivot_error_code != encoding_error::ok) {
 						// need to call the error handler and then propagate it.
 						auto __error_result = ::ztd::text::propagate_transcode_decode_error<_TranscodeResult>(
@@ -580,11 +599,8 @@ namespace ztd { namespace text {
 							__from_progress_handler._M_code_points_progress(),
 							__to_progress_handler._M_code_points_progress(),
 							__to_progress_handler._M_code_units_progress());
-						::std::size_t __error_written_count = static_cast<std::size_t>(
-							__error_result.output.data() - __intermediate_output.data());
-						_IntermediateOutput __error_intermediate_output(__intermediate_output.begin(),
-							__intermediate_output.begin() + __error_written_count);
-						ranges::__rng_detail::__container_insert_bulk(__output, __error_intermediate_output);
+						__storage._M_commit(static_cast<std::size_t>(
+							__error_result.output.data() - __intermediate_output.data()));
 						__error_count += __error_result.error_count;
 						__pivot_error_count += __error_result.pivot_error_count;
 						if (__error_result.error_code != encoding_error::ok) {
@@ -607,11 +623,8 @@ namespace ztd { namespace text {
 							          __to_state, __result.error_code, __result.error_count),
 							     __to_error_handler, __to_progress_handler._M_code_points_progress(),
 							     __to_progress_handler._M_code_units_progress());
-						::std::size_t __error_written_count
-							= __error_result.output.data() - __intermediate_output.data();
-						_IntermediateOutput __error_intermediate_output(__intermediate_output.begin(),
-							__intermediate_output.begin() + __error_written_count);
-						ranges::__rng_detail::__container_insert_bulk(__output, __error_intermediate_output);
+						__storage._M_commit(static_cast<std::size_t>(
+							__error_result.output.data() - __intermediate_output.data()));
 						__error_count += __error_result.error_count;
 						__pivot_error_count += __error_result.pivot_error_count;
 						if (__error_result.error_code != encoding_error::ok) {
@@ -639,18 +652,40 @@ namespace ztd { namespace text {
 			}
 		}
 
-		template <bool _OutputOnly, bool _NoState, typename _OutputContainer, typename _Input, typename _FromEncoding,
-			typename _ToEncoding, typename _FromErrorHandler, typename _ToErrorHandler, typename _FromState,
-			typename _ToState, typename _Pivot>
-		constexpr auto __transcode_dispatch(_Input&& __input, _FromEncoding&& __from_encoding,
-			_ToEncoding&& __to_encoding, _FromErrorHandler&& __from_error_handler,
+		template <bool _OutputOnly, bool _NoState, typename _OutputContainer, typename _SizingPolicy,
+			typename _Input, typename _FromEncoding, typename _ToEncoding, typename _FromErrorHandler,
+			typename _ToErrorHandler, typename _FromState, typename _ToState, typename _Pivot>
+		constexpr auto __transcode_dispatch(const _SizingPolicy& __sizing, _Input&& __input,
+			_FromEncoding&& __from_encoding, _ToEncoding&& __to_encoding, _FromErrorHandler&& __from_error_handler,
 			_ToErrorHandler&& __to_error_handler, _FromState& __from_state, _ToState& __to_state, _Pivot&& __pivot) {
+			using _UFromEncoding = remove_cvref_t<_FromEncoding>;
+			using _UToEncoding   = remove_cvref_t<_ToEncoding>;
+			using _SizingKey     = ::ztd::tag<_UFromEncoding, _UToEncoding>;
 
 			_OutputContainer __output {};
-			if constexpr (is_detected_v<ranges::detect_adl_size, _Input>) {
-				using _SizeType = decltype(::ztd::ranges::size(__input));
-				if constexpr (is_detected_v<ranges::detect_reserve_with_size, _OutputContainer, _SizeType>) {
-					_SizeType __output_size_hint = static_cast<_SizeType>(::ztd::ranges::size(__input));
+			const ::std::size_t __input_size = __txt_detail::__output_sizing_input_size(__input);
+			if constexpr (is_detected_v<ranges::detect_reserve_with_size, _OutputContainer, ::std::size_t>) {
+				const ::std::size_t __output_size_hint = __txt_detail::__output_size_hint<_SizingKey>(__sizing,
+					__input_size, __input_size,
+					__input_size * max_code_points_v<_UFromEncoding> * max_code_units_v<_UToEncoding>,
+					max_transcode_code_units_v<_UFromEncoding, _UToEncoding> * 2,
+					[&](::std::size_t __fallback_size) -> ::std::size_t {
+						using _UInput = remove_cvref_t<_Input>;
+						if constexpr (!ranges::is_range_input_or_output_range_exactly_v<_UInput> // cf
+							&& ::std::is_copy_constructible_v<_FromState>                     // cf
+							&& ::std::is_copy_constructible_v<_ToState>) {
+							remove_cvref_t<_FromState> __count_from_state = __from_state;
+							remove_cvref_t<_ToState> __count_to_state     = __to_state;
+							auto __count_result = ::ztd::text::count_as_transcoded(__input, __from_encoding,
+								__to_encoding, __from_error_handler, __to_error_handler, __count_from_state,
+								__count_to_state, __pivot);
+							return __count_result.count;
+						}
+						else {
+							return __fallback_size;
+						}
+					});
+				if (__output_size_hint != 0) {
 					__output.reserve(__output_size_hint);
 				}
 			}
@@ -658,6 +693,8 @@ namespace ztd { namespace text {
 				::std::forward<_Input>(__input), ::std::forward<_FromEncoding>(__from_encoding), __output,
 				::std::forward<_ToEncoding>(__to_encoding), ::std::forward<_FromErrorHandler>(__from_error_handler),
 				::std::forward<_ToErrorHandler>(__to_error_handler), __from_state, __to_state, __pivot);
+			__txt_detail::__record_output_size<_SizingKey>(
+				__sizing, __input_size, __txt_detail::__output_sizing_input_size(__output));
 			if constexpr (_OutputOnly) {
 				(void)__stateful_result;
 				return __output;
@@ -671,6 +708,19 @@ namespace ztd { namespace text {
 					::std::move(__stateful_result), ::std::move(__output));
 			}
 		}
+
+		template <bool _OutputOnly, bool _NoState, typename _OutputContainer, typename _Input, typename _FromEncoding,
+			typename _ToEncoding, typename _FromErrorHandler, typename _ToErrorHandler, typename _FromState,
+			typename _ToState, typename _Pivot>
+		constexpr auto __transcode_dispatch(_Input&& __input, _FromEncoding&& __from_encoding,
+			_ToEncoding&& __to_encoding, _FromErrorHandler&& __from_error_handler,
+			_ToErrorHandler&& __to_error_handler, _FromState& __from_state, _ToState& __to_state, _Pivot&& __pivot) {
+			return __txt_detail::__transcode_dispatch<_OutputOnly, _NoState, _OutputContainer>(default_output_sizing,
+				::std::forward<_Input>(__input), ::std::forward<_FromEncoding>(__from_encoding),
+				::std::forward<_ToEncoding>(__to_encoding), ::std::forward<_FromErrorHandler>(__from_error_handler),
+				::std::forward<_ToErrorHandler>(__to_error_handler), __from_state, __to_state,
+				::std::forward<_Pivot>(__pivot));
+		}
 	} // namespace __txt_detail
 
 	//////
@@ -943,11 +993,15 @@ namespace ztd { namespace text {
 	//////
 	/// @brief Converts the code units of the given input view through the from encoding to code units of the to
 	/// encoding for the output, which is then returned in a result structure with additional information about
-	/// success.
+	/// success. Room is reserved in the output according to the given sizing policy.
 	///
 	/// @tparam _OutputContainer The container to default-construct and serialize data into. Typically, a @c
 	/// std::basic_string or a `std::vector` of some sort.
 	///
+	/// @param[in]     __sizing The output sizing policy (ztd::text::exact_output_sizing,
+	/// ztd::text::upper_bound_output_sizing, ztd::text::adaptive_output_sizing, a
+	/// ztd::text::user_hint_output_sizing_t, or ztd::text::default_output_sizing) that decides how much to reserve
+	/// in the container before transcoding.
 	/// @param[in]     __input An input_view to read code units from and use in the decode operation that will
 	/// produce intermediate code points.
 	/// @param[in]     __from_encoding The encoding that will be used to decode the input's code units into
@@ -963,14 +1017,16 @@ namespace ztd { namespace text {
 	/// user.
 	///
 	/// @returns A ztd::text::transcode_result object that contains references to `__from_state` and @p
-	/// __to_state and an `output` parameter that contains the `_OutputContainer` specified. If the container has a
-	/// `container.reserve` function, it is and some multiple of the input's size is used to pre-size the container,
-	/// to aid with `push_back` / `insert` reallocation pains.
-	template <typename _OutputContainer = void, typename _Input, typename _FromEncoding, typename _ToEncoding,
-		typename _FromErrorHandler, typename _ToErrorHandler, typename _FromState, typename _ToState, typename _Pivot>
-	constexpr auto transcode_to(_Input&& __input, _FromEncoding&& __from_encoding, _ToEncoding&& __to_encoding,
-		_FromErrorHandler&& __from_error_handler, _ToErrorHandler&& __to_error_handler, _FromState& __from_state,
-		_ToState& __to_state, _Pivot&& __pivot) {
+	/// __to_state and an `output` parameter that contains the `_OutputContainer` specified.
+	///
+	/// @remarks The reservation only happens if the container has a `reserve` member function.
+	template <typename _OutputContainer = void, typename _SizingPolicy, typename _Input, typename _FromEncoding,
+		typename _ToEncoding, typename _FromErrorHandler, typename _ToErrorHandler, typename _FromState,
+		typename _ToState, typename _Pivot,
+		::std::enable_if_t<is_output_sizing_policy_v<remove_cvref_t<_SizingPolicy>>>* = nullptr>
+	constexpr auto transcode_to(_SizingPolicy&& __sizing, _Input&& __input, _FromEncoding&& __from_encoding,
+		_ToEncoding&& __to_encoding, _FromErrorHandler&& __from_error_handler, _ToErrorHandler&& __to_error_handler,
+		_FromState& __from_state, _ToState& __to_state, _Pivot&& __pivot) {
 		using _UToEncoding              = remove_cvref_t<_ToEncoding>;
 		using _UOutputContainer         = remove_cvref_t<_OutputContainer>;
 		using _OutputCodeUnit           = code_unit_t<_UToEncoding>;
@@ -980,7 +1036,7 @@ namespace ztd { namespace text {
 		if constexpr (_IsVoidContainer && _IsStringable) {
 			// prevent instantiation errors with basic_string by boxing it inside of an "if constexpr"
 			using _RealOutputContainer = ::std::basic_string<_OutputCodeUnit>;
-			return __txt_detail::__transcode_dispatch<false, false, _RealOutputContainer>(
+			return __txt_detail::__transcode_dispatch<false, false, _RealOutputContainer>(__sizing,
 				::std::forward<_Input>(__input), ::std::forward<_FromEncoding>(__from_encoding),
 				::std::forward<_ToEncoding>(__to_encoding), ::std::forward<_FromErrorHandler>(__from_error_handler),
 				::std::forward<_ToErrorHandler>(__to_error_handler), __from_state, __to_state, __pivot);
@@ -988,13 +1044,208 @@ namespace ztd { namespace text {
 		else {
 			using _RealOutputContainer
 				= ::std::conditional_t<_IsVoidContainer, ::std::vector<_OutputCodeUnit>, _OutputContainer>;
-			return __txt_detail::__transcode_dispatch<false, false, _RealOutputContainer>(
+			return __txt_detail::__transcode_dispatch<false, false, _RealOutputContainer>(__sizing,
 				::std::forward<_Input>(__input), ::std::forward<_FromEncoding>(__from_encoding),
 				::std::forward<_ToEncoding>(__to_encoding), ::std::forward<_FromErrorHandler>(__from_error_handler),
 				::std::forward<_ToErrorHandler>(__to_error_handler), __from_state, __to_state, __pivot);
 		}
 	}
 
+	//////
+	/// @brief Converts the code units of the given input view through the from encoding to code units of the to
+	/// encoding for the output, which is then returned in a result structure with additional information about
+	/// success. Room is reserved in the output according to the given sizing policy.
+	///
+	/// @tparam _OutputContainer The container to default-construct and serialize data into. Typically, a @c
+	/// std::basic_string or a `std::vector` of some sort.
+	///
+	/// @param[in]     __sizing The output sizing policy that decides how much to reserve in the container before
+	/// transcoding.
+	/// @param[in]     __input An input_view to read code units from and use in the decode operation that will
+	/// produce intermediate code points.
+	/// @param[in]     __from_encoding The encoding that will be used to decode the input's code units into
+	/// intermediate code points.
+	/// @param[in]     __to_encoding The encoding that will be used to encode the intermediate code points into the
+	/// final code units.
+	/// @param[in]     __from_error_handler The error handler for the `__from_encoding` 's decode step.
+	/// @param[in]     __to_error_handler The error handler for the `__to_encoding` 's encode step.
+	/// @param[in,out] __from_state A reference to the associated state for the `__from_encoding` 's decode step.
+	/// @param[in,out] __to_state A reference to the associated state for the `__to_encoding` 's encode step.
+	///
+	/// @returns A ztd::text::pivotless_transcode_result object that contains references to `__from_state` and @p
+	/// __to_state and an `output` parameter that contains the `_OutputContainer` specified.
+	template <typename _OutputContainer = void, typename _SizingPolicy, typename _Input, typename _FromEncoding,
+		typename _ToEncoding, typename _FromErrorHandler, typename _ToErrorHandler, typename _FromState,
+		typename _ToState, ::std::enable_if_t<is_output_sizing_policy_v<remove_cvref_t<_SizingPolicy>>>* = nullptr>
+	constexpr auto transcode_to(_SizingPolicy&& __sizing, _Input&& __input, _FromEncoding&& __from_encoding,
+		_ToEncoding&& __to_encoding, _FromErrorHandler&& __from_error_handler, _ToErrorHandler&& __to_error_handler,
+		_FromState& __from_state, _ToState& __to_state) {
+		using _UFromEncoding = ::ztd::remove_cvref_t<_FromEncoding>;
+		using _CodePoint     = code_point_t<_UFromEncoding>;
+		using _PivotRange    = ::ztd::ranges::subrange<_CodePoint*>;
+
+		constexpr ::std::size_t __pivot_buffer_buffer_max
+			= ZTD_TEXT_INTERMEDIATE_TRANSCODE_BUFFER_SIZE_I_(code_point_t<_UFromEncoding>)
+			     < max_code_points_v<_UFromEncoding>
+			? max_code_points_v<_UFromEncoding>
+			: ZTD_TEXT_INTERMEDIATE_TRANSCODE_BUFFER_SIZE_I_(code_point_t<_UFromEncoding>);
+
+		_CodePoint __pivot_buffer[__pivot_buffer_buffer_max] {};
+		_PivotRange __pivot(__pivot_buffer);
+		return ::ztd::text::transcode_to<_OutputContainer>(__sizing, ::std::forward<_Input>(__input),
+			::std::forward<_FromEncoding>(__from_encoding), ::std::forward<_ToEncoding>(__to_encoding),
+			::std::forward<_FromErrorHandler>(__from_error_handler),
+			::std::forward<_ToErrorHandler>(__to_error_handler), __from_state, __to_state, __pivot);
+	}
+
+	//////
+	/// @brief Converts the code units of the given input view through the from encoding to code units of the to
+	/// encoding for the output, which is then returned in a result structure with additional information about
+	/// success. Room is reserved in the output according to the given sizing policy.
+	///
+	/// @tparam _OutputContainer The container to default-construct and serialize data into. Typically, a @c
+	/// std::basic_string or a `std::vector` of some sort.
+	///
+	/// @param[in]     __sizing The output sizing policy that decides how much to reserve in the container before
+	/// transcoding.
+	/// @param[in]     __input An input_view to read code units from and use in the decode operation that will
+	/// produce intermediate code points.
+	/// @param[in]     __from_encoding The encoding that will be used to decode the input's code units into
+	/// intermediate code points.
+	/// @param[in]     __to_encoding The encoding that will be used to encode the intermediate code points into the
+	/// final code units.
+	/// @param[in]     __from_error_handler The error handler for the `__from_encoding` 's decode step.
+	/// @param[in]     __to_error_handler The error handler for the `__to_encoding` 's encode step.
+	///
+	/// @returns A ztd::text::stateless_transcode_result object that contains references to an `container.output`
+	/// parameter that contains the `_OutputContainer` specified.
+	///
+	/// @remarks The states for both steps are created using ztd::text::make_decode_state and
+	/// ztd::text::make_encode_state.
+	template <typename _OutputContainer = void, typename _SizingPolicy, typename _Input, typename _FromEncoding,
+		typename _ToEncoding, typename _FromErrorHandler, typename _ToErrorHandler,
+		::std::enable_if_t<is_output_sizing_policy_v<remove_cvref_t<_SizingPolicy>>>* = nullptr>
+	constexpr auto transcode_to(_SizingPolicy&& __sizing, _Input&& __input, _FromEncoding&& __from_encoding,
+		_ToEncoding&& __to_encoding, _FromErrorHandler&& __from_error_handler, _ToErrorHandler&& __to_error_handler) {
+		using _UFromEncoding = remove_cvref_t<_FromEncoding>;
+		using _UToEncoding   = remove_cvref_t<_ToEncoding>;
+		using _FromState     = decode_state_t<_UFromEncoding>;
+		using _ToState       = encode_state_t<_UToEncoding>;
+
+		_FromState __from_state = ::ztd::text::make_decode_state(__from_encoding);
+		_ToState __to_state     = ::ztd::text::make_encode_state(__to_encoding);
+
+		return ::ztd::text::transcode_to<_OutputContainer>(__sizing, ::std::forward<_Input>(__input),
+			::std::forward<_FromEncoding>(__from_encoding), ::std::forward<_ToEncoding>(__to_encoding),
+			::std::forward<_FromErrorHandler>(__from_error_handler),
+			::std::forward<_ToErrorHandler>(__to_error_handler), __from_state, __to_state);
+	}
+
+	//////
+	/// @brief Converts the code units of the given input view through the from encoding to code units of the to
+	/// encoding for the output, which is then returned in a result structure with additional information about
+	/// success. Room is reserved in the output according to the given sizing policy.
+	///
+	/// @tparam _OutputContainer The container to default-construct and serialize data into. Typically, a @c
+	/// std::basic_string or a `std::vector` of some sort.
+	///
+	/// @param[in]     __sizing The output sizing policy that decides how much to reserve in the container before
+	/// transcoding.
+	/// @param[in]     __input An input_view to read code units from and use in the decode operation that will
+	/// produce intermediate code points.
+	/// @param[in]     __from_encoding The encoding that will be used to decode the input's code units into
+	/// intermediate code points.
+	/// @param[in]     __to_encoding The encoding that will be used to encode the intermediate code points into the
+	/// final code units.
+	/// @param[in]     __from_error_handler The error handler for the `__from_encoding` 's decode step.
+	///
+	/// @returns A ztd::text::stateless_transcode_result object that contains references to an `container.output`
+	/// parameter that contains the `_OutputContainer` specified.
+	///
+	/// @remarks A `to_error_handler` for the encode step of the operation is created using default construction of a
+	/// ztd::text::default_handler_t that is marked as careless.
+	template <typename _OutputContainer = void, typename _SizingPolicy, typename _Input, typename _FromEncoding,
+		typename _ToEncoding, typename _FromErrorHandler,
+		::std::enable_if_t<is_output_sizing_policy_v<remove_cvref_t<_SizingPolicy>>>* = nullptr>
+	constexpr auto transcode_to(_SizingPolicy&& __sizing, _Input&& __input, _FromEncoding&& __from_encoding,
+		_ToEncoding&& __to_encoding, _FromErrorHandler&& __from_error_handler) {
+		auto __handler = __txt_detail::__duplicate_or_be_careless(__from_error_handler);
+
+		return ::ztd::text::transcode_to<_OutputContainer>(__sizing, ::std::forward<_Input>(__input),
+			::std::forward<_FromEncoding>(__from_encoding), ::std::forward<_ToEncoding>(__to_encoding),
+			::std::forward<_FromErrorHandler>(__from_error_handler), __handler);
+	}
+
+	//////
+	/// @brief Converts the code units of the given input view through the from encoding to code units of the to
+	/// encoding for the output, which is then returned in a result structure with additional information about
+	/// success. Room is reserved in the output according to the given sizing policy.
+	///
+	/// @tparam _OutputContainer The container to default-construct and serialize data into. Typically, a @c
+	/// std::basic_string or a `std::vector` of some sort.
+	///
+	/// @param[in]     __sizing The output sizing policy that decides how much to reserve in the container before
+	/// transcoding.
+	/// @param[in]     __input An input_view to read code units from and use in the decode operation that will
+	/// produce intermediate code points.
+	/// @param[in]     __from_encoding The encoding that will be used to decode the input's code units into
+	/// intermediate code points.
+	/// @param[in]     __to_encoding The encoding that will be used to encode the intermediate code points into the
+	/// final code units.
+	///
+	/// @returns A ztd::text::stateless_transcode_result object that contains references to an `container.output`
+	/// parameter that contains the `_OutputContainer` specified.
+	///
+	/// @remarks A `from_error_handler` for the decode step of the operation is created using default construction of
+	/// a ztd::text::default_handler_t that is marked as careless.
+	template <typename _OutputContainer = void, typename _SizingPolicy, typename _Input, typename _FromEncoding,
+		typename _ToEncoding, ::std::enable_if_t<is_output_sizing_policy_v<remove_cvref_t<_SizingPolicy>>>* = nullptr>
+	constexpr auto transcode_to(
+		_SizingPolicy&& __sizing, _Input&& __input, _FromEncoding&& __from_encoding, _ToEncoding&& __to_encoding) {
+		default_handler_t __handler {};
+		return ::ztd::text::transcode_to<_OutputContainer>(__sizing, ::std::forward<_Input>(__input),
+			::std::forward<_FromEncoding>(__from_encoding), ::std::forward<_ToEncoding>(__to_encoding), __handler);
+	}
+
+	//////
+	/// @brief Converts the code units of the given input view through the from encoding to code units of the to
+	/// encoding for the output, which is then returned in a result structure with additional information about
+	/// success.
+	///
+	/// @tparam _OutputContainer The container to default-construct and serialize data into. Typically, a @c
+	/// std::basic_string or a `std::vector` of some sort.
+	///
+	/// @param[in]     __input An input_view to read code units from and use in the decode operation that will
+	/// produce intermediate code points.
+	/// @param[in]     __from_encoding The encoding that will be used to decode the input's code units into
+	/// intermediate code points.
+	/// @param[in]     __to_encoding The encoding that will be used to encode the intermediate code points into the
+	/// final code units.
+	/// @param[in]     __from_error_handler The error handler for the `__from_encoding` 's decode step.
+	/// @param[in]     __to_error_handler The error handler for the `__to_encoding` 's encode step.
+	/// @param[in,out] __from_state A reference to the associated state for the `__from_encoding` 's decode step.
+	/// @param[in,out] __to_state A reference to the associated state for the `__to_encoding` 's encode step.
+	/// @param[in, out] __pivot A reference to a descriptor of a (potentially usable) range as the intermediate pivot,
+	/// usually a range of contiguous data from a span provided by the implementation but can be passed in here by the
+	/// user.
+	///
+	/// @returns A ztd::text::transcode_result object that contains references to `__from_state` and @p
+	/// __to_state and an `output` parameter that contains the `_OutputContainer` specified. If the container has a
+	/// `container.reserve` function, it is and some multiple of the input's size is used to pre-size the container,
+	/// to aid with `push_back` / `insert` reallocation pains (see ztd::text::default_output_sizing).
+	template <typename _OutputContainer = void, typename _Input, typename _FromEncoding, typename _ToEncoding,
+		typename _FromErrorHandler, typename _ToErrorHandler, typename _FromState, typename _ToState, typename _Pivot,
+		::std::enable_if_t<!is_output_sizing_policy_v<remove_cvref_t<_Input>>>* = nullptr>
+	constexpr auto transcode_to(_Input&& __input, _FromEncoding&& __from_encoding, _ToEncoding&& __to_encoding,
+		_FromErrorHandler&& __from_error_handler, _ToErrorHandler&& __to_error_handler, _FromState& __from_state,
+		_ToState& __to_state, _Pivot&& __pivot) {
+		return ::ztd::text::transcode_to<_OutputContainer>(default_output_sizing, ::std::forward<_Input>(__input),
+			::std::forward<_FromEncoding>(__from_encoding), ::std::forward<_ToEncoding>(__to_encoding),
+			::std::forward<_FromErrorHandler>(__from_error_handler),
+			::std::forward<_ToErrorHandler>(__to_error_handler), __from_state, __to_state,
+			::std::forward<_Pivot>(__pivot));
+	}
+
 	//////
 	/// @brief Converts the code units of the given input view through the from encoding to code units of the to
 	/// encoding for the output, which is then returned in a result structure with additional information about
@@ -1066,7 +1317,8 @@ namespace ztd { namespace text {
 	/// return type is stateless since both states must be passed in. If you want to have access to the states, create
 	/// both of them yourself and pass them into a lower-level function that accepts those parameters.
 	template <typename _OutputContainer = void, typename _Input, typename _FromEncoding, typename _ToEncoding,
-		typename _FromErrorHandler, typename _ToErrorHandler, typename _FromState>
+		typename _FromErrorHandler, typename _ToErrorHandler, typename _FromState,
+		::std::enable_if_t<!is_output_sizing_policy_v<remove_cvref_t<_Input>>>* = nullptr>
 	constexpr auto transcode_to(_Input&& __input, _FromEncoding&& __from_encoding, _ToEncoding&& __to_encoding,
 		_FromErrorHandler&& __from_error_handler, _ToErrorHandler&& __to_error_handler, _FromState& __from_state) {
 		using _UToEncoding = remove_cvref_t<_ToEncoding>;
@@ -1104,7 +1356,8 @@ namespace ztd { namespace text {
 	/// return type is stateless since both states must be passed in. If you want to have access to the states, create
 	/// both of them yourself and pass them into a lower-level function that accepts those parameters.
 	template <typename _OutputContainer = void, typename _Input, typename _FromEncoding, typename _ToEncoding,
-		typename _FromErrorHandler, typename _ToErrorHandler>
+		typename _FromErrorHandler, typename _ToErrorHandler,
+		::std::enable_if_t<!is_output_sizing_policy_v<remove_cvref_t<_Input>>>* = nullptr>
 	constexpr auto transcode_to(_Input&& __input, _FromEncoding&& __from_encoding, _ToEncoding&& __to_encoding,
 		_FromErrorHandler&& __from_error_handler, _ToErrorHandler&& __to_error_handler) {
 		using _UFromEncoding = remove_cvref_t<_FromEncoding>;
@@ -1142,7 +1395,7 @@ namespace ztd { namespace text {
 	/// passed in. If you want to have access to the states, create both of them yourself and pass them into a
 	/// lower-level function that accepts those parameters.
 	template <typename _OutputContainer = void, typename _Input, typename _FromEncoding, typename _ToEncoding,
-		typename _FromErrorHandler>
+		typename _FromErrorHandler, ::std::enable_if_t<!is_output_sizing_policy_v<remove_cvref_t<_Input>>>* = nullptr>
 	constexpr auto transcode_to(_Input&& __input, _FromEncoding&& __from_encoding, _ToEncoding&& __to_encoding,
 		_FromErrorHandler&& __from_error_handler) {
 		auto __handler = __txt_detail::__duplicate_or_be_careless(__from_error_handler);
@@ -315,6 +315,7 @@ namespace ztd { namespace text {
 					}
 				}
 
+				::ztd::ranges::iter_advance(__in_it);
 				if constexpr (__call_error_handler) {
 					if (__in_it == __in_last) {
 						__self_t __self {};
@@ -322,11 +323,9 @@ namespace ztd { namespace text {
 							_Result(_SubInput(::std::move(__in_it), ::std::move(__in_last)),
 							     _SubOutput(::std::move(__out_it), ::std::move(__out_last)), __s,
 							     encoding_error::incomplete_sequence),
-							::ztd::span<code_unit>(), ::ztd::span<code_point>());
+							::ztd::span<code_unit>(__units.data(), 1), ::ztd::span<code_point>());
 					}
 				}
-
-				::ztd::ranges::iter_advance(__in_it);
 				const char16_t __trail16 = static_cast<char16_t>(*__in_it);
 				__units[1]               = static_cast<code_unit>(__trail16);
 				if constexpr (__surrogates_allowed) {
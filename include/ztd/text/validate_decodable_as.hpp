@@ -45,6 +45,8 @@
 #include <ztd/text/transcode_one.hpp>
 #include <ztd/text/detail/is_lossless.hpp>
 #include <ztd/text/detail/encoding_range.hpp>
+#include <ztd/text/detail/segmented_range.hpp>
+#include <ztd/text/detail/validate_unicode_kernels.hpp>
 #include <ztd/text/char_predicates.hpp>
 
 #include <ztd/idk/span.hpp>
@@ -234,6 +236,10 @@ namespace ztd { namespace text {
 			return text_validate_decodable_as(::ztd::tag<remove_cvref_t<_Encoding>> {},
 				::std::forward<_Input>(__input), ::std::forward<_Encoding>(__encoding), __decode_state);
 		}
+		else if constexpr (__txt_detail::__is_segmentable_v<_Input, _DecodeState, _EncodeState>) {
+			return __txt_detail::__segmented_validate_decodable_as(::std::forward<_Input>(__input),
+				::std::forward<_Encoding>(__encoding), __decode_state, __encode_state);
+		}
 		else if constexpr (is_detected_v<__txt_detail::__detect_adl_internal_text_validate_decodable_as, _Input,
 			                   _Encoding, _DecodeState>) {
 			return __text_validate_decodable_as(::ztd::tag<remove_cvref_t<_Encoding>> {},
@@ -45,6 +45,7 @@
 #include <ztd/text/recode_one.hpp>
 #include <ztd/text/detail/is_lossless.hpp>
 #include <ztd/text/detail/encoding_range.hpp>
+#include <ztd/text/detail/segmented_range.hpp>
 #include <ztd/text/char_predicates.hpp>
 
 #include <ztd/ranges/adl.hpp>
@@ -261,6 +262,10 @@ namespace ztd { namespace text {
 			return text_validate_encodable_as(::ztd::tag<remove_cvref_t<_Encoding>> {},
 				::std::forward<_Input>(__input), ::std::forward<_Encoding>(__encoding), __encode_state);
 		}
+		else if constexpr (__txt_detail::__is_segmentable_v<_Input, _EncodeState, _DecodeState>) {
+			return __txt_detail::__segmented_validate_encodable_as(::std::forward<_Input>(__input),
+				::std::forward<_Encoding>(__encoding), __encode_state, __decode_state);
+		}
 		else if constexpr (is_detected_v<__txt_detail::__detect_adl_internal_text_validate_encodable_as, _Input,
 			                   _Encoding, _EncodeState>) {
 			(void)__decode_state;
@@ -44,6 +44,7 @@
 #include <ztd/text/transcode_one.hpp>
 #include <ztd/text/detail/is_lossless.hpp>
 #include <ztd/text/detail/encoding_range.hpp>
+#include <ztd/text/detail/segmented_range.hpp>
 
 #include <ztd/idk/span.hpp>
 #include <ztd/idk/type_traits.hpp>
@@ -210,6 +211,11 @@ namespace ztd { namespace text {
 				::std::forward<_Input>(__input), ::std::forward<_FromEncoding>(__from_encoding),
 				::std::forward<_ToEncoding>(__to_encoding), __decode_state, __encode_state, __pivot);
 		}
+		else if constexpr (__txt_detail::__is_segmentable_v<_Input, _DecodeState, _EncodeState>) {
+			return __txt_detail::__segmented_validate_transcodable_as(::std::forward<_Input>(__input),
+				::std::forward<_FromEncoding>(__from_encoding), ::std::forward<_ToEncoding>(__to_encoding),
+				__decode_state, __encode_state, __pivot);
+		}
 		else if constexpr (is_detected_v<__txt_detail::__detect_adl_internal_text_validate_transcodable_as, _Input,
 			                   _FromEncoding, _ToEncoding, _DecodeState, _EncodeState, _Pivot>) {
 			(void)__encode_state;
@@ -117,6 +117,32 @@
 
 #define ZTD_TEXT_PIVOT_RECODE_BUFFER_SIZE_I_(...) (ZTD_TEXT_PIVOT_RECODE_BUFFER_BYTE_SIZE_I_ / sizeof(__VA_ARGS__))
 
+#if defined(ZTD_TEXT_CHUNKED_VIEW_BUFFER_BYTE_SIZE)
+	#define ZTD_TEXT_CHUNKED_VIEW_BUFFER_BYTE_SIZE_I_ ZTD_TEXT_CHUNKED_VIEW_BUFFER_BYTE_SIZE
+#else
+	#define ZTD_TEXT_CHUNKED_VIEW_BUFFER_BYTE_SIZE_I_ 1024
+#endif // Chunked view buffer sizing
+
+#define ZTD_TEXT_CHUNKED_VIEW_BUFFER_SIZE_I_(...) (ZTD_TEXT_CHUNKED_VIEW_BUFFER_BYTE_SIZE_I_ / sizeof(__VA_ARGS__))
+
+#if defined(ZTD_TEXT_PARALLEL_TRANSCODE_MINIMUM_CHUNK_SIZE)
+	#define ZTD_TEXT_PARALLEL_TRANSCODE_MINIMUM_CHUNK_SIZE_I_ ZTD_TEXT_PARALLEL_TRANSCODE_MINIMUM_CHUNK_SIZE
+#else
+	#define ZTD_TEXT_PARALLEL_TRANSCODE_MINIMUM_CHUNK_SIZE_I_ (1024 * 1024)
+#endif // Parallel transcode splitting threshold
+
+#if defined(ZTD_TEXT_ICONV_DESCRIPTOR_CACHE_SIZE)
+	#define ZTD_TEXT_ICONV_DESCRIPTOR_CACHE_SIZE_I_ ZTD_TEXT_ICONV_DESCRIPTOR_CACHE_SIZE
+#else
+	#define ZTD_TEXT_ICONV_DESCRIPTOR_CACHE_SIZE_I_ 16
+#endif // iconv descriptors kept open per conversion
+
+#if defined(ZTD_TEXT_ANY_ENCODING_INLINE_STORAGE_SIZE)
+	#define ZTD_TEXT_ANY_ENCODING_INLINE_STORAGE_SIZE_I_ ZTD_TEXT_ANY_ENCODING_INLINE_STORAGE_SIZE
+#else
+	#define ZTD_TEXT_ANY_ENCODING_INLINE_STORAGE_SIZE_I_ 48
+#endif // bytes kept inside any_encoding objects and their states for the erased encoding/state
+
 
 #if defined(ZTD_TEXT_YES_PLEASE_DESTROY_MY_LITERALS_UTTERLY_I_MEAN_IT)
 	#if (ZTD_TEXT_YES_PLEASE_DESTROY_MY_LITERALS_UTTERLY_I_MEAN_IT != 0)
@@ -178,6 +204,16 @@
 	#define ZTD_TEXT_UNICODE_SCALAR_VALUE_INVARIANT_ABORT_I_ ZTD_OFF
 #endif
 
+#if defined(ZTD_TEXT_SIMD)
+	#if (ZTD_TEXT_SIMD != 0)
+		#define ZTD_TEXT_SIMD_I_ ZTD_ON
+	#else
+		#define ZTD_TEXT_SIMD_I_ ZTD_OFF
+	#endif
+#else
+	#define ZTD_TEXT_SIMD_I_ ZTD_DEFAULT_ON
+#endif
+
 #if defined(ZTD_TEXT_ABI_NAMESPACE)
 	#define ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_ inline namespace ZTD_TEXT_ABI_NAMESPACE {
 	#define ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_ }
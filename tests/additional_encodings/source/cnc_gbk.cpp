@@ -0,0 +1,101 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#include <ztd/text/cuneicode_encoding.hpp>
+#include <ztd/text/decode.hpp>
+#include <ztd/text/encode.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <ztd/idk/size.hpp>
+#include <ztd/idk/span.hpp>
+
+#include <string>
+#include <string_view>
+
+TEST_CASE("text/additional_encodings/cnc_gbk", "bulk decode and encode of GBK text through cuneicode") {
+	constexpr const unsigned char original_data[] = { 0x47, 0x42, 0x31, 0x38, 0x30, 0x33, 0x30, 0x20, 0xB7, 0xFB, 0xBA,
+		0xCF, 0xD0, 0xD4, 0xCE, 0xCA, 0xD3, 0xEB, 0xB4, 0xF0, 0x20, 0xA1, 0xAA, 0x20, 0xD0, 0xC7, 0xD0, 0xC7, 0xD6,
+		0xAE, 0xBB, 0xF0, 0xA3, 0xAC, 0xBF, 0xC9, 0xD2, 0xD4, 0xC1, 0xC7, 0xD4, 0xAD, 0xA1, 0xA3 };
+	constexpr const char32_t expected_data[]      = { 0x00000047, 0x00000042, 0x00000031, 0x00000038, 0x00000030,
+		     0x00000033, 0x00000030, 0x00000020, 0x00007b26, 0x00005408, 0x00006027, 0x000095ee, 0x00004e0e, 0x00007b54,
+		     0x00000020, 0x00002014, 0x00000020, 0x0000661f, 0x0000661f, 0x00004e4b, 0x0000706b, 0x0000ff0c, 0x000053ef,
+		     0x00004ee5, 0x000071ce, 0x0000539f, 0x00003002 };
+
+	std::string_view original(reinterpret_cast<const char*>(original_data + 0), ztdc_c_array_size(original_data));
+	std::u32string_view expected(expected_data + 0, ztdc_c_array_size(expected_data));
+
+	SECTION("decode") {
+		char32_t decoded_data[ztdc_c_array_size(expected_data)] = {};
+		ztd::span<char32_t> decoded_output(decoded_data);
+		auto decoded_result
+			= ztd::text::decode_into_raw(original, ztd::text::cnc_gbk, decoded_output, ztd::text::pass_handler);
+		REQUIRE(decoded_result.error_code == ztd::text::encoding_error::ok);
+		REQUIRE_FALSE(decoded_result.errors_were_handled());
+		REQUIRE(ztd::ranges::empty(decoded_result.input));
+		REQUIRE(ztd::ranges::empty(decoded_result.output));
+		REQUIRE(std::u32string_view(decoded_data, ztdc_c_array_size(decoded_data)) == expected);
+	}
+	SECTION("decode with an error in the middle") {
+		std::string broken(original);
+		broken.insert(broken.begin() + 8, '\xFF');
+		char32_t decoded_data[ztdc_c_array_size(expected_data) + 1] = {};
+		ztd::span<char32_t> decoded_output(decoded_data);
+		auto decoded_result = ztd::text::decode_into_raw(
+			broken, ztd::text::cnc_gbk, decoded_output, ztd::text::replacement_handler);
+		REQUIRE(decoded_result.error_code == ztd::text::encoding_error::ok);
+		REQUIRE(decoded_result.error_count == 1);
+		REQUIRE(ztd::ranges::empty(decoded_result.input));
+		std::u32string_view decoded(decoded_data, ztdc_c_array_size(decoded_data));
+		REQUIRE(decoded.substr(0, 8) == expected.substr(0, 8));
+		REQUIRE(decoded[8] == U'\uFFFD');
+		REQUIRE(decoded.substr(9) == expected.substr(8));
+	}
+	SECTION("decode into too small an output") {
+		char32_t decoded_data[5] = {};
+		ztd::span<char32_t> decoded_output(decoded_data);
+		auto decoded_result
+			= ztd::text::decode_into_raw(original, ztd::text::cnc_gbk, decoded_output, ztd::text::pass_handler);
+		REQUIRE(decoded_result.error_code == ztd::text::encoding_error::insufficient_output_space);
+		REQUIRE(ztd::ranges::size(decoded_result.input) == original.size() - 5);
+		REQUIRE(std::u32string_view(decoded_data, 5) == expected.substr(0, 5));
+	}
+	SECTION("encode") {
+		char encoded_data[ztdc_c_array_size(original_data)] = {};
+		ztd::span<char> encoded_output(encoded_data);
+		auto encoded_result
+			= ztd::text::encode_into_raw(expected, ztd::text::cnc_gbk, encoded_output, ztd::text::pass_handler);
+		REQUIRE(encoded_result.error_code == ztd::text::encoding_error::ok);
+		REQUIRE_FALSE(encoded_result.errors_were_handled());
+		REQUIRE(ztd::ranges::empty(encoded_result.input));
+		REQUIRE(ztd::ranges::empty(encoded_result.output));
+		REQUIRE(std::string_view(encoded_data, ztdc_c_array_size(encoded_data)) == original);
+	}
+}
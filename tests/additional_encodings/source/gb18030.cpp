@@ -34,8 +34,11 @@
 
 #include <ztd/idk/size.hpp>
 
+#include <cstdint>
 #include <fstream>
 #include <iostream>
+#include <optional>
+#include <string>
 #include <vector>
 
 TEST_CASE("text/additional_encodings/gb18030", "test a quick roundtrip using example GB18030 text to UTF-32") {
@@ -68,3 +71,71 @@ TEST_CASE("text/additional_encodings/gb18030", "test a quick roundtrip using exa
 	[[maybe_unused]] auto original_index = it.second - original.begin();
 	REQUIRE(encoded == original);
 }
+
+TEST_CASE("text/additional_encodings/gb18030/four_byte_ranges",
+     "check the cached four-byte range lookups and the bulk GB18030 loops against the original lookups") {
+	namespace txt_detail = ztd::text::__txt_detail;
+	SECTION("range lookups") {
+		txt_detail::__gb18030_range_cursor cursor = {};
+		for (std::size_t index = 0; index < 39420; ++index) {
+			const std::optional<std::uint_least32_t> expected = ztd::et::gb18030_ranges_index_to_code_point(index);
+			if (txt_detail::__gb18030_four_byte_code_point(index, cursor) != expected) {
+				CAPTURE(index);
+				REQUIRE(txt_detail::__gb18030_four_byte_code_point(index, cursor) == expected);
+			}
+		}
+		for (std::size_t index = 188990; index < 1237590; index += 1021) {
+			const std::optional<std::uint_least32_t> expected = ztd::et::gb18030_ranges_index_to_code_point(index);
+			CAPTURE(index);
+			REQUIRE(txt_detail::__gb18030_four_byte_code_point(index, cursor) == expected);
+		}
+		for (std::uint_least32_t code_point = 0x80; code_point < 0x110000; ++code_point) {
+			if (code_point > 0xFFFF && (code_point % 257) != 0) {
+				continue;
+			}
+			if (ztd::et::gb18030_code_point_to_index(code_point)) {
+				// only code points without a two-byte sequence ever reach the four-byte lookup
+				continue;
+			}
+			const std::optional<std::size_t> expected = ztd::et::gb18030_ranges_code_point_to_index(code_point);
+			if (txt_detail::__gb18030_four_byte_index(code_point, cursor) != expected) {
+				CAPTURE(code_point);
+				REQUIRE(txt_detail::__gb18030_four_byte_index(code_point, cursor) == expected);
+			}
+		}
+	}
+	SECTION("bulk conversions") {
+		std::u32string code_points;
+		for (char32_t code_point = 0x60; code_point < 0x3000; code_point += 3) {
+			code_points.push_back(code_point);
+		}
+		code_points += U"\u4E00\u4E8C\U0001F31F\U0001F320\uFFFF\U0010FFFF\u00A5\u00A5";
+		// bulk encode must match encoding them one at a time, including the replaced ones
+		std::string expected_encoded;
+		for (auto it = code_points.cbegin(); it != code_points.cend(); ++it) {
+			const auto one = ztd::text::encode_one(
+			     ztd::ranges::make_subrange(it, it + 1), ztd::text::gb18030, ztd::text::replacement_handler);
+			expected_encoded.append(one.cbegin(), one.cend());
+		}
+		std::string encoded = ztd::text::encode(code_points, ztd::text::gb18030, ztd::text::replacement_handler);
+		REQUIRE(encoded == expected_encoded);
+
+		// and decoding it back, with a few broken sequences mixed in, must match the one-at-a-time loop
+		std::string broken = encoded;
+		broken.insert(broken.size() / 2, "\x81\x30\xFF\x30\xFF");
+		broken += "\x84\x31";
+		std::u32string expected_decoded;
+		auto broken_input = ztd::ranges::make_subrange(broken.cbegin(), broken.cend());
+		while (!ztd::ranges::empty(broken_input)) {
+			char32_t buffer[ztd::text::max_code_points_v<ztd::text::basic_gb18030<char>>] {};
+			ztd::span<char32_t> buffer_view(buffer);
+			ztd::text::basic_gb18030<char>::state state {};
+			auto result = ztd::text::gb18030.decode_one(
+			     broken_input, buffer_view, ztd::text::replacement_handler, state);
+			expected_decoded.append(buffer_view.begin(), result.output.begin());
+			broken_input = ztd::ranges::make_subrange(result.input.begin(), result.input.end());
+		}
+		std::u32string decoded = ztd::text::decode(broken, ztd::text::gb18030, ztd::text::replacement_handler);
+		REQUIRE(decoded == expected_decoded);
+	}
+}
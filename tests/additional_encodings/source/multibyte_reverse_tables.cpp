@@ -0,0 +1,95 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#include <ztd/text.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+inline namespace ztd_text_tests_additional_encodings_multibyte_reverse_tables {
+	template <std::size_t IndexLimit, ztd::et::basic_lookup_index_to_code_point_function* LookupCodePoint,
+		ztd::et::basic_lookup_code_point_to_index_function* LookupIndex>
+	void check_multibyte_reverse_table() {
+		namespace txt_detail = ztd::text::__txt_detail;
+		auto check_code_point = [](std::uint_least32_t code_point) {
+			const std::optional<std::size_t> expected = LookupIndex(code_point);
+			const std::optional<std::size_t> actual
+				= txt_detail::__multibyte_code_point_to_index<IndexLimit, LookupCodePoint, LookupIndex>(
+				     code_point);
+			if (actual != expected) {
+				CAPTURE(code_point);
+				REQUIRE(actual == expected);
+			}
+		};
+		// every code point the index table has must give exactly what the search gives, including the ones
+		// that appear at several indices
+		for (std::size_t index = 0; index < IndexLimit; ++index) {
+			const std::optional<std::uint_least32_t> maybe_code_point = LookupCodePoint(index);
+			if (maybe_code_point) {
+				check_code_point(*maybe_code_point);
+			}
+		}
+		// and a spread of the rest, including code points above the table that go back to the search
+		for (std::uint_least32_t code_point = 0; code_point < 0x30100; code_point += 97) {
+			check_code_point(code_point);
+		}
+		const txt_detail::__multibyte_reverse_table& table
+			= txt_detail::__multibyte_reverse_table_instance<IndexLimit, LookupCodePoint, LookupIndex>();
+		REQUIRE(table._M_available());
+		// one index page plus one page per populated 256 code points; never more pages than there are indices
+		const std::size_t footprint = table._M_footprint();
+		CAPTURE(footprint);
+		REQUIRE(table._M_page_count <= IndexLimit);
+		REQUIRE(footprint == sizeof(table) + (table._M_page_count * 256 * sizeof(std::uint_least16_t)));
+	}
+} // namespace ztd_text_tests_additional_encodings_multibyte_reverse_tables
+
+TEST_CASE("text/additional_encodings/multibyte_reverse_tables",
+     "check the lazily-built reverse tables of the double-byte encodings against the original index searches") {
+	SECTION("gb18030") {
+		check_multibyte_reverse_table<126 * 190, &ztd::et::gb18030_index_to_code_point,
+		     &ztd::et::gb18030_code_point_to_index>();
+	}
+	SECTION("big5_hkscs") {
+		check_multibyte_reverse_table<126 * 157, &ztd::et::big5_hkscs_index_to_code_point,
+		     &ztd::et::big5_hkscs_code_point_to_index>();
+	}
+	SECTION("euc_kr_uhc") {
+		check_multibyte_reverse_table<126 * 190, &ztd::et::euc_kr_uhc_index_to_code_point,
+		     &ztd::et::euc_kr_uhc_code_point_to_index>();
+	}
+	SECTION("shift_jis_x0208") {
+		check_multibyte_reverse_table<60 * 188, &ztd::et::shift_jis_x0208_index_to_code_point,
+		     &ztd::et::shift_jis_x0208_code_point_to_index>();
+	}
+}
@@ -0,0 +1,179 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#include <ztd/text.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <string>
+#include <string_view>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+inline namespace ztd_text_tests_additional_encodings_single_byte_lookup {
+	template <typename Encoding>
+	void check_single_byte_lookup(const Encoding& encoding) {
+		std::string all_bytes;
+		for (int byte = 0; byte < 256; ++byte) {
+			all_bytes.push_back(static_cast<char>(static_cast<unsigned char>(byte)));
+		}
+		// bulk decode of every byte must match decoding them one at a time, including the replaced ones
+		std::u32string expected_decoded;
+		for (auto it = all_bytes.cbegin(); it != all_bytes.cend(); ++it) {
+			const auto one = ztd::text::decode_one(
+			     ztd::ranges::make_subrange(it, it + 1), encoding, ztd::text::replacement_handler);
+			expected_decoded.append(one.cbegin(), one.cend());
+		}
+		std::u32string decoded = ztd::text::decode(all_bytes, encoding, ztd::text::replacement_handler);
+		REQUIRE(decoded == expected_decoded);
+
+		// bulk encode must match encoding them one at a time, including code points that have no byte
+		std::u32string code_points = expected_decoded;
+		code_points += U"\U0001F600\u4E00\uFFFF";
+		std::string expected_encoded;
+		for (auto it = code_points.cbegin(); it != code_points.cend(); ++it) {
+			const auto one = ztd::text::encode_one(
+			     ztd::ranges::make_subrange(it, it + 1), encoding, ztd::text::replacement_handler);
+			expected_encoded.append(one.cbegin(), one.cend());
+		}
+		std::string encoded = ztd::text::encode(code_points, encoding, ztd::text::replacement_handler);
+		REQUIRE(encoded == expected_encoded);
+
+		// every byte that decodes cleanly must come back as itself
+		for (int byte = 0; byte < 256; ++byte) {
+			std::string_view single(all_bytes.data() + byte, 1);
+			auto decode_result = ztd::text::decode_to(single, encoding, ztd::text::pass_handler);
+			if (decode_result.error_code != ztd::text::encoding_error::ok) {
+				continue;
+			}
+			auto encode_result = ztd::text::encode_to(decode_result.output, encoding, ztd::text::pass_handler);
+			REQUIRE(encode_result.error_code == ztd::text::encoding_error::ok);
+			REQUIRE(encode_result.output == single);
+		}
+	}
+
+	template <bool AsciiLow, ztd::et::basic_lookup_index_to_code_point_function* LookupCodePoint,
+		ztd::et::basic_lookup_code_point_to_index_function* LookupIndex>
+	void check_single_byte_tables() {
+		namespace txt_detail = ztd::text::__txt_detail;
+		// what the encodings did before the tables: ASCII passes through when the bottom half is ASCII, and the
+		// lookups index everything else
+		auto search_code_point = [](std::size_t byte) -> std::optional<std::uint_least32_t> {
+			if constexpr (AsciiLow) {
+				if (byte < 0x80) {
+					return static_cast<std::uint_least32_t>(byte);
+				}
+				return LookupCodePoint(byte - 0x80);
+			}
+			return LookupCodePoint(byte);
+		};
+		auto search_byte = [](std::uint_least32_t code_point) -> std::optional<unsigned char> {
+			if constexpr (AsciiLow) {
+				if (code_point < 0x80) {
+					return static_cast<unsigned char>(code_point);
+				}
+			}
+			const std::optional<std::size_t> maybe_index = LookupIndex(code_point);
+			if (!maybe_index) {
+				return std::nullopt;
+			}
+			return static_cast<unsigned char>(*maybe_index + 0x80);
+		};
+		auto check_code_point = [&search_byte](std::uint_least32_t code_point) {
+			const std::optional<unsigned char> expected = search_byte(code_point);
+			const std::uint_least16_t entry
+				= txt_detail::__single_byte_encode_lookup<AsciiLow, LookupCodePoint, LookupIndex>(code_point);
+			const std::optional<unsigned char> actual
+				= entry == 0 ? std::nullopt : std::optional<unsigned char>(static_cast<unsigned char>(entry));
+			if (actual != expected) {
+				CAPTURE(code_point);
+				REQUIRE(actual == expected);
+			}
+		};
+		// every byte must decode to exactly what the lookup gives, and every code point a byte decodes to must
+		// encode to exactly what the reverse lookup gives
+		const txt_detail::__single_byte_decode_table& decode_table
+			= txt_detail::__single_byte_decode_table_v<AsciiLow, LookupCodePoint>;
+		for (std::size_t byte = 0; byte < 256; ++byte) {
+			const std::optional<std::uint_least32_t> expected = search_code_point(byte);
+			const std::uint_least32_t code = decode_table.__code_points[byte];
+			const std::optional<std::uint_least32_t> actual = code == txt_detail::__single_byte_no_code_point
+				? std::nullopt
+				: std::optional<std::uint_least32_t>(code);
+			if (actual != expected) {
+				CAPTURE(byte);
+				REQUIRE(actual == expected);
+			}
+			if (expected) {
+				check_code_point(*expected);
+			}
+		}
+		// and a spread of the rest, including code points above the table that go back to the search
+		for (std::uint_least32_t code_point = 0; code_point < 0x30100; code_point += 97) {
+			check_code_point(code_point);
+		}
+	}
+} // namespace ztd_text_tests_additional_encodings_single_byte_lookup
+
+TEST_CASE("text/additional_encodings/single_byte_lookup",
+     "check the table-driven bulk paths of single-byte lookup encodings against one-at-a-time conversions") {
+	SECTION("koi8_r") {
+		check_single_byte_lookup(ztd::text::koi8_r);
+	}
+	SECTION("windows_1252") {
+		check_single_byte_lookup(ztd::text::windows_1252);
+	}
+	SECTION("atari_st") {
+		check_single_byte_lookup(ztd::text::atari_st);
+	}
+	SECTION("ibm_856_hebrew") {
+		check_single_byte_lookup(ztd::text::ibm_856_hebrew);
+	}
+}
+
+TEST_CASE("text/additional_encodings/single_byte_lookup/tables",
+     "check the single-byte lookup tables against the original index lookups") {
+	SECTION("koi8_r") {
+		check_single_byte_tables<true, &ztd::et::koi8_r_index_to_code_point, &ztd::et::koi8_r_code_point_to_index>();
+	}
+	SECTION("windows_1252") {
+		check_single_byte_tables<true, &ztd::et::windows_1252_index_to_code_point,
+		     &ztd::et::windows_1252_code_point_to_index>();
+	}
+	SECTION("atari_st") {
+		check_single_byte_tables<false, &ztd::et::atari_st_index_to_code_point,
+		     &ztd::et::atari_st_code_point_to_index>();
+	}
+	SECTION("ibm_856_hebrew") {
+		check_single_byte_tables<false, &ztd::et::ibm_856_hebrew_index_to_code_point,
+		     &ztd::et::ibm_856_hebrew_code_point_to_index>();
+	}
+}
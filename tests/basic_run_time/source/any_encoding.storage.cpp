@@ -0,0 +1,125 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#include <ztd/text/any_encoding.hpp>
+#include <ztd/text/decode.hpp>
+#include <ztd/text/utf8.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <ztd/text/tests/basic_unicode_strings.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <string>
+
+inline namespace ztd_text_tests_basic_runtime_any_encoding_storage {
+	std::atomic<std::size_t> allocation_count { 0 };
+
+	struct large_utf8 : ztd::text::utf8_t {
+		unsigned char padding[512] = {};
+	};
+
+	template <typename Encoding>
+	void check_decode_after_move(Encoding&& base_encoding) {
+		const auto& input    = ztd::tests::u8_basic_source_character_set_bytes_native_endian;
+		const auto& expected = ztd::tests::u32_basic_source_character_set;
+
+		ztd::text::any_encoding original_encoding(std::forward<Encoding>(base_encoding));
+		ztd::text::any_encoding::decode_state original_state = ztd::text::make_decode_state(original_encoding);
+		ztd::text::any_encoding encoding(std::move(original_encoding));
+		ztd::text::any_encoding::decode_state state(std::move(original_state));
+
+		std::u32string result_storage(std::size(input), char32_t {});
+		ztd::span<char32_t> result_storage_view(result_storage.data(), result_storage.size());
+		auto result
+		     = ztd::text::decode_into(input, encoding, result_storage_view, ztd::text::replacement_handler, state);
+		std::u32string_view result_view(result_storage_view.data(),
+		     static_cast<std::size_t>(result.output.data() - result_storage_view.data()));
+		REQUIRE(result.error_code == ztd::text::encoding_error::ok);
+		REQUIRE_FALSE(result.errors_were_handled());
+		REQUIRE(std::size(result.input) == 0);
+		REQUIRE(std::equal(result_view.begin(), result_view.end(), expected.begin(), expected.end()));
+	}
+} // namespace ztd_text_tests_basic_runtime_any_encoding_storage
+
+void* operator new(std::size_t size) {
+	allocation_count.fetch_add(1, std::memory_order_relaxed);
+	if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+		return ptr;
+	}
+	throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+	std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+	std::free(ptr);
+}
+
+TEST_CASE("text/any_encoding/storage", "small encodings and their states are stored without heap allocations") {
+	SECTION("small encodings do not allocate") {
+		const std::size_t allocations_before = allocation_count.load();
+		{
+			ztd::text::any_encoding encoding(ztd::text::utf8);
+			ztd::text::any_encoding::decode_state decode_state = ztd::text::make_decode_state(encoding);
+			ztd::text::any_encoding::encode_state encode_state = ztd::text::make_encode_state(encoding);
+			ztd::text::any_encoding moved_encoding(std::move(encoding));
+			ztd::text::any_encoding::decode_state moved_decode_state(std::move(decode_state));
+			ztd::text::any_encoding::encode_state moved_encode_state(std::move(encode_state));
+			moved_decode_state = ztd::text::make_decode_state(moved_encoding);
+			moved_encode_state = ztd::text::make_encode_state(moved_encoding);
+		}
+		const std::size_t allocations_after = allocation_count.load();
+		REQUIRE(allocations_before == allocations_after);
+	}
+	SECTION("large encodings still allocate") {
+		const std::size_t allocations_before = allocation_count.load();
+		{
+			ztd::text::any_encoding encoding(large_utf8 {});
+			(void)encoding;
+		}
+		const std::size_t allocations_after = allocation_count.load();
+		REQUIRE(allocations_before != allocations_after);
+	}
+	SECTION("decode after moving") {
+		SECTION("inline") {
+			check_decode_after_move(ztd::text::utf8);
+		}
+		SECTION("heap") {
+			check_decode_after_move(large_utf8 {});
+		}
+	}
+}
@@ -84,6 +84,31 @@ inline namespace ztd_text_tests_basic_runtime_any_encoding_transcode {
 			REQUIRE(is_equal1);
 		}
 	}
+
+	template <typename Input, typename Expected>
+	void check_direct_transcode(const ztd::text::any_encoding& from_encoding,
+	     const ztd::text::any_encoding& to_encoding, const Input& input, const Expected& expected,
+	     std::size_t expected_error_count) {
+		auto from_state = ztd::text::make_decode_state(from_encoding);
+		auto to_state   = ztd::text::make_encode_state(to_encoding);
+		std::vector<std::byte> result_storage(
+		     std::size(input) * ztd::text::max_code_units_v<ztd::text::any_encoding>, std::byte {});
+		ztd::span<std::byte> result_storage_view(result_storage);
+		ztd::span<const std::byte> input_view(
+		     reinterpret_cast<const std::byte*>(std::data(input)), std::size(input));
+		auto result = ztd::text::transcode_into(input_view, from_encoding, result_storage_view, to_encoding,
+		     ztd::text::replacement_handler, ztd::text::replacement_handler, from_state, to_state);
+		ztd::span<std::byte> result_view(result_storage_view.data(),
+		     static_cast<std::size_t>(result.output.data() - result_storage_view.data()));
+		ztd::span<const std::byte> expected_view(
+		     reinterpret_cast<const std::byte*>(std::data(expected)), std::size(expected));
+		bool is_equal
+		     = std::equal(result_view.begin(), result_view.end(), expected_view.begin(), expected_view.end());
+		REQUIRE(result.error_code == ztd::text::encoding_error::ok);
+		REQUIRE(result.error_count == expected_error_count);
+		REQUIRE(std::size(result.input) == 0);
+		REQUIRE(is_equal);
+	}
 } // namespace ztd_text_tests_basic_runtime_any_encoding_transcode
 
 TEST_CASE("text/transcode/any_encoding/encoding_scheme", "encode with byte arrays with specific endianness") {
@@ -214,3 +239,64 @@ TEST_CASE("text/transcode/any_encoding/encoding_scheme", "encode with byte array
 		}
 	}
 }
+
+TEST_CASE("text/transcode/any_encoding/direct",
+     "transcode between two type-erased encodings, through both the typed and the block paths") {
+	ztd::text::any_encoding utf8_encoding(ztd::text::utf8);
+	SECTION("same encoding") {
+		ztd::text::any_encoding other_utf8_encoding(ztd::text::utf8);
+		check_direct_transcode(utf8_encoding, other_utf8_encoding,
+		     ztd::tests::u8_unicode_sequence_bytes_truth_native_endian,
+		     ztd::tests::u8_unicode_sequence_bytes_truth_native_endian, 0);
+		const unsigned char invalid_input[] = { 'a', 0xFF, 'b', 0xC0, 'c' };
+		const unsigned char expected[]      = { 'a', 0xEF, 0xBF, 0xBD, 'b', 0xEF, 0xBF, 0xBD, 'c' };
+		check_direct_transcode(utf8_encoding, other_utf8_encoding, invalid_input, expected, 2);
+	}
+	SECTION("utf8 to utf16") {
+		ztd::text::any_encoding utf16_encoding(ztd::text::utf16);
+		check_direct_transcode(utf8_encoding, utf16_encoding,
+		     ztd::tests::u8_unicode_sequence_bytes_truth_native_endian,
+		     ztd::tests::u16_unicode_sequence_bytes_truth_native_endian, 0);
+		check_direct_transcode(utf16_encoding, utf8_encoding,
+		     ztd::tests::u16_unicode_sequence_bytes_truth_native_endian,
+		     ztd::tests::u8_unicode_sequence_bytes_truth_native_endian, 0);
+	}
+	SECTION("utf8 to big endian utf32") {
+		ztd::text::any_encoding utf32_encoding(ztd::text::encoding_scheme<ztd::text::utf32_t, ztd::endian::big> {});
+		check_direct_transcode(utf8_encoding, utf32_encoding,
+		     ztd::tests::u8_unicode_sequence_bytes_truth_native_endian,
+		     ztd::tests::u32_unicode_sequence_bytes_truth_big_endian, 0);
+		const unsigned char invalid_input[] = { 'a', 0xFF, 'b' };
+		const unsigned char expected[]      = { 0, 0, 0, 'a', 0, 0, 0xFF, 0xFD, 0, 0, 0, 'b' };
+		check_direct_transcode(utf8_encoding, utf32_encoding, invalid_input, expected, 1);
+	}
+	SECTION("utf8 to ascii") {
+		ztd::text::any_encoding ascii_encoding(ztd::text::ascii);
+		const unsigned char input[]    = { 'a', 0xC3, 0xA9, 'b' };
+		const unsigned char expected[] = { 'a', '?', 'b' };
+		check_direct_transcode(utf8_encoding, ascii_encoding, input, expected, 1);
+	}
+	SECTION("decode error after an encode error in the same block") {
+		ztd::text::any_encoding ascii_encoding(ztd::text::ascii);
+		const unsigned char input[] = { 'a', 0xC3, 0xA9, 'b', 0xFF, 'c' };
+		ztd::span<const std::byte> input_view(reinterpret_cast<const std::byte*>(input), std::size(input));
+		std::byte output[16] {};
+		std::size_t from_handler_calls = 0;
+		auto counting_from_handler     = [&](const auto& encoding, auto result, const auto& input_progress,
+                                         const auto& output_progress) {
+			++from_handler_calls;
+			return ztd::text::replacement_handler(encoding, std::move(result), input_progress, output_progress);
+		};
+		auto from_state = ztd::text::make_decode_state(utf8_encoding);
+		auto to_state   = ztd::text::make_encode_state(ascii_encoding);
+		auto result     = ztd::text::transcode_into_raw(input_view, utf8_encoding, ztd::span<std::byte>(output),
+		         ascii_encoding, counting_from_handler, ztd::text::pass_handler, from_state, to_state);
+		REQUIRE(result.error_code == ztd::text::encoding_error::invalid_sequence);
+		// the error handler for 0xFF must not run: the input stops just past the U+00E9 that ASCII cannot hold
+		REQUIRE(from_handler_calls == 0);
+		REQUIRE(result.error_count <= 1);
+		REQUIRE(result.input.data() == input_view.data() + 3);
+		REQUIRE(result.output.data() == output + 1);
+		REQUIRE(output[0] == static_cast<std::byte>('a'));
+	}
+}
@@ -0,0 +1,247 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#include <ztd/text/chunked_decode_view.hpp>
+#include <ztd/text/chunked_transcode_view.hpp>
+#include <ztd/text/decode.hpp>
+#include <ztd/text/transcode.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <ztd/text/tests/basic_unicode_strings.hpp>
+
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <cstddef>
+#include <iterator>
+
+inline namespace ztd_text_tests_basic_run_time_chunked_view {
+	template <std::size_t ChunkSize, typename Encoding, typename Input>
+	void check_chunked_decode_view(Encoding& encoding, const Input& input) {
+		using Range = std::basic_string_view<ztd::text::code_unit_t<Encoding>>;
+		using View  = ztd::text::chunked_decode_view<Encoding, Range, ztd::text::replacement_handler_t,
+               ztd::text::decode_state_t<Encoding>, ChunkSize>;
+		const auto expected_output = ztd::text::decode(Range(input), encoding, ztd::text::replacement_handler);
+		View result0_view(Range(input), encoding);
+		auto result0_it         = result0_view.begin();
+		const auto result0_last = result0_view.end();
+		auto truth0_it          = std::cbegin(expected_output);
+		const auto truth0_last  = std::cend(expected_output);
+		for (; result0_it != result0_last; ++result0_it, (void)++truth0_it) {
+			REQUIRE(result0_it.error_code() == ztd::text::encoding_error::ok);
+			REQUIRE(truth0_it != truth0_last);
+			const auto truth0_val  = *truth0_it;
+			const auto result0_val = *result0_it;
+			REQUIRE(truth0_val == result0_val);
+		}
+		REQUIRE(truth0_it == truth0_last);
+	}
+
+	template <std::size_t ChunkSize, typename FromEncoding, typename ToEncoding, typename Input>
+	void check_chunked_transcode_view(FromEncoding& from, ToEncoding& to, const Input& input) {
+		using Range = std::basic_string_view<ztd::text::code_unit_t<FromEncoding>>;
+		using View  = ztd::text::chunked_transcode_view<FromEncoding, ToEncoding, Range,
+               ztd::text::replacement_handler_t, ztd::text::replacement_handler_t,
+               ztd::text::decode_state_t<FromEncoding>, ztd::text::encode_state_t<ToEncoding>, ChunkSize>;
+		const auto expected_output = ztd::text::transcode(
+		     Range(input), from, to, ztd::text::replacement_handler, ztd::text::replacement_handler);
+		View result0_view(Range(input), from, to);
+		auto result0_it         = result0_view.begin();
+		const auto result0_last = result0_view.end();
+		auto truth0_it          = std::cbegin(expected_output);
+		const auto truth0_last  = std::cend(expected_output);
+		for (; result0_it != result0_last; result0_it++, (void)++truth0_it) {
+			REQUIRE(result0_it.error_code() == ztd::text::encoding_error::ok);
+			REQUIRE(truth0_it != truth0_last);
+			const auto truth0_val  = *truth0_it;
+			const auto result0_val = *result0_it;
+			REQUIRE(truth0_val == result0_val);
+		}
+		REQUIRE(truth0_it == truth0_last);
+	}
+
+	template <typename Encoding, typename Input>
+	void check_chunked_decode_view_all(Encoding& encoding, const Input& input) {
+		check_chunked_decode_view<1>(encoding, input);
+		check_chunked_decode_view<3>(encoding, input);
+		check_chunked_decode_view<ZTD_TEXT_CHUNKED_VIEW_BUFFER_SIZE_I_(ztd::text::code_point_t<Encoding>)>(
+		     encoding, input);
+	}
+
+	template <typename FromEncoding, typename ToEncoding, typename Input>
+	void check_chunked_transcode_view_all(FromEncoding& from, ToEncoding& to, const Input& input) {
+		check_chunked_transcode_view<1>(from, to, input);
+		check_chunked_transcode_view<3>(from, to, input);
+		check_chunked_transcode_view<ZTD_TEXT_CHUNKED_VIEW_BUFFER_SIZE_I_(ztd::text::code_point_t<ToEncoding>)>(
+		     from, to, input);
+	}
+
+	// ill-formed sequences, including one cut off at the very end
+	inline constexpr ztd::uchar8_t u8_ill_formed[]
+		= { 0x61, 0xC3, 0xA9, 0xFF, 0xE2, 0x82, 0xAC, 0xF0, 0x9F, 0x98, 0x62, 0xE2, 0x82 };
+	inline constexpr char16_t u16_ill_formed[] = { 0x0061, 0xD83D, 0x0062, 0xDE00, 0xD83D, 0xDE00, 0xD83D };
+	// A tiny stateful encoding: 0x0E switches between lower and upper case for the letters that follow it. The
+	// switch is read as part of the decode step of the next letter, so a step that runs out of output space has
+	// already changed the state by the time it reports what it read.
+	struct toggling_ascii {
+		struct state {
+			bool upper = false;
+		};
+
+		using code_unit    = char;
+		using code_point   = char32_t;
+		using decode_state = state;
+		using encode_state = state;
+
+		static inline constexpr std::size_t max_code_units  = 2;
+		static inline constexpr std::size_t max_code_points = 1;
+		static inline constexpr char toggle                 = '\x0E';
+
+		template <typename Input, typename Output, typename ErrorHandler>
+		static constexpr auto decode_one(Input&& input, Output&& output, ErrorHandler&& error_handler, state& s) {
+			using SubInput  = ztd::ranges::csubrange_for_t<std::remove_reference_t<Input>>;
+			using SubOutput = ztd::ranges::subrange_for_t<std::remove_reference_t<Output>>;
+			using Result    = ztd::text::decode_result<SubInput, SubOutput, state>;
+
+			auto in_it    = ztd::ranges::cbegin(input);
+			auto in_last  = ztd::ranges::cend(input);
+			auto out_it   = ztd::ranges::begin(output);
+			auto out_last = ztd::ranges::end(output);
+			code_unit units[max_code_units] {};
+			std::size_t units_read = 0;
+			if (in_it != in_last && *in_it == toggle) {
+				units[units_read++] = *in_it;
+				s.upper             = !s.upper;
+				ztd::ranges::iter_advance(in_it);
+			}
+			if (in_it == in_last) {
+				return Result(SubInput(std::move(in_it), std::move(in_last)),
+				     SubOutput(std::move(out_it), std::move(out_last)), s, ztd::text::encoding_error::ok);
+			}
+			if (out_it == out_last) {
+				return std::forward<ErrorHandler>(error_handler)(toggling_ascii {},
+				     Result(SubInput(std::move(in_it), std::move(in_last)),
+				          SubOutput(std::move(out_it), std::move(out_last)), s,
+				          ztd::text::encoding_error::insufficient_output_space),
+				     ztd::span<code_unit>(units, units_read), ztd::span<code_point>());
+			}
+			const char unit = *in_it;
+			ztd::ranges::iter_advance(in_it);
+			*out_it = static_cast<code_point>(s.upper && unit >= 'a' && unit <= 'z' ? unit - 'a' + 'A' : unit);
+			ztd::ranges::iter_advance(out_it);
+			return Result(SubInput(std::move(in_it), std::move(in_last)),
+			     SubOutput(std::move(out_it), std::move(out_last)), s, ztd::text::encoding_error::ok);
+		}
+
+		template <typename Input, typename Output, typename ErrorHandler>
+		static constexpr auto encode_one(Input&& input, Output&& output, ErrorHandler&&, state& s) {
+			using SubInput  = ztd::ranges::csubrange_for_t<std::remove_reference_t<Input>>;
+			using SubOutput = ztd::ranges::subrange_for_t<std::remove_reference_t<Output>>;
+			using Result    = ztd::text::encode_result<SubInput, SubOutput, state>;
+
+			auto in_it    = ztd::ranges::cbegin(input);
+			auto in_last  = ztd::ranges::cend(input);
+			auto out_it   = ztd::ranges::begin(output);
+			auto out_last = ztd::ranges::end(output);
+			if (in_it != in_last && out_it != out_last) {
+				*out_it = static_cast<code_unit>(*in_it);
+				ztd::ranges::iter_advance(in_it);
+				ztd::ranges::iter_advance(out_it);
+			}
+			return Result(SubInput(std::move(in_it), std::move(in_last)),
+			     SubOutput(std::move(out_it), std::move(out_last)), s, ztd::text::encoding_error::ok);
+		}
+	};
+} // namespace ztd_text_tests_basic_run_time_chunked_view
+
+TEST_CASE("text/chunked_decode_view/basic", "chunked_decode_view produces exactly what decode produces") {
+	SECTION("utf8") {
+		ztd::text::utf8_t encoding {};
+		check_chunked_decode_view_all(encoding, ztd::tests::u8_basic_source_character_set);
+		check_chunked_decode_view_all(encoding, ztd::tests::u8_unicode_sequence_truth_native_endian);
+		check_chunked_decode_view_all(
+		     encoding, std::basic_string_view<ztd::uchar8_t>(u8_ill_formed, std::size(u8_ill_formed)));
+	}
+	SECTION("utf16") {
+		ztd::text::utf16_t encoding {};
+		check_chunked_decode_view_all(encoding, ztd::tests::u16_basic_source_character_set);
+		check_chunked_decode_view_all(encoding, ztd::tests::u16_unicode_sequence_truth_native_endian);
+		check_chunked_decode_view_all(encoding, std::u16string_view(u16_ill_formed, std::size(u16_ill_formed)));
+	}
+	SECTION("utf32") {
+		ztd::text::utf32_t encoding {};
+		check_chunked_decode_view_all(encoding, ztd::tests::u32_basic_source_character_set);
+		check_chunked_decode_view_all(encoding, ztd::tests::u32_unicode_sequence_truth_native_endian);
+	}
+	SECTION("stateful") {
+		toggling_ascii encoding {};
+		std::string input;
+		for (std::size_t i = 0; i < 4; ++i) {
+			input += "ab\x0E" "cd\x0E" "ef";
+		}
+		REQUIRE(ztd::text::decode(std::string_view(input), encoding, ztd::text::replacement_handler)
+		     == U"abCDefabCDefabCDefabCDef");
+		check_chunked_decode_view_all(encoding, std::string_view(input));
+	}
+	SECTION("empty") {
+		ztd::text::utf8_t encoding {};
+		ztd::text::chunked_decode_view<ztd::text::utf8_t, std::basic_string_view<ztd::uchar8_t>> empty_view(
+		     std::basic_string_view<ztd::uchar8_t>(), encoding);
+		REQUIRE(empty_view.begin() == empty_view.end());
+	}
+}
+
+TEST_CASE("text/chunked_transcode_view/basic", "chunked_transcode_view produces exactly what transcode produces") {
+	SECTION("utf8") {
+		ztd::text::utf8_t from {};
+		ztd::text::utf16_t to16 {};
+		ztd::text::utf32_t to32 {};
+		check_chunked_transcode_view_all(from, to16, ztd::tests::u8_unicode_sequence_truth_native_endian);
+		check_chunked_transcode_view_all(from, to32, ztd::tests::u8_unicode_sequence_truth_native_endian);
+		check_chunked_transcode_view_all(
+		     from, to16, std::basic_string_view<ztd::uchar8_t>(u8_ill_formed, std::size(u8_ill_formed)));
+	}
+	SECTION("utf16") {
+		ztd::text::utf16_t from {};
+		ztd::text::utf8_t to8 {};
+		ztd::text::utf32_t to32 {};
+		check_chunked_transcode_view_all(from, to8, ztd::tests::u16_unicode_sequence_truth_native_endian);
+		check_chunked_transcode_view_all(from, to32, ztd::tests::u16_unicode_sequence_truth_native_endian);
+	}
+	SECTION("utf32") {
+		ztd::text::utf32_t from {};
+		ztd::text::utf8_t to8 {};
+		ztd::text::utf16_t to16 {};
+		check_chunked_transcode_view_all(from, to8, ztd::tests::u32_unicode_sequence_truth_native_endian);
+		check_chunked_transcode_view_all(from, to16, ztd::tests::u32_unicode_sequence_truth_native_endian);
+	}
+}
@@ -34,6 +34,46 @@
 
 #include <ztd/text/tests/basic_unicode_strings.hpp>
 
+#include <ztd/idk/span.hpp>
+
+#include <cstddef>
+#include <initializer_list>
+#include <vector>
+
+namespace ztd_text_tests_basic_run_time_count_decodable {
+	template <typename Encoding, typename Source>
+	void check_bulk_count(Encoding& encoding, const Source& source,
+		std::initializer_list<std::initializer_list<ztd::text::code_unit_t<Encoding>>> bad_sequences) {
+		using CodeUnit = ztd::text::code_unit_t<Encoding>;
+		std::vector<CodeUnit> input;
+		for (std::size_t i = 0; i < 6; ++i) {
+			input.insert(input.end(), 29 + i * 7, static_cast<CodeUnit>('a' + i));
+			input.insert(input.end(), source.data(), source.data() + source.size());
+		}
+		std::vector<std::vector<CodeUnit>> inputs { input };
+		for (const auto& bad_sequence : bad_sequences) {
+			for (std::size_t position = 0; position <= 96; position += 3) {
+				std::vector<CodeUnit> bad_input = input;
+				bad_input.insert(bad_input.begin() + position, bad_sequence.begin(), bad_sequence.end());
+				inputs.push_back(std::move(bad_input));
+			}
+		}
+		for (std::size_t cut = 1; cut < 8; ++cut) {
+			inputs.emplace_back(input.begin(), input.end() - cut);
+		}
+		for (const auto& checked_input : inputs) {
+			ztd::span<const CodeUnit> input_view(checked_input.data(), checked_input.size());
+			ztd::text::decode_state_t<Encoding> state {};
+			auto expected
+			     = ztd::text::basic_count_as_decoded(input_view, encoding, ztd::text::replacement_handler, state);
+			auto result   = ztd::text::count_as_decoded(input_view, encoding, ztd::text::replacement_handler);
+			REQUIRE(result.count == expected.count);
+			REQUIRE(result.error_count == expected.error_count);
+			REQUIRE(ztd::ranges::size(result.input) == ztd::ranges::size(expected.input));
+		}
+	}
+} // namespace ztd_text_tests_basic_run_time_count_decodable
+
 TEST_CASE("text/count_as_decoded/core", "basic usages of count_as_decoded function do not explode") {
 	std::size_t expected0 = std::size(ztd::tests::u32_basic_source_character_set);
 	std::size_t expected1 = std::size(ztd::tests::u32_unicode_sequence_truth_native_endian);
@@ -124,3 +164,21 @@ TEST_CASE("text/count_as_decoded/core", "basic usages of count_as_decoded functi
 		REQUIRE(result1.count == expected1);
 	}
 }
+
+TEST_CASE("text/count_as_decoded/unicode bulk",
+     "bulk counting of unicode input gives exactly the same results as the single-step loop") {
+	using namespace ztd_text_tests_basic_run_time_count_decodable;
+	SECTION("utf8") {
+		ztd::text::utf8_t encoding {};
+		check_bulk_count(encoding, ztd::tests::u8_unicode_sequence_truth_native_endian,
+			{ { 0x80 }, { 0xC0, 0x80 }, { 0xED, 0xA0, 0x80 }, { 0xF0, 0x9F, 0x98 } });
+	}
+	SECTION("utf16") {
+		ztd::text::utf16_t encoding {};
+		check_bulk_count(encoding, ztd::tests::u16_unicode_sequence_truth_native_endian, { { 0xD800 }, { 0xDC00 } });
+	}
+	SECTION("utf32") {
+		ztd::text::utf32_t encoding {};
+		check_bulk_count(encoding, ztd::tests::u32_unicode_sequence_truth_native_endian, { { 0xD800 } });
+	}
+}
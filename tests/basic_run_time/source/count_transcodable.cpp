@@ -34,6 +34,65 @@
 
 #include <ztd/text/tests/basic_unicode_strings.hpp>
 
+#include <ztd/idk/span.hpp>
+
+#include <cstddef>
+#include <initializer_list>
+#include <vector>
+
+namespace ztd_text_tests_basic_run_time_count_transcodable {
+	template <typename FromEncoding, typename ToEncoding, typename CodeUnit>
+	void check_same_as_basic(
+		FromEncoding& from_encoding, ToEncoding& to_encoding, const std::vector<CodeUnit>& input) {
+		using CodePoint = ztd::text::code_point_t<FromEncoding>;
+		ztd::span<const CodeUnit> input_view(input.data(), input.size());
+		ztd::text::replacement_handler_t handler {};
+		ztd::text::decode_state_t<FromEncoding> from_state {};
+		ztd::text::encode_state_t<ToEncoding> to_state {};
+		CodePoint pivot_storage[ztd::text::max_code_points_v<FromEncoding>] {};
+		ztd::span<CodePoint, ztd::text::max_code_points_v<FromEncoding>> pivot(pivot_storage);
+		auto expected = ztd::text::basic_count_as_transcoded(
+		     input_view, from_encoding, to_encoding, handler, handler, from_state, to_state, pivot);
+		auto result = ztd::text::count_as_transcoded(input_view, from_encoding, to_encoding, handler, handler);
+		REQUIRE(result.count == expected.count);
+		REQUIRE(result.error_code == expected.error_code);
+		REQUIRE(result.error_count == expected.error_count);
+		REQUIRE(ztd::ranges::size(result.input) == ztd::ranges::size(expected.input));
+	}
+
+	template <typename FromEncoding, typename Source>
+	void check_bulk_count(FromEncoding& from_encoding, const Source& source,
+		std::initializer_list<std::initializer_list<ztd::text::code_unit_t<FromEncoding>>> bad_sequences) {
+		using CodeUnit = ztd::text::code_unit_t<FromEncoding>;
+		// long ASCII runs interleaved with the test sequence, so both the vectorized and the scalar paths get used
+		std::vector<CodeUnit> input;
+		for (std::size_t i = 0; i < 6; ++i) {
+			input.insert(input.end(), 29 + i * 7, static_cast<CodeUnit>('a' + i));
+			input.insert(input.end(), source.data(), source.data() + source.size());
+		}
+		std::vector<std::vector<CodeUnit>> inputs { input };
+		for (const auto& bad_sequence : bad_sequences) {
+			for (std::size_t position = 0; position <= 96; position += 3) {
+				std::vector<CodeUnit> bad_input = input;
+				bad_input.insert(bad_input.begin() + position, bad_sequence.begin(), bad_sequence.end());
+				bad_input.insert(bad_input.end() - position, bad_sequence.begin(), bad_sequence.end());
+				inputs.push_back(std::move(bad_input));
+			}
+		}
+		for (std::size_t cut = 1; cut < 8; ++cut) {
+			inputs.emplace_back(input.begin(), input.end() - cut);
+		}
+		ztd::text::utf8_t utf8 {};
+		ztd::text::utf16_t utf16 {};
+		ztd::text::utf32_t utf32 {};
+		for (const auto& checked_input : inputs) {
+			check_same_as_basic(from_encoding, utf8, checked_input);
+			check_same_as_basic(from_encoding, utf16, checked_input);
+			check_same_as_basic(from_encoding, utf32, checked_input);
+		}
+	}
+} // namespace ztd_text_tests_basic_run_time_count_transcodable
+
 TEST_CASE("text/count_as_transcoded/core", "basic usages of count_as_transcoded function do not explode") {
 	SECTION("execution") {
 		ztd::text::execution_t to_encoding {};
@@ -144,3 +203,23 @@ TEST_CASE("text/count_as_transcoded/core", "basic usages of count_as_transcoded
 		REQUIRE(result1.count == expected1);
 	}
 }
+
+TEST_CASE("text/count_as_transcoded/unicode bulk",
+     "bulk counting between unicode encodings gives exactly the same results as the single-step loop") {
+	using namespace ztd_text_tests_basic_run_time_count_transcodable;
+	SECTION("utf8") {
+		ztd::text::utf8_t encoding {};
+		check_bulk_count(encoding, ztd::tests::u8_unicode_sequence_truth_native_endian,
+			{ { 0x80 }, { 0xC0, 0x80 }, { 0xED, 0xA0, 0x80 }, { 0xF4, 0x90, 0x80, 0x80 }, { 0xF0, 0x9F, 0x98 } });
+	}
+	SECTION("utf16") {
+		ztd::text::utf16_t encoding {};
+		check_bulk_count(encoding, ztd::tests::u16_unicode_sequence_truth_native_endian,
+			{ { 0xD800 }, { 0xDC00 }, { 0xDBFF, 0x41 } });
+	}
+	SECTION("utf32") {
+		ztd::text::utf32_t encoding {};
+		check_bulk_count(
+			encoding, ztd::tests::u32_unicode_sequence_truth_native_endian, { { 0xD800 }, { 0x110000 } });
+	}
+}
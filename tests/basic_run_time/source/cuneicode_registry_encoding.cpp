@@ -0,0 +1,93 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#include <ztd/text/cuneicode_registry_encoding.hpp>
+#include <ztd/text/transcode.hpp>
+#include <ztd/text/decode.hpp>
+#include <ztd/text/encode.hpp>
+
+#include <ztd/text/tests/basic_unicode_strings.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <algorithm>
+#include <string>
+
+TEST_CASE("text/cuneicode_registry_encoding",
+	"a run-time named cuneicode registry encoding converts in bulk and around errors") {
+	std::string utf8_input;
+	std::u16string utf16_input;
+	std::u32string utf32_input;
+	for (int i = 0; i < 32; ++i) {
+		utf8_input.append(ztd::tests::u8_unicode_sequence_truth_native_endian.begin(),
+			ztd::tests::u8_unicode_sequence_truth_native_endian.end());
+		utf16_input.append(ztd::tests::u16_unicode_sequence_truth_native_endian.begin(),
+			ztd::tests::u16_unicode_sequence_truth_native_endian.end());
+		utf32_input.append(ztd::tests::u32_unicode_sequence_truth_native_endian.begin(),
+			ztd::tests::u32_unicode_sequence_truth_native_endian.end());
+	}
+	cnc_open_err utf8_err = cnc_open_err_ok;
+	const ztd::text::basic_cuneicode_registry_encoding<char, char32_t> utf8_encoding("UTF-8", utf8_err);
+	REQUIRE(utf8_err == cnc_open_err_ok);
+
+	SECTION("decode") {
+		std::u32string result = ztd::text::decode(utf8_input, utf8_encoding, ztd::text::replacement_handler);
+		REQUIRE(result == utf32_input);
+
+		std::string broken_input = utf8_input;
+		// between two copies of the sequence, so it does not split a valid sequence
+		broken_input.insert((broken_input.size() / 32) * 16, "\xFF");
+		std::u32string broken_result
+			= ztd::text::decode(broken_input, utf8_encoding, ztd::text::replacement_handler);
+		REQUIRE(broken_result.size() == utf32_input.size() + 1);
+		REQUIRE(std::count(broken_result.cbegin(), broken_result.cend(), U'\uFFFD')
+			== std::count(utf32_input.cbegin(), utf32_input.cend(), U'\uFFFD') + 1);
+	}
+	SECTION("encode") {
+		std::string result = ztd::text::encode(utf32_input, utf8_encoding, ztd::text::replacement_handler);
+		REQUIRE(result == utf8_input);
+	}
+	SECTION("transcode") {
+		cnc_open_err utf16_err = cnc_open_err_ok;
+		const ztd::text::basic_cuneicode_registry_encoding<char16_t, char32_t> utf16_encoding("UTF-16", utf16_err);
+		REQUIRE(utf16_err == cnc_open_err_ok);
+		std::u16string result = ztd::text::transcode(utf8_input, utf8_encoding, utf16_encoding,
+			ztd::text::replacement_handler, ztd::text::replacement_handler);
+		REQUIRE(result == utf16_input);
+	}
+	SECTION("unknown names") {
+		cnc_open_err bad_err = cnc_open_err_ok;
+		const ztd::text::cuneicode_registry_encoding bad_encoding("not-an-encoding-name-anyone-uses", bad_err);
+		REQUIRE(bad_err != cnc_open_err_ok);
+		REQUIRE(bad_encoding.error() == bad_err);
+		auto result = ztd::text::decode_to(utf8_input, bad_encoding, ztd::text::replacement_handler);
+		REQUIRE(result.error_code != ztd::text::encoding_error::ok);
+	}
+}
@@ -36,6 +36,11 @@
 
 #include <ztd/text/tests/basic_unicode_strings.hpp>
 
+#include <ztd/idk/encoding_detection.hpp>
+
+#include <clocale>
+#include <string>
+
 TEST_CASE("text/decode/core", "basic usages of decode function do not explode") {
 	SECTION("execution") {
 		ztd::text::execution_t encoding {};
@@ -119,3 +124,82 @@ TEST_CASE("text/decode/core", "basic usages of decode function do not explode")
 		REQUIRE(result1 == ztd::tests::u32_unicode_sequence_truth_native_endian);
 	}
 }
+
+TEST_CASE("text/decode/execution/bulk", "a UTF-8 execution encoding decodes and encodes many blocks at once") {
+	ztd::text::execution_t encoding {};
+	if (!ztd::text::contains_unicode_encoding(encoding)) {
+		return;
+	}
+	std::string input;
+	std::u32string expected;
+	for (int i = 0; i < 600; ++i) {
+		input.append(ztd::tests::unicode_sequence_truth_native_endian.begin(),
+		     ztd::tests::unicode_sequence_truth_native_endian.end());
+		expected.append(ztd::tests::u32_unicode_sequence_truth_native_endian.begin(),
+		     ztd::tests::u32_unicode_sequence_truth_native_endian.end());
+	}
+
+	SECTION("well-formed") {
+		std::u32string result0 = ztd::text::decode(input, encoding, ztd::text::replacement_handler);
+		REQUIRE(result0 == expected);
+		std::string result1 = ztd::text::encode(result0, encoding, ztd::text::replacement_handler);
+		REQUIRE(result1 == input);
+	}
+	SECTION("ill-formed") {
+		if (!ztd::is_execution_encoding_utf8()) {
+			return;
+		}
+		std::string bad_input = input;
+		bad_input.insert(ztd::tests::unicode_sequence_truth_native_endian.size() * 300, 1, static_cast<char>(0xFF));
+		auto result = ztd::text::decode_to(bad_input, encoding, ztd::text::replacement_handler);
+		REQUIRE(result.error_count == 1);
+		REQUIRE(result.output.size() == expected.size() + 1);
+	}
+}
+
+#if (ZTD_IS_ON(ZTD_HEADER_CUCHAR) || ZTD_IS_ON(ZTD_HEADER_UCHAR_H)) && ZTD_IS_OFF(ZTD_PLATFORM_MAC_OS)
+TEST_CASE("text/decode/execution/locale",
+     "execution states pick the ASCII or UTF-8 kernels for the locale they were made or refreshed in") {
+	const char* original_locale_name = std::setlocale(LC_ALL, nullptr);
+	const std::string original_locale(original_locale_name == nullptr ? "C" : original_locale_name);
+	ztd::text::execution_t encoding {};
+
+	SECTION("C") {
+		REQUIRE(std::setlocale(LC_ALL, "C") != nullptr);
+		auto state        = ztd::text::make_decode_state(encoding);
+		auto encode_state = ztd::text::make_encode_state(encoding);
+		std::string input;
+		std::u32string expected;
+		for (int i = 0; i < 600; ++i) {
+			input.append(ztd::tests::basic_source_character_set.begin(),
+			     ztd::tests::basic_source_character_set.end());
+			expected.append(ztd::tests::u32_basic_source_character_set.begin(),
+			     ztd::tests::u32_basic_source_character_set.end());
+		}
+		std::u32string result0 = ztd::text::decode(input, encoding, ztd::text::replacement_handler, state);
+		REQUIRE(result0 == expected);
+		std::string result1 = ztd::text::encode(result0, encoding, ztd::text::replacement_handler, encode_state);
+		REQUIRE(result1 == input);
+	}
+	SECTION("UTF-8") {
+		REQUIRE(std::setlocale(LC_ALL, "C") != nullptr);
+		auto state                      = ztd::text::make_decode_state(encoding);
+		const char* utf8_locale_names[] = { "C.UTF-8", "C.utf8", "en_US.UTF-8", "en_US.utf8" };
+		bool has_utf8_locale            = false;
+		for (const char* utf8_locale_name : utf8_locale_names) {
+			if (std::setlocale(LC_ALL, utf8_locale_name) != nullptr) {
+				has_utf8_locale = true;
+				break;
+			}
+		}
+		if (has_utf8_locale && ztd::is_execution_encoding_utf8()) {
+			// the state still describes the "C" locale until it is told to look again
+			state.refresh_locale();
+			std::u32string result = ztd::text::decode(ztd::tests::unicode_sequence_truth_native_endian, encoding,
+			     ztd::text::replacement_handler, state);
+			REQUIRE(result == ztd::tests::u32_unicode_sequence_truth_native_endian);
+		}
+	}
+	std::setlocale(LC_ALL, original_locale.c_str());
+}
+#endif
@@ -29,6 +29,7 @@
 // ============================================================================ //
 
 #include <ztd/text/decode_one.hpp>
+#include <ztd/text/decode.hpp>
 
 #include <ztd/text/encoding.hpp>
 
@@ -36,6 +37,8 @@
 
 #include <ztd/text/tests/basic_unicode_strings.hpp>
 
+#include <string>
+
 inline namespace ztd_text_tests_basic_run_time_decode_one {
 	template <typename Encoding, typename Source, typename Expected>
 	void check_decode_one(Encoding& encoding, Source& source, Expected& expected) {
@@ -121,3 +124,33 @@ TEST_CASE("decode_one can be used to decode a single bit of text at a time and w
 		     ztd::tests::u32_unicode_sequence_truth_native_endian);
 	}
 }
+
+TEST_CASE("text/decode_one/utf16/incomplete",
+     "a leading surrogate at the end of the input is reported as an incomplete sequence without reading past it") {
+	const char16_t input[] = { u'a', static_cast<char16_t>(0xD83D) };
+	ztd::span<const char16_t> input_view(input + 1, 1);
+	char32_t output[1] {};
+	std::size_t handler_calls = 0;
+	std::size_t progress_size = 0;
+	char16_t progress_unit    = 0;
+	auto recording_handler    = [&](const auto&, auto result, const auto& input_progress, const auto&) {
+		++handler_calls;
+		progress_size = input_progress.size();
+		if (!input_progress.empty()) {
+			progress_unit = input_progress[0];
+		}
+		return result;
+	};
+	ztd::text::decode_state_t<ztd::text::utf16_t> state {};
+	auto result = ztd::text::utf16.decode_one(input_view, ztd::span<char32_t>(output), recording_handler, state);
+	REQUIRE(result.error_code == ztd::text::encoding_error::incomplete_sequence);
+	REQUIRE(handler_calls == 1);
+	REQUIRE(progress_size == 1);
+	REQUIRE(progress_unit == static_cast<char16_t>(0xD83D));
+	REQUIRE(result.input.empty());
+	REQUIRE(result.output.size() == 1);
+
+	std::u32string replaced
+	     = ztd::text::decode(ztd::span<const char16_t>(input), ztd::text::utf16, ztd::text::replacement_handler);
+	REQUIRE(replaced == U"a\uFFFD");
+}
@@ -36,6 +36,43 @@
 #include <ztd/text/tests/basic_unicode_strings.hpp>
 
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+inline namespace ztd_text_tests_basic_run_time_encoding_scheme_transcode {
+	template <typename CodeUnit>
+	std::vector<std::byte> to_scheme_bytes(const std::basic_string<CodeUnit>& units, ztd::endian order) {
+		std::vector<std::byte> bytes;
+		for (CodeUnit unit : units) {
+			for (std::size_t i = 0; i < sizeof(CodeUnit); ++i) {
+				std::size_t shift = order == ztd::endian::big ? (sizeof(CodeUnit) - 1 - i) * 8 : i * 8;
+				bytes.push_back(static_cast<std::byte>((static_cast<std::uint_least32_t>(unit) >> shift) & 0xFF));
+			}
+		}
+		return bytes;
+	}
+
+	template <typename Encoding, ztd::endian Endian>
+	void check_bulk_scheme(const std::u32string& code_points) {
+		using CodeUnit = ztd::text::code_unit_t<Encoding>;
+		ztd::text::encoding_scheme<Encoding, Endian> encoding {};
+		std::basic_string<CodeUnit> units = ztd::text::encode(code_points, Encoding {});
+		std::vector<std::byte> bytes      = to_scheme_bytes(units, Endian);
+
+		std::u32string decoded = ztd::text::decode(bytes, encoding);
+		REQUIRE(decoded == code_points);
+		std::vector<std::byte> encoded = ztd::text::encode(code_points, encoding);
+		REQUIRE(encoded == bytes);
+
+		auto expected_utf8   = ztd::text::encode(code_points, ztd::text::utf8);
+		auto transcoded_utf8 = ztd::text::transcode(bytes, encoding, ztd::text::utf8);
+		REQUIRE(transcoded_utf8 == expected_utf8);
+		std::vector<std::byte> transcoded_bytes = ztd::text::transcode(transcoded_utf8, ztd::text::utf8, encoding);
+		REQUIRE(transcoded_bytes == bytes);
+	}
+} // namespace ztd_text_tests_basic_run_time_encoding_scheme_transcode
 
 TEST_CASE("text/transcode/encoding_scheme", "encode to byte arrays with specific endianness") {
 	SECTION("endian::native") {
@@ -169,3 +206,63 @@ TEST_CASE("text/transcode/encoding_scheme", "encode to byte arrays with specific
 		}
 	}
 }
+
+TEST_CASE("text/transcode/encoding_scheme/bulk", "byte-swapping UTF-16 and UTF-32 schemes over many blocks") {
+	std::u32string code_points;
+	for (int i = 0; i < 600; ++i) {
+		code_points.append(ztd::tests::u32_unicode_sequence_truth_native_endian.begin(),
+		     ztd::tests::u32_unicode_sequence_truth_native_endian.end());
+	}
+
+	SECTION("utf16") {
+		check_bulk_scheme<ztd::text::utf16_t, ztd::endian::big>(code_points);
+		check_bulk_scheme<ztd::text::utf16_t, ztd::endian::little>(code_points);
+	}
+	SECTION("utf32") {
+		check_bulk_scheme<ztd::text::utf32_t, ztd::endian::big>(code_points);
+		check_bulk_scheme<ztd::text::utf32_t, ztd::endian::little>(code_points);
+	}
+	SECTION("lone surrogate") {
+		std::u16string units(3000, u'a');
+		units[2000] = static_cast<char16_t>(0xD800);
+		std::vector<std::byte> bytes = to_scheme_bytes(units, ztd::endian::big);
+		ztd::text::encoding_scheme<ztd::text::utf16_t, ztd::endian::big> encoding {};
+
+		std::u32string expected(3000, U'a');
+		expected[2000]     = U'\uFFFD';
+		auto decode_result = ztd::text::decode_to(bytes, encoding, ztd::text::replacement_handler);
+		REQUIRE(decode_result.output == expected);
+		REQUIRE(decode_result.error_count == 1);
+
+		auto expected_utf8   = ztd::text::encode(expected, ztd::text::utf8);
+		auto transcoded_utf8
+		     = ztd::text::transcode(bytes, encoding, ztd::text::utf8, ztd::text::replacement_handler);
+		REQUIRE(transcoded_utf8 == expected_utf8);
+	}
+	SECTION("truncated input") {
+		// the last code unit is the first half of a surrogate pair whose second half never arrives
+		std::u16string units(3000, u'a');
+		units.push_back(static_cast<char16_t>(0xD83D));
+		std::vector<std::byte> bytes = to_scheme_bytes(units, ztd::endian::big);
+		ztd::text::encoding_scheme<ztd::text::utf16_t, ztd::endian::big> encoding {};
+
+		using Utf8CodeUnit = ztd::text::code_unit_t<ztd::text::utf8_t>;
+		std::vector<Utf8CodeUnit> output(units.size() * 4);
+		auto from_state = ztd::text::make_decode_state(encoding);
+		auto to_state   = ztd::text::make_encode_state(ztd::text::utf8);
+		auto result     = ztd::text::transcode_into_raw(bytes, encoding, ztd::span<Utf8CodeUnit>(output),
+		         ztd::text::utf8, ztd::text::pass_handler, ztd::text::pass_handler, from_state, to_state);
+		REQUIRE(result.error_code == ztd::text::encoding_error::incomplete_sequence);
+		// every whole code point before the truncated one was written, and the leading surrogate was read
+		REQUIRE(std::size(result.input) == 0);
+		REQUIRE(static_cast<std::size_t>(result.output.data() - output.data()) == 3000);
+		REQUIRE(std::all_of(output.cbegin(), output.cbegin() + 3000,
+		     [](Utf8CodeUnit unit) { return unit == static_cast<Utf8CodeUnit>('a'); }));
+
+		std::u32string expected(3000, U'a');
+		expected.push_back(U'\uFFFD');
+		auto expected_utf8 = ztd::text::encode(expected, ztd::text::utf8);
+		auto replaced      = ztd::text::transcode(bytes, encoding, ztd::text::utf8, ztd::text::replacement_handler);
+		REQUIRE(replaced == expected_utf8);
+	}
+}
@@ -34,6 +34,9 @@
 
 #include <catch2/catch_all.hpp>
 
+#include <algorithm>
+#include <string>
+
 #include <ztd/text/tests/basic_unicode_strings.hpp>
 
 inline namespace ztd_text_tests_basic_run_time_errors_replacement {
@@ -143,3 +146,50 @@ TEST_CASE("text/encoding/errors/replacement", "invalid characters are properly r
 		}
 	}
 }
+
+TEST_CASE("text/encoding/errors/replacement/run",
+     "runs of invalid characters are replaced in one error handler call, just like the replacement handler would") {
+	std::string input;
+	std::size_t run_count = 0;
+	for (int i = 0; i < 50; ++i) {
+		input.append("abc");
+		input.append("\xFF\xFE\x80\x80\xC0");
+		input.append("d\xC3\xA9" "f");
+		input.append("\xED\xA0\x80\xF8\x88\x80\x80\x80");
+		input.append("ghi");
+		run_count += 2;
+	}
+
+	SECTION("decode") {
+		auto expected = ztd::text::decode_to(input, ztd::text::compat_utf8, ztd::text::replacement_handler);
+		auto result   = ztd::text::decode_to(input, ztd::text::compat_utf8, ztd::text::run_replacement_handler);
+		REQUIRE(result.error_code == ztd::text::encoding_error::ok);
+		REQUIRE(result.error_count == expected.error_count);
+		REQUIRE(result.output == expected.output);
+	}
+	SECTION("transcode") {
+		auto expected = ztd::text::transcode_to(
+		     input, ztd::text::compat_utf8, ztd::text::utf16, ztd::text::replacement_handler);
+		auto result = ztd::text::transcode_to(
+		     input, ztd::text::compat_utf8, ztd::text::utf16, ztd::text::run_replacement_handler);
+		REQUIRE(result.error_count == expected.error_count);
+		REQUIRE(result.output == expected.output);
+	}
+	SECTION("collapse runs") {
+		auto expected = ztd::text::decode_to(input, ztd::text::compat_utf8, ztd::text::replacement_handler);
+		auto result
+		     = ztd::text::decode_to(input, ztd::text::compat_utf8, ztd::text::run_replacement_handler_t(true));
+		REQUIRE(result.error_count == expected.error_count);
+		using code_point          = ztd::text::code_point_t<ztd::text::compat_utf8_t>;
+		const code_point replaced = static_cast<code_point>(U'\uFFFD');
+		decltype(expected.output) collapsed;
+		for (code_point c : expected.output) {
+			if (c == replaced && !collapsed.empty() && collapsed.back() == replaced) {
+				continue;
+			}
+			collapsed.push_back(c);
+		}
+		REQUIRE(result.output == collapsed);
+		REQUIRE(static_cast<std::size_t>(std::count(collapsed.begin(), collapsed.end(), replaced)) == run_count);
+	}
+}
@@ -0,0 +1,109 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#include <ztd/text/normalization.hpp>
+#include <ztd/text/normalized_view.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <string>
+#include <vector>
+
+inline namespace ztd_text_tests_basic_run_time_normalization {
+	template <typename NormalizationForm>
+	std::u32string normalize(NormalizationForm form, std::u32string_view input) {
+		std::vector<char32_t> output(input.size() * 18 + 1);
+		auto result = form(input, ztd::span<char32_t>(output));
+		REQUIRE(result.error_code == ztd::text::normalization_error::ok);
+		REQUIRE(ztd::ranges::empty(result.input));
+		return std::u32string(output.data(), output.size() - ztd::ranges::size(result.output));
+	}
+} // namespace ztd_text_tests_basic_run_time_normalization
+
+TEST_CASE("text/normalization/forms", "the Unicode Normalization Forms produce the expected sequences") {
+	// ANGSTROM SIGN, LATIN SMALL LIGATURE FI, a Hangul syllable, and a + circumflex + dot below (out of order)
+	constexpr std::u32string_view input = U"AÅﬁ한ậ!";
+	SECTION("nfd") {
+		REQUIRE(normalize(ztd::text::nfd {}, input) == U"AÅﬁ한ậ!");
+	}
+	SECTION("nfc") {
+		REQUIRE(normalize(ztd::text::nfc {}, input) == U"AÅﬁ한ậ!");
+	}
+	SECTION("nfkd") {
+		REQUIRE(normalize(ztd::text::nfkd {}, input) == U"AÅfi한ậ!");
+	}
+	SECTION("nfkc") {
+		REQUIRE(normalize(ztd::text::nfkc {}, input) == U"AÅfi한ậ!");
+	}
+	SECTION("fcc") {
+		// a mark only composes with the starter it directly follows
+		REQUIRE(normalize(ztd::text::fcc {}, U"á̖") == U"á̖");
+		REQUIRE(normalize(ztd::text::nfc {}, U"á̖") == U"á̖");
+	}
+	SECTION("already normalized") {
+		constexpr std::u32string_view ascii = U"The quick brown fox jumps over the lazy dog.";
+		REQUIRE(normalize(ztd::text::nfc {}, ascii) == ascii);
+		REQUIRE(normalize(ztd::text::nfkd {}, ascii) == ascii);
+	}
+	SECTION("stream-safe") {
+		// more than 30 non-starters in a row get a U+034F COMBINING GRAPHEME JOINER
+		std::u32string marks = U"a";
+		marks.append(40, U'́');
+		std::u32string expected = U"á";
+		expected.append(29, U'́');
+		expected.push_back(U'͏');
+		expected.append(10, U'́');
+		REQUIRE(normalize(ztd::text::nfc {}, marks) == expected);
+	}
+	SECTION("insufficient output") {
+		// output is only ever cut at a segment boundary
+		constexpr std::u32string_view pieces = U"ééé";
+		char32_t output[2] {};
+		auto result = ztd::text::nfc {}(pieces, ztd::span<char32_t>(output));
+		REQUIRE(result.error_code == ztd::text::normalization_error::insufficient_output);
+		REQUIRE(ztd::ranges::size(result.output) == 0);
+		REQUIRE(ztd::ranges::size(result.input) == 2);
+		REQUIRE(output[0] == U'é');
+		REQUIRE(output[1] == U'é');
+	}
+}
+
+TEST_CASE("text/normalization/normalized_view", "normalized_view walks over the normalized code points") {
+	std::u32string input(300, U'x');
+	input += U"Å한";
+	std::u32string expected(300, U'x');
+	expected += U"Å한";
+	ztd::text::normalized_view<ztd::text::nfd, std::u32string_view> view(input);
+	std::u32string normalized;
+	for (char32_t code_point : view) {
+		normalized.push_back(code_point);
+	}
+	REQUIRE(normalized == expected);
+}
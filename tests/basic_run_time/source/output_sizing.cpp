@@ -0,0 +1,142 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#include <ztd/text/output_sizing.hpp>
+#include <ztd/text/decode.hpp>
+#include <ztd/text/encode.hpp>
+#include <ztd/text/transcode.hpp>
+#include <ztd/text/encoding.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <ztd/text/tests/basic_unicode_strings.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <string>
+#include <vector>
+
+inline namespace ztd_text_tests_basic_run_time_output_sizing {
+	template <typename Sizing>
+	void check_output_sizing(const Sizing& sizing) {
+		using u8string = std::basic_string<ztd::uchar8_t>;
+		u8string u8_input;
+		std::u32string u32_expected;
+		for (int i = 0; i < 100; ++i) {
+			u8_input.append(ztd::tests::u8_unicode_sequence_truth_native_endian.begin(),
+			     ztd::tests::u8_unicode_sequence_truth_native_endian.end());
+			u32_expected.append(ztd::tests::u32_unicode_sequence_truth_native_endian.begin(),
+			     ztd::tests::u32_unicode_sequence_truth_native_endian.end());
+		}
+		std::u16string u16_expected = ztd::text::transcode(u8_input, ztd::text::utf8, ztd::text::utf16);
+
+		auto decode_result = ztd::text::decode_to<std::vector<char32_t>>(sizing, u8_input, ztd::text::utf8);
+		REQUIRE(decode_result.error_code == ztd::text::encoding_error::ok);
+		REQUIRE(std::equal(decode_result.output.cbegin(), decode_result.output.cend(), u32_expected.cbegin(),
+		     u32_expected.cend()));
+
+		auto encode_result = ztd::text::encode_to<u8string>(sizing, u32_expected, ztd::text::utf8);
+		REQUIRE(encode_result.error_code == ztd::text::encoding_error::ok);
+		REQUIRE(encode_result.output == u8_input);
+
+		auto transcode_result = ztd::text::transcode_to<std::vector<char16_t>>(
+		     sizing, u8_input, ztd::text::utf8, ztd::text::utf16, ztd::text::replacement_handler);
+		REQUIRE(transcode_result.error_code == ztd::text::encoding_error::ok);
+		REQUIRE(std::equal(transcode_result.output.cbegin(), transcode_result.output.cend(), u16_expected.cbegin(),
+		     u16_expected.cend()));
+
+		auto deque_result = ztd::text::transcode_to<std::deque<char16_t>>(
+		     sizing, u8_input, ztd::text::utf8, ztd::text::utf16, ztd::text::replacement_handler);
+		REQUIRE(deque_result.error_code == ztd::text::encoding_error::ok);
+		REQUIRE(std::equal(
+		     deque_result.output.cbegin(), deque_result.output.cend(), u16_expected.cbegin(), u16_expected.cend()));
+	}
+} // namespace ztd_text_tests_basic_run_time_output_sizing
+
+TEST_CASE("text/output_sizing", "every output sizing policy produces the same output") {
+	SECTION("default") {
+		check_output_sizing(ztd::text::default_output_sizing);
+	}
+	SECTION("exact") {
+		check_output_sizing(ztd::text::exact_output_sizing);
+	}
+	SECTION("upper_bound") {
+		check_output_sizing(ztd::text::upper_bound_output_sizing);
+	}
+	SECTION("adaptive") {
+		check_output_sizing(ztd::text::adaptive_output_sizing);
+	}
+	SECTION("user_hint") {
+		check_output_sizing(ztd::text::user_hint_output_sizing_t(10));
+		check_output_sizing(ztd::text::user_hint_output_sizing_t(100000));
+	}
+}
+
+TEST_CASE("text/output_sizing/reservation", "output sizing policies reserve what they promise") {
+	std::basic_string<ztd::uchar8_t> input;
+	for (int i = 0; i < 100; ++i) {
+		input.append(ztd::tests::u8_unicode_sequence_truth_native_endian.begin(),
+		     ztd::tests::u8_unicode_sequence_truth_native_endian.end());
+	}
+	const std::size_t headroom = ztd::text::max_transcode_code_units_v<ztd::text::utf8_t, ztd::text::utf16_t> * 2;
+	std::vector<char16_t> expected
+	     = ztd::text::transcode<std::vector<char16_t>>(input, ztd::text::utf8, ztd::text::utf16);
+	SECTION("exact") {
+		auto result = ztd::text::transcode_to<std::vector<char16_t>>(
+		     ztd::text::exact_output_sizing, input, ztd::text::utf8, ztd::text::utf16);
+		REQUIRE(result.output == expected);
+		REQUIRE(result.output.capacity() <= expected.size() + headroom);
+	}
+	SECTION("upper_bound") {
+		auto result = ztd::text::transcode_to<std::vector<char16_t>>(
+		     ztd::text::upper_bound_output_sizing, input, ztd::text::utf8, ztd::text::utf16);
+		REQUIRE(result.output == expected);
+		REQUIRE(result.output.capacity() >= input.size() * 2);
+	}
+	SECTION("user_hint") {
+		auto result = ztd::text::transcode_to<std::vector<char16_t>>(
+		     ztd::text::user_hint_output_sizing_t(50000), input, ztd::text::utf8, ztd::text::utf16);
+		REQUIRE(result.output == expected);
+		REQUIRE(result.output.capacity() >= 50000);
+	}
+	SECTION("adaptive") {
+		// the first conversions teach this thread the ratio, which the last one reserves by
+		for (int i = 0; i < 2; ++i) {
+			auto result = ztd::text::transcode_to<std::vector<char16_t>>(
+			     ztd::text::adaptive_output_sizing, input, ztd::text::utf8, ztd::text::utf16);
+			REQUIRE(result.output == expected);
+		}
+		auto result = ztd::text::transcode_to<std::vector<char16_t>>(
+		     ztd::text::adaptive_output_sizing, input, ztd::text::utf8, ztd::text::utf16);
+		REQUIRE(result.output == expected);
+		REQUIRE(result.output.capacity() <= expected.size() + (expected.size() / 4) + headroom);
+	}
+}
@@ -0,0 +1,155 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#include <ztd/text/parallel_transcode.hpp>
+#include <ztd/text/transcode.hpp>
+#include <ztd/idk/span.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <ztd/text/tests/basic_unicode_strings.hpp>
+
+#include <vector>
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+
+inline namespace ztd_text_tests_basic_run_time_parallel_transcode {
+	// small pieces and a fixed thread count, so that even test-sized inputs are split many times over
+	inline constexpr ztd::text::parallel_policy test_policy = { 4, 16 };
+
+	template <typename FromEncoding, typename Input, typename IllFormed>
+	std::vector<ztd::text::code_unit_t<FromEncoding>> make_large_input(
+	     const Input& input, const IllFormed& ill_formed) {
+		using CodeUnit = ztd::text::code_unit_t<FromEncoding>;
+		std::vector<CodeUnit> large_input;
+		for (std::size_t i = 0; i < 64; ++i) {
+			large_input.insert(large_input.cend(), std::cbegin(input), std::cend(input));
+			if ((i % 5) == 2) {
+				large_input.insert(large_input.cend(), std::cbegin(ill_formed), std::cend(ill_formed));
+			}
+		}
+		return large_input;
+	}
+
+	template <typename FromEncoding, typename ToEncoding, typename Input>
+	void check_parallel_transcode(FromEncoding& from, ToEncoding& to, const Input& input) {
+		using FromCodeUnit = ztd::text::code_unit_t<FromEncoding>;
+		using ToCodeUnit   = ztd::text::code_unit_t<ToEncoding>;
+		using Range        = ztd::span<const FromCodeUnit>;
+		const Range input_view(input.data(), input.size());
+		SECTION("replacement") {
+			auto expected_result = ztd::text::transcode_to(
+			     input_view, from, to, ztd::text::replacement_handler, ztd::text::replacement_handler);
+			auto result = ztd::text::parallel_transcode_to(
+			     test_policy, input_view, from, to, ztd::text::replacement_handler, ztd::text::replacement_handler);
+			REQUIRE(result.error_code == expected_result.error_code);
+			REQUIRE(result.error_count == expected_result.error_count);
+			REQUIRE(result.input.empty());
+			REQUIRE(result.output == expected_result.output);
+		}
+		SECTION("stop on error") {
+			std::vector<ToCodeUnit> expected_output(input.size() * 4);
+			std::vector<ToCodeUnit> output(input.size() * 4);
+			auto expected_result = ztd::text::transcode_into_raw(input_view, from, expected_output, to,
+			     ztd::text::pass_handler_t {}, ztd::text::pass_handler_t {});
+			auto result          = ztd::text::parallel_transcode_into_raw(test_policy, input_view, from, output, to,
+			              ztd::text::pass_handler_t {}, ztd::text::pass_handler_t {});
+			const std::size_t expected_written = expected_output.size() - std::size(expected_result.output);
+			const std::size_t written          = output.size() - result.output.size();
+			REQUIRE(result.error_code == expected_result.error_code);
+			REQUIRE(result.error_count == expected_result.error_count);
+			REQUIRE(result.input.size() == std::size(expected_result.input));
+			REQUIRE(written == expected_written);
+			REQUIRE(std::equal(output.data(), output.data() + written, expected_output.data()));
+		}
+		SECTION("insufficient output space") {
+			const auto full_output = ztd::text::transcode(
+			     input_view, from, to, ztd::text::replacement_handler, ztd::text::replacement_handler);
+			std::vector<ToCodeUnit> expected_output(full_output.size() / 2);
+			std::vector<ToCodeUnit> output(full_output.size() / 2);
+			auto expected_result = ztd::text::transcode_into_raw(input_view, from, expected_output, to,
+			     ztd::text::replacement_handler, ztd::text::replacement_handler);
+			auto result          = ztd::text::parallel_transcode_into_raw(test_policy, input_view, from, output, to,
+			              ztd::text::replacement_handler, ztd::text::replacement_handler);
+			REQUIRE(result.error_code == ztd::text::encoding_error::insufficient_output_space);
+			REQUIRE(result.error_code == expected_result.error_code);
+			REQUIRE(result.error_count == expected_result.error_count);
+			REQUIRE(result.input.size() == std::size(expected_result.input));
+			REQUIRE(result.output.size() == std::size(expected_result.output));
+			REQUIRE(output == expected_output);
+		}
+	}
+
+	inline constexpr ztd::uchar8_t u8_ill_formed[] = { 0x61, 0xC3, 0xFF, 0xE2, 0x82, 0xF0, 0x9F, 0x98, 0xC3 };
+	inline constexpr char16_t u16_ill_formed[]     = { 0x0061, 0xD83D, 0x0062, 0xDE00, 0xD83D };
+	inline constexpr char32_t u32_ill_formed[]     = { 0x0061, 0xD800, 0x110000, 0x0062 };
+} // namespace ztd_text_tests_basic_run_time_parallel_transcode
+
+TEST_CASE("text/parallel_transcode/basic", "parallel transcoding produces exactly what transcoding does") {
+	SECTION("utf8") {
+		ztd::text::utf8_t from {};
+		ztd::text::utf16_t to {};
+		const auto input = make_large_input<ztd::text::utf8_t>(
+		     ztd::tests::u8_unicode_sequence_truth_native_endian, u8_ill_formed);
+		check_parallel_transcode(from, to, input);
+	}
+	SECTION("utf16") {
+		ztd::text::utf16_t from {};
+		ztd::text::utf8_t to {};
+		const auto input = make_large_input<ztd::text::utf16_t>(
+		     ztd::tests::u16_unicode_sequence_truth_native_endian, u16_ill_formed);
+		check_parallel_transcode(from, to, input);
+	}
+	SECTION("utf32") {
+		ztd::text::utf32_t from {};
+		ztd::text::utf8_t to {};
+		const auto input = make_large_input<ztd::text::utf32_t>(
+		     ztd::tests::u32_unicode_sequence_truth_native_endian, u32_ill_formed);
+		check_parallel_transcode(from, to, input);
+	}
+	SECTION("utf32 split at the last code point") {
+		ztd::text::utf32_t from {};
+		ztd::text::utf8_t to {};
+		// every piece has to start on U+10FFFF, the last code point, which is as valid a split point as any other
+		const std::vector<char32_t> input(256, static_cast<char32_t>(0x10FFFF));
+		check_parallel_transcode(from, to, input);
+	}
+	SECTION("small input") {
+		ztd::text::utf8_t from {};
+		ztd::text::utf32_t to {};
+		const ztd::span<const ztd::uchar8_t> input(u8_ill_formed);
+		const auto expected_output = ztd::text::transcode(
+		     input, from, to, ztd::text::replacement_handler, ztd::text::replacement_handler);
+		const auto output = ztd::text::parallel_transcode(
+		     ztd::text::parallel, input, from, to, ztd::text::replacement_handler, ztd::text::replacement_handler);
+		REQUIRE(output == expected_output);
+	}
+}
@@ -0,0 +1,328 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#include <ztd/text/decode.hpp>
+#include <ztd/text/encode.hpp>
+#include <ztd/text/transcode.hpp>
+#include <ztd/text/count_as_decoded.hpp>
+#include <ztd/text/count_as_encoded.hpp>
+#include <ztd/text/count_as_transcoded.hpp>
+#include <ztd/text/validate_decodable_as.hpp>
+#include <ztd/text/validate_encodable_as.hpp>
+#include <ztd/text/validate_transcodable_as.hpp>
+#include <ztd/idk/span.hpp>
+#include <ztd/idk/tag.hpp>
+#include <ztd/ranges/subrange.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <ztd/text/tests/basic_unicode_strings.hpp>
+
+#include <vector>
+#include <string>
+#include <string_view>
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+inline namespace ztd_text_tests_basic_run_time_segmented_range {
+	inline constexpr ztd::uchar8_t u8_ill_formed[] = { 0x61, 0xC3, 0xFF, 0xE2, 0x82, 0xF0, 0x9F, 0x98, 0xC3 };
+
+	// A tiny stateful encoding: 0x0E switches between lower and upper case for the letters that follow it. The
+	// switch is read as part of the decode step of the next letter, so a segment that ends right after it has
+	// already changed the state by the time the step reports an incomplete sequence.
+	struct toggling_ascii {
+		struct state {
+			bool upper = false;
+		};
+
+		using code_unit    = char;
+		using code_point   = char32_t;
+		using decode_state = state;
+		using encode_state = state;
+
+		static inline constexpr std::size_t max_code_units  = 2;
+		static inline constexpr std::size_t max_code_points = 1;
+		static inline constexpr char toggle                 = '\x0E';
+
+		template <typename Input, typename Output, typename ErrorHandler>
+		static constexpr auto decode_one(Input&& input, Output&& output, ErrorHandler&& error_handler, state& s) {
+			using SubInput  = ztd::ranges::csubrange_for_t<std::remove_reference_t<Input>>;
+			using SubOutput = ztd::ranges::subrange_for_t<std::remove_reference_t<Output>>;
+			using Result    = ztd::text::decode_result<SubInput, SubOutput, state>;
+
+			auto in_it    = ztd::ranges::cbegin(input);
+			auto in_last  = ztd::ranges::cend(input);
+			auto out_it   = ztd::ranges::begin(output);
+			auto out_last = ztd::ranges::end(output);
+			code_unit units[max_code_units] {};
+			std::size_t units_read = 0;
+			if (in_it != in_last && *in_it == toggle) {
+				units[units_read++] = *in_it;
+				s.upper             = !s.upper;
+				ztd::ranges::iter_advance(in_it);
+				if (in_it == in_last) {
+					return std::forward<ErrorHandler>(error_handler)(toggling_ascii {},
+					     Result(SubInput(std::move(in_it), std::move(in_last)),
+					          SubOutput(std::move(out_it), std::move(out_last)), s,
+					          ztd::text::encoding_error::incomplete_sequence),
+					     ztd::span<const code_unit>(units, units_read), ztd::span<const code_point>());
+				}
+			}
+			if (in_it == in_last) {
+				return Result(SubInput(std::move(in_it), std::move(in_last)),
+				     SubOutput(std::move(out_it), std::move(out_last)), s, ztd::text::encoding_error::ok);
+			}
+			if (out_it == out_last) {
+				return std::forward<ErrorHandler>(error_handler)(toggling_ascii {},
+				     Result(SubInput(std::move(in_it), std::move(in_last)),
+				          SubOutput(std::move(out_it), std::move(out_last)), s,
+				          ztd::text::encoding_error::insufficient_output_space),
+				     ztd::span<const code_unit>(units, units_read), ztd::span<const code_point>());
+			}
+			const char unit = *in_it;
+			ztd::ranges::iter_advance(in_it);
+			*out_it = static_cast<code_point>(s.upper && unit >= 'a' && unit <= 'z' ? unit - 'a' + 'A' : unit);
+			ztd::ranges::iter_advance(out_it);
+			return Result(SubInput(std::move(in_it), std::move(in_last)),
+			     SubOutput(std::move(out_it), std::move(out_last)), s, ztd::text::encoding_error::ok);
+		}
+
+		template <typename Input, typename Output, typename ErrorHandler>
+		static constexpr auto encode_one(Input&& input, Output&& output, ErrorHandler&&, state& s) {
+			using SubInput  = ztd::ranges::csubrange_for_t<std::remove_reference_t<Input>>;
+			using SubOutput = ztd::ranges::subrange_for_t<std::remove_reference_t<Output>>;
+			using Result    = ztd::text::encode_result<SubInput, SubOutput, state>;
+
+			auto in_it    = ztd::ranges::cbegin(input);
+			auto in_last  = ztd::ranges::cend(input);
+			auto out_it   = ztd::ranges::begin(output);
+			auto out_last = ztd::ranges::end(output);
+			if (in_it != in_last && out_it != out_last) {
+				*out_it = static_cast<code_unit>(*in_it);
+				ztd::ranges::iter_advance(in_it);
+				ztd::ranges::iter_advance(out_it);
+			}
+			return Result(SubInput(std::move(in_it), std::move(in_last)),
+			     SubOutput(std::move(out_it), std::move(out_last)), s, ztd::text::encoding_error::ok);
+		}
+	};
+
+	// a forward iterator over a list of separately-allocated chunks, like the pieces of a rope
+	template <typename Unit>
+	struct chunked_iterator {
+		using value_type        = Unit;
+		using difference_type   = std::ptrdiff_t;
+		using pointer           = const Unit*;
+		using reference         = const Unit&;
+		using iterator_category = std::forward_iterator_tag;
+		using iterator_concept  = std::forward_iterator_tag;
+
+		const std::vector<std::vector<Unit>>* chunks = nullptr;
+		std::size_t chunk_index                      = 0;
+		std::size_t offset                           = 0;
+
+		reference operator*() const {
+			return (*chunks)[chunk_index][offset];
+		}
+
+		chunked_iterator& operator++() {
+			++offset;
+			if (offset == (*chunks)[chunk_index].size()) {
+				++chunk_index;
+				offset = 0;
+			}
+			return *this;
+		}
+
+		chunked_iterator operator++(int) {
+			chunked_iterator copy = *this;
+			++*this;
+			return copy;
+		}
+
+		friend bool operator==(const chunked_iterator& left, const chunked_iterator& right) {
+			return left.chunk_index == right.chunk_index && left.offset == right.offset;
+		}
+
+		friend bool operator!=(const chunked_iterator& left, const chunked_iterator& right) {
+			return !(left == right);
+		}
+	};
+
+	template <typename Unit>
+	ztd::span<const Unit> text_segment(ztd::tag<chunked_iterator<Unit>>, const chunked_iterator<Unit>& first,
+	     const chunked_iterator<Unit>& last) {
+		const std::vector<Unit>& chunk = (*first.chunks)[first.chunk_index];
+		std::size_t segment_last       = first.chunk_index == last.chunk_index ? last.offset : chunk.size();
+		return ztd::span<const Unit>(chunk.data() + first.offset, segment_last - first.offset);
+	}
+
+	template <typename Unit>
+	struct chunked_units {
+		std::vector<std::vector<Unit>> chunks;
+
+		chunked_units(ztd::span<const Unit> input, std::size_t chunk_size) {
+			for (std::size_t first = 0; first < input.size(); first += chunk_size) {
+				std::size_t last = std::min(first + chunk_size, input.size());
+				chunks.emplace_back(input.data() + first, input.data() + last);
+			}
+		}
+
+		ztd::ranges::subrange<chunked_iterator<Unit>, chunked_iterator<Unit>> view() const {
+			return { chunked_iterator<Unit> { &chunks, 0, 0 },
+			     chunked_iterator<Unit> { &chunks, chunks.size(), 0 } };
+		}
+	};
+
+	template <typename Result>
+	std::size_t input_left(const Result& result) {
+		return static_cast<std::size_t>(std::distance(result.input.begin(), result.input.end()));
+	}
+
+	template <typename FromEncoding, typename ToEncoding, typename Input>
+	void check_segmented(const Input& input) {
+		using FromCodeUnit  = ztd::text::code_unit_t<FromEncoding>;
+		using FromCodePoint = ztd::text::code_point_t<FromEncoding>;
+		const ztd::span<const FromCodeUnit> input_view(std::data(input), std::size(input));
+
+		auto expected_decode    = ztd::text::decode_to(input_view, FromEncoding {}, ztd::text::replacement_handler);
+		auto expected_transcode = ztd::text::transcode_to(input_view, FromEncoding {}, ToEncoding {},
+		     ztd::text::replacement_handler, ztd::text::replacement_handler);
+		auto expected_encode
+		     = ztd::text::encode_to(expected_decode.output, ToEncoding {}, ztd::text::replacement_handler);
+		auto expected_count
+		     = ztd::text::count_as_decoded(input_view, FromEncoding {}, ztd::text::replacement_handler);
+		auto expected_transcode_count = ztd::text::count_as_transcoded(input_view, FromEncoding {}, ToEncoding {},
+		     ztd::text::replacement_handler, ztd::text::replacement_handler);
+		auto expected_encode_count
+		     = ztd::text::count_as_encoded(expected_decode.output, ToEncoding {}, ztd::text::replacement_handler);
+		auto expected_decodable    = ztd::text::validate_decodable_as(input_view, FromEncoding {});
+		auto expected_transcodable = ztd::text::validate_transcodable_as(input_view, FromEncoding {}, ToEncoding {});
+		auto expected_encodable    = ztd::text::validate_encodable_as(expected_decode.output, ToEncoding {});
+
+		for (std::size_t chunk_size : { 1, 2, 3, 5, 7, 64 }) {
+			chunked_units<FromCodeUnit> chunked_input(input_view, chunk_size);
+			chunked_units<FromCodePoint> chunked_decoded(expected_decode.output, chunk_size);
+
+			auto decode_result = ztd::text::decode_to(
+			     chunked_input.view(), FromEncoding {}, ztd::text::replacement_handler);
+			REQUIRE(decode_result.error_code == expected_decode.error_code);
+			REQUIRE(decode_result.error_count == expected_decode.error_count);
+			REQUIRE(input_left(decode_result) == 0);
+			REQUIRE(decode_result.output == expected_decode.output);
+
+			auto transcode_result = ztd::text::transcode_to(chunked_input.view(), FromEncoding {}, ToEncoding {},
+			     ztd::text::replacement_handler, ztd::text::replacement_handler);
+			REQUIRE(transcode_result.error_code == expected_transcode.error_code);
+			REQUIRE(transcode_result.error_count == expected_transcode.error_count);
+			REQUIRE(input_left(transcode_result) == 0);
+			REQUIRE(transcode_result.output == expected_transcode.output);
+
+			auto encode_result
+			     = ztd::text::encode_to(chunked_decoded.view(), ToEncoding {}, ztd::text::replacement_handler);
+			REQUIRE(encode_result.error_code == expected_encode.error_code);
+			REQUIRE(encode_result.error_count == expected_encode.error_count);
+			REQUIRE(input_left(encode_result) == 0);
+			REQUIRE(encode_result.output == expected_encode.output);
+
+			auto count_result = ztd::text::count_as_decoded(
+			     chunked_input.view(), FromEncoding {}, ztd::text::replacement_handler);
+			REQUIRE(count_result.count == expected_count.count);
+			REQUIRE(count_result.error_count == expected_count.error_count);
+
+			auto transcode_count_result = ztd::text::count_as_transcoded(chunked_input.view(), FromEncoding {},
+			     ToEncoding {}, ztd::text::replacement_handler, ztd::text::replacement_handler);
+			REQUIRE(transcode_count_result.count == expected_transcode_count.count);
+			REQUIRE(transcode_count_result.error_count == expected_transcode_count.error_count);
+
+			auto encode_count_result = ztd::text::count_as_encoded(
+			     chunked_decoded.view(), ToEncoding {}, ztd::text::replacement_handler);
+			REQUIRE(encode_count_result.count == expected_encode_count.count);
+			REQUIRE(encode_count_result.error_count == expected_encode_count.error_count);
+
+			auto decodable_result = ztd::text::validate_decodable_as(chunked_input.view(), FromEncoding {});
+			REQUIRE(decodable_result.valid == expected_decodable.valid);
+			REQUIRE(input_left(decodable_result) == expected_decodable.input.size());
+
+			auto transcodable_result
+			     = ztd::text::validate_transcodable_as(chunked_input.view(), FromEncoding {}, ToEncoding {});
+			REQUIRE(transcodable_result.valid == expected_transcodable.valid);
+			REQUIRE(input_left(transcodable_result) == expected_transcodable.input.size());
+
+			auto encodable_result = ztd::text::validate_encodable_as(chunked_decoded.view(), ToEncoding {});
+			REQUIRE(encodable_result.valid == expected_encodable.valid);
+			REQUIRE(input_left(encodable_result) == expected_encodable.input.size());
+		}
+	}
+} // namespace ztd_text_tests_basic_run_time_segmented_range
+
+TEST_CASE("text/segmented_range",
+     "converting a range with text_segment gives the same results as converting the same units laid out flat") {
+	SECTION("well-formed") {
+		SECTION("utf8 to utf16") {
+			check_segmented<ztd::text::utf8_t, ztd::text::utf16_t>(
+			     ztd::tests::u8_unicode_sequence_truth_native_endian);
+		}
+		SECTION("utf16 to utf8") {
+			check_segmented<ztd::text::utf16_t, ztd::text::utf8_t>(
+			     ztd::tests::u16_unicode_sequence_truth_native_endian);
+		}
+		SECTION("utf32 to utf16") {
+			check_segmented<ztd::text::utf32_t, ztd::text::utf16_t>(
+			     ztd::tests::u32_unicode_sequence_truth_native_endian);
+		}
+	}
+	SECTION("ill-formed") {
+		std::vector<ztd::uchar8_t> input;
+		for (std::size_t i = 0; i < 8; ++i) {
+			input.insert(input.cend(), std::cbegin(ztd::tests::u8_unicode_sequence_truth_native_endian),
+			     std::cend(ztd::tests::u8_unicode_sequence_truth_native_endian));
+			input.insert(input.cend(), std::cbegin(u8_ill_formed), std::cend(u8_ill_formed));
+		}
+		check_segmented<ztd::text::utf8_t, ztd::text::utf16_t>(input);
+	}
+	SECTION("stateful") {
+		std::string input;
+		for (std::size_t i = 0; i < 4; ++i) {
+			input += "ab\x0E" "cd\x0E" "ef";
+		}
+		auto expected
+		     = ztd::text::decode_to(std::string_view(input), toggling_ascii {}, ztd::text::replacement_handler);
+		REQUIRE(expected.output == U"abCDefabCDefabCDefabCDef");
+		check_segmented<toggling_ascii, ztd::text::utf32_t>(input);
+	}
+	SECTION("incomplete at the end of the input") {
+		const ztd::uchar8_t input[] = { 0x61, 0xF0, 0x9F, 0x98, 0x80, 0x62, 0xF0, 0x9F, 0x98 };
+		check_segmented<ztd::text::utf8_t, ztd::text::utf16_t>(input);
+	}
+}
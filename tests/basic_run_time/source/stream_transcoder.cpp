@@ -0,0 +1,245 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#include <ztd/text/stream_transcoder.hpp>
+#include <ztd/text/transcode.hpp>
+#include <ztd/idk/span.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <ztd/text/tests/basic_unicode_strings.hpp>
+
+#include <vector>
+#include <string>
+#include <string_view>
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+inline namespace ztd_text_tests_basic_run_time_stream_transcoder {
+	inline constexpr ztd::uchar8_t u8_ill_formed[] = { 0x61, 0xC3, 0xFF, 0xE2, 0x82, 0xF0, 0x9F, 0x98, 0xC3 };
+
+	// A tiny stateful encoding: 0x0E switches between lower and upper case for the letters that follow it. The
+	// switch is read as part of the decode step of the next letter, so a piece that ends right after it has
+	// already changed the state by the time the step reports an incomplete sequence.
+	struct toggling_ascii {
+		struct state {
+			bool upper = false;
+		};
+
+		using code_unit    = char;
+		using code_point   = char32_t;
+		using decode_state = state;
+		using encode_state = state;
+
+		static inline constexpr std::size_t max_code_units  = 2;
+		static inline constexpr std::size_t max_code_points = 1;
+		static inline constexpr char toggle                 = '\x0E';
+
+		template <typename Input, typename Output, typename ErrorHandler>
+		static constexpr auto decode_one(Input&& input, Output&& output, ErrorHandler&& error_handler, state& s) {
+			using SubInput  = ztd::ranges::csubrange_for_t<std::remove_reference_t<Input>>;
+			using SubOutput = ztd::ranges::subrange_for_t<std::remove_reference_t<Output>>;
+			using Result    = ztd::text::decode_result<SubInput, SubOutput, state>;
+
+			auto in_it    = ztd::ranges::cbegin(input);
+			auto in_last  = ztd::ranges::cend(input);
+			auto out_it   = ztd::ranges::begin(output);
+			auto out_last = ztd::ranges::end(output);
+			code_unit units[max_code_units] {};
+			std::size_t units_read = 0;
+			if (in_it != in_last && *in_it == toggle) {
+				units[units_read++] = *in_it;
+				s.upper             = !s.upper;
+				ztd::ranges::iter_advance(in_it);
+				if (in_it == in_last) {
+					return std::forward<ErrorHandler>(error_handler)(toggling_ascii {},
+					     Result(SubInput(std::move(in_it), std::move(in_last)),
+					          SubOutput(std::move(out_it), std::move(out_last)), s,
+					          ztd::text::encoding_error::incomplete_sequence),
+					     ztd::span<const code_unit>(units, units_read), ztd::span<const code_point>());
+				}
+			}
+			if (in_it == in_last) {
+				return Result(SubInput(std::move(in_it), std::move(in_last)),
+				     SubOutput(std::move(out_it), std::move(out_last)), s, ztd::text::encoding_error::ok);
+			}
+			if (out_it == out_last) {
+				return std::forward<ErrorHandler>(error_handler)(toggling_ascii {},
+				     Result(SubInput(std::move(in_it), std::move(in_last)),
+				          SubOutput(std::move(out_it), std::move(out_last)), s,
+				          ztd::text::encoding_error::insufficient_output_space),
+				     ztd::span<const code_unit>(units, units_read), ztd::span<const code_point>());
+			}
+			const char unit = *in_it;
+			ztd::ranges::iter_advance(in_it);
+			*out_it = static_cast<code_point>(s.upper && unit >= 'a' && unit <= 'z' ? unit - 'a' + 'A' : unit);
+			ztd::ranges::iter_advance(out_it);
+			return Result(SubInput(std::move(in_it), std::move(in_last)),
+			     SubOutput(std::move(out_it), std::move(out_last)), s, ztd::text::encoding_error::ok);
+		}
+
+		template <typename Input, typename Output, typename ErrorHandler>
+		static constexpr auto encode_one(Input&& input, Output&& output, ErrorHandler&&, state& s) {
+			using SubInput  = ztd::ranges::csubrange_for_t<std::remove_reference_t<Input>>;
+			using SubOutput = ztd::ranges::subrange_for_t<std::remove_reference_t<Output>>;
+			using Result    = ztd::text::encode_result<SubInput, SubOutput, state>;
+
+			auto in_it    = ztd::ranges::cbegin(input);
+			auto in_last  = ztd::ranges::cend(input);
+			auto out_it   = ztd::ranges::begin(output);
+			auto out_last = ztd::ranges::end(output);
+			if (in_it != in_last && out_it != out_last) {
+				*out_it = static_cast<code_unit>(*in_it);
+				ztd::ranges::iter_advance(in_it);
+				ztd::ranges::iter_advance(out_it);
+			}
+			return Result(SubInput(std::move(in_it), std::move(in_last)),
+			     SubOutput(std::move(out_it), std::move(out_last)), s, ztd::text::encoding_error::ok);
+		}
+	};
+
+	template <typename Transcoder, typename Input>
+	std::vector<ztd::text::code_unit_t<typename Transcoder::to_encoding_type>> stream_through(
+	     Transcoder& transcoder, const Input& input, std::size_t piece_size, std::size_t& error_count) {
+		using ToCodeUnit = ztd::text::code_unit_t<typename Transcoder::to_encoding_type>;
+		// a deliberately tiny output buffer, so that pieces also have to be fed in several goes
+		ToCodeUnit output_buffer[5] {};
+		std::vector<ToCodeUnit> output;
+		auto flush = [&](const ztd::span<ToCodeUnit>& rest) {
+			output.insert(output.cend(), std::cbegin(output_buffer), std::cend(output_buffer) - rest.size());
+		};
+		error_count = 0;
+		for (std::size_t first = 0; first < input.size(); first += piece_size) {
+			ztd::span<const ztd::text::code_unit_t<typename Transcoder::from_encoding_type>> piece(
+			     input.data() + first, std::min(piece_size, input.size() - first));
+			for (;;) {
+				auto result = transcoder.feed(piece, output_buffer);
+				flush(result.output);
+				error_count += result.error_count;
+				piece = result.input;
+				if (result.error_code == ztd::text::encoding_error::ok) {
+					REQUIRE(piece.empty());
+					break;
+				}
+				REQUIRE(result.error_code == ztd::text::encoding_error::insufficient_output_space);
+			}
+		}
+		for (;;) {
+			auto result = transcoder.finish(output_buffer);
+			flush(result.output);
+			error_count += result.error_count;
+			if (result.error_code == ztd::text::encoding_error::ok) {
+				REQUIRE(result.input.empty());
+				break;
+			}
+			REQUIRE(result.error_code == ztd::text::encoding_error::insufficient_output_space);
+		}
+		return output;
+	}
+
+	template <typename FromEncoding, typename ToEncoding, typename Input>
+	void check_stream_transcode(const Input& input) {
+		using FromCodeUnit = ztd::text::code_unit_t<FromEncoding>;
+		const ztd::span<const FromCodeUnit> input_view(std::data(input), std::size(input));
+		auto expected_result = ztd::text::transcode_to(input_view, FromEncoding {}, ToEncoding {},
+		     ztd::text::replacement_handler, ztd::text::replacement_handler);
+		ztd::text::stream_transcoder<FromEncoding, ToEncoding, ztd::text::replacement_handler_t,
+		     ztd::text::replacement_handler_t>
+		     transcoder {};
+		for (std::size_t piece_size : { 1, 2, 3, 5, 7, 64 }) {
+			std::size_t error_count = 0;
+			auto output             = stream_through(transcoder, input_view, piece_size, error_count);
+			REQUIRE(transcoder.carried().empty());
+			REQUIRE(error_count == expected_result.error_count);
+			REQUIRE(output.size() == expected_result.output.size());
+			REQUIRE(std::equal(output.cbegin(), output.cend(), expected_result.output.cbegin()));
+		}
+	}
+} // namespace ztd_text_tests_basic_run_time_stream_transcoder
+
+TEST_CASE("text/transcode/stream_transcoder",
+     "a stream transcoder produces the same output no matter how the input is split into pieces") {
+	SECTION("well-formed") {
+		SECTION("utf8 to utf16") {
+			check_stream_transcode<ztd::text::utf8_t, ztd::text::utf16_t>(
+			     ztd::tests::u8_unicode_sequence_truth_native_endian);
+		}
+		SECTION("utf16 to utf8") {
+			check_stream_transcode<ztd::text::utf16_t, ztd::text::utf8_t>(
+			     ztd::tests::u16_unicode_sequence_truth_native_endian);
+		}
+		SECTION("utf32 to utf8") {
+			check_stream_transcode<ztd::text::utf32_t, ztd::text::utf8_t>(
+			     ztd::tests::u32_unicode_sequence_truth_native_endian);
+		}
+	}
+	SECTION("ill-formed") {
+		std::vector<ztd::uchar8_t> input;
+		for (std::size_t i = 0; i < 8; ++i) {
+			input.insert(input.cend(), std::cbegin(ztd::tests::u8_unicode_sequence_truth_native_endian),
+			     std::cend(ztd::tests::u8_unicode_sequence_truth_native_endian));
+			input.insert(input.cend(), std::cbegin(u8_ill_formed), std::cend(u8_ill_formed));
+		}
+		check_stream_transcode<ztd::text::utf8_t, ztd::text::utf32_t>(input);
+	}
+	SECTION("stateful") {
+		std::string input;
+		for (std::size_t i = 0; i < 4; ++i) {
+			input += "ab\x0E" "cd\x0E" "ef";
+		}
+		REQUIRE(ztd::text::transcode(std::string_view(input), toggling_ascii {}, ztd::text::utf32_t {},
+		             ztd::text::replacement_handler, ztd::text::replacement_handler)
+		     == U"abCDefabCDefabCDefabCDef");
+		check_stream_transcode<toggling_ascii, ztd::text::utf32_t>(input);
+	}
+	SECTION("incomplete at the end of the stream") {
+		ztd::text::stream_transcoder<ztd::text::utf8_t, ztd::text::utf32_t, ztd::text::replacement_handler_t,
+		     ztd::text::replacement_handler_t>
+		     transcoder {};
+		const ztd::uchar8_t input[] = { 0x61, 0xF0, 0x9F, 0x98 };
+		char32_t output[8] {};
+		auto result = transcoder.feed(input, output);
+		REQUIRE(result.error_code == ztd::text::encoding_error::ok);
+		REQUIRE(result.error_count == 0);
+		REQUIRE(result.input.empty());
+		REQUIRE(result.output.size() == 7);
+		REQUIRE(transcoder.carried().size() == 3);
+		auto finish_result = transcoder.finish(result.output);
+		REQUIRE(finish_result.error_code == ztd::text::encoding_error::ok);
+		REQUIRE(finish_result.error_count == 1);
+		REQUIRE(finish_result.output.size() == 6);
+		REQUIRE(output[0] == U'a');
+		REQUIRE(output[1] == U'\uFFFD');
+		REQUIRE(transcoder.carried().empty());
+	}
+}
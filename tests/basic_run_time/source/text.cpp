@@ -34,6 +34,24 @@
 
 #include <ztd/text/tests/basic_unicode_strings.hpp>
 
+#include <string>
+#include <utility>
+#include <vector>
+#include <cstddef>
+
+inline namespace ztd_text_tests_basic_run_time_text {
+	struct counting_replacement_handler {
+		std::size_t* calls;
+
+		template <typename Encoding, typename Result, typename InputProgress, typename OutputProgress>
+		constexpr auto operator()(const Encoding& encoding, Result result, const InputProgress& input_progress,
+		     const OutputProgress& output_progress) const {
+			++*calls;
+			return ztd::text::replacement_handler(encoding, std::move(result), input_progress, output_progress);
+		}
+	};
+} // namespace ztd_text_tests_basic_run_time_text
+
 TEST_CASE("text/text/basic", "basic usages of text do not explode") {
 #if ZTD_IS_OFF(ZTD_COMPILER_VCXX)
 	SECTION("execution") {
@@ -58,3 +76,110 @@ TEST_CASE("text/text/basic", "basic usages of text do not explode") {
 	}
 #endif
 }
+
+TEST_CASE("text/text/modifiers", "append, insert, replace, and erase splice converted input into the storage") {
+	SECTION("utf8") {
+		ztd::text::u8text txt(U"abc");
+		txt.append(U"\U0001F600");
+		REQUIRE(ztd::text::decode(txt.base(), ztd::text::utf8) == U"abc\U0001F600");
+		txt.append(u"\u00E9");
+		REQUIRE(ztd::text::decode(txt.base(), ztd::text::utf8) == U"abc\U0001F600\u00E9");
+		txt.insert(1, U"\u2603");
+		REQUIRE(ztd::text::decode(txt.base(), ztd::text::utf8) == U"a\u2603bc\U0001F600\u00E9");
+		txt.replace(0, 4, u"xy");
+		REQUIRE(ztd::text::decode(txt.base(), ztd::text::utf8) == U"xybc\U0001F600\u00E9");
+		txt.erase(4, 4);
+		REQUIRE(ztd::text::decode(txt.base(), ztd::text::utf8) == U"xybc\u00E9");
+		txt.insert(txt.base().size(), u"!");
+		REQUIRE(ztd::text::decode(txt.base(), ztd::text::utf8) == U"xybc\u00E9!");
+		txt.clear();
+		REQUIRE(txt.base().empty());
+	}
+	SECTION("utf16") {
+		ztd::text::u16text txt(u"abc");
+		txt.append(U"\U0001F600");
+		REQUIRE(txt.base() == u"abc\U0001F600");
+		txt.insert(0, U"\u00E9", ztd::text::utf32);
+		REQUIRE(txt.base() == u"\u00E9abc\U0001F600");
+		txt.replace(1, 3, U"\u2603\u2603", ztd::text::utf32, ztd::text::replacement_handler);
+		REQUIRE(txt.base() == u"\u00E9\u2603\u2603\U0001F600");
+		txt.erase(3, 2);
+		REQUIRE(txt.base() == u"\u00E9\u2603\u2603");
+	}
+	SECTION("utf32") {
+		ztd::text::u32text txt;
+		for (int i = 0; i < 100; ++i) {
+			txt.append(u"\u00E9");
+		}
+		REQUIRE(txt.base() == std::u32string(100, U'\u00E9'));
+		txt.replace(10, 80, u"a");
+		REQUIRE(txt.base() == std::u32string(10, U'\u00E9') + U"a" + std::u32string(10, U'\u00E9'));
+	}
+	SECTION("error handler output larger than the size hint") {
+		// each invalid byte becomes a 3-byte replacement character, well past the one-unit-per-unit size hint:
+		// the rest of the input must be converted from where it stopped, not from the start again
+		const std::vector<ztd::uchar8_t> input(20, static_cast<ztd::uchar8_t>(0xFF));
+		std::size_t calls = 0;
+		ztd::text::u8text txt(U"a");
+		txt.append(input, ztd::text::utf8, counting_replacement_handler { &calls });
+		REQUIRE(calls == input.size());
+		REQUIRE(ztd::text::decode(txt.base(), ztd::text::utf8) == U"a" + std::u32string(input.size(), U'\uFFFD'));
+	}
+}
+
+TEST_CASE("text/text/code point index", "cached code point counts and positions stay correct across modifications") {
+	using storage_t = std::basic_string<ztd::text::code_unit_t<ztd::text::utf8_t>>;
+	using index_t        = ztd::text::cached_code_point_index<16>;
+	using indexed_u8text = ztd::text::basic_text<ztd::text::utf8_t, ztd::text::nfkc, storage_t, index_t>;
+	std::u32string expected;
+	for (int i = 0; i < 200; ++i) {
+		expected += U"aé☃\U0001F600";
+	}
+	indexed_u8text txt(expected);
+	ztd::text::u8text plain_txt(expected);
+	REQUIRE(txt.size() == expected.size());
+	REQUIRE(plain_txt.size() == expected.size());
+	REQUIRE(txt.code_unit_index(0) == 0);
+	REQUIRE(txt.code_unit_index(1) == 1);
+	REQUIRE(txt.code_unit_index(4) == 10);
+	REQUIRE(txt.code_unit_index(401) == 1001);
+	REQUIRE(txt.code_unit_index(expected.size()) == 2000);
+	REQUIRE(txt.code_point_index(1001) == 401);
+	REQUIRE(plain_txt.code_unit_index(401) == 1001);
+	REQUIRE(plain_txt.code_point_index(1001) == 401);
+
+	txt.insert(txt.code_unit_index(401), U"xyz");
+	expected.insert(401, U"xyz");
+	REQUIRE(txt.size() == expected.size());
+	REQUIRE(txt.code_unit_index(404) == 1004);
+	REQUIRE(txt.code_point_index(1004) == 404);
+	REQUIRE(txt.code_point_index(txt.code_unit_index(700)) == 700);
+
+	txt.erase(txt.code_unit_index(10), txt.code_unit_index(300) - txt.code_unit_index(10));
+	expected.erase(10, 290);
+	REQUIRE(txt.size() == expected.size());
+	for (std::size_t i = 0; i <= expected.size(); i += 7) {
+		REQUIRE(txt.code_point_index(txt.code_unit_index(i)) == i);
+	}
+	REQUIRE(ztd::text::decode(std::as_const(txt).base(), ztd::text::utf8) == expected);
+
+	txt.base().append(storage_t(3, static_cast<ztd::text::code_unit_t<ztd::text::utf8_t>>('b')));
+	expected += U"bbb";
+	REQUIRE(txt.size() == expected.size());
+	txt.reindex();
+	REQUIRE(txt.size() == expected.size());
+	REQUIRE(txt.code_point_index(std::as_const(txt).base().size()) == expected.size());
+
+	// a lookup on a stale index rebuilds it, so positions past the change are found through checkpoints again
+	txt.base().insert(0, storage_t(2, static_cast<ztd::text::code_unit_t<ztd::text::utf8_t>>('c')));
+	expected.insert(0, U"cc");
+	REQUIRE(txt.size() == expected.size());
+	for (std::size_t i = 0; i <= expected.size(); i += 13) {
+		REQUIRE(txt.code_point_index(txt.code_unit_index(i)) == i);
+	}
+
+	static_assert(noexcept(txt.clear()), "clearing a text with a cached index must not throw");
+	txt.clear();
+	REQUIRE(txt.size() == 0);
+	REQUIRE(txt.empty());
+}
@@ -36,6 +36,10 @@
 #include <catch2/catch_all.hpp>
 
 #include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <string>
+#include <vector>
 
 inline namespace ztd_text_tests_transcode_containers {
 	template <typename FromEncoding, typename ToEncoding, template <class...> typename Container = std::vector>
@@ -145,3 +149,60 @@ TEST_CASE(
 		check_container_roundtrip(from, to);
 	}
 }
+
+TEST_CASE("text/transcode/containers/large",
+     "the _to conversions grow containers across many chunks and keep going past handled errors") {
+	using u8string = std::basic_string<ztd::uchar8_t>;
+	u8string u8_input;
+	std::u32string u32_expected;
+	for (int i = 0; i < 300; ++i) {
+		u8_input.append(ztd::tests::u8_unicode_sequence_truth_native_endian.begin(),
+		     ztd::tests::u8_unicode_sequence_truth_native_endian.end());
+		u32_expected.append(ztd::tests::u32_unicode_sequence_truth_native_endian.begin(),
+		     ztd::tests::u32_unicode_sequence_truth_native_endian.end());
+	}
+	std::u16string u16_expected = ztd::text::transcode(u8_input, ztd::text::utf8, ztd::text::utf16);
+	SECTION("well-formed") {
+		auto decode_result = ztd::text::decode_to<std::u32string>(u8_input, ztd::text::utf8);
+		REQUIRE(decode_result.error_code == ztd::text::encoding_error::ok);
+		REQUIRE(decode_result.output == u32_expected);
+		std::vector<char32_t> vector_output = ztd::text::decode<std::vector<char32_t>>(u8_input, ztd::text::utf8);
+		REQUIRE(std::equal(vector_output.cbegin(), vector_output.cend(), u32_expected.cbegin(), u32_expected.cend()));
+		std::deque<char32_t> deque_output = ztd::text::decode<std::deque<char32_t>>(u8_input, ztd::text::utf8);
+		REQUIRE(std::equal(deque_output.cbegin(), deque_output.cend(), u32_expected.cbegin(), u32_expected.cend()));
+
+		auto encode_result = ztd::text::encode_to<u8string>(u32_expected, ztd::text::utf8);
+		REQUIRE(encode_result.error_code == ztd::text::encoding_error::ok);
+		REQUIRE(encode_result.output == u8_input);
+
+		auto transcode_result = ztd::text::transcode_to<std::u16string>(u8_input, ztd::text::utf8, ztd::text::utf16);
+		REQUIRE(transcode_result.error_code == ztd::text::encoding_error::ok);
+		REQUIRE(transcode_result.output == u16_expected);
+		std::deque<char16_t> deque_transcoded
+		     = ztd::text::transcode<std::deque<char16_t>>(u8_input, ztd::text::utf8, ztd::text::utf16);
+		REQUIRE(std::equal(deque_transcoded.cbegin(), deque_transcoded.cend(), u16_expected.cbegin(),
+		     u16_expected.cend()));
+	}
+	SECTION("reserved") {
+		u8string ascii_input(5000, static_cast<ztd::uchar8_t>('a'));
+		std::string ascii_output = ztd::text::transcode<std::string>(ascii_input, ztd::text::utf8, ztd::text::ascii);
+		REQUIRE(ascii_output == std::string(5000, 'a'));
+		std::u32string ascii_decoded = ztd::text::decode(ascii_output, ztd::text::ascii);
+		REQUIRE(ascii_decoded == std::u32string(5000, U'a'));
+	}
+	SECTION("ill-formed") {
+		const std::size_t sequence_size = ztd::tests::u8_unicode_sequence_truth_native_endian.size();
+		u8string bad_input              = u8_input;
+		bad_input.insert(sequence_size * 200, 1, static_cast<ztd::uchar8_t>(0xFF));
+		bad_input.insert(sequence_size * 100, 1, static_cast<ztd::uchar8_t>(0xFF));
+		auto decode_result = ztd::text::decode_to(bad_input, ztd::text::utf8, ztd::text::replacement_handler);
+		REQUIRE(decode_result.error_code == ztd::text::encoding_error::ok);
+		REQUIRE(decode_result.error_count == 2);
+		REQUIRE(decode_result.output.size() == u32_expected.size() + 2);
+		auto transcode_result = ztd::text::transcode_to<std::u16string>(
+		     bad_input, ztd::text::utf8, ztd::text::utf16, ztd::text::replacement_handler);
+		REQUIRE(transcode_result.error_code == ztd::text::encoding_error::ok);
+		REQUIRE(transcode_result.error_count == 2);
+		REQUIRE(transcode_result.output.size() == u16_expected.size() + 2);
+	}
+}
@@ -0,0 +1,183 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+#include <ztd/text/encoding.hpp>
+#include <ztd/text/transcode.hpp>
+#include <ztd/text/decode.hpp>
+#include <ztd/text/encode.hpp>
+
+#include <ztd/text/tests/basic_unicode_strings.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <string>
+#include <vector>
+
+inline namespace ztd_text_tests_basic_run_time_transcode_unicode {
+	template <typename Encoding, typename Source>
+	std::basic_string<ztd::text::code_unit_t<Encoding>> long_input(const Source& source) {
+		// long ASCII runs interleaved with the test sequence, so both the bulk and the single-step paths get used
+		using CodeUnit = ztd::text::code_unit_t<Encoding>;
+		std::basic_string<CodeUnit> input;
+		for (std::size_t i = 0; i < 24; ++i) {
+			input.append(37 + i * 3, static_cast<CodeUnit>('a' + (i % 26)));
+			input.append(source.data(), source.size());
+		}
+		return input;
+	}
+
+	template <typename FromEncoding, typename ToEncoding, typename Input>
+	void check_unicode_transcode(FromEncoding& from_encoding, ToEncoding& to_encoding, const Input& input) {
+		using ToCodeUnit = ztd::text::code_unit_t<ToEncoding>;
+		auto expected    = ztd::text::encode(ztd::text::decode(input, from_encoding, ztd::text::replacement_handler),
+		        to_encoding, ztd::text::replacement_handler);
+		auto result = ztd::text::transcode(
+		     input, from_encoding, to_encoding, ztd::text::replacement_handler, ztd::text::replacement_handler);
+		REQUIRE(result == expected);
+
+		// stopping short on output space must leave the input and output exactly where the single-step loop does
+		for (std::size_t output_size : { expected.size() / 2, expected.size() - 1 }) {
+			std::vector<ToCodeUnit> bulk_output(output_size);
+			std::vector<ToCodeUnit> basic_output(output_size);
+			ztd::span<const ztd::text::code_unit_t<FromEncoding>> input_view(input.data(), input.size());
+			ztd::text::decode_state_t<FromEncoding> bulk_from_state {}, basic_from_state {};
+			ztd::text::encode_state_t<ToEncoding> bulk_to_state {}, basic_to_state {};
+			ztd::text::code_point_t<FromEncoding> bulk_pivot_storage[8] {}, basic_pivot_storage[8] {};
+			auto bulk_result = ztd::text::transcode_into_raw(input_view, from_encoding,
+			     ztd::span<ToCodeUnit>(bulk_output), to_encoding, ztd::text::replacement_handler,
+			     ztd::text::replacement_handler, bulk_from_state, bulk_to_state,
+			     ztd::span<ztd::text::code_point_t<FromEncoding>>(bulk_pivot_storage));
+			auto basic_result = ztd::text::basic_transcode_into_raw(input_view, from_encoding,
+			     ztd::span<ToCodeUnit>(basic_output), to_encoding, ztd::text::replacement_handler,
+			     ztd::text::replacement_handler, basic_from_state, basic_to_state,
+			     ztd::span<ztd::text::code_point_t<FromEncoding>>(basic_pivot_storage));
+			REQUIRE(bulk_result.error_code == basic_result.error_code);
+			REQUIRE(bulk_result.error_count == basic_result.error_count);
+			REQUIRE(bulk_result.input.size() == basic_result.input.size());
+			REQUIRE(bulk_result.output.size() == basic_result.output.size());
+			REQUIRE(bulk_output == basic_output);
+		}
+	}
+
+	struct replace_until_handler {
+		std::size_t* calls;
+		std::size_t stop_at;
+
+		template <typename Encoding, typename Result, typename InputProgress, typename OutputProgress>
+		constexpr auto operator()(const Encoding& encoding, Result result, const InputProgress& input_progress,
+		     const OutputProgress& output_progress) const {
+			const ztd::text::encoding_error error_code = result.error_code;
+			auto replaced
+			     = ztd::text::replacement_handler(encoding, std::move(result), input_progress, output_progress);
+			++*calls;
+			if (*calls == stop_at) {
+				// replace this one too, but stop the transcode here
+				replaced.error_code = error_code;
+			}
+			return replaced;
+		}
+	};
+
+	template <typename FromEncoding, typename ToEncoding, typename Input>
+	void check_unicode_transcode_stops(FromEncoding& from_encoding, ToEncoding& to_encoding, const Input& input) {
+		// the first error is replaced and the second one stops the transcode: the error counts of both steps
+		// that the kernels handed off must make it into the result
+		using ToCodeUnit = ztd::text::code_unit_t<ToEncoding>;
+		std::vector<ToCodeUnit> bulk_output(input.size() * 4);
+		std::vector<ToCodeUnit> basic_output(input.size() * 4);
+		std::size_t bulk_calls = 0, basic_calls = 0;
+		replace_until_handler bulk_handler { &bulk_calls, 2 };
+		replace_until_handler basic_handler { &basic_calls, 2 };
+		ztd::span<const ztd::text::code_unit_t<FromEncoding>> input_view(input.data(), input.size());
+		ztd::text::decode_state_t<FromEncoding> bulk_from_state {}, basic_from_state {};
+		ztd::text::encode_state_t<ToEncoding> bulk_to_state {}, basic_to_state {};
+		ztd::text::code_point_t<FromEncoding> bulk_pivot_storage[8] {}, basic_pivot_storage[8] {};
+		auto bulk_result = ztd::text::transcode_into_raw(input_view, from_encoding,
+		     ztd::span<ToCodeUnit>(bulk_output), to_encoding, bulk_handler, ztd::text::replacement_handler,
+		     bulk_from_state, bulk_to_state, ztd::span<ztd::text::code_point_t<FromEncoding>>(bulk_pivot_storage));
+		auto basic_result = ztd::text::basic_transcode_into_raw(input_view, from_encoding,
+		     ztd::span<ToCodeUnit>(basic_output), to_encoding, basic_handler, ztd::text::replacement_handler,
+		     basic_from_state, basic_to_state, ztd::span<ztd::text::code_point_t<FromEncoding>>(basic_pivot_storage));
+		REQUIRE(bulk_calls == 2);
+		REQUIRE(basic_calls == 2);
+		REQUIRE(bulk_result.error_code != ztd::text::encoding_error::ok);
+		REQUIRE(bulk_result.error_code == basic_result.error_code);
+		REQUIRE(bulk_result.error_count == 2);
+		REQUIRE(bulk_result.error_count == basic_result.error_count);
+		REQUIRE(bulk_result.pivot_error_count == basic_result.pivot_error_count);
+		REQUIRE(bulk_result.input.size() == basic_result.input.size());
+		REQUIRE(bulk_result.output.size() == basic_result.output.size());
+		REQUIRE(bulk_output == basic_output);
+	}
+} // namespace ztd_text_tests_basic_run_time_transcode_unicode
+
+TEST_CASE("text/transcode/unicode", "bulk UTF-8, UTF-16, and UTF-32 transcoding matches decoding then encoding") {
+	ztd::text::utf8_t utf8 {};
+	ztd::text::utf16_t utf16 {};
+	ztd::text::utf32_t utf32 {};
+	SECTION("valid") {
+		auto u8_input  = long_input<ztd::text::utf8_t>(ztd::tests::u8_unicode_sequence_truth_native_endian);
+		auto u16_input = long_input<ztd::text::utf16_t>(ztd::tests::u16_unicode_sequence_truth_native_endian);
+		auto u32_input = long_input<ztd::text::utf32_t>(ztd::tests::u32_unicode_sequence_truth_native_endian);
+		check_unicode_transcode(utf8, utf16, u8_input);
+		check_unicode_transcode(utf8, utf32, u8_input);
+		check_unicode_transcode(utf16, utf8, u16_input);
+		check_unicode_transcode(utf16, utf32, u16_input);
+		check_unicode_transcode(utf32, utf8, u32_input);
+		check_unicode_transcode(utf32, utf16, u32_input);
+	}
+	SECTION("invalid") {
+		auto u8_input  = long_input<ztd::text::utf8_t>(ztd::tests::u8_unicode_invalid_input);
+		auto u16_input = long_input<ztd::text::utf16_t>(ztd::tests::u16_unicode_invalid_input);
+		auto u32_input = long_input<ztd::text::utf32_t>(ztd::tests::u32_unicode_invalid_input);
+		check_unicode_transcode(utf8, utf16, u8_input);
+		check_unicode_transcode(utf8, utf32, u8_input);
+		check_unicode_transcode(utf16, utf8, u16_input);
+		check_unicode_transcode(utf16, utf32, u16_input);
+		check_unicode_transcode(utf32, utf8, u32_input);
+		check_unicode_transcode(utf32, utf16, u32_input);
+	}
+	SECTION("errors in two chunks") {
+		std::basic_string<ztd::text::code_unit_t<ztd::text::utf8_t>> u8_input(300, 'a');
+		u8_input.push_back(static_cast<ztd::text::code_unit_t<ztd::text::utf8_t>>(0xFF));
+		u8_input.append(300, 'b');
+		u8_input.push_back(static_cast<ztd::text::code_unit_t<ztd::text::utf8_t>>(0xFF));
+		u8_input.append(300, 'c');
+		std::u16string u16_input(300, u'a');
+		u16_input.push_back(static_cast<char16_t>(0xD800));
+		u16_input.append(300, u'b');
+		u16_input.push_back(static_cast<char16_t>(0xDC00));
+		u16_input.append(300, u'c');
+		check_unicode_transcode_stops(utf8, utf16, u8_input);
+		check_unicode_transcode_stops(utf8, utf32, u8_input);
+		check_unicode_transcode_stops(utf16, utf8, u16_input);
+		check_unicode_transcode_stops(utf16, utf32, u16_input);
+	}
+}
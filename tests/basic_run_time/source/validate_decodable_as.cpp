@@ -35,6 +35,12 @@
 
 #include <ztd/text/tests/basic_unicode_strings.hpp>
 
+#include <ztd/idk/span.hpp>
+
+#include <cstddef>
+#include <initializer_list>
+#include <vector>
+
 inline namespace ztd_text_tests_basic_run_time_validate_decodable_as {
 	template <typename Input, typename Encoding>
 	void validate_check(Input& input, Encoding& encoding) {
@@ -43,6 +49,45 @@ inline namespace ztd_text_tests_basic_run_time_validate_decodable_as {
 		auto result1 = ztd::text::validate_decodable_as(input, encoding);
 		REQUIRE(result1);
 	}
+
+	template <typename Encoding, typename CodeUnit>
+	void check_same_as_basic(Encoding& encoding, const std::vector<CodeUnit>& input) {
+		ztd::span<const CodeUnit> input_view(input.data(), input.size());
+		ztd::text::decode_state_t<Encoding> decode_state {};
+		ztd::text::encode_state_t<Encoding> encode_state {};
+		auto expected = ztd::text::basic_validate_decodable_as(input_view, encoding, decode_state, encode_state);
+		auto result   = ztd::text::validate_decodable_as(input_view, encoding);
+		REQUIRE(result.valid == expected.valid);
+		REQUIRE(ztd::ranges::size(result.input) == ztd::ranges::size(expected.input));
+	}
+
+	template <typename Encoding, typename Source>
+	void check_bulk_validate(Encoding& encoding, const Source& source,
+		std::initializer_list<std::initializer_list<ztd::text::code_unit_t<Encoding>>> bad_sequences) {
+		using CodeUnit = ztd::text::code_unit_t<Encoding>;
+		// long ASCII runs interleaved with the test sequence, so both the vectorized and the scalar paths get used
+		std::vector<CodeUnit> input;
+		for (std::size_t i = 0; i < 6; ++i) {
+			input.insert(input.end(), 29 + i * 7, static_cast<CodeUnit>('a' + i));
+			input.insert(input.end(), source.data(), source.data() + source.size());
+		}
+		check_same_as_basic(encoding, input);
+		REQUIRE(ztd::text::validate_decodable_as(input, encoding));
+
+		// every error must be reported at exactly the position the single-step loop reports it
+		const std::size_t positions = input.size() < 160 ? input.size() : 160;
+		for (const auto& bad_sequence : bad_sequences) {
+			for (std::size_t position = 0; position <= positions; ++position) {
+				std::vector<CodeUnit> bad_input = input;
+				bad_input.insert(bad_input.begin() + position, bad_sequence.begin(), bad_sequence.end());
+				check_same_as_basic(encoding, bad_input);
+			}
+		}
+		for (std::size_t cut = 1; cut < 8; ++cut) {
+			std::vector<CodeUnit> truncated_input(input.begin(), input.end() - cut);
+			check_same_as_basic(encoding, truncated_input);
+		}
+	}
 } // namespace ztd_text_tests_basic_run_time_validate_decodable_as
 
 TEST_CASE("text/validate_decodable_as/basic", "basic usages of validate_decodable_as function do not explode") {
@@ -96,3 +141,23 @@ TEST_CASE("text/validate_decodable_as/basic", "basic usages of validate_decodabl
 		validate_check(ztd::tests::u32_unicode_sequence_truth_native_endian, encoding);
 	}
 }
+
+TEST_CASE("text/validate_decodable_as/unicode bulk",
+	"validate_decodable_as on UTF-8, UTF-16, and UTF-32 reports errors exactly where the single-step loop does") {
+	SECTION("utf8") {
+		ztd::text::utf8_t encoding {};
+		check_bulk_validate(encoding, ztd::tests::u8_unicode_sequence_truth_native_endian,
+			{ { 0x80 }, { 0xFF }, { 0xC0, 0x80 }, { 0xE0, 0x80, 0x80 }, { 0xED, 0xA0, 0x80 },
+			     { 0xF4, 0x90, 0x80, 0x80 }, { 0xF5, 0x80, 0x80, 0x80 }, { 0xE2, 0x82 }, { 0xF0, 0x9F, 0x98 } });
+	}
+	SECTION("utf16") {
+		ztd::text::utf16_t encoding {};
+		check_bulk_validate(encoding, ztd::tests::u16_unicode_sequence_truth_native_endian,
+			{ { 0xD800 }, { 0xDC00 }, { 0xDBFF, 0x41 }, { 0xDFFF, 0xD800 } });
+	}
+	SECTION("utf32") {
+		ztd::text::utf32_t encoding {};
+		check_bulk_validate(encoding, ztd::tests::u32_unicode_sequence_truth_native_endian,
+			{ { 0xD800 }, { 0xDFFF }, { 0x110000 }, { 0xFFFFFFFF } });
+	}
+}
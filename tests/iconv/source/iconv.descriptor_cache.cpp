@@ -0,0 +1,80 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================ //
+
+
+#include <ztd/text/decode.hpp>
+#include <ztd/text/encoding.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <ztd/text/tests/basic_unicode_strings.hpp>
+
+#include <utility>
+
+TEST_CASE("text/iconv/descriptor cache", "iconv states reuse conversion descriptors instead of reopening them") {
+	ztd::text::clear_iconv_descriptor_cache();
+	ztd::text::basic_iconv<char, char32_t> encoding("UTF-8");
+	{
+		ztd::text::decode_state_t<ztd::text::basic_iconv<char, char32_t>> state(encoding);
+		REQUIRE(state._M_is_valid());
+	}
+	ztd::text::iconv_descriptor_cache_statistics first_stats = ztd::text::iconv_descriptor_cache_stats();
+	REQUIRE(first_stats.misses == 1);
+	REQUIRE(first_stats.hits == 0);
+	REQUIRE(first_stats.pooled == 1);
+
+	for (int i = 0; i < 8; ++i) {
+		std::u32string result = ztd::text::decode(
+		     ztd::tests::u8_unicode_sequence_truth_native_endian, encoding, ztd::text::replacement_handler);
+		REQUIRE(result == ztd::tests::u32_unicode_sequence_truth_native_endian);
+	}
+	ztd::text::iconv_descriptor_cache_statistics reuse_stats = ztd::text::iconv_descriptor_cache_stats();
+	REQUIRE(reuse_stats.misses == 1);
+	REQUIRE(reuse_stats.hits >= 8);
+	REQUIRE(reuse_stats.pooled == 1);
+
+	SECTION("copies and moves") {
+		ztd::text::decode_state_t<ztd::text::basic_iconv<char, char32_t>> state(encoding);
+		ztd::text::decode_state_t<ztd::text::basic_iconv<char, char32_t>> copied_state(state);
+		REQUIRE(state._M_is_valid());
+		REQUIRE(copied_state._M_is_valid());
+		REQUIRE(state._M_conv_descriptor != copied_state._M_conv_descriptor);
+		ztd::text::decode_state_t<ztd::text::basic_iconv<char, char32_t>> moved_state(std::move(copied_state));
+		REQUIRE(moved_state._M_is_valid());
+		REQUIRE_FALSE(copied_state._M_is_valid());
+	}
+	SECTION("clearing") {
+		ztd::text::clear_iconv_descriptor_cache();
+		ztd::text::iconv_descriptor_cache_statistics cleared_stats = ztd::text::iconv_descriptor_cache_stats();
+		REQUIRE(cleared_stats.misses == 0);
+		REQUIRE(cleared_stats.hits == 0);
+		REQUIRE(cleared_stats.pooled == 0);
+	}
+}
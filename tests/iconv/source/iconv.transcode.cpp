@@ -30,11 +30,16 @@
 
 #include <ztd/text/encoding.hpp>
 #include <ztd/text/transcode.hpp>
+#include <ztd/text/decode.hpp>
+#include <ztd/text/encode.hpp>
 
 #include <ztd/text/tests/basic_unicode_strings.hpp>
 
 #include <catch2/catch_all.hpp>
 
+#include <algorithm>
+#include <string>
+
 inline namespace ztd_text_tests_iconv_transcode {
 	template <typename Encoding, typename Input>
 	void check_roundtrip(Encoding& encoding, Input& input) {
@@ -63,3 +68,79 @@ TEST_CASE("text/transcode/iconv", "iconv transcode can roundtrip") {
 		}
 	}
 }
+
+TEST_CASE("text/transcode/iconv/bulk",
+	"iconv conversions over whole buffers match the one-at-a-time conversions, including around errors") {
+	const ztd::text::basic_iconv<char, char32_t> utf8_encoding("UTF-8");
+	std::string utf8_input;
+	std::u32string utf32_input;
+	for (int i = 0; i < 64; ++i) {
+		utf8_input.append(ztd::tests::unicode_sequence_truth_native_endian.begin(),
+			ztd::tests::unicode_sequence_truth_native_endian.end());
+		utf32_input.append(ztd::tests::u32_unicode_sequence_truth_native_endian.begin(),
+			ztd::tests::u32_unicode_sequence_truth_native_endian.end());
+	}
+
+	SECTION("decode") {
+		std::u32string result = ztd::text::decode(utf8_input, utf8_encoding, ztd::text::replacement_handler);
+		REQUIRE(result == utf32_input);
+
+		std::string broken_input = utf8_input;
+		// between two copies of the sequence, so it does not split a valid sequence
+		broken_input.insert((broken_input.size() / 64) * 32, "\xFF\xFF");
+		std::u32string broken_result
+			= ztd::text::decode(broken_input, utf8_encoding, ztd::text::replacement_handler);
+		REQUIRE(broken_result.size() == utf32_input.size() + 2);
+		REQUIRE(std::count(broken_result.cbegin(), broken_result.cend(), U'\uFFFD')
+			== std::count(utf32_input.cbegin(), utf32_input.cend(), U'\uFFFD') + 2);
+	}
+	SECTION("encode") {
+		std::string result = ztd::text::encode(utf32_input, utf8_encoding, ztd::text::replacement_handler);
+		REQUIRE(result == utf8_input);
+	}
+	SECTION("transcode") {
+		const ztd::text::basic_iconv<char, char32_t> other_utf8_encoding("UTF-8");
+		std::string result = ztd::text::transcode(utf8_input, utf8_encoding, other_utf8_encoding,
+			ztd::text::replacement_handler, ztd::text::replacement_handler);
+		REQUIRE(result == utf8_input);
+
+		std::string broken_input = utf8_input;
+		broken_input.append("\xFF");
+		std::string broken_result = ztd::text::transcode(broken_input, utf8_encoding, other_utf8_encoding,
+			ztd::text::replacement_handler, ztd::text::replacement_handler);
+		REQUIRE(broken_result == utf8_input + "\xEF\xBF\xBD");
+	}
+}
+
+TEST_CASE("text/transcode/iconv/shift state",
+	"iconv conversions straight into a stateful encoding leave the output in its initial shift state") {
+	const ztd::text::basic_iconv<char, char32_t> utf8_encoding("UTF-8");
+	const ztd::text::basic_iconv<char, char32_t> iso2022jp_encoding("ISO-2022-JP");
+	ztd::text::encode_state_t<ztd::text::basic_iconv<char, char32_t>> probe_state(iso2022jp_encoding);
+	if (!probe_state._M_is_valid()) {
+		// this iconv cannot convert to or from ISO-2022-JP
+		return;
+	}
+	const std::string nihon        = "\xE6\x97\xA5\xE6\x9C\xAC";
+	const std::u32string u32_nihon = U"\u65E5\u672C";
+	const std::string shift_in     = "\x1B$B";
+	const std::string shift_out    = "\x1B(B";
+
+	SECTION("end of input") {
+		std::string result = ztd::text::transcode(nihon, utf8_encoding, iso2022jp_encoding,
+			ztd::text::replacement_handler, ztd::text::replacement_handler);
+		REQUIRE(result.size() > shift_in.size() + shift_out.size());
+		REQUIRE(result.compare(0, shift_in.size(), shift_in) == 0);
+		REQUIRE(result.compare(result.size() - shift_out.size(), shift_out.size(), shift_out) == 0);
+	}
+	SECTION("around an error") {
+		std::string broken_input = nihon + "\xFF" + nihon;
+		std::string result       = ztd::text::transcode(broken_input, utf8_encoding, iso2022jp_encoding,
+			ztd::text::replacement_handler, ztd::text::replacement_handler);
+		REQUIRE(result.compare(result.size() - shift_out.size(), shift_out.size(), shift_out) == 0);
+		std::u32string roundtrip = ztd::text::decode(result, iso2022jp_encoding, ztd::text::replacement_handler);
+		REQUIRE(roundtrip.size() > u32_nihon.size() * 2);
+		REQUIRE(roundtrip.compare(0, u32_nihon.size(), u32_nihon) == 0);
+		REQUIRE(roundtrip.compare(roundtrip.size() - u32_nihon.size(), u32_nihon.size(), u32_nihon) == 0);
+	}
+}
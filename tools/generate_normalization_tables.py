@@ -0,0 +1,281 @@
+#!/usr/bin/env python
+
+# =============================================================================
+#
+# ztd.text
+# Copyright © JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+# Contact: opensource@soasis.org
+#
+# Commercial License Usage
+# Licensees holding valid commercial ztd.text licenses may use this file in
+# accordance with the commercial license agreement provided with the
+# Software or, alternatively, in accordance with the terms contained in
+# a written agreement between you and Shepherd's Oasis, LLC.
+# For licensing terms and conditions see your agreement. For
+# further information contact opensource@soasis.org.
+#
+# Apache License Version 2 Usage
+# Alternatively, this file may be used under the terms of Apache License
+# Version 2.0 (the "License") for non-commercial use; you may not use this
+# file except in compliance with the License. You may obtain a copy of the
+# License at
+#
+# https://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+import argparse
+import unicodedata
+
+description = "Generates the normalization property, decomposition and composition tables used by ztd.text's normalization forms from the Unicode Character Database bundled with Python."
+
+parser = argparse.ArgumentParser(description=description)
+parser.add_argument(
+    "-o",
+    "--output",
+    help="the file to write the generated header to",
+    metavar="<file>",
+    default="include/ztd/text/detail/normalization_tables.hpp",
+)
+args = parser.parse_args()
+
+trie_limit = 0x30000
+trie_shift = 5
+trie_block_size = 1 << trie_shift
+
+hangul_s_base, hangul_s_count = 0xAC00, 11172
+hangul_l_first, hangul_l_last = 0x1100, 0x1112
+hangul_v_first, hangul_v_last = 0x1161, 0x1175
+hangul_t_first, hangul_t_last = 0x11A8, 0x11C2
+
+ccc_mask = 0x00FF
+nfd_no = 0x0100
+nfkd_no = 0x0200
+nfc_no = 0x0400
+nfkc_no = 0x0800
+composes_with_previous = 0x1000
+composes_with_next = 0x2000
+
+
+def is_surrogate(cp):
+    return 0xD800 <= cp < 0xE000
+
+
+def is_hangul_syllable(cp):
+    return hangul_s_base <= cp < hangul_s_base + hangul_s_count
+
+
+def normalize(form, cp):
+    return [ord(c) for c in unicodedata.normalize(form, chr(cp))]
+
+
+# primary composites: canonical pairs that recompose under NFC
+compositions = {}
+for cp in range(0x110000):
+    if is_surrogate(cp) or is_hangul_syllable(cp):
+        continue
+    mapping = unicodedata.decomposition(chr(cp))
+    if not mapping or mapping.startswith("<"):
+        continue
+    parts = [int(part, 16) for part in mapping.split()]
+    if len(parts) == 2 and normalize("NFC", parts[0]) == [parts[0]]:
+        if unicodedata.normalize("NFC", chr(parts[0]) + chr(parts[1])) == chr(cp):
+            compositions[(parts[0], parts[1])] = cp
+firsts = set(first for first, _ in compositions)
+seconds = set(second for _, second in compositions)
+firsts.update(range(hangul_l_first, hangul_l_last + 1))
+seconds.update(range(hangul_v_first, hangul_v_last + 1))
+seconds.update(range(hangul_t_first, hangul_t_last + 1))
+
+records = []
+mapping_data = [0]
+for cp in range(trie_limit):
+    if is_surrogate(cp):
+        records.append(0)
+        continue
+    record = unicodedata.combining(chr(cp))
+    nfd = normalize("NFD", cp)
+    nfkd = normalize("NFKD", cp)
+    if nfd != [cp]:
+        record |= nfd_no
+    if nfkd != [cp]:
+        record |= nfkd_no
+    if normalize("NFC", cp) != [cp]:
+        record |= nfc_no
+    if normalize("NFKC", cp) != [cp]:
+        record |= nfkc_no
+    if cp in seconds:
+        record |= composes_with_previous
+    if cp in firsts or (is_hangul_syllable(cp) and (cp - hangul_s_base) % 28 == 0):
+        record |= composes_with_next
+    if not is_hangul_syllable(cp) and (nfd != [cp] or nfkd != [cp]):
+        # canonical mapping (possibly empty), then the compatibility mapping (empty if it is the same)
+        record |= len(mapping_data) << 16
+        canonical = nfd if nfd != [cp] else []
+        compatibility = nfkd if nfkd != nfd else []
+        mapping_data.append(len(canonical))
+        mapping_data.extend(canonical)
+        mapping_data.append(len(compatibility))
+        mapping_data.extend(compatibility)
+    records.append(record)
+
+for cp in range(trie_limit, 0x110000):
+    assert unicodedata.combining(chr(cp)) == 0 and not unicodedata.decomposition(chr(cp))
+assert len(mapping_data) < 0x10000
+
+blocks = {}
+trie_index = []
+trie_data = []
+for block_start in range(0, trie_limit, trie_block_size):
+    block = tuple(records[block_start : block_start + trie_block_size])
+    if block not in blocks:
+        blocks[block] = len(blocks)
+        trie_data.extend(block)
+    trie_index.append(blocks[block])
+assert len(blocks) < 0x10000
+
+max_decomposition = max(
+    max(len(normalize("NFD", cp)), len(normalize("NFKD", cp))) for cp in range(trie_limit) if not is_surrogate(cp)
+)
+
+
+def quick_check_limit(flags):
+    return next(cp for cp in range(trie_limit) if records[cp] & (ccc_mask | flags))
+
+
+quick_check_limits = (
+    ("nfd", quick_check_limit(nfd_no)),
+    ("nfkd", quick_check_limit(nfkd_no)),
+    ("nfc", quick_check_limit(nfc_no | composes_with_previous)),
+    ("nfkc", quick_check_limit(nfkc_no | composes_with_previous)),
+)
+
+sorted_compositions = sorted(((first << 21) | second, composite) for (first, second), composite in compositions.items())
+
+
+def write_array(out, values):
+    line = "\t\t\t"
+    for i, value in enumerate(values):
+        item = value + ("," if i + 1 < len(values) else "")
+        if len(line.expandtabs(5)) + len(item) + 1 > 120:
+            out.write(line.rstrip() + "\n")
+            line = "\t\t\t"
+        line += item + " "
+    out.write(line.rstrip() + "\n")
+
+
+with open(__file__, "r", encoding="utf-8") as self_file:
+    license_lines = self_file.read().splitlines()[2:31]
+
+with open(args.output, "w", encoding="utf-8", newline="\n") as out:
+    out.write("// =============================================================================\n")
+    for license_line in license_lines[1:-1]:
+        out.write("//" + license_line[1:] + "\n")
+    out.write("// ============================================================================ //\n\n")
+    out.write(
+        """#pragma once
+
+#ifndef ZTD_TEXT_DETAIL_NORMALIZATION_TABLES_HPP
+#define ZTD_TEXT_DETAIL_NORMALIZATION_TABLES_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+#include <ztd/prologue.hpp>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	namespace __txt_detail {
+"""
+    )
+    out.write(
+        "\t\t// Generated by tools/generate_normalization_tables.py from the Unicode {} character database.\n"
+        "\t\t// Do not edit by hand.\n\n".format(unicodedata.unidata_version)
+    )
+    out.write(
+        """		// Each code point has a 32-bit record: the canonical combining class in the low byte, then the quick check
+		// and composition flags, then (in the top 16 bits) the offset of its decomposition mappings in
+		// __normalization_mapping_data.
+"""
+    )
+    for name, value in (
+        ("ccc_mask", ccc_mask),
+        ("nfd_no", nfd_no),
+        ("nfkd_no", nfkd_no),
+        ("nfc_no", nfc_no),
+        ("nfkc_no", nfkc_no),
+        ("composes_with_previous", composes_with_previous),
+        ("composes_with_next", composes_with_next),
+    ):
+        out.write(
+            "\t\tinline constexpr ::std::uint_least32_t __normalization_{} = {:#06x};\n".format(
+                name.ljust(len("composes_with_previous")), value
+            )
+        )
+    out.write(
+        "\n\t\t// Everything below these is a starter that each form leaves untouched.\n"
+    )
+    for name, value in quick_check_limits:
+        out.write(
+            "\t\tinline constexpr ::std::uint_least32_t {} = {:#06x};\n".format(
+                "__normalization_{}_quick_check_limit".format(name).ljust(len("__normalization_nfkc_quick_check_limit")),
+                value,
+            )
+        )
+    out.write("\n\t\t// The longest full decomposition of any single code point, in either form.\n")
+    out.write("\t\tinline constexpr ::std::size_t __normalization_max_decomposition = {};\n".format(max_decomposition))
+    out.write("\n\t\t// Code points at or above this have no normalization properties at all.\n")
+    out.write("\t\tinline constexpr ::std::uint_least32_t __normalization_trie_limit = {:#07x};\n".format(trie_limit))
+    out.write("\t\tinline constexpr ::std::size_t __normalization_trie_shift = {};\n\n".format(trie_shift))
+    out.write("\t\tinline constexpr ::std::uint_least16_t __normalization_trie_index[{}] = {{\n".format(len(trie_index)))
+    write_array(out, [str(value) for value in trie_index])
+    out.write("\t\t};\n\n")
+    out.write("\t\tinline constexpr ::std::uint_least32_t __normalization_trie_data[{}] = {{\n".format(len(trie_data)))
+    write_array(out, [hex(value) for value in trie_data])
+    out.write("\t\t};\n\n")
+    out.write(
+        """		// Full (recursively applied) decompositions: the canonical mapping's length and code points, then the
+		// compatibility mapping's length and code points. A length of 0 means no canonical mapping, or a
+		// compatibility mapping that is the same as the canonical one.
+"""
+    )
+    out.write(
+        "\t\tinline constexpr ::std::uint_least32_t __normalization_mapping_data[{}] = {{\n".format(len(mapping_data))
+    )
+    write_array(out, [hex(value) for value in mapping_data])
+    out.write("\t\t};\n\n")
+    out.write(
+        """		// Primary composites, sorted by (first << 21) | second.
+		struct __normalization_composition {
+			::std::uint_least64_t __pair;
+			::std::uint_least32_t __composite;
+		};
+
+"""
+    )
+    out.write(
+        "\t\tinline constexpr __normalization_composition __normalization_compositions[{}] = {{\n".format(
+            len(sorted_compositions)
+        )
+    )
+    write_array(out, ["{{ {}, {} }}".format(hex(pair), hex(composite)) for pair, composite in sorted_compositions])
+    out.write("\t\t};\n")
+    out.write(
+        """	} // namespace __txt_detail
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#include <ztd/epilogue.hpp>
+
+#endif
+"""
+    )